@@ -274,6 +274,7 @@ struct Agnostic_CORINFO_FIELD_INFO
     DWORD                         accessAllowed;
     Agnostic_CORINFO_HELPER_DESC  accessCalloutHelper;
     Agnostic_CORINFO_CONST_LOOKUP fieldLookup;
+    DWORD                         threadStaticSlotOffset;
 };
 
 struct DD
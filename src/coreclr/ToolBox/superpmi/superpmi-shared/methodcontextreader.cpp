@@ -70,6 +70,9 @@ MethodContextReader::MethodContextReader(
     const char* inputFileName, const int* indexes, int indexCount, char* hash, int offset, int increment)
     : fileHandle(INVALID_HANDLE_VALUE)
     , fileSize(0)
+    , fileMapping(nullptr)
+    , fileView(nullptr)
+    , viewPos(0)
     , curMCIndex(0)
     , Indexes(indexes)
     , IndexCount(indexCount)
@@ -113,13 +116,50 @@ MethodContextReader::MethodContextReader(
     if (this->fileHandle != INVALID_HANDLE_VALUE)
     {
         GetFileSizeEx(this->fileHandle, (PLARGE_INTEGER) & this->fileSize);
+        MapFile();
     }
 
     ReadExcludedMethods(mchFileName);
 }
 
+void MethodContextReader::MapFile()
+{
+#ifdef HOST_64BIT
+    // Collections can be many GB, so only map them when there is enough address space
+    if (this->fileSize == 0)
+    {
+        return;
+    }
+
+    this->fileMapping = CreateFileMappingW(this->fileHandle, NULL, PAGE_READONLY, 0, 0, nullptr);
+    if (this->fileMapping == nullptr)
+    {
+        LogDebug("Failed to map input file, reading it instead. GetLastError()=%u", GetLastError());
+        return;
+    }
+
+    this->fileView = (const unsigned char*)MapViewOfFile(this->fileMapping, FILE_MAP_READ, 0, 0, 0);
+    if (this->fileView == nullptr)
+    {
+        LogDebug("Failed to map a view of the input file, reading it instead. GetLastError()=%u", GetLastError());
+        CloseHandle(this->fileMapping);
+        this->fileMapping = nullptr;
+    }
+#endif // HOST_64BIT
+}
+
 MethodContextReader::~MethodContextReader()
 {
+    if (fileView != nullptr)
+    {
+        UnmapViewOfFile(this->fileView);
+    }
+
+    if (fileMapping != nullptr)
+    {
+        CloseHandle(this->fileMapping);
+    }
+
     if (fileHandle != INVALID_HANDLE_VALUE)
     {
         CloseHandle(this->fileHandle);
@@ -143,6 +183,11 @@ void MethodContextReader::ReleaseLock()
 
 bool MethodContextReader::atEof()
 {
+    if (this->fileView != nullptr)
+    {
+        return this->viewPos == this->fileSize;
+    }
+
     __int64 pos = 0;
     SetFilePointerEx(this->fileHandle, *(PLARGE_INTEGER)&pos, (PLARGE_INTEGER)&pos,
                      FILE_CURRENT); // LARGE_INTEGER is a crime against humanity
@@ -158,6 +203,29 @@ MethodContextBuffer MethodContextReader::ReadMethodContextNoLock(bool justSkip)
     {
         return MethodContextBuffer();
     }
+    if (this->fileView != nullptr)
+    {
+        AssertMsg(this->fileSize - this->viewPos >= (__int64)(2 + sizeof(unsigned int)), "Truncated method context");
+        const unsigned char* mcStart = this->fileView + this->viewPos;
+        AssertMsg((mcStart[0] == 'm') && (mcStart[1] == 'c'), "Didn't find magic number");
+        memcpy(&totalLen, &mcStart[2], sizeof(unsigned int));
+        AssertMsg(this->fileSize - this->viewPos >= (__int64)(2 + sizeof(unsigned int)) + totalLen + 2,
+                  "Truncated method context");
+        this->viewPos += 2 + sizeof(unsigned int) + totalLen + 2;
+
+        // Increment curMCIndex as we read or skipped another MC
+        ++curMCIndex;
+
+        if (justSkip)
+        {
+            return MethodContextBuffer(0);
+        }
+
+        // The MethodContext takes ownership of the buffer, so it has to be a copy
+        unsigned char* buff2 = new unsigned char[totalLen + 2]; // total + End Canary
+        memcpy(buff2, mcStart + 2 + sizeof(unsigned int), totalLen + 2);
+        return MethodContextBuffer(buff2, totalLen);
+    }
     Assert(ReadFile(this->fileHandle, buff, 2 + sizeof(unsigned int), &bytesRead, NULL) == TRUE);
     AssertMsg((buff[0] == 'm') && (buff[1] == 'c'), "Didn't find magic number");
     memcpy(&totalLen, &buff[2], sizeof(unsigned int));
@@ -413,6 +481,10 @@ double MethodContextReader::PercentComplete()
         // Best estimate I can come up with...
         return 100.0 * (double)this->curIndexPos / (double)this->IndexCount;
     }
+    if (this->fileView != nullptr)
+    {
+        return 100.0 * (double)this->viewPos / (double)this->fileSize;
+    }
     this->AcquireLock();
     __int64 pos = 0;
     SetFilePointerEx(this->fileHandle, *(PLARGE_INTEGER)&pos, (PLARGE_INTEGER)&pos, FILE_CURRENT);
@@ -457,6 +529,21 @@ MethodContextBuffer MethodContextReader::GetSpecificMethodContext(unsigned int m
     {
         return MethodContextBuffer(-2);
     }
+    if (this->fileView != nullptr)
+    {
+        if (pos >= this->fileSize)
+        {
+            this->ReleaseLock();
+            return MethodContextBuffer(-4);
+        }
+
+        this->viewPos = pos;
+
+        // ReadMethodContext will release the lock, but we already acquired it
+        MethodContextBuffer mcb = this->ReadMethodContext(false);
+        curMCIndex              = methodNumber;
+        return mcb;
+    }
     if (SetFilePointerEx(this->fileHandle, *(PLARGE_INTEGER)&pos, (PLARGE_INTEGER)&pos, FILE_BEGIN))
     {
         // ReadMethodContext will release the lock, but we already acquired it
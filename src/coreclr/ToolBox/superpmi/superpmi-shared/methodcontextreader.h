@@ -52,6 +52,13 @@ private:
     // The size of the MC/MCH file
     __int64 fileSize;
 
+    // The MC/MCH file mapped into memory, or nullptr to read it through fileHandle
+    HANDLE               fileMapping;
+    const unsigned char* fileView;
+
+    // Current read position in fileView
+    __int64 viewPos;
+
     // Current MC index in the input MC/MCH file
     int curMCIndex;
 
@@ -95,6 +102,9 @@ private:
     // Just a helper...
     static HANDLE OpenFile(const char* inputFile, DWORD flags = FILE_ATTRIBUTE_NORMAL);
 
+    // Map the whole input file so reading and skipping method contexts doesn't have to do I/O calls
+    void MapFile();
+
     MethodContextBuffer ReadMethodContextNoLock(bool justSkip = false);
     MethodContextBuffer ReadMethodContext(bool acquireLock, bool justSkip = false);
     MethodContextBuffer GetSpecificMethodContext(unsigned int methodNumber);
@@ -77,6 +77,11 @@ void CommandLine::DumpHelp(const char* program)
     printf("         n - method number inside the source MCH\n");
     printf("         t - method throughput time\n");
     printf("         * - all available method stats\n");
+    printf("     With two JITs and throughput stats, the total compile cycles of both\n");
+    printf("     JITs and their difference are also reported.\n");
+    printf("\n");
+    printf(" -methodStatsFile <filename>\n");
+    printf("     Emit the method statistics to 'filename' instead of filename.mc.stats.\n");
     printf("\n");
     printf(" -a[pplyDiff]\n");
     printf("     Compare the compile result generated from the provided JIT with the\n");
@@ -367,6 +372,16 @@ bool CommandLine::Parse(int argc, char* argv[], /* OUT */ Options* o)
 
                 o->methodStatsTypes = argv[i];
             }
+            else if ((_stricmp(&argv[i][1], "methodStatsFile") == 0))
+            {
+                if (++i >= argc)
+                {
+                    DumpHelp(argv[0]);
+                    return false;
+                }
+
+                o->methodStatsFilename = argv[i];
+            }
             else if ((_strnicmp(&argv[i][1], "applyDiff", argLen) == 0))
             {
                 o->applyDiff = true;
@@ -699,3 +714,15 @@ bool CommandLine::AddJitOption(int&  currArgument,
     delete[] value;
     return true;
 }
+
+void CommandLine::GetMethodStatsFilename(const Options& o, char* filename, size_t filenameSize)
+{
+    if (o.methodStatsFilename != nullptr)
+    {
+        strcpy_s(filename, filenameSize, o.methodStatsFilename);
+    }
+    else
+    {
+        sprintf_s(filename, filenameSize, "%s.stats", o.nameOfInputMethodContextFile);
+    }
+}
@@ -35,6 +35,7 @@ public:
             , indexes(nullptr)
             , hash(nullptr)
             , methodStatsTypes(nullptr)
+            , methodStatsFilename(nullptr)
             , mclFilename(nullptr)
             , diffMCLFilename(nullptr)
             , targetArchitecture(nullptr)
@@ -65,6 +66,7 @@ public:
         int*  indexes;
         char* hash;
         char* methodStatsTypes;
+        char* methodStatsFilename; // Where to write the -emitMethodStats output, or nullptr for the default.
         char* mclFilename;
         char* diffMCLFilename;
         char* targetArchitecture;
@@ -85,6 +87,9 @@ public:
                              LightWeightMap<DWORD, DWORD>** pJitOptions,
                              LightWeightMap<DWORD, DWORD>** pForceJitOptions);
 
+    // Get the name of the file -emitMethodStats writes to.
+    static void GetMethodStatsFilename(const Options& o, char* filename, size_t filenameSize);
+
 private:
     static void DumpHelp(const char* program);
 };
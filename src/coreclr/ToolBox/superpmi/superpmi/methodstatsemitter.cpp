@@ -9,16 +9,13 @@
 #include "methodstatsemitter.h"
 #include "logging.h"
 
-MethodStatsEmitter::MethodStatsEmitter(char* nameOfInput)
+MethodStatsEmitter::MethodStatsEmitter(const char* statsFilename)
 {
-    char filename[MAX_PATH + 1];
-    sprintf_s(filename, MAX_PATH + 1, "%s.stats", nameOfInput);
-
     hStatsFile =
-        CreateFileA(filename, GENERIC_WRITE, FILE_SHARE_WRITE, NULL, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+        CreateFileA(statsFilename, GENERIC_WRITE, FILE_SHARE_WRITE, NULL, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
     if (hStatsFile == INVALID_HANDLE_VALUE)
     {
-        LogError("Failed to open output file '%s'. GetLastError()=%u", filename, GetLastError());
+        LogError("Failed to open output file '%s'. GetLastError()=%u", statsFilename, GetLastError());
     }
 }
 
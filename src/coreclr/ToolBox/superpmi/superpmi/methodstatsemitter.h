@@ -18,7 +18,7 @@ private:
     HANDLE hStatsFile;
 
 public:
-    MethodStatsEmitter(char* nameOfInput);
+    MethodStatsEmitter(const char* statsFilename);
     ~MethodStatsEmitter();
 
     void Emit(int methodNumber, MethodContext* mc, ULONGLONG firstTime, ULONGLONG secondTime);
@@ -212,6 +212,9 @@ void ProcessChildStdOut(const CommandLine::Options& o,
                         int*                        excluded,
                         int*                        missing,
                         int*                        diffs,
+                        int*                        throughputMethods,
+                        ULONGLONG*                  throughputCycles1,
+                        ULONGLONG*                  throughputCycles2,
                         bool*                       usageError)
 {
     char buff[MAX_LOG_LINE_SIZE];
@@ -284,6 +287,20 @@ void ProcessChildStdOut(const CommandLine::Options& o,
             *excluded += childExcluded;
             *missing += childMissing;
         }
+        else if (strncmp(buff, g_ThroughputSummaryFixedPrefix, strlen(g_ThroughputSummaryFixedPrefix)) == 0)
+        {
+            int       childMethods = 0;
+            ULONGLONG childCycles1 = 0, childCycles2 = 0;
+            int converted = sscanf_s(buff, g_ThroughputSummaryFormatString, &childMethods, &childCycles1, &childCycles2);
+            if (converted != 3)
+            {
+                LogError("Couldn't parse status message: \"%s\"", buff);
+                continue;
+            }
+            *throughputMethods += childMethods;
+            *throughputCycles1 += childCycles1;
+            *throughputCycles2 += childCycles2;
+        }
     }
 
 Cleanup:
@@ -338,6 +355,43 @@ void MergeWorkerMCLs(char* mclFilename, char** arrWorkerMCLPath, int workerCount
         LogError("Unable to write to MCL file %s.", mclFilename);
 }
 
+// Concatenate the method stats CSV files of the workers, keeping the header row of the first one only.
+// 'arrWorkerMethodStatsPath' is an array of strings of size 'workerCount'.
+void MergeWorkerMethodStats(const char* methodStatsFilename, char** arrWorkerMethodStatsPath, int workerCount)
+{
+    FILE* fpOut = fopen(methodStatsFilename, "w");
+    if (fpOut == NULL)
+    {
+        LogError("Unable to open '%s'.", methodStatsFilename);
+        return;
+    }
+
+    char buff[MAX_LOG_LINE_SIZE];
+    for (int i = 0; i < workerCount; i++)
+    {
+        FILE* fpIn = fopen(arrWorkerMethodStatsPath[i], "r");
+        if (fpIn == NULL)
+        {
+            LogError("Unable to open '%s'.", arrWorkerMethodStatsPath[i]);
+            continue;
+        }
+
+        bool isHeader = true;
+        while (fgets(buff, MAX_LOG_LINE_SIZE, fpIn) != NULL)
+        {
+            if (!isHeader || (i == 0))
+            {
+                fputs(buff, fpOut);
+            }
+            isHeader = false;
+        }
+
+        fclose(fpIn);
+    }
+
+    fclose(fpOut);
+}
+
 #define MAX_CMDLINE_SIZE 0x1000 // 4 KB
 
 //-------------------------------------------------------------
@@ -479,6 +533,7 @@ int doParallelSuperPMI(CommandLine::Options& o)
 
     char** arrFailingMCListPath = new char*[o.workerCount];
     char** arrDiffMCListPath    = new char*[o.workerCount];
+    char** arrMethodStatsPath   = new char*[o.workerCount];
     char** arrStdOutputPath     = new char*[o.workerCount];
     char** arrStdErrorPath      = new char*[o.workerCount];
 
@@ -512,6 +567,16 @@ int doParallelSuperPMI(CommandLine::Options& o)
             arrDiffMCListPath[i] = nullptr;
         }
 
+        if (o.methodStatsTypes != nullptr)
+        {
+            arrMethodStatsPath[i] = new char[MAX_PATH];
+            sprintf_s(arrMethodStatsPath[i], MAX_PATH, "%sParallelSuperPMI-Stats-%u-%d.csv", tempPath, randNumber, i);
+        }
+        else
+        {
+            arrMethodStatsPath[i] = nullptr;
+        }
+
         arrStdOutputPath[i] = new char[MAX_PATH];
         arrStdErrorPath[i]  = new char[MAX_PATH];
 
@@ -539,6 +604,12 @@ int doParallelSuperPMI(CommandLine::Options& o)
                                       arrDiffMCListPath[i]);
         }
 
+        if (o.methodStatsTypes != nullptr)
+        {
+            bytesWritten += sprintf_s(cmdLine + bytesWritten, MAX_CMDLINE_SIZE - bytesWritten, " -methodStatsFile %s",
+                                      arrMethodStatsPath[i]);
+        }
+
         if (o.failureLimit > 0)
         {
             bytesWritten += sprintf_s(cmdLine + bytesWritten, MAX_CMDLINE_SIZE - bytesWritten, " -failureLimit %d",
@@ -625,13 +696,16 @@ int doParallelSuperPMI(CommandLine::Options& o)
         bool usageError = false; // variable to flag if we hit a usage error in SuperPMI
 
         int loaded = 0, jitted = 0, failed = 0, excluded = 0, missing = 0, diffs = 0;
+        int       throughputMethods = 0;
+        ULONGLONG throughputCycles1 = 0, throughputCycles2 = 0;
 
         // Read the stderr files and log them as errors
         // Read the stdout files and parse them for counts and log any MISSING or ISSUE errors
         for (int i = 0; i < o.workerCount; i++)
         {
             ProcessChildStdErr(arrStdErrorPath[i]);
-            ProcessChildStdOut(o, arrStdOutputPath[i], &loaded, &jitted, &failed, &excluded, &missing, &diffs, &usageError);
+            ProcessChildStdOut(o, arrStdOutputPath[i], &loaded, &jitted, &failed, &excluded, &missing, &diffs,
+                               &throughputMethods, &throughputCycles1, &throughputCycles2, &usageError);
             if (usageError)
                 break;
         }
@@ -648,6 +722,13 @@ int doParallelSuperPMI(CommandLine::Options& o)
             MergeWorkerMCLs(o.diffMCLFilename, arrDiffMCListPath, o.workerCount);
         }
 
+        if (o.methodStatsTypes != nullptr && !usageError)
+        {
+            char methodStatsFilename[MAX_PATH + 1];
+            CommandLine::GetMethodStatsFilename(o, methodStatsFilename, _countof(methodStatsFilename));
+            MergeWorkerMethodStats(methodStatsFilename, arrMethodStatsPath, o.workerCount);
+        }
+
         if (!usageError)
         {
             if (o.applyDiff)
@@ -658,6 +739,12 @@ int doParallelSuperPMI(CommandLine::Options& o)
             {
                 LogInfo(g_SummaryFormatString, loaded, jitted, failed, excluded, missing);
             }
+
+            if (throughputMethods > 0)
+            {
+                LogInfo(g_ThroughputSummaryFormatString, throughputMethods, throughputCycles1, throughputCycles2);
+                LogThroughputSummary(throughputCycles1, throughputCycles2);
+            }
         }
 
         st.Stop();
@@ -677,6 +764,10 @@ int doParallelSuperPMI(CommandLine::Options& o)
             {
                 DeleteFile(arrDiffMCListPath[i]);
             }
+            if (arrMethodStatsPath[i] != nullptr)
+            {
+                DeleteFile(arrMethodStatsPath[i]);
+            }
             DeleteFile(arrStdOutputPath[i]);
             DeleteFile(arrStdErrorPath[i]);
         }
@@ -27,6 +27,17 @@ extern int doParallelSuperPMI(CommandLine::Options& o);
 const char* const g_AllFormatStringFixedPrefix  = "Loaded ";
 const char* const g_SummaryFormatString         = "Loaded %d  Jitted %d  FailedCompile %d Excluded %d Missing %d";
 const char* const g_AsmDiffsSummaryFormatString = "Loaded %d  Jitted %d  FailedCompile %d Excluded %d Missing %d Diffs %d";
+const char* const g_ThroughputSummaryFixedPrefix  = "Throughput ";
+const char* const g_ThroughputSummaryFormatString = "Throughput Methods %d  Cycles1 %llu  Cycles2 %llu";
+
+// Log the relative compile time of the second JIT for the methods both JITs compiled.
+void LogThroughputSummary(ULONGLONG cycles1, ULONGLONG cycles2)
+{
+    if (cycles1 != 0)
+    {
+        LogInfo("JIT2 compile cycles relative to JIT1: %+.2f%%", ((double)cycles2 - (double)cycles1) * 100.0 / (double)cycles1);
+    }
+}
 
 //#define SuperPMI_ChewMemory 0x7FFFFFFF //Amount of address space to consume on startup
 
@@ -170,6 +181,11 @@ int __cdecl main(int argc, char* argv[])
     bool   collectThroughput = false;
     MCList failingToReplayMCL, diffMCL;
 
+    // Totals of the compile cycles of the two JITs for the methods both compiled successfully
+    int       throughputMethodCount = 0;
+    ULONGLONG throughputCycles1     = 0;
+    ULONGLONG throughputCycles2     = 0;
+
     CommandLine::Options o;
     if (!CommandLine::Parse(argc, argv, &o))
     {
@@ -217,7 +233,9 @@ int __cdecl main(int argc, char* argv[])
 
     if (o.methodStatsTypes != nullptr)
     {
-        methodStatsEmitter = new MethodStatsEmitter(o.nameOfInputMethodContextFile);
+        char statsFilename[MAX_PATH + 1];
+        CommandLine::GetMethodStatsFilename(o, statsFilename, _countof(statsFilename));
+        methodStatsEmitter = new MethodStatsEmitter(statsFilename);
         methodStatsEmitter->SetStatsTypes(o.methodStatsTypes);
     }
 
@@ -478,6 +496,10 @@ int __cdecl main(int argc, char* argv[])
                         }
                     }
 
+                    throughputMethodCount++;
+                    throughputCycles1 += crl->clockCyclesToCompile;
+                    throughputCycles2 += mc->cr->clockCyclesToCompile;
+
                     if (methodStatsEmitter != nullptr)
                     {
                         methodStatsEmitter->Emit(reader->GetMethodContextIndex(), mc, crl->clockCyclesToCompile,
@@ -596,6 +618,12 @@ int __cdecl main(int argc, char* argv[])
         LogInfo(g_SummaryFormatString, loadedCount, jittedCount, failToReplayCount, excludedCount, missingCount);
     }
 
+    if (collectThroughput && (o.nameOfJit2 != nullptr))
+    {
+        LogInfo(g_ThroughputSummaryFormatString, throughputMethodCount, throughputCycles1, throughputCycles2);
+        LogThroughputSummary(throughputCycles1, throughputCycles2);
+    }
+
     st2.Stop();
     LogVerbose("Total time: %fms", st2.GetMilliseconds());
 
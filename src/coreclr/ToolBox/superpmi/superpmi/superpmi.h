@@ -11,6 +11,10 @@ extern const char* const g_SuperPMIUsageFirstLine;
 extern const char* const g_AllFormatStringFixedPrefix;
 extern const char* const g_SummaryFormatString;
 extern const char* const g_AsmDiffsSummaryFormatString;
+extern const char* const g_ThroughputSummaryFormatString;
+extern const char* const g_ThroughputSummaryFixedPrefix;
+
+void LogThroughputSummary(ULONGLONG cycles1, ULONGLONG cycles2);
 
 enum class SpmiResult
 {
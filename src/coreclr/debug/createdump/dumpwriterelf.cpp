@@ -2,6 +2,210 @@
 // The .NET Foundation licenses this file to you under the MIT license.
 
 #include "createdump.h"
+#include <pthread.h>
+
+// Reads the memory regions of the target on a separate thread so that reading the next
+// chunk of memory overlaps with writing the previous one to the core file.
+class MemoryRegionReader
+{
+private:
+    struct Chunk
+    {
+        BYTE* Buffer;
+        size_t Size;
+        bool Filled;
+    };
+
+    CrashInfo& m_crashInfo;
+    std::set<MemoryRegion> m_memoryRegions;
+    Chunk m_chunks[MEMORY_CHUNK_COUNT];
+    size_t m_readIndex;
+    size_t m_writeIndex;
+    pthread_t m_thread;
+    pthread_mutex_t m_lock;
+    pthread_cond_t m_condition;
+    bool m_started;
+    bool m_completed;
+    bool m_failed;
+    bool m_canceled;
+
+public:
+    MemoryRegionReader(CrashInfo& crashInfo) :
+        m_crashInfo(crashInfo),
+        m_memoryRegions(crashInfo.MemoryRegions()),
+        m_readIndex(0),
+        m_writeIndex(0),
+        m_started(false),
+        m_completed(false),
+        m_failed(false),
+        m_canceled(false)
+    {
+        memset(m_chunks, 0, sizeof(m_chunks));
+        pthread_mutex_init(&m_lock, nullptr);
+        pthread_cond_init(&m_condition, nullptr);
+    }
+
+    ~MemoryRegionReader()
+    {
+        if (m_started)
+        {
+            Cancel();
+            pthread_join(m_thread, nullptr);
+        }
+        for (Chunk& chunk : m_chunks)
+        {
+            free(chunk.Buffer);
+        }
+        pthread_cond_destroy(&m_condition);
+        pthread_mutex_destroy(&m_lock);
+    }
+
+    // Returns false if the reader thread could not be started
+    bool Start()
+    {
+        for (Chunk& chunk : m_chunks)
+        {
+            chunk.Buffer = (BYTE*)malloc(MEMORY_CHUNK_SIZE);
+            if (chunk.Buffer == nullptr) {
+                return false;
+            }
+        }
+        m_started = pthread_create(&m_thread, nullptr, ReaderThread, this) == 0;
+        return m_started;
+    }
+
+    // Waits for the next chunk of memory in region order. Returns false once all the regions
+    // have been read or if reading failed, the chunk must be released after it is written.
+    bool GetChunk(const BYTE** buffer, size_t* size)
+    {
+        pthread_mutex_lock(&m_lock);
+        Chunk& chunk = m_chunks[m_writeIndex];
+        while (!chunk.Filled && !m_completed) {
+            pthread_cond_wait(&m_condition, &m_lock);
+        }
+        bool result = chunk.Filled;
+        pthread_mutex_unlock(&m_lock);
+
+        *buffer = chunk.Buffer;
+        *size = chunk.Size;
+        return result;
+    }
+
+    void ReleaseChunk()
+    {
+        pthread_mutex_lock(&m_lock);
+        m_chunks[m_writeIndex].Filled = false;
+        m_writeIndex = (m_writeIndex + 1) % MEMORY_CHUNK_COUNT;
+        pthread_cond_broadcast(&m_condition);
+        pthread_mutex_unlock(&m_lock);
+    }
+
+    void Cancel()
+    {
+        pthread_mutex_lock(&m_lock);
+        m_canceled = true;
+        pthread_cond_broadcast(&m_condition);
+        pthread_mutex_unlock(&m_lock);
+    }
+
+    bool Failed()
+    {
+        pthread_mutex_lock(&m_lock);
+        bool failed = m_failed;
+        pthread_mutex_unlock(&m_lock);
+        return failed;
+    }
+
+private:
+    static void* ReaderThread(void* context)
+    {
+        MemoryRegionReader* reader = (MemoryRegionReader*)context;
+        bool succeeded = reader->ReadMemoryRegions();
+
+        pthread_mutex_lock(&reader->m_lock);
+        reader->m_failed = !succeeded;
+        reader->m_completed = true;
+        pthread_cond_broadcast(&reader->m_condition);
+        pthread_mutex_unlock(&reader->m_lock);
+        return nullptr;
+    }
+
+    bool ReadMemoryRegions()
+    {
+        for (const MemoryRegion& memoryRegion : m_memoryRegions)
+        {
+            if (!memoryRegion.IsBackedByMemory()) {
+                continue;
+            }
+            uint64_t address = memoryRegion.StartAddress();
+            size_t size = memoryRegion.Size();
+
+            while (size > 0)
+            {
+                pthread_mutex_lock(&m_lock);
+                Chunk& chunk = m_chunks[m_readIndex];
+                while (chunk.Filled && !m_canceled) {
+                    pthread_cond_wait(&m_condition, &m_lock);
+                }
+                bool canceled = m_canceled;
+                pthread_mutex_unlock(&m_lock);
+
+                if (canceled) {
+                    return false;
+                }
+
+                // Fill the whole chunk, one read per chunk usually covers it
+                size_t bytesToRead = std::min(size, (size_t)MEMORY_CHUNK_SIZE);
+                size_t total = 0;
+                while (total < bytesToRead)
+                {
+                    size_t read = 0;
+                    if (!m_crashInfo.ReadProcessMemory((void*)(address + total), chunk.Buffer + total, bytesToRead - total, &read)) {
+                        fprintf(stderr, "ReadProcessMemory(%" PRIA PRIx64 ", %08zx) FAILED\n", address + total, bytesToRead - total);
+                        return false;
+                    }
+
+                    // This can happen if the target process dies before createdump is finished
+                    if (read == 0) {
+                        fprintf(stderr, "ReadProcessMemory(%" PRIA PRIx64 ", %08zx) returned 0 bytes read\n", address + total, bytesToRead - total);
+                        return false;
+                    }
+                    total += read;
+                }
+
+                pthread_mutex_lock(&m_lock);
+                chunk.Size = bytesToRead;
+                chunk.Filled = true;
+                m_readIndex = (m_readIndex + 1) % MEMORY_CHUNK_COUNT;
+                pthread_cond_broadcast(&m_condition);
+                pthread_mutex_unlock(&m_lock);
+
+                address += bytesToRead;
+                size -= bytesToRead;
+            }
+        }
+        return true;
+    }
+};
+
+static bool
+IsZeroPage(const BYTE* buffer, size_t size)
+{
+    const uint64_t* words = (const uint64_t*)buffer;
+    for (size_t i = 0; i < size / sizeof(uint64_t); i++)
+    {
+        if (words[i] != 0) {
+            return false;
+        }
+    }
+    for (size_t i = size & ~(sizeof(uint64_t) - 1); i < size; i++)
+    {
+        if (buffer[i] != 0) {
+            return false;
+        }
+    }
+    return true;
+}
 
 // Write the core dump file:
 //   ELF header
@@ -167,48 +371,121 @@ DumpWriter::WriteDump()
 
     TRACE("Writing %" PRIu64 " memory regions to core file\n", phnum - 1);
 
-    // Read from target process and write memory regions to core
+    return WriteMemoryRegions();
+}
+
+// Read from target process and write memory regions to core
+bool
+DumpWriter::WriteMemoryRegions()
+{
+    m_sparseFile = true;
+    m_endsWithHole = false;
+
     uint64_t total = 0;
-    for (const MemoryRegion& memoryRegion : m_crashInfo.MemoryRegions())
+    MemoryRegionReader reader(m_crashInfo);
+    if (reader.Start())
     {
-        // Only write the regions that are backed by memory
-        if (memoryRegion.IsBackedByMemory())
+        const BYTE* buffer;
+        size_t size;
+        while (reader.GetChunk(&buffer, &size))
         {
-            uint64_t address = memoryRegion.StartAddress();
-            size_t size = memoryRegion.Size();
+            if (!WriteMemoryData(buffer, size)) {
+                return false;
+            }
+            reader.ReleaseChunk();
             total += size;
+        }
+        if (reader.Failed()) {
+            return false;
+        }
+    }
+    else
+    {
+        TRACE("Reading memory regions on the writer thread\n");
 
-            while (size > 0)
+        for (const MemoryRegion& memoryRegion : m_crashInfo.MemoryRegions())
+        {
+            // Only write the regions that are backed by memory
+            if (memoryRegion.IsBackedByMemory())
             {
-                size_t bytesToRead = std::min(size, sizeof(m_tempBuffer));
-                size_t read = 0;
-
-                if (!m_crashInfo.ReadProcessMemory((void*)address, m_tempBuffer, bytesToRead, &read)) {
-                    fprintf(stderr, "ReadProcessMemory(%" PRIA PRIx64 ", %08zx) FAILED\n", address, bytesToRead);
-                    return false;
-                }
-
-                // This can happen if the target process dies before createdump is finished
-                if (read == 0) {
-                    fprintf(stderr, "ReadProcessMemory(%" PRIA PRIx64 ", %08zx) returned 0 bytes read\n", address, bytesToRead);
-                    return false;
-                }
-
-                if (!WriteData(m_tempBuffer, read)) {
-                    return false;
+                uint64_t address = memoryRegion.StartAddress();
+                size_t size = memoryRegion.Size();
+                total += size;
+
+                while (size > 0)
+                {
+                    size_t bytesToRead = std::min(size, sizeof(m_tempBuffer));
+                    size_t read = 0;
+
+                    if (!m_crashInfo.ReadProcessMemory((void*)address, m_tempBuffer, bytesToRead, &read)) {
+                        fprintf(stderr, "ReadProcessMemory(%" PRIA PRIx64 ", %08zx) FAILED\n", address, bytesToRead);
+                        return false;
+                    }
+
+                    // This can happen if the target process dies before createdump is finished
+                    if (read == 0) {
+                        fprintf(stderr, "ReadProcessMemory(%" PRIA PRIx64 ", %08zx) returned 0 bytes read\n", address, bytesToRead);
+                        return false;
+                    }
+
+                    if (!WriteMemoryData(m_tempBuffer, read)) {
+                        return false;
+                    }
+
+                    address += read;
+                    size -= read;
                 }
-
-                address += read;
-                size -= read;
             }
         }
     }
 
+    // A trailing hole is not part of the file until its size is set
+    if (m_endsWithHole)
+    {
+        off64_t end = lseek64(m_fd, 0, SEEK_CUR);
+        if (end == -1 || ftruncate64(m_fd, end) == -1) {
+            fprintf(stderr, "Setting the core file size FAILED %d %s\n", errno, strerror(errno));
+            return false;
+        }
+    }
+
     printf("Written %" PRId64 " bytes (%" PRId64 " pages) to core file\n", total, total / PAGE_SIZE);
 
     return true;
 }
 
+// Write memory contents to the core file, runs of zero pages are skipped over
+// and left as holes when the core file supports seeking.
+bool
+DumpWriter::WriteMemoryData(const BYTE* buffer, size_t length)
+{
+    size_t offset = 0;
+    while (offset < length)
+    {
+        size_t start = offset;
+        bool zero = IsZeroPage(buffer + offset, std::min(length - offset, (size_t)PAGE_SIZE));
+        do {
+            offset += std::min(length - offset, (size_t)PAGE_SIZE);
+        } while (offset < length && IsZeroPage(buffer + offset, std::min(length - offset, (size_t)PAGE_SIZE)) == zero);
+
+        if (zero && m_sparseFile)
+        {
+            if (lseek64(m_fd, offset - start, SEEK_CUR) != -1) {
+                m_endsWithHole = true;
+                continue;
+            }
+            // Pipes and the like can't seek, the zeros are written out then
+            m_sparseFile = false;
+        }
+
+        if (!WriteData(buffer + start, offset - start)) {
+            return false;
+        }
+        m_endsWithHole = false;
+    }
+    return true;
+}
+
 bool
 DumpWriter::WriteProcessInfo()
 {
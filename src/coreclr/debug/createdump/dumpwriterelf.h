@@ -29,12 +29,18 @@
 #define NT_FILE		0x46494c45
 #endif
 
+// Target memory is read in chunks of this size, one chunk is read while the previous one is written
+#define MEMORY_CHUNK_SIZE (1024 * 1024)
+#define MEMORY_CHUNK_COUNT 2
+
 class DumpWriter
 {
 private:
     int m_fd;
     CrashInfo& m_crashInfo;
     BYTE m_tempBuffer[0x4000];
+    bool m_sparseFile;
+    bool m_endsWithHole;
 
 public:
     DumpWriter(CrashInfo& crashInfo);
@@ -48,6 +54,8 @@ private:
     size_t GetNTFileInfoSize(size_t* alignmentBytes = nullptr);
     bool WriteNTFileInfo();
     bool WriteThread(const ThreadInfo& thread, int fatal_signal);
+    bool WriteMemoryRegions();
+    bool WriteMemoryData(const BYTE* buffer, size_t length);
     bool WriteData(const void* buffer, size_t length);
 
     size_t GetProcessInfoSize() const { return sizeof(Nhdr) + 8 + sizeof(prpsinfo_t); }
@@ -2057,6 +2057,149 @@ void DacInstanceManager::Flush(bool fSaveBlock)
 #endif //DAC_HASHTABLE
 
     InitEmpty();
+
+    m_pageCache.Flush(fSaveBlock);
+}
+
+DacTargetPageCache::DacTargetPageCache(void)
+    : m_enabled(true),
+      m_data(NULL)
+{
+    Flush(true);
+}
+
+DacTargetPageCache::~DacTargetPageCache(void)
+{
+    delete [] m_data;
+}
+
+void
+DacTargetPageCache::Flush(bool fSaveMemory)
+{
+    SUPPORTS_DAC_HOST_ONLY;
+
+    for (ULONG32 i = 0; i < DAC_PAGE_CACHE_PAGE_COUNT; i++)
+    {
+        m_pages[i] = InvalidPage;
+    }
+    m_nextReadPage = InvalidPage;
+
+    if (!fSaveMemory)
+    {
+        delete [] m_data;
+        m_data = NULL;
+    }
+}
+
+HRESULT
+DacTargetPageCache::Read(ICorDebugDataTarget* pTarget, TADDR addr, PBYTE buffer,
+                         ULONG32 size, ULONG32* pReturned)
+{
+    SUPPORTS_DAC_HOST_ONLY;
+
+    if (m_enabled && size > 0 && size <= DAC_PAGE_CACHE_PAGE_SIZE)
+    {
+        TADDR page = addr & ~((TADDR)DAC_PAGE_CACHE_PAGE_SIZE - 1);
+        ULONG32 offset = (ULONG32)(addr - page);
+        ULONG32 firstSize = min(size, (ULONG32)DAC_PAGE_CACHE_PAGE_SIZE - offset);
+
+        // The caller has checked that addr + size doesn't overflow, so a read
+        // that spills over into a second page can always address it.
+        PBYTE firstData = FindOrReadPage(pTarget, page);
+        PBYTE secondData = NULL;
+        if (firstData != NULL && firstSize < size)
+        {
+            secondData = FindOrReadPage(pTarget, page + DAC_PAGE_CACHE_PAGE_SIZE);
+        }
+
+        if (firstData != NULL && (firstSize == size || secondData != NULL))
+        {
+            memcpy(buffer, firstData + offset, firstSize);
+            if (firstSize < size)
+            {
+                memcpy(buffer + firstSize, secondData, size - firstSize);
+            }
+
+            *pReturned = size;
+            return S_OK;
+        }
+    }
+
+    // Too large to be worth caching, or the target doesn't have the whole page,
+    // which is common in mini dumps. The exact range may still be readable.
+    return pTarget->ReadVirtual(addr, buffer, size, pReturned);
+}
+
+PBYTE
+DacTargetPageCache::FindOrReadPage(ICorDebugDataTarget* pTarget, TADDR page)
+{
+    SUPPORTS_DAC_HOST_ONLY;
+
+    ULONG32 slot = GetSlot(page);
+    if (m_pages[slot] == page)
+    {
+        return m_data + slot * DAC_PAGE_CACHE_PAGE_SIZE;
+    }
+
+    if (m_data == NULL)
+    {
+        m_data = new (nothrow) BYTE[DAC_PAGE_CACHE_PAGE_COUNT * DAC_PAGE_CACHE_PAGE_SIZE];
+        if (m_data == NULL)
+        {
+            return NULL;
+        }
+    }
+
+    // Only read ahead when this miss continues the previous one. Random access
+    // would just pay for pages that are never used.
+    ULONG32 count = 1;
+    if (page == m_nextReadPage)
+    {
+        // The chunk has to map to consecutive slots, and must not wrap the
+        // target address space.
+        count = min((ULONG32)DAC_PAGE_CACHE_READ_AHEAD_PAGES, DAC_PAGE_CACHE_PAGE_COUNT - slot);
+        TADDR pagesLeft = ((TADDR)-1 - page) / DAC_PAGE_CACHE_PAGE_SIZE + 1;
+        if (pagesLeft < count)
+        {
+            count = (ULONG32)pagesLeft;
+        }
+    }
+
+    PBYTE data = m_data + slot * DAC_PAGE_CACHE_PAGE_SIZE;
+    for (;;)
+    {
+        // The read may clobber these slots even when it fails.
+        for (ULONG32 i = 0; i < count; i++)
+        {
+            m_pages[slot + i] = InvalidPage;
+        }
+
+        ULONG32 returned = 0;
+        HRESULT hr = pTarget->ReadVirtual(page, data, count * DAC_PAGE_CACHE_PAGE_SIZE, &returned);
+        if (hr == S_OK && returned >= DAC_PAGE_CACHE_PAGE_SIZE)
+        {
+            // Keep whatever complete pages a short read produced.
+            count = min(count, returned / DAC_PAGE_CACHE_PAGE_SIZE);
+            break;
+        }
+
+        if (count == 1)
+        {
+            return NULL;
+        }
+
+        // Some of the pages ahead are missing from the target, fall back to
+        // the one that was asked for.
+        count = 1;
+    }
+
+    for (ULONG32 i = 0; i < count; i++)
+    {
+        m_pages[slot + i] = page + i * DAC_PAGE_CACHE_PAGE_SIZE;
+    }
+    m_nextReadPage = page + count * DAC_PAGE_CACHE_PAGE_SIZE;
+
+    return data;
 }
 
 #if defined(DAC_HASHTABLE)
@@ -3291,6 +3434,10 @@ ClrDataAccess::QueryInterface(THIS_
     {
         ifaceRet = static_cast<ISOSDacInterface10*>(this);
     }
+    else if (IsEqualIID(interfaceId, __uuidof(ISOSDacInterface11)))
+    {
+        ifaceRet = static_cast<ISOSDacInterface11*>(this);
+    }
     else
     {
         *iface = NULL;
@@ -270,6 +270,11 @@ DacDbiInterfaceImpl::DacDbiInterfaceImpl(
     // This overrides the assignment in the base class ctor (which runs first).
     m_fEnableDllVerificationAsserts = true;
 #endif
+
+    // The right side writes to the target through its own data target (patches,
+    // SetValue), which the DAC never sees, so cached pages could go stale
+    // while the process is stopped.
+    m_instances.EnableTargetPageCache(false);
 }
 
 //-----------------------------------------------------------------------------
@@ -160,8 +160,8 @@ DacReadAll(TADDR addr, PVOID buffer, ULONG32 size, bool throwEx)
     nStart = GetCycleCount();
 #endif // #if defined(DAC_MEASURE_PERF)
 
-    status = g_dacImpl->m_pTarget->
-        ReadVirtual(addr, (PBYTE)buffer, size, &returned);
+    status = g_dacImpl->m_instances.
+        ReadTarget(g_dacImpl->m_pTarget, addr, (PBYTE)buffer, size, &returned);
 
 #if defined(DAC_MEASURE_PERF)
     nEnd = GetCycleCount();
@@ -201,6 +201,8 @@ DacWriteAll(TADDR addr, PVOID buffer, ULONG32 size, bool throwEx)
 
     HRESULT status;
 
+    g_dacImpl->m_instances.FlushTargetPages();
+
     status = g_dacImpl->m_pMutableTarget->WriteVirtual(addr, (PBYTE)buffer, size);
     if (status != S_OK)
     {
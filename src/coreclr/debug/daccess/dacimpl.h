@@ -674,6 +674,63 @@ struct DumpMemoryReportStatics
 };
 
 
+//
+// Cache of target memory pages for DacReadAll.
+//
+// Dump analysis reads the target in many small pieces (method table pointers,
+// object headers, fields), and every ReadVirtual call on the data target has a
+// fixed cost that dwarfs the copy. The cache keeps whole target pages so that
+// neighbouring reads are served locally, and reads a few pages ahead when it
+// notices a sequential scan such as a heap walk.
+//
+// Like the instance cache, this assumes that the target doesn't change until
+// the next Flush.
+//
+#define DAC_PAGE_CACHE_PAGE_SIZE 0x1000
+#define DAC_PAGE_CACHE_PAGE_COUNT 1024
+#define DAC_PAGE_CACHE_READ_AHEAD_PAGES 16
+
+class DacTargetPageCache
+{
+public:
+    DacTargetPageCache(void);
+    ~DacTargetPageCache(void);
+
+    // Reads are served from the cache when it's enabled and the request is at
+    // most a page. Anything else, or a page the target can't provide in full,
+    // goes straight to the data target.
+    HRESULT Read(ICorDebugDataTarget* pTarget, TADDR addr, PBYTE buffer,
+                 ULONG32 size, ULONG32* pReturned);
+
+    void Enable(bool enable)
+    {
+        SUPPORTS_DAC_HOST_ONLY;
+        m_enabled = enable;
+        Flush(false);
+    }
+
+    void Flush(bool fSaveMemory);
+
+private:
+    // Page addresses are aligned, so this never matches a real page.
+    static const TADDR InvalidPage = 1;
+
+    static ULONG32 GetSlot(TADDR page)
+    {
+        LIMITED_METHOD_CONTRACT;
+        return (ULONG32)(page / DAC_PAGE_CACHE_PAGE_SIZE) & (DAC_PAGE_CACHE_PAGE_COUNT - 1);
+    }
+
+    PBYTE FindOrReadPage(ICorDebugDataTarget* pTarget, TADDR page);
+
+    bool m_enabled;
+    // Allocated on first use, DAC_PAGE_CACHE_PAGE_COUNT pages.
+    PBYTE m_data;
+    TADDR m_pages[DAC_PAGE_CACHE_PAGE_COUNT];
+    // One past the last page filled on a miss, used to detect sequential scans.
+    TADDR m_nextReadPage;
+};
+
 class DacInstanceManager
 {
 public:
@@ -700,6 +757,26 @@ public:
 
     UINT DumpAllInstances(ICLRDataEnumMemoryRegionsCallback *pCallBack);
 
+    HRESULT ReadTarget(ICorDebugDataTarget* pTarget, TADDR addr, PBYTE buffer,
+                       ULONG32 size, ULONG32* pReturned)
+    {
+        SUPPORTS_DAC_HOST_ONLY;
+        return m_pageCache.Read(pTarget, addr, buffer, size, pReturned);
+    }
+
+    // Drops the cached pages without touching the instances, for writes to the target.
+    void FlushTargetPages(void)
+    {
+        SUPPORTS_DAC_HOST_ONLY;
+        m_pageCache.Flush(true);
+    }
+
+    void EnableTargetPageCache(bool enable)
+    {
+        SUPPORTS_DAC_HOST_ONLY;
+        m_pageCache.Enable(enable);
+    }
+
 private:
 
     DAC_INSTANCE_BLOCK* FindInstanceBlock(DAC_INSTANCE* inst);
@@ -811,6 +888,8 @@ private:
 
     DAC_INSTANCE* m_superseded;
     DAC_INSTANCE_PUSH* m_instPushed;
+
+    DacTargetPageCache m_pageCache;
 };
 
 
@@ -839,7 +918,8 @@ class ClrDataAccess
       public ISOSDacInterface7,
       public ISOSDacInterface8,
       public ISOSDacInterface9,
-      public ISOSDacInterface10
+      public ISOSDacInterface10,
+      public ISOSDacInterface11
 {
 public:
     ClrDataAccess(ICorDebugDataTarget * pTarget, ICLRDataTarget * pLegacyTarget=0);
@@ -1213,6 +1293,9 @@ public:
     virtual HRESULT STDMETHODCALLTYPE GetComWrappersCCWData(CLRDATA_ADDRESS ccw, CLRDATA_ADDRESS *managedObject, int *refCount);
     virtual HRESULT STDMETHODCALLTYPE IsComWrappersRCW(CLRDATA_ADDRESS rcw, BOOL *isComWrappersRCW);
     virtual HRESULT STDMETHODCALLTYPE GetComWrappersRCWData(CLRDATA_ADDRESS rcw, CLRDATA_ADDRESS *identity);
+
+    // ISOSDacInterface11
+    virtual HRESULT STDMETHODCALLTYPE GetHeapObjectsInRange(CLRDATA_ADDRESS start, CLRDATA_ADDRESS end, unsigned int count, SOSHeapObjectData *objects, unsigned int *pFetched, CLRDATA_ADDRESS *pNext);
     //
     // ClrDataAccess.
     //
@@ -1159,6 +1159,7 @@ HRESULT ClrDataAccess::GetTieredVersions(
                     nativeCodeAddrs[count].OptimizationTier = DacpTieredVersionData::OptimizationTier_Unknown;
                     break;
                 case NativeCodeVersion::OptimizationTier0:
+                case NativeCodeVersion::OptimizationTier0Instrumented:
                     nativeCodeAddrs[count].OptimizationTier = DacpTieredVersionData::OptimizationTier_QuickJitted;
                     break;
                 case NativeCodeVersion::OptimizationTier1:
@@ -5034,3 +5035,55 @@ HRESULT ClrDataAccess::GetComWrappersRCWData(CLRDATA_ADDRESS rcw, CLRDATA_ADDRES
     return E_NOTIMPL;
 #endif // FEATURE_COMWRAPPERS
 }
+
+HRESULT ClrDataAccess::GetHeapObjectsInRange(CLRDATA_ADDRESS start, CLRDATA_ADDRESS end, unsigned int count,
+                                             SOSHeapObjectData *objects, unsigned int *pFetched, CLRDATA_ADDRESS *pNext)
+{
+    if (start >= end || (count > 0 && objects == NULL) || pFetched == NULL)
+        return E_INVALIDARG;
+
+    SOSDacEnter();
+
+    *pFetched = 0;
+    if (pNext != NULL)
+        *pNext = 0;
+
+    // Unlike GetObjectData this reads only the method table and size of each object, which
+    // the heap walker gets through its linear read cache, so a tool can enumerate the heap in
+    // a few calls instead of one per object. Free objects are included, callers can tell them
+    // apart by their method table.
+    DacHeapWalker walker;
+    hr = walker.Init(start, end - 1);
+
+    unsigned int i = 0;
+    while (SUCCEEDED(hr) && i < count && walker.HasMoreObjects())
+    {
+        CORDB_ADDRESS addr, mt;
+        ULONG64 size;
+        hr = walker.Next(&addr, &mt, &size);
+        if (SUCCEEDED(hr))
+        {
+            objects[i].Address = addr;
+            objects[i].MethodTable = mt;
+            objects[i].Size = size;
+            i++;
+        }
+    }
+
+    *pFetched = i;
+
+    if (SUCCEEDED(hr) && walker.HasMoreObjects())
+    {
+        // Next hands out the current object before it moves on, so the address is
+        // valid even if the walker can't get past it.
+        CORDB_ADDRESS next = 0;
+        walker.Next(&next, NULL, NULL);
+        if (pNext != NULL)
+            *pNext = next;
+
+        hr = S_FALSE;
+    }
+
+    SOSDacLeave();
+    return hr;
+}
@@ -60,7 +60,8 @@ CordbFunctionBreakpoint::CordbFunctionBreakpoint(CordbCode *code,
                                                  BOOL offsetIsIl)
   : CordbBreakpoint(code->GetProcess(), CBT_FUNCTION),
   m_code(code), m_offset(offset),
-  m_offsetIsIl(offsetIsIl)
+  m_offsetIsIl(offsetIsIl),
+  m_hasCondition(false)
 {
     // Remember the app domain we came from so that breakpoints can be
     // deactivated from within the ExitAppdomain callback.
@@ -87,6 +88,10 @@ HRESULT CordbFunctionBreakpoint::QueryInterface(REFIID id, void **pInterface)
     {
         *pInterface = static_cast<ICorDebugFunctionBreakpoint*>(this);
     }
+    else if (id == IID_ICorDebugFunctionBreakpoint2)
+    {
+        *pInterface = static_cast<ICorDebugFunctionBreakpoint2*>(this);
+    }
     else
     {
         // Not looking for a function breakpoint? See if the base class handles
@@ -139,6 +144,63 @@ HRESULT CordbFunctionBreakpoint::GetOffset(ULONG32 *pnOffset)
     return S_OK;
 }
 
+//---------------------------------------------------------------------------------------
+//
+// Sets or clears the condition that the LS evaluates before stopping at the breakpoint
+//
+// Arguments:
+//    pCondition - the condition, or NULL to remove it
+//
+// Return Value:
+//    S_OK if successful, E_UNEXPECTED if the breakpoint is active, E_INVALIDARG if the
+//    condition is malformed.
+//
+//---------------------------------------------------------------------------------------
+HRESULT CordbFunctionBreakpoint::SetCondition(COR_DEBUG_BREAKPOINT_CONDITION *pCondition)
+{
+    PUBLIC_API_ENTRY(this);
+    FAIL_IF_NEUTERED(this);
+
+    // The condition is sent with the breakpoint when it is activated
+    if (m_active)
+    {
+        return E_UNEXPECTED;
+    }
+
+    if (pCondition == NULL)
+    {
+        m_hasCondition = false;
+        return S_OK;
+    }
+
+    if (pCondition->codeStartAddress == NULL)
+    {
+        return E_INVALIDARG;
+    }
+
+    if ((pCondition->locationType != VLT_REGISTER) && (pCondition->locationType != VLT_REGISTER_RELATIVE))
+    {
+        return E_INVALIDARG;
+    }
+
+    ULONG32 valueSize = pCondition->valueSize;
+    if ((valueSize != 1) && (valueSize != 2) && (valueSize != 4) && (valueSize != 8))
+    {
+        return E_INVALIDARG;
+    }
+
+    if ((pCondition->conditionOperator < CONDITION_EQUAL) ||
+        (pCondition->conditionOperator > CONDITION_GREATER_THAN_OR_EQUAL))
+    {
+        return E_INVALIDARG;
+    }
+
+    m_condition = *pCondition;
+    m_hasCondition = true;
+
+    return S_OK;
+}
+
 //---------------------------------------------------------------------------------------
 //
 // Activates or removes a breakpoint
@@ -218,6 +280,12 @@ HRESULT CordbFunctionBreakpoint::Activate(BOOL fActivate)
                 (m_code.GetValue()->AsNativeCode())->GetVMNativeCodeMethodDescToken().ToLsPtr();
         }
 
+        pEvent->BreakpointData.hasCondition = m_hasCondition;
+        if (m_hasCondition)
+        {
+            pEvent->BreakpointData.condition = m_condition;
+        }
+
         // Note: we're sending a two-way event, so it blocks here
         // until the breakpoint is really added and the reply event is
         // copied over the event we sent.
@@ -7571,7 +7571,8 @@ public:
  * ------------------------------------------------------------------------- */
 
 class CordbFunctionBreakpoint : public CordbBreakpoint,
-                                public ICorDebugFunctionBreakpoint
+                                public ICorDebugFunctionBreakpoint,
+                                public ICorDebugFunctionBreakpoint2
 {
 public:
     CordbFunctionBreakpoint(CordbCode *code, SIZE_T offset, BOOL offsetIsIl);
@@ -7611,6 +7612,12 @@ public:
         return BaseIsActive(pbActive);
     }
 
+    //-----------------------------------------------------------
+    // ICorDebugFunctionBreakpoint2
+    //-----------------------------------------------------------
+
+    COM_METHOD SetCondition(COR_DEBUG_BREAKPOINT_CONDITION *pCondition);
+
     //-----------------------------------------------------------
     // Non-COM methods
     //-----------------------------------------------------------
@@ -7636,6 +7643,10 @@ public:
     RSExtSmartPtr<CordbCode> m_code;
     SIZE_T          m_offset;
     BOOL            m_offsetIsIl;
+
+    // Condition evaluated by the LS, sent when the breakpoint is activated
+    bool            m_hasCondition;
+    COR_DEBUG_BREAKPOINT_CONDITION m_condition;
 };
 
 /* ------------------------------------------------------------------------- *
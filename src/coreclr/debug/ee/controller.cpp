@@ -4929,7 +4929,8 @@ DebuggerBreakpoint::DebuggerBreakpoint(Module *module,
                                        bool nativeCodeBindAllVersions,
                                        BOOL *pSucceed
                                        )
-                                       : DebuggerController(NULL, pAppDomain)
+                                       : DebuggerController(NULL, pAppDomain),
+                                         m_hasCondition(false)
 {
     _ASSERTE(pSucceed != NULL);
     _ASSERTE((native == (nativeMethodDesc != NULL)) || nativeCodeBindAllVersions);
@@ -4948,15 +4949,181 @@ DebuggerBreakpoint::DebuggerBreakpoint(Module *module,
     }
 }
 
+// This helper is required because the AVInRuntimeImplOkayHolder can not
+// be directly placed inside the scope of a PAL_TRY
+static void _ReadConditionValueHelper(ULONG64 *pValue, const BYTE *pAddr, ULONG32 size)
+{
+    AVInRuntimeImplOkayHolder AVOkay;
+
+    switch (size)
+    {
+    case 1: *pValue = *(const UINT8 *)pAddr; break;
+    case 2: *pValue = *(const UINT16 UNALIGNED *)pAddr; break;
+    case 4: *pValue = *(const UINT32 UNALIGNED *)pAddr; break;
+    case 8: *pValue = *(const UINT64 UNALIGNED *)pAddr; break;
+    }
+}
+
+// Reads a value of a breakpoint condition. The address comes from the debugger's
+// description of the variable, so an AV is treated as the value not being available.
+static bool ReadConditionValue(ULONG64 *pValue, const BYTE *pAddr, ULONG32 size)
+{
+    struct Param
+    {
+        ULONG64 *pValue;
+        const BYTE *pAddr;
+        ULONG32 size;
+        bool fSucceeded;
+    } param;
+    param.pValue = pValue;
+    param.pAddr = pAddr;
+    param.size = size;
+    param.fSucceeded = false;
+
+    PAL_TRY(Param *, pParam, &param)
+    {
+        _ReadConditionValueHelper(pParam->pValue, pParam->pAddr, pParam->size);
+        pParam->fSucceeded = true;
+    }
+    PAL_EXCEPT_FILTER(FilterAccessViolation2)
+    {
+        LOG((LF_CORDB, LL_INFO10000, "DB::RCV: AV reading condition value at 0x%p\n", pAddr));
+    }
+    PAL_ENDTRY
+
+    return param.fSucceeded;
+}
+
+// Returns the value of a register, given as a CorDebugRegister, from the context
+static bool GetConditionRegisterValue(CorDebugRegister reg, CONTEXT *pContext, SIZE_T *pValue)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    for (int i = 0; i < (int)_countof(g_JITToCorDbgReg); i++)
+    {
+        if (g_JITToCorDbgReg[i] == reg)
+        {
+            SIZE_T regOffs = GetRegOffsInCONTEXT((ICorDebugInfo::RegNum)i);
+            if (regOffs == (SIZE_T)-1)
+                return false;
+
+            *pValue = *(SIZE_T *)((BYTE *)pContext + regOffs);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+// bool DebuggerBreakpoint::IsConditionFalse()
+// What: Evaluates the condition of the breakpoint in the context of the
+// thread that hit it.
+// How: Returns true only if the condition could be evaluated and is false.
+// If the value can't be read, or the code is not the version the condition
+// was compiled for, the breakpoint stops and the debugger deals with it.
+bool DebuggerBreakpoint::IsConditionFalse(CONTEXT *pContext)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+    }
+    CONTRACTL_END;
+
+    if (pContext == NULL)
+        return false;
+
+    // The variable home is only valid for the code it was computed for
+    if (g_pEEInterface->GetNativeCodeStartAddress((PCODE)GetIP(pContext)) != (PCODE)m_condition.codeStartAddress)
+        return false;
+
+    SIZE_T regValue;
+    if (!GetConditionRegisterValue(m_condition.baseRegister, pContext, &regValue))
+        return false;
+
+    ULONG64 value = 0;
+
+    if (m_condition.locationType == VLT_REGISTER && !m_condition.isFieldOfObject)
+    {
+        value = regValue;
+    }
+    else
+    {
+        const BYTE *pAddr = NULL;
+
+        if (m_condition.locationType == VLT_REGISTER_RELATIVE)
+        {
+            pAddr = (const BYTE *)regValue + m_condition.offset;
+        }
+
+        if (m_condition.isFieldOfObject)
+        {
+            ULONG64 objRef = regValue;
+            if (pAddr != NULL && !ReadConditionValue(&objRef, pAddr, sizeof(void *)))
+                return false;
+
+            if (objRef == 0)
+                return false;
+
+            pAddr = (const BYTE *)(SIZE_T)objRef + m_condition.fieldOffset;
+        }
+
+        if (!ReadConditionValue(&value, pAddr, m_condition.valueSize))
+            return false;
+    }
+
+    // Truncate to the size of the value, and sign extend signed values
+    ULONG32 unusedBits = (sizeof(ULONG64) - m_condition.valueSize) * 8;
+    if (unusedBits > 0)
+    {
+        value = (value << unusedBits) >> unusedBits;
+    }
+
+    int comparison;
+    if (m_condition.isSigned)
+    {
+        INT64 signedValue = (INT64)(value << unusedBits) >> unusedBits;
+        INT64 signedConstant = (INT64)m_condition.constantValue;
+        comparison = (signedValue < signedConstant) ? -1 : ((signedValue > signedConstant) ? 1 : 0);
+    }
+    else
+    {
+        comparison = (value < m_condition.constantValue) ? -1 : ((value > m_condition.constantValue) ? 1 : 0);
+    }
+
+    bool result;
+    switch (m_condition.conditionOperator)
+    {
+    case CONDITION_EQUAL:                 result = (comparison == 0); break;
+    case CONDITION_NOT_EQUAL:             result = (comparison != 0); break;
+    case CONDITION_LESS_THAN:             result = (comparison < 0);  break;
+    case CONDITION_LESS_THAN_OR_EQUAL:    result = (comparison <= 0); break;
+    case CONDITION_GREATER_THAN:          result = (comparison > 0);  break;
+    case CONDITION_GREATER_THAN_OR_EQUAL: result = (comparison >= 0); break;
+    default:                              result = true; break;
+    }
+
+    LOG((LF_CORDB, LL_INFO10000, "DB::ICF: condition is %s\n", result ? "true" : "false"));
+
+    return !result;
+}
+
 // TP_RESULT DebuggerBreakpoint::TriggerPatch()
-// What: This patch will always be activated.
-// How: return true.
+// What: This patch will always be activated, unless the
+// breakpoint has a condition that is false.
+// How: return TPR_TRIGGER, or TPR_IGNORE for a false condition.
 TP_RESULT DebuggerBreakpoint::TriggerPatch(DebuggerControllerPatch *patch,
                                       Thread *thread,
                                       TRIGGER_WHY tyWhy)
 {
     LOG((LF_CORDB, LL_INFO10000, "DB::TP\n"));
 
+    if (m_hasCondition && IsConditionFalse(g_pEEInterface->GetThreadFilterContext(thread)))
+    {
+        return TPR_IGNORE;
+    }
+
     return TPR_TRIGGER;
 }
 
@@ -1495,12 +1495,25 @@ public:
     virtual DEBUGGER_CONTROLLER_TYPE GetDCType( void )
         { return DEBUGGER_CONTROLLER_BREAKPOINT; }
 
+    // Only stop when the condition is true, see ICorDebugFunctionBreakpoint2
+    void SetCondition(const COR_DEBUG_BREAKPOINT_CONDITION *pCondition)
+    {
+        LIMITED_METHOD_CONTRACT;
+        m_condition = *pCondition;
+        m_hasCondition = true;
+    }
+
 private:
 
     TP_RESULT TriggerPatch(DebuggerControllerPatch *patch,
                       Thread *thread,
                       TRIGGER_WHY tyWhy);
     bool SendEvent(Thread *thread, bool fInteruptedBySetIp);
+
+    bool IsConditionFalse(CONTEXT *pContext);
+
+    bool m_hasCondition;
+    COR_DEBUG_BREAKPOINT_CONDITION m_condition;
 };
 
 // * ------------------------------------------------------------------------ *
@@ -10691,6 +10691,23 @@ bool Debugger::HandleIPCEvent(DebuggerIPCEvent * pEvent)
                     pDebuggerBP = NULL;
                     hr = CORDBG_E_UNABLE_TO_SET_BREAKPOINT;
                 }
+
+                // The debuggee is stopped while the breakpoint is added, so no thread can
+                // hit it before the condition is set.
+                if ((pDebuggerBP != NULL) && pEvent->BreakpointData.hasCondition)
+                {
+                    ULONG32 valueSize = pEvent->BreakpointData.condition.valueSize;
+                    if ((valueSize == 1) || (valueSize == 2) || (valueSize == 4) || (valueSize == 8))
+                    {
+                        pDebuggerBP->SetCondition(&pEvent->BreakpointData.condition);
+                    }
+                    else
+                    {
+                        pDebuggerBP->Delete();
+                        pDebuggerBP = NULL;
+                        hr = E_INVALIDARG;
+                    }
+                }
             }
 
             if ((pDebuggerBP == NULL) && !FAILED(hr))
@@ -1989,6 +1989,8 @@ struct MSLAYOUT DebuggerIPCEvent
             SIZE_T       offset;
             SIZE_T       encVersion;
             LSPTR_METHODDESC  nativeCodeMethodDescToken; // points to the MethodDesc if !isIL
+            bool         hasCondition;
+            COR_DEBUG_BREAKPOINT_CONDITION condition; // evaluated by the LS when hasCondition
         } BreakpointData;
 
         struct MSLAYOUT
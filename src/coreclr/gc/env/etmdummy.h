@@ -19,6 +19,7 @@
 #define FireEtwGCRestartEEBegin_V1(ClrInstanceID) 0
 #define FireEtwGCSuspendEEEnd() 0
 #define FireEtwGCSuspendEEEnd_V1(ClrInstanceID) 0
+#define FireEtwGCSuspendEEEnd_V2(ClrInstanceID, TimeToSafepoint, SignaledThreadCount) 0
 #define FireEtwGCSuspendEEBegin(Reason) 0
 #define FireEtwGCSuspendEEBegin_V1(Reason, Count, ClrInstanceID) 0
 #define FireEtwGCAllocationTick(AllocationAmount, AllocationKind) 0
@@ -33,11 +34,13 @@
 #define FireEtwGCFinalizersEnd_V1(Count, ClrInstanceID) 0
 #define FireEtwGCFinalizersBegin() 0
 #define FireEtwGCFinalizersBegin_V1(ClrInstanceID) 0
+#define FireEtwGCFinalizersBegin_V2(ClrInstanceID, QueueLength, HelperThreadCount) 0
 #define FireEtwBulkType(Count, ClrInstanceID, Values_Len_, Values) 0
 #define FireEtwGCBulkRootEdge(Index, Count, ClrInstanceID, Values_Len_, Values) 0
 #define FireEtwGCBulkRootConditionalWeakTableElementEdge(Index, Count, ClrInstanceID, Values_Len_, Values) 0
 #define FireEtwGCBulkNode(Index, Count, ClrInstanceID, Values_Len_, Values) 0
 #define FireEtwGCBulkEdge(Index, Count, ClrInstanceID, Values_Len_, Values) 0
+#define FireEtwGCBulkTypeStatistics(Index, Count, ClrInstanceID, Values_Len_, Values) 0
 #define FireEtwGCSampledObjectAllocationHigh(Address, TypeID, ObjectCountForTypeSample, TotalSizeForTypeSample, ClrInstanceID) 0
 #define FireEtwGCBulkSurvivingObjectRanges(Index, Count, ClrInstanceID, Values_Len_, Values) 0
 #define FireEtwGCBulkMovedObjectRanges(Index, Count, ClrInstanceID, Values_Len_, Values) 0
@@ -85,6 +88,7 @@
 #define FireEtwThreadPoolIOPack(NativeOverlapped, Overlapped, ClrInstanceID) 0
 #define FireEtwThreadCreating(ID, ClrInstanceID) 0
 #define FireEtwThreadRunning(ID, ClrInstanceID) 0
+#define FireEtwThreadRunning_V1(ID, ClrInstanceID, StartupTime) 0
 #define FireEtwExceptionThrown() 0
 #define FireEtwExceptionThrown_V1(ExceptionType, ExceptionMessage, ExceptionEIP, ExceptionHRESULT, ExceptionFlags, ClrInstanceID) 0
 #define FireEtwExceptionCatchStart(EntryEIP, MethodID, MethodName, ClrInstanceID) 0
@@ -96,6 +100,7 @@
 #define FireEtwExceptionThrownStop() 0
 #define FireEtwContention() 0
 #define FireEtwContentionStart_V1(ContentionFlags, ClrInstanceID) 0
+#define FireEtwContentionStart_V2(ContentionFlags, ClrInstanceID, LockID, AssociatedObjectID, AssociatedObjectTypeID, LockOwnerThreadID) 0
 #define FireEtwContentionStop(ContentionFlags, ClrInstanceID) 0
 #define FireEtwCLRStackWalk(ClrInstanceID, Reserved1, Reserved2, FrameCount, Stack) 0
 #define FireEtwAppDomainMemAllocated(AppDomainID, Allocated, ClrInstanceID) 0
@@ -149,6 +154,7 @@
 #define FireEtwAppDomainLoad_V1(AppDomainID, AppDomainFlags, AppDomainName, AppDomainIndex, ClrInstanceID) 0
 #define FireEtwAppDomainUnload(AppDomainID, AppDomainFlags, AppDomainName) 0
 #define FireEtwAppDomainUnload_V1(AppDomainID, AppDomainFlags, AppDomainName, AppDomainIndex, ClrInstanceID) 0
+#define FireEtwLoaderAllocatorUnloadProgress(TornDownCount, PendingCount, ClrInstanceID) 0
 #define FireEtwModuleRangeLoad(ClrInstanceID, ModuleID, RangeBegin, RangeSize, RangeType) 0
 #define FireEtwStrongNameVerificationStart(VerificationFlags, ErrorCode, FullyQualifiedAssemblyName) 0
 #define FireEtwStrongNameVerificationStart_V1(VerificationFlags, ErrorCode, FullyQualifiedAssemblyName, ClrInstanceID) 0
@@ -171,6 +177,7 @@
 #define FireEtwDebugExceptionProcessingStart() 0
 #define FireEtwDebugExceptionProcessingEnd() 0
 #define FireEtwCodeSymbols(ModuleId, TotalChunks, ChunkNumber, ChunkLength, Chunk, ClrInstanceID) 0
+#define FireEtwRuntimeCounter(CounterName, Value, ClrInstanceID) 0
 #define FireEtwCLRStackWalkDCStart(ClrInstanceID, Reserved1, Reserved2, FrameCount, Stack) 0
 #define FireEtwMethodDCStart(MethodID, ModuleID, MethodStartAddress, MethodSize, MethodToken, MethodFlags) 0
 #define FireEtwMethodDCStart_V1(MethodID, ModuleID, MethodStartAddress, MethodSize, MethodToken, MethodFlags, ClrInstanceID) 0
@@ -344,6 +351,7 @@
 #define FireEtwSecurityCatchCall_V1(ClrInstanceID) 0
 #define FireEtwSecurityCatchCallEnd() 0
 #define FireEtwSecurityCatchCallEnd_V1(ClrInstanceID) 0
+#define FireEtwEEStartupPhase(PhaseName, DurationMicroseconds, ClrInstanceID) 0
 #define FireEtwCLRStackWalkPrivate(ClrInstanceID, Reserved1, Reserved2, FrameCount, Stack) 0
 #define FireEtwModuleRangeLoadPrivate(ClrInstanceID, ModuleID, RangeBegin, RangeSize, RangeType, IBCType, SectionType) 0
 #define FireEtwBindingPolicyPhaseStart(AppDomainID, LoadContextID, FromLoaderCache, DynamicLoad, AssemblyCodebase, AssemblyName, ClrInstanceID) 0
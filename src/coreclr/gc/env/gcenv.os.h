@@ -246,6 +246,10 @@ public:
     // Shutdown the interface implementation
     static void Shutdown();
 
+    // Discard the cached processor count and memory limit so they are detected again, used
+    // when the process has been restored from a checkpoint on a machine with different limits
+    static void RefreshResourceLimits();
+
     //
     // Virtual memory management
     //
@@ -310,6 +314,16 @@ public:
     //  true if it has succeeded, false if it has failed
     static bool VirtualReset(void *address, size_t size, bool unlock);
 
+    // Ask for a virtual memory range to be backed by large pages where the OS can do that
+    // without committing up front, e.g. transparent huge pages on Linux. This is only a
+    // hint - the range keeps working with normal pages if no large pages are available.
+    // Parameters:
+    //  address - starting virtual address
+    //  size    - size of the virtual memory range
+    // Return:
+    //  true if the OS accepted the hint, false otherwise
+    static bool VirtualPreferLargePages(void *address, size_t size);
+
     //
     // Write watching
     //
@@ -447,6 +461,15 @@ public:
     //  Any parameter can be null.
     static void GetMemoryStatus(uint64_t restricted_limit, uint32_t* memory_load, uint64_t* available_physical, uint64_t* available_page_file);
 
+    // Get the memory pressure the OS reports for the process, e.g. cgroup v2 memory.pressure and memory.high
+    // Parameters:
+    //  stall_some - Hundredths of a percent of recent time in which some tasks were stalled waiting on memory.
+    //  stall_full - Hundredths of a percent of recent time in which all non-idle tasks were stalled waiting on memory.
+    //  high_limit - The usage, in bytes, above which the OS throttles and reclaims aggressively, or 0 if there is none.
+    // Return:
+    //  true if any of the above is available
+    static bool GetMemoryPressure(uint32_t* stall_some, uint32_t* stall_full, uint64_t* high_limit);
+
     // Get size of an OS memory page
     static size_t GetPageSize();
 
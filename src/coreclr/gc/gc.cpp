@@ -18,7 +18,7 @@
 
 #include "gcpriv.h"
 
-#if defined(TARGET_AMD64) && defined(TARGET_WINDOWS)
+#if (defined(TARGET_AMD64) && defined(TARGET_WINDOWS)) || defined(TARGET_ARM64)
 #define USE_VXSORT
 #else
 #define USE_INTROSORT
@@ -1901,12 +1901,25 @@ const int max_snoop_level = 128;
 // time in milliseconds between decommit steps
 #define DECOMMIT_TIME_STEP_MILLISECONDS (100)
 
+// time in milliseconds between reads of the OS memory pressure signals
+#define MEMORY_PRESSURE_REFRESH_MS (250)
+
 inline
 size_t align_on_page (size_t add)
 {
     return ((add + OS_PAGE_SIZE - 1) & ~((size_t)OS_PAGE_SIZE - 1));
 }
 
+// the huge page size we assume for GCHugePages - 2MB is what x64 and arm64 use
+// with 4K base pages, which is the only common configuration that has them
+#define LARGE_PAGE_SIZE ((size_t)2*1024*1024)
+
+inline
+size_t align_on_large_page (size_t add)
+{
+    return ((add + LARGE_PAGE_SIZE - 1) & ~(LARGE_PAGE_SIZE - 1));
+}
+
 inline
 uint8_t* align_on_page (uint8_t* add)
 {
@@ -2015,6 +2028,12 @@ void stomp_write_barrier_initialize(uint8_t* ephemeral_low, uint8_t* ephemeral_h
 
     args.lowest_address = g_gc_lowest_address;
     args.highest_address = g_gc_highest_address;
+
+#ifdef USE_REGIONS
+    args.region_to_generation_table = gc_heap::map_region_to_generation_skewed;
+    args.region_shr = (uint8_t)gc_heap::min_segment_size_shr;
+#endif //USE_REGIONS
+
     args.ephemeral_low = ephemeral_low;
     args.ephemeral_high = ephemeral_high;
     GCToEEInterface::StompWriteBarrier(&args);
@@ -2151,6 +2170,9 @@ size_t*     gc_heap::g_bpromoted;
 
 BOOL        gc_heap::gradual_decommit_in_progress_p = FALSE;
 size_t      gc_heap::max_decommit_step_size = 0;
+size_t      gc_heap::decommit_budget = 0;
+uint64_t    gc_heap::last_decommit_step_time = 0;
+int         gc_heap::decommit_step_start_heap = 0;
 #else  //MULTIPLE_HEAPS
 
 size_t      gc_heap::g_promoted;
@@ -2177,6 +2199,14 @@ gc_history_global gc_heap::gc_data_global;
 
 uint64_t    gc_heap::gc_last_ephemeral_decommit_time = 0;
 
+size_t      gc_heap::decommit_size_per_ms = DECOMMIT_SIZE_PER_MILLISECOND;
+
+size_t      gc_heap::allocation_sample_bytes = 0;
+
+#ifdef VERIFY_HEAP
+int         gc_heap::heap_verify_sample_percent = 0;
+#endif //VERIFY_HEAP
+
 CLRCriticalSection gc_heap::check_commit_cs;
 
 size_t      gc_heap::current_total_committed = 0;
@@ -2223,6 +2253,16 @@ uint32_t    gc_heap::m_high_memory_load_th;
 
 uint32_t    gc_heap::v_high_memory_load_th;
 
+uint32_t    gc_heap::memory_stall_th = 0;
+
+uint32_t    gc_heap::memory_stall_some = 0;
+
+uint32_t    gc_heap::memory_stall_full = 0;
+
+uint64_t    gc_heap::memory_high_limit = 0;
+
+uint64_t    gc_heap::memory_pressure_refresh_time = 0;
+
 bool        gc_heap::is_restricted_physical_mem;
 
 uint64_t    gc_heap::total_physical_mem = 0;
@@ -2241,6 +2281,10 @@ bool        affinity_config_specified_p = false;
 
 #ifdef USE_REGIONS
 region_allocator global_region_allocator;
+
+#ifdef MULTIPLE_HEAPS
+numa_region_free_list gc_heap::numa_free_regions[MAX_SUPPORTED_NODES];
+#endif //MULTIPLE_HEAPS
 #endif //USE_REGIONS
 
 #ifdef BACKGROUND_GC
@@ -2367,6 +2411,18 @@ gen_to_condemn_tuning gc_heap::gen_to_condemn_reasons;
 
 size_t      gc_heap::etw_allocation_running_amount[2];
 
+size_t      gc_heap::etw_allocation_next_tick[2];
+
+#ifdef FEATURE_EVENT_TRACE
+layout_stats_entry* gc_heap::layout_stats_table = 0;
+
+uint64_t    gc_heap::layout_stats_size_histogram[LAYOUT_STATS_SIZE_BUCKETS];
+
+uint64_t    gc_heap::layout_stats_dropped_count = 0;
+#endif //FEATURE_EVENT_TRACE
+
+uint64_t    gc_heap::allocation_sample_rand = 0;
+
 uint64_t    gc_heap::total_alloc_bytes_soh = 0;
 
 uint64_t    gc_heap::total_alloc_bytes_uoh = 0;
@@ -2604,6 +2660,17 @@ uint64_t gc_heap::total_loh_a_last_bgc = 0;
 size_t gc_heap::eph_gen_starts_size = 0;
 heap_segment* gc_heap::segment_standby_list;
 bool          gc_heap::use_large_pages_p = 0;
+
+bool          gc_heap::prefer_large_pages_p = false;
+
+#ifdef FEATURE_EVENT_TRACE
+bool          gc_heap::layout_stats_p = false;
+#endif //FEATURE_EVENT_TRACE
+
+size_t        gc_heap::pause_target_us = 0;
+
+float         gc_heap::pause_target_budget_factor[max_generation];
+
 #ifdef HEAP_BALANCE_INSTRUMENTATION
 size_t        gc_heap::last_gc_end_time_us = 0;
 #endif //HEAP_BALANCE_INSTRUMENTATION
@@ -2612,6 +2679,9 @@ size_t        gc_heap::min_segment_size = 0;
 size_t        gc_heap::min_uoh_segment_size = 0;
 #endif //!USE_REGIONS
 size_t        gc_heap::min_segment_size_shr = 0;
+#ifdef USE_REGIONS
+uint8_t*      gc_heap::map_region_to_generation_skewed = 0;
+#endif //USE_REGIONS
 size_t        gc_heap::soh_segment_size = 0;
 size_t        gc_heap::segment_info_size = 0;
 
@@ -2622,6 +2692,7 @@ size_t gc_heap::compact_or_sweep_gcs[2];
 #ifdef FEATURE_LOH_COMPACTION
 BOOL                   gc_heap::loh_compaction_always_p = FALSE;
 gc_loh_compaction_mode gc_heap::loh_compaction_mode = loh_compaction_default;
+int                    gc_heap::loh_compaction_frag_percent = 0;
 int                    gc_heap::loh_pinned_queue_decay = LOH_PIN_DECAY;
 #endif //FEATURE_LOH_COMPACTION
 
@@ -2677,6 +2748,10 @@ uint8_t* gc_heap::alloc_allocated = 0;
 
 size_t gc_heap::allocation_quantum = CLR_SIZE;
 
+size_t gc_heap::allocation_quantum_max = CLR_SIZE;
+
+size_t gc_heap::alloc_context_refills = 0;
+
 GCSpinLock gc_heap::more_space_lock_soh;
 GCSpinLock gc_heap::more_space_lock_uoh;
 
@@ -2825,7 +2900,7 @@ void gc_history_per_heap::print()
         gen_data[i].print (heap_index, i);
     }
 
-    dprintf (DT_LOG_0, ("fla %Id flr %Id esa %Id ca %Id pa %Id paa %Id, rfle %d, ec %Id",
+    dprintf (DT_LOG_0, ("fla %Id flr %Id esa %Id ca %Id pa %Id paa %Id, rfle %d, ec %Id, acr %Id",
                     maxgen_size_info.free_list_allocated,
                     maxgen_size_info.free_list_rejected,
                     maxgen_size_info.end_seg_allocated,
@@ -2833,7 +2908,8 @@ void gc_history_per_heap::print()
                     maxgen_size_info.pinned_allocated,
                     maxgen_size_info.pinned_allocated_advance,
                     maxgen_size_info.running_free_list_efficiency,
-                    extra_gen0_committed));
+                    extra_gen0_committed,
+                    alloc_context_refills));
 
     int mechanism = 0;
     gc_mechanism_descr* descr = 0;
@@ -2882,23 +2958,26 @@ void gc_history_global::print()
 void gc_heap::fire_per_heap_hist_event (gc_history_per_heap* current_gc_data_per_heap, int heap_num)
 {
     maxgen_size_increase* maxgen_size_info = &(current_gc_data_per_heap->maxgen_size_info);
-    FIRE_EVENT(GCPerHeapHistory_V3,
-               (void *)(maxgen_size_info->free_list_allocated),
-               (void *)(maxgen_size_info->free_list_rejected),
-               (void *)(maxgen_size_info->end_seg_allocated),
-               (void *)(maxgen_size_info->condemned_allocated),
-               (void *)(maxgen_size_info->pinned_allocated),
-               (void *)(maxgen_size_info->pinned_allocated_advance),
-               maxgen_size_info->running_free_list_efficiency,
-               current_gc_data_per_heap->gen_to_condemn_reasons.get_reasons0(),
-               current_gc_data_per_heap->gen_to_condemn_reasons.get_reasons1(),
-               current_gc_data_per_heap->mechanisms[gc_heap_compact],
-               current_gc_data_per_heap->mechanisms[gc_heap_expand],
-               current_gc_data_per_heap->heap_index,
-               (void *)(current_gc_data_per_heap->extra_gen0_committed),
-               total_generation_count,
-               (uint32_t)(sizeof (gc_generation_data)),
-               (void *)&(current_gc_data_per_heap->gen_data[0]));
+    if (!GCEventSummary::IsEnabled())
+    {
+        FIRE_EVENT(GCPerHeapHistory_V3,
+                   (void *)(maxgen_size_info->free_list_allocated),
+                   (void *)(maxgen_size_info->free_list_rejected),
+                   (void *)(maxgen_size_info->end_seg_allocated),
+                   (void *)(maxgen_size_info->condemned_allocated),
+                   (void *)(maxgen_size_info->pinned_allocated),
+                   (void *)(maxgen_size_info->pinned_allocated_advance),
+                   maxgen_size_info->running_free_list_efficiency,
+                   current_gc_data_per_heap->gen_to_condemn_reasons.get_reasons0(),
+                   current_gc_data_per_heap->gen_to_condemn_reasons.get_reasons1(),
+                   current_gc_data_per_heap->mechanisms[gc_heap_compact],
+                   current_gc_data_per_heap->mechanisms[gc_heap_expand],
+                   current_gc_data_per_heap->heap_index,
+                   (void *)(current_gc_data_per_heap->extra_gen0_committed),
+                   total_generation_count,
+                   (uint32_t)(sizeof (gc_generation_data)),
+                   (void *)&(current_gc_data_per_heap->gen_data[0]));
+    }
 
     current_gc_data_per_heap->print();
     current_gc_data_per_heap->gen_to_condemn_reasons.print (heap_num);
@@ -2911,17 +2990,21 @@ void gc_heap::fire_pevents()
     settings.record (current_gc_data_global);
     current_gc_data_global->print();
 
-    FIRE_EVENT(GCGlobalHeapHistory_V3,
-               current_gc_data_global->final_youngest_desired,
-               current_gc_data_global->num_heaps,
-               current_gc_data_global->condemned_generation,
-               current_gc_data_global->gen0_reduction_count,
-               current_gc_data_global->reason,
-               current_gc_data_global->global_mechanisms_p,
-               current_gc_data_global->pause_mode,
-               current_gc_data_global->mem_pressure,
-               current_gc_data_global->gen_to_condemn_reasons.get_reasons0(),
-               current_gc_data_global->gen_to_condemn_reasons.get_reasons1());
+    // The history events are replaced by the interval summary when that is enabled, see do_post_gc
+    if (!GCEventSummary::IsEnabled())
+    {
+        FIRE_EVENT(GCGlobalHeapHistory_V3,
+                   current_gc_data_global->final_youngest_desired,
+                   current_gc_data_global->num_heaps,
+                   current_gc_data_global->condemned_generation,
+                   current_gc_data_global->gen0_reduction_count,
+                   current_gc_data_global->reason,
+                   current_gc_data_global->global_mechanisms_p,
+                   current_gc_data_global->pause_mode,
+                   current_gc_data_global->mem_pressure,
+                   current_gc_data_global->gen_to_condemn_reasons.get_reasons0(),
+                   current_gc_data_global->gen_to_condemn_reasons.get_reasons1());
+    }
 
 #ifdef MULTIPLE_HEAPS
     for (int i = 0; i < gc_heap::n_heaps; i++)
@@ -6640,6 +6723,18 @@ bool gc_heap::virtual_decommit (void* address, size_t size, gc_oh_num oh, int h_
     return decommit_succeeded_p;
 }
 
+// Huge pages come from the OS on a best effort basis - if it doesn't have any or
+// doesn't support them we just keep using normal pages so we ignore the result.
+// Note that decommitting drops the hint on some OSes so this needs to be done
+// every time the memory is committed again.
+void gc_heap::prefer_large_pages (uint8_t* address, size_t size)
+{
+    if (prefer_large_pages_p && (size != 0))
+    {
+        GCToOSInterface::VirtualPreferLargePages (address, size);
+    }
+}
+
 void gc_heap::virtual_free (void* add, size_t allocated_size, heap_segment* sg)
 {
     bool release_succeeded_p = GCToOSInterface::VirtualRelease (add, allocated_size);
@@ -8293,6 +8388,10 @@ uint32_t* gc_heap::make_card_table (uint8_t* start, uint8_t* end)
         return 0;
     }
 
+    // the card table is consulted for every cross generation store and card marking
+    // walks it linearly, so it's one of the few places where huge pages pay off.
+    prefer_large_pages (mem, commit_size);
+
     // initialize the ref count
     uint32_t* ct = (uint32_t*)(mem+sizeof (card_table_info));
     card_table_refcount (ct) = 0;
@@ -8497,6 +8596,8 @@ int gc_heap::grow_brick_card_tables (uint8_t* start,
                 set_fgm_result (fgm_commit_table, commit_size, uoh_p);
                 goto fail;
             }
+
+            prefer_large_pages (mem, commit_size);
         }
 
         ct = (uint32_t*)(mem + sizeof (card_table_info));
@@ -8914,6 +9015,24 @@ BOOL gc_heap::insert_ro_segment (heap_segment* seg)
     return TRUE;
 }
 
+// Grows the allocated part of a read only segment whose owner keeps allocating
+// objects into it after it was registered.
+void gc_heap::update_ro_segment (heap_segment* seg, uint8_t* allocated, uint8_t* committed)
+{
+    enter_spin_lock (&gc_heap::gc_lock);
+
+    assert (heap_segment_read_only_p (seg));
+    assert (allocated >= heap_segment_allocated (seg));
+    assert (allocated <= committed);
+    assert (committed <= heap_segment_reserved (seg));
+
+    heap_segment_allocated (seg) = allocated;
+    heap_segment_used (seg) = allocated;
+    heap_segment_committed (seg) = committed;
+
+    leave_spin_lock (&gc_heap::gc_lock);
+}
+
 // No one is calling this function right now. If this is getting called we need
 // to take care of decommitting the mark array for it - we will need to remember
 // which portion of the mark array was committed and only decommit that.
@@ -9219,6 +9338,11 @@ private:
 #ifdef USE_VXSORT
 static void do_vxsort (uint8_t** item_array, ptrdiff_t item_count, uint8_t* range_low, uint8_t* range_high)
 {
+#ifdef TARGET_ARM64
+    // AdvSIMD does not downclock, so the vectorized sort pays off
+    // for somewhat smaller lists than with AVX2
+    const size_t NEON_THRESHOLD_SIZE = 4 * 1024;
+#else //TARGET_ARM64
     // above this threshold, using AVX2 for sorting will likely pay off
     // despite possible downclocking on some devices
     const size_t AVX2_THRESHOLD_SIZE = 8 * 1024;
@@ -9226,10 +9350,19 @@ static void do_vxsort (uint8_t** item_array, ptrdiff_t item_count, uint8_t* rang
     // above this threshold, using AVX51F for sorting will likely pay off
     // despite possible downclocking on current devices
     const size_t AVX512F_THRESHOLD_SIZE = 128 * 1024;
+#endif //TARGET_ARM64
 
     if (item_count <= 1)
         return;
 
+#ifdef TARGET_ARM64
+    if (IsSupportedInstructionSet (InstructionSet::NEON) && (item_count > NEON_THRESHOLD_SIZE))
+    {
+        dprintf(3, ("Sorting mark lists"));
+        do_vxsort_neon (item_array, &item_array[item_count - 1], range_low, range_high);
+    }
+    else
+#else //TARGET_ARM64
     if (IsSupportedInstructionSet (InstructionSet::AVX2) && (item_count > AVX2_THRESHOLD_SIZE))
     {
         dprintf(3, ("Sorting mark lists"));
@@ -9245,6 +9378,7 @@ static void do_vxsort (uint8_t** item_array, ptrdiff_t item_count, uint8_t* rang
         }
     }
     else
+#endif //TARGET_ARM64
     {
         dprintf (3, ("Sorting mark lists"));
         introsort::sort (item_array, &item_array[item_count - 1], 0);
@@ -9863,11 +9997,16 @@ void gc_heap::grow_mark_list ()
 {
     // with vectorized sorting, we can use bigger mark lists
 #ifdef USE_VXSORT
+#ifdef TARGET_ARM64
+    const bool vectorized_sort_p = IsSupportedInstructionSet (InstructionSet::NEON);
+#else //TARGET_ARM64
+    const bool vectorized_sort_p = IsSupportedInstructionSet (InstructionSet::AVX2);
+#endif //TARGET_ARM64
 #ifdef MULTIPLE_HEAPS
-    const size_t MAX_MARK_LIST_SIZE = IsSupportedInstructionSet (InstructionSet::AVX2) ? 
+    const size_t MAX_MARK_LIST_SIZE = vectorized_sort_p ? 
         (1000 * 1024) : (200 * 1024);
 #else //MULTIPLE_HEAPS
-    const size_t MAX_MARK_LIST_SIZE = IsSupportedInstructionSet (InstructionSet::AVX2) ? 
+    const size_t MAX_MARK_LIST_SIZE = vectorized_sort_p ? 
         (32 * 1024) : (16 * 1024);
 #endif //MULTIPLE_HEAPS
 #else //USE_VXSORT
@@ -10629,17 +10768,23 @@ void gc_heap::return_free_region (heap_segment* region)
         num_free_large_regions_added++;
         heap_segment_next (region) = free_large_regions;
         free_large_regions = region;
+        committed_in_free += heap_segment_committed (region) - get_region_start (region);
     }
     else
     {
-        num_free_regions++;
-        num_free_regions_added++;
-        heap_segment_next (region) = free_regions;
-        free_regions = region;
+#ifdef MULTIPLE_HEAPS
+        if (((size_t)num_free_regions < free_regions_reserve()) ||
+            !return_free_region_to_numa_node (region))
+#endif //MULTIPLE_HEAPS
+        {
+            num_free_regions++;
+            num_free_regions_added++;
+            heap_segment_next (region) = free_regions;
+            free_regions = region;
+            committed_in_free += heap_segment_committed (region) - get_region_start (region);
+        }
     }
 
-    committed_in_free += heap_segment_committed (region) - get_region_start (region);
-
     uint8_t* region_start = get_region_start (region);
     uint8_t* region_end = heap_segment_reserved (region);
 
@@ -10660,9 +10805,104 @@ void gc_heap::return_free_region (heap_segment* region)
     }
 }
 
+#ifdef MULTIPLE_HEAPS
+void numa_region_free_list::enter_spin_lock()
+{
+    while (true)
+    {
+        if (Interlocked::CompareExchange(&lock.lock, 0, -1) < 0)
+            break;
+
+        while (lock.lock >= 0)
+        {
+            YieldProcessor();           // indicate to the processor that we are spinning
+        }
+    }
+#ifdef _DEBUG
+    lock.holding_thread = GCToEEInterface::GetThread();
+#endif //_DEBUG
+}
+
+void numa_region_free_list::leave_spin_lock()
+{
+#ifdef _DEBUG
+    lock.holding_thread = (Thread*)-1;
+#endif //_DEBUG
+    lock.lock = -1;
+}
+
+// How many free basic regions this heap keeps for itself - enough to get through
+// its next gen0 budget. Anything beyond that goes to the pool of its NUMA node.
+size_t gc_heap::free_regions_reserve()
+{
+    size_t region_size = (size_t)1 << min_segment_size_shr;
+    size_t gen0_budget = dd_desired_allocation (dynamic_data_of (0));
+    return (gen0_budget / region_size) + 1;
+}
+
+// Returns false if there's no pool for this heap's node, in which case the caller
+// keeps the region on the heap's own free list.
+bool gc_heap::return_free_region_to_numa_node (heap_segment* region)
+{
+    uint16_t node = heap_select::find_numa_node_from_heap_no (heap_number);
+    if (node >= MAX_SUPPORTED_NODES)
+    {
+        return false;
+    }
+
+    numa_region_free_list* node_list = &numa_free_regions[node];
+
+    node_list->enter_spin_lock();
+    heap_segment_next (region) = node_list->head;
+    node_list->head = region;
+    node_list->num_regions++;
+    node_list->committed += heap_segment_committed (region) - get_region_start (region);
+    node_list->leave_spin_lock();
+
+    dprintf (REGIONS_LOG, ("h%d returned region %Ix to node %d, node has %d free regions",
+        heap_number, heap_segment_mem (region), node, node_list->num_regions));
+    return true;
+}
+
+heap_segment* gc_heap::get_free_region_from_numa_node()
+{
+    uint16_t node = heap_select::find_numa_node_from_heap_no (heap_number);
+    if (node >= MAX_SUPPORTED_NODES)
+    {
+        return 0;
+    }
+
+    numa_region_free_list* node_list = &numa_free_regions[node];
+
+    // racy check to avoid taking the lock when the pool is empty - we'll just fall back
+    // to allocating a new region.
+    if (!node_list->head)
+    {
+        return 0;
+    }
+
+    node_list->enter_spin_lock();
+    heap_segment* region = node_list->head;
+    if (region)
+    {
+        node_list->head = heap_segment_next (region);
+        node_list->num_regions--;
+        node_list->committed -= heap_segment_committed (region) - get_region_start (region);
+    }
+    node_list->leave_spin_lock();
+
+    if (region)
+    {
+        dprintf (REGIONS_LOG, ("h%d got region %Ix from node %d, node has %d free regions left",
+            heap_number, heap_segment_mem (region), node, node_list->num_regions));
+    }
+
+    return region;
+}
+#endif //MULTIPLE_HEAPS
+
 // USE_REGIONS TODO: SOH should be able to get a large region and split it up into basic regions
 // if needed.
-// USE_REGIONS TODO: In Server GC we should allow to get a free region from another heap.
 heap_segment* gc_heap::get_free_region (int gen_number)
 {
     heap_segment* region = 0;
@@ -10683,6 +10923,14 @@ heap_segment* gc_heap::get_free_region (int gen_number)
             free_regions = heap_segment_next (free_regions);
             committed_in_free -= heap_segment_committed (region) - get_region_start (region);
         }
+#ifdef MULTIPLE_HEAPS
+        else
+        {
+            // Prefer a region another heap on our NUMA node gave up over new address
+            // space from region_allocator.
+            region = get_free_region_from_numa_node();
+        }
+#endif //MULTIPLE_HEAPS
     }
     else
     {
@@ -10783,10 +11031,24 @@ bool gc_heap::is_region_demoted (uint8_t* obj)
     return heap_segment_demoted_p (region_of (obj));
 }
 
+inline
+void gc_heap::update_region_generation_map (uint8_t* start, uint8_t* end, int gen_num)
+{
+    // The write barrier treats UOH regions like gen2.
+    uint8_t gen_byte = (uint8_t)min (gen_num, max_generation);
+    size_t begin_index = (size_t)start >> min_segment_size_shr;
+    size_t end_index = (size_t)(end - 1) >> min_segment_size_shr;
+    for (size_t index = begin_index; index <= end_index; index++)
+    {
+        map_region_to_generation_skewed[index] = gen_byte;
+    }
+}
+
 inline
 void gc_heap::set_region_gen_num (heap_segment* region, int gen_num)
 {
     heap_segment_gen_num (region) = gen_num;
+    update_region_generation_map (get_region_start (region), heap_segment_reserved (region), gen_num);
 }
 
 inline
@@ -10950,6 +11212,7 @@ void gc_heap::init_heap_segment (heap_segment* seg, gc_heap* hp
     int gen_num_for_region = min (gen_num, max_generation);
     heap_segment_gen_num (seg) = gen_num_for_region;
     heap_segment_plan_gen_num (seg) = gen_num_for_region;
+    update_region_generation_map (start, (start + size), gen_num_for_region);
 #endif //USE_REGIONS
 
 #ifdef USE_REGIONS
@@ -11786,6 +12049,14 @@ HRESULT gc_heap::initialize_gc (size_t soh_segment_size,
                                            ((size_t)1 << min_segment_size_shr), 
                                            &g_gc_lowest_address, &g_gc_highest_address))
             return E_OUTOFMEMORY;
+
+        // The regions range never moves, so this covers every region we will ever hand out.
+        size_t region_count = (size_t)(g_gc_highest_address - g_gc_lowest_address) >> min_segment_size_shr;
+        uint8_t* map_region_to_generation = new (nothrow) uint8_t[region_count];
+        if (!map_region_to_generation)
+            return E_OUTOFMEMORY;
+        memset (map_region_to_generation, max_generation, region_count);
+        map_region_to_generation_skewed = map_region_to_generation - ((size_t)g_gc_lowest_address >> min_segment_size_shr);
     }
     else
     {
@@ -11942,9 +12213,32 @@ gc_heap::init_semi_shared()
     }
 #endif //MARK_LIST
 
+#ifdef FEATURE_EVENT_TRACE
+    layout_stats_p = GCConfig::GetGCLayoutStats();
+#endif //FEATURE_EVENT_TRACE
+
+#ifdef VERIFY_HEAP
+    heap_verify_sample_percent = (int)min (max ((int64_t)GCConfig::GetHeapVerifySample(), (int64_t)0), (int64_t)100);
+    if (heap_verify_sample_percent == 100)
+    {
+        heap_verify_sample_percent = 0;
+    }
+#endif //VERIFY_HEAP
+
+    if (GCConfig::GetGCAllocSampleBytes() > 0)
+    {
+        allocation_sample_bytes = (size_t)GCConfig::GetGCAllocSampleBytes();
+    }
+
+    if (GCConfig::GetGCDecommitSizePerMs() > 0)
+    {
+        decommit_size_per_ms = align_on_page ((size_t)GCConfig::GetGCDecommitSizePerMs());
+    }
+
 #ifdef MULTIPLE_HEAPS
-    // gradual decommit: set size to some reasonable value per time interval
-    max_decommit_step_size = ((DECOMMIT_SIZE_PER_MILLISECOND * DECOMMIT_TIME_STEP_MILLISECONDS) / n_heaps);
+    // gradual decommit: the budget for one time interval is shared by all heaps,
+    // a single heap never gets more than this per step
+    max_decommit_step_size = decommit_size_per_ms * DECOMMIT_TIME_STEP_MILLISECONDS;
 
     // but do at least MIN_DECOMMIT_SIZE per step to make the OS call worthwhile
     max_decommit_step_size = max (max_decommit_step_size, MIN_DECOMMIT_SIZE);
@@ -11984,9 +12278,18 @@ gc_heap::init_semi_shared()
 #ifdef FEATURE_LOH_COMPACTION
     loh_compaction_always_p = GCConfig::GetLOHCompactionMode() != 0;
     loh_compaction_mode = loh_compaction_default;
+    loh_compaction_frag_percent = (int)min ((int64_t)GCConfig::GetLOHCompactFragPercent(), (int64_t)100);
 #endif //FEATURE_LOH_COMPACTION
 
     loh_size_threshold = (size_t)GCConfig::GetLOHThreshold();
+
+    pause_target_us = (size_t)max ((int64_t)GCConfig::GetGCPauseTargetMs(), (int64_t)0) * 1000;
+    GCEventSummary::Initialize ((uint64_t)max ((int64_t)GCConfig::GetGCEventSummaryInterval(), (int64_t)0),
+                                GetHighPrecisionTimeStamp());
+    for (int i = 0; i < max_generation; i++)
+    {
+        pause_target_budget_factor[i] = 1.0f;
+    }
     assert (loh_size_threshold >= LARGE_OBJECT_SIZE);
 
 #ifdef BGC_SERVO_TUNING
@@ -12386,6 +12689,10 @@ gc_heap::init_gc_heap (int  h_number)
 
     allocation_quantum = CLR_SIZE;
 
+    allocation_quantum_max = CLR_SIZE;
+
+    alloc_context_refills = 0;
+
     more_space_lock_soh = gc_lock;
 
     more_space_lock_uoh = gc_lock;
@@ -12572,6 +12879,24 @@ gc_heap::init_gc_heap (int  h_number)
 
     etw_allocation_running_amount[0] = 0;
     etw_allocation_running_amount[1] = 0;
+    allocation_sample_rand = ((uint64_t)(h_number + 1) << 32) ^ GetHighPrecisionTimeStamp();
+
+#ifdef FEATURE_EVENT_TRACE
+    layout_stats_table = 0;
+    if (layout_stats_p)
+    {
+        // these are only diagnostics so if we can't get the memory this heap just doesn't collect them
+        layout_stats_table = new (nothrow) layout_stats_entry[LAYOUT_STATS_TABLE_SIZE];
+        if (layout_stats_table)
+        {
+            memset (layout_stats_table, 0, sizeof (layout_stats_entry) * LAYOUT_STATS_TABLE_SIZE);
+        }
+    }
+    memset (layout_stats_size_histogram, 0, sizeof (layout_stats_size_histogram));
+    layout_stats_dropped_count = 0;
+#endif //FEATURE_EVENT_TRACE
+    etw_allocation_next_tick[0] = get_next_allocation_tick();
+    etw_allocation_next_tick[1] = get_next_allocation_tick();
     total_alloc_bytes_soh = 0;
     total_alloc_bytes_uoh = 0;
 
@@ -12880,6 +13205,25 @@ BOOL gc_heap::grow_heap_segment (heap_segment* seg, uint8_t* high_address, bool*
 
     size_t c_size = align_on_page ((size_t)(high_address - heap_segment_committed (seg)));
     c_size = max (c_size, commit_min_th);
+
+#ifdef USE_REGIONS
+    bool gen0_p = (heap_segment_gen_num (seg) == 0);
+#else
+    bool gen0_p = (seg == ephemeral_heap_segment);
+#endif //USE_REGIONS
+    bool round_to_large_page_p = prefer_large_pages_p && gen0_p;
+#ifdef MULTIPLE_HEAPS
+    // gradual decommit relies on us not committing beyond its target
+    round_to_large_page_p = round_to_large_page_p && !gradual_decommit_in_progress_p;
+#endif //MULTIPLE_HEAPS
+    if (round_to_large_page_p)
+    {
+        // the OS can only back a range with a huge page once all of it is committed, so
+        // commit gen0 up to the next huge page boundary instead of a few pages at a time
+        uint8_t* new_committed = (uint8_t*)align_on_large_page ((size_t)(heap_segment_committed (seg) + c_size));
+        c_size = new_committed - heap_segment_committed (seg);
+    }
+
     c_size = min (c_size, (size_t)(heap_segment_reserved (seg) - heap_segment_committed (seg)));
 
     if (c_size == 0)
@@ -12892,6 +13236,11 @@ BOOL gc_heap::grow_heap_segment (heap_segment* seg, uint8_t* high_address, bool*
     bool ret = virtual_commit (heap_segment_committed (seg), c_size, heap_segment_oh (seg), heap_number, hard_limit_exceeded_p);
     if (ret)
     {
+        if (gen0_p)
+        {
+            prefer_large_pages (heap_segment_committed (seg), c_size);
+        }
+
         heap_segment_committed (seg) += c_size;
 
         STRESS_LOG1(LF_GC, LL_INFO10000, "New commit: %Ix\n",
@@ -13823,6 +14172,11 @@ void gc_heap::adjust_limit_clr (uint8_t* start, size_t limit_size, size_t size,
     }
 #endif //MULTIPLE_HEAPS
 
+    if (gen_number == 0)
+    {
+        record_alloc_context_refill (acontext);
+    }
+
     dprintf (3, ("Expanding segment allocation [%Ix, %Ix[", (size_t)start,
                (size_t)start + limit_size - aligned_min_obj_size));
 
@@ -14003,8 +14357,37 @@ size_t gc_heap::new_allocation_limit (size_t size, size_t physical_limit, int ge
     return limit;
 }
 
+// A context is given at least allocation_quantum. A context that keeps refilling is given
+// twice as much for every few recent refills, up to allocation_quantum_max, so that busy
+// threads take the more space lock less often while quiet threads don't hold on to large
+// unused quanta. The refill count of a context is halved with every GC.
+#define ALLOC_QUANTUM_REFILLS_PER_STEP 4
+#define ALLOC_QUANTUM_MAX_STEPS 3
+
+static uint32_t recent_alloc_context_refills (alloc_context* acontext, uint16_t gc_index)
+{
+    uint16_t gcs_since_refill = (uint16_t)(gc_index - acontext->alloc_quantum_gc);
+    return ((gcs_since_refill < 16) ? ((uint32_t)acontext->alloc_quantum_refills >> gcs_since_refill) : 0);
+}
+
+size_t gc_heap::get_allocation_quantum (alloc_context* acontext)
+{
+    uint32_t refills = recent_alloc_context_refills (acontext, (uint16_t)settings.gc_index);
+    int steps = (int)min ((uint32_t)ALLOC_QUANTUM_MAX_STEPS, refills / ALLOC_QUANTUM_REFILLS_PER_STEP);
+    return max (allocation_quantum, min (allocation_quantum << steps, allocation_quantum_max));
+}
+
+void gc_heap::record_alloc_context_refill (alloc_context* acontext)
+{
+    uint16_t gc_index = (uint16_t)settings.gc_index;
+    uint32_t refills = recent_alloc_context_refills (acontext, gc_index) + 1;
+    acontext->alloc_quantum_refills = (uint16_t)min (refills, (uint32_t)UINT16_MAX);
+    acontext->alloc_quantum_gc = gc_index;
+    alloc_context_refills++;
+}
+
 size_t gc_heap::limit_from_size (size_t size, uint32_t flags, size_t physical_limit, int gen_number,
-                                 int align_const)
+                                 alloc_context* acontext, int align_const)
 {
     size_t padded_size = size + Align (min_obj_size, align_const);
     // for LOH this is not true...we could select a physical_limit that's exactly the same
@@ -14013,7 +14396,7 @@ size_t gc_heap::limit_from_size (size_t size, uint32_t flags, size_t physical_li
 
     // For SOH if the size asked for is very small, we want to allocate more than just what's asked for if possible.
     // Unless we were told not to clean, then we will not force it.
-    size_t min_size_to_allocate = ((gen_number == 0 && !(flags & GC_ALLOC_ZEROING_OPTIONAL)) ? allocation_quantum : 0);
+    size_t min_size_to_allocate = ((gen_number == 0 && !(flags & GC_ALLOC_ZEROING_OPTIONAL)) ? get_allocation_quantum (acontext) : 0);
 
     size_t desired_size_to_allocate  = max (padded_size, min_size_to_allocate);
     size_t new_physical_limit = min (physical_limit, desired_size_to_allocate);
@@ -14377,7 +14760,7 @@ BOOL gc_heap::a_fit_free_list_p (int gen_number,
                 // We ask for more Align (min_obj_size)
                 // to make sure that we can insert a free object
                 // in adjust_limit will set the limit lower
-                size_t limit = limit_from_size (size, flags, free_list_size, gen_number, align_const);
+                size_t limit = limit_from_size (size, flags, free_list_size, gen_number, acontext, align_const);
 
                 uint8_t*  remain = (free_list + limit);
                 size_t remain_size = (free_list_size - limit);
@@ -14550,7 +14933,7 @@ BOOL gc_heap::a_fit_free_list_uoh_p (size_t size,
 
                 // Substract min obj size because limit_from_size adds it. Not needed for LOH
                 size_t limit = limit_from_size (size - Align(min_obj_size, align_const), flags, free_list_size,
-                                                gen_number, align_const);
+                                                gen_number, acontext, align_const);
 
 #ifdef FEATURE_LOH_COMPACTION
                 if (loh_pad)
@@ -14647,7 +15030,7 @@ BOOL gc_heap::a_fit_segment_end_p (int gen_number,
         limit = limit_from_size (size,
                                  flags,
                                  (end - allocated),
-                                 gen_number, align_const);
+                                 gen_number, acontext, align_const);
         goto found_fit;
     }
 
@@ -14658,7 +15041,7 @@ BOOL gc_heap::a_fit_segment_end_p (int gen_number,
         limit = limit_from_size (size,
                                  flags,
                                  (end - allocated),
-                                 gen_number, align_const);
+                                 gen_number, acontext, align_const);
 
         if (grow_heap_segment (seg, (allocated + limit), &hard_limit_short_seg_end_p))
         {
@@ -15937,7 +16320,7 @@ allocation_state gc_heap::try_allocate_more_space (alloc_context* acontext, size
 
         allocated_since_last_gc[etw_allocation_index] += alloc_context_bytes;
 
-        if (etw_allocation_running_amount[etw_allocation_index] > etw_allocation_tick)
+        if (etw_allocation_running_amount[etw_allocation_index] > etw_allocation_next_tick[etw_allocation_index])
         {
 #ifdef FEATURE_REDHAWK
             FIRE_EVENT(GCAllocationTick_V1, (uint32_t)etw_allocation_running_amount[etw_allocation_index],
@@ -15957,12 +16340,49 @@ allocation_state gc_heap::try_allocate_more_space (alloc_context* acontext, size
 #endif //FEATURE_EVENT_TRACE
 #endif //FEATURE_REDHAWK
             etw_allocation_running_amount[etw_allocation_index] = 0;
+            etw_allocation_next_tick[etw_allocation_index] = get_next_allocation_tick();
         }
     }
 
     return can_allocate;
 }
 
+// With GCAllocSampleBytes the distance between allocation ticks is drawn from an
+// exponential distribution, which makes the ticks a Poisson process over allocated
+// bytes. Each tick still reports the amount allocated since the previous one, so
+// summing the ticks gives an unbiased estimate of what each type allocated, and the
+// stack that comes with the event is the stack of the allocating thread.
+//
+// We don't want to take a dependency on libm here so -ln(u) is computed from the
+// exponent of u plus a quadratic approximation of its mantissa's log2, which is
+// within 0.5% and good enough for sampling.
+size_t gc_heap::get_next_allocation_tick()
+{
+    if (allocation_sample_bytes == 0)
+    {
+        return etw_allocation_tick;
+    }
+
+    // xorshift64, this is only ever called with the more space lock held
+    uint64_t x = allocation_sample_rand;
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    allocation_sample_rand = x;
+
+    // u is uniform in (0, 1] with 31 bits of fraction, which keeps it in a size_t on 32-bit
+    size_t u = (size_t)(x >> 33) + 1;
+    int exponent = index_of_highest_set_bit (u);
+    double f = (double)(u - ((size_t)1 << exponent)) / (double)((size_t)1 << exponent);
+    double neg_log2_u = (double)(31 - exponent) - (f + 0.3466 * f * (1.0 - f));
+
+    // ln(2) * -log2(u) * mean, capped so one unlucky draw can't hide a type for long
+    double distance = 0.6931471805599453 * neg_log2_u * (double)allocation_sample_bytes;
+    distance = min (distance, (double)allocation_sample_bytes * 16);
+
+    return max ((size_t)distance, Align (min_obj_size));
+}
+
 #ifdef MULTIPLE_HEAPS
 void gc_heap::balance_heaps (alloc_context* acontext)
 {
@@ -17778,6 +18198,24 @@ int gc_heap::joined_generation_to_condemn (BOOL should_evaluate_elevation,
     }
 #endif //BGC_SERVO_TUNING
 
+#ifdef FEATURE_LOH_COMPACTION
+    // A blocking gen2 has to sweep LOH anyway so when LOH is badly fragmented we compact it
+    // in that same pause. We don't make the GC blocking for this - if this turns out to be a
+    // BGC, loh_compaction is simply not looked at, just like with GCLOHCompact.
+    if ((n == max_generation) && !settings.loh_compaction && (loh_compaction_frag_percent > 0))
+    {
+        size_t loh_frag = get_total_gen_fragmentation (loh_generation);
+        size_t loh_size = get_total_generation_size (loh_generation);
+
+        if (loh_size && ((loh_frag * 100) >= (loh_size * (size_t)loh_compaction_frag_percent)))
+        {
+            settings.loh_compaction = TRUE;
+            dprintf (GTC_LOG, ("loh frag %Id is >= %d%% of loh size %Id, compacting LOH if blocking",
+                loh_frag, loh_compaction_frag_percent, loh_size));
+        }
+    }
+#endif //FEATURE_LOH_COMPACTION
+
     if ((n == max_generation) && (*blocking_collection_p == FALSE))
     {
         // If we are doing a gen2 we should reset elevation regardless and let the gen2
@@ -18071,6 +18509,20 @@ bool gc_heap::try_get_new_free_region()
     }
     else
     {
+#ifdef MULTIPLE_HEAPS
+        region = get_free_region_from_numa_node();
+        if (region)
+        {
+            num_free_regions++;
+            num_free_regions_added++;
+            heap_segment_next (region) = free_regions;
+            free_regions = region;
+            committed_in_free += heap_segment_committed (region) - get_region_start (region);
+            dprintf (REGIONS_LOG, ("h%d got an empty region %Ix from its node", heap_number, region));
+            return true;
+        }
+#endif //MULTIPLE_HEAPS
+
         region = allocate_new_region (__this, 0, false);
         if (region)
         {
@@ -18171,6 +18623,7 @@ int gc_heap::generation_to_condemn (int n_initial,
     uint64_t available_physical = 0;
     uint64_t available_page_file = 0;
     BOOL check_memory = FALSE;
+    bool memory_pressure_p = false;
     BOOL high_fragmentation  = FALSE;
     BOOL v_high_memory_load  = FALSE;
     BOOL high_memory_load    = FALSE;
@@ -18410,12 +18863,23 @@ int gc_heap::generation_to_condemn (int n_initial,
         }
     }
 
+    // When the OS says we are under memory pressure we check the memory load for gen0 GCs too,
+    // so we can get to a gen1/gen2 before the container's OOM killer gets to us.
+    if (memory_stall_th != 0)
+    {
+        if (heap_number == 0)
+        {
+            refresh_memory_pressure();
+        }
+        memory_pressure_p = memory_pressure_signaled_p();
+    }
+
     // It's hard to catch when we get to the point that the memory load is so high
     // we get an induced GC from the finalizer thread so we are checking the memory load
     // for every gen0 GC.
     check_memory = (check_only_p ?
                     (n >= 0) :
-                    ((n >= 1) || low_memory_detected));
+                    ((n >= 1) || low_memory_detected || memory_pressure_p));
 
     if (check_memory)
     {
@@ -18436,6 +18900,11 @@ int gc_heap::generation_to_condemn (int n_initial,
         memory_load = max (memory_load, va_memory_load);
 #endif //USE_REGIONS
 
+        if (memory_pressure_p)
+        {
+            memory_load = max (memory_load, get_memory_pressure_load (memory_load, available_physical));
+        }
+
         // Need to get it early enough for all heaps to use.
         local_settings->entry_available_physical_mem = available_physical;
         local_settings->entry_memory_load = memory_load;
@@ -19116,11 +19585,15 @@ void gc_heap::gc1()
         //decide on the next allocation quantum
         if (alloc_contexts_used >= 1)
         {
-            allocation_quantum = Align (min ((size_t)CLR_SIZE,
-                                            (size_t)max (1024, get_new_allocation (0) / (2 * alloc_contexts_used))),
+            size_t fair_share = (size_t)max (1024, get_new_allocation (0) / (2 * alloc_contexts_used));
+            allocation_quantum = Align (min ((size_t)CLR_SIZE, fair_share), get_alignment_constant(FALSE));
+            allocation_quantum_max = Align (min ((size_t)CLR_SIZE << ALLOC_QUANTUM_MAX_STEPS, max (allocation_quantum, fair_share)),
                                             get_alignment_constant(FALSE));
-            dprintf (3, ("New allocation quantum: %d(0x%Ix)", allocation_quantum, allocation_quantum));
+            dprintf (3, ("New allocation quantum: %d(0x%Ix), max %Id", allocation_quantum, allocation_quantum, allocation_quantum_max));
         }
+
+        get_gc_data_per_heap()->alloc_context_refills = alloc_context_refills;
+        alloc_context_refills = 0;
     }
 
     descr_generations ("END");
@@ -21125,6 +21598,72 @@ VOLATILE(uint8_t*)& gc_heap::ref_mark_stack (gc_heap* hp, int index)
 
 #endif //MH_SC_MARK
 
+#ifdef FEATURE_EVENT_TRACE
+// Called for each object we mark when GCLayoutStats is on. The layout of a type is
+// worked out the first time we see it, after that it's a hash lookup and a few adds.
+inline
+void gc_heap::record_layout_stats (uint8_t* o, size_t s)
+{
+    if (!layout_stats_table)
+    {
+        return;
+    }
+
+    layout_stats_size_histogram[min (index_of_highest_set_bit (s), (LAYOUT_STATS_SIZE_BUCKETS - 1))]++;
+
+    MethodTable* mt = method_table (o);
+    size_t hash = ((size_t)mt >> 3) * 2654435761u;
+    for (int probe = 0; probe < LAYOUT_STATS_MAX_PROBES; probe++)
+    {
+        layout_stats_entry* entry = &layout_stats_table[(hash + probe) & (LAYOUT_STATS_TABLE_SIZE - 1)];
+        if (entry->mt == 0)
+        {
+            entry->mt = mt;
+            entry->ref_bitmap = 0;
+            entry->fixed_ref_slots = 0;
+
+            if (mt->HasComponentSize())
+            {
+                entry->ref_bitmap = (contain_pointers (o) ? UINT32_MAX : 0);
+            }
+            else if (contain_pointers (o))
+            {
+                uint32_t ref_bitmap = 0;
+                uint32_t ref_slots = 0;
+                go_through_object_nostart (mt, o, s, ppslot,
+                    {
+                        size_t field_index = ((uint8_t*)ppslot - (o + sizeof (uint8_t*))) / sizeof (uint8_t*);
+                        ref_bitmap |= ((field_index < 32) ? ((uint32_t)1 << field_index) : UINT32_MAX);
+                        ref_slots++;
+                    });
+                entry->ref_bitmap = ref_bitmap;
+                entry->fixed_ref_slots = ref_slots;
+            }
+        }
+
+        if (entry->mt == mt)
+        {
+            entry->count++;
+            entry->total_size += s;
+            if (mt->HasComponentSize())
+            {
+                if (contain_pointers (o))
+                {
+                    entry->total_ref_slots += CGCDesc::GetNumPointers (mt, s, ((CObjectHeader*)o)->GetNumComponents());
+                }
+            }
+            else
+            {
+                entry->total_ref_slots += entry->fixed_ref_slots;
+            }
+            return;
+        }
+    }
+
+    layout_stats_dropped_count++;
+}
+#endif //FEATURE_EVENT_TRACE
+
 #define stolen 2
 #define partial 1
 #define partial_object 3
@@ -21237,6 +21776,12 @@ void gc_heap::mark_object_simple1 (uint8_t* oo, uint8_t* start THREAD_NUMBER_DCL
                                                   }
                                                   size_t obj_size = size (o);
                                                   promoted_bytes (thread) += obj_size;
+#ifdef FEATURE_EVENT_TRACE
+                                                  if (layout_stats_p)
+                                                  {
+                                                      record_layout_stats (o, obj_size);
+                                                  }
+#endif //FEATURE_EVENT_TRACE
                                                   if (contain_pointers_or_collectible (o))
                                                   {
                                                       *(mark_stack_tos++) = o;
@@ -21282,6 +21827,12 @@ void gc_heap::mark_object_simple1 (uint8_t* oo, uint8_t* start THREAD_NUMBER_DCL
 
                             size_t obj_size = size (class_obj);
                             promoted_bytes (thread) += obj_size;
+#ifdef FEATURE_EVENT_TRACE
+                            if (layout_stats_p)
+                            {
+                                record_layout_stats (class_obj, obj_size);
+                            }
+#endif //FEATURE_EVENT_TRACE
                             *(mark_stack_tos++) = class_obj;
                             // The code below expects that the oo is still stored in the stack slot that was
                             // just popped and it "pushes" it back just by incrementing the mark_stack_tos.
@@ -21337,6 +21888,12 @@ void gc_heap::mark_object_simple1 (uint8_t* oo, uint8_t* start THREAD_NUMBER_DCL
                                                 }
                                                 size_t obj_size = size (o);
                                                 promoted_bytes (thread) += obj_size;
+#ifdef FEATURE_EVENT_TRACE
+                                                if (layout_stats_p)
+                                                {
+                                                    record_layout_stats (o, obj_size);
+                                                }
+#endif //FEATURE_EVENT_TRACE
                                                 if (contain_pointers_or_collectible (o))
                                                 {
                                                     *(mark_stack_tos++) = o;
@@ -21424,6 +21981,9 @@ int find_next_buddy_heap (int this_heap_number, int current_buddy, int n_heaps)
 void
 gc_heap::mark_steal()
 {
+    memset (&steal_stats, 0, sizeof (steal_stats));
+    uint64_t steal_start_time = GetHighPrecisionTimeStamp();
+
     mark_stack_busy() = 0;
     //clear the mark stack in the snooping range
     for (int i = 0; i < max_snoop_level; i++)
@@ -21473,6 +22033,8 @@ gc_heap::mark_steal()
                         //this is a normal object, not a partial mark tuple
                         //success = (Interlocked::CompareExchangePointer (&ref_mark_stack (hp, level), 0, o)==o);
                         success = (Interlocked::CompareExchangePointer (&ref_mark_stack (hp, level), (uint8_t*)4, o)==o);
+                        if (!success)
+                            steal_stats.failed_steal_count++;
 #ifdef SNOOP_STATS
                         snoop_stat.interlocked_count++;
                         if (success)
@@ -21509,6 +22071,8 @@ gc_heap::mark_steal()
                         //steal the object
                         success = (Interlocked::CompareExchangePointer (&ref_mark_stack (hp, level+1), 
                                                                         (uint8_t*)stolen, next) == next);
+                        if (!success)
+                            steal_stats.failed_steal_count++;
 #ifdef SNOOP_STATS
                         snoop_stat.interlocked_count++;
                         if (success)
@@ -21542,8 +22106,13 @@ gc_heap::mark_steal()
                     uint32_t start_tick = GCToOSInterface::GetLowPrecisionTimeStamp();
 #endif //SNOOP_STATS
 
+                    steal_stats.stolen_count++;
+                    uint64_t stolen_mark_start = GetHighPrecisionTimeStamp();
+
                     mark_object_simple1 (o, start, heap_number);
 
+                    steal_stats.stolen_mark_time += GetHighPrecisionTimeStamp() - stolen_mark_start;
+
 #ifdef SNOOP_STATS
                     dprintf (SNOOP_LOG, ("heap%d: done marking %Ix from %d [%d] %dms tl:%dms",
                             heap_number, (size_t)o, (heap_number+1)%n_heaps, level,
@@ -21618,6 +22187,8 @@ gc_heap::mark_steal()
             }
         }
     }
+
+    steal_stats.idle_time = (GetHighPrecisionTimeStamp() - steal_start_time) - steal_stats.stolen_mark_time;
 }
 
 inline
@@ -21770,6 +22341,12 @@ gc_heap::mark_object_simple (uint8_t** po THREAD_NUMBER_DCL)
             m_boundary (o);
             size_t s = size (o);
             promoted_bytes (thread) += s;
+#ifdef FEATURE_EVENT_TRACE
+            if (layout_stats_p)
+            {
+                record_layout_stats (o, s);
+            }
+#endif //FEATURE_EVENT_TRACE
             {
                 go_through_object_cl (method_table(o), o, s, poo,
                                         {
@@ -21779,6 +22356,12 @@ gc_heap::mark_object_simple (uint8_t** po THREAD_NUMBER_DCL)
                                                 m_boundary (oo);
                                                 size_t obj_size = size (oo);
                                                 promoted_bytes (thread) += obj_size;
+#ifdef FEATURE_EVENT_TRACE
+                                                if (layout_stats_p)
+                                                {
+                                                    record_layout_stats (oo, obj_size);
+                                                }
+#endif //FEATURE_EVENT_TRACE
 
                                                 if (contain_pointers_or_collectible (oo))
                                                     mark_object_simple1 (oo, oo THREAD_NUMBER_ARG);
@@ -22721,6 +23304,13 @@ size_t gc_heap::get_total_committed_size()
     total_committed = committed_size();
 #endif //MULTIPLE_HEAPS
 
+#if defined(USE_REGIONS) && defined(MULTIPLE_HEAPS)
+    for (int node = 0; node < MAX_SUPPORTED_NODES; node++)
+    {
+        total_committed += numa_free_regions[node].committed;
+    }
+#endif //USE_REGIONS && MULTIPLE_HEAPS
+
     return total_committed;
 }
 
@@ -22755,6 +23345,80 @@ void gc_heap::get_memory_info (uint32_t* memory_load,
     GCToOSInterface::GetMemoryStatus(is_restricted_physical_mem ? total_physical_mem  : 0,  memory_load, available_physical, available_page_file);
 }
 
+// The OS can tell us a container is under memory pressure well before usage reaches the hard limit:
+// cgroup v2 reclaims and throttles above memory.high, and reports the time tasks spend stalled on
+// memory in memory.pressure. Reading those is a couple of file reads, so we only do it periodically.
+void gc_heap::refresh_memory_pressure()
+{
+    uint64_t now = GetHighPrecisionTimeStamp();
+    if ((now - memory_pressure_refresh_time) < (MEMORY_PRESSURE_REFRESH_MS * 1000))
+        return;
+
+    uint64_t last_refresh_time = memory_pressure_refresh_time;
+    memory_pressure_refresh_time = now;
+
+    uint32_t stall_some = 0;
+    uint32_t stall_full = 0;
+    uint64_t high_limit = 0;
+    if (!GCToOSInterface::GetMemoryPressure (&stall_some, &stall_full, &high_limit))
+    {
+        // If there was nothing to find the first time (not in a cgroup v2 memory cgroup)
+        // don't keep looking.
+        if (last_refresh_time == 0)
+        {
+            memory_stall_th = 0;
+        }
+    }
+
+    memory_stall_some = stall_some;
+    memory_stall_full = stall_full;
+    memory_high_limit = high_limit;
+}
+
+bool gc_heap::memory_pressure_signaled_p()
+{
+    return ((memory_stall_th != 0) &&
+            ((memory_stall_some >= memory_stall_th) || (memory_high_limit != 0)));
+}
+
+// Returns the memory load the pressure signals amount to, so the usual high/very high memory load
+// thresholds (GCHighMemPercent) kick in. Usage is measured against memory.high the same way it is
+// against the limit, and stalls count as high (some tasks stalled) or very high (all tasks stalled)
+// memory load.
+uint32_t gc_heap::get_memory_pressure_load (uint32_t memory_load, uint64_t available_physical)
+{
+    uint32_t pressure_load = 0;
+
+    if (memory_high_limit != 0)
+    {
+        uint64_t used = (total_physical_mem > available_physical) ? (total_physical_mem - available_physical) : 0;
+        pressure_load = (uint32_t)min ((uint64_t)100, (used * 100 / memory_high_limit));
+    }
+
+    if (memory_stall_full >= memory_stall_th)
+    {
+        pressure_load = max (pressure_load, v_high_memory_load_th);
+    }
+    else if (memory_stall_some >= memory_stall_th)
+    {
+        pressure_load = max (pressure_load, high_memory_load_th);
+    }
+
+    if ((pressure_load > memory_load) && (heap_number == 0))
+    {
+        dprintf (GTC_LOG, ("memory pressure: stall some %d full %d, high %I64d -> ml %d (was %d)",
+            memory_stall_some, memory_stall_full, memory_high_limit, pressure_load, memory_load));
+
+        if (EVENT_ENABLED(GCMemoryPressure))
+        {
+            FIRE_EVENT(GCMemoryPressure, memory_stall_some, memory_stall_full, memory_high_limit,
+                       memory_load, pressure_load);
+        }
+    }
+
+    return pressure_load;
+}
+
 void fire_mark_event (int heap_num, int root_type, size_t bytes_marked)
 {
     dprintf (DT_LOG_0, ("-----------[%d]mark %d: %Id", heap_num, root_type, bytes_marked));
@@ -22986,16 +23650,19 @@ void gc_heap::scan_dependent_handles (int condemned_gen_number, ScanContext *sc,
         gc_t_join.join(this, gc_join_rescan_dependent_handles);
         if (gc_t_join.joined())
         {
+            GCScan::GcResetHandleTableClaims();
+
             dprintf(3, ("Starting all gc thread for dependent handle promotion"));
             gc_t_join.restart();
         }
 
-        // If the portion of the dependent handle table managed by this worker has handles that could still be
-        // promoted perform a rescan. If the rescan resulted in at least one promotion note this fact since it
-        // could require a rescan of handles on this or other workers.
-        if (GCScan::GcDhUnpromotedHandlesExist(sc))
-            if (GCScan::GcDhReScan(sc))
-                s_fUnscannedPromotions = TRUE;
+        // Rescan the dependent handle tables. Rather than each worker rescanning the tables of its own slot
+        // the tables are handed out to whichever worker claims them first, so every worker takes part even
+        // if its own portion has nothing left to promote (one slot's tables often hold most of the handles).
+        // If the rescan resulted in at least one promotion note this fact since it could require a rescan of
+        // handles on this or other workers.
+        if (GCScan::GcDhReScan(sc, true))
+            s_fUnscannedPromotions = TRUE;
     }
 }
 #else //MULTIPLE_HEAPS
@@ -23035,6 +23702,20 @@ void gc_heap::scan_dependent_handles (int condemned_gen_number, ScanContext *sc,
 }
 #endif //MULTIPLE_HEAPS
 
+void gc_heap::fire_handle_scan_phase_event (handle_scan_phase phase, uint64_t start_us)
+{
+#ifdef FEATURE_EVENT_TRACE
+    if (EVENT_ENABLED(GCHandleScanPhase))
+    {
+        FIRE_EVENT(GCHandleScanPhase, (uint32_t)heap_number, (uint32_t)phase,
+                   (uint64_t)(GetHighPrecisionTimeStamp() - start_us));
+    }
+#else
+    UNREFERENCED_PARAMETER(phase);
+    UNREFERENCED_PARAMETER(start_us);
+#endif //FEATURE_EVENT_TRACE
+}
+
 size_t gc_heap::get_generation_start_size (int gen_number)
 {
 #ifdef USE_REGIONS
@@ -23429,6 +24110,18 @@ void gc_heap::mark_phase (int condemned_gen_number, BOOL mark_only_p)
     if (do_mark_steal_p)
     {
         mark_steal();
+
+        dprintf (3, ("h%d stole %d objects (%d failed), idle %I64dus, marking stolen %I64dus",
+            heap_number, steal_stats.stolen_count, steal_stats.failed_steal_count,
+            steal_stats.idle_time, steal_stats.stolen_mark_time));
+        if (EVENT_ENABLED(GCMarkSteal))
+        {
+            FIRE_EVENT(GCMarkSteal, (uint32_t)heap_number,
+                       steal_stats.stolen_count,
+                       steal_stats.failed_steal_count,
+                       steal_stats.idle_time,
+                       steal_stats.stolen_mark_time);
+        }
     }
 #endif //MH_SC_MARK
 
@@ -23439,8 +24132,10 @@ void gc_heap::mark_phase (int condemned_gen_number, BOOL mark_only_p)
     // to optimize away further scans. The call to scan_dependent_handles is what will cycle through more
     // iterations if required and will also perform processing of any mark stack overflow once the dependent
     // handle table has been fully promoted.
+    uint64_t handle_scan_start = GetHighPrecisionTimeStamp();
     GCScan::GcDhInitialScan(GCHeap::Promote, condemned_gen_number, max_generation, &sc);
     scan_dependent_handles(condemned_gen_number, &sc, true);
+    fire_handle_scan_phase_event (handle_scan_dependent_promotion, handle_scan_start);
 
 #ifdef MULTIPLE_HEAPS
     dprintf(3, ("Joining for short weak handle scan"));
@@ -23471,6 +24166,8 @@ void gc_heap::mark_phase (int condemned_gen_number, BOOL mark_only_p)
             gc_t_join.r_init();
         }
 
+        GCScan::GcResetHandleTableClaims();
+
         dprintf(3, ("Starting all gc thread for short weak handle scan"));
         gc_t_join.restart();
 #endif //MULTIPLE_HEAPS
@@ -23493,7 +24190,13 @@ void gc_heap::mark_phase (int condemned_gen_number, BOOL mark_only_p)
 #endif // FEATURE_CARD_MARKING_STEALING
 
     // null out the target of short weakref that were not promoted.
+    handle_scan_start = GetHighPrecisionTimeStamp();
+#ifdef MULTIPLE_HEAPS
+    GCScan::GcShortWeakPtrScan(GCHeap::Promote, condemned_gen_number, max_generation, &sc, true);
+#else
     GCScan::GcShortWeakPtrScan(GCHeap::Promote, condemned_gen_number, max_generation,&sc);
+#endif //MULTIPLE_HEAPS
+    fire_handle_scan_phase_event (handle_scan_short_weak, handle_scan_start);
 
 #ifdef MULTIPLE_HEAPS
     dprintf(3, ("Joining for finalization"));
@@ -23517,7 +24220,9 @@ void gc_heap::mark_phase (int condemned_gen_number, BOOL mark_only_p)
 
     // Scan dependent handles again to promote any secondaries associated with primaries that were promoted
     // for finalization. As before scan_dependent_handles will also process any mark stack overflow.
+    handle_scan_start = GetHighPrecisionTimeStamp();
     scan_dependent_handles(condemned_gen_number, &sc, false);
+    fire_handle_scan_phase_event (handle_scan_dependent_promotion, handle_scan_start);
 
 #ifdef MULTIPLE_HEAPS
     static VOLATILE(int32_t) syncblock_scan_p;
@@ -23527,12 +24232,19 @@ void gc_heap::mark_phase (int condemned_gen_number, BOOL mark_only_p)
     {
         dprintf(3, ("Starting all gc thread for weak pointer deletion"));
         syncblock_scan_p = 0;
+        GCScan::GcResetHandleTableClaims();
         gc_t_join.restart();
     }
 #endif //MULTIPLE_HEAPS
 
     // null out the target of long weakref that were not promoted.
+    handle_scan_start = GetHighPrecisionTimeStamp();
+#ifdef MULTIPLE_HEAPS
+    GCScan::GcWeakPtrScan (GCHeap::Promote, condemned_gen_number, max_generation, &sc, true);
+#else
     GCScan::GcWeakPtrScan (GCHeap::Promote, condemned_gen_number, max_generation, &sc);
+#endif //MULTIPLE_HEAPS
+    fire_handle_scan_phase_event (handle_scan_long_weak, handle_scan_start);
 
 #ifdef MULTIPLE_HEAPS
 #ifdef MARK_LIST
@@ -23671,6 +24383,14 @@ void gc_heap::mark_phase (int condemned_gen_number, BOOL mark_only_p)
 #endif //BACKGROUND_GC
 
     promoted_bytes (heap_number) -= promoted_bytes_live;
+
+#ifdef FEATURE_EVENT_TRACE
+    if (layout_stats_p)
+    {
+        fire_layout_stats_events();
+    }
+#endif //FEATURE_EVENT_TRACE
+
     dprintf(2,("---- End of mark phase ----"));
 }
 
@@ -30226,6 +30946,8 @@ BOOL gc_heap::commit_mark_array_by_range (uint8_t* begin, uint8_t* end, uint32_t
 
     if (virtual_commit (commit_start, size, gc_oh_num::none))
     {
+        prefer_large_pages (commit_start, size);
+
         // We can only verify the mark array is cleared from begin to end, the first and the last
         // page aren't necessarily all cleared 'cause they could be used by other segments or
         // card bundle.
@@ -33296,6 +34018,34 @@ uint8_t* gc_heap::find_first_object (uint8_t* start, uint8_t* first_object)
     return o;
 }
 
+// Find the first non-zero card word in [card_word, card_word_end), returns card_word_end
+// if they are all clear. Long runs are handed to the vectorized scanners, which test
+// 512 cards at a time; short ones aren't worth the call.
+inline
+uint32_t* find_nonzero_card_word (uint32_t* card_word, uint32_t* card_word_end)
+{
+#ifdef USE_VXSORT
+    const size_t vectorized_scan_min_words = 32;
+
+    if ((size_t)(card_word_end - card_word) >= vectorized_scan_min_words)
+    {
+#ifdef TARGET_ARM64
+        if (IsSupportedInstructionSet (InstructionSet::NEON))
+            return find_nonzero_card_word_neon (card_word, card_word_end);
+#else //TARGET_ARM64
+        if (IsSupportedInstructionSet (InstructionSet::AVX2))
+            return find_nonzero_card_word_avx2 (card_word, card_word_end);
+#endif //TARGET_ARM64
+    }
+#endif //USE_VXSORT
+
+    while ((card_word < card_word_end) && !(*card_word))
+    {
+        card_word++;
+    }
+    return card_word;
+}
+
 #ifdef CARD_BUNDLE
 // Find the first non-zero card word between cardw and cardw_end.
 // The index of the word we find is returned in cardw.
@@ -33310,20 +34060,24 @@ BOOL gc_heap::find_card_dword (size_t& cardw, size_t cardw_end)
         size_t end_cardb = cardw_card_bundle (align_cardw_on_bundle (cardw_end));
         while (1)
         {
-            // Find a non-zero bundle
+            // Find a non-zero bundle, stepping over whole clear bundle words
             while ((cardb < end_cardb) && (card_bundle_set_p (cardb) == 0))
             {
-                cardb++;
+                if ((card_bundle_bit (cardb) == 0) && (card_bundle_table[card_bundle_word (cardb)] == 0))
+                {
+                    cardb = min (cardb + card_bundle_word_width, end_cardb);
+                }
+                else
+                {
+                    cardb++;
+                }
             }
             if (cardb == end_cardb)
                 return FALSE;
 
             uint32_t* card_word = &card_table[max(card_bundle_cardw (cardb),cardw)];
             uint32_t* card_word_end = &card_table[min(card_bundle_cardw (cardb+1),cardw_end)];
-            while ((card_word < card_word_end) && !(*card_word))
-            {
-                card_word++;
-            }
+            card_word = find_nonzero_card_word (card_word, card_word_end);
 
             if (card_word != card_word_end)
             {
@@ -33346,18 +34100,12 @@ BOOL gc_heap::find_card_dword (size_t& cardw, size_t cardw_end)
     }
     else
     {
-        uint32_t* card_word = &card_table[cardw];
-        uint32_t* card_word_end = &card_table [cardw_end];
+        uint32_t* card_word = find_nonzero_card_word (&card_table[cardw], &card_table [cardw_end]);
 
-        while (card_word < card_word_end)
+        if (card_word != &card_table [cardw_end])
         {
-            if ((*card_word) != 0)
-            {
-                cardw = (card_word - &card_table [0]);
-                return TRUE;
-            }
-
-            card_word++;
+            cardw = (card_word - &card_table [0]);
+            return TRUE;
         }
         return FALSE;
 
@@ -33407,12 +34155,7 @@ BOOL gc_heap::find_card(uint32_t* card_table,
 #else //CARD_BUNDLE
         // Go through the remaining card words between here and card_word_end until we find
         // one that is non-zero.
-        do
-        {
-            ++last_card_word;
-        }
-
-        while ((last_card_word < &card_table [card_word_end]) && !(*last_card_word));
+        last_card_word = find_nonzero_card_word (last_card_word + 1, &card_table [card_word_end]);
         if (last_card_word < &card_table [card_word_end])
         {
             card_word_value = *last_card_word;
@@ -35879,6 +36622,11 @@ size_t gc_heap::desired_new_allocation (dynamic_data* dd,
             new_allocation = linear_allocation_model (allocation_fraction, new_allocation,
                                                       dd_desired_allocation (dd), dd_collection_count (dd));
 
+            if (pause_target_us)
+            {
+                new_allocation = apply_pause_target_budget (gen_number, new_allocation, min_gc_size);
+            }
+
             if (gen_number == 0)
             {
                 if (pass == 0)
@@ -36328,7 +37076,13 @@ void gc_heap::decommit_ephemeral_segment_pages()
 #ifdef MULTIPLE_HEAPS
     if (decommit_target < heap_segment_committed (ephemeral_heap_segment))
     {
-        gradual_decommit_in_progress_p = TRUE;
+        if (!gradual_decommit_in_progress_p)
+        {
+            // start accruing budget from now rather than from the end of the last round
+            gradual_decommit_in_progress_p = TRUE;
+            decommit_budget = 0;
+            last_decommit_step_time = GetHighPrecisionTimeStamp();
+        }
     }
 #ifdef _DEBUG
     // these are only for checking against logic errors
@@ -36346,9 +37100,9 @@ void gc_heap::decommit_ephemeral_segment_pages()
     // this is the amount we were planning to decommit
     ptrdiff_t decommit_size = heap_segment_committed (ephemeral_heap_segment) - decommit_target;
 
-    // we do a max of DECOMMIT_SIZE_PER_MILLISECOND per millisecond of elapsed time since the last GC
+    // we do a max of decommit_size_per_ms per millisecond of elapsed time since the last GC
     // we limit the elapsed time to 10 seconds to avoid spending too much time decommitting
-    ptrdiff_t max_decommit_size = min (ephemeral_elapsed, (10*1000)) * DECOMMIT_SIZE_PER_MILLISECOND;
+    ptrdiff_t max_decommit_size = min (ephemeral_elapsed, (10*1000)) * decommit_size_per_ms;
     decommit_size = min (decommit_size, max_decommit_size);
 
     slack_space = heap_segment_committed (ephemeral_heap_segment) - heap_segment_allocated (ephemeral_heap_segment) - decommit_size;
@@ -36360,24 +37114,57 @@ void gc_heap::decommit_ephemeral_segment_pages()
 }
 
 #ifdef MULTIPLE_HEAPS
-// return true if we actually decommitted anything
+// return true if there is more to decommit
+//
+// The budget is per process and grows with the time elapsed since the last step,
+// so the decommit rate doesn't scale with the number of heaps and a step that was
+// delayed doesn't fall behind. Heaps are served in turn from a rotating start and
+// we never issue a call for less than MIN_DECOMMIT_SIZE unless that finishes the
+// heap - the leftover is carried over so it goes out as one larger call later.
 bool gc_heap::decommit_step ()
 {
     // should never get here for large pages because decommit_ephemeral_segment_pages
     // will not do anything if use_large_pages_p is true
     assert (!use_large_pages_p);
 
-    size_t decommit_size = 0;
+    uint64_t now = GetHighPrecisionTimeStamp();
+    size_t elapsed_ms = (size_t)((now - last_decommit_step_time) / 1000);
+    last_decommit_step_time = now;
+
+    // don't let a long wait (e.g. a suspended process) turn into a burst of decommits
+    elapsed_ms = min (elapsed_ms, (size_t)(2 * DECOMMIT_TIME_STEP_MILLISECONDS));
+    decommit_budget = min (decommit_budget + elapsed_ms * decommit_size_per_ms, 2 * max_decommit_step_size);
+
+    bool more_to_decommit_p = false;
+    int start_heap = decommit_step_start_heap;
     for (int i = 0; i < n_heaps; i++)
     {
-        gc_heap* hp = gc_heap::g_heaps[i];
-        decommit_size += hp->decommit_ephemeral_segment_pages_step ();
+        int heap_index = (start_heap + i) % n_heaps;
+        gc_heap* hp = gc_heap::g_heaps[heap_index];
+
+        size_t remaining = hp->decommit_ephemeral_segment_pages_step (decommit_budget);
+        if (remaining != 0)
+        {
+            if (!more_to_decommit_p)
+            {
+                // the first heap we couldn't finish goes first next time
+                decommit_step_start_heap = heap_index;
+                more_to_decommit_p = true;
+            }
+        }
+    }
+
+    if (!more_to_decommit_p)
+    {
+        decommit_budget = 0;
     }
-    return (decommit_size != 0);
+
+    return more_to_decommit_p;
 }
 
-// return the decommitted size
-size_t gc_heap::decommit_ephemeral_segment_pages_step ()
+// decommit as much of what this heap wants to decommit as the budget allows,
+// charging it against the budget; return how much is left to decommit
+size_t gc_heap::decommit_ephemeral_segment_pages_step (size_t& budget)
 {
     // we rely on desired allocation not being changed outside of GC
     assert (ephemeral_heap_segment->saved_desired_allocation == dd_desired_allocation (dynamic_data_of (0)));
@@ -36394,18 +37181,27 @@ size_t gc_heap::decommit_ephemeral_segment_pages_step ()
         // how much would we need to decommit to get to decommit_target in one step?
         size_t full_decommit_size = (committed - decommit_target);
 
-        // don't do more than max_decommit_step_size per step
-        size_t decommit_size = min (max_decommit_step_size, full_decommit_size);
+        // don't do more than max_decommit_step_size per step or what's left of the budget
+        size_t decommit_size = min (min (max_decommit_step_size, full_decommit_size), budget);
+
+        // a partial decommit has to be worth the OS call, otherwise wait for more budget
+        if ((decommit_size < full_decommit_size) && (decommit_size < MIN_DECOMMIT_SIZE))
+        {
+            return full_decommit_size;
+        }
 
         // figure out where the new committed should be
         uint8_t* new_committed = (committed - decommit_size);
         size_t size = decommit_heap_segment_pages_worker (ephemeral_heap_segment, new_committed);
+        budget -= min (size, budget);
 
 #ifdef _DEBUG
         ephemeral_heap_segment->saved_committed = committed - size;
 #endif // _DEBUG
 
-        return size;
+        // the target isn't page aligned so we consider ourselves done once we are within a page of it
+        return ((size < full_decommit_size) && ((full_decommit_size - size) >= OS_PAGE_SIZE)) ?
+            (full_decommit_size - size) : 0;
     }
     return 0;
 }
@@ -39591,6 +40387,340 @@ void gc_heap::leave_gc_lock_for_verify_heap()
 #endif // VERIFY_HEAP
 }
 
+// Verifies the objects, bricks and cards of a single segment. This only reads the
+// heap so under Server GC it may be called by any GC thread, not just this heap's.
+void gc_heap::verify_heap_segment (heap_segment* seg, int curr_gen_num, int heap_verify_level,
+                                   size_t* objects_verified, size_t* objects_verified_deep)
+{
+    int             align_const = get_alignment_constant (curr_gen_num == max_generation);
+    BOOL            large_brick_p = (curr_gen_num > max_generation);
+
+    BOOL            bCurrentBrickInvalid = FALSE;
+    size_t          last_valid_brick = 0;
+    size_t          curr_brick = 0;
+    size_t          prev_brick = (size_t)-1;
+#ifdef USE_REGIONS
+    int             gen_num_for_cards = ((curr_gen_num >= max_generation) ? max_generation : curr_gen_num);
+    uint8_t*        e_high = 0;
+    uint8_t*        next_boundary = 0;
+#else //USE_REGIONS
+    int             gen_num_for_cards = 0;
+    uint8_t*        e_high = ephemeral_high;
+    uint8_t*        next_boundary = generation_allocation_start (generation_of (max_generation - 1));
+    uint8_t*        begin_youngest = generation_allocation_start(generation_of(0));
+#endif //!USE_REGIONS
+
+    uint8_t*        curr_object = heap_segment_mem (seg);
+    uint8_t*        prev_object = 0;
+
+#ifdef USE_REGIONS
+    if (heap_segment_gen_num (seg) != heap_segment_plan_gen_num (seg))
+    {
+        dprintf (1, ("Seg %Ix, gen num is %d, plan gen num is %d",
+            heap_segment_mem (seg), heap_segment_gen_num (seg), heap_segment_plan_gen_num (seg)));
+        FATAL_GC_ERROR();
+    }
+#endif //USE_REGIONS
+
+#ifdef BACKGROUND_GC
+    BOOL consider_bgc_mark_p    = FALSE;
+    BOOL check_current_sweep_p  = FALSE;
+    BOOL check_saved_sweep_p    = FALSE;
+    should_check_bgc_mark (seg, &consider_bgc_mark_p, &check_current_sweep_p, &check_saved_sweep_p);
+#endif //BACKGROUND_GC
+
+    while (curr_object < heap_segment_allocated (seg))
+    {
+        if (is_mark_set (curr_object))
+        {
+            dprintf (1, ("curr_object: %Ix is marked!",(size_t)curr_object));
+            FATAL_GC_ERROR();
+        }
+
+        size_t s = size (curr_object);
+        dprintf (3, ("o: %Ix, s: %d", (size_t)curr_object, s));
+        if (s == 0)
+        {
+            dprintf (1, ("Verifying Heap: size of current object %Ix == 0", curr_object));
+            FATAL_GC_ERROR();
+        }
+
+#ifndef USE_REGIONS
+        // handle generation boundaries within ephemeral segment
+        if (seg == ephemeral_heap_segment)
+        {
+            if ((curr_gen_num > 0) && (curr_object >= next_boundary))
+            {
+                curr_gen_num--;
+                if (curr_gen_num > 0)
+                {
+                    next_boundary = generation_allocation_start (generation_of (curr_gen_num - 1));
+                }
+            }
+        }
+#endif //!USE_REGIONS
+
+#ifdef USE_REGIONS
+        if (curr_gen_num != 0)
+#else
+        // If object is not in the youngest generation, then lets
+        // verify that the brick table is correct....
+        if (((seg != ephemeral_heap_segment) ||
+             (brick_of(curr_object) < brick_of(begin_youngest))))
+#endif //USE_REGIONS
+        {
+            curr_brick = brick_of(curr_object);
+
+            // Brick Table Verification...
+            //
+            // On brick transition
+            //     if brick is negative
+            //          verify that brick indirects to previous valid brick
+            //     else
+            //          set current brick invalid flag to be flipped if we
+            //          encounter an object at the correct place
+            //
+            if (curr_brick != prev_brick)
+            {
+                // If the last brick we were examining had positive
+                // entry but we never found the matching object, then
+                // we have a problem
+                // If prev_brick was the last one of the segment
+                // it's ok for it to be invalid because it is never looked at
+                if (bCurrentBrickInvalid &&
+                    (curr_brick != brick_of (heap_segment_mem (seg))) &&
+                    !heap_segment_read_only_p (seg))
+                {
+                    dprintf (1, ("curr brick %Ix invalid", curr_brick));
+                    FATAL_GC_ERROR();
+                }
+
+                if (large_brick_p)
+                {
+                    //large objects verify the table only if they are in
+                    //range.
+                    if ((heap_segment_reserved (seg) <= highest_address) &&
+                        (heap_segment_mem (seg) >= lowest_address) &&
+                        brick_table [curr_brick] != 0)
+                    {
+                        dprintf (1, ("curr_brick %Ix for large object %Ix is set to %Ix",
+                            curr_brick, (size_t)curr_object, (size_t)brick_table[curr_brick]));
+                        FATAL_GC_ERROR();
+                    }
+                    else
+                    {
+                        bCurrentBrickInvalid = FALSE;
+                    }
+                }
+                else
+                {
+                    // If the current brick contains a negative value make sure
+                    // that the indirection terminates at the last  valid brick
+                    if (brick_table [curr_brick] <= 0)
+                    {
+                        if (brick_table [curr_brick] == 0)
+                        {
+                            dprintf(1, ("curr_brick %Ix for object %Ix set to 0",
+                                    curr_brick, (size_t)curr_object));
+                            FATAL_GC_ERROR();
+                        }
+                        ptrdiff_t i = curr_brick;
+                        while ((i >= ((ptrdiff_t) brick_of (heap_segment_mem (seg)))) &&
+                               (brick_table[i] < 0))
+                        {
+                            i = i + brick_table[i];
+                        }
+                        if (i <  ((ptrdiff_t)(brick_of (heap_segment_mem (seg))) - 1))
+                        {
+                            dprintf (1, ("ptrdiff i: %Ix < brick_of (heap_segment_mem (seg)):%Ix - 1. curr_brick: %Ix",
+                                    i, brick_of (heap_segment_mem (seg)),
+                                    curr_brick));
+                            FATAL_GC_ERROR();
+                        }
+                        bCurrentBrickInvalid = FALSE;
+                    }
+                    else if (!heap_segment_read_only_p (seg))
+                    {
+                        bCurrentBrickInvalid = TRUE;
+                    }
+                }
+            }
+
+            if (bCurrentBrickInvalid)
+            {
+                if (curr_object == (brick_address(curr_brick) + brick_table[curr_brick] - 1))
+                {
+                    bCurrentBrickInvalid = FALSE;
+                    last_valid_brick = curr_brick;
+                }
+            }
+        }
+
+        if ((*((uint8_t**)curr_object) != (uint8_t *) g_gc_pFreeObjectMethodTable) &&
+            verify_sampled_brick_p (brick_of (curr_object)))
+        {
+#ifdef FEATURE_LOH_COMPACTION
+            if ((curr_gen_num == loh_generation) && (prev_object != 0))
+            {
+                assert (method_table (prev_object) == g_gc_pFreeObjectMethodTable);
+            }
+#endif //FEATURE_LOH_COMPACTION
+
+            (*objects_verified)++;
+
+            BOOL can_verify_deep = TRUE;
+#ifdef BACKGROUND_GC
+            can_verify_deep = fgc_should_consider_object (curr_object, seg, consider_bgc_mark_p, check_current_sweep_p, check_saved_sweep_p);
+#endif //BACKGROUND_GC
+
+            BOOL deep_verify_obj = can_verify_deep;
+            if ((heap_verify_level & GCConfig::HEAPVERIFY_DEEP_ON_COMPACT) && !settings.compaction)
+                deep_verify_obj = FALSE;
+
+            ((CObjectHeader*)curr_object)->ValidateHeap(deep_verify_obj);
+
+            if (can_verify_deep)
+            {
+                if (curr_gen_num > 0)
+                {
+                    BOOL need_card_p = FALSE;
+                    if (contain_pointers_or_collectible (curr_object))
+                    {
+                        dprintf (4, ("curr_object: %Ix", (size_t)curr_object));
+                        size_t crd = card_of (curr_object);
+                        BOOL found_card_p = card_set_p (crd);
+
+#ifdef COLLECTIBLE_CLASS
+                        if (is_collectible(curr_object))
+                        {
+                            uint8_t* class_obj = get_class_object (curr_object);
+                            if (check_need_card (class_obj, gen_num_for_cards, next_boundary, e_high))
+                            {
+                                if (!found_card_p)
+                                {
+                                    dprintf (1, ("Card not set, curr_object = [%Ix:%Ix pointing to class object %Ix",
+                                                card_of (curr_object), (size_t)curr_object, class_obj));
+                                    FATAL_GC_ERROR();
+                                }
+                            }
+                        }
+#endif //COLLECTIBLE_CLASS
+
+                        if (contain_pointers(curr_object))
+                        {
+                            go_through_object_nostart
+                                (method_table(curr_object), curr_object, s, oo,
+                                {
+                                    if (crd != card_of ((uint8_t*)oo))
+                                    {
+                                        crd = card_of ((uint8_t*)oo);
+                                        found_card_p = card_set_p (crd);
+                                        need_card_p = FALSE;
+                                    }
+                                    if (*oo && check_need_card (*oo, gen_num_for_cards, next_boundary, e_high))
+                                    {
+                                        need_card_p = TRUE;
+                                    }
+
+                                    if (need_card_p && !found_card_p)
+                                    {
+                                        dprintf (1, ("Card not set, curr_object = [%Ix:%Ix, %Ix:%Ix[",
+                                                    card_of (curr_object), (size_t)curr_object,
+                                                    card_of (curr_object+Align(s, align_const)), 
+                                                    (size_t)(curr_object+Align(s, align_const))));
+                                        FATAL_GC_ERROR();
+                                    }
+                                }
+                                    );
+                        }
+                        if (need_card_p && !found_card_p)
+                        {
+                            dprintf (1, ("Card not set, curr_object = [%Ix:%Ix, %Ix:%Ix[",
+                                card_of (curr_object), (size_t)curr_object,
+                                card_of (curr_object + Align(s, align_const)),
+                                (size_t)(curr_object + Align(s, align_const))));
+                            FATAL_GC_ERROR();
+                        }
+                    }
+                }
+                (*objects_verified_deep)++;
+            }
+        }
+
+        prev_object = curr_object;
+        prev_brick = curr_brick;
+        curr_object = curr_object + Align(s, align_const);
+        if (curr_object < prev_object)
+        {
+            dprintf (1, ("overflow because of a bad object size: %Ix size %Ix", prev_object, s));
+            FATAL_GC_ERROR();
+        }
+    }
+
+    if (curr_object > heap_segment_allocated(seg))
+    {
+        dprintf (1, ("Verifiying Heap: curr_object: %Ix > heap_segment_allocated (seg: %Ix) %Ix",
+                (size_t)curr_object, (size_t)seg, heap_segment_allocated (seg)));
+        FATAL_GC_ERROR();
+    }
+}
+
+// Walks this heap's segments in a fixed order. Under Server GC every GC thread
+// calls this for every heap once it's done with its own, and each segment is
+// verified by whichever thread claims its index first.
+void gc_heap::verify_heap_segments (int heap_verify_level, size_t* objects_verified, size_t* objects_verified_deep)
+{
+#ifdef USE_REGIONS
+    int gen_num_to_stop = 0;
+#else //USE_REGIONS
+    // For no regions the gen number is seperately reduced when we detect the ephemeral seg.
+    int gen_num_to_stop = max_generation;
+#endif //!USE_REGIONS
+
+#ifdef MULTIPLE_HEAPS
+    // the claimed indices only ever go up and we walk the segments in the same order
+    // on every thread, so we always get to the one we claimed
+    int claimed_index = Interlocked::Increment (&verify_seg_claim_index) - 1;
+#endif //MULTIPLE_HEAPS
+    int seg_index = 0;
+
+    // go through all generations starting with the highest
+    for (int curr_gen_num = total_generation_count - 1; curr_gen_num >= gen_num_to_stop; curr_gen_num--)
+    {
+        heap_segment* seg = heap_segment_in_range (generation_start_segment (generation_of (curr_gen_num)));
+
+        while (seg)
+        {
+#ifdef MULTIPLE_HEAPS
+            if (seg_index == claimed_index)
+#endif //MULTIPLE_HEAPS
+            {
+                verify_heap_segment (seg, curr_gen_num, heap_verify_level, objects_verified, objects_verified_deep);
+#ifdef MULTIPLE_HEAPS
+                claimed_index = Interlocked::Increment (&verify_seg_claim_index) - 1;
+#endif //MULTIPLE_HEAPS
+            }
+
+            seg_index++;
+            seg = heap_segment_next_in_range (seg);
+        }
+    }
+}
+
+// With HeapVerifySamplePercent we still walk every object, which is cheap, but only
+// validate the objects and their cards that start in a pseudo randomly chosen subset of
+// bricks. The subset changes with every GC so over time all of the heap gets checked.
+BOOL gc_heap::verify_sampled_brick_p (size_t brick)
+{
+    if (heap_verify_sample_percent == 0)
+    {
+        return TRUE;
+    }
+
+    uint64_t h = ((uint64_t)brick ^ ((uint64_t)settings.gc_index << 40)) * 0x9E3779B97F4A7C15ULL;
+    return (((h >> 32) % 100) < (uint64_t)heap_verify_sample_percent);
+}
+
 void gc_heap::verify_heap (BOOL begin_gc_p)
 {
     int heap_verify_level = static_cast<int>(GCConfig::GetHeapVerifyLevel());
@@ -39673,6 +40803,8 @@ void gc_heap::verify_heap (BOOL begin_gc_p)
             {
                 g_heaps[i]->copy_brick_card_table();
             }
+
+            g_heaps[i]->verify_seg_claim_index = 0;
         }
 
         current_join->restart();
@@ -39715,291 +40847,16 @@ void gc_heap::verify_heap (BOOL begin_gc_p)
     size_t          total_objects_verified = 0;
     size_t          total_objects_verified_deep = 0;
 
-    BOOL            bCurrentBrickInvalid = FALSE;
-    size_t          last_valid_brick = 0;
-    size_t          curr_brick = 0;
-    size_t          prev_brick = (size_t)-1;
-    int             gen_num_for_cards = 0;
-#ifdef USE_REGIONS
-    int             gen_num_to_stop = 0;
-    uint8_t*        e_high = 0;
-    uint8_t*        next_boundary = 0;
-#else //USE_REGIONS
-    // For no regions the gen number is seperately reduced when we detect the ephemeral seg.
-    int gen_num_to_stop = max_generation;
-    uint8_t*        e_high = ephemeral_high;
-    uint8_t*        next_boundary = generation_allocation_start (generation_of (max_generation - 1));
-    uint8_t*        begin_youngest = generation_allocation_start(generation_of(0));
-#endif //!USE_REGIONS
-
-    // go through all generations starting with the highest
-    for (int curr_gen_num = total_generation_count - 1; curr_gen_num >= gen_num_to_stop; curr_gen_num--)
+#ifdef MULTIPLE_HEAPS
+    // start with our own heap, then help the heaps that still have segments left
+    for (int i = 0; i < n_heaps; i++)
     {
-        int             align_const = get_alignment_constant (curr_gen_num == max_generation);
-        BOOL            large_brick_p = (curr_gen_num > max_generation);
-#ifdef USE_REGIONS
-        gen_num_for_cards = ((curr_gen_num >= max_generation) ? max_generation : curr_gen_num);
-#endif //USE_REGIONS
-        heap_segment*   seg = heap_segment_in_range (generation_start_segment (generation_of (curr_gen_num) ));
-
-        while (seg)
-        {
-            uint8_t*        curr_object = heap_segment_mem (seg);
-            uint8_t*        prev_object = 0;
-
-#ifdef USE_REGIONS
-            if (heap_segment_gen_num (seg) != heap_segment_plan_gen_num (seg))
-            {
-                dprintf (1, ("Seg %Ix, gen num is %d, plan gen num is %d",
-                    heap_segment_mem (seg), heap_segment_gen_num (seg), heap_segment_plan_gen_num (seg)));
-                FATAL_GC_ERROR();
-            }
-#endif //USE_REGIONS
-
-#ifdef BACKGROUND_GC
-            BOOL consider_bgc_mark_p    = FALSE;
-            BOOL check_current_sweep_p  = FALSE;
-            BOOL check_saved_sweep_p    = FALSE;
-            should_check_bgc_mark (seg, &consider_bgc_mark_p, &check_current_sweep_p, &check_saved_sweep_p);
-#endif //BACKGROUND_GC
-
-            while (curr_object < heap_segment_allocated (seg))
-            {
-                if (is_mark_set (curr_object))
-                {
-                    dprintf (1, ("curr_object: %Ix is marked!",(size_t)curr_object));
-                    FATAL_GC_ERROR();
-                }
-
-                size_t s = size (curr_object);
-                dprintf (3, ("o: %Ix, s: %d", (size_t)curr_object, s));
-                if (s == 0)
-                {
-                    dprintf (1, ("Verifying Heap: size of current object %Ix == 0", curr_object));
-                    FATAL_GC_ERROR();
-                }
-
-#ifndef USE_REGIONS
-                // handle generation boundaries within ephemeral segment
-                if (seg == ephemeral_heap_segment)
-                {
-                    if ((curr_gen_num > 0) && (curr_object >= next_boundary))
-                    {
-                        curr_gen_num--;
-                        if (curr_gen_num > 0)
-                        {
-                            next_boundary = generation_allocation_start (generation_of (curr_gen_num - 1));
-                        }
-                    }
-                }
-#endif //!USE_REGIONS
-
-#ifdef USE_REGIONS
-                if (curr_gen_num != 0)
-#else
-                // If object is not in the youngest generation, then lets
-                // verify that the brick table is correct....
-                if (((seg != ephemeral_heap_segment) ||
-                     (brick_of(curr_object) < brick_of(begin_youngest))))
-#endif //USE_REGIONS
-                {
-                    curr_brick = brick_of(curr_object);
-
-                    // Brick Table Verification...
-                    //
-                    // On brick transition
-                    //     if brick is negative
-                    //          verify that brick indirects to previous valid brick
-                    //     else
-                    //          set current brick invalid flag to be flipped if we
-                    //          encounter an object at the correct place
-                    //
-                    if (curr_brick != prev_brick)
-                    {
-                        // If the last brick we were examining had positive
-                        // entry but we never found the matching object, then
-                        // we have a problem
-                        // If prev_brick was the last one of the segment
-                        // it's ok for it to be invalid because it is never looked at
-                        if (bCurrentBrickInvalid &&
-                            (curr_brick != brick_of (heap_segment_mem (seg))) &&
-                            !heap_segment_read_only_p (seg))
-                        {
-                            dprintf (1, ("curr brick %Ix invalid", curr_brick));
-                            FATAL_GC_ERROR();
-                        }
-
-                        if (large_brick_p)
-                        {
-                            //large objects verify the table only if they are in
-                            //range.
-                            if ((heap_segment_reserved (seg) <= highest_address) &&
-                                (heap_segment_mem (seg) >= lowest_address) &&
-                                brick_table [curr_brick] != 0)
-                            {
-                                dprintf (1, ("curr_brick %Ix for large object %Ix is set to %Ix",
-                                    curr_brick, (size_t)curr_object, (size_t)brick_table[curr_brick]));
-                                FATAL_GC_ERROR();
-                            }
-                            else
-                            {
-                                bCurrentBrickInvalid = FALSE;
-                            }
-                        }
-                        else
-                        {
-                            // If the current brick contains a negative value make sure
-                            // that the indirection terminates at the last  valid brick
-                            if (brick_table [curr_brick] <= 0)
-                            {
-                                if (brick_table [curr_brick] == 0)
-                                {
-                                    dprintf(1, ("curr_brick %Ix for object %Ix set to 0",
-                                            curr_brick, (size_t)curr_object));
-                                    FATAL_GC_ERROR();
-                                }
-                                ptrdiff_t i = curr_brick;
-                                while ((i >= ((ptrdiff_t) brick_of (heap_segment_mem (seg)))) &&
-                                       (brick_table[i] < 0))
-                                {
-                                    i = i + brick_table[i];
-                                }
-                                if (i <  ((ptrdiff_t)(brick_of (heap_segment_mem (seg))) - 1))
-                                {
-                                    dprintf (1, ("ptrdiff i: %Ix < brick_of (heap_segment_mem (seg)):%Ix - 1. curr_brick: %Ix",
-                                            i, brick_of (heap_segment_mem (seg)),
-                                            curr_brick));
-                                    FATAL_GC_ERROR();
-                                }
-                                bCurrentBrickInvalid = FALSE;
-                            }
-                            else if (!heap_segment_read_only_p (seg))
-                            {
-                                bCurrentBrickInvalid = TRUE;
-                            }
-                        }
-                    }
-
-                    if (bCurrentBrickInvalid)
-                    {
-                        if (curr_object == (brick_address(curr_brick) + brick_table[curr_brick] - 1))
-                        {
-                            bCurrentBrickInvalid = FALSE;
-                            last_valid_brick = curr_brick;
-                        }
-                    }
-                }
-
-                if (*((uint8_t**)curr_object) != (uint8_t *) g_gc_pFreeObjectMethodTable)
-                {
-#ifdef FEATURE_LOH_COMPACTION
-                    if ((curr_gen_num == loh_generation) && (prev_object != 0))
-                    {
-                        assert (method_table (prev_object) == g_gc_pFreeObjectMethodTable);
-                    }
-#endif //FEATURE_LOH_COMPACTION
-
-                    total_objects_verified++;
-
-                    BOOL can_verify_deep = TRUE;
-#ifdef BACKGROUND_GC
-                    can_verify_deep = fgc_should_consider_object (curr_object, seg, consider_bgc_mark_p, check_current_sweep_p, check_saved_sweep_p);
-#endif //BACKGROUND_GC
-
-                    BOOL deep_verify_obj = can_verify_deep;
-                    if ((heap_verify_level & GCConfig::HEAPVERIFY_DEEP_ON_COMPACT) && !settings.compaction)
-                        deep_verify_obj = FALSE;
-
-                    ((CObjectHeader*)curr_object)->ValidateHeap(deep_verify_obj);
-
-                    if (can_verify_deep)
-                    {
-                        if (curr_gen_num > 0)
-                        {
-                            BOOL need_card_p = FALSE;
-                            if (contain_pointers_or_collectible (curr_object))
-                            {
-                                dprintf (4, ("curr_object: %Ix", (size_t)curr_object));
-                                size_t crd = card_of (curr_object);
-                                BOOL found_card_p = card_set_p (crd);
-
-#ifdef COLLECTIBLE_CLASS
-                                if (is_collectible(curr_object))
-                                {
-                                    uint8_t* class_obj = get_class_object (curr_object);
-                                    if (check_need_card (class_obj, gen_num_for_cards, next_boundary, e_high))
-                                    {
-                                        if (!found_card_p)
-                                        {
-                                            dprintf (1, ("Card not set, curr_object = [%Ix:%Ix pointing to class object %Ix",
-                                                        card_of (curr_object), (size_t)curr_object, class_obj));
-                                            FATAL_GC_ERROR();
-                                        }
-                                    }
-                                }
-#endif //COLLECTIBLE_CLASS
-
-                                if (contain_pointers(curr_object))
-                                {
-                                    go_through_object_nostart
-                                        (method_table(curr_object), curr_object, s, oo,
-                                        {
-                                            if (crd != card_of ((uint8_t*)oo))
-                                            {
-                                                crd = card_of ((uint8_t*)oo);
-                                                found_card_p = card_set_p (crd);
-                                                need_card_p = FALSE;
-                                            }
-                                            if (*oo && check_need_card (*oo, gen_num_for_cards, next_boundary, e_high))
-                                            {
-                                                need_card_p = TRUE;
-                                            }
-
-                                            if (need_card_p && !found_card_p)
-                                            {
-                                                dprintf (1, ("Card not set, curr_object = [%Ix:%Ix, %Ix:%Ix[",
-                                                            card_of (curr_object), (size_t)curr_object,
-                                                            card_of (curr_object+Align(s, align_const)), 
-                                                            (size_t)(curr_object+Align(s, align_const))));
-                                                FATAL_GC_ERROR();
-                                            }
-                                        }
-                                            );
-                                }
-                                if (need_card_p && !found_card_p)
-                                {
-                                    dprintf (1, ("Card not set, curr_object = [%Ix:%Ix, %Ix:%Ix[",
-                                        card_of (curr_object), (size_t)curr_object,
-                                        card_of (curr_object + Align(s, align_const)),
-                                        (size_t)(curr_object + Align(s, align_const))));
-                                    FATAL_GC_ERROR();
-                                }
-                            }
-                        }
-                        total_objects_verified_deep++;
-                    }
-                }
-
-                prev_object = curr_object;
-                prev_brick = curr_brick;
-                curr_object = curr_object + Align(s, align_const);
-                if (curr_object < prev_object)
-                {
-                    dprintf (1, ("overflow because of a bad object size: %Ix size %Ix", prev_object, s));
-                    FATAL_GC_ERROR();
-                }
-            }
-
-            if (curr_object > heap_segment_allocated(seg))
-            {
-                dprintf (1, ("Verifiying Heap: curr_object: %Ix > heap_segment_allocated (seg: %Ix) %Ix",
-                        (size_t)curr_object, (size_t)seg, heap_segment_allocated (seg)));
-                FATAL_GC_ERROR();
-            }
-
-            seg = heap_segment_next_in_range (seg);
-        }
+        gc_heap* hp = g_heaps[(heap_number + i) % n_heaps];
+        hp->verify_heap_segments (heap_verify_level, &total_objects_verified, &total_objects_verified_deep);
     }
+#else
+    verify_heap_segments (heap_verify_level, &total_objects_verified, &total_objects_verified_deep);
+#endif //MULTIPLE_HEAPS
 
 #ifdef BACKGROUND_GC
     dprintf (2, ("(%s)(%s)(%s) total_objects_verified is %Id, total_objects_verified_deep is %Id",
@@ -40294,6 +41151,9 @@ HRESULT GCHeap::Initialize()
 
 #endif //HOST_64BIT
 
+    // with GCLargePages everything is on large pages already
+    gc_heap::prefer_large_pages_p = !gc_heap::use_large_pages_p && GCConfig::GetGCHugePages();
+
     uint32_t nhp = 1;
     uint32_t nhp_from_config = 0;
 
@@ -40509,6 +41369,8 @@ HRESULT GCHeap::Initialize()
 
     gc_heap::m_high_memory_load_th = min ((gc_heap::high_memory_load_th + 5), gc_heap::v_high_memory_load_th);
 
+    gc_heap::memory_stall_th = (uint32_t)min ((int64_t)100, GCConfig::GetGCMemStallPercent()) * 100;
+
     gc_heap::pm_stress_on = (GCConfig::GetGCProvModeStress() != 0);
 
 #if defined(HOST_64BIT)
@@ -41553,6 +42415,68 @@ GCHeap::GarbageCollectTry (int generation, BOOL low_memory_p, int mode)
     return GarbageCollectGeneration (gen, reason);
 }
 
+// A simple AIMD style controller for GCPauseTargetMs. Ephemeral pauses are dominated
+// by how much survives and that is roughly proportional to how much we let the
+// generation allocate, so we steer the budget of the generation that was condemned:
+//
+// If a pause went over the target we cut that generation's budget factor in proportion
+// to how far over we were (but by at most half per GC so a single outlier doesn't
+// collapse the budget). If we were comfortably under we grow it back by a fixed step.
+// Since we react to every individual pause instead of an average, the high percentiles
+// are what's being controlled.
+//
+// The resulting budget is still clamped by the generation's min budget so we never
+// end up doing GCs back to back.
+void gc_heap::update_pause_target_control (int gen_number, size_t pause_duration)
+{
+    assert (gen_number < max_generation);
+
+    const float min_factor = 0.05f;
+    const float max_decrease = 0.5f;
+    const float increase_step = 0.05f;
+    // we only grow the budget back when we are below this fraction of the target,
+    // otherwise we'd oscillate around it.
+    const float headroom = 0.75f;
+
+    float& factor = pause_target_budget_factor[gen_number];
+    float old_factor = factor;
+
+    if (pause_duration > pause_target_us)
+    {
+        float ratio = max (max_decrease, (float)pause_target_us / (float)pause_duration);
+        factor = max (min_factor, factor * ratio);
+    }
+    else if ((float)pause_duration < ((float)pause_target_us * headroom))
+    {
+        factor = min (1.0f, factor + increase_step);
+    }
+
+    dprintf (GTC_LOG, ("gen%d pause %Idus, target %Idus, budget factor %d%% -> %d%%",
+        gen_number, pause_duration, pause_target_us,
+        (int)(old_factor * 100), (int)(factor * 100)));
+
+    if (EVENT_ENABLED(GCPauseTargetControl))
+    {
+        FIRE_EVENT(GCPauseTargetControl, (uint32_t)gen_number, (uint64_t)pause_duration,
+                   (uint64_t)pause_target_us, (uint32_t)(factor * 100));
+    }
+}
+
+size_t gc_heap::apply_pause_target_budget (int gen_number, size_t new_allocation, size_t min_gc_size)
+{
+    assert (gen_number < max_generation);
+
+    float factor = pause_target_budget_factor[gen_number];
+    if (factor < 1.0f)
+    {
+        size_t scaled_allocation = max ((size_t)((float)new_allocation * factor), min_gc_size);
+        dprintf (2, ("pause target: gen%d budget %Id -> %Id", gen_number, new_allocation, scaled_allocation));
+        new_allocation = min (new_allocation, scaled_allocation);
+    }
+
+    return new_allocation;
+}
+
 #ifdef BACKGROUND_GC
 void gc_heap::add_bgc_pause_duration_0()
 {
@@ -42070,6 +42994,11 @@ void gc_heap::do_post_gc()
         last_gc_info->pause_durations[0] = pause_duration;
         total_suspended_time += pause_duration;
         last_gc_info->pause_durations[1] = 0;
+
+        if (pause_target_us && (settings.condemned_generation < max_generation))
+        {
+            update_pause_target_control (settings.condemned_generation, pause_duration);
+        }
     }
 
     uint64_t total_process_time = end_gc_time - process_start_time;
@@ -42087,6 +43016,14 @@ void gc_heap::do_post_gc()
     last_gc_info->compaction = settings.compaction;
     last_gc_info->concurrent = settings.concurrent;
 
+    if (GCEventSummary::IsEnabled())
+    {
+        GCEventSummary::RecordGC (end_gc_time, settings.condemned_generation, !!settings.concurrent,
+            (uint64_t)(last_gc_info->pause_durations[0] + last_gc_info->pause_durations[1]),
+            last_gc_info->promoted, last_gc_info->fragmentation,
+            (settings.concurrent ? (uint64_t)dd_gc_elapsed_time (hp->dynamic_data_of (max_generation)) : 0));
+    }
+
 #ifdef BACKGROUND_GC
     is_last_recorded_bgc = settings.concurrent;
 #endif //BACKGROUND_GC
@@ -42973,6 +43910,22 @@ Object* GCHeap::GetNextFinalizableObject()
 
 }
 
+size_t GCHeap::GetNextFinalizableBatch(Object** objects, size_t count)
+{
+#ifdef MULTIPLE_HEAPS
+    size_t cnt = 0;
+    for (int hn = 0; (hn < gc_heap::n_heaps) && (cnt < count); hn++)
+    {
+        gc_heap* hp = gc_heap::g_heaps [hn];
+        cnt += hp->finalize_queue->GetNextFinalizableObjects (&objects[cnt], count - cnt);
+    }
+    return cnt;
+
+#else //MULTIPLE_HEAPS
+    return pGenGCHeap->finalize_queue->GetNextFinalizableObjects (objects, count);
+#endif //MULTIPLE_HEAPS
+}
+
 size_t GCHeap::GetNumberFinalizableObjects()
 {
 #ifdef MULTIPLE_HEAPS
@@ -43216,6 +44169,25 @@ CFinalize::GetNextFinalizableObject (BOOL only_non_critical)
     return obj;
 }
 
+// Takes up to count objects off the end of the queue like GetNextFinalizableObject (TRUE)
+// does, but under one acquisition of the finalize lock. Objects with a critical finalizer
+// are never returned.
+size_t
+CFinalize::GetNextFinalizableObjects (Object** objects, size_t count)
+{
+    EnterFinalizeLock();
+
+    size_t cnt = min (count, (size_t)(SegQueueLimit (FinalizerListSeg) - SegQueue (FinalizerListSeg)));
+    for (size_t i = 0; i < cnt; i++)
+    {
+        objects[i] = *(--SegQueueLimit (FinalizerListSeg));
+        dprintf (3, ("running finalizer for %Ix (mt: %Ix)", objects[i], method_table (objects[i])));
+    }
+
+    LeaveFinalizeLock();
+    return cnt;
+}
+
 size_t
 CFinalize::GetNumberFinalizableObjects()
 {
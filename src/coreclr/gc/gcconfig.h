@@ -77,8 +77,12 @@ public:
     BOOL_CONFIG  (GCNumaAware,            "GCNumaAware",            NULL,                             true,              "Enables numa allocations in the GC")                                                     \
     BOOL_CONFIG  (GCCpuGroup,             "GCCpuGroup",             "System.GC.CpuGroup",             false,             "Enables CPU groups in the GC")                                                           \
     BOOL_CONFIG  (GCLargePages,           "GCLargePages",           "System.GC.LargePages",           false,             "Enables using Large Pages in the GC")                                                    \
+    BOOL_CONFIG  (GCHugePages,            "GCHugePages",            NULL,                             false,             "Asks for gen0, the card table and the mark array to use huge pages when the OS has them")\
+    BOOL_CONFIG  (GCLayoutStats,          "GCLayoutStats",          NULL,                             false,             "Collects per type object layout stats while marking and fires them as events")           \
     INT_CONFIG   (HeapVerifyLevel,        "HeapVerify",             NULL,                             HEAPVERIFY_NONE,   "When set verifies the integrity of the managed heap on entry and exit of each GC")       \
+    INT_CONFIG   (HeapVerifySample,       "HeapVerifySample",       NULL,                             0,                 "Specifies the percentage of bricks whose objects heap verification checks, 0 means all") \
     INT_CONFIG   (LOHCompactionMode,      "GCLOHCompact",           NULL,                             0,                 "Specifies the LOH compaction mode")                                                      \
+    INT_CONFIG   (LOHCompactFragPercent,  "GCLOHCompactFragPercent", NULL,                            0,                 "Specifies the LOH fragmentation percentage at which a blocking gen2 also compacts LOH")  \
     INT_CONFIG   (LOHThreshold,           "GCLOHThreshold",         NULL,                             LARGE_OBJECT_SIZE, "Specifies the size that will make objects go on LOH")                                    \
     INT_CONFIG   (BGCSpinCount,           "BGCSpinCount",           NULL,                             140,               "Specifies the bgc spin count")                                                           \
     INT_CONFIG   (BGCSpin,                "BGCSpin",                NULL,                             2,                 "Specifies the bgc spin time")                                                            \
@@ -96,8 +100,13 @@ public:
                                                                                                                          "list of processor numbers or ranges of processor numbers. On Windows, each entry is "    \
                                                                                                                          "prefixed by the CPU group number. Example: Unix - 1,3,5,7-9,12, Windows - 0:1,1:7-9")    \
     INT_CONFIG   (GCHighMemPercent,       "GCHighMemPercent",       "System.GC.HighMemoryPercent",    0,                 "The percent for GC to consider as high memory")                                          \
+    INT_CONFIG   (GCMemStallPercent,      "GCMemStallPercent",      NULL,                             10,                "Specifies the memory stall (PSI) percent to treat as high memory load, 0 disables")      \
     INT_CONFIG   (GCProvModeStress,       "GCProvModeStress",       NULL,                             0,                 "Stress the provisional modes")                                                           \
     INT_CONFIG   (GCGen0MaxBudget,        "GCGen0MaxBudget",        NULL,                             0,                 "Specifies the largest gen0 allocation budget")                                           \
+    INT_CONFIG   (GCAllocSampleBytes,     "GCAllocSampleBytes",     NULL,                             0,                 "Specifies the mean bytes between sampled allocation tick events, 0 means every 100KB")   \
+    INT_CONFIG   (GCPauseTargetMs,        "GCPauseTargetMs",        NULL,                             0,                 "Specifies the pause target in ms for ephemeral GCs, 0 means no target")                  \
+    INT_CONFIG   (GCEventSummaryInterval, "GCEventSummaryInterval", NULL,                             0,                 "Specifies the seconds between GCIntervalSummary events, 0 means per GC history events")  \
+    INT_CONFIG   (GCDecommitSizePerMs,    "GCDecommitSizePerMs",    NULL,                             0,                 "Specifies the most the GC decommits per ms of elapsed time, 0 means the default")        \
     INT_CONFIG   (GCLowSkipRatio,         "GCLowSkipRatio",         NULL,                             30,                "Specifies the low generation skip ratio")                                                \
     INT_CONFIG   (GCHeapHardLimit,        "GCHeapHardLimit",        "System.GC.HeapHardLimit",        0,                 "Specifies a hard limit for the GC heap")                                                 \
     INT_CONFIG   (GCHeapHardLimitPercent, "GCHeapHardLimitPercent", "System.GC.HeapHardLimitPercent", 0,                 "Specifies the GC heap usage as a percentage of the total memory")                        \
@@ -131,7 +140,7 @@ public:
     INT_CONFIG   (GCHeapHardLimitSOHPercent, "GCHeapHardLimitSOHPercent", "System.GC.HeapHardLimitSOHPercent", 0,        "Specifies the GC heap SOH usage as a percentage of the total memory")                    \
     INT_CONFIG   (GCHeapHardLimitLOHPercent, "GCHeapHardLimitLOHPercent", "System.GC.HeapHardLimitLOHPercent", 0,        "Specifies the GC heap LOH usage as a percentage of the total memory")                    \
     INT_CONFIG   (GCHeapHardLimitPOHPercent, "GCHeapHardLimitPOHPercent", "System.GC.HeapHardLimitPOHPercent", 0,        "Specifies the GC heap POH usage as a percentage of the total memory")                    \
-    INT_CONFIG   (GCEnabledInstructionSets,  "GCEnabledInstructionSets",  NULL,                                -1,       "Specifies whether GC can use AVX2 or AVX512F - 0 for neither, 1 for AVX2, 3 for AVX512F")\
+    INT_CONFIG   (GCEnabledInstructionSets,  "GCEnabledInstructionSets",  NULL,                                -1,       "Specifies whether GC can use AVX2, AVX512F or AdvSIMD - 0 for none, 1 for AVX2, 3 for AVX512F, 4 for AdvSIMD")\
 
 // This class is responsible for retreiving configuration information
 // for how the GC should operate.
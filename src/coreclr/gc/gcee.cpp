@@ -350,6 +350,49 @@ void gc_heap::fire_etw_pin_object_event (uint8_t* object, uint8_t** ppObject)
 {
     FIRE_EVENT(PinObjectAtGCTime, object, ppObject);
 }
+
+// Fires what this heap collected for GCLayoutStats during this mark phase and
+// starts over, so each event describes the objects one GC found live.
+void gc_heap::fire_layout_stats_events()
+{
+    if (!layout_stats_table)
+    {
+        return;
+    }
+
+    if (EVENT_ENABLED(GCObjectLayoutStats))
+    {
+        for (int i = 0; i < LAYOUT_STATS_TABLE_SIZE; i++)
+        {
+            layout_stats_entry* entry = &layout_stats_table[i];
+            if (entry->mt != 0)
+            {
+                FIRE_EVENT(GCObjectLayoutStats, (uint32_t)heap_number,
+                           (uint64_t)(size_t)entry->mt,
+                           entry->count,
+                           entry->total_size,
+                           entry->total_ref_slots,
+                           entry->ref_bitmap);
+            }
+        }
+    }
+
+    if (EVENT_ENABLED(GCObjectSizeHistogram))
+    {
+        for (int i = 0; i < LAYOUT_STATS_SIZE_BUCKETS; i++)
+        {
+            if (layout_stats_size_histogram[i] != 0)
+            {
+                FIRE_EVENT(GCObjectSizeHistogram, (uint32_t)heap_number, (uint32_t)i, layout_stats_size_histogram[i],
+                           layout_stats_dropped_count);
+            }
+        }
+    }
+
+    memset (layout_stats_table, 0, sizeof (layout_stats_entry) * LAYOUT_STATS_TABLE_SIZE);
+    memset (layout_stats_size_histogram, 0, sizeof (layout_stats_size_histogram));
+    layout_stats_dropped_count = 0;
+}
 #endif // FEATURE_EVENT_TRACE
 
 uint32_t gc_heap::user_thread_wait (GCEvent *event, BOOL no_mode_change, int time_out_ms)
@@ -493,6 +536,21 @@ void GCHeap::UnregisterFrozenSegment(segment_handle seg)
 #endif // FEATURE_BASICFREEZE
 }
 
+void GCHeap::UpdateFrozenSegment(segment_handle seg, uint8_t* allocated, uint8_t* committed)
+{
+#ifdef FEATURE_BASICFREEZE
+#ifdef MULTIPLE_HEAPS
+    gc_heap* heap = gc_heap::g_heaps[0];
+#else
+    gc_heap* heap = pGenGCHeap;
+#endif //MULTIPLE_HEAPS
+
+    heap->update_ro_segment(reinterpret_cast<heap_segment*>(seg), allocated, committed);
+#else
+    assert(!"Should not call GCHeap::UpdateFrozenSegment without FEATURE_BASICFREEZE defined!");
+#endif // FEATURE_BASICFREEZE
+}
+
 bool GCHeap::IsInFrozenSegment(Object *object)
 {
 #ifdef FEATURE_BASICFREEZE
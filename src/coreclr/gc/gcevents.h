@@ -46,5 +46,31 @@ KNOWN_EVENT(PrvSetGCHandle, GCEventProvider_Private, GCEventLevel_Information, G
 KNOWN_EVENT(PrvDestroyGCHandle, GCEventProvider_Private, GCEventLevel_Information, GCEventKeyword_GCHandlePrivate)
 KNOWN_EVENT(PinPlugAtGCTime, GCEventProvider_Private, GCEventLevel_Verbose, GCEventKeyword_GCPrivate)
 
+// HeapNum, StolenCount, FailedStealCount, IdleTimeUs, StolenMarkTimeUs
+DYNAMIC_EVENT(GCMarkSteal, GCEventLevel_Information, GCEventKeyword_GC, uint32_t, uint32_t, uint32_t, uint64_t, uint64_t)
+
+// Generation, PauseUs, PauseTargetUs, BudgetFactorPercent
+DYNAMIC_EVENT(GCPauseTargetControl, GCEventLevel_Information, GCEventKeyword_GC, uint32_t, uint64_t, uint64_t, uint32_t)
+
+// HeapNum, MethodTable, ObjectCount, TotalSize, TotalRefSlots, RefBitmap
+DYNAMIC_EVENT(GCObjectLayoutStats, GCEventLevel_Verbose, GCEventKeyword_GC, uint32_t, uint64_t, uint64_t, uint64_t, uint64_t, uint32_t)
+
+// HeapNum, SizeBucket (highest set bit of the size), ObjectCount, DroppedCount
+DYNAMIC_EVENT(GCObjectSizeHistogram, GCEventLevel_Verbose, GCEventKeyword_GC, uint32_t, uint32_t, uint64_t, uint64_t)
+
+// HeapNum, Phase (0 = dependent handle promotion, 1 = short weak nulling, 2 = long weak nulling), DurationUs
+DYNAMIC_EVENT(GCHandleScanPhase, GCEventLevel_Information, GCEventKeyword_GC, uint32_t, uint32_t, uint64_t)
+
+// StallSome, StallFull (hundredths of a percent), HighLimit, MemoryLoad, PressureMemoryLoad
+DYNAMIC_EVENT(GCMemoryPressure, GCEventLevel_Information, GCEventKeyword_GC, uint32_t, uint32_t, uint64_t, uint32_t, uint32_t)
+
+// IntervalMs, GCCount, Gen0Count, Gen1Count, Gen2Count, BGCCount, TotalPauseUs, MaxPauseUs,
+// PauseCounts (8 buckets, pauses under 0.1, 0.5, 1, 5, 10, 50, 100ms and the rest),
+// PromotedBytes, MaxFragmentationBytes, TotalBGCDurationUs, MaxBGCDurationUs
+DYNAMIC_EVENT(GCIntervalSummary, GCEventLevel_Information, GCEventKeyword_GC,
+              uint32_t, uint32_t, uint32_t, uint32_t, uint32_t, uint32_t, uint64_t, uint64_t,
+              uint32_t, uint32_t, uint32_t, uint32_t, uint32_t, uint32_t, uint32_t, uint32_t,
+              uint64_t, uint64_t, uint64_t, uint64_t)
+
 #undef KNOWN_EVENT
 #undef DYNAMIC_EVENT
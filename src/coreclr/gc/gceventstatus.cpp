@@ -6,3 +6,93 @@
 
 Volatile<GCEventLevel> GCEventStatus::enabledLevels[2] = {GCEventLevel_None, GCEventLevel_None};
 Volatile<GCEventKeyword> GCEventStatus::enabledKeywords[2] = {GCEventKeyword_None, GCEventKeyword_None};
+
+const uint64_t GCEventSummary::pauseBucketLimits[GCEventSummary::PauseBucketCount - 1] =
+    {100, 500, 1000, 5000, 10000, 50000, 100000};
+
+uint64_t GCEventSummary::intervalUs = 0;
+uint64_t GCEventSummary::intervalStart = 0;
+int32_t GCEventSummary::lock = 0;
+uint32_t GCEventSummary::gcCount = 0;
+uint32_t GCEventSummary::genCounts[3] = {0, 0, 0};
+uint32_t GCEventSummary::bgcCount = 0;
+uint64_t GCEventSummary::totalPauseUs = 0;
+uint64_t GCEventSummary::maxPauseUs = 0;
+uint32_t GCEventSummary::pauseCounts[GCEventSummary::PauseBucketCount] = {};
+uint64_t GCEventSummary::promotedBytes = 0;
+uint64_t GCEventSummary::maxFragmentationBytes = 0;
+uint64_t GCEventSummary::totalBGCDurationUs = 0;
+uint64_t GCEventSummary::maxBGCDurationUs = 0;
+
+void GCEventSummary::Initialize(uint64_t intervalSeconds, uint64_t now)
+{
+    intervalUs = intervalSeconds * 1000 * 1000;
+    Reset(now);
+}
+
+void GCEventSummary::Reset(uint64_t now)
+{
+    intervalStart = now;
+    gcCount = 0;
+    memset(genCounts, 0, sizeof(genCounts));
+    bgcCount = 0;
+    totalPauseUs = 0;
+    maxPauseUs = 0;
+    memset(pauseCounts, 0, sizeof(pauseCounts));
+    promotedBytes = 0;
+    maxFragmentationBytes = 0;
+    totalBGCDurationUs = 0;
+    maxBGCDurationUs = 0;
+}
+
+void GCEventSummary::RecordGC(uint64_t now, int condemnedGeneration, bool concurrent, uint64_t pauseUs,
+                              uint64_t promoted, uint64_t fragmentation, uint64_t bgcDurationUs)
+{
+    assert(IsEnabled());
+    assert(condemnedGeneration >= 0 && condemnedGeneration < 3);
+
+    while (Interlocked::CompareExchange(&lock, 1, 0) != 0)
+    {
+        GCToOSInterface::YieldThread(0);
+    }
+
+    gcCount++;
+    genCounts[condemnedGeneration]++;
+    totalPauseUs += pauseUs;
+    maxPauseUs = max(maxPauseUs, pauseUs);
+
+    int bucket = 0;
+    while ((bucket < PauseBucketCount - 1) && (pauseUs >= pauseBucketLimits[bucket]))
+    {
+        bucket++;
+    }
+    pauseCounts[bucket]++;
+
+    promotedBytes += promoted;
+    maxFragmentationBytes = max(maxFragmentationBytes, fragmentation);
+
+    if (concurrent)
+    {
+        bgcCount++;
+        totalBGCDurationUs += bgcDurationUs;
+        maxBGCDurationUs = max(maxBGCDurationUs, bgcDurationUs);
+    }
+
+    if ((now - intervalStart) >= intervalUs)
+    {
+        if (EVENT_ENABLED(GCIntervalSummary))
+        {
+            FIRE_EVENT(GCIntervalSummary,
+                       (uint32_t)min((uint64_t)UINT32_MAX, (now - intervalStart) / 1000),
+                       gcCount, genCounts[0], genCounts[1], genCounts[2], bgcCount,
+                       totalPauseUs, maxPauseUs,
+                       pauseCounts[0], pauseCounts[1], pauseCounts[2], pauseCounts[3],
+                       pauseCounts[4], pauseCounts[5], pauseCounts[6], pauseCounts[7],
+                       promotedBytes, maxFragmentationBytes, totalBGCDurationUs, maxBGCDurationUs);
+        }
+
+        Reset(now);
+    }
+
+    Interlocked::Exchange(&lock, 0);
+}
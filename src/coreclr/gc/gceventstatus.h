@@ -197,6 +197,74 @@ private:
     GCEventStatus() = delete;
 };
 
+/*
+ * GCEventSummary aggregates pauses, promoted bytes, fragmentation and BGC
+ * durations over an interval and fires them as a single GCIntervalSummary
+ * event. This is meant for continuous monitoring, where the per GC history
+ * events are too large to collect all the time.
+ *
+ * The summary is enabled with GCEventSummaryInterval. While it is enabled the
+ * GCGlobalHeapHistory and GCPerHeapHistory events are not fired. The summary
+ * for an interval is fired by the first GC that ends after the interval has
+ * elapsed, so nothing is fired while no GCs happen.
+ */
+class GCEventSummary
+{
+public:
+    static const int PauseBucketCount = 8;
+
+private:
+    /*
+     * The upper bounds of the first PauseBucketCount - 1 pause buckets, in us,
+     * the last bucket has all the longer pauses.
+     */
+    static const uint64_t pauseBucketLimits[PauseBucketCount - 1];
+
+    static uint64_t intervalUs;
+    static uint64_t intervalStart;
+
+    /*
+     * A blocking GC can end while a BGC is ending on the BGC thread.
+     */
+    static int32_t lock;
+
+    static uint32_t gcCount;
+    static uint32_t genCounts[3];
+    static uint32_t bgcCount;
+    static uint64_t totalPauseUs;
+    static uint64_t maxPauseUs;
+    static uint32_t pauseCounts[PauseBucketCount];
+    static uint64_t promotedBytes;
+    static uint64_t maxFragmentationBytes;
+    static uint64_t totalBGCDurationUs;
+    static uint64_t maxBGCDurationUs;
+
+public:
+    /*
+     * Initialize enables the summary, intervalSeconds of 0 leaves it disabled.
+     */
+    static void Initialize(uint64_t intervalSeconds, uint64_t now);
+
+    static inline bool IsEnabled()
+    {
+        return intervalUs != 0;
+    }
+
+    /*
+     * RecordGC adds a GC that just ended to the current interval, and fires
+     * the summary when the interval has elapsed. bgcDurationUs is only used
+     * for background GCs. All times are in us.
+     */
+    static void RecordGC(uint64_t now, int condemnedGeneration, bool concurrent, uint64_t pauseUs,
+                         uint64_t promoted, uint64_t fragmentation, uint64_t bgcDurationUs);
+
+private:
+    static void Reset(uint64_t now);
+
+    // This class is a singleton and can't be instantiated.
+    GCEventSummary() = delete;
+};
+
 /*
  * FireDynamicEvent is a variadic function that fires a dynamic event with the
  * given name and event payload. This function serializes the arguments into
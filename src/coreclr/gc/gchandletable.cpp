@@ -176,3 +176,20 @@ void GCHandleManager::TraceRefCountedHandles(HANDLESCANPROC callback, uintptr_t
     ::Ref_TraceRefCountHandles(callback, param1, param2);
 }
 
+void GCHandleManager::DestroyHandlesOfType(const OBJECTHANDLE* handles, uint32_t count, HandleType type)
+{
+    // handles from different tables can be mixed in one batch; free each run
+    // of handles that share a table with a single call
+    uint32_t start = 0;
+    while (start < count)
+    {
+        HHANDLETABLE table = ::HndGetHandleTable(handles[start]);
+        uint32_t end = start + 1;
+        while ((end < count) && (::HndGetHandleTable(handles[end]) == table))
+            end++;
+
+        ::HndDestroyHandles(table, type, handles + start, end - start);
+        start = end;
+    }
+}
+
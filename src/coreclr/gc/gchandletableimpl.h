@@ -67,6 +67,8 @@ public:
     virtual HandleType HandleFetchType(OBJECTHANDLE handle);
 
     virtual void TraceRefCountedHandles(HANDLESCANPROC callback, uintptr_t param1, uintptr_t param2);
+
+    virtual void DestroyHandlesOfType(const OBJECTHANDLE* handles, uint32_t count, HandleType type);
 };
 
 #endif  // GCHANDLETABLE_H_
@@ -11,7 +11,7 @@
 // The minor version of the GC/EE interface. Non-breaking changes are required
 // to bump the minor version number. GCs and EEs with minor version number
 // mismatches can still interopate correctly, with some care.
-#define GC_INTERFACE_MINOR_VERSION 1
+#define GC_INTERFACE_MINOR_VERSION 5
 
 struct ScanContext;
 struct gc_alloc_context;
@@ -108,6 +108,16 @@ struct WriteBarrierParameters
     // The new write watch table, if we are using our own write watch
     // implementation. Used for WriteBarrierOp::SwitchToWriteWatch only.
     uint8_t* write_watch_table;
+
+    // The generation of each region, indexed by (address >> region_shr). Only
+    // set by a GC that uses regions, null otherwise. The table does not move for
+    // the lifetime of the GC. Used for WriteBarrierOp::Initialize only. Added in
+    // minor version 4, the EE must not read this or region_shr from a GC that
+    // reports an older minor version.
+    uint8_t* region_to_generation_table;
+
+    // The log2 of the region size. Only valid if region_to_generation_table is set.
+    uint8_t region_shr;
 };
 
 // Opaque type for tracking object pointers
@@ -141,6 +151,11 @@ struct gc_alloc_context
     void*          gc_reserved_1;
     void*          gc_reserved_2;
     int            alloc_count;
+    // Used by the GC to size this context's allocation quantum from its recent refill rate:
+    // the low bits of the GC index of the last refill, and the decayed number of refills.
+    // They fit in what used to be tail padding on 64 bit targets.
+    uint16_t       alloc_quantum_gc;
+    uint16_t       alloc_quantum_refills;
 public:
 
     void init()
@@ -154,6 +169,8 @@ public:
         gc_reserved_1 = 0;
         gc_reserved_2 = 0;
         alloc_count = 0;
+        alloc_quantum_gc = 0;
+        alloc_quantum_refills = 0;
     }
 };
 
@@ -517,6 +534,9 @@ public:
     virtual HandleType HandleFetchType(OBJECTHANDLE handle) = 0;
 
     virtual void TraceRefCountedHandles(HANDLESCANPROC callback, uintptr_t param1, uintptr_t param2) = 0;
+
+    // Frees a batch of handles of the same type. Added in minor version 2.
+    virtual void DestroyHandlesOfType(const OBJECTHANDLE* handles, uint32_t count, HandleType type) = 0;
 };
 
 // IGCHeap is the interface that the VM will use when interacting with the GC.
@@ -904,6 +924,15 @@ public:
 
     IGCHeap() {}
     virtual ~IGCHeap() {}
+
+    // Moves the allocated and committed limits of a frozen segment that is still being filled.
+    // Only valid if FEATURE_BASICFREEZE is defined. Added in minor version 3.
+    virtual void UpdateFrozenSegment(segment_handle seg, uint8_t* allocated, uint8_t* committed) = 0;
+
+    // Gets up to count finalizable objects without a critical finalizer and returns how many
+    // were stored in objects. Requests made by several threads at once get disjoint objects.
+    // Added in minor version 5.
+    virtual size_t GetNextFinalizableBatch(Object** objects, size_t count) = 0;
 };
 
 #ifdef WRITE_BARRIER_CHECK
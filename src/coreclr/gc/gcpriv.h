@@ -438,6 +438,14 @@ enum gc_oh_num
 
 gc_oh_num gen_to_oh (int gen);
 
+// handle scan phases reported by the GCHandleScanPhase event
+enum handle_scan_phase
+{
+    handle_scan_dependent_promotion = 0,
+    handle_scan_short_weak = 1,
+    handle_scan_long_weak = 2
+};
+
 #if defined(TRACE_GC) && defined(BACKGROUND_GC)
 static const char * const str_bgc_state[] =
 {
@@ -1096,6 +1104,48 @@ struct snoop_stats_data
 };
 #endif //SNOOP_STATS
 
+#ifdef MH_SC_MARK
+// Unlike snoop_stats_data this is always collected - it's cheap enough and it's
+// what tells us whether mark_steal actually evened out a skewed object graph.
+// It's reset at the start of each mark_steal and fired with the GCMarkSteal event.
+struct mark_steal_stats
+{
+    // number of objects (or partial mark chunks) this heap stole from other heaps.
+    uint32_t stolen_count;
+    // number of times we lost the interlocked race for an entry to its owner or
+    // another thief.
+    uint32_t failed_steal_count;
+    // time in mark_steal not spent marking stolen objects, in microseconds.
+    uint64_t idle_time;
+    // time spent marking stolen objects, in microseconds.
+    uint64_t stolen_mark_time;
+};
+#endif //MH_SC_MARK
+
+#ifdef FEATURE_EVENT_TRACE
+// With GCLayoutStats each heap keeps one of these per MethodTable it marks, in a
+// small open addressed table that's fired as GCObjectLayoutStats events and cleared
+// at the end of each mark phase. The ref slots are the static layout, not how many
+// of them were non null, which is what matters when deciding how to lay out a type.
+struct layout_stats_entry
+{
+    MethodTable* mt;
+    // bit i is set if the i-th pointer sized field is a reference; arrays and objects
+    // with references past the 32nd field have all bits set.
+    uint32_t ref_bitmap;
+    // ref slots per object, for types without components.
+    uint32_t fixed_ref_slots;
+    uint64_t count;
+    uint64_t total_size;
+    uint64_t total_ref_slots;
+};
+
+#define LAYOUT_STATS_TABLE_SIZE     2048
+#define LAYOUT_STATS_MAX_PROBES     8
+// object sizes are bucketed by their highest set bit
+#define LAYOUT_STATS_SIZE_BUCKETS   32
+#endif //FEATURE_EVENT_TRACE
+
 struct no_gc_region_info
 {
     size_t soh_allocation_size;
@@ -1110,6 +1160,25 @@ struct no_gc_region_info
     BOOL minimal_gc_p;
 };
 
+#if defined(USE_REGIONS) && defined(MULTIPLE_HEAPS)
+// Free basic regions shared by all the heaps on one NUMA node. The memory of these
+// regions was committed for a heap on this node so handing them to another heap on
+// the same node keeps allocation and mark node local.
+//
+// This is taken both by allocating threads and by GC threads during a GC so, like
+// region_allocator, it only spins and never waits for a GC to finish.
+struct numa_region_free_list
+{
+    GCSpinLock lock;
+    heap_segment* head;
+    int num_regions;
+    size_t committed;
+
+    void enter_spin_lock();
+    void leave_spin_lock();
+};
+#endif //USE_REGIONS && MULTIPLE_HEAPS
+
 // if you change these, make sure you update them for sos (strike.cpp) as well.
 //
 // !!!NOTE!!!
@@ -1225,6 +1294,13 @@ public:
     PER_HEAP_ISOLATED
     void leave_gc_lock_for_verify_heap();
     PER_HEAP
+    void verify_heap_segment (heap_segment* seg, int curr_gen_num, int heap_verify_level,
+                              size_t* objects_verified, size_t* objects_verified_deep);
+    PER_HEAP
+    void verify_heap_segments (int heap_verify_level, size_t* objects_verified, size_t* objects_verified_deep);
+    PER_HEAP_ISOLATED
+    BOOL verify_sampled_brick_p (size_t brick);
+    PER_HEAP
     void verify_heap (BOOL begin_gc_p);
     PER_HEAP
     BOOL check_need_card (uint8_t* child_obj, int gen_num_for_cards, 
@@ -1269,6 +1345,14 @@ public:
     void return_free_region (heap_segment* region);
     PER_HEAP
     heap_segment* get_free_region (int gen_number);
+#ifdef MULTIPLE_HEAPS
+    PER_HEAP
+    size_t free_regions_reserve();
+    PER_HEAP
+    bool return_free_region_to_numa_node (heap_segment* region);
+    PER_HEAP
+    heap_segment* get_free_region_from_numa_node();
+#endif //MULTIPLE_HEAPS
     PER_HEAP
     void clear_region_info (heap_segment* region);
     PER_HEAP_ISOLATED
@@ -1282,6 +1366,8 @@ public:
     PER_HEAP_ISOLATED
     void set_region_gen_num (heap_segment* region, int gen_num);
     PER_HEAP_ISOLATED
+    void update_region_generation_map (uint8_t* start, uint8_t* end, int gen_num);
+    PER_HEAP_ISOLATED
     int get_region_plan_gen_num (uint8_t* obj);
     PER_HEAP_ISOLATED
     int get_plan_gen_num (int gen_number);
@@ -1637,15 +1723,30 @@ protected:
     PER_HEAP_ISOLATED
     void handle_failure_for_no_gc();
 
+    PER_HEAP
+    size_t get_next_allocation_tick ();
+
     PER_HEAP
     void fire_etw_allocation_event (size_t allocation_amount, int gen_number, uint8_t* object_address);
 
     PER_HEAP
     void fire_etw_pin_object_event (uint8_t* object, uint8_t** ppObject);
 
+#ifdef FEATURE_EVENT_TRACE
+    PER_HEAP
+    void record_layout_stats (uint8_t* o, size_t s);
+
+    PER_HEAP
+    void fire_layout_stats_events();
+#endif //FEATURE_EVENT_TRACE
+
     PER_HEAP
     size_t limit_from_size (size_t size, uint32_t flags, size_t room, int gen_number,
-                            int align_const);
+                            alloc_context* acontext, int align_const);
+    PER_HEAP
+    size_t get_allocation_quantum (alloc_context* acontext);
+    PER_HEAP
+    void record_alloc_context_refill (alloc_context* acontext);
     PER_HEAP
     allocation_state try_allocate_more_space (alloc_context* acontext, size_t jsize, uint32_t flags,
                                               int alloc_generation_number);
@@ -1854,6 +1955,8 @@ protected:
     BOOL insert_ro_segment (heap_segment* seg);
     PER_HEAP
     void remove_ro_segment (heap_segment* seg);
+    PER_HEAP
+    void update_ro_segment (heap_segment* seg, uint8_t* allocated, uint8_t* committed);
 #endif //FEATURE_BASICFREEZE
     PER_HEAP
     BOOL set_ro_segment_in_range (heap_segment* seg);
@@ -1884,7 +1987,7 @@ protected:
     PER_HEAP
     void decommit_heap_segment_pages (heap_segment* seg, size_t extra_space);
     PER_HEAP
-    size_t decommit_ephemeral_segment_pages_step ();
+    size_t decommit_ephemeral_segment_pages_step (size_t& budget);
     PER_HEAP
     size_t decommit_heap_segment_pages_worker (heap_segment* seg, uint8_t *new_committed);
     PER_HEAP_ISOLATED
@@ -1892,6 +1995,8 @@ protected:
     PER_HEAP
     void decommit_heap_segment (heap_segment* seg);
     PER_HEAP_ISOLATED
+    void prefer_large_pages (uint8_t* address, size_t size);
+    PER_HEAP_ISOLATED
     bool virtual_alloc_commit_for_heap (void* addr, size_t size, int h_number);
     PER_HEAP_ISOLATED
     bool virtual_commit (void* address, size_t size, gc_oh_num oh, int h_number=-1, bool* hard_limit_exceeded_p=NULL);
@@ -2592,6 +2697,9 @@ protected:
     PER_HEAP
     void scan_dependent_handles (int condemned_gen_number, ScanContext *sc, BOOL initial_scan_p);
 
+    PER_HEAP
+    void fire_handle_scan_phase_event (handle_scan_phase phase, uint64_t start_us);
+
     PER_HEAP
     size_t get_generation_start_size (int gen_number);
 
@@ -3046,6 +3154,12 @@ protected:
     void get_memory_info (uint32_t* memory_load,
                           uint64_t* available_physical=NULL,
                           uint64_t* available_page_file=NULL);
+    PER_HEAP_ISOLATED
+    void refresh_memory_pressure();
+    PER_HEAP_ISOLATED
+    bool memory_pressure_signaled_p();
+    PER_HEAP
+    uint32_t get_memory_pressure_load (uint32_t memory_load, uint64_t available_physical);
     PER_HEAP
     size_t generation_size (int gen_number);
     PER_HEAP_ISOLATED
@@ -3425,6 +3539,13 @@ public:
     PER_HEAP
     size_t committed_in_free;
 
+#ifdef MULTIPLE_HEAPS
+    // Basic regions a heap doesn't need for its next gen0 budget are pooled per NUMA node
+    // instead of staying on that heap's free list.
+    PER_HEAP_ISOLATED
+    numa_region_free_list numa_free_regions[MAX_SUPPORTED_NODES];
+#endif //MULTIPLE_HEAPS
+
     PER_HEAP
     // After plan we calculate this as the planned end gen0 space;
     // but if we end up sweeping, we recalculate it at the end of
@@ -3577,6 +3698,18 @@ public:
     PER_HEAP
     size_t etw_allocation_running_amount[2];
 
+    // The running amount at which we fire the next allocation tick event. This is
+    // etw_allocation_tick unless GCAllocSampleBytes asks for sampled ticks.
+    PER_HEAP
+    size_t etw_allocation_next_tick[2];
+
+    PER_HEAP
+    uint64_t allocation_sample_rand;
+
+    // GCAllocSampleBytes, 0 if allocation ticks are not sampled.
+    PER_HEAP_ISOLATED
+    size_t allocation_sample_bytes;
+
     PER_HEAP
     uint64_t total_alloc_bytes_soh;
 
@@ -3628,6 +3761,10 @@ public:
     PER_HEAP_ISOLATED
     uint64_t gc_last_ephemeral_decommit_time;
 
+    // The most we decommit per millisecond of elapsed time, for the whole process.
+    PER_HEAP_ISOLATED
+    size_t decommit_size_per_ms;
+
 #ifdef SHORT_PLUGS
     PER_HEAP_ISOLATED
     double short_plugs_pad_ratio;
@@ -3707,6 +3844,24 @@ public:
     PER_HEAP_ISOLATED
     uint32_t v_high_memory_load_th;
 
+    // Memory pressure the OS reports on top of usage vs. the limit (cgroup v2
+    // memory.pressure and memory.high), refreshed at most every
+    // MEMORY_PRESSURE_REFRESH_MS. Stalls are in hundredths of a percent.
+    PER_HEAP_ISOLATED
+    uint32_t memory_stall_th;
+
+    PER_HEAP_ISOLATED
+    uint32_t memory_stall_some;
+
+    PER_HEAP_ISOLATED
+    uint32_t memory_stall_full;
+
+    PER_HEAP_ISOLATED
+    uint64_t memory_high_limit;
+
+    PER_HEAP_ISOLATED
+    uint64_t memory_pressure_refresh_time;
+
     PER_HEAP_ISOLATED
     bool is_restricted_physical_mem;
 
@@ -3798,11 +3953,32 @@ public:
     PER_HEAP_ISOLATED
     bool use_large_pages_p;
 
+    // This is if we ask the OS for large pages on the memory that benefits the most
+    // from fewer TLB misses, without committing it up front like use_large_pages_p.
+    PER_HEAP_ISOLATED
+    bool prefer_large_pages_p;
+
 #ifdef HEAP_BALANCE_INSTRUMENTATION
     PER_HEAP_ISOLATED
     size_t last_gc_end_time_us;
 #endif //HEAP_BALANCE_INSTRUMENTATION
 
+    // GCPauseTargetMs in us, 0 if we are not trying to meet a pause target.
+    PER_HEAP_ISOLATED
+    size_t pause_target_us;
+
+    // When we have a pause target we scale the gen0 and gen1 budgets by these factors.
+    // They shrink when a GC of that generation pauses longer than the target and grow
+    // back towards 1 when we have headroom.
+    PER_HEAP_ISOLATED
+    float pause_target_budget_factor[max_generation];
+
+    PER_HEAP_ISOLATED
+    void update_pause_target_control (int gen_number, size_t pause_duration);
+
+    PER_HEAP_ISOLATED
+    size_t apply_pause_target_budget (int gen_number, size_t new_allocation, size_t min_gc_size);
+
 #ifndef USE_REGIONS
     PER_HEAP_ISOLATED
     size_t min_segment_size;
@@ -3815,6 +3991,15 @@ public:
     PER_HEAP_ISOLATED
     size_t min_segment_size_shr;
 
+#ifdef USE_REGIONS
+    // One byte per basic region with the generation of the region it belongs to,
+    // skewed so it can be indexed with (address >> min_segment_size_shr). This is
+    // what lets the region write barrier skip stores that can't create a
+    // cross generation reference.
+    PER_HEAP_ISOLATED
+    uint8_t* map_region_to_generation_skewed;
+#endif //USE_REGIONS
+
     // For SOH we always allocate segments of the same
     // size unless no_gc_region requires larger ones.
     PER_HEAP_ISOLATED
@@ -3877,6 +4062,18 @@ protected:
     BOOL       verify_pinned_queue_p;
 #endif // _DEBUG && VERIFY_HEAP
 
+#ifdef VERIFY_HEAP
+#ifdef MULTIPLE_HEAPS
+    // The next of this heap's segments to be claimed by a verifying GC thread.
+    PER_HEAP
+    VOLATILE(int32_t) verify_seg_claim_index;
+#endif //MULTIPLE_HEAPS
+
+    // HeapVerifySample, 0 if we verify all objects.
+    PER_HEAP_ISOLATED
+    int        heap_verify_sample_percent;
+#endif //VERIFY_HEAP
+
     PER_HEAP
     uint8_t*    oldest_pinned_plug;
 
@@ -3907,6 +4104,11 @@ protected:
     PER_HEAP_ISOLATED
     gc_loh_compaction_mode loh_compaction_mode;
 
+    // If LOH fragmentation is at least this percentage of its size, a gen2 GC that is
+    // blocking anyway also compacts LOH. 0 means we never do this on our own.
+    PER_HEAP_ISOLATED
+    int         loh_compaction_frag_percent;
+
     // We may not compact LOH on every heap if we can't
     // grow the pinned queue. This is to indicate whether
     // this heap's LOH is compacted or not. So even if
@@ -4133,6 +4335,27 @@ protected:
     snoop_stats_data snoop_stat;
 #endif //SNOOP_STATS
 
+#ifdef MH_SC_MARK
+    PER_HEAP
+    mark_steal_stats steal_stats;
+#endif //MH_SC_MARK
+
+#ifdef FEATURE_EVENT_TRACE
+    // GCLayoutStats
+    PER_HEAP_ISOLATED
+    bool layout_stats_p;
+
+    PER_HEAP
+    layout_stats_entry* layout_stats_table;
+
+    PER_HEAP
+    uint64_t layout_stats_size_histogram[LAYOUT_STATS_SIZE_BUCKETS];
+
+    // objects of types we didn't have room for in the table.
+    PER_HEAP
+    uint64_t layout_stats_dropped_count;
+#endif //FEATURE_EVENT_TRACE
+
 
     PER_HEAP
     uint8_t**          c_mark_list;
@@ -4193,6 +4416,14 @@ protected:
     PER_HEAP
     size_t allocation_quantum;
 
+    // Largest quantum a context that refills often can grow to, see get_allocation_quantum.
+    PER_HEAP
+    size_t allocation_quantum_max;
+
+    // Number of times a gen0 allocation context was refilled on this heap since the last GC.
+    PER_HEAP
+    size_t alloc_context_refills;
+
     PER_HEAP
     size_t alloc_contexts_used;
 
@@ -4220,6 +4451,17 @@ protected:
 
     PER_HEAP_ISOLATED
     size_t max_decommit_step_size;
+
+    // Unspent decommit budget carried over from the previous step.
+    PER_HEAP_ISOLATED
+    size_t decommit_budget;
+
+    PER_HEAP_ISOLATED
+    uint64_t last_decommit_step_time;
+
+    // The heap the next decommit step starts with, so no heap is always last in line.
+    PER_HEAP_ISOLATED
+    int decommit_step_start_heap;
 #endif //MULTIPLE_HEAPS
 
 #define youngest_generation (generation_of (0))
@@ -4740,6 +4982,7 @@ public:
     void LeaveFinalizeLock();
     bool RegisterForFinalization (int gen, Object* obj, size_t size=0);
     Object* GetNextFinalizableObject (BOOL only_non_critical=FALSE);
+    size_t GetNextFinalizableObjects (Object** objects, size_t count);
     BOOL ScanForFinalization (promote_func* fn, int gen,BOOL mark_only_p, gc_heap* hp);
     void RelocateFinalizationData (int gen, gc_heap* hp);
     void WalkFReachableObjects (fq_walk_fn fn);
@@ -357,6 +357,9 @@ public:
 
     size_t extra_gen0_committed;
 
+    // Number of gen0 allocation context refills on this heap since the previous GC.
+    size_t alloc_context_refills;
+
     void set_mechanism (gc_mechanism_per_heap mechanism_per_heap, uint32_t value);
 
     void set_mechanism_bit (gc_mechanism_bit_per_heap mech_bit)
@@ -85,25 +85,27 @@ bool GCScan::GcDhUnpromotedHandlesExist(ScanContext* sc)
 // this method in a loop. The scan records state that let's us know when to terminate (no further handles to
 // be promoted or no promotions in the last scan). Returns true if at least one object was promoted as a
 // result of the scan.
-bool GCScan::GcDhReScan(ScanContext* sc)
+bool GCScan::GcDhReScan(ScanContext* sc, bool claim_tables)
 {
     // Locate our dependent handle context based on the GC context.
     DhContext *pDhContext = Ref_GetDependentHandleContext(sc);
 
-    return Ref_ScanDependentHandlesForPromotion(pDhContext);
+    return Ref_ScanDependentHandlesForPromotion(pDhContext, claim_tables);
 }
 
 /*
  * Scan for dead weak pointers
  */
 
-void GCScan::GcWeakPtrScan( promote_func* fn, int condemned, int max_gen, ScanContext* sc )
+void GCScan::GcWeakPtrScan( promote_func* fn, int condemned, int max_gen, ScanContext* sc, bool claim_tables )
 {
-    // Clear out weak pointers that are no longer live.
-    Ref_CheckReachable(condemned, max_gen, (uintptr_t)sc);
+    // Clear out weak pointers that are no longer live. When the tables are claimed this also clears the
+    // dependent handles in each table it claims.
+    Ref_CheckReachable(condemned, max_gen, (uintptr_t)sc, claim_tables);
 
     // Clear any secondary objects whose primary object is now definitely dead.
-    Ref_ScanDependentHandlesForClearing(condemned, max_gen, sc, fn);
+    if (!claim_tables)
+        Ref_ScanDependentHandlesForClearing(condemned, max_gen, sc, fn);
 }
 
 static void CALLBACK CheckPromoted(_UNCHECKED_OBJECTREF *pObjRef, uintptr_t * /*pExtraInfo*/, uintptr_t /*lp1*/, uintptr_t /*lp2*/)
@@ -138,10 +140,15 @@ void GCScan::GcScanSizedRefs(promote_func* fn, int condemned, int max_gen, ScanC
 }
 
 void GCScan::GcShortWeakPtrScan(promote_func* fn,  int condemned, int max_gen,
-                                     ScanContext* sc)
+                                     ScanContext* sc, bool claim_tables)
 {
     UNREFERENCED_PARAMETER(fn);
-    Ref_CheckAlive(condemned, max_gen, (uintptr_t)sc);
+    Ref_CheckAlive(condemned, max_gen, (uintptr_t)sc, claim_tables);
+}
+
+void GCScan::GcResetHandleTableClaims()
+{
+    Ref_ResetHandleTableClaims();
 }
 
 /*
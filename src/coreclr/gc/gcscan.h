@@ -53,12 +53,17 @@ class GCScan
     static void GcScanDependentHandlesForProfilerAndETW (int max_gen, ScanContext* sc, handle_scan_fn fn);
 
     // scan for dead weak pointers
-    static void GcWeakPtrScan (promote_func* fn, int condemned, int max_gen, ScanContext*sc );
+    static void GcWeakPtrScan (promote_func* fn, int condemned, int max_gen, ScanContext*sc, bool claim_tables = false);
     static void GcWeakPtrScanBySingleThread (int condemned, int max_gen, ScanContext*sc );
 
     // scan for dead weak pointers
     static void GcShortWeakPtrScan (promote_func* fn, int condemned, int max_gen,
-                                    ScanContext* sc);
+                                    ScanContext* sc, bool claim_tables = false);
+
+    // Under server GC, the scans above and GcDhReScan can split the handle tables dynamically between the
+    // GC threads rather than each thread scanning its own slot (claim_tables). Every GC thread must then
+    // take part, and the claims must have been reset by a single thread (inside a join) beforehand.
+    static void GcResetHandleTableClaims();
 
     //
     // Dependent handle promotion scan support
@@ -73,7 +78,7 @@ class GCScan
 
     // Rescan the handles for additonal primaries that have been promoted since the last scan. Return true if
     // any objects were promoted as a result.
-    static bool GcDhReScan(ScanContext* sc);
+    static bool GcDhReScan(ScanContext* sc, bool claim_tables = false);
 
     // post-promotions callback
     static void GcPromotionsGranted (int condemned, int max_gen,
@@ -159,6 +159,28 @@ HHANDLETABLE HndCreateHandleTable(const uint32_t *pTypeFlags, uint32_t uTypeCoun
         pTable->rgMainCache[u].lFreeIndex = HANDLES_PER_CACHE_BANK;
     }
 
+    // workstation GC funnels every processor through this one table, so give
+    // each processor its own row of the quick cache; server GC already hands
+    // out a table per heap.  the rows are only an optimization, so if we can't
+    // get them we just fall back to the shared quick cache.
+    uint32_t uCpuCount = GCToOSInterface::GetCurrentProcessCpuCount();
+    if (!IsServerHeap() && (uCpuCount > 1) && GCToOSInterface::CanGetCurrentProcessorNumber())
+    {
+        uint32_t uRowCount = 1;
+        while ((uRowCount < uCpuCount) && (uRowCount < HANDLE_MAX_QUICK_CACHE_ROWS))
+            uRowCount <<= 1;
+
+        uint32_t dwRowsSize = (uRowCount + 1) * sizeof(HandleQuickCacheRow);
+        uint8_t *pRowsAlloc = new (nothrow) uint8_t[dwRowsSize];
+        if (pRowsAlloc != NULL)
+        {
+            memset (pRowsAlloc, 0, dwRowsSize);
+            pTable->pQuickCacheRowsAlloc = pRowsAlloc;
+            pTable->pQuickCacheRows = (HandleQuickCacheRow *)ALIGN_UP(pRowsAlloc, HANDLE_QUICK_CACHE_ROW_SIZE);
+            pTable->uQuickCacheRowMask = uRowCount - 1;
+        }
+    }
+
 #ifdef _DEBUG
     // set up scanning stats
     pTable->_DEBUG_iMaxGen = -1;
@@ -209,6 +231,9 @@ void HndDestroyHandleTable(HHANDLETABLE hTable)
         pSegment = pNextSegment;
     }
 
+    // free the per-processor quick cache rows, if any
+    delete [] pTable->pQuickCacheRowsAlloc;
+
     // free the table's memory
     delete [] (uint8_t*) pTable;
 }
@@ -388,6 +413,54 @@ void HndDestroyHandle(HHANDLETABLE hTable, uint32_t uType, OBJECTHANDLE handle)
 }
 
 
+/*
+ * HndDestroyHandles
+ *
+ * Entrypoint for freeing a batch of handles of the same type that all belong
+ * to the same table.
+ *
+ */
+void HndDestroyHandles(HHANDLETABLE hTable, uint32_t uType, const OBJECTHANDLE *pHandles, uint32_t uCount)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+        CAN_TAKE_LOCK;     // because of TableFreeHandlesToCache
+    }
+    CONTRACTL_END;
+
+    // fetch the handle table pointer
+    HandleTable *pTable = Table(hTable);
+
+    // sanity check the type index
+    _ASSERTE(uType < pTable->uTypeCount);
+
+    for (uint32_t u = 0; u < uCount; u++)
+    {
+        OBJECTHANDLE handle = pHandles[u];
+
+        STRESS_LOG2(LF_GC, LL_INFO1000, "DestroyHandle: *%p->%p\n", handle, *(_UNCHECKED_OBJECTREF *)handle);
+
+        FIRE_EVENT(DestroyGCHandle, (void *)handle);
+        FIRE_EVENT(PrvDestroyGCHandle, (void *)handle);
+
+        // sanity check handle we are being asked to free
+        _ASSERTE(handle);
+        _ASSERTE(HndGetHandleTable(handle) == hTable);
+        _ASSERTE(HandleFetchType(handle) == uType);
+    }
+
+    // return the handles to the table's cache
+    TableFreeHandlesToCache(pTable, uType, pHandles, uCount);
+
+#if defined(ENABLE_PERF_COUNTERS) || defined(FEATURE_EVENT_TRACE)
+    g_dwHandles -= uCount;
+#endif // defined(ENABLE_PERF_COUNTERS) || defined(FEATURE_EVENT_TRACE)
+}
+
+
 /*
  * HndDestroyHandleOfUnknownType
  *
@@ -960,6 +1033,19 @@ uint32_t HndCountHandles(HHANDLETABLE hTable)
         if (*pQuickCache)
             ++uCacheCount;
 
+    // and do the same for the per-processor rows
+    if (pTable->pQuickCacheRows)
+    {
+        for (uint32_t uRow = 0; uRow <= pTable->uQuickCacheRowMask; uRow++)
+        {
+            pQuickCache = pTable->pQuickCacheRows[uRow].rgHandles;
+            pQuickCacheEnd = pQuickCache + HANDLE_MAX_INTERNAL_TYPES;
+            for (; pQuickCache != pQuickCacheEnd; ++pQuickCache)
+                if (*pQuickCache)
+                    ++uCacheCount;
+        }
+    }
+
     // return the number of handles marked as "used" that are not
     // residing in the cache
     return (uCount - uCacheCount);
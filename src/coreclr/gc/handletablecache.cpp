@@ -703,6 +703,25 @@ void TableCacheMissOnFree(HandleTable *pTable, HandleTypeCache *pCache, uint32_t
 }
 
 
+/*
+ * TableGetQuickCache
+ *
+ * Returns the quick cache slots that the current processor should use.
+ *
+ */
+static inline OBJECTHANDLE *TableGetQuickCache(HandleTable *pTable)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    // the processor may change underneath us; that only costs us locality,
+    // since each slot is still only ever touched with interlocked ops
+    if (pTable->pQuickCacheRows)
+        return pTable->pQuickCacheRows[GCToOSInterface::GetCurrentProcessorNumber() & pTable->uQuickCacheRowMask].rgHandles;
+
+    return pTable->rgQuickCache;
+}
+
+
 /*
  * TableAllocSingleHandleFromCache
  *
@@ -719,10 +738,11 @@ OBJECTHANDLE TableAllocSingleHandleFromCache(HandleTable *pTable, uint32_t uType
     OBJECTHANDLE handle;
 
     // first try to get a handle from the quick cache
-    if (pTable->rgQuickCache[uType])
+    OBJECTHANDLE *pQuickCache = TableGetQuickCache(pTable);
+    if (pQuickCache[uType])
     {
         // try to grab the handle we saw
-        handle = Interlocked::ExchangePointer(pTable->rgQuickCache + uType, (OBJECTHANDLE)NULL);
+        handle = Interlocked::ExchangePointer(pQuickCache + uType, (OBJECTHANDLE)NULL);
 
         // if it worked then we're done
         if (handle)
@@ -787,10 +807,11 @@ void TableFreeSingleHandleToCache(HandleTable *pTable, uint32_t uType, OBJECTHAN
         HandleQuickSetUserData(handle, 0L);
 
     // is there room in the quick cache?
-    if (!pTable->rgQuickCache[uType])
+    OBJECTHANDLE *pQuickCache = TableGetQuickCache(pTable);
+    if (!pQuickCache[uType])
     {
         // yup - try to stuff our handle in the slot we saw
-        handle = Interlocked::ExchangePointer(&pTable->rgQuickCache[uType], handle);
+        handle = Interlocked::ExchangePointer(&pQuickCache[uType], handle);
 
         // if we didn't end up with another handle then we're done
         if (!handle)
@@ -97,6 +97,8 @@ C_ASSERT (HANDLE_HANDLES_PER_MASK * 2 == HANDLE_HANDLES_PER_BLOCK);
 // cache layout metrics
 #define HANDLE_CACHE_TYPE_SIZE          128 // 128 == 63 handles per bank
 #define HANDLES_PER_CACHE_BANK          ((HANDLE_CACHE_TYPE_SIZE / 2) - 1)
+#define HANDLE_QUICK_CACHE_ROW_SIZE     128 // keeps each processor's quick cache row on its own cache lines
+#define HANDLE_MAX_QUICK_CACHE_ROWS     64  // must be a power of two
 
 // cache policy defines
 #define REBALANCE_TOLERANCE             (HANDLES_PER_CACHE_BANK / 3)
@@ -458,6 +460,22 @@ struct AsyncScanInfo
 };
 
 
+/*
+ * Handle Quick Cache Row
+ *
+ * One processor's slice of the per-type 'quick' handle cache.  Rows are
+ * padded out so that processors freeing and allocating handles concurrently
+ * do not bounce each other's cache lines.
+ */
+struct HandleQuickCacheRow
+{
+    OBJECTHANDLE rgHandles[HANDLE_MAX_INTERNAL_TYPES];      // interlocked ops used here
+    uint8_t      rgPad[HANDLE_QUICK_CACHE_ROW_SIZE - (HANDLE_MAX_INTERNAL_TYPES * sizeof(OBJECTHANDLE))];
+};
+
+C_ASSERT (sizeof(HandleQuickCacheRow) == HANDLE_QUICK_CACHE_ROW_SIZE);
+
+
 /*
  * Handle Table
  *
@@ -488,7 +506,7 @@ struct HandleTable
 
     /*
      * number of handles owned by this table that are marked as "used"
-     * (this includes the handles residing in rgMainCache and rgQuickCache)
+     * (this includes the handles residing in rgMainCache and the quick caches)
      */
     uint32_t dwCount;
 
@@ -512,6 +530,14 @@ struct HandleTable
      */
     OBJECTHANDLE rgQuickCache[HANDLE_MAX_INTERNAL_TYPES];   // interlocked ops used here
 
+    /*
+     * per-processor rows of the quick cache, used instead of rgQuickCache when
+     * many processors share this table (NULL otherwise)
+     */
+    HandleQuickCacheRow *pQuickCacheRows;
+    uint8_t             *pQuickCacheRowsAlloc;
+    uint32_t             uQuickCacheRowMask;
+
     /*
      * debug-only statistics
      */
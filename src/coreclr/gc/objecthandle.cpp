@@ -825,6 +825,54 @@ int getSlotNumber(ScanContext* sc)
     return (IsServerHeap() ? sc->thread_number : 0);
 }
 
+// Normally each server GC thread scans only the tables in its own slot of every bucket. That leaves one
+// thread doing nearly all of the work when most handles of a kind were created from threads sharing a home
+// heap (ConditionalWeakTable-heavy code is the usual example). For the phases below the GC can instead hand
+// the tables out dynamically: every thread calls the scan, and each (bucket, slot) table goes to whichever
+// thread claims it first. The claim counters are only reset by a single thread inside a join.
+static VOLATILE(int32_t) g_rgHandleTableClaims[HTSP_COUNT];
+
+void Ref_ResetHandleTableClaims()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    for (int i = 0; i < HTSP_COUNT; i++)
+        g_rgHandleTableClaims[i] = 0;
+}
+
+// Returns the next unclaimed table for the given phase, or NULL once all of them have been handed out.
+static HHANDLETABLE ClaimNextHandleTable(HandleTableScanPhase phase)
+{
+    WRAPPER_NO_CONTRACT;
+
+    // only slots that belong to a heap can hold handles (see getNumberOfSlots)
+    int n_slots = g_theGCHeap->GetNumberOfHeaps();
+
+    while (true)
+    {
+        int32_t claim = Interlocked::Increment(&g_rgHandleTableClaims[phase]) - 1;
+        uint32_t uBucket = (uint32_t)(claim / n_slots);
+        int slot = claim % n_slots;
+
+        HandleTableMap *walk = &g_HandleTableMap;
+        while (walk && (uBucket >= INITIAL_HANDLE_TABLE_ARRAY_SIZE))
+        {
+            uBucket -= INITIAL_HANDLE_TABLE_ARRAY_SIZE;
+            walk = walk->pNext;
+        }
+
+        if (!walk)
+            return NULL;
+
+        if (walk->pBuckets[uBucket] != NULL)
+        {
+            HHANDLETABLE hTable = walk->pBuckets[uBucket]->pTable[slot];
+            if (hTable)
+                return hTable;
+        }
+    }
+}
+
 // <TODO> - reexpress as complete only like hndtable does now!!! -fmh</REVISIT_TODO>
 void Ref_EndSynchronousGC(uint32_t condemned, uint32_t maxgen)
 {
@@ -941,6 +989,19 @@ uint32_t CompareExchangeVariableHandleType(OBJECTHANDLE handle, uint32_t oldType
 }
 
 
+// Traces the variable-strength handles of a single table.
+static void TraceVariableHandlesInTable(HHANDLETABLE hTable, HANDLESCANPROC pfnTrace, uintptr_t lp1, uintptr_t lp2, uint32_t uEnableMask, uint32_t condemned, uint32_t maxgen, uint32_t flags)
+{
+    WRAPPER_NO_CONTRACT;
+
+    uint32_t           type = HNDTYPE_VARIABLE;
+    struct VARSCANINFO info = { (uintptr_t)uEnableMask, pfnTrace, lp2 };
+
+    HndScanHandlesForGC(hTable, VariableTraceDispatcher,
+                        lp1, (uintptr_t)&info, &type, 1, condemned, maxgen, HNDGCF_EXTRAINFO | flags);
+}
+
+
 /*
  * TraceVariableHandles.
  *
@@ -1121,7 +1182,7 @@ void Ref_TraceRefCountHandles(HANDLESCANPROC callback, uintptr_t lParam1, uintpt
 
 
 
-void Ref_CheckReachable(uint32_t condemned, uint32_t maxgen, uintptr_t lp1)
+void Ref_CheckReachable(uint32_t condemned, uint32_t maxgen, uintptr_t lp1, bool fClaimTables)
 {
     WRAPPER_NO_CONTRACT;
 
@@ -1138,6 +1199,23 @@ void Ref_CheckReachable(uint32_t condemned, uint32_t maxgen, uintptr_t lp1)
 
     // check objects pointed to by short weak handles
     uint32_t flags = (((ScanContext*) lp1)->concurrent) ? HNDGCF_ASYNC : HNDGCF_NORMAL;
+
+    if (fClaimTables)
+    {
+        HHANDLETABLE hTable;
+        uint32_t dependentType = HNDTYPE_DEPENDENT;
+        while ((hTable = ClaimNextHandleTable(HTSP_LONG_WEAK)) != NULL)
+        {
+            HndScanHandlesForGC(hTable, CheckPromoted, lp1, 0, types, _countof(types), condemned, maxgen, flags);
+
+            // the variable and dependent handles have to come from the same claim so no two threads share a
+            // table (this is the work Ref_ScanDependentHandlesForClearing does in the unclaimed case)
+            TraceVariableHandlesInTable(hTable, CheckPromoted, lp1, 0, VHT_WEAK_LONG, condemned, maxgen, flags);
+            HndScanHandlesForGC(hTable, ClearDependentHandle, lp1, 0, &dependentType, 1, condemned, maxgen, flags | HNDGCF_EXTRAINFO);
+        }
+        return;
+    }
+
     int uCPUindex = getSlotNumber((ScanContext*) lp1);
 
     HandleTableMap *walk = &g_HandleTableMap;
@@ -1145,11 +1223,11 @@ void Ref_CheckReachable(uint32_t condemned, uint32_t maxgen, uintptr_t lp1)
         for (uint32_t i = 0; i < INITIAL_HANDLE_TABLE_ARRAY_SIZE; i ++)
         {
             if (walk->pBuckets[i] != NULL)
-           {
+            {
                 HHANDLETABLE hTable = walk->pBuckets[i]->pTable[uCPUindex];
                 if (hTable)
                     HndScanHandlesForGC(hTable, CheckPromoted, lp1, 0, types, _countof(types), condemned, maxgen, flags);
-        }
+            }
         }
         walk = walk->pNext;
     }
@@ -1185,6 +1263,52 @@ DhContext *Ref_GetDependentHandleContext(ScanContext* sc)
     return &g_pDependentHandleContexts[getSlotNumber(sc)];
 }
 
+// Claimed flavor of Ref_ScanDependentHandlesForPromotion below: the tables this thread scans are whichever it
+// claims rather than the ones in its own slot. Each claimed table is rescanned until it stops producing
+// promotions; other tables (including those scanned by other threads) are picked up on the GC's next round.
+static bool ScanClaimedDependentHandlesForPromotion(DhContext *pDhContext)
+{
+    uint32_t type = HNDTYPE_DEPENDENT;
+    uint32_t flags = (pDhContext->m_pScanContext->concurrent) ? HNDGCF_ASYNC : HNDGCF_NORMAL;
+    flags |= HNDGCF_EXTRAINFO;
+
+    bool fAnyPromotions = false;
+    bool fAnyUnpromotedPrimaries = false;
+
+    HHANDLETABLE hTable;
+    while ((hTable = ClaimNextHandleTable(HTSP_DEPENDENT_PROMOTION)) != NULL)
+    {
+        do
+        {
+            pDhContext->m_fUnpromotedPrimaries = false;
+            pDhContext->m_fPromoted = false;
+
+            HndScanHandlesForGC(hTable,
+                                PromoteDependentHandle,
+                                uintptr_t(pDhContext->m_pScanContext),
+                                uintptr_t(pDhContext->m_pfnPromoteFunction),
+                                &type, 1,
+                                pDhContext->m_iCondemned,
+                                pDhContext->m_iMaxGen,
+                                flags );
+
+            if (pDhContext->m_fPromoted)
+                fAnyPromotions = true;
+
+        } while (pDhContext->m_fUnpromotedPrimaries && pDhContext->m_fPromoted);
+
+        if (pDhContext->m_fUnpromotedPrimaries)
+            fAnyUnpromotedPrimaries = true;
+    }
+
+    // leave the context describing everything this thread scanned so that the GC's OR across threads covers
+    // every table
+    pDhContext->m_fUnpromotedPrimaries = fAnyUnpromotedPrimaries;
+    pDhContext->m_fPromoted = fAnyPromotions;
+
+    return fAnyPromotions;
+}
+
 // Scan the dependent handle table promoting any secondary object whose associated primary object is promoted.
 //
 // Multiple scans may be required since (a) secondary promotions made during one scan could cause the primary
@@ -1192,8 +1316,11 @@ DhContext *Ref_GetDependentHandleContext(ScanContext* sc)
 // initially calls us.
 //
 // Returns true if any promotions resulted from this scan.
-bool Ref_ScanDependentHandlesForPromotion(DhContext *pDhContext)
+bool Ref_ScanDependentHandlesForPromotion(DhContext *pDhContext, bool fClaimTables)
 {
+    if (fClaimTables)
+        return ScanClaimedDependentHandlesForPromotion(pDhContext);
+
     LOG((LF_GC, LL_INFO10000, "Checking liveness of referents of dependent handles in generation %u\n", pDhContext->m_iCondemned));
     uint32_t type = HNDTYPE_DEPENDENT;
     uint32_t flags = (pDhContext->m_pScanContext->concurrent) ? HNDGCF_ASYNC : HNDGCF_NORMAL;
@@ -1368,7 +1495,7 @@ void Ref_ScanSizedRefHandles(uint32_t condemned, uint32_t maxgen, ScanContext* s
     ScanSizedRefByCPU(maxgen, CalculateSizedRefSize, sc, fn, flags);
 }
 
-void Ref_CheckAlive(uint32_t condemned, uint32_t maxgen, uintptr_t lp1)
+void Ref_CheckAlive(uint32_t condemned, uint32_t maxgen, uintptr_t lp1, bool fClaimTables)
 {
     WRAPPER_NO_CONTRACT;
 
@@ -1384,6 +1511,19 @@ void Ref_CheckAlive(uint32_t condemned, uint32_t maxgen, uintptr_t lp1)
     };
     uint32_t flags = (((ScanContext*) lp1)->concurrent) ? HNDGCF_ASYNC : HNDGCF_NORMAL;
 
+    if (fClaimTables)
+    {
+        HHANDLETABLE hTable;
+        while ((hTable = ClaimNextHandleTable(HTSP_SHORT_WEAK)) != NULL)
+        {
+            HndScanHandlesForGC(hTable, CheckPromoted, lp1, 0, types, _countof(types), condemned, maxgen, flags);
+
+            // the variable handles have to come from the same claim so no two threads share a table
+            TraceVariableHandlesInTable(hTable, CheckPromoted, lp1, 0, VHT_WEAK_SHORT, condemned, maxgen, flags);
+        }
+        return;
+    }
+
     int uCPUindex = getSlotNumber((ScanContext*) lp1);
     HandleTableMap *walk = &g_HandleTableMap;
     while (walk)
@@ -0,0 +1,491 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+//
+// GCBench.cpp
+//
+
+//
+//  A benchmark driver for the GC, built on the same minimal execution engine as GCSample (see the
+//  overview in GCSample.cpp). It runs synthetic workloads against the GC without the rest of CoreCLR,
+//  so GC changes can be compared in isolation:
+//
+//  * gen0churn - short lived small objects with a small set of survivors that gets replaced steadily
+//  * lohfrag   - large arrays of random sizes replaced in random order, fragmenting the large object heap
+//  * pinning   - small gen0 buffers pinned through pinned handles while other objects are churned around them
+//  * deepgraph - a long linked list plus a binary tree whose subtrees are replaced, for deep mark stacks
+//
+//  Usage: gcbench [workload|all] [scale]
+//
+//  scale multiplies the amount of work done by every workload (default 1). The random number generator
+//  is seeded with a fixed value so runs are reproducible. For every workload we print the number of GCs
+//  per generation, the allocation throughput and the percentiles of the EE suspension (GC pause) times.
+//
+//  The sample EE is single threaded and does not create GC threads, so only blocking workstation GCs
+//  are measured.
+//
+
+#include "common.h"
+
+#include "gcenv.h"
+
+#include "gc.h"
+#include "objecthandle.h"
+
+#include "gcdesc.h"
+
+#if defined(HOST_64BIT)
+#define card_byte_shift     11
+#else
+#define card_byte_shift     10
+#endif
+
+#define card_byte(addr) (((size_t)(addr)) >> card_byte_shift)
+
+static IGCHeap * g_pBenchHeap;
+
+// xorshift64*, seeded per workload so each one is reproducible on its own
+static uint64_t g_rngState;
+
+static void SeedRandom(uint64_t seed)
+{
+    g_rngState = seed;
+}
+
+static uint32_t NextRandom(uint32_t range)
+{
+    g_rngState ^= g_rngState >> 12;
+    g_rngState ^= g_rngState << 25;
+    g_rngState ^= g_rngState >> 27;
+    return (uint32_t)(((g_rngState * 2685821657736338717ULL) >> 32) % range);
+}
+
+//
+// Type layouts
+//
+
+class Node : public Object {
+public:
+    Object * m_pLeft;
+    Object * m_pRight;
+    size_t m_payload;
+};
+
+static struct Node_MethodTable
+{
+    // GCDesc
+    CGCDescSeries m_series[1];
+    size_t m_numSeries;
+
+    // The actual methodtable
+    MethodTable m_MT;
+}
+Node_MethodTable;
+
+// A byte array, laid out like the free object methodtable
+static MethodTable ByteArray_MethodTable;
+
+static void InitializeMethodTables()
+{
+    uint32_t baseSize = sizeof(Node) + sizeof(ObjHeader);
+    Node_MethodTable.m_MT.m_baseSize = max(baseSize, MIN_OBJECT_SIZE);
+    Node_MethodTable.m_MT.m_componentSize = 0;
+    Node_MethodTable.m_MT.m_flags = MTFlag_ContainsPointers;
+
+    // m_pLeft and m_pRight are adjacent so a single series covers both
+    Node_MethodTable.m_numSeries = 1;
+    Node_MethodTable.m_series[0].SetSeriesOffset(offsetof(Node, m_pLeft));
+    Node_MethodTable.m_series[0].SetSeriesCount(2);
+    Node_MethodTable.m_series[0].seriessize -= Node_MethodTable.m_MT.m_baseSize;
+
+    ByteArray_MethodTable.InitializeFreeObject();
+}
+
+//
+// Allocation and write barrier, same as in GCSample but with support for arrays and the large object heap
+//
+
+static Object * AllocateRaw(MethodTable * pMT, size_t size, uint32_t flags)
+{
+    Object * pObject;
+
+    alloc_context * acontext = GetThread()->GetAllocContext();
+    uint8_t* result = acontext->alloc_ptr;
+    uint8_t* advance = result + size;
+    if ((flags == 0) && (advance <= acontext->alloc_limit))
+    {
+        acontext->alloc_ptr = advance;
+        pObject = (Object *)result;
+    }
+    else
+    {
+        pObject = g_pBenchHeap->Alloc(acontext, size, flags);
+        if (pObject == NULL)
+        {
+            printf("Out of memory allocating %zu bytes\n", size);
+            abort();
+        }
+    }
+
+    pObject->RawSetMethodTable(pMT);
+    return pObject;
+}
+
+static Node * AllocateNode(size_t payload)
+{
+    Node * pNode = (Node *)AllocateRaw(&Node_MethodTable.m_MT, Node_MethodTable.m_MT.GetBaseSize(), 0);
+    pNode->m_payload = payload;
+    return pNode;
+}
+
+static Object * AllocateByteArray(uint32_t length)
+{
+    size_t size = ALIGN_UP(ByteArray_MethodTable.GetBaseSize() + (size_t)length, sizeof(void*));
+    uint32_t flags = (size >= 85000) ? GC_ALLOC_LARGE_OBJECT_HEAP : 0;
+
+    ArrayBase * pArray = (ArrayBase *)AllocateRaw(&ByteArray_MethodTable, size, flags);
+    *(uint32_t *)((uint8_t *)pArray + ArrayBase::GetOffsetOfNumComponents()) = length;
+    return pArray;
+}
+
+inline void ErectWriteBarrier(Object ** dst, Object * ref)
+{
+    if (((uint8_t*)dst < g_gc_lowest_address) || ((uint8_t*)dst >= g_gc_highest_address))
+        return;
+
+    uint8_t* pCardByte = (uint8_t *)*(volatile uint8_t **)(&g_gc_card_table) + card_byte((uint8_t *)dst);
+    if(*pCardByte != 0xFF)
+        *pCardByte = 0xFF;
+}
+
+static void WriteBarrier(Object ** dst, Object * ref)
+{
+    *dst = ref;
+    ErectWriteBarrier(dst, ref);
+}
+
+//
+// Roots. The sample EE reports no stack roots, so everything that has to survive is held by handles.
+//
+
+class RootSet
+{
+    OBJECTHANDLE * m_pHandles;
+    uint32_t m_count;
+
+public:
+    RootSet(uint32_t count, HandleType type)
+        : m_count(count)
+    {
+        HHANDLETABLE hTable = g_HandleTableMap.pBuckets[0]->pTable[GetCurrentThreadHomeHeapNumber()];
+
+        m_pHandles = new OBJECTHANDLE[count];
+        for (uint32_t i = 0; i < count; i++)
+        {
+            m_pHandles[i] = HndCreateHandle(hTable, type, NULL);
+            if (m_pHandles[i] == NULL)
+            {
+                printf("Failed to create handle\n");
+                abort();
+            }
+        }
+    }
+
+    ~RootSet()
+    {
+        for (uint32_t i = 0; i < m_count; i++)
+        {
+            HndDestroyHandleOfUnknownType(HndGetHandleTable(m_pHandles[i]), m_pHandles[i]);
+        }
+        delete[] m_pHandles;
+    }
+
+    uint32_t Count()
+    {
+        return m_count;
+    }
+
+    Object * Get(uint32_t index)
+    {
+        return OBJECTREFToObject(HndFetchHandle(m_pHandles[index]));
+    }
+
+    void Set(uint32_t index, Object * pObject)
+    {
+        HndAssignHandle(m_pHandles[index], ObjectToOBJECTREF(pObject));
+    }
+};
+
+//
+// Pause tracking
+//
+
+static int64_t * g_pPauseTicks;
+static size_t g_pauseCount;
+static size_t g_pauseCapacity;
+
+static void RecordPause(int64_t ticks)
+{
+    if (g_pauseCount == g_pauseCapacity)
+    {
+        size_t newCapacity = max(g_pauseCapacity * 2, (size_t)1024);
+        int64_t * pNew = new int64_t[newCapacity];
+        if (g_pauseCount != 0)
+            memcpy(pNew, g_pPauseTicks, g_pauseCount * sizeof(int64_t));
+        delete[] g_pPauseTicks;
+        g_pPauseTicks = pNew;
+        g_pauseCapacity = newCapacity;
+    }
+
+    g_pPauseTicks[g_pauseCount++] = ticks;
+}
+
+static int ComparePauses(const void * a, const void * b)
+{
+    int64_t l = *(const int64_t *)a;
+    int64_t r = *(const int64_t *)b;
+    return (l < r) ? -1 : ((l > r) ? 1 : 0);
+}
+
+static double TicksToMicroseconds(int64_t ticks)
+{
+    return (double)ticks * 1000000.0 / (double)GCToOSInterface::QueryPerformanceFrequency();
+}
+
+static double PausePercentile(double percentile)
+{
+    size_t index = (size_t)(percentile * (double)(g_pauseCount - 1) / 100.0 + 0.5);
+    return TicksToMicroseconds(g_pPauseTicks[index]);
+}
+
+//
+// Workloads
+//
+
+static void Gen0Churn(uint32_t scale)
+{
+    RootSet survivors(4096, HNDTYPE_DEFAULT);
+
+    for (size_t i = 0; i < (size_t)scale * 100000000; i++)
+    {
+        Node * pNode = AllocateNode(i);
+
+        // roughly one in sixteen objects survives until its slot is reused
+        if ((i % 16) == 0)
+        {
+            survivors.Set(NextRandom(survivors.Count()), pNode);
+        }
+    }
+}
+
+static void LohFragmentation(uint32_t scale)
+{
+    RootSet arrays(512, HNDTYPE_DEFAULT);
+    RootSet small(1024, HNDTYPE_DEFAULT);
+
+    for (size_t i = 0; i < (size_t)scale * 40000; i++)
+    {
+        // sizes above the large object threshold, up to 1MB
+        uint32_t length = 85000 + NextRandom(1024 * 1024 - 85000);
+        arrays.Set(NextRandom(arrays.Count()), AllocateByteArray(length));
+
+        // some small object churn in between so gen0 GCs happen too
+        for (int j = 0; j < 64; j++)
+        {
+            small.Set(NextRandom(small.Count()), AllocateByteArray(NextRandom(512)));
+        }
+    }
+}
+
+static void PinningStorm(uint32_t scale)
+{
+    RootSet pinned(2048, HNDTYPE_PINNED);
+    RootSet live(4096, HNDTYPE_DEFAULT);
+
+    for (size_t i = 0; i < (size_t)scale * 20000000; i++)
+    {
+        if ((i % 8) == 0)
+        {
+            // a freshly allocated buffer, pinned while still in gen0
+            pinned.Set(NextRandom(pinned.Count()), AllocateByteArray(1024 + NextRandom(3072)));
+        }
+
+        Node * pNode = AllocateNode(i);
+        if ((i % 4) == 0)
+        {
+            live.Set(NextRandom(live.Count()), pNode);
+        }
+    }
+}
+
+static Node * BuildTree(int depth, size_t payload)
+{
+    Node * pNode = AllocateNode(payload);
+    if (depth == 0)
+        return pNode;
+
+    // keep the node reachable while its children are being allocated
+    RootSet parent(1, HNDTYPE_DEFAULT);
+    parent.Set(0, pNode);
+
+    Node * pLeft = BuildTree(depth - 1, payload * 2);
+    WriteBarrier(&((Node *)parent.Get(0))->m_pLeft, pLeft);
+
+    Node * pRight = BuildTree(depth - 1, payload * 2 + 1);
+    WriteBarrier(&((Node *)parent.Get(0))->m_pRight, pRight);
+
+    return (Node *)parent.Get(0);
+}
+
+static void DeepGraph(uint32_t scale)
+{
+    const int treeDepth = 18;
+    const int subtreeDepth = 8;
+
+    RootSet roots(2, HNDTYPE_DEFAULT);
+
+    // a linked list long enough to overflow the mark stack, roots[0] is the head and roots[1] the tail
+    roots.Set(0, AllocateNode(0));
+    roots.Set(1, roots.Get(0));
+    for (size_t i = 1; i < 1000000; i++)
+    {
+        Node * pNode = AllocateNode(i);
+
+        // fetch the tail after allocating, the allocation may have moved it
+        WriteBarrier(&((Node *)roots.Get(1))->m_pLeft, pNode);
+        roots.Set(1, pNode);
+    }
+
+    // a binary tree whose subtrees are replaced, creating old-to-young references all over it
+    RootSet tree(1, HNDTYPE_DEFAULT);
+    tree.Set(0, BuildTree(treeDepth, 1));
+
+    for (size_t i = 0; i < (size_t)scale * 200000; i++)
+    {
+        Node * pSubtree = BuildTree(subtreeDepth, i);
+
+        Node * pNode = (Node *)tree.Get(0);
+        for (int level = 0; level < treeDepth - subtreeDepth - 1; level++)
+        {
+            pNode = (Node *)(NextRandom(2) ? pNode->m_pLeft : pNode->m_pRight);
+        }
+
+        WriteBarrier(NextRandom(2) ? &pNode->m_pLeft : &pNode->m_pRight, pSubtree);
+    }
+}
+
+struct Workload
+{
+    const char * name;
+    void (*run)(uint32_t scale);
+};
+
+static const Workload s_workloads[] =
+{
+    { "gen0churn", Gen0Churn },
+    { "lohfrag", LohFragmentation },
+    { "pinning", PinningStorm },
+    { "deepgraph", DeepGraph },
+};
+
+static void RunWorkload(const Workload * pWorkload, uint32_t scale)
+{
+    int gcCountsBefore[3];
+    for (int gen = 0; gen < 3; gen++)
+        gcCountsBefore[gen] = g_pBenchHeap->CollectionCount(gen);
+
+    g_pauseCount = 0;
+    SeedRandom(0x2545F4914F6CDD1DULL);
+
+    uint64_t allocatedBefore = g_pBenchHeap->GetTotalAllocatedBytes();
+    int64_t start = GCToOSInterface::QueryPerformanceCounter();
+
+    pWorkload->run(scale);
+
+    int64_t elapsed = GCToOSInterface::QueryPerformanceCounter() - start;
+    uint64_t allocated = g_pBenchHeap->GetTotalAllocatedBytes() - allocatedBefore;
+
+    int gcCounts[3];
+    for (int gen = 0; gen < 3; gen++)
+        gcCounts[gen] = g_pBenchHeap->CollectionCount(gen) - gcCountsBefore[gen];
+
+    int64_t totalPause = 0;
+    for (size_t i = 0; i < g_pauseCount; i++)
+        totalPause += g_pPauseTicks[i];
+
+    double elapsedSeconds = TicksToMicroseconds(elapsed) / 1000000.0;
+
+    printf("%-10s elapsed %8.3fs  allocated %10.1fMB  throughput %8.1fMB/s  gcs gen0 %d gen1 %d gen2 %d\n",
+        pWorkload->name,
+        elapsedSeconds,
+        (double)allocated / (1024 * 1024),
+        (double)allocated / (1024 * 1024) / elapsedSeconds,
+        gcCounts[0] - gcCounts[1], gcCounts[1] - gcCounts[2], gcCounts[2]);
+
+    if (g_pauseCount != 0)
+    {
+        qsort(g_pPauseTicks, g_pauseCount, sizeof(int64_t), ComparePauses);
+
+        printf("%-10s pauses %zu  time in gc %5.1f%%  p50 %9.1fus  p90 %9.1fus  p99 %9.1fus  max %9.1fus\n",
+            pWorkload->name,
+            g_pauseCount,
+            100.0 * (double)totalPause / (double)elapsed,
+            PausePercentile(50), PausePercentile(90), PausePercentile(99), PausePercentile(100));
+    }
+}
+
+extern "C" HRESULT GC_Initialize(IGCToCLR* clrToGC, IGCHeap** gcHeap, IGCHandleManager** gcHandleManager, GcDacVars* gcDacVars);
+
+int __cdecl main(int argc, char* argv[])
+{
+    const char * workloadName = (argc > 1) ? argv[1] : "all";
+    uint32_t scale = (argc > 2) ? (uint32_t)atoi(argv[2]) : 1;
+    if (scale == 0)
+    {
+        printf("Usage: gcbench [workload|all] [scale]\n");
+        return -1;
+    }
+
+    // GC_Initialize initializes the OS interface too
+    GcDacVars dacVars;
+    IGCHandleManager *pGCHandleManager;
+    if (GC_Initialize(nullptr, &g_pBenchHeap, &pGCHandleManager, &dacVars) != S_OK)
+    {
+        return -1;
+    }
+
+    if (FAILED(g_pBenchHeap->Initialize()))
+        return -1;
+
+    if (!pGCHandleManager->Initialize())
+        return -1;
+
+    ThreadStore::AttachCurrentThread();
+
+    InitializeMethodTables();
+    SetSuspensionCallback(RecordPause);
+
+    bool found = false;
+    for (size_t i = 0; i < sizeof(s_workloads) / sizeof(s_workloads[0]); i++)
+    {
+        if ((strcmp(workloadName, "all") == 0) || (strcmp(workloadName, s_workloads[i].name) == 0))
+        {
+            RunWorkload(&s_workloads[i], scale);
+
+            // start the next workload from a clean heap
+            g_pBenchHeap->GarbageCollect();
+            found = true;
+        }
+    }
+
+    if (!found)
+    {
+        printf("Unknown workload '%s'. Workloads are:", workloadName);
+        for (size_t i = 0; i < sizeof(s_workloads) / sizeof(s_workloads[0]); i++)
+            printf(" %s", s_workloads[i].name);
+        printf("\n");
+        return -1;
+    }
+
+    return 0;
+}
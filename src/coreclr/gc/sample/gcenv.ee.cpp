@@ -124,8 +124,18 @@ void ThreadStore::AttachCurrentThread()
     g_pThreadList = pThread;
 }
 
+static SuspensionCallback g_pSuspensionCallback = NULL;
+static int64_t g_suspendStart;
+
+void SetSuspensionCallback(SuspensionCallback callback)
+{
+    g_pSuspensionCallback = callback;
+}
+
 void GCToEEInterface::SuspendEE(SUSPEND_REASON reason)
 {
+    g_suspendStart = GCToOSInterface::QueryPerformanceCounter();
+
     g_theGCHeap->SetGCInProgress(true);
 
     // TODO: Implement
@@ -136,6 +146,11 @@ void GCToEEInterface::RestartEE(bool bFinishedGC)
     // TODO: Implement
 
     g_theGCHeap->SetGCInProgress(false);
+
+    if (g_pSuspensionCallback != NULL)
+    {
+        g_pSuspensionCallback(GCToOSInterface::QueryPerformanceCounter() - g_suspendStart);
+    }
 }
 
 void GCToEEInterface::GcScanRoots(promote_func* fn,  int condemned, int max_gen, ScanContext* sc)
@@ -137,6 +137,12 @@ public:
     static void AttachCurrentThread();
 };
 
+// Called when the EE is restarted with how long it was suspended for, in
+// GCToOSInterface::QueryPerformanceCounter ticks
+typedef void (*SuspensionCallback)(int64_t suspendedTicks);
+
+void SetSuspensionCallback(SuspensionCallback callback);
+
 // -----------------------------------------------------------------------------------------------------------
 // Config file enumulation
 //
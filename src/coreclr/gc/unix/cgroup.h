@@ -7,6 +7,7 @@
 
 void InitializeCGroup();
 void CleanupCGroup();
+void RefreshCGroup();
 
 #endif // __CGROUP_H__
 
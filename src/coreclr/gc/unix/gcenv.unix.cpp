@@ -226,6 +226,7 @@ static pthread_mutex_t g_flushProcessWriteBuffersMutex;
 size_t GetRestrictedPhysicalMemoryLimit();
 bool GetPhysicalMemoryUsed(size_t* val);
 bool GetCpuLimit(uint32_t* val);
+bool GetMemoryPressure(uint32_t* stall_some, uint32_t* stall_full, uint64_t* high_limit);
 
 static size_t g_RestrictedPhysicalMemoryLimit = 0;
 
@@ -348,6 +349,175 @@ void NUMASupportCleanup()
 #endif // HAVE_NUMA_H
 }
 
+// Processors of the current process in the order in which they are handed out to heaps
+static uint16_t g_heapProcessorOrder[MAX_SUPPORTED_CPUS];
+static uint16_t g_heapProcessorCount = 0;
+
+#ifdef __linux__
+struct HeapProcessorInfo
+{
+    uint16_t procNo;
+    uint16_t node;
+    // First processor of the last level cache domain and of the core of the processor
+    uint16_t llcDomain;
+    uint16_t core;
+    // Position of the processor within its last level cache domain, all the cores of the
+    // domain come before their SMT siblings
+    uint16_t llcRank;
+};
+
+// Read the first processor of a sysfs processor list like "0-3,64-67"
+static bool ReadFirstProcessorFromList(const char* path, uint16_t* procNo)
+{
+    FILE* file = fopen(path, "r");
+    if (file == nullptr)
+    {
+        return false;
+    }
+
+    unsigned int value;
+    bool result = (fscanf(file, "%u", &value) == 1) && (value < MAX_SUPPORTED_CPUS);
+    fclose(file);
+
+    if (result)
+    {
+        *procNo = (uint16_t)value;
+    }
+
+    return result;
+}
+
+static bool GetLastLevelCacheDomain(size_t procNo, uint16_t* llcDomain)
+{
+    bool found = false;
+    unsigned int highestLevel = 0;
+
+    for (int index = 0; ; index++)
+    {
+        char path[128];
+        snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%zu/cache/index%d/level", procNo, index);
+
+        FILE* file = fopen(path, "r");
+        if (file == nullptr)
+        {
+            break;
+        }
+
+        unsigned int level;
+        bool hasLevel = fscanf(file, "%u", &level) == 1;
+        fclose(file);
+
+        if (hasLevel && level >= highestLevel)
+        {
+            snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%zu/cache/index%d/shared_cpu_list", procNo, index);
+            if (ReadFirstProcessorFromList(path, llcDomain))
+            {
+                highestLevel = level;
+                found = true;
+            }
+        }
+    }
+
+    return found;
+}
+
+// Order the processors so that consecutive heaps go to different last level cache domains,
+// using one SMT thread per core first, while the heaps of a NUMA node stay contiguous. When
+// there are fewer heaps than processors, as with containers or GCHeapCount, this spreads the
+// heaps over all the L3 caches instead of packing them into the first ones (e.g. one CCX on
+// AMD EPYC).
+static bool InitializeTopologyHeapProcessorOrder()
+{
+    static HeapProcessorInfo processors[MAX_SUPPORTED_CPUS];
+    uint16_t count = 0;
+
+    for (size_t procNo = 0; procNo < MAX_SUPPORTED_CPUS; procNo++)
+    {
+        if (!g_processAffinitySet.Contains(procNo))
+        {
+            continue;
+        }
+
+        HeapProcessorInfo* info = &processors[count++];
+        info->procNo = (uint16_t)procNo;
+        info->node = 0;
+#if HAVE_NUMA_H
+        if (g_numaAvailable)
+        {
+            int result = numa_node_of_cpu(procNo);
+            info->node = (result >= 0) ? (uint16_t)result : 0;
+        }
+#endif // HAVE_NUMA_H
+
+        char path[128];
+        snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%zu/topology/thread_siblings_list", procNo);
+        if (!GetLastLevelCacheDomain(procNo, &info->llcDomain) || !ReadFirstProcessorFromList(path, &info->core))
+        {
+            return false;
+        }
+    }
+
+    for (uint16_t i = 0; i < count; i++)
+    {
+        HeapProcessorInfo* info = &processors[i];
+        bool isSibling = info->core != info->procNo;
+
+        info->llcRank = 0;
+        for (uint16_t j = 0; j < count; j++)
+        {
+            const HeapProcessorInfo* other = &processors[j];
+            if (other->node != info->node || other->llcDomain != info->llcDomain)
+            {
+                continue;
+            }
+
+            bool isOtherSibling = other->core != other->procNo;
+            if ((isOtherSibling < isSibling) || ((isOtherSibling == isSibling) && (other->procNo < info->procNo)))
+            {
+                info->llcRank++;
+            }
+        }
+    }
+
+    std::sort(processors, processors + count, [](const HeapProcessorInfo& a, const HeapProcessorInfo& b)
+    {
+        if (a.node != b.node)
+            return a.node < b.node;
+        if (a.llcRank != b.llcRank)
+            return a.llcRank < b.llcRank;
+        return a.llcDomain < b.llcDomain;
+    });
+
+    for (uint16_t i = 0; i < count; i++)
+    {
+        g_heapProcessorOrder[i] = processors[i].procNo;
+    }
+    g_heapProcessorCount = count;
+
+    return true;
+}
+#endif // __linux__
+
+static void InitializeHeapProcessorOrder()
+{
+#ifdef __linux__
+    if (InitializeTopologyHeapProcessorOrder())
+    {
+        return;
+    }
+#endif // __linux__
+
+    // No topology information, hand out the processors in order
+    g_heapProcessorCount = 0;
+    for (size_t procNo = 0; procNo < MAX_SUPPORTED_CPUS; procNo++)
+    {
+        if (g_processAffinitySet.Contains(procNo))
+        {
+            g_heapProcessorOrder[g_heapProcessorCount++] = (uint16_t)procNo;
+        }
+    }
+}
+
 // Initialize the interface implementation
 // Return:
 //  true if it has succeeded, false if it has failed
@@ -456,6 +626,8 @@ bool GCToOSInterface::Initialize()
 
     NUMASupportInitialize();
 
+    InitializeHeapProcessorOrder();
+
     return true;
 }
 
@@ -473,6 +645,32 @@ void GCToOSInterface::Shutdown()
     NUMASupportCleanup();
 }
 
+// Discard the cached processor count and memory limit. The affinity set and the NUMA
+// data are left alone, the heaps were already laid out for them.
+void GCToOSInterface::RefreshResourceLimits()
+{
+    RefreshCGroup();
+
+    uint32_t cpuCount = g_totalCpuCount;
+
+#if HAVE_SCHED_GETAFFINITY
+    cpu_set_t cpuSet;
+    if (sched_getaffinity(getpid(), sizeof(cpu_set_t), &cpuSet) == 0)
+    {
+        cpuCount = CPU_COUNT(&cpuSet);
+    }
+#endif // HAVE_SCHED_GETAFFINITY
+
+    uint32_t cpuLimit;
+    if (GetCpuLimit(&cpuLimit) && cpuLimit < cpuCount)
+    {
+        cpuCount = cpuLimit;
+    }
+
+    VolatileStore(&g_currentProcessCpuCount, cpuCount);
+    VolatileStore(&g_RestrictedPhysicalMemoryLimit, (size_t)0);
+}
+
 // Get numeric id of the current thread if possible on the
 // current platform. It is indended for logging purposes only.
 // Return:
@@ -803,6 +1001,25 @@ bool GCToOSInterface::VirtualReset(void * address, size_t size, bool unlock)
     return (st == 0);
 }
 
+// Ask for a virtual memory range to be backed by large pages where the OS can do that
+// without committing up front. This is only a hint, the range keeps working with normal
+// pages if no large pages are available.
+// Parameters:
+//  address - starting virtual address
+//  size    - size of the virtual memory range
+// Return:
+//  true if the OS accepted the hint, false otherwise
+bool GCToOSInterface::VirtualPreferLargePages(void* address, size_t size)
+{
+#ifdef MADV_HUGEPAGE
+    // This fails with EINVAL if the kernel was built without transparent huge pages
+    // and is a no-op if they are disabled system wide, both of which are fine.
+    return (madvise(address, size, MADV_HUGEPAGE) == 0);
+#else
+    return false;
+#endif
+}
+
 // Check if the OS supports write watching
 bool GCToOSInterface::SupportsWriteWatch()
 {
@@ -1368,6 +1585,18 @@ void GCToOSInterface::GetMemoryStatus(uint64_t restricted_limit, uint32_t* memor
         *available_page_file = GetAvailablePageFile();
 }
 
+// Get the memory pressure the OS reports for the process
+// Parameters:
+//  stall_some - Hundredths of a percent of recent time in which some tasks were stalled waiting on memory.
+//  stall_full - Hundredths of a percent of recent time in which all non-idle tasks were stalled waiting on memory.
+//  high_limit - The usage, in bytes, above which the OS throttles and reclaims aggressively, or 0 if there is none.
+// Return:
+//  true if any of the above is available
+bool GCToOSInterface::GetMemoryPressure(uint32_t* stall_some, uint32_t* stall_full, uint64_t* high_limit)
+{
+    return ::GetMemoryPressure(stall_some, stall_full, high_limit);
+}
+
 // Get a high precision performance counter
 // Return:
 //  The counter value
@@ -1445,36 +1674,26 @@ bool GCToOSInterface::CanEnableGCCPUGroups()
 //  true if it succeeded
 bool GCToOSInterface::GetProcessorForHeap(uint16_t heap_number, uint16_t* proc_no, uint16_t* node_no)
 {
-    bool success = false;
-
-    uint16_t availableProcNumber = 0;
-    for (size_t procNumber = 0; procNumber < MAX_SUPPORTED_CPUS; procNumber++)
+    if (heap_number >= g_heapProcessorCount)
     {
-        if (g_processAffinitySet.Contains(procNumber))
-        {
-            if (availableProcNumber == heap_number)
-            {
-                *proc_no = procNumber;
+        return false;
+    }
+
+    uint16_t procNumber = g_heapProcessorOrder[heap_number];
+    *proc_no = procNumber;
 #if HAVE_NUMA_H
-                if (GCToOSInterface::CanEnableGCNumaAware())
-                {
-                    int result = numa_node_of_cpu(procNumber);
-                    *node_no = (result >= 0) ? (uint16_t)result : NUMA_NODE_UNDEFINED;
-                }
-                else
+    if (GCToOSInterface::CanEnableGCNumaAware())
+    {
+        int result = numa_node_of_cpu(procNumber);
+        *node_no = (result >= 0) ? (uint16_t)result : NUMA_NODE_UNDEFINED;
+    }
+    else
 #endif // HAVE_NUMA_H
-                {
-                    *node_no = NUMA_NODE_UNDEFINED;
-                }
-
-                success = true;
-                break;
-            }
-            availableProcNumber++;
-        }
+    {
+        *node_no = NUMA_NODE_UNDEFINED;
     }
 
-    return success;
+    return true;
 }
 
 // Parse the confing string describing affinitization ranges and update the passed in affinitySet accordingly
@@ -12,7 +12,7 @@
 #define ARCH_X64
 #endif
 #ifdef _M_ARM64
-#define ARCH_ARM
+#define ARCH_ARM64
 #endif
 #else
 #ifdef __i386__
@@ -24,6 +24,9 @@
 #ifdef __arm__
 #define ARCH_ARM
 #endif
+#ifdef __aarch64__
+#define ARCH_ARM64
+#endif
 #endif
 
 #ifdef _MSC_VER
@@ -45,6 +48,19 @@
 #define NOINLINE __attribute__((noinline))
 #endif
 
+#if defined(ARCH_X64) || defined(ARCH_X86)
+#include <immintrin.h>
+#define vxsort_popcnt_u32(x) _mm_popcnt_u32(x)
+#define vxsort_popcnt_u64(x) _mm_popcnt_u64(x)
+#elif defined(_MSC_VER)
+// MSVC on ARM64
+#define vxsort_popcnt_u32(x) ((int)_CountOneBits(x))
+#define vxsort_popcnt_u64(x) ((int64_t)_CountOneBits64(x))
+#else
+#define vxsort_popcnt_u32(x) ((int)__builtin_popcount(x))
+#define vxsort_popcnt_u64(x) ((int64_t)__builtin_popcountll(x))
+#endif
+
 namespace std {
 template <class _Ty>
 class numeric_limits {
@@ -70,9 +86,9 @@ public:
 template <>
 class numeric_limits<int64_t> {
    public:
-    static constexpr int64_t Max() { return 0x7fffffffffffffffi64; }
+    static constexpr int64_t Max() { return 0x7fffffffffffffffLL; }
 
-    static constexpr int64_t Min() { return -0x7fffffffffffffffi64 - 1; }
+    static constexpr int64_t Min() { return -0x7fffffffffffffffLL - 1; }
 };
 }  // namespace std
 
@@ -0,0 +1,42 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+#include "common.h"
+
+#include "vxsort_targets_enable_avx2.h"
+
+#include <immintrin.h>
+#include "do_vxsort.h"
+
+// Each iteration tests 16 card words (512 cards) with two 256-bit loads. Once
+// a block has a set card the scalar loop below finds the exact word.
+uint32_t* find_nonzero_card_word_avx2 (uint32_t* card_word, uint32_t* card_word_end)
+{
+    // card words are 4 byte aligned; walk up to a vector boundary first
+    while ((card_word < card_word_end) && (((size_t)card_word & (sizeof(__m256i) - 1)) != 0))
+    {
+        if (*card_word)
+            return card_word;
+        card_word++;
+    }
+
+    const size_t words_per_block = 2 * sizeof(__m256i) / sizeof(uint32_t);
+    while ((size_t)(card_word_end - card_word) >= words_per_block)
+    {
+        __m256i v0 = _mm256_load_si256 ((const __m256i*)card_word);
+        __m256i v1 = _mm256_load_si256 ((const __m256i*)card_word + 1);
+        __m256i v = _mm256_or_si256 (v0, v1);
+        if (!_mm256_testz_si256 (v, v))
+            break;
+        card_word += words_per_block;
+    }
+
+    while (card_word < card_word_end)
+    {
+        if (*card_word)
+            return card_word;
+        card_word++;
+    }
+    return card_word_end;
+}
+#include "vxsort_targets_disable.h"
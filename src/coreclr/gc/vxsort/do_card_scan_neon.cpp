@@ -0,0 +1,33 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+#include "common.h"
+
+#include <arm_neon.h>
+#include "do_vxsort.h"
+
+// Each iteration tests 16 card words (512 cards) with four 128-bit loads. Once
+// a block has a set card the scalar loop below finds the exact word.
+uint32_t* find_nonzero_card_word_neon (uint32_t* card_word, uint32_t* card_word_end)
+{
+    const size_t words_per_block = 4 * sizeof(uint32x4_t) / sizeof(uint32_t);
+    while ((size_t)(card_word_end - card_word) >= words_per_block)
+    {
+        uint32x4_t v0 = vld1q_u32 (card_word);
+        uint32x4_t v1 = vld1q_u32 (card_word + 4);
+        uint32x4_t v2 = vld1q_u32 (card_word + 8);
+        uint32x4_t v3 = vld1q_u32 (card_word + 12);
+        uint32x4_t v = vorrq_u32 (vorrq_u32 (v0, v1), vorrq_u32 (v2, v3));
+        if (vmaxvq_u32 (v) != 0)
+            break;
+        card_word += words_per_block;
+    }
+
+    while (card_word < card_word_end)
+    {
+        if (*card_word)
+            return card_word;
+        card_word++;
+    }
+    return card_word_end;
+}
@@ -6,6 +6,7 @@ enum class InstructionSet
 {
     AVX2 = 0,
     AVX512F = 1,
+    NEON = 2,
 };
 
 void InitSupportedInstructionSet (int32_t configSetting);
@@ -14,3 +15,10 @@ bool IsSupportedInstructionSet (InstructionSet instructionSet);
 void do_vxsort_avx2 (uint8_t** low, uint8_t** high, uint8_t *range_low, uint8_t *range_high);
 
 void do_vxsort_avx512 (uint8_t** low, uint8_t** high, uint8_t* range_low, uint8_t* range_high);
+
+void do_vxsort_neon (uint8_t** low, uint8_t** high, uint8_t* range_low, uint8_t* range_high);
+
+// Return the first non-zero card word in [card_word, card_word_end), or card_word_end if there is none
+uint32_t* find_nonzero_card_word_avx2 (uint32_t* card_word, uint32_t* card_word_end);
+
+uint32_t* find_nonzero_card_word_neon (uint32_t* card_word, uint32_t* card_word_end);
@@ -8,8 +8,6 @@
 #include "alignment.h"
 #include "machine_traits.h"
 
-#include <immintrin.h>
-
 namespace vxsort {
 
 template<typename TFrom, typename TTo, vector_machine M, int Shift = 0, int Unroll = 1, int MinLength = 1, bool RespectPackingOrder = false>
@@ -0,0 +1,23 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+#include "common.h"
+#include "bitonic_sort.NEON.int64_t.h"
+
+using namespace vxsort;
+
+void vxsort::smallsort::bitonic<int64_t, vector_machine::NEON >::sort(int64_t *ptr, size_t length) {
+    const auto v = (length + N - 1) / N;
+    if (v <= 1)
+        sort_padded<1>(ptr, length);
+    else if (v <= 2)
+        sort_padded<2>(ptr, length);
+    else if (v <= 4)
+        sort_padded<4>(ptr, length);
+    else if (v <= 8)
+        sort_padded<8>(ptr, length);
+    else {
+        assert(v <= MAX_VECTORS);
+        sort_padded<16>(ptr, length);
+    }
+}
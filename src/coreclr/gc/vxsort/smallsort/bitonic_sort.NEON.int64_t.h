@@ -0,0 +1,99 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+/////////////////////////////////////////////////////////////////////////////
+////
+// Unlike the AVX2/AVX512 variants, this file is not generated: with only two
+// 64-bit lanes per vector the network is small enough to express directly as a
+// loop nest over a fixed number of vectors, which the compiler fully unrolls.
+/////////////////////////////////////////////////////////////////////////////
+
+#ifndef BITONIC_SORT_NEON_INT64_T_H
+#define BITONIC_SORT_NEON_INT64_T_H
+
+#include <arm_neon.h>
+#include "bitonic_sort.h"
+
+namespace vxsort {
+namespace smallsort {
+
+template<> struct bitonic<int64_t, NEON> {
+    static const int N = 2;
+    static const int MAX_VECTORS = 16;
+    static constexpr int64_t MAX = std::numeric_limits<int64_t>::Max();
+public:
+
+    // lane-wise compare-exchange of two vectors: a receives the minima, b the maxima
+    static INLINE void cmp_xchg(int64x2_t& a, int64x2_t& b) {
+        uint64x2_t gt = vcgtq_s64(a, b);
+        int64x2_t min = vbslq_s64(gt, b, a);
+        int64x2_t max = vbslq_s64(gt, a, b);
+        a = min;
+        b = max;
+    }
+
+    // compare-exchange of the two lanes within a single vector
+    static INLINE void cmp_xchg_lanes(int64x2_t& d, bool ascending) {
+        int64x2_t s = vextq_s64(d, d, 1);
+        uint64x2_t gt = vcgtq_s64(d, s);
+        int64x2_t min = vbslq_s64(gt, s, d);
+        int64x2_t max = vbslq_s64(gt, d, s);
+        d = ascending ? vzip1q_s64(min, max) : vzip1q_s64(max, min);
+    }
+
+    template <int V>
+    static INLINE void sort_vectors(int64x2_t* d) {
+        static_assert((V & (V - 1)) == 0, "vector count must be a power of two");
+        const int n = V * N;
+
+        for (int k = 2; k <= n; k <<= 1) {
+            for (int j = k >> 1; j > 0; j >>= 1) {
+                if (j == 1) {
+                    for (int i = 0; i < V; i++) {
+                        cmp_xchg_lanes(d[i], ((i * N) & k) == 0);
+                    }
+                } else {
+                    const int vj = j / N;
+                    for (int i = 0; i < V; i++) {
+                        const int l = i ^ vj;
+                        if (l <= i)
+                            continue;
+                        if (((i * N) & k) == 0)
+                            cmp_xchg(d[i], d[l]);
+                        else
+                            cmp_xchg(d[l], d[i]);
+                    }
+                }
+            }
+        }
+    }
+
+    template <int V>
+    static INLINE void sort_padded(int64_t* ptr, size_t length) {
+        int64x2_t d[V];
+        const size_t full = length / N;
+
+        for (size_t i = 0; i < full; i++)
+            d[i] = vld1q_s64(ptr + i * N);
+
+        // pad the tail with MAX so it sorts to the end and is never written back
+        for (size_t i = full; i < (size_t)V; i++)
+            d[i] = vdupq_n_s64(MAX);
+        if (length % N)
+            d[full] = vsetq_lane_s64(ptr[full * N], d[full], 0);
+
+        sort_vectors<V>(d);
+
+        for (size_t i = 0; i < full; i++)
+            vst1q_s64(ptr + i * N, d[i]);
+        if (length % N)
+            ptr[full * N] = vgetq_lane_s64(d[full], 0);
+    }
+
+    static void sort(int64_t *ptr, size_t length);
+
+};
+}
+}
+
+#endif
@@ -19,6 +19,9 @@ GCSystemInfo g_SystemInfo;
 
 static size_t g_RestrictedPhysicalMemoryLimit = (size_t)UINTPTR_MAX;
 
+// Cached number of processors assigned to the current process, 0 if not computed yet
+static int g_currentProcessCpuCount = 0;
+
 static bool g_SeLockMemoryPrivilegeAcquired = false;
 
 static AffinitySet g_processAffinitySet;
@@ -548,6 +551,13 @@ void GCToOSInterface::Shutdown()
     // nothing to do.
 }
 
+// Discard the cached processor count and memory limit
+void GCToOSInterface::RefreshResourceLimits()
+{
+    VolatileStore(&g_currentProcessCpuCount, 0);
+    VolatileStore(&g_RestrictedPhysicalMemoryLimit, (size_t)UINTPTR_MAX);
+}
+
 // Get numeric id of the current thread if possible on the
 // current platform. It is indended for logging purposes only.
 // Return:
@@ -795,6 +805,21 @@ bool GCToOSInterface::VirtualReset(void * address, size_t size, bool unlock)
     return success;
 }
 
+// Ask for a virtual memory range to be backed by large pages where the OS can do that
+// without committing up front. This is only a hint, the range keeps working with normal
+// pages if no large pages are available.
+// Parameters:
+//  address - starting virtual address
+//  size    - size of the virtual memory range
+// Return:
+//  true if the OS accepted the hint, false otherwise
+bool GCToOSInterface::VirtualPreferLargePages(void* address, size_t size)
+{
+    // Windows can only map large pages when the memory is reserved and committed,
+    // see VirtualReserveAndCommitLargePages.
+    return false;
+}
+
 // Check if the OS supports write watching
 bool GCToOSInterface::SupportsWriteWatch()
 {
@@ -954,7 +979,7 @@ const AffinitySet* GCToOSInterface::SetGCThreadsAffinitySet(uintptr_t configAffi
 //  The number of processors
 uint32_t GCToOSInterface::GetCurrentProcessCpuCount()
 {
-    static int cCPUs = 0;
+    int cCPUs = VolatileLoad(&g_currentProcessCpuCount);
 
     if (cCPUs != 0)
         return cCPUs;
@@ -996,7 +1021,7 @@ uint32_t GCToOSInterface::GetCurrentProcessCpuCount()
         }
     }
 
-    cCPUs = count;
+    VolatileStore(&g_currentProcessCpuCount, count);
 
     return count;
 }
@@ -1038,6 +1063,19 @@ uint64_t GCToOSInterface::GetPhysicalMemoryLimit(bool* is_restricted)
     return memStatus.ullTotalPhys;
 }
 
+// Get the memory pressure the OS reports for the process
+// Parameters:
+//  stall_some - Hundredths of a percent of recent time in which some tasks were stalled waiting on memory.
+//  stall_full - Hundredths of a percent of recent time in which all non-idle tasks were stalled waiting on memory.
+//  high_limit - The usage, in bytes, above which the OS throttles and reclaims aggressively, or 0 if there is none.
+// Return:
+//  true if any of the above is available
+bool GCToOSInterface::GetMemoryPressure(uint32_t* stall_some, uint32_t* stall_full, uint64_t* high_limit)
+{
+    // Windows has no equivalent of stall information; job objects only have hard limits.
+    return false;
+}
+
 // Get memory status
 // Parameters:
 //  restricted_limit - The amount of physical memory in bytes that the current process is being restricted to. If non-zero, it used to calculate
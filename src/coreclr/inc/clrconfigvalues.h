@@ -129,6 +129,7 @@ RETAIL_CONFIG_DWORD_INFO(INTERNAL_JitPitchMaxVal, W("JitPitchMaxVal"), (DWORD)0x
 /// Assembly Loader
 ///
 CONFIG_DWORD_INFO(INTERNAL_GetAssemblyIfLoadedIgnoreRidMap, W("GetAssemblyIfLoadedIgnoreRidMap"), 0, "Used to force loader to ignore assemblies cached in the rid-map")
+RETAIL_CONFIG_DWORD_INFO(EXTERNAL_LoaderAllocatorTeardownBatchSize, W("LoaderAllocatorTeardownBatchSize"), 4, "Maximum number of collected collectible LoaderAllocators whose code and stubs are torn down in one pass of the finalizer thread. 0 tears them down as soon as they are collected")
 
 ///
 /// Conditional breakpoints
@@ -282,6 +283,8 @@ RETAIL_CONFIG_DWORD_INFO(UNSUPPORTED_HeapVerify, W("HeapVerify"), 0, "When set v
 RETAIL_CONFIG_DWORD_INFO(UNSUPPORTED_GCNumaAware, W("GCNumaAware"), 1, "Specifies if to enable GC NUMA aware")
 RETAIL_CONFIG_DWORD_INFO(EXTERNAL_GCCpuGroup, W("GCCpuGroup"), 0, "Specifies if to enable GC to support CPU groups")
 RETAIL_CONFIG_STRING_INFO(EXTERNAL_GCName, W("GCName"), "")
+RETAIL_CONFIG_DWORD_INFO(INTERNAL_FrozenObjectHeap, W("FrozenObjectHeap"), 1, "Allocate string literals of loader allocators that never unload on the frozen object heap, which the GC does not scan")
+RETAIL_CONFIG_DWORD_INFO(EXTERNAL_FinalizerThreadCount, W("FinalizerThreadCount"), 1, "Number of threads that run finalizers. The threads beyond the finalizer thread help running non critical finalizers when the finalization queue builds up")
 
 ///
 /// IBC
@@ -307,6 +310,7 @@ CONFIG_DWORD_INFO(INTERNAL_JitGCStress, W("JitGCStress"), 0, "GC stress mode for
 CONFIG_DWORD_INFO(INTERNAL_JitHeartbeat, W("JitHeartbeat"), 0, "")
 CONFIG_DWORD_INFO(INTERNAL_JitHelperLogging, W("JitHelperLogging"), 0, "")
 RETAIL_CONFIG_DWORD_INFO(UNSUPPORTED_JITMinOpts, W("JITMinOpts"), 0, "Forces MinOpts")
+RETAIL_CONFIG_DWORD_INFO(EXTERNAL_JitLargePageCodeHeaps, W("JitLargePageCodeHeaps"), 0, "Reserves code heaps for optimized code so that they can be backed by transparent huge pages where the OS supports it.")
 RETAIL_CONFIG_STRING_INFO(EXTERNAL_JitName, W("JitName"), "Primary Jit to use")
 #if defined(ALLOW_SXS_JIT)
 RETAIL_CONFIG_STRING_INFO(EXTERNAL_AltJitName, W("AltJitName"), "Alternative Jit to use, will fall back to primary jit.")
@@ -370,6 +374,8 @@ RETAIL_CONFIG_DWORD_INFO(UNSUPPORTED_TrackDynamicMethodDebugInfo, W("TrackDynami
 
 RETAIL_CONFIG_STRING_INFO(INTERNAL_MultiCoreJitProfile, W("MultiCoreJitProfile"), "If set, use the file to store/control multi-core JIT.")
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_MultiCoreJitProfileWriteDelay, W("MultiCoreJitProfileWriteDelay"), 12, "Set the delay after which the multi-core JIT profile will be written to disk.")
+RETAIL_CONFIG_DWORD_INFO(INTERNAL_MultiCoreJitReadyToRun, W("MultiCoreJitReadyToRun"), 0, "If set, record methods that use ReadyToRun code in the multi-core JIT profile and resolve their fixups on a background thread on playback.")
+RETAIL_CONFIG_DWORD_INFO(INTERNAL_MultiCoreJitTypeLoads, W("MultiCoreJitTypeLoads"), 0, "If set, record type loads in the multi-core JIT profile and preload the recorded types on a background thread on playback.")
 
 #endif
 
@@ -385,6 +391,7 @@ RETAIL_CONFIG_DWORD_INFO(INTERNAL_InterpreterStubMin, W("InterpreterStubMin"), 0
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_InterpreterStubMax, W("InterpreterStubMax"), UINT32_MAX, "If non-zero, only interpret methods selected by 'Interpret' whose stub number is at most this value.")
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_InterpreterJITThreshold, W("InterpreterJITThreshold"), 10, "The number of times a method should be interpreted before being JITted")
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_InterpreterDoLoopMethods, W("InterpreterDoLoopMethods"), 0, "If set, don't check for loops, start by interpreting *all* methods")
+RETAIL_CONFIG_DWORD_INFO(INTERNAL_InterpreterClassConstructors, W("InterpreterClassConstructors"), 0, "If set, interpret class constructors without JIT compiling them, whether or not they are selected by 'Interpret'")
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_InterpreterUseCaching, W("InterpreterUseCaching"), 1, "If non-zero, use the caching mechanism.")
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_InterpreterLooseRules, W("InterpreterLooseRules"), 1, "If non-zero, allow ECMA spec violations required by managed C++.")
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_InterpreterPrintPostMortem, W("InterpreterPrintPostMortem"), 0, "Prints summary information about the execution to the console")
@@ -464,6 +471,8 @@ CONFIG_STRING_INFO(INTERNAL_NgenBind_ZapForbidExcludeList, W("NgenBind_ZapForbid
 CONFIG_STRING_INFO(INTERNAL_NgenBind_ZapForbidList,        W("NgenBind_ZapForbidList"), "")
 
 CONFIG_DWORD_INFO(INTERNAL_SymDiffDump, W("SymDiffDump"), 0, "Used to create the map file while binding the assembly. Used by SemanticDiffer")
+RETAIL_CONFIG_DWORD_INFO(INTERNAL_StartupAssemblyPrefetchCount, W("StartupAssemblyPrefetchCount"), 0, "Number of TPA assemblies (or compressed bundled assemblies) to open and map in the background at startup. Zero disables prefetching.")
+RETAIL_CONFIG_DWORD_INFO(INTERNAL_StartupAssemblyPrefetchThreads, W("StartupAssemblyPrefetchThreads"), 1, "Number of background threads used by startup assembly prefetching.")
 
 ///
 /// NGEN
@@ -519,7 +528,8 @@ RETAIL_CONFIG_STRING_INFO(UNSUPPORTED_ETW_ObjectAllocationEventsPerTypePerSec, W
 RETAIL_CONFIG_DWORD_INFO(UNSUPPORTED_ProfAPI_ValidateNGENInstrumentation, W("ProfAPI_ValidateNGENInstrumentation"), 0, "This flag enables additional validations when using the IMetaDataEmit APIs for NGEN'ed images to ensure only supported edits are made.")
 
 #ifdef FEATURE_PERFMAP
-RETAIL_CONFIG_DWORD_INFO(EXTERNAL_PerfMapEnabled, W("PerfMapEnabled"), 0, "This flag is used on Linux to enable writing /tmp/perf-$pid.map. It is disabled by default")
+RETAIL_CONFIG_DWORD_INFO(EXTERNAL_PerfMapEnabled, W("PerfMapEnabled"), 0, "This flag is used on Linux to enable writing /tmp/perf-$pid.map and the perf jitdump file. 1 writes both, 2 writes only the jitdump file and 3 writes only the perf map. It is disabled by default")
+RETAIL_CONFIG_DWORD_INFO(EXTERNAL_PerfMapStubsOnly, W("PerfMapStubsOnly"), 0, "When perf map is enabled, only log stubs and skip JIT compiled and precompiled methods.")
 RETAIL_CONFIG_STRING_INFO(EXTERNAL_PerfMapJitDumpPath, W("PerfMapJitDumpPath"), "Specifies a path to write the perf jitdump file. Defaults to GetTempPathA()")
 RETAIL_CONFIG_DWORD_INFO(EXTERNAL_PerfMapIgnoreSignal, W("PerfMapIgnoreSignal"), 0, "When perf map is enabled, this option will configure the specified signal to be accepted and ignored as a marker in the perf logs.  It is disabled by default")
 RETAIL_CONFIG_DWORD_INFO(EXTERNAL_PerfMapShowOptimizationTiers, W("PerfMapShowOptimizationTiers"), 1, "Shows optimization tiers in the perf map for methods, as part of the symbol name. Useful for seeing separate stack frames for different optimization tiers of each method.")
@@ -545,6 +555,7 @@ CONFIG_DWORD_INFO(INTERNAL_DiagnosticSuspend, W("DiagnosticSuspend"), 0, "")
 CONFIG_DWORD_INFO(INTERNAL_SuspendDeadlockTimeout, W("SuspendDeadlockTimeout"), 40000, "")
 CONFIG_DWORD_INFO(INTERNAL_SuspendThreadDeadlockTimeoutMs, W("SuspendThreadDeadlockTimeoutMs"), 2000, "")
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_ThreadSuspendInjection, W("INTERNAL_ThreadSuspendInjection"), 1, "Specifies whether to inject activations for thread suspension on Unix")
+RETAIL_CONFIG_DWORD_INFO(INTERNAL_ThreadSuspendPollGracePeriodUs, W("ThreadSuspendPollGracePeriodUs"), 0, "Time in microseconds that thread suspension on Unix waits for threads to reach a JIT-emitted safepoint poll (see JitSafepointPolls) before injecting activations")
 
 ///
 /// Thread (miscellaneous)
@@ -563,6 +574,7 @@ RETAIL_CONFIG_DWORD_INFO(INTERNAL_ThreadPool_ForceMinWorkerThreads, W("ThreadPoo
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_ThreadPool_ForceMaxWorkerThreads, W("ThreadPool_ForceMaxWorkerThreads"), 0, "Overrides the MaxThreads setting for the ThreadPool worker pool")
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_ThreadPool_DisableStarvationDetection, W("ThreadPool_DisableStarvationDetection"), 0, "Disables the ThreadPool feature that forces new threads to be added when workitems run for too long")
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_ThreadPool_DebugBreakOnWorkerStarvation, W("ThreadPool_DebugBreakOnWorkerStarvation"), 0, "Breaks into the debugger if the ThreadPool detects work queue starvation")
+RETAIL_CONFIG_DWORD_INFO(INTERNAL_ThreadPool_AffinitizeWorkersToNumaNodes, W("ThreadPool_AffinitizeWorkersToNumaNodes"), 0, "Restricts each worker thread to the processors of one NUMA node, distributing workers across nodes (Windows only)")
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_ThreadPool_EnableWorkerTracking, W("ThreadPool_EnableWorkerTracking"), 0, "Enables extra expensive tracking of how many workers threads are working simultaneously")
 #ifdef TARGET_ARM64
 // Spinning scheme is currently different on ARM64, see CLRLifoSemaphore::Wait(DWORD, UINT32, UINT32)
@@ -585,6 +597,8 @@ RETAIL_CONFIG_DWORD_INFO(INTERNAL_HillClimbing_MaxSampleErrorPercent,
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_HillClimbing_SampleIntervalLow,                   W("HillClimbing_SampleIntervalLow"),                  10, "");
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_HillClimbing_SampleIntervalHigh,                  W("HillClimbing_SampleIntervalHigh"),                 200, "");
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_HillClimbing_GainExponent,                        W("HillClimbing_GainExponent"),                       200, "The exponent to apply to the gain, times 100.  100 means to use linear gain, higher values will enhance large moves and damp small ones.");
+RETAIL_CONFIG_DWORD_INFO(INTERNAL_HillClimbing_Mode,                                W("HillClimbing_Mode"),                               0, "Selects the worker thread injection controller: 0 - throughput-driven hill climbing, 1 - queue latency and blocked thread driven");
+RETAIL_CONFIG_DWORD_INFO(INTERNAL_HillClimbing_QueueLatencyTargetMs,                W("HillClimbing_QueueLatencyTargetMs"),               50, "Queue latency controller: maximum time in milliseconds that pending work may wait for a worker thread before threads are injected");
 
 ///
 /// Tiered Compilation
@@ -605,6 +619,7 @@ RETAIL_CONFIG_DWORD_INFO(INTERNAL_TC_DeleteCallCountingStubsAfter, W("TC_DeleteC
 #else
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_TC_DeleteCallCountingStubsAfter, W("TC_DeleteCallCountingStubsAfter"), 4096, "Deletes call counting stubs after this many have completed. Zero to disable deleting.")
 #endif
+RETAIL_CONFIG_DWORD_INFO(INTERNAL_TC_SeparateTier0CodeHeap, W("TC_SeparateTier0CodeHeap"), 1, "Allocates tier0 code in separate code heaps so that optimized code is packed more densely.")
 #endif // FEATURE_TIERED_COMPILATION
 
 ///
@@ -625,6 +640,8 @@ RETAIL_CONFIG_STRING_INFO(INTERNAL_PGODataPath, W("PGODataPath"), "Read/Write PG
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_ReadPGOData, W("ReadPGOData"), 0, "Read PGO data")
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_WritePGOData, W("WritePGOData"), 0, "Write PGO data")
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_TieredPGO, W("TieredPGO"), 0, "Instrument Tier0 code and make counts available to Tier1")
+RETAIL_CONFIG_DWORD_INFO(INTERNAL_ReadyToRunPGOData, W("ReadyToRunPGOData"), 1, "Use profile data embedded in ReadyToRun images when jitting at Tier1")
+RETAIL_CONFIG_DWORD_INFO(INTERNAL_TieredPGO_InstrumentOnlyHotCode, W("TieredPGO_InstrumentOnlyHotCode"), 1, "When TieredPGO is enabled, leave Tier0 code uninstrumented and instrument only methods that reach the call count threshold, in a separate tier before Tier1")
 #endif
 
 ///
@@ -648,6 +665,7 @@ CONFIG_DWORD_INFO(INTERNAL_VirtualCallStubDumpLogCounter, W("VirtualCallStubDump
 CONFIG_DWORD_INFO(INTERNAL_VirtualCallStubDumpLogIncr, W("VirtualCallStubDumpLogIncr"), 0, "Used only when STUB_LOGGING is defined, which by default is not.")
 RETAIL_CONFIG_DWORD_INFO(EXTERNAL_VirtualCallStubLogging, W("VirtualCallStubLogging"), 0, "Worth keeping, but should be moved into \"#ifdef STUB_LOGGING\" blocks. This goes for most (or all) of the stub logging infrastructure.")
 CONFIG_DWORD_INFO(INTERNAL_VirtualCallStubMissCount, W("VirtualCallStubMissCount"), 100, "Used only when STUB_LOGGING is defined, which by default is not.")
+CONFIG_DWORD_INFO(INTERNAL_VirtualCallStubPolymorphicSiteSize, W("VirtualCallStubPolymorphicSiteSize"), 3, "Maximum number of types an interface call site checks inline through chained dispatch stubs before it falls back to the shared resolve stub. 1 disables polymorphic call sites.")
 CONFIG_DWORD_INFO(INTERNAL_VirtualCallStubResetCacheCounter, W("VirtualCallStubResetCacheCounter"), 0, "Used only when STUB_LOGGING is defined, which by default is not.")
 CONFIG_DWORD_INFO(INTERNAL_VirtualCallStubResetCacheIncr, W("VirtualCallStubResetCacheIncr"), 0, "Used only when STUB_LOGGING is defined, which by default is not.")
 
@@ -680,6 +698,8 @@ RETAIL_CONFIG_STRING_INFO(EXTERNAL_ZapSet, W("ZapSet"), "")
 RETAIL_CONFIG_DWORD_INFO(EXTERNAL_ReadyToRun, W("ReadyToRun"), 1, "Enable/disable use of ReadyToRun native code") // On by default for CoreCLR
 RETAIL_CONFIG_STRING_INFO(EXTERNAL_ReadyToRunExcludeList, W("ReadyToRunExcludeList"), "List of assemblies that cannot use Ready to Run images")
 RETAIL_CONFIG_STRING_INFO(EXTERNAL_ReadyToRunLogFile, W("ReadyToRunLogFile"), "Name of file to log success/failure of using Ready to Run images")
+RETAIL_CONFIG_DWORD_INFO(INTERNAL_ReadyToRunBindCallCellsInBackground, W("ReadyToRunBindCallCellsInBackground"), 1, "When the tiering delay ends, bind the call cells of loaded ReadyToRun images whose targets already have code on the tiering background worker")
+CONFIG_DWORD_INFO(INTERNAL_ReadyToRunCompilePInvokeStubs, W("ReadyToRunCompilePInvokeStubs"), 0, "Precompile P/Invoke IL stubs into ReadyToRun images of assemblies other than System.Private.CoreLib. The image then depends on the stub shapes of the runtime it was compiled against.")
 
 #if defined(FEATURE_EVENT_TRACE) || defined(FEATURE_EVENTSOURCE_XPLAT)
 RETAIL_CONFIG_DWORD_INFO(EXTERNAL_EnableEventLog, W("EnableEventLog"), 0, "Enable/disable use of EnableEventLogging mechanism ") // Off by default
@@ -693,6 +713,7 @@ RETAIL_CONFIG_STRING_INFO(INTERNAL_EventNameFilter, W("EventNameFilter"), "")
 CONFIG_DWORD_INFO(INTERNAL_ExposeExceptionsInCOM, W("ExposeExceptionsInCOM"), 0, "")
 RETAIL_CONFIG_DWORD_INFO(UNSUPPORTED_InteropValidatePinnedObjects, W("InteropValidatePinnedObjects"), 0, "After returning from a managed-to-unmanaged interop call, validate GC heap around objects pinned by IL stubs.")
 RETAIL_CONFIG_DWORD_INFO(EXTERNAL_InteropLogArguments, W("InteropLogArguments"), 0, "Log all pinned arguments passed to an interop call")
+RETAIL_CONFIG_STRING_INFO(INTERNAL_PInvokeNoGCTransitionList, W("PInvokeNoGCTransitionList"), "Semicolon separated list of library!entrypoint native exports that are short and non-blocking. Blittable P/Invokes to them are called without a GC transition, as if marked with SuppressGCTransitionAttribute.")
 RETAIL_CONFIG_STRING_INFO(UNSUPPORTED_LogCCWRefCountChange, W("LogCCWRefCountChange"), "Outputs debug information and calls LogCCWRefCountChange_BREAKPOINT when AddRef or Release is called on a CCW.")
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_EnableRCWCleanupOnSTAShutdown, W("EnableRCWCleanupOnSTAShutdown"), 0, "Performs RCW cleanup when STA shutdown is detected using IInitializeSpy in classic processes.")
 
@@ -706,6 +727,7 @@ RETAIL_CONFIG_STRING_INFO(INTERNAL_EventPipeConfig, W("EventPipeConfig"), "Confi
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_EventPipeRundown, W("EventPipeRundown"), 1, "Enable/disable eventpipe rundown.")
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_EventPipeCircularMB, W("EventPipeCircularMB"), 1024, "The EventPipe circular buffer size in megabytes.")
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_EventPipeProcNumbers, W("EventPipeProcNumbers"), 0, "Enable/disable capturing processor numbers in EventPipe event headers")
+RETAIL_CONFIG_DWORD_INFO(INTERNAL_EventPipeAsyncSampling, W("EventPipeAsyncSampling"), 0, "Sample thread stacks by signaling each managed thread and walking its frame pointer chain instead of suspending the runtime")
 
 // 
 // Generational Aware Analysis
@@ -727,12 +749,18 @@ RETAIL_CONFIG_STRING_INFO(EXTERNAL_DOTNET_DiagnosticPorts, W("DiagnosticPorts"),
 RETAIL_CONFIG_STRING_INFO(INTERNAL_LTTngConfig, W("LTTngConfig"), "Configuration for LTTng.")
 RETAIL_CONFIG_DWORD_INFO(UNSUPPORTED_LTTng, W("LTTng"), 1, "If COMPlus_LTTng is set to 0, this will prevent the LTTng library from being loaded at runtime")
 
+//
+// Checkpoint and restore
+//
+RETAIL_CONFIG_DWORD_INFO(EXTERNAL_CheckpointRestore, W("CheckpointRestore"), 0, "Allows the process to be checkpointed and restored through the runtime checkpoint notifications, see checkpointrestore.h")
+
 
 #ifdef FEATURE_GDBJIT
 ///
 /// GDBJIT
 ///
 CONFIG_STRING_INFO(INTERNAL_GDBJitElfDump, W("GDBJitElfDump"), "Dump ELF for specified method")
+RETAIL_CONFIG_DWORD_INFO(INTERNAL_GDBJitOnDemand, W("GDBJitOnDemand"), 0, "Only generate debug info for JIT compiled methods when it is requested through the diagnostics IPC")
 #ifdef FEATURE_GDBJIT_FRAME
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_GDBJitEmitDebugFrame, W("GDBJitEmitDebugFrame"), TRUE, "Enable .debug_frame generation")
 #endif
@@ -759,6 +787,7 @@ CONFIG_DWORD_INFO(INTERNAL_CPUFamily, W("CPUFamily"), 0xFFFFFFFF, "")
 CONFIG_DWORD_INFO(INTERNAL_CPUFeatures, W("CPUFeatures"), 0xFFFFFFFF, "")
 RETAIL_CONFIG_DWORD_INFO(EXTERNAL_DisableConfigCache, W("DisableConfigCache"), 0, "Used to disable the \"probabilistic\" config cache, which walks through the appropriate config registry keys on init and probabilistically keeps track of which exist.")
 RETAIL_CONFIG_DWORD_INFO(EXTERNAL_DisableStackwalkCache, W("DisableStackwalkCache"), 0, "")
+RETAIL_CONFIG_DWORD_INFO(EXTERNAL_DisableCallSiteUnwind, W("DisableCallSiteUnwind"), 0, "Disables the direct unwind of managed frames at call sites during GC root enumeration")
 RETAIL_CONFIG_DWORD_INFO(UNSUPPORTED_DoubleArrayToLargeObjectHeap, W("DoubleArrayToLargeObjectHeap"), 0, "Controls double[] placement")
 CONFIG_STRING_INFO(INTERNAL_DumpOnClassLoad, W("DumpOnClassLoad"), "Dumps information about loaded class to log.")
 CONFIG_DWORD_INFO(INTERNAL_ExpandAllOnLoad, W("ExpandAllOnLoad"), 0, "")
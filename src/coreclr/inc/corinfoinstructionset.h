@@ -28,14 +28,15 @@ enum CORINFO_InstructionSet
     InstructionSet_Vector64=10,
     InstructionSet_Vector128=11,
     InstructionSet_Dczva=12,
-    InstructionSet_ArmBase_Arm64=13,
-    InstructionSet_AdvSimd_Arm64=14,
-    InstructionSet_Aes_Arm64=15,
-    InstructionSet_Crc32_Arm64=16,
-    InstructionSet_Dp_Arm64=17,
-    InstructionSet_Rdm_Arm64=18,
-    InstructionSet_Sha1_Arm64=19,
-    InstructionSet_Sha256_Arm64=20,
+    InstructionSet_Sve=13,
+    InstructionSet_ArmBase_Arm64=14,
+    InstructionSet_AdvSimd_Arm64=15,
+    InstructionSet_Aes_Arm64=16,
+    InstructionSet_Crc32_Arm64=17,
+    InstructionSet_Dp_Arm64=18,
+    InstructionSet_Rdm_Arm64=19,
+    InstructionSet_Sha1_Arm64=20,
+    InstructionSet_Sha256_Arm64=21,
 #endif // TARGET_ARM64
 #ifdef TARGET_AMD64
     InstructionSet_X86Base=1,
@@ -276,6 +277,8 @@ inline CORINFO_InstructionSetFlags EnsureInstructionSetFlagsAreValid(CORINFO_Ins
             resultflags.RemoveInstructionSet(InstructionSet_Sha1);
         if (resultflags.HasInstructionSet(InstructionSet_Sha256) && !resultflags.HasInstructionSet(InstructionSet_ArmBase))
             resultflags.RemoveInstructionSet(InstructionSet_Sha256);
+        if (resultflags.HasInstructionSet(InstructionSet_Sve) && !resultflags.HasInstructionSet(InstructionSet_AdvSimd))
+            resultflags.RemoveInstructionSet(InstructionSet_Sve);
 #endif // TARGET_ARM64
 #ifdef TARGET_AMD64
         if (resultflags.HasInstructionSet(InstructionSet_X86Base) && !resultflags.HasInstructionSet(InstructionSet_X86Base_X64))
@@ -460,6 +463,8 @@ inline const char *InstructionSetToString(CORINFO_InstructionSet instructionSet)
             return "Vector128";
         case InstructionSet_Dczva :
             return "Dczva";
+        case InstructionSet_Sve :
+            return "Sve";
 #endif // TARGET_ARM64
 #ifdef TARGET_AMD64
         case InstructionSet_X86Base :
@@ -4,6 +4,27 @@
 #ifndef __CORJITHOST_H__
 #define __CORJITHOST_H__
 
+// JitMethodStatistics
+//
+// Per method compilation statistics that the JIT reports through
+// `ICorJitHost::reportMethodStatistics` when `JitReportMethodStatistics` is set.
+// Phase ids are the JIT's `Phases` values (see jit/compphases.h); only phases that
+// took any time are reported. Times are in nanoseconds.
+struct JitMethodStatistics
+{
+    CORINFO_METHOD_HANDLE     method;
+    unsigned                  ilCodeSize;
+    unsigned                  nativeCodeSize;
+    unsigned long long        totalTime;
+    unsigned long long        arenaBytesAllocated;
+    unsigned long long        arenaBytesUsed;
+    unsigned                  inlineCandidates;
+    unsigned                  inlineSuccesses;
+    unsigned                  phaseCount;
+    const unsigned short*     phaseIds;
+    const unsigned long long* phaseTimes;
+};
+
 // ICorJitHost
 //
 // ICorJitHost provides the interface that the JIT uses to access some functionality that
@@ -52,6 +73,12 @@ public:
     {
         freeMemory(slab);
     }
+
+    // Report the compilation statistics of a method. The statistics are only valid for
+    // the duration of the call. Hosts that have no use for them can ignore the call.
+    virtual void reportMethodStatistics(const JitMethodStatistics* stats)
+    {
+    }
 };
 
 #endif
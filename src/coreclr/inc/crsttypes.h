@@ -52,89 +52,90 @@ enum CrstType
     CrstExecuteManRangeLock = 34,
     CrstExternalObjectContextCache = 35,
     CrstFCall = 36,
-    CrstFuncPtrStubs = 37,
-    CrstFusionAppCtx = 38,
-    CrstGCCover = 39,
-    CrstGlobalStrLiteralMap = 40,
-    CrstHandleTable = 41,
-    CrstHostAssemblyMap = 42,
-    CrstHostAssemblyMapAdd = 43,
-    CrstIbcProfile = 44,
-    CrstIJWFixupData = 45,
-    CrstIJWHash = 46,
-    CrstILStubGen = 47,
-    CrstInlineTrackingMap = 48,
-    CrstInstMethodHashTable = 49,
-    CrstInterop = 50,
-    CrstInteropData = 51,
-    CrstIsJMCMethod = 52,
-    CrstISymUnmanagedReader = 53,
-    CrstJit = 54,
-    CrstJitGenericHandleCache = 55,
-    CrstJitInlineTrackingMap = 56,
-    CrstJitPatchpoint = 57,
-    CrstJitPerf = 58,
-    CrstJumpStubCache = 59,
-    CrstLeafLock = 60,
-    CrstListLock = 61,
-    CrstLoaderAllocator = 62,
-    CrstLoaderAllocatorReferences = 63,
-    CrstLoaderHeap = 64,
-    CrstManagedObjectWrapperMap = 65,
-    CrstMethodDescBackpatchInfoTracker = 66,
-    CrstModule = 67,
-    CrstModuleFixup = 68,
-    CrstModuleLookupTable = 69,
-    CrstMulticoreJitHash = 70,
-    CrstMulticoreJitManager = 71,
-    CrstNativeImageEagerFixups = 72,
-    CrstNativeImageLoad = 73,
-    CrstNls = 74,
-    CrstNotifyGdb = 75,
-    CrstObjectList = 76,
-    CrstPEImage = 77,
-    CrstPendingTypeLoadEntry = 78,
-    CrstPgoData = 79,
-    CrstPinnedByrefValidation = 80,
-    CrstProfilerGCRefDataFreeList = 81,
-    CrstProfilingAPIStatus = 82,
-    CrstRCWCache = 83,
-    CrstRCWCleanupList = 84,
-    CrstReadyToRunEntryPointToMethodDescMap = 85,
-    CrstReflection = 86,
-    CrstReJITGlobalRequest = 87,
-    CrstRetThunkCache = 88,
-    CrstSavedExceptionInfo = 89,
-    CrstSaveModuleProfileData = 90,
-    CrstSecurityStackwalkCache = 91,
-    CrstSigConvert = 92,
-    CrstSingleUseLock = 93,
-    CrstSpecialStatics = 94,
-    CrstStackSampler = 95,
-    CrstStressLog = 96,
-    CrstStubCache = 97,
-    CrstStubDispatchCache = 98,
-    CrstStubUnwindInfoHeapSegments = 99,
-    CrstSyncBlockCache = 100,
-    CrstSyncHashLock = 101,
-    CrstSystemBaseDomain = 102,
-    CrstSystemDomain = 103,
-    CrstSystemDomainDelayedUnloadList = 104,
-    CrstThreadIdDispenser = 105,
-    CrstThreadpoolTimerQueue = 106,
-    CrstThreadpoolWaitThreads = 107,
-    CrstThreadpoolWorker = 108,
-    CrstThreadStore = 109,
-    CrstTieredCompilation = 110,
-    CrstTypeEquivalenceMap = 111,
-    CrstTypeIDMap = 112,
-    CrstUMEntryThunkCache = 113,
-    CrstUniqueStack = 114,
-    CrstUnresolvedClassLock = 115,
-    CrstUnwindInfoTableLock = 116,
-    CrstVSDIndirectionCellLock = 117,
-    CrstWrapperTemplate = 118,
-    kNumberOfCrstTypes = 119
+    CrstFrozenObjectHeap = 37,
+    CrstFuncPtrStubs = 38,
+    CrstFusionAppCtx = 39,
+    CrstGCCover = 40,
+    CrstGlobalStrLiteralMap = 41,
+    CrstHandleTable = 42,
+    CrstHostAssemblyMap = 43,
+    CrstHostAssemblyMapAdd = 44,
+    CrstIbcProfile = 45,
+    CrstIJWFixupData = 46,
+    CrstIJWHash = 47,
+    CrstILStubGen = 48,
+    CrstInlineTrackingMap = 49,
+    CrstInstMethodHashTable = 50,
+    CrstInterop = 51,
+    CrstInteropData = 52,
+    CrstIsJMCMethod = 53,
+    CrstISymUnmanagedReader = 54,
+    CrstJit = 55,
+    CrstJitGenericHandleCache = 56,
+    CrstJitInlineTrackingMap = 57,
+    CrstJitPatchpoint = 58,
+    CrstJitPerf = 59,
+    CrstJumpStubCache = 60,
+    CrstLeafLock = 61,
+    CrstListLock = 62,
+    CrstLoaderAllocator = 63,
+    CrstLoaderAllocatorReferences = 64,
+    CrstLoaderHeap = 65,
+    CrstManagedObjectWrapperMap = 66,
+    CrstMethodDescBackpatchInfoTracker = 67,
+    CrstModule = 68,
+    CrstModuleFixup = 69,
+    CrstModuleLookupTable = 70,
+    CrstMulticoreJitHash = 71,
+    CrstMulticoreJitManager = 72,
+    CrstNativeImageEagerFixups = 73,
+    CrstNativeImageLoad = 74,
+    CrstNls = 75,
+    CrstNotifyGdb = 76,
+    CrstObjectList = 77,
+    CrstPEImage = 78,
+    CrstPendingTypeLoadEntry = 79,
+    CrstPgoData = 80,
+    CrstPinnedByrefValidation = 81,
+    CrstProfilerGCRefDataFreeList = 82,
+    CrstProfilingAPIStatus = 83,
+    CrstRCWCache = 84,
+    CrstRCWCleanupList = 85,
+    CrstReadyToRunEntryPointToMethodDescMap = 86,
+    CrstReflection = 87,
+    CrstReJITGlobalRequest = 88,
+    CrstRetThunkCache = 89,
+    CrstSavedExceptionInfo = 90,
+    CrstSaveModuleProfileData = 91,
+    CrstSecurityStackwalkCache = 92,
+    CrstSigConvert = 93,
+    CrstSingleUseLock = 94,
+    CrstSpecialStatics = 95,
+    CrstStackSampler = 96,
+    CrstStressLog = 97,
+    CrstStubCache = 98,
+    CrstStubDispatchCache = 99,
+    CrstStubUnwindInfoHeapSegments = 100,
+    CrstSyncBlockCache = 101,
+    CrstSyncHashLock = 102,
+    CrstSystemBaseDomain = 103,
+    CrstSystemDomain = 104,
+    CrstSystemDomainDelayedUnloadList = 105,
+    CrstThreadIdDispenser = 106,
+    CrstThreadpoolTimerQueue = 107,
+    CrstThreadpoolWaitThreads = 108,
+    CrstThreadpoolWorker = 109,
+    CrstThreadStore = 110,
+    CrstTieredCompilation = 111,
+    CrstTypeEquivalenceMap = 112,
+    CrstTypeIDMap = 113,
+    CrstUMEntryThunkCache = 114,
+    CrstUniqueStack = 115,
+    CrstUnresolvedClassLock = 116,
+    CrstUnwindInfoTableLock = 117,
+    CrstVSDIndirectionCellLock = 118,
+    CrstWrapperTemplate = 119,
+    kNumberOfCrstTypes = 120
 };
 
 #endif // __CRST_TYPES_INCLUDED
@@ -182,6 +183,7 @@ int g_rgCrstLevelMap[] =
     0,          // CrstExecuteManRangeLock
     0,          // CrstExternalObjectContextCache
     3,          // CrstFCall
+    -1,         // CrstFrozenObjectHeap
     7,          // CrstFuncPtrStubs
     10,         // CrstFusionAppCtx
     10,         // CrstGCCover
@@ -306,6 +308,7 @@ LPCSTR g_rgCrstNameMap[] =
     "CrstExecuteManRangeLock",
     "CrstExternalObjectContextCache",
     "CrstFCall",
+    "CrstFrozenObjectHeap",
     "CrstFuncPtrStubs",
     "CrstFusionAppCtx",
     "CrstGCCover",
@@ -323,6 +323,7 @@ namespace ETW
 
         static BOOL ShouldWalkHeapObjectsForEtw();
         static BOOL ShouldWalkHeapRootsForEtw();
+        static BOOL ShouldLogHeapTypeStatisticsOnlyForEtw();
         static BOOL ShouldTrackMovementForEtw();
         static HRESULT ForceGCForDiagnostics();
         static VOID ForceGC(LONGLONG l64ClientSequenceNumber);
@@ -341,6 +342,10 @@ namespace ETW
             ULONGLONG typeID,
             ULONGLONG cRefs,
             Object ** rgObjReferenceTargets);
+        static VOID ObjectTypeStatistic(
+            ProfilerWalkHeapContext * profilerWalkHeapContext,
+            Object * pObj,
+            ULONGLONG typeID);
         static BOOL ShouldWalkStaticsAndCOMForEtw();
         static VOID WalkStaticsAndCOMForETW();
         static VOID EndHeapDump(ProfilerWalkHeapContext * profilerWalkHeapContext);
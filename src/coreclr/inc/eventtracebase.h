@@ -677,6 +677,7 @@ class CrawlFrame;
 class LoaderAllocator;
 class AssemblyLoaderAllocator;
 struct AllLoggedTypes;
+struct JitMethodStatistics;
 class CrstBase;
 class BulkTypeEventLogger;
 class TypeHandle;
@@ -930,6 +931,7 @@ namespace ETW
         static VOID MethodTableRestored(MethodTable * pMethodTable);
         static VOID DynamicMethodDestroyed(MethodDesc *pMethodDesc);
         static VOID LogMethodInstrumentationData(MethodDesc* method, uint32_t cbData, BYTE *data, TypeHandle* pTypeHandles, uint32_t typeHandles);
+        static VOID MethodJitStatistics(MethodDesc *pMethodDesc, const JitMethodStatistics *pStats);
 #else // FEATURE_EVENT_TRACE
     public:
         static VOID GetR2RGetEntryPointStart(MethodDesc *pMethodDesc) {};
@@ -942,6 +944,7 @@ namespace ETW
         static VOID MethodTableRestored(MethodTable * pMethodTable) {};
         static VOID DynamicMethodDestroyed(MethodDesc *pMethodDesc) {};
         static VOID LogMethodInstrumentationData(MethodDesc* method, uint32_t cbData, BYTE *data, TypeHandle* pTypeHandles, uint32_t typeHandles) {};
+        static VOID MethodJitStatistics(MethodDesc *pMethodDesc, const JitMethodStatistics *pStats) {};
 #endif // FEATURE_EVENT_TRACE
     };
 
@@ -192,6 +192,11 @@ enum ICodeManagerFlags
     #define MAX_PREDECODED_SLOTS 64
 #endif
 
+// The runtime caches the slot tables decoded during stack scanning, see GcSlotTableCache
+#if defined(USE_GC_INFO_DECODER) && !defined(GCINFODECODER_NO_EE) && !defined(DACCESS_COMPILE) && !defined(CROSSGEN_COMPILE)
+#define GCINFO_SLOT_TABLE_CACHE
+#endif
+
 
 
 enum GcInfoDecoderFlags
@@ -467,6 +472,72 @@ private:
     GcSlotDesc* m_pLastSlot;
 };
 
+#ifdef GCINFO_SLOT_TABLE_CACHE
+//
+// Per-thread cache of the slot tables decoded by GcInfoDecoder::EnumerateLiveSlots.
+//
+// A thread with a deep stack often has many frames of the same few methods on it, and every GC decodes
+// the slot table of each of those frames again. The cache is direct-mapped on the GC info address and
+// is only allocated for threads that actually scan stacks. Tables with more than MAX_PREDECODED_SLOTS
+// slots are not kept: the rest of such a table is decoded lazily, and only once.
+//
+// Cached tables point into the GC info of their method, so Flush has to be called whenever GC info
+// may be freed.
+//
+class GcSlotTableCache
+{
+public:
+    struct Entry
+    {
+        PTR_CBYTE       gcInfoAddress;
+        size_t          slotTableEndPos;
+        GcSlotDecoder   slotDecoder;
+    };
+
+    // Returns the entry that the slot table of gcInfoAddress maps to, or NULL if there is no cache for
+    // the current thread. The entry holds the decoded table if *pHit is set, otherwise the caller decodes
+    // into it and calls Fill once the table is known to be cacheable.
+    static Entry* GetEntry(PTR_CBYTE gcInfoAddress, bool* pHit);
+
+    static void Fill(Entry* pEntry, PTR_CBYTE gcInfoAddress, size_t slotTableEndPos)
+    {
+        LIMITED_METHOD_CONTRACT;
+
+        pEntry->gcInfoAddress = (pEntry->slotDecoder.GetNumSlots() <= MAX_PREDECODED_SLOTS) ? gcInfoAddress : NULL;
+        pEntry->slotTableEndPos = slotTableEndPos;
+    }
+
+    // Invalidates the caches of all threads
+    static void Flush();
+
+    static INT64 GetHitCount();
+    static INT64 GetMissCount();
+
+private:
+    // 32 entries are about 17KB on 64bit
+    static const DWORD CACHE_SIZE_LOG2 = 5;
+    static const DWORD CACHE_SIZE = 1 << CACHE_SIZE_LOG2;
+
+    // Per-thread hit/miss counts are added to the global counters once they reach this value
+    static const DWORD COUNT_BATCH = 1024;
+
+    struct ThreadCache
+    {
+        DWORD   flushEpoch;
+        DWORD   hitCount;
+        DWORD   missCount;
+        Entry   entries[CACHE_SIZE];
+    };
+
+    static ThreadCache* GetThreadCache();
+
+    // incremented by Flush, invalidating all thread caches
+    static Volatile<DWORD> s_flushEpoch;
+    static INT64           s_hitCount;
+    static INT64           s_missCount;
+};
+#endif // GCINFO_SLOT_TABLE_CACHE
+
 #ifdef USE_GC_INFO_DECODER
 class GcInfoDecoder
 {
@@ -588,6 +659,8 @@ private:
 
 #ifdef _DEBUG
     GcInfoDecoderFlags m_Flags;
+#endif
+#if defined(_DEBUG) || defined(GCINFO_SLOT_TABLE_CACHE)
     PTR_CBYTE m_GcInfoAddress;
 #endif
     UINT32 m_Version;
@@ -43,11 +43,11 @@ typedef const GUID *LPCGUID;
 #define GUID_DEFINED
 #endif // !GUID_DEFINED
 
-constexpr GUID JITEEVersionIdentifier = { /* 12234eca-dfc2-48bc-a320-6155cf25ce17 */
-    0x12234eca,
-    0xdfc2,
-    0x48bc,
-    {0xa3, 0x20, 0x61, 0x55, 0xcf, 0x25, 0xce, 0x17}
+constexpr GUID JITEEVersionIdentifier = { /* 3f6a9c12-7d4e-4b85-a0e9-5c1b8d27f463 */
+    0x3f6a9c12,
+    0x7d4e,
+    0x4b85,
+    {0xa0, 0xe9, 0x5c, 0x1b, 0x8d, 0x27, 0xf4, 0x63}
 };
 
 //////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -203,6 +203,11 @@
     JITHELPER(CORINFO_HELP_GETSHARED_NONGCTHREADSTATIC_BASE_NOCTOR,       JIT_GetSharedNonGCThreadStaticBase, CORINFO_HELP_SIG_REG_ONLY)
     JITHELPER(CORINFO_HELP_GETSHARED_GCTHREADSTATIC_BASE_DYNAMICCLASS,    JIT_GetSharedGCThreadStaticBaseDynamicClass, CORINFO_HELP_SIG_REG_ONLY)
     JITHELPER(CORINFO_HELP_GETSHARED_NONGCTHREADSTATIC_BASE_DYNAMICCLASS, JIT_GetSharedNonGCThreadStaticBaseDynamicClass, CORINFO_HELP_SIG_REG_ONLY)
+#ifdef FEATURE_INLINED_THREAD_STATICS
+    JITHELPER(CORINFO_HELP_GETSHARED_NONGCTHREADSTATIC_BASE_OPTIMIZED,    JIT_GetSharedNonGCThreadStaticBaseOptimized, CORINFO_HELP_SIG_REG_ONLY)
+#else
+    JITHELPER(CORINFO_HELP_GETSHARED_NONGCTHREADSTATIC_BASE_OPTIMIZED,    NULL, CORINFO_HELP_SIG_REG_ONLY)
+#endif
 
     // Debugger
     JITHELPER(CORINFO_HELP_DBG_IS_JUST_MY_CODE, JIT_DbgIsJustMyCode,CORINFO_HELP_SIG_REG_ONLY)
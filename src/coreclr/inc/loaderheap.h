@@ -144,6 +144,9 @@ struct LoaderHeapBlock
 
 struct LoaderHeapFreeBlock;
 
+// Number of exact size free lists kept for small blocks, see UnlockedLoaderHeap::m_pSmallFreeBlocks
+#define LOADER_HEAP_SMALL_FREE_LIST_COUNT 16
+
 // Collection of methods for helping in debugging heap corruptions
 #ifdef _DEBUG
 class  LoaderHeapSniffer;
@@ -214,10 +217,17 @@ private:
 
     size_t              m_dwTotalAlloc;
 
+    // Sum of m_dwTotalAlloc over all the loader heaps that are alive
+    static LONG64       s_totalCommittedBytes;
+
     DWORD                m_Options;
 
     LoaderHeapFreeBlock *m_pFirstFreeBlock;
 
+    // Freed blocks of small sizes are recycled through exact size lists, indexed by the block size in
+    // pointer-sized units. This keeps the common small allocations from walking m_pFirstFreeBlock.
+    LoaderHeapFreeBlock *m_pSmallFreeBlocks[LOADER_HEAP_SMALL_FREE_LIST_COUNT];
+
     // This is used to hold on to a block of reserved memory provided to the
     // constructor. We do this instead of adding it as the first block because
     // that requires comitting the first page of the reserved block, and for
@@ -293,6 +303,8 @@ private:
     size_t GetBytesAvailCommittedRegion();
     size_t GetBytesAvailReservedRegion();
 
+    LoaderHeapFreeBlock **GetSmallFreeList(size_t dwTotalSize);
+
 protected:
     // number of bytes available in region
     size_t UnlockedGetReservedBytesFree()
@@ -394,6 +406,14 @@ public:
         return m_dwTotalAlloc;
     }
 
+#ifndef DACCESS_COMPILE
+    static size_t GetTotalCommittedBytes()
+    {
+        LIMITED_METHOD_CONTRACT;
+        return (size_t)InterlockedCompareExchange64(&s_totalCommittedBytes, 0, 0); // prevent tearing
+    }
+#endif
+
     BOOL IsExecutable();
 
 public:
@@ -17,6 +17,10 @@ class PInvokeOverride
 public:
     static void SetPInvokeOverride(PInvokeOverrideFn* overrideImpl);
     static const void* GetMethodImpl(const char* libraryName, const char* entrypointName);
+
+    // Native exports that may be called without a GC transition (see PInvokeNoGCTransitionList)
+    static bool HasNoGCTransitionImpls();
+    static bool IsNoGCTransitionImpl(const char* libraryName, const char* entrypointName);
 };
 
 #endif // _PINVOKEOVERRIDE_H_
@@ -16,7 +16,7 @@
 
 // Keep these in sync with src/coreclr/tools/Common/Internal/Runtime/ModuleHeaders.cs
 #define READYTORUN_MAJOR_VERSION 0x0005
-#define READYTORUN_MINOR_VERSION 0x0003
+#define READYTORUN_MINOR_VERSION 0x0004
 
 #define MINIMUM_READYTORUN_MAJOR_VERSION 0x003
 
@@ -24,6 +24,7 @@
 // R2R Version 2.2 adds the ProfileDataInfo section
 // R2R Version 3.0 changes calling conventions to correctly handle explicit structures to spec.
 //     R2R 3.0 is not backward compatible with 2.x.
+// R2R Version 5.4 adds the Check_IL_Body and Verify_IL_Body fixups for cross version bubble inlining
 
 struct READYTORUN_CORE_HEADER
 {
@@ -211,6 +212,9 @@ enum ReadyToRunFixupKind
 
     READYTORUN_FIXUP_Verify_FieldOffset         = 0x31, /* Generate a runtime check to ensure that the field offset matches between compile and runtime. Unlike Check_FieldOffset, this will generate a runtime failure instead of silently dropping the method */
     READYTORUN_FIXUP_Verify_TypeLayout          = 0x32, /* Generate a runtime check to ensure that the type layout (size, alignment, HFA, reference map) matches between compile and runtime. Unlike Check_TypeLayout, this will generate a runtime failure instead of silently dropping the method */
+
+    READYTORUN_FIXUP_Check_IL_Body              = 0x33, /* Check that the IL body of a method inlined across version bubbles matches between compile and runtime. If it does not, the method is silently dropped */
+    READYTORUN_FIXUP_Verify_IL_Body             = 0x34, /* Verify that the IL body of a method inlined across version bubbles matches between compile and runtime. Unlike Check_IL_Body, this will generate a runtime failure instead of silently dropping the method */
 };
 
 //
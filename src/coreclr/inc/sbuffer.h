@@ -112,6 +112,10 @@ class SBuffer
 
     void Set(const SBuffer &buffer);
     void Set(const BYTE *buffer, COUNT_T size);
+
+    // Takes over the heap allocation of buffer when it is cheaper than copying it, buffer
+    // is left empty in that case. Otherwise this is the same as Set(buffer).
+    void Steal(SBuffer &buffer);
     void SetImmutable(const BYTE *buffer, COUNT_T size);
 
     //--------------------------------------------------------------------
@@ -238,6 +238,51 @@ inline void SBuffer::Set(const SBuffer &buffer)
     RETURN;
 }
 
+inline void SBuffer::Steal(SBuffer &buffer)
+{
+    CONTRACT_VOID
+    {
+        INSTANCE_CHECK;
+        PRECONDITION(buffer.Check());
+        PRECONDITION(!buffer.IsOpened());
+        THROWS;
+        GC_NOTRIGGER;
+    }
+    CONTRACT_END;
+
+    // Only take the block if copying would have to reallocate our own buffer; a prealloc
+    // or large enough allocation is reused as-is.
+    if (buffer.IsAllocated()
+        && &buffer != this
+        && (IsImmutable() || m_allocation < buffer.GetSize()))
+    {
+        if (IsAllocated())
+            DeleteBuffer(m_buffer, m_allocation);
+
+        m_size = buffer.m_size;
+        m_allocation = buffer.m_allocation;
+        m_buffer = buffer.m_buffer;
+        m_flags = buffer.m_flags;
+
+        buffer.m_size = 0;
+        buffer.m_allocation = 0;
+        buffer.m_buffer = NULL;
+        buffer.m_flags = 0;
+
+#if _DEBUG
+        // Both buffers changed, invalidate their iterators
+        m_revision++;
+        buffer.m_revision++;
+#endif
+    }
+    else
+    {
+        Set(buffer);
+    }
+
+    RETURN;
+}
+
 inline void SBuffer::Set(const BYTE *buffer, COUNT_T size)
 {
     CONTRACT_VOID
@@ -135,6 +135,9 @@ private:
 
     explicit SString(const SString &s);
 
+    // Moves take over the heap buffer of s and leave it empty.
+    SString(SString &&s);
+
     SString(const SString &s1, const SString &s2);
     SString(const SString &s1, const SString &s2, const SString &s3);
     SString(const SString &s1, const SString &s2, const SString &s3, const SString &s4);
@@ -158,6 +161,7 @@ private:
 
     // Set this string to the concatenation of s1,s2,s3,s4
     void Set(const SString &s);
+    void Set(SString &&s);
     void Set(const SString &s1, const SString &s2);
     void Set(const SString &s1, const SString &s2, const SString &s3);
     void Set(const SString &s1, const SString &s2, const SString &s3, const SString &s4);
@@ -689,6 +693,7 @@ private:
     WCHAR operator[](int index) const { WRAPPER_NO_CONTRACT; return Begin()[index]; }
 
     SString &operator= (const SString &s) { WRAPPER_NO_CONTRACT; Set(s); return *this; }
+    SString &operator= (SString &&s) { WRAPPER_NO_CONTRACT; Set(std::move(s)); return *this; }
     SString &operator+= (const SString &s) { WRAPPER_NO_CONTRACT; Append(s); return *this; }
 
     // -------------------------------------------------------------------
@@ -825,6 +830,13 @@ public:
         Set(s);
     }
 
+    FORCEINLINE InlineSString(SString &&s)
+      : SString(m_inline, SBUFFER_PADDED_SIZE(MEMSIZE))
+    {
+        WRAPPER_NO_CONTRACT;
+        Set(std::move(s));
+    }
+
     FORCEINLINE InlineSString(const SString &s1, const SString &s2)
       : SString(m_inline, SBUFFER_PADDED_SIZE(MEMSIZE))
     {
@@ -943,6 +955,13 @@ public:
         Set(s);
         return *this;
     }
+
+    FORCEINLINE InlineSString<MEMSIZE> &operator= (SString &&s)
+    {
+        WRAPPER_NO_CONTRACT;
+        Set(std::move(s));
+        return *this;
+    }
 };
 
 // ================================================================================
@@ -116,6 +116,23 @@ inline SString::SString(const SString &s)
     SS_RETURN;
 }
 
+inline SString::SString(SString &&s)
+  : SBuffer(Immutable, s_EmptyBuffer, sizeof(s_EmptyBuffer))
+{
+    SS_CONTRACT_VOID
+    {
+        SS_CONSTRUCTOR_CHECK;
+        PRECONDITION(s.Check());
+        THROWS;
+        GC_NOTRIGGER;
+    }
+    SS_CONTRACT_END;
+
+    Set(std::move(s));
+
+    SS_RETURN;
+}
+
 inline SString::SString(const SString &s1, const SString &s2)
   : SBuffer(Immutable, s_EmptyBuffer, sizeof(s_EmptyBuffer))
 {
@@ -474,6 +491,41 @@ inline void SString::Set(const SString &s)
     SS_RETURN;
 }
 
+//-----------------------------------------------------------------------------
+// Set this string to s, taking over its buffer where possible. s is left empty.
+//-----------------------------------------------------------------------------
+inline void SString::Set(SString &&s)
+{
+    SS_CONTRACT_VOID
+    {
+        INSTANCE_CHECK;
+        PRECONDITION(s.Check());
+        THROWS;
+        GC_NOTRIGGER;
+        SUPPORTS_DAC;
+    }
+    SS_CONTRACT_END;
+
+    if (&s != this)
+    {
+        Representation representation = s.GetRepresentation();
+        BOOL allocated = s.IsAllocated();
+
+        Steal(s);
+        SetRepresentation(representation);
+        ClearNormalized();
+
+        if (allocated && !s.IsAllocated())
+        {
+            // The buffer was taken, reset s to the shared empty string
+            s.SetImmutable(s_EmptyBuffer, sizeof(s_EmptyBuffer));
+            s.SetRepresentation(REPRESENTATION_EMPTY);
+        }
+    }
+
+    SS_RETURN;
+}
+
 //-----------------------------------------------------------------------------
 // Set this string to concatenation of s1 and s2
 //-----------------------------------------------------------------------------
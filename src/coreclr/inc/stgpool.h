@@ -335,7 +335,7 @@ public:
         UINT32              nOffset,    // Offset of blob in pool.
         MetaData::DataBlob *pData);
 
-#ifdef FEATURE_PREJIT
+#if defined(FEATURE_PREJIT) || defined(FEATURE_METADATA_HOT_DATA)
     // Initialize hot data structures.
     // Method can be called multiple time, e.g. to disable usage of hot data structures in certain scenarios
     // (see code:CMiniMd::DisableHotDataUsage).
@@ -349,7 +349,7 @@ public:
         _ASSERTE(!"InitHotData(): Not supposed to exist in RoMetaData.dll");
 #endif //!(defined(FEATURE_UTILCODE_NO_DEPENDENCIES))
     }
-#endif //FEATURE_PREJIT
+#endif //FEATURE_PREJIT || FEATURE_METADATA_HOT_DATA
 
 protected:
 
@@ -314,7 +314,7 @@ public:
     unsigned __int64 startTimeStamp;        // start time from when tick counter started
     FILETIME startTime;                     // time the application started
     SIZE_T   moduleOffset;                  // Used to compute format strings.
-#if defined(HOST_WINDOWS) && defined(HOST_64BIT)
+#if defined(HOST_64BIT) && (defined(HOST_WINDOWS) || defined(__linux__))
 #define MEMORY_MAPPED_STRESSLOG
 #endif
 
@@ -583,11 +583,24 @@ struct StressLogChunk
             return NULL;
         }
 
+#ifdef MEMORY_MAPPED_STRESSLOG
+        if (StressLog::theLog.stressLogHeader != nullptr)
+        {
+            return StressLog::AllocMemoryMapped(size);
+        }
+#endif //MEMORY_MAPPED_STRESSLOG
+
         return malloc(size);
     }
 
     void operator delete (void* chunk)
     {
+#ifdef MEMORY_MAPPED_STRESSLOG
+        // chunks in the memory mapped file are never reused
+        if (StressLog::theLog.stressLogHeader != nullptr)
+            return;
+#endif //MEMORY_MAPPED_STRESSLOG
+
         free(chunk);
     }
 #endif
@@ -713,6 +726,7 @@ public:
 
 #if defined(MEMORY_MAPPED_STRESSLOG) && !defined(STRESS_LOG_ANALYZER)
     void* __cdecl operator new(size_t n, const NoThrow&) NOEXCEPT;
+    void __cdecl operator delete(void* p);
 #endif
 
     ~ThreadStressLog ()
@@ -180,6 +180,18 @@
 
 #endif // !defined(CROSSGEN_COMPILE)
 
+// Non-GC thread statics of non-collectible types are reachable from JIT-ed code through a per-thread
+// table placed at a fixed offset from the thread pointer (initial-exec TLS, so no __tls_get_addr call).
+#if defined(TARGET_UNIX) && defined(TARGET_AMD64) && !defined(CROSSGEN_COMPILE)
+#define FEATURE_INLINED_THREAD_STATICS
+#endif
+
+// EventPipe can sample managed threads by interrupting them with the activation signal and walking
+// their frame pointer chains in the signal handler, instead of suspending the runtime.
+#if defined(FEATURE_PERFTRACING) && defined(FEATURE_HIJACK) && defined(TARGET_LINUX) && (defined(TARGET_AMD64) || defined(TARGET_ARM64)) && !defined(CROSSGEN_COMPILE)
+#define FEATURE_EVENTPIPE_ASYNC_SAMPLING
+#endif
+
 #if defined(FEATURE_INTERPRETER) && defined(CROSSGEN_COMPILE)
 #undef FEATURE_INTERPRETER
 #endif
@@ -1148,6 +1148,12 @@ DWORD_PTR GetCurrentProcessCpuMask();
 //******************************************************************************
 int GetCurrentProcessCpuCount();
 
+//******************************************************************************
+// Discards the cached processor count, so the next GetCurrentProcessCpuCount
+// detects it again
+//******************************************************************************
+void ResetCurrentProcessCpuCount();
+
 uint32_t GetOsPageSize();
 
 
@@ -2705,6 +2711,64 @@ inline ULONG HashStringA(LPCSTR szStr)
     return hash;
 }
 
+// Hash function for NUL terminated UTF-8 names, such as the strings in the metadata string heap.
+// The string is hashed eight bytes at a time, which makes it a lot faster than HashStringA for
+// typical type and member names. The hash does not depend on the alignment of the string.
+inline ULONG HashUtf8String(LPCUTF8 szStr, ULONG seed = 5381)
+{
+    LIMITED_METHOD_DAC_CONTRACT;
+
+#if BIGENDIAN
+    ULONG   hash = seed;
+    int     c;
+
+    while ((c = (BYTE)*szStr) != 0)
+    {
+        hash = ((hash << 5) + hash) ^ c;
+        ++szStr;
+    }
+    return hash;
+#else
+    const UINT64 lowBits = UI64(0x0101010101010101);
+    const UINT64 highBits = UI64(0x8080808080808080);
+    // Smallest page size of any supported platform, chunks which do not cross it can be loaded
+    // as a whole even when the terminator is in the middle of them.
+    const size_t pageSize = 0x1000;
+
+    UINT64 hash = seed;
+
+    for (;;)
+    {
+        UINT64 chunk;
+        if (((size_t)szStr & (pageSize - 1)) <= pageSize - sizeof(chunk))
+        {
+            memcpy(&chunk, szStr, sizeof(chunk));
+        }
+        else
+        {
+            chunk = 0;
+            for (size_t i = 0; (i < sizeof(chunk)) && (szStr[i] != 0); i++)
+                chunk |= (UINT64)(BYTE)szStr[i] << (i * 8);
+        }
+
+        // The lowest bit set is the high bit of the first zero byte, if any.
+        UINT64 zeroBytes = (chunk - lowBits) & ~chunk & highBits;
+        if (zeroBytes != 0)
+        {
+            DWORD index;
+            BitScanForward64(&index, zeroBytes);
+            // Drop the terminator and the bytes following it.
+            chunk &= (UI64(1) << (index & ~7)) - 1;
+            hash = (hash ^ chunk) * UI64(0x100000001B3);
+            return (ULONG)(hash ^ (hash >> 32));
+        }
+
+        hash = (hash ^ chunk) * UI64(0x100000001B3);
+        szStr += sizeof(chunk);
+    }
+#endif
+}
+
 inline ULONG HashString(LPCWSTR szStr)
 {
     LIMITED_METHOD_CONTRACT;
@@ -1257,6 +1257,9 @@ protected:
 #endif
     void genCodeForInitBlkRepStos(GenTreeBlk* initBlkNode);
     void genCodeForInitBlkUnroll(GenTreeBlk* initBlkNode);
+#ifdef TARGET_XARCH
+    unsigned genGetBlockUnrollSimdSize(unsigned size);
+#endif
     void genJumpTable(GenTree* tree);
     void genTableBasedSwitch(GenTree* tree);
     void genCodeForArrIndex(GenTreeArrIndex* treeNode);
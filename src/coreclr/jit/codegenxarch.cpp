@@ -2663,6 +2663,31 @@ void CodeGen::genCodeForInitBlkRepStos(GenTreeBlk* initBlkNode)
     instGen(INS_r_stosb);
 }
 
+//----------------------------------------------------------------------------------
+// genGetBlockUnrollSimdSize: Get the widest SIMD register size usable by an unrolled
+//    block copy or initialization of the specified size.
+//
+// Arguments:
+//    size - the size of the block
+//
+// Return Value:
+//    YMM_REGSIZE_BYTES if AVX is available and the block is at least that large,
+//    XMM_REGSIZE_BYTES otherwise.
+//
+// Notes:
+//    This must agree with LinearScan::BuildBlockStore, which marks the method as
+//    containing 256-bit AVX code so that vzeroupper is emitted in the prolog/epilog.
+//
+unsigned CodeGen::genGetBlockUnrollSimdSize(unsigned size)
+{
+    if ((size >= YMM_REGSIZE_BYTES) && compiler->compOpportunisticallyDependsOn(InstructionSet_AVX))
+    {
+        return YMM_REGSIZE_BYTES;
+    }
+
+    return XMM_REGSIZE_BYTES;
+}
+
 //----------------------------------------------------------------------------------
 // genCodeForInitBlkUnroll: Generate unrolled block initialization code.
 //
@@ -2735,16 +2760,17 @@ void CodeGen::genCodeForInitBlkUnroll(GenTreeBlk* node)
     assert(size <= INT32_MAX);
     assert(dstOffset < (INT32_MAX - static_cast<int>(size)));
 
-    // Fill as much as possible using SSE2 stores.
+    // Fill as much as possible using SSE2 stores, or AVX stores if the block is large enough.
     if (size >= XMM_REGSIZE_BYTES)
     {
         regNumber srcXmmReg = node->GetSingleTempReg(RBM_ALLFLOAT);
+        unsigned  simdSize  = genGetBlockUnrollSimdSize(size);
 
         if (src->gtSkipReloadOrCopy()->IsIntegralConst(0))
         {
             // If the source is constant 0 then always use xorps, it's faster
             // than copying the constant from a GPR to a XMM register.
-            emit->emitIns_R_R(INS_xorps, EA_16BYTE, srcXmmReg, srcXmmReg);
+            emit->emitIns_R_R(INS_xorps, EA_ATTR(simdSize), srcXmmReg, srcXmmReg);
         }
         else
         {
@@ -2754,11 +2780,22 @@ void CodeGen::genCodeForInitBlkUnroll(GenTreeBlk* node)
             // For x86, we need one more to convert it from 8 bytes to 16 bytes.
             emit->emitIns_R_R(INS_punpckldq, EA_16BYTE, srcXmmReg, srcXmmReg);
 #endif
+
+            if (simdSize == YMM_REGSIZE_BYTES)
+            {
+                // Replicate the low 16 bytes into the upper half of the YMM register.
+                emit->emitIns_R_R_R_I(INS_vinsertf128, EA_32BYTE, srcXmmReg, srcXmmReg, srcXmmReg, 0x01);
+            }
         }
 
         instruction simdMov = simdUnalignedMovIns();
-        for (unsigned regSize = XMM_REGSIZE_BYTES; size >= regSize; size -= regSize, dstOffset += regSize)
+        for (unsigned regSize = simdSize; size >= XMM_REGSIZE_BYTES; size -= regSize, dstOffset += regSize)
         {
+            while (regSize > size)
+            {
+                regSize /= 2;
+            }
+
             if (dstLclNum != BAD_VAR_NUM)
             {
                 emit->emitIns_S_R(simdMov, EA_ATTR(regSize), srcXmmReg, dstLclNum, dstOffset);
@@ -2943,9 +2980,14 @@ void CodeGen::genCodeForCpBlkUnroll(GenTreeBlk* node)
         regNumber tempReg = node->GetSingleTempReg(RBM_ALLFLOAT);
 
         instruction simdMov = simdUnalignedMovIns();
-        for (unsigned regSize = XMM_REGSIZE_BYTES; size >= regSize;
+        for (unsigned regSize = genGetBlockUnrollSimdSize(size); size >= XMM_REGSIZE_BYTES;
              size -= regSize, srcOffset += regSize, dstOffset += regSize)
         {
+            while (regSize > size)
+            {
+                regSize /= 2;
+            }
+
             if (srcLclNum != BAD_VAR_NUM)
             {
                 emit->emitIns_R_S(simdMov, EA_ATTR(regSize), tempReg, srcLclNum, srcOffset);
@@ -24,6 +24,8 @@ XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
 #include "patchpointinfo.h"
 #include "jitstd/algorithm.h"
 
+extern ICorJitHost* g_jitHost;
+
 #if defined(DEBUG)
 // Column settings for COMPlus_JitDumpIR.  We could(should) make these programmable.
 #define COLUMN_OPCODE 30
@@ -1948,6 +1950,7 @@ void Compiler::compInit(ArenaAllocator*       pAlloc,
     compTailCallUsed      = false;
     compLocallocUsed      = false;
     compLocallocOptimized = false;
+    compLocallocSeen      = false;
     compQmarkRationalized = false;
     compQmarkUsed         = false;
     compFloatingPointUsed = false;
@@ -2479,6 +2482,11 @@ void Compiler::compSetProcessor()
         instructionSetFlags.RemoveInstructionSet(InstructionSet_AdvSimd);
         instructionSetFlags.RemoveInstructionSet(InstructionSet_AdvSimd_Arm64);
     }
+
+    if (!JitConfig.EnableArm64Sve())
+    {
+        instructionSetFlags.RemoveInstructionSet(InstructionSet_Sve);
+    }
 #endif
 
     instructionSetFlags = EnsureInstructionSetFlagsAreValid(instructionSetFlags);
@@ -4415,9 +4423,69 @@ void Compiler::EndPhase(Phases phase)
     }
 #endif
 
+    if (compMethodStats != nullptr)
+    {
+        LARGE_INTEGER now;
+        (void)QueryPerformanceCounter(&now);
+        compMethodStats->phaseTicks[phase] += now.QuadPart - compMethodStats->lastPhaseEnd.QuadPart;
+        compMethodStats->lastPhaseEnd = now;
+    }
+
     mostRecentlyActivePhase = phase;
 }
 
+//------------------------------------------------------------------------
+// compReportMethodStatistics: report the phase times, arena sizes and inlining
+//    counts of the method that was just compiled to the host
+//
+// Notes:
+//    Only called for root compilations when JitReportMethodStatistics is set.
+//
+void Compiler::compReportMethodStatistics()
+{
+    assert(compMethodStats != nullptr);
+
+    LARGE_INTEGER now;
+    LARGE_INTEGER freq;
+    (void)QueryPerformanceCounter(&now);
+    if (!QueryPerformanceFrequency(&freq) || (freq.QuadPart == 0))
+    {
+        return;
+    }
+
+    const double nsPerTick  = 1000000000.0 / (double)freq.QuadPart;
+    const double totalTicks = (double)(now.QuadPart - compMethodStats->compileStart.QuadPart);
+
+    unsigned short     phaseIds[PHASE_NUMBER_OF];
+    unsigned long long phaseTimes[PHASE_NUMBER_OF];
+    unsigned           phaseCount = 0;
+
+    for (unsigned phase = 0; phase < PHASE_NUMBER_OF; phase++)
+    {
+        if (compMethodStats->phaseTicks[phase] != 0)
+        {
+            phaseIds[phaseCount]   = (unsigned short)phase;
+            phaseTimes[phaseCount] = (unsigned long long)(compMethodStats->phaseTicks[phase] * nsPerTick);
+            phaseCount++;
+        }
+    }
+
+    JitMethodStatistics stats;
+    stats.method              = info.compMethodHnd;
+    stats.ilCodeSize          = info.compILCodeSize;
+    stats.nativeCodeSize      = info.compNativeCodeSize;
+    stats.totalTime           = (unsigned long long)(totalTicks * nsPerTick);
+    stats.arenaBytesAllocated = compArenaAllocator->getTotalBytesAllocated();
+    stats.arenaBytesUsed      = compArenaAllocator->getTotalBytesUsed();
+    stats.inlineCandidates    = m_inlineStrategy->GetCandidateCount();
+    stats.inlineSuccesses     = m_inlineStrategy->GetInlineCount();
+    stats.phaseCount          = phaseCount;
+    stats.phaseIds            = phaseIds;
+    stats.phaseTimes          = phaseTimes;
+
+    g_jitHost->reportMethodStatistics(&stats);
+}
+
 //------------------------------------------------------------------------
 // compCompile: run phases needed for compilation
 //
@@ -4919,6 +4987,10 @@ void Compiler::compCompile(void** methodCodePtr, uint32_t* methodCodeSize, JitFl
         //
         DoPhase(this, PHASE_CLONE_LOOPS, &Compiler::optCloneLoops);
 
+        // Vectorize simple counted loops over arrays
+        //
+        DoPhase(this, PHASE_VECTORIZE_LOOPS, &Compiler::optVectorizeLoops);
+
         // Unroll loops
         //
         DoPhase(this, PHASE_UNROLL_LOOPS, &Compiler::optUnrollLoops);
@@ -5532,6 +5604,15 @@ int Compiler::compCompile(CORINFO_MODULE_HANDLE classPtr,
     }
 #endif // FEATURE_JIT_METHOD_PERF
 
+    compMethodStats = nullptr;
+
+    if (!compIsForInlining() && (JitConfig.JitReportMethodStatistics() != 0))
+    {
+        compMethodStats = new (this, CMK_Generic) MethodStatistics();
+        (void)QueryPerformanceCounter(&compMethodStats->compileStart);
+        compMethodStats->lastPhaseEnd = compMethodStats->compileStart;
+    }
+
 #ifdef DEBUG
     Compiler* me  = this;
     forceFrameJIT = (void*)&me; // let us see the this pointer in fastchecked build
@@ -5866,6 +5947,11 @@ void Compiler::compCompileFinish()
 
 #endif
 
+    if (compMethodStats != nullptr)
+    {
+        compReportMethodStatistics();
+    }
+
 #ifdef DEBUG
     if (opts.dspOrder)
     {
@@ -6361,6 +6447,16 @@ int Compiler::compCompileHelper(CORINFO_MODULE_HANDLE classPtr,
         // Method likely has a loop, switch to the OptimizedTier to avoid spending too much time running slower code
         fgSwitchToOptimized();
     }
+#ifdef FEATURE_ON_STACK_REPLACEMENT
+    else if (compHasBackwardJump && opts.jitFlags->IsSet(JitFlags::JIT_FLAG_TIER0) &&
+             (JitConfig.TC_OnStackReplacement() > 0) && !fgCanUsePatchpoints() && fgCanSwitchToOptimized())
+    {
+        // Method likely has a loop and relies on OSR to escape Tier0, but OSR can't handle
+        // this method (see fgTransformPatchpoints). Switch to the OptimizedTier rather than
+        // leaving the loop running Tier0 code until call counting promotes the method.
+        fgSwitchToOptimized();
+    }
+#endif // FEATURE_ON_STACK_REPLACEMENT
 
     compSetOptimizationLevel();
 
@@ -8266,8 +8362,6 @@ void JitTimer::PrintCsvHeader()
     }
 }
 
-extern ICorJitHost* g_jitHost;
-
 void JitTimer::PrintCsvMethodStats(Compiler* comp)
 {
     LPCWSTR jitTimeLogCsv = Compiler::JitTimeLogCsv();
@@ -3672,7 +3672,7 @@ public:
     void lvaUpdateClass(unsigned varNum, CORINFO_CLASS_HANDLE clsHnd, bool isExact = false);
     void lvaUpdateClass(unsigned varNum, GenTree* tree, CORINFO_CLASS_HANDLE stackHandle = nullptr);
 
-#define MAX_NumOfFieldsInPromotableStruct 4 // Maximum number of fields in promotable struct
+#define MAX_NumOfFieldsInPromotableStruct 8 // Maximum number of fields in promotable struct
 
     // Info about struct type fields.
     struct lvaStructFieldInfo
@@ -4780,6 +4780,7 @@ public:
     PhaseStatus fgTransformIndirectCalls();
 
     PhaseStatus fgTransformPatchpoints();
+    bool        fgCanUsePatchpoints();
 
     PhaseStatus fgInline();
 
@@ -4904,6 +4905,8 @@ public:
     void fgPerNodeLocalVarLiveness(GenTree* node);
     void fgPerBlockLocalVarLiveness();
 
+    void fgReportNoHeapWrites();
+
     VARSET_VALRET_TP fgGetHandlerLiveVars(BasicBlock* block);
 
     void fgLiveVarAnalysis(bool updateInternalOnly = false);
@@ -5496,6 +5499,8 @@ public:
     void fgComputeEdgeWeights();
 
     bool fgReorderBlocks();
+    bool fgCanReorderBlocksUsingProfile();
+    bool fgReorderBlocksUsingProfile();
 
     void fgDetermineFirstColdBlock();
 
@@ -6249,6 +6254,16 @@ public:
     void optCloneLoop(unsigned loopInd, LoopCloneContext* context);
     void optEnsureUniqueHead(unsigned loopInd, BasicBlock::weight_t ambientWeight);
     void optUnrollLoops(); // Unrolls loops (needs to have cost info)
+    bool optPartiallyUnrollLoop(unsigned lnum, int unrollLimitSz);
+    BasicBlock::weight_t optLoopEstimatedTripCount(unsigned lnum);
+    void optVectorizeLoops(); // Vectorizes simple counted loops over arrays
+
+#ifdef FEATURE_HW_INTRINSICS
+    bool optVectorizeLoop(unsigned lnum);
+    bool optIsVectorizableTree(GenTree* tree, unsigned iterVar, var_types elemType);
+    bool optIsVectorizableElemAddr(GenTree* addr, unsigned iterVar, var_types elemType);
+    GenTree* optVectorizeTree(GenTree* tree, var_types elemType, unsigned simdSize);
+#endif // FEATURE_HW_INTRINSICS
     void optRemoveRedundantZeroInits();
 
 protected:
@@ -8950,6 +8965,7 @@ public:
     bool compTailCallUsed;         // Does the method do a tailcall
     bool compLocallocUsed;         // Does the method use localloc.
     bool compLocallocOptimized;    // Does the method have an optimized localloc
+    bool compLocallocSeen;         // Does the method IL contain localloc (set by the IL prescan)
     bool compQmarkUsed;            // Does the method use GT_QMARK/GT_COLON
     bool compQmarkRationalized;    // Is it allowed to use a GT_QMARK/GT_COLON node.
     bool compUnsafeCastUsed;       // Does the method use LDIND/STIND to cast between scalar/refernce types
@@ -10279,6 +10295,19 @@ private:
     static LPCWSTR JitTimeLogCsv();        // Retrieve the file name for CSV from ConfigDWORD.
     static LPCWSTR compJitTimeLogFilename; // If a log file for JIT time is desired, filename to write it to.
 #endif
+
+    // Phase times collected in release builds when JitReportMethodStatistics is set.
+    // Each phase is charged the time since the end of the previous phase, like JitTimer.
+    struct MethodStatistics
+    {
+        LARGE_INTEGER    compileStart;
+        LARGE_INTEGER    lastPhaseEnd;
+        unsigned __int64 phaseTicks[PHASE_NUMBER_OF];
+    };
+
+    MethodStatistics* compMethodStats; // Non-null for root compilations reporting statistics.
+
+    void compReportMethodStatistics();
     void BeginPhase(Phases phase); // Indicate the start of the given phase.
     void EndPhase(Phases phase);   // Indicate the end of the given phase.
 
@@ -27,6 +27,7 @@ CompMemKindMacro(LSRA_RefPosition)
 CompMemKindMacro(Reachability)
 CompMemKindMacro(SSA)
 CompMemKindMacro(ValueNumber)
+CompMemKindMacro(ValueNumberMap)
 CompMemKindMacro(LvaTable)
 CompMemKindMacro(UnwindInfo)
 CompMemKindMacro(hashBv)
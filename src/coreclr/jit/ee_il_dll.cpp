@@ -250,6 +250,10 @@ void JitTls::SetCompiler(Compiler* compiler)
 // The main JIT function for the 32 bit JIT.  See code:ICorJitCompiler#EEToJitInterface for more on the EE-JIT
 // interface. Things really don't get going inside the JIT until the code:Compiler::compCompile#Phases
 // method.  Usually that is where you want to go.
+//
+// compileMethod may be called on any number of threads at once (crossgen2 compiles methods in parallel).
+// All per-compilation state lives in the Compiler instance, its arena allocator and JitTls; process-wide
+// state is either read-only after jitStartup, or updated under a lock or with interlocked operations.
 
 CorJitResult CILJit::compileMethod(ICorJitInfo*         compHnd,
                                    CORINFO_METHOD_INFO* methodInfo,
@@ -87,7 +87,7 @@ const char* emitter::emitIfName(unsigned f)
 #include "emitfmts.h"
     };
 
-    static char errBuff[32];
+    thread_local char errBuff[32];
 
     if (f < _countof(ifNames))
     {
@@ -1280,6 +1280,28 @@ void emitter::appendToCurIG(instrDesc* id)
     emitCurIGsize += id->idCodeSize();
 }
 
+//------------------------------------------------------------------------
+// emitRemoveLastInstruction: Remove the last instruction emitted to the current instruction group,
+//    so that a peephole can replace it by a combined instruction.
+//
+// Notes:
+//    The instruction must be the last one in the current group. The space of its descriptor is
+//    reused by the next instruction, and emitLastIns is cleared, so no peephole looks at it again.
+//    The caller must emit the replacement at once, so that any location captured after the removed
+//    instruction ends up right after the replacement.
+//
+void emitter::emitRemoveLastInstruction()
+{
+    assert(emitLastIns != nullptr);
+    assert(emitCurIGinsCnt > 0);
+    assert(((BYTE*)emitLastIns >= emitCurIGfreeBase) && ((BYTE*)emitLastIns < emitCurIGfreeNext));
+
+    emitCurIGinsCnt--;
+    emitCurIGsize -= emitLastIns->idCodeSize();
+    emitCurIGfreeNext = (BYTE*)emitLastIns;
+    emitLastIns       = nullptr;
+}
+
 /*****************************************************************************
  *
  *  Display (optionally) an instruction offset.
@@ -3219,8 +3241,8 @@ const char* emitter::emitFldName(CORINFO_FIELD_HANDLE fieldVal)
         const char* memberName;
         const char* className;
 
-        const int   TEMP_BUFFER_LEN = 1024;
-        static char buff[TEMP_BUFFER_LEN];
+        const int         TEMP_BUFFER_LEN = 1024;
+        thread_local char buff[TEMP_BUFFER_LEN];
 
         memberName = emitComp->eeGetFieldName(fieldVal, &className);
 
@@ -8491,18 +8513,18 @@ void emitter::emitRecordCallSite(ULONG                 instrOffset,  /* IN */
  *  Given a code offset, return a string representing a label for that offset.
  *  If the code offset is just after the end of the code of the function, the
  *  label will be "END". If the code offset doesn't correspond to any known
- *  offset, the label will be "UNKNOWN". The strings are returned from static
- *  buffers. This function rotates amongst four such static buffers (there are
+ *  offset, the label will be "UNKNOWN". The strings are returned from per-thread
+ *  buffers. This function rotates amongst four such buffers (there are
  *  cases where this function is called four times to provide data for a single
  *  printf()).
  */
 
 const char* emitter::emitOffsetToLabel(unsigned offs)
 {
-    const size_t    TEMP_BUFFER_LEN = 40;
-    static unsigned curBuf          = 0;
-    static char     buf[4][TEMP_BUFFER_LEN];
-    char*           retbuf;
+    const size_t          TEMP_BUFFER_LEN = 40;
+    thread_local unsigned curBuf          = 0;
+    thread_local char     buf[4][TEMP_BUFFER_LEN];
+    char*                 retbuf;
 
     UNATIVE_OFFSET nextof = 0;
 
@@ -1353,6 +1353,8 @@ protected:
 
     void appendToCurIG(instrDesc* id);
 
+    void emitRemoveLastInstruction();
+
     /********************************************************************************************/
 
     struct instrDescJmp : instrDesc
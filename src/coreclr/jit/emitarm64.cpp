@@ -5561,6 +5561,13 @@ void emitter::emitIns_R_R_I(
         {
             return;
         }
+
+        // Can the ldr/str be combined with the previous one?
+        if (emitComp->opts.OptimizationEnabled() && IsOptimizableLdrStrWithPair(ins, reg1, reg2, imm, size, fmt))
+        {
+            ReplaceLdrStrWithPairInstr(ins, attr, reg1, reg2, imm);
+            return;
+        }
     }
     else if (isAddSub)
     {
@@ -15651,4 +15658,137 @@ bool emitter::IsRedundantLdStr(
 
     return false;
 }
+
+//----------------------------------------------------------------------------------------
+// IsOptimizableLdrStrWithPair:
+//    For ldr/str next to each other, check if the current one and the previous one access
+//    adjacent locations off the same base register, so that both can be done by one ldp/stp.
+//
+//    ldr x1,  [x3, #8]
+//    ldr x2,  [x3, #16]    =>  ldp x1, x2, [x3, #8]
+//
+//          OR
+//
+//    str x1,  [x3, #16]
+//    str x2,  [x3, #8]     =>  stp x2, x1, [x3, #8]
+//
+// Arguments:
+//    ins  - The current instruction
+//    reg1 - The current destination (ldr) or source (str)
+//    reg2 - The current base register
+//    imm  - Immediate offset, scaled by the operand size
+//    size - Operand size
+//    fmt  - Format of instruction
+// Return Value:
+//    true if the previous instruction can be replaced by a pair instruction that also does the
+//    current one, see ReplaceLdrStrWithPairInstr.
+
+bool emitter::IsOptimizableLdrStrWithPair(
+    instruction ins, regNumber reg1, regNumber reg2, ssize_t imm, emitAttr size, insFormat fmt)
+{
+    // The previous instruction gets removed, so it has to be in the current instruction group
+    if (((ins != INS_ldr) && (ins != INS_str)) || (emitLastIns == nullptr) || (emitCurIGinsCnt == 0))
+    {
+        return false;
+    }
+
+    // Prolog and epilog instructions are each described by their own unwind codes
+    if (emitIGisInProlog(emitCurIG) || emitIGisInEpilog(emitCurIG) || emitIGisInFuncletProlog(emitCurIG) ||
+        emitIGisInFuncletEpilog(emitCurIG))
+    {
+        return false;
+    }
+
+    // Only optimize if:
+    // 1. "base" or "base plus scaled immediate offset" addressing modes.
+    // 2. General registers of 4 or 8 bytes.
+    // 3. The previous instruction is the same, with the same operand size and base register.
+    // 4. The previous instruction doesn't describe a local variable or a relocation, which
+    //    would get lost.
+    if (((fmt != IF_LS_2A) && (fmt != IF_LS_2B)) || !isGeneralRegisterOrZR(reg1) ||
+        ((size != EA_4BYTE) && (size != EA_8BYTE)))
+    {
+        return false;
+    }
+
+    insFormat lastInsFmt = emitLastIns->idInsFmt();
+    regNumber prevReg1   = emitLastIns->idReg1();
+    regNumber prevReg2   = emitLastIns->idReg2();
+
+    if ((emitLastIns->idIns() != ins) || ((lastInsFmt != IF_LS_2A) && (lastInsFmt != IF_LS_2B)) ||
+        (emitLastIns->idOpSize() != size) || (prevReg2 != reg2) || !isGeneralRegisterOrZR(prevReg1) ||
+        emitLastIns->idIsLclVar() || emitLastIns->idIsReloc())
+    {
+        return false;
+    }
+
+    ssize_t prevImm = emitLastIns->idIsLargeCns() ? ((instrDescCns*)emitLastIns)->idcCnsVal : emitLastIns->idSmallCns();
+
+    // Both immediates are in units of the operand size, and ldp/stp have a signed 7-bit scaled offset
+    if ((((imm - prevImm) != 1) && ((prevImm - imm) != 1)) || (min(imm, prevImm) > 63))
+    {
+        return false;
+    }
+
+    if (ins == INS_ldr)
+    {
+        // Make sure the first load doesn't change the base register of the second one,
+        // and that the two loads have different destinations.
+        //  ldr x0, [x0]
+        //  ldr x1, [x0, #8]  <-- can't combine because x0 is the value loaded by the previous instruction.
+        if ((prevReg1 == reg2) || (prevReg1 == reg1))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------------
+// ReplaceLdrStrWithPairInstr:
+//    Replace the previous ldr/str and the current one with an ldp/stp, after
+//    IsOptimizableLdrStrWithPair has returned true for them.
+//
+// Arguments:
+//    ins      - The current instruction
+//    reg1Attr - The attribute of the current instruction, including the GC type of reg1
+//    reg1     - The current destination (ldr) or source (str)
+//    reg2     - The current base register
+//    imm      - Immediate offset, scaled by the operand size
+
+void emitter::ReplaceLdrStrWithPairInstr(
+    instruction ins, emitAttr reg1Attr, regNumber reg1, regNumber reg2, ssize_t imm)
+{
+    regNumber prevReg1 = emitLastIns->idReg1();
+    ssize_t prevImm = emitLastIns->idIsLargeCns() ? ((instrDescCns*)emitLastIns)->idcCnsVal : emitLastIns->idSmallCns();
+
+    emitAttr prevReg1Attr = emitLastIns->idOpSize();
+    if (emitLastIns->idGCref() == GCT_GCREF)
+    {
+        prevReg1Attr = EA_GCREF;
+    }
+    else if (emitLastIns->idGCref() == GCT_BYREF)
+    {
+        prevReg1Attr = EA_BYREF;
+    }
+
+    instruction optIns  = (ins == INS_ldr) ? INS_ldp : INS_stp;
+    regNumber   baseReg = encodingZRtoSP(reg2);
+    ssize_t     offset  = min(imm, prevImm) * EA_SIZE_IN_BYTES(reg1Attr);
+
+    JITDUMP("\n -- combining '%s reg%u' and '%s reg%u' off [reg%u, #%d] into '%s'.\n", codeGen->genInsName(ins),
+            prevReg1, codeGen->genInsName(ins), reg1, baseReg, (int)offset, codeGen->genInsName(optIns));
+
+    emitRemoveLastInstruction();
+
+    if (prevImm < imm)
+    {
+        emitIns_R_R_R_I(optIns, prevReg1Attr, prevReg1, reg1, baseReg, offset, INS_OPTS_NONE, reg1Attr);
+    }
+    else
+    {
+        emitIns_R_R_R_I(optIns, reg1Attr, reg1, prevReg1, baseReg, offset, INS_OPTS_NONE, prevReg1Attr);
+    }
+}
 #endif // defined(TARGET_ARM64)
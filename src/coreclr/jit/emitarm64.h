@@ -120,6 +120,12 @@ static UINT64 Replicate_helper(UINT64 value, unsigned width, emitAttr size);
 bool IsRedundantMov(instruction ins, emitAttr size, regNumber dst, regNumber src);
 bool IsRedundantLdStr(instruction ins, regNumber reg1, regNumber reg2, ssize_t imm, emitAttr size, insFormat fmt);
 
+// Checks whether the current ldr/str and the previous one access adjacent locations off the same base
+// register, so that the two can be replaced by a single ldp/stp.
+bool IsOptimizableLdrStrWithPair(
+    instruction ins, regNumber reg1, regNumber reg2, ssize_t imm, emitAttr size, insFormat fmt);
+void ReplaceLdrStrWithPairInstr(instruction ins, emitAttr reg1Attr, regNumber reg1, regNumber reg2, ssize_t imm);
+
 /************************************************************************
 *
 * This union is used to to encode/decode the special ARM64 immediate values
@@ -5030,6 +5030,11 @@ void emitter::emitIns_R_C(instruction ins, emitAttr attr, regNumber reg, CORINFO
         if (fldHnd == FLD_GLOBAL_FS)
         {
             sz += 1;
+#ifdef TARGET_AMD64
+            // There is no RIP-relative form of fs:[ddd]; the absolute displacement needs a SIB byte.
+            assert(ins == INS_mov);
+            sz += 1;
+#endif // TARGET_AMD64
         }
     }
 
@@ -10976,6 +10981,16 @@ BYTE* emitter::emitOutputCV(BYTE* dst, instrDesc* id, code_t code, CnsVal* addc)
         {
             dst += emitOutputByte(dst, code);
         }
+#ifdef TARGET_AMD64
+        else if (fldh == FLD_GLOBAL_FS)
+        {
+            // Special case: mov reg, fs:[ddd] is encoded with rm=100 and a SIB byte with neither
+            // base nor index, as mod=00 rm=101 would make the displacement RIP-relative.
+            assert((code & 0x0700) == 0x0500);
+            dst += emitOutputWord(dst, (code & ~0x0700) | 0x0400);
+            dst += emitOutputByte(dst, 0x25);
+        }
+#endif // TARGET_AMD64
         else
         {
             dst += emitOutputWord(dst, code);
@@ -11068,9 +11083,18 @@ BYTE* emitter::emitOutputCV(BYTE* dst, instrDesc* id, code_t code, CnsVal* addc)
         }
 
 #ifdef TARGET_AMD64
-        // All static field and data section constant accesses should be marked as relocatable
-        noway_assert(id->idIsDspReloc());
-        dst += emitOutputLong(dst, 0);
+        if (fldh == FLD_GLOBAL_FS)
+        {
+            // The thread pointer relative offset is an absolute displacement
+            noway_assert(!id->idIsDspReloc());
+            dst += emitOutputLong(dst, (int)(ssize_t)target);
+        }
+        else
+        {
+            // All static field and data section constant accesses should be marked as relocatable
+            noway_assert(id->idIsDspReloc());
+            dst += emitOutputLong(dst, 0);
+        }
 #else  // TARGET_X86
         dst += emitOutputLong(dst, (int)(ssize_t)target);
 #endif // TARGET_X86
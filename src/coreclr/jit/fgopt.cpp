@@ -3726,47 +3726,137 @@ bool Compiler::fgOptimizeBranch(BasicBlock* bJump)
     return true;
 }
 
-/*****************************************************************************
- *
- *  Function called to optimize switch statements
- */
-
+//-----------------------------------------------------------------------------
+// fgOptimizeSwitchJumps: peel the dominant case of switches, based on profile data
+//
+// Returns:
+//    True if any switch was changed.
+//
+// Notes:
+//    A switch where profile data shows that a single case, other than the default,
+//    is taken most of the time gets a compare and branch to that case's target in
+//    front of it:
+//
+//        if (value == dominantCase) goto dominantTarget;
+//        switch (value) { ... }
+//
+//    so the common path is a well predicted conditional branch instead of an
+//    indirect jump, which lowering would emit for the switch. The switch itself is
+//    left as is. Its edge to the dominant target now has zero weight.
+//
+//    Cases whose target is shared with other cases are not peeled since edge
+//    weights can't tell which of the cases is dominant.
+//
 bool Compiler::fgOptimizeSwitchJumps()
 {
-    bool result = false; // Our return value
-
-#if 0
-    // TODO-CQ: Add switch jump optimizations?
-    if (!fgHasSwitch)
+    if (!fgHasSwitch || !fgHaveValidEdgeWeights)
+    {
         return false;
+    }
 
-    if (!fgHaveValidEdgeWeights)
-        return false;
+    bool modified = false;
 
-    for (BasicBlock* bSrc = fgFirstBB; bSrc != NULL; bSrc = bSrc->bbNext)
+    for (BasicBlock* block = fgFirstBB; block != nullptr; block = block->bbNext)
     {
-        if (bSrc->bbJumpKind == BBJ_SWITCH)
+        if ((block->bbJumpKind != BBJ_SWITCH) || block->isRunRarely() || !block->hasProfileWeight() ||
+            (block->bbWeight <= BB_ZERO_WEIGHT))
         {
-            unsigned        jumpCnt; jumpCnt = bSrc->bbJumpSwt->bbsCount;
-            BasicBlock**    jumpTab; jumpTab = bSrc->bbJumpSwt->bbsDstTab;
+            continue;
+        }
+
+        const unsigned     caseCount = block->bbJumpSwt->bbsCount;
+        BasicBlock** const jumpTab   = block->bbJumpSwt->bbsDstTab;
 
-            do
+        // The default case is always the last one and is already tested first by lowering.
+        assert(block->bbJumpSwt->bbsHasDefault);
+
+        unsigned             dominantCase     = caseCount;
+        BasicBlock::weight_t dominantFraction = 0;
+
+        for (unsigned i = 0; i < caseCount - 1; i++)
+        {
+            flowList* const edge = fgGetPredForBlock(jumpTab[i], block);
+            if (edge->flDupCount != 1)
             {
-                BasicBlock*   bDst       = *jumpTab;
-                flowList*     edgeToDst  = fgGetPredForBlock(bDst, bSrc);
-                double        outRatio   = (double) edgeToDst->edgeWeightMin()  / (double) bSrc->bbWeight;
+                continue;
+            }
 
-                if (outRatio >= 0.60)
-                {
-                    // straighten switch here...
-                }
+            const BasicBlock::weight_t fraction = edge->edgeWeightMin() / block->bbWeight;
+            if (fraction > dominantFraction)
+            {
+                dominantFraction = fraction;
+                dominantCase     = i;
             }
-            while (++jumpTab, --jumpCnt);
         }
+
+        if ((dominantCase == caseCount) || (dominantFraction < 0.55f))
+        {
+            continue;
+        }
+
+        // Profile counts may be slightly inconsistent, so clamp the fraction.
+        dominantFraction = min(dominantFraction, 1.0f);
+
+        BasicBlock* const dominantTarget = jumpTab[dominantCase];
+        Statement* const  switchStmt     = block->lastStmt();
+        GenTree* const    switchTree     = switchStmt->GetRootNode();
+        assert(switchTree->OperIs(GT_SWITCH));
+        GenTree* const switchValue = switchTree->AsOp()->gtGetOp1();
+
+        JITDUMP("Peeling dominant case %u (%.2f%%) of switch " FMT_BB " to " FMT_BB "\n", dominantCase,
+                100.0 * dominantFraction, block->bbNum, dominantTarget->bbNum);
+
+        // Split the block right before the switch: newBlock is the switch block and block
+        // falls into it after the compare.
+        BasicBlock* const newBlock = (block->firstStmt() == switchStmt)
+                                         ? fgSplitBlockAtBeginning(block)
+                                         : fgSplitBlockAfterStatement(block, switchStmt->GetPrevStmt());
+
+        GenTree* const   caseValue   = gtNewIconNode(dominantCase, genActualType(switchValue->TypeGet()));
+        GenTree* const   caseCompare = gtNewOperNode(GT_EQ, TYP_INT, switchValue, caseValue);
+        GenTree* const   jmpTree     = gtNewOperNode(GT_JTRUE, TYP_VOID, caseCompare);
+        Statement* const jmpStmt     = fgNewStmtFromTree(jmpTree, switchStmt->GetILOffsetX());
+        fgInsertStmtAtEnd(block, jmpStmt);
+
+        // The switch value is now evaluated by the compare; give the switch its own use of it,
+        // which spills the value to a temp if it is not a local.
+        switchTree->AsOp()->gtOp1 = fgMakeMultiUse(&caseCompare->AsOp()->gtOp1);
+
+        switchTree->gtFlags = switchTree->AsOp()->gtOp1->gtFlags & GTF_ALL_EFFECT;
+        caseCompare->gtFlags |= caseCompare->AsOp()->gtOp1->gtFlags & GTF_ALL_EFFECT;
+        caseCompare->gtFlags |= GTF_RELOP_JMP_USED | GTF_DONT_CSE;
+        jmpTree->gtFlags |= caseCompare->gtFlags & GTF_ALL_EFFECT;
+
+        if (fgStmtListThreaded)
+        {
+            gtSetStmtInfo(switchStmt);
+            fgSetStmtSeq(switchStmt);
+            gtSetStmtInfo(jmpStmt);
+            fgSetStmtSeq(jmpStmt);
+        }
+
+        block->bbJumpKind = BBJ_COND;
+        block->bbJumpDest = dominantTarget;
+
+        flowList* const blockToTargetEdge   = fgAddRefPred(dominantTarget, block);
+        flowList* const blockToNewBlockEdge = fgGetPredForBlock(newBlock, block);
+        flowList* const switchToTargetEdge  = fgGetPredForBlock(dominantTarget, newBlock);
+
+        const BasicBlock::weight_t toTargetWeight   = block->bbWeight * dominantFraction;
+        const BasicBlock::weight_t toNewBlockWeight = block->bbWeight - toTargetWeight;
+
+        newBlock->inheritWeightPercentage(block, 100 - (unsigned)(dominantFraction * 100));
+        blockToTargetEdge->setEdgeWeights(toTargetWeight, toTargetWeight, dominantTarget);
+        blockToNewBlockEdge->setEdgeWeights(toNewBlockWeight, toNewBlockWeight, newBlock);
+
+        // The peeled case was the only one leading to the target, so the switch no longer
+        // goes there in practice.
+        switchToTargetEdge->setEdgeWeights(BB_ZERO_WEIGHT, BB_ZERO_WEIGHT, dominantTarget);
+
+        modified = true;
     }
-#endif
 
-    return result;
+    return modified;
 }
 
 //-----------------------------------------------------------------------------
@@ -4142,9 +4232,6 @@ bool Compiler::fgReorderBlocks()
     //
     if (fgIsUsingProfileWeights())
     {
-        //
-        // Note that this is currently not yet implemented
-        //
         optimizedSwitches = fgOptimizeSwitchJumps();
         if (optimizedSwitches)
         {
@@ -4163,6 +4250,21 @@ bool Compiler::fgReorderBlocks()
     }
 #endif // DEBUG
 
+    // With consistent profile data, lay out the whole method based on edge weights
+    // rather than using the local heuristics below.
+    if (fgCanReorderBlocksUsingProfile())
+    {
+        movedBlocks = fgReorderBlocksUsingProfile();
+
+        const bool changed = movedBlocks || newRarelyRun || optimizedSwitches;
+        if (changed)
+        {
+            fgNeedsUpdateFlowGraph = true;
+        }
+
+        return changed;
+    }
+
     BasicBlock* bNext;
     BasicBlock* bPrev;
     BasicBlock* block;
@@ -5278,6 +5380,305 @@ bool Compiler::fgReorderBlocks()
 #pragma warning(pop)
 #endif
 
+//-----------------------------------------------------------------------------
+// fgCanReorderBlocksUsingProfile: check whether the profile driven global layout
+//     can be used instead of the local heuristics of fgReorderBlocks.
+//
+// Returns:
+//    True if the method has profile data with consistent edge weights and no EH.
+//
+// Notes:
+//    EH regions have to stay contiguous, which the chaining below knows nothing
+//    about, so methods with EH keep using the local heuristics.
+//
+bool Compiler::fgCanReorderBlocksUsingProfile()
+{
+    if (JitConfig.JitDoProfileLayout() == 0)
+    {
+        return false;
+    }
+
+    return fgIsUsingProfileWeights() && fgHaveValidEdgeWeights && fgComputePredsDone && (compHndBBtabCount == 0) &&
+           (fgFirstBB->bbNext != nullptr);
+}
+
+//-----------------------------------------------------------------------------
+// fgReorderBlocksUsingProfile: lay out the method's blocks using a global,
+//     profile driven ordering (Pettis-Hansen bottom-up chaining).
+//
+// Returns:
+//    True if the block order changed.
+//
+// Notes:
+//    Every block starts out as a chain of its own. Flow edges are then visited by
+//    decreasing weight, and an edge whose source ends a chain and whose target
+//    starts another one glues the two chains together, making the edge a fall
+//    through. The entry chain is placed first, followed by the remaining chains
+//    ordered by the weight of their first block, with chains starting with a
+//    rarely run block placed last (in their original order) so that they form
+//    the cold region fgDetermineFirstColdBlock splits off.
+//
+//    Broken fall throughs are repaired afterwards, either by reversing a
+//    conditional branch or by adding an unconditional jump.
+//
+bool Compiler::fgReorderBlocksUsingProfile()
+{
+    assert(fgCanReorderBlocksUsingProfile());
+
+#ifdef DEBUG
+    if (verbose)
+    {
+        printf("*************** In fgReorderBlocksUsingProfile()\n");
+    }
+#endif // DEBUG
+
+    struct LayoutEdge
+    {
+        BasicBlock*          src;
+        BasicBlock*          dst;
+        BasicBlock::weight_t weight;
+    };
+
+    struct LayoutEdgeCmp
+    {
+        bool operator()(const LayoutEdge& e1, const LayoutEdge& e2) const
+        {
+            if (e1.weight != e2.weight)
+            {
+                return e1.weight > e2.weight;
+            }
+
+            // Keep the sort deterministic: prefer edges that are already fall throughs, then lexical order.
+            const bool fallThrough1 = (e1.src->bbNext == e1.dst);
+            const bool fallThrough2 = (e2.src->bbNext == e2.dst);
+            if (fallThrough1 != fallThrough2)
+            {
+                return fallThrough1;
+            }
+
+            if (e1.src != e2.src)
+            {
+                return e1.src->bbNum < e2.src->bbNum;
+            }
+
+            return e1.dst->bbNum < e2.dst->bbNum;
+        }
+    };
+
+    const unsigned bbArraySize = fgBBNumMax + 1;
+
+    // Per block (indexed by bbNum): the block currently heading its chain, the next block
+    // in its chain, the last block of the chain (valid for chain heads only), the block that
+    // used to follow it if it fell through, and its original position.
+    BasicBlock** chainHead   = new (this, CMK_BasicBlock) BasicBlock*[bbArraySize]{};
+    BasicBlock** chainNext   = new (this, CMK_BasicBlock) BasicBlock*[bbArraySize]{};
+    BasicBlock** chainTail   = new (this, CMK_BasicBlock) BasicBlock*[bbArraySize]{};
+    BasicBlock** fallThrough = new (this, CMK_BasicBlock) BasicBlock*[bbArraySize]{};
+    unsigned*    position    = new (this, CMK_BasicBlock) unsigned[bbArraySize]{};
+
+    unsigned blockCount = 0;
+    unsigned edgeCount  = 0;
+
+    for (BasicBlock* block = fgFirstBB; block != nullptr; block = block->bbNext)
+    {
+        chainHead[block->bbNum] = block;
+        chainTail[block->bbNum] = block;
+        position[block->bbNum]  = blockCount++;
+
+        if (block->bbFallsThrough())
+        {
+            fallThrough[block->bbNum] = block->bbNext;
+        }
+
+        edgeCount += block->NumSucc(this);
+    }
+
+    LayoutEdge* edges    = new (this, CMK_BasicBlock) LayoutEdge[max(edgeCount, 1u)];
+    unsigned    numEdges = 0;
+
+    for (BasicBlock* block = fgFirstBB; block != nullptr; block = block->bbNext)
+    {
+        // Only these kinds can be made to fall through to a successor of our choice.
+        if ((block->bbJumpKind != BBJ_NONE) && (block->bbJumpKind != BBJ_ALWAYS) && (block->bbJumpKind != BBJ_COND))
+        {
+            continue;
+        }
+
+        if ((block->bbFlags & BBF_KEEP_BBJ_ALWAYS) != 0)
+        {
+            continue;
+        }
+
+        const unsigned numSucc = block->NumSucc(this);
+        for (unsigned i = 0; i < numSucc; i++)
+        {
+            BasicBlock* const succ = block->GetSucc(i, this);
+
+            // The entry block has to stay first.
+            if ((succ == block) || (succ == fgFirstBB))
+            {
+                continue;
+            }
+
+            flowList* const edge = fgGetPredForBlock(succ, block);
+            noway_assert(edge != nullptr);
+
+            const BasicBlock::weight_t weight = (edge->edgeWeightMin() + edge->edgeWeightMax()) / 2;
+            if (weight <= BB_ZERO_WEIGHT)
+            {
+                continue;
+            }
+
+            assert(numEdges < edgeCount);
+            edges[numEdges++] = {block, succ, weight};
+        }
+    }
+
+    jitstd::sort(edges, edges + numEdges, LayoutEdgeCmp());
+
+    for (unsigned i = 0; i < numEdges; i++)
+    {
+        BasicBlock* const src = edges[i].src;
+        BasicBlock* const dst = edges[i].dst;
+
+        BasicBlock* const srcHead = chainHead[src->bbNum];
+
+        if ((chainTail[srcHead->bbNum] != src) || (chainHead[dst->bbNum] != dst) || (srcHead == dst))
+        {
+            continue;
+        }
+
+        JITDUMP("Chaining " FMT_BB " -> " FMT_BB " (weight " FMT_WT ")\n", src->bbNum, dst->bbNum, edges[i].weight);
+
+        chainNext[src->bbNum]     = dst;
+        chainTail[srcHead->bbNum] = chainTail[dst->bbNum];
+
+        for (BasicBlock* b = dst; b != nullptr; b = chainNext[b->bbNum])
+        {
+            chainHead[b->bbNum] = srcHead;
+        }
+    }
+
+    // Collect the chain heads, entry chain first.
+    BasicBlock** heads    = new (this, CMK_BasicBlock) BasicBlock*[blockCount];
+    unsigned     numHeads = 0;
+
+    for (BasicBlock* block = fgFirstBB; block != nullptr; block = block->bbNext)
+    {
+        if (chainHead[block->bbNum] == block)
+        {
+            heads[numHeads++] = block;
+        }
+    }
+
+    assert(heads[0] == fgFirstBB);
+
+    struct LayoutChainCmp
+    {
+        const unsigned* m_position;
+
+        LayoutChainCmp(const unsigned* position) : m_position(position)
+        {
+        }
+
+        bool operator()(BasicBlock* h1, BasicBlock* h2) const
+        {
+            const bool rare1 = h1->isRunRarely();
+            const bool rare2 = h2->isRunRarely();
+
+            if (rare1 != rare2)
+            {
+                return rare2;
+            }
+
+            if (!rare1 && (h1->bbWeight != h2->bbWeight))
+            {
+                return h1->bbWeight > h2->bbWeight;
+            }
+
+            return m_position[h1->bbNum] < m_position[h2->bbNum];
+        }
+    };
+
+    jitstd::sort(heads + 1, heads + numHeads, LayoutChainCmp(position));
+
+    // Relink the blocks in chain order.
+    BasicBlock** order    = new (this, CMK_BasicBlock) BasicBlock*[blockCount];
+    unsigned     numOrder = 0;
+    bool         moved    = false;
+
+    for (unsigned i = 0; i < numHeads; i++)
+    {
+        for (BasicBlock* b = heads[i]; b != nullptr; b = chainNext[b->bbNum])
+        {
+            moved |= (position[b->bbNum] != numOrder);
+            order[numOrder++] = b;
+        }
+    }
+
+    noway_assert(numOrder == blockCount);
+
+    if (!moved)
+    {
+        JITDUMP("Profile driven layout kept the original block order\n");
+        return false;
+    }
+
+    order[0]->bbPrev = nullptr;
+    for (unsigned i = 0; i + 1 < numOrder; i++)
+    {
+        order[i]->setNext(order[i + 1]);
+    }
+    order[numOrder - 1]->bbNext = nullptr;
+    fgLastBB                    = order[numOrder - 1];
+
+    // Repair the fall throughs the new order broke.
+    for (unsigned i = 0; i < numOrder; i++)
+    {
+        BasicBlock* const block   = order[i];
+        BasicBlock* const oldNext = fallThrough[block->bbNum];
+
+        if ((oldNext == nullptr) || (block->bbNext == oldNext))
+        {
+            continue;
+        }
+
+        if ((block->bbJumpKind == BBJ_COND) && (block->bbNext == block->bbJumpDest))
+        {
+            // The taken target now follows, so branch to the old fall through instead.
+            Statement* const condTestStmt = block->lastStmt();
+            GenTree* const   condTest     = condTestStmt->GetRootNode();
+            noway_assert(condTest->gtOper == GT_JTRUE);
+
+            condTest->AsOp()->gtOp1 = gtReverseCond(condTest->AsOp()->gtOp1);
+            block->bbJumpDest       = oldNext;
+
+            JITDUMP("Reversed conditional jump at " FMT_BB " to target " FMT_BB "\n", block->bbNum, oldNext->bbNum);
+        }
+        else
+        {
+            fgConnectFallThrough(block, oldNext);
+        }
+    }
+
+#ifdef DEBUG
+    if (verbose)
+    {
+        printf("\nAfter fgReorderBlocksUsingProfile the BB graph is:");
+        fgDispBasicBlocks(verboseTrees);
+        printf("\n");
+    }
+
+    // Make sure that the predecessor lists are accurate
+    if (expensiveDebugCheckLevel >= 2)
+    {
+        fgDebugCheckBBlist();
+    }
+#endif // DEBUG
+
+    return true;
+}
+
 //-------------------------------------------------------------
 // fgUpdateFlowGraph: Removes any empty blocks, unreachable blocks, and redundant jumps.
 // Most of those appear after dead store removal and folding of conditionals.
@@ -52,6 +52,46 @@ static bool blockNeedsGCPoll(BasicBlock* block)
     return blockMayNeedGCPoll;
 }
 
+//------------------------------------------------------------------------
+// blockNeedsSafepointPoll: Determine whether the block needs a GC poll when
+//                          safepoint polls are enabled (JitSafepointPolls)
+//
+// Arguments:
+//   block         - the block to check
+//
+// Notes:
+//    With safepoint polls the runtime can bring a thread running managed code to
+//    a GC safe point just by setting the trap flag, without interrupting it. For
+//    that, every path that can run for an unbounded time has to reach a poll:
+//    loop back-edges cover long running loops, and method returns cover deep or
+//    recursive call chains.
+//
+// Returns:
+//    Whether the GC poll needs to be inserted after the block
+//
+static bool blockNeedsSafepointPoll(BasicBlock* block)
+{
+    switch (block->bbJumpKind)
+    {
+        case BBJ_RETURN:
+            return true;
+
+        case BBJ_ALWAYS:
+            // The tail of a BBJ_CALLFINALLY pair must stay empty.
+            if (block->isBBCallAlwaysPairTail())
+            {
+                return false;
+            }
+            FALLTHROUGH;
+
+        case BBJ_COND:
+            return block->bbJumpDest->bbNum <= block->bbNum;
+
+        default:
+            return false;
+    }
+}
+
 //------------------------------------------------------------------------------
 // fgInsertGCPolls : Insert GC polls for basic blocks containing calls to methods
 //                   with SuppressGCTransitionAttribute.
@@ -64,6 +104,9 @@ static bool blockNeedsGCPoll(BasicBlock* block)
 //    This must be done after any transformations that would add control flow between
 //    calls.
 //
+//    When JitSafepointPolls is set, loop back-edges and method returns get polls too;
+//    see blockNeedsSafepointPoll.
+//
 // Returns:
 //    PhaseStatus indicating what, if anything, was changed.
 //
@@ -72,7 +115,11 @@ PhaseStatus Compiler::fgInsertGCPolls()
 {
     PhaseStatus result = PhaseStatus::MODIFIED_NOTHING;
 
-    if ((optMethodFlags & OMF_NEEDS_GCPOLLS) == 0)
+    // Safepoint polls are only useful to the runtime that is about to run the code.
+    const bool safepointPolls =
+        (JitConfig.JitSafepointPolls() != 0) && !opts.jitFlags->IsSet(JitFlags::JIT_FLAG_PREJIT);
+
+    if (((optMethodFlags & OMF_NEEDS_GCPOLLS) == 0) && !safepointPolls)
     {
         return result;
     }
@@ -95,7 +142,13 @@ PhaseStatus Compiler::fgInsertGCPolls()
     {
         // When optimizations are enabled, we can't rely on BBF_HAS_SUPPRESSGC_CALL flag:
         // the call could've been moved, e.g., hoisted from a loop, CSE'd, etc.
-        if (opts.OptimizationDisabled() ? ((block->bbFlags & BBF_HAS_SUPPRESSGC_CALL) == 0) : !blockNeedsGCPoll(block))
+        bool needsPoll = false;
+        if ((optMethodFlags & OMF_NEEDS_GCPOLLS) != 0)
+        {
+            needsPoll = opts.OptimizationDisabled() ? ((block->bbFlags & BBF_HAS_SUPPRESSGC_CALL) != 0)
+                                                    : blockNeedsGCPoll(block);
+        }
+        if (!needsPoll && !(safepointPolls && blockNeedsSafepointPoll(block)))
         {
             continue;
         }
@@ -4235,6 +4235,7 @@ struct GenTreeCall final : public GenTree
 #define GTF_CALL_M_EXP_RUNTIME_LOOKUP      0x01000000 // GT_CALL -- this call needs to be tranformed into CFG for the dynamic dictionary expansion feature.
 #define GTF_CALL_M_STRESS_TAILCALL         0x02000000 // GT_CALL -- the call is NOT "tail" prefixed but GTF_CALL_M_EXPLICIT_TAILCALL was added because of tail call stress mode
 #define GTF_CALL_M_EXPANDED_EARLY          0x04000000 // GT_CALL -- the Virtual Call target address is expanded and placed in gtControlExpr in Morph rather than in Lower
+#define GTF_CALL_M_NO_HEAP_WRITES          0x08000000 // GT_CALL -- the callee is known not to write to GcHeap/ByrefExposed memory
 
     // clang-format on
 
@@ -4496,6 +4497,11 @@ struct GenTreeCall final : public GenTree
         return (gtCallMoreFlags & GTF_CALL_M_DEVIRTUALIZED) != 0;
     }
 
+    bool HasNoHeapWrites() const
+    {
+        return (gtCallMoreFlags & GTF_CALL_M_NO_HEAP_WRITES) != 0;
+    }
+
     bool IsGuarded() const
     {
         return (gtCallMoreFlags & GTF_CALL_M_GUARDED) != 0;
@@ -7511,6 +7511,14 @@ GenTree* Compiler::impImportStaticFieldAccess(CORINFO_RESOLVED_TOKEN* pResolvedT
 
             op1 = gtNewHelperCallNode(pFieldInfo->helper, type, gtNewCallArgs(op1));
 
+            // As with the non-generic shared statics helpers (see fgGetStaticsCCtorHelper), the class
+            // constructor of a beforefieldinit class may run at any point before the first static
+            // access, so the helper call can be hoisted out of loops and CSE'd with other accesses.
+            if (info.compCompHnd->getClassAttribs(pResolvedToken->hClass) & CORINFO_FLG_BEFOREFIELDINIT)
+            {
+                op1->gtFlags |= GTF_CALL_HOISTABLE;
+            }
+
             FieldSeqNode* fs = GetFieldSeqStore()->CreateSingleton(pResolvedToken->hField);
             op1              = gtNewOperNode(GT_ADD, type, op1,
                                 new (this, GT_CNS_INT) GenTreeIntCon(TYP_I_IMPL, pFieldInfo->offset, fs));
@@ -7548,6 +7556,44 @@ GenTree* Compiler::impImportStaticFieldAccess(CORINFO_RESOLVED_TOKEN* pResolvedT
             break;
         }
 
+        case CORINFO_FIELD_STATIC_TLS_MANAGED:
+        {
+            // The EE caches the non-GC thread statics base of the class in a slot at a fixed offset
+            // from the thread pointer. The slot is only empty the first time the class is accessed
+            // on a given thread, in which case the helper computes the base and populates the slot.
+            GenTreeCall::Use* args = gtNewCallArgs(gtNewIconNode(pFieldInfo->threadStaticSlotOffset));
+            op1                    = gtNewHelperCallNode(pFieldInfo->helper, TYP_I_IMPL, args);
+
+#ifdef TARGET_AMD64
+            impSpillSideEffects(true, CHECK_SPILL_ALL DEBUGARG("bubbling QMark for thread static base"));
+
+            // slot = fs:[threadStaticSlotOffset]
+            GenTree* slot =
+                gtNewIconHandleNode((size_t)(ssize_t)pFieldInfo->threadStaticSlotOffset, GTF_ICON_TLS_HDL);
+            slot = gtNewOperNode(GT_IND, TYP_I_IMPL, slot);
+            slot->gtFlags |= GTF_IND_NONFAULTING;
+
+            unsigned slotLclNum = lvaGrabTemp(true DEBUGARG("thread static base slot"));
+            impAssignTempGen(slotLclNum, slot, (unsigned)CHECK_SPILL_NONE);
+
+            // base = (slot != 0) ? slot : helper(threadStaticSlotOffset)
+            GenTree* nullCheck =
+                gtNewOperNode(GT_NE, TYP_INT, gtNewLclvNode(slotLclNum, TYP_I_IMPL), gtNewIconNode(0, TYP_I_IMPL));
+            GenTreeColon* colon =
+                new (this, GT_COLON) GenTreeColon(TYP_I_IMPL, gtNewLclvNode(slotLclNum, TYP_I_IMPL), op1);
+            GenTree* qmark = gtNewQmarkNode(TYP_I_IMPL, nullCheck, colon);
+
+            unsigned baseLclNum = lvaGrabTemp(true DEBUGARG("thread static base"));
+            impAssignTempGen(baseLclNum, qmark, (unsigned)CHECK_SPILL_NONE);
+            op1 = gtNewLclvNode(baseLclNum, TYP_I_IMPL);
+#endif // TARGET_AMD64
+
+            FieldSeqNode* fs = GetFieldSeqStore()->CreateSingleton(pResolvedToken->hField);
+            op1              = gtNewOperNode(GT_ADD, TYP_I_IMPL, op1,
+                                new (this, GT_CNS_INT) GenTreeIntCon(TYP_I_IMPL, pFieldInfo->offset, fs));
+            break;
+        }
+
         case CORINFO_FIELD_STATIC_READYTORUN_HELPER:
         {
 #ifdef FEATURE_READYTORUN_COMPILER
@@ -8415,6 +8461,14 @@ var_types Compiler::impImportCall(OPCODE                  opcode,
             call->AsCall()->gtCallMoreFlags |= GTF_CALL_M_NOGCCHECK;
         }
 
+        // Direct calls to methods previously found not to write to the heap can be
+        // treated as heap readers only.
+        if ((mflags & CORINFO_FLG_NO_HEAP_WRITES) && (call->AsCall()->gtCallType == CT_USER_FUNC) &&
+            !call->AsCall()->IsVirtual() && (JitConfig.JitEnableNoHeapWritesSummary() != 0))
+        {
+            call->AsCall()->gtCallMoreFlags |= GTF_CALL_M_NO_HEAP_WRITES;
+        }
+
         // Mark call if it's one of the ones we will maybe treat as an intrinsic
         if (isSpecialIntrinsic)
         {
@@ -14786,6 +14840,7 @@ void Compiler::impImportBlockCode(BasicBlock* block)
                     case CORINFO_FIELD_STATIC_RVA_ADDRESS:
                     case CORINFO_FIELD_STATIC_SHARED_STATIC_HELPER:
                     case CORINFO_FIELD_STATIC_GENERICS_STATIC_HELPER:
+                    case CORINFO_FIELD_STATIC_TLS_MANAGED:
                     case CORINFO_FIELD_STATIC_READYTORUN_HELPER:
                         op1 = impImportStaticFieldAccess(&resolvedToken, (CORINFO_ACCESS_FLAGS)aflags, &fieldInfo,
                                                          lclTyp);
@@ -15056,6 +15111,17 @@ void Compiler::impImportBlockCode(BasicBlock* block)
                                                clsHnd, op2);
                         goto SPILL_APPEND;
 
+                    case CORINFO_FIELD_STATIC_TLS_MANAGED:
+                        // The thread statics base is computed by statements appended ahead of the store,
+                        // so evaluate the value being stored first to keep side effects in order.
+                        if ((op2->gtFlags & GTF_SIDE_EFFECT) != 0)
+                        {
+                            unsigned valueLclNum = lvaGrabTemp(true DEBUGARG("stsfld thread static value"));
+                            impAssignTempGen(valueLclNum, op2, (unsigned)CHECK_SPILL_ALL);
+                            op2 = gtNewLclvNode(valueLclNum, lvaTable[valueLclNum].TypeGet());
+                        }
+                        FALLTHROUGH;
+
                     case CORINFO_FIELD_STATIC_ADDRESS:
                     case CORINFO_FIELD_STATIC_RVA_ADDRESS:
                     case CORINFO_FIELD_STATIC_SHARED_STATIC_HELPER:
@@ -19161,6 +19227,7 @@ void Compiler::impCheckCanInline(GenTreeCall*           call,
                 pInfo->guardedClassHandle  = nullptr;
                 pInfo->guardedMethodHandle = nullptr;
                 pInfo->stubAddr            = nullptr;
+                pInfo->nextGuess           = nullptr;
             }
 
             pInfo->methInfo                       = methInfo;
@@ -20144,10 +20211,57 @@ void Compiler::impMarkInlineCandidate(GenTree*               callNode,
     // Do the actual evaluation
     impMarkInlineCandidateHelper(call, exactContextHnd, exactContextNeedsRuntimeLookup, callInfo);
 
-    // If this call is an inline candidate or is not a guarded devirtualization
-    // candidate, we're done.
-    if (call->IsInlineCandidate() || !call->IsGuardedDevirtualizationCandidate())
+    // If this call is not a guarded devirtualization candidate, we're done.
+    if (!call->IsGuardedDevirtualizationCandidate())
+    {
+        return;
+    }
+
+    // If there are further guesses, evaluate each of them in turn, and keep
+    // only those whose target method we can inline.
+    //
+    InlineCandidateInfo* firstGuess = call->IsInlineCandidate() ? call->gtInlineCandidateInfo : nullptr;
+    InlineCandidateInfo* lastGuess  = firstGuess;
+    InlineCandidateInfo* guess      = call->gtInlineCandidateInfo->nextGuess;
+
+    call->gtInlineCandidateInfo->nextGuess = nullptr;
+
+    while (guess != nullptr)
+    {
+        InlineCandidateInfo* const followingGuess = guess->nextGuess;
+        guess->nextGuess                          = nullptr;
+
+        call->gtInlineCandidateInfo = guess;
+        call->gtFlags &= ~GTF_CALL_INLINE_CANDIDATE;
+        impMarkInlineCandidateHelper(call, exactContextHnd, exactContextNeedsRuntimeLookup, callInfo);
+
+        if (call->IsInlineCandidate())
+        {
+            if (lastGuess == nullptr)
+            {
+                firstGuess = guess;
+            }
+            else
+            {
+                lastGuess->nextGuess = guess;
+            }
+
+            lastGuess = guess;
+        }
+        else
+        {
+            JITDUMP("Dropping guess for class %s from guarded devirtualization chain for call [%06u]: target "
+                    "method can't be inlined\n",
+                    eeGetClassName(guess->guardedClassHandle), dspTreeID(call));
+        }
+
+        guess = followingGuess;
+    }
+
+    if (firstGuess != nullptr)
     {
+        call->gtInlineCandidateInfo = firstGuess;
+        call->gtFlags |= GTF_CALL_INLINE_CANDIDATE;
         return;
     }
 
@@ -20915,6 +21029,11 @@ void Compiler::impDevirtualizeCall(GenTreeCall*            call,
     call->gtCallType    = CT_USER_FUNC;
     call->gtCallMoreFlags |= GTF_CALL_M_DEVIRTUALIZED;
 
+    if ((derivedMethodAttribs & CORINFO_FLG_NO_HEAP_WRITES) && (JitConfig.JitEnableNoHeapWritesSummary() != 0))
+    {
+        call->gtCallMoreFlags |= GTF_CALL_M_NO_HEAP_WRITES;
+    }
+
     // Virtual calls include an implicit null check, which we may
     // now need to make explicit.
     if (!objIsNonNull)
@@ -21324,60 +21443,86 @@ void Compiler::considerGuardedDevirtualization(
         return;
     }
 
-    // See if there's a likely guess for the class.
+    // See if there are likely guesses for the class.
     //
     const unsigned likelihoodThreshold = isInterface ? 25 : 30;
-    unsigned       likelihood          = 0;
+    const unsigned maxLikelyClasses    = 4;
     unsigned       numberOfClasses     = 0;
+    unsigned       maxTypeChecks       = (unsigned)JitConfig.JitGuardedDevirtualizationMaxTypeChecks();
 
-    CORINFO_CLASS_HANDLE likelyClass =
-        getLikelyClass(fgPgoSchema, fgPgoSchemaCount, fgPgoData, ilOffset, &likelihood, &numberOfClasses);
-
-    if (likelyClass == NO_CLASS_HANDLE)
+    if (maxTypeChecks > maxLikelyClasses)
     {
-        JITDUMP("No likely class, sorry\n");
-        return;
+        maxTypeChecks = maxLikelyClasses;
     }
 
-    JITDUMP("Likely class for %p (%s) is %p (%s) [likelihood:%u classes seen:%u]\n", dspPtr(objClass), objClassName,
-            likelyClass, eeGetClassName(likelyClass), likelihood, numberOfClasses);
+    LikelyClassRecord likelyClasses[maxLikelyClasses];
+    const unsigned    numberOfLikelyClasses = getLikelyClasses(likelyClasses, maxTypeChecks, fgPgoSchema,
+                                                            fgPgoSchemaCount, fgPgoData, ilOffset, &numberOfClasses);
 
-    // Todo: a more advanced heuristic using likelihood, number of
-    // classes, and the profile count for this block.
-    //
-    // For now we will guess if the likelihood is at least 25%/30% (intfc/virt), as studies
-    // have shown this transformation should pay off even if we guess wrong sometimes.
-    //
-    if (likelihood < likelihoodThreshold)
+    if (numberOfLikelyClasses == 0)
     {
-        JITDUMP("Not guessing for class; likelihood is below %s call threshold %u\n", callKind, likelihoodThreshold);
+        JITDUMP("No likely class, sorry\n");
         return;
     }
 
-    // Figure out which method will be called.
+    // Guess for each likely class in turn, most likely first; the checks are
+    // chained so that each guess only runs when the previous ones failed.
     //
-    CORINFO_DEVIRTUALIZATION_INFO dvInfo;
-    dvInfo.virtualMethod = baseMethod;
-    dvInfo.objClass      = likelyClass;
-    dvInfo.context       = *pContextHandle;
+    for (unsigned i = 0; i < numberOfLikelyClasses; i++)
+    {
+        CORINFO_CLASS_HANDLE const likelyClass = likelyClasses[i].clsHandle;
+        unsigned const             likelihood  = likelyClasses[i].likelihood;
 
-    const bool canResolve = info.compCompHnd->resolveVirtualMethod(&dvInfo);
+        JITDUMP("Likely class #%u for %p (%s) is %p (%s) [likelihood:%u classes seen:%u]\n", i, dspPtr(objClass),
+                objClassName, likelyClass, eeGetClassName(likelyClass), likelihood, numberOfClasses);
 
-    if (!canResolve)
-    {
-        JITDUMP("Can't figure out which method would be invoked, sorry\n");
-        return;
-    }
+        // Todo: a more advanced heuristic using likelihood, number of
+        // classes, and the profile count for this block.
+        //
+        // For now we will guess if the likelihood is at least 25%/30% (intfc/virt), as studies
+        // have shown this transformation should pay off even if we guess wrong sometimes.
+        //
+        // The classes are sorted by likelihood, so no later guess can do better.
+        //
+        if (likelihood < likelihoodThreshold)
+        {
+            JITDUMP("Not guessing for class; likelihood is below %s call threshold %u\n", callKind,
+                    likelihoodThreshold);
+            return;
+        }
 
-    CORINFO_METHOD_HANDLE likelyMethod = dvInfo.devirtualizedMethod;
-    JITDUMP("%s call would invoke method %s\n", callKind, eeGetMethodName(likelyMethod, nullptr));
+        // Figure out which method will be called.
+        //
+        CORINFO_DEVIRTUALIZATION_INFO dvInfo;
+        dvInfo.virtualMethod = baseMethod;
+        dvInfo.objClass      = likelyClass;
+        dvInfo.context       = *pContextHandle;
 
-    // Add this as a potential candidate.
-    //
-    uint32_t const likelyMethodAttribs = info.compCompHnd->getMethodAttribs(likelyMethod);
-    uint32_t const likelyClassAttribs  = info.compCompHnd->getClassAttribs(likelyClass);
-    addGuardedDevirtualizationCandidate(call, likelyMethod, likelyClass, likelyMethodAttribs, likelyClassAttribs,
-                                        likelihood);
+        const bool canResolve = info.compCompHnd->resolveVirtualMethod(&dvInfo);
+
+        if (!canResolve)
+        {
+            JITDUMP("Can't figure out which method would be invoked, sorry\n");
+            continue;
+        }
+
+        CORINFO_METHOD_HANDLE likelyMethod = dvInfo.devirtualizedMethod;
+        JITDUMP("%s call would invoke method %s\n", callKind, eeGetMethodName(likelyMethod, nullptr));
+
+        // Add this as a potential candidate.
+        //
+        uint32_t const likelyMethodAttribs = info.compCompHnd->getMethodAttribs(likelyMethod);
+        uint32_t const likelyClassAttribs  = info.compCompHnd->getClassAttribs(likelyClass);
+        addGuardedDevirtualizationCandidate(call, likelyMethod, likelyClass, likelyMethodAttribs, likelyClassAttribs,
+                                            likelihood);
+
+        // If the call could not be made a candidate, later guesses won't fare any better.
+        //
+        if (!call->IsGuardedDevirtualizationCandidate())
+        {
+            return;
+        }
+    }
 }
 
 //------------------------------------------------------------------------
@@ -21457,6 +21602,30 @@ void Compiler::addGuardedDevirtualizationCandidate(GenTreeCall*          call,
 
 #endif
 
+    // If the call is already a candidate, chain this guess after the existing ones.
+    //
+    if (call->IsGuardedDevirtualizationCandidate())
+    {
+        JITDUMP("Call [%06u] will also guess for class %s\n", dspTreeID(call), eeGetClassName(classHandle));
+
+        InlineCandidateInfo* lastGuess = call->gtInlineCandidateInfo;
+        while (lastGuess->nextGuess != nullptr)
+        {
+            lastGuess = lastGuess->nextGuess;
+        }
+
+        InlineCandidateInfo* const pNextInfo = new (this, CMK_Inlining) InlineCandidateInfo;
+
+        pNextInfo->guardedMethodHandle = methodHandle;
+        pNextInfo->guardedClassHandle  = classHandle;
+        pNextInfo->likelihood          = likelihood;
+        pNextInfo->stubAddr            = lastGuess->stubAddr;
+        pNextInfo->nextGuess           = nullptr;
+
+        lastGuess->nextGuess = pNextInfo;
+        return;
+    }
+
     // We're all set, proceed with candidate creation.
     //
     JITDUMP("Marking call [%06u] as guarded devirtualization candidate; will guess for class %s\n", dspTreeID(call),
@@ -21477,6 +21646,7 @@ void Compiler::addGuardedDevirtualizationCandidate(GenTreeCall*          call,
     pInfo->guardedMethodHandle = methodHandle;
     pInfo->guardedClassHandle  = classHandle;
     pInfo->likelihood          = likelihood;
+    pInfo->nextGuess           = nullptr;
 
     // Save off the stub address since it shares a union with the candidate info.
     //
@@ -502,7 +502,12 @@ private:
     {
     public:
         GuardedDevirtualizationTransformer(Compiler* compiler, BasicBlock* block, Statement* stmt)
-            : Transformer(compiler, block, stmt), returnTemp(BAD_VAR_NUM)
+            : Transformer(compiler, block, stmt)
+            , returnTemp(BAD_VAR_NUM)
+            , hasRetExpr(false)
+            , isChainedGuess(false)
+            , remainingLikelihood(100)
+            , chainedStmt(nullptr)
         {
         }
 
@@ -527,10 +532,60 @@ private:
             assert((likelihood >= 0) && (likelihood <= 100));
             JITDUMP("Likelihood of correct guess is %u\n", likelihood);
 
+            // A chained guess only runs when all the earlier guesses failed, so
+            // its odds of being right are relative to what those left over.
+            //
+            const unsigned guessLikelihood = likelihood;
+
+            if (remainingLikelihood < 100)
+            {
+                likelihood =
+                    (remainingLikelihood <= guessLikelihood) ? 100 : (100 * guessLikelihood) / remainingLikelihood;
+                JITDUMP("Likelihood of correct guess given earlier guesses failed is %u\n", likelihood);
+            }
+
             Transform();
+
+            // If the residual call has another guess, expand that one in the else block.
+            //
+            if (chainedStmt != nullptr)
+            {
+                const unsigned leftOver =
+                    (remainingLikelihood > guessLikelihood) ? (remainingLikelihood - guessLikelihood) : 0;
+                GuardedDevirtualizationTransformer chainedTransformer(compiler, elseBlock, chainedStmt, returnTemp,
+                                                                      hasRetExpr, leftOver);
+                chainedTransformer.Run();
+            }
         }
 
     protected:
+        //------------------------------------------------------------------------
+        // GuardedDevirtualizationTransformer: set up to transform the residual
+        //    call of an earlier guess, which will test for the next likely class.
+        //
+        // Arguments:
+        //    compiler - the compiler
+        //    block - else block of the earlier guess
+        //    stmt - statement holding the residual call
+        //    returnTemp - temp the earlier guess routes the call result through
+        //    hasRetExpr - true if the original call had a GT_RET_EXPR
+        //    remainingLikelihood - odds that none of the earlier guesses was right
+        //
+        GuardedDevirtualizationTransformer(Compiler*   compiler,
+                                           BasicBlock* block,
+                                           Statement*  stmt,
+                                           unsigned    returnTemp,
+                                           bool        hasRetExpr,
+                                           unsigned    remainingLikelihood)
+            : Transformer(compiler, block, stmt)
+            , returnTemp(returnTemp)
+            , hasRetExpr(hasRetExpr)
+            , isChainedGuess(true)
+            , remainingLikelihood(remainingLikelihood)
+            , chainedStmt(nullptr)
+        {
+        }
+
         virtual const char* Name()
         {
             return "GuardedDevirtualization";
@@ -544,9 +599,17 @@ private:
         //
         // Return Value:
         //    call tree node pointer.
+        //
+        // Notes:
+        //    Residual calls of chained guesses may have their result assigned to
+        //    the return temp.
         virtual GenTreeCall* GetCall(Statement* callStmt)
         {
             GenTree* tree = callStmt->GetRootNode();
+            if (isChainedGuess && tree->OperIs(GT_ASG))
+            {
+                tree = tree->gtGetOp2();
+            }
             assert(tree->IsCall());
             GenTreeCall* call = tree->AsCall();
             return call;
@@ -608,6 +671,14 @@ private:
         //
         virtual void FixupRetExpr()
         {
+            // For a chained guess the first guess has already done this, and
+            // handed us its return temp.
+            //
+            if (isChainedGuess)
+            {
+                return;
+            }
+
             // If call returns a value, we need to copy it to a temp, and
             // bash the associated GT_RET_EXPR to refer to the temp instead
             // of the call.
@@ -621,6 +692,7 @@ private:
             if (retExpr != nullptr)
             {
                 assert(retExpr->AsRetExpr()->gtInlineCandidate == origCall);
+                hasRetExpr = true;
             }
 
             if (origCall->TypeGet() != TYP_VOID)
@@ -737,7 +809,6 @@ private:
 
             // Re-establish this call as an inline candidate.
             //
-            GenTree* oldRetExpr              = inlineInfo->retExpr;
             inlineInfo->clsHandle            = compiler->info.compCompHnd->getMethodClass(methodHnd);
             inlineInfo->exactContextHnd      = context;
             inlineInfo->preexistingSpillTemp = returnTemp;
@@ -752,7 +823,7 @@ private:
             // Note the original GT_RET_EXPR is sitting at the join point of the
             // guarded expansion and for non-void calls, and now refers to a temp local;
             // we set all this up in FixupRetExpr().
-            if (oldRetExpr != nullptr)
+            if (hasRetExpr)
             {
                 GenTree* retExpr = compiler->gtNewInlineCandidateReturnExpr(call, call->TypeGet(), thenBlock->bbFlags);
                 inlineInfo->retExpr = retExpr;
@@ -791,9 +862,25 @@ private:
                 newStmt->SetRootNode(assign);
             }
 
+            // If there is another class to guess for, leave the residual call as a
+            // candidate for it; Run will expand it once we're done here.
+            //
+            InlineCandidateInfo* const nextGuess = call->gtInlineCandidateInfo->nextGuess;
+            GenTree* const             callRoot  = newStmt->GetRootNode();
+
+            if ((nextGuess != nullptr) &&
+                ((callRoot == call) || (callRoot->OperIs(GT_ASG) && (callRoot->gtGetOp2() == call))))
+            {
+                JITDUMP("Residual call [%06u] will next guess for class %s\n", compiler->dspTreeID(call),
+                        compiler->eeGetClassName(nextGuess->guardedClassHandle));
+                call->gtInlineCandidateInfo = nextGuess;
+                call->gtFlags |= GTF_CALL_INLINE_CANDIDATE;
+                call->SetGuardedDevirtualizationCandidate();
+                chainedStmt = newStmt;
+            }
             // For stub calls, restore the stub address. For everything else,
             // null out the candidate info field.
-            if (call->IsVirtualStub())
+            else if (call->IsVirtualStub())
             {
                 JITDUMP("Restoring stub addr %p from candidate info\n", call->gtInlineCandidateInfo->stubAddr);
                 call->gtStubCallStubAddr = call->gtInlineCandidateInfo->stubAddr;
@@ -810,7 +897,11 @@ private:
         }
 
     private:
-        unsigned returnTemp;
+        unsigned   returnTemp;
+        bool       hasRetExpr;
+        bool       isChainedGuess;
+        unsigned   remainingLikelihood;
+        Statement* chainedStmt;
     };
 
     // Runtime lookup with dynamic dictionary expansion transformer,
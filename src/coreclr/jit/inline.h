@@ -525,11 +525,14 @@ struct ClassProfileCandidateInfo
 // GuardedDevirtualizationCandidateInfo provides information about
 // a potential target of a virtual or interface call.
 //
+struct InlineCandidateInfo;
+
 struct GuardedDevirtualizationCandidateInfo : ClassProfileCandidateInfo
 {
     CORINFO_CLASS_HANDLE  guardedClassHandle;
     CORINFO_METHOD_HANDLE guardedMethodHandle;
     unsigned              likelihood;
+    InlineCandidateInfo*  nextGuess; // next class to test for if this guess fails, in decreasing likelihood
 };
 
 // InlineCandidateInfo provides basic information about a particular
@@ -821,6 +824,12 @@ public:
         return m_InlineCount;
     }
 
+    // Number of inline candidates seen
+    unsigned GetCandidateCount() const
+    {
+        return m_CandidateCount;
+    }
+
     // Return the current code size estimate for this method
     int GetCurrentSizeEstimate() const
     {
@@ -898,6 +898,21 @@ extern "C" CORINFO_CLASS_HANDLE WINAPI getLikelyClass(ICorJitInfo::PgoInstrument
                                                       UINT32*                                pLikelihood,
                                                       UINT32*                                pNumberOfClasses);
 
+// A class observed at a call site, along with the odds (0..100) of seeing it there.
+struct LikelyClassRecord
+{
+    CORINFO_CLASS_HANDLE clsHandle;
+    UINT32               likelihood;
+};
+
+UINT32 getLikelyClasses(LikelyClassRecord*                     pLikelyClasses,
+                        UINT32                                 maxLikelyClasses,
+                        ICorJitInfo::PgoInstrumentationSchema* schema,
+                        UINT32                                 countSchemaItems,
+                        BYTE*                                  pInstrumentationData,
+                        int32_t                                ilOffset,
+                        UINT32*                                pNumberOfClasses);
+
 /*****************************************************************************/
 #endif //_JIT_H_
 /*****************************************************************************/
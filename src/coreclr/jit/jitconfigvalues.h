@@ -243,6 +243,9 @@ CONFIG_INTEGER(JitAlignLoops, W("JitAlignLoops"), 0)
 ///
 /// JIT
 ///
+CONFIG_INTEGER(JitSafepointPolls, W("JitSafepointPolls"), 0) // If set, poll for GC suspension on loop back-edges and
+                                                               // method returns so that the runtime can reach a
+                                                               // safepoint without interrupting the thread
 #ifdef FEATURE_ENABLE_NO_RANGE_CHECKS
 CONFIG_INTEGER(JitNoRangeChks, W("JitNoRngChks"), 0) // If 1, don't generate range checks
 #endif
@@ -289,6 +292,8 @@ CONFIG_INTEGER(EnableEHWriteThru, W("EnableEHWriteThru"), 1) // Enable the regis
                                                              // partial enregistration of vars exposed on EH boundaries
 CONFIG_INTEGER(EnableMultiRegLocals, W("EnableMultiRegLocals"), 1) // Enable the enregistration of locals that are
                                                                    // defined or used in a multireg context.
+CONFIG_INTEGER(JitLsraFastRegisterSelection, W("JitLsraFastRegisterSelection"), 1) // Use the cheap register selection
+                                                                                   // heuristics when not optimizing
 
 // clang-format off
 
@@ -448,8 +453,21 @@ CONFIG_INTEGER(JitInlinePolicyProfile, W("JitInlinePolicyProfile"), 0)
 CONFIG_INTEGER(JitInlinePolicyProfileThreshold, W("JitInlinePolicyProfileThreshold"), 40)
 CONFIG_INTEGER(JitObjectStackAllocation, W("JitObjectStackAllocation"), 0)
 
+// Use the global profile driven block layout when edge weights are available.
+CONFIG_INTEGER(JitDoProfileLayout, W("JitDoProfileLayout"), 1)
+
+// Vectorize simple counted loops over arrays after loop cloning.
+CONFIG_INTEGER(JitDoLoopVectorization, W("JitDoLoopVectorization"), 0)
+
+// Partially unroll hot loops with a runtime bound when profile data shows a high trip count.
+CONFIG_INTEGER(JitDoPartialUnroll, W("JitDoPartialUnroll"), 1)
+
 CONFIG_INTEGER(JitEECallTimingInfo, W("JitEECallTimingInfo"), 0)
 
+// Report per method phase times, arena sizes and inlining counts to the host, see
+// ICorJitHost::reportMethodStatistics. The runtime sends them as EventPipe events.
+CONFIG_INTEGER(JitReportMethodStatistics, W("JitReportMethodStatistics"), 0)
+
 #if defined(DEBUG)
 CONFIG_INTEGER(JitEnableFinallyCloning, W("JitEnableFinallyCloning"), 1)
 CONFIG_INTEGER(JitEnableRemoveEmptyTry, W("JitEnableRemoveEmptyTry"), 1)
@@ -457,6 +475,11 @@ CONFIG_INTEGER(JitEnableRemoveEmptyTry, W("JitEnableRemoveEmptyTry"), 1)
 
 // Overall master enable for Guarded Devirtualization.
 CONFIG_INTEGER(JitEnableGuardedDevirtualization, W("JitEnableGuardedDevirtualization"), 1)
+// Maximum number of classes to test for at a guarded devirtualization site.
+CONFIG_INTEGER(JitGuardedDevirtualizationMaxTypeChecks, W("JitGuardedDevirtualizationMaxTypeChecks"), 3)
+
+// Report, and take advantage of, per-method "no heap writes" side effect summaries.
+CONFIG_INTEGER(JitEnableNoHeapWritesSummary, W("JitEnableNoHeapWritesSummary"), 1)
 
 #if defined(DEBUG)
 // Various policies for GuardedDevirtualization
@@ -759,6 +759,233 @@ private:
     unsigned     m_tableMax;      // maximum occupied count
 };
 
+//------------------------------------------------------------------------
+// JitOpenAddressingHashTable implements a mapping from a Key type to a Value
+// type, like JitHashTable, but stores the entries inline in a single array
+// and resolves collisions by linear probing.
+//
+// This avoids the separately allocated node (and its next pointer) that
+// JitHashTable needs per entry, so it is denser and more cache friendly for
+// large tables of small keys and values. Entries can't be removed, and keys
+// and values must not need destruction.
+//
+// Each slot has a control byte alongside it: zero for an empty slot, and
+// otherwise 0x80 plus 7 bits of the key's hash, so that most probes of
+// occupied slots are rejected without comparing keys.
+//
+// KeyFuncs and Behavior follow the same conventions as for JitHashTable;
+// only the density factor and the minimum allocation of Behavior are used.
+//
+template <typename Key,
+          typename KeyFuncs,
+          typename Value,
+          typename Allocator = CompAllocator,
+          typename Behavior  = JitHashTableBehavior>
+class JitOpenAddressingHashTable
+{
+public:
+    JitOpenAddressingHashTable(Allocator alloc)
+        : m_alloc(alloc), m_control(nullptr), m_slots(nullptr), m_capacity(0), m_shift(32), m_count(0)
+    {
+    }
+
+    ~JitOpenAddressingHashTable()
+    {
+        if (m_capacity != 0)
+        {
+            m_alloc.deallocate(m_slots);
+            m_alloc.deallocate(m_control);
+        }
+    }
+
+    //------------------------------------------------------------------------
+    // GetCount: Get the number of entries in the table.
+    //
+    unsigned GetCount() const
+    {
+        return m_count;
+    }
+
+    //------------------------------------------------------------------------
+    // Lookup: Get the value associated to the specified key, if any.
+    //
+    // Arguments:
+    //    k    - the key
+    //    pVal - pointer to a location used to store the associated value
+    //
+    // Return Value:
+    //    `true` if the key exists, `false` otherwise
+    //
+    bool Lookup(Key k, Value* pVal = nullptr) const
+    {
+        if (m_count == 0)
+        {
+            return false;
+        }
+
+        const unsigned hash = Hash(k);
+        const BYTE     tag  = Tag(hash);
+
+        for (unsigned index = hash >> m_shift;; index = (index + 1) & (m_capacity - 1))
+        {
+            const BYTE control = m_control[index];
+
+            if (control == 0)
+            {
+                return false;
+            }
+
+            if ((control == tag) && KeyFuncs::Equals(k, m_slots[index].m_key))
+            {
+                if (pVal != nullptr)
+                {
+                    *pVal = m_slots[index].m_val;
+                }
+                return true;
+            }
+        }
+    }
+
+    enum SetKind
+    {
+        None,
+        Overwrite
+    };
+
+    //------------------------------------------------------------------------
+    // Set: Associate the specified value with the specified key.
+    //
+    // Arguments:
+    //    k - the key
+    //    v - the value
+    //    kind - Normal, we are not allowed to overwrite
+    //           Overwrite, we are allowed to overwrite
+    //           currently only used by CHK/DBG builds in an assert.
+    //
+    // Return Value:
+    //    `true` if the key exists and was overwritten,
+    //    `false` otherwise.
+    //
+    bool Set(Key k, Value v, SetKind kind = None)
+    {
+        CheckGrowth();
+
+        const unsigned hash  = Hash(k);
+        const BYTE     tag   = Tag(hash);
+        unsigned       index = hash >> m_shift;
+
+        while (m_control[index] != 0)
+        {
+            if ((m_control[index] == tag) && KeyFuncs::Equals(k, m_slots[index].m_key))
+            {
+                assert(kind == Overwrite);
+                m_slots[index].m_val = v;
+                return true;
+            }
+
+            index = (index + 1) & (m_capacity - 1);
+        }
+
+        m_control[index]     = tag;
+        m_slots[index].m_key = k;
+        m_slots[index].m_val = v;
+        m_count++;
+        return false;
+    }
+
+private:
+    struct Slot
+    {
+        Key   m_key;
+        Value m_val;
+    };
+
+    // Spread the key's hash code over all 32 bits (Fibonacci hashing); the
+    // top bits select the home slot.
+    static unsigned Hash(Key k)
+    {
+        return static_cast<unsigned>(KeyFuncs::GetHashCode(k)) * 0x9E3779B9u;
+    }
+
+    // Tag bits are taken from the middle of the hash, away from the index bits
+    // of all but very large tables.
+    static BYTE Tag(unsigned hash)
+    {
+        return static_cast<BYTE>(0x80 | ((hash >> 8) & 0x7F));
+    }
+
+    //------------------------------------------------------------------------
+    // CheckGrowth: Make sure there is room for one more entry, doubling the
+    // capacity if adding it would exceed the density factor.
+    //
+    void CheckGrowth()
+    {
+        if ((m_count + 1) * Behavior::s_density_factor_denominator <=
+            m_capacity * Behavior::s_density_factor_numerator)
+        {
+            return;
+        }
+
+        unsigned newCapacity = 16;
+        while (newCapacity < Behavior::s_minimum_allocation)
+        {
+            newCapacity *= 2;
+        }
+
+        if (m_capacity != 0)
+        {
+            if (m_capacity >= (1u << 30))
+            {
+                Behavior::NoMemory();
+            }
+            newCapacity = m_capacity * 2;
+        }
+
+        unsigned newShift = 32;
+        for (unsigned c = newCapacity; c > 1; c >>= 1)
+        {
+            newShift--;
+        }
+
+        BYTE* newControl = m_alloc.template allocate<BYTE>(newCapacity);
+        Slot* newSlots   = m_alloc.template allocate<Slot>(newCapacity);
+        memset(newControl, 0, newCapacity * sizeof(BYTE));
+
+        for (unsigned i = 0; i < m_capacity; i++)
+        {
+            if (m_control[i] != 0)
+            {
+                unsigned index = Hash(m_slots[i].m_key) >> newShift;
+                while (newControl[index] != 0)
+                {
+                    index = (index + 1) & (newCapacity - 1);
+                }
+
+                newControl[index] = m_control[i];
+                newSlots[index]   = m_slots[i];
+            }
+        }
+
+        if (m_capacity != 0)
+        {
+            m_alloc.deallocate(m_slots);
+            m_alloc.deallocate(m_control);
+        }
+
+        m_control  = newControl;
+        m_slots    = newSlots;
+        m_capacity = newCapacity;
+        m_shift    = newShift;
+    }
+
+    Allocator m_alloc;    // Allocator to use in this table.
+    BYTE*     m_control;  // control byte per slot
+    Slot*     m_slots;    // the entries
+    unsigned  m_capacity; // number of slots (a power of 2, or 0)
+    unsigned  m_shift;    // 32 - log2(m_capacity)
+    unsigned  m_count;    // number of entries
+};
+
 // Commonly used KeyFuncs types:
 
 // Base class for types whose equality function is the same as their "==".
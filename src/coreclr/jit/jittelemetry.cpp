@@ -214,8 +214,8 @@ void JitTelemetry::NotifyDllProcessDetach()
 //
 //  Description:
 //      Increment static volatile counters for the current compiled method.
-//      This is slightly inaccurate due to lack of synchronization around
-//      the counters. Inaccuracy is the tradeoff for JITting cost.
+//      Methods may be compiled on several threads at once, so the counters
+//      are updated with interlocked operations.
 //
 //  Note:
 //      1. Must be called post fully successful compilation of the method.
@@ -228,7 +228,7 @@ void JitTelemetry::NotifyEndOfCompilation()
         return;
     }
 
-    s_uMethodsCompiled++; // volatile increment
+    InterlockedIncrement((LONG volatile*)&s_uMethodsCompiled);
 }
 
 //------------------------------------------------------------------------
@@ -250,11 +250,10 @@ void JitTelemetry::NotifyNowayAssert(const char* filename, unsigned line)
         return;
     }
 
-    s_uMethodsHitNowayAssert++;
+    unsigned noways = (unsigned)InterlockedIncrement((LONG volatile*)&s_uMethodsHitNowayAssert);
 
     // Check if our assumption that noways are rare is invalid for this
     // process. If so, return early than logging too much data.
-    unsigned noways   = s_uMethodsHitNowayAssert;
     unsigned attempts = max(1, s_uMethodsCompiled + noways);
     double   ratio    = (noways / ((double)attempts));
     if (noways > NOWAY_SUFFICIENCY_THRESHOLD && ratio > NOWAY_NOISE_RATIO)
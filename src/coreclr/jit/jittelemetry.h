@@ -40,9 +40,8 @@ private:
 
     //
     //--------------------------------------------------------------------------------
-    // The below per process counters are updated without synchronization or
-    // thread-safety to avoid interfering with the JIT throughput. Accuracy
-    // of these counters will be traded-off for throughput.
+    // The below per process counters are shared by all compiling threads, and
+    // are updated with interlocked operations.
     //
 
     // Methods compiled per DLL unload
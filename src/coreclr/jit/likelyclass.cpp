@@ -219,3 +219,112 @@ extern "C" DLLEXPORT CORINFO_CLASS_HANDLE WINAPI getLikelyClass(ICorJitInfo::Pgo
     //
     return NULL;
 }
+
+//------------------------------------------------------------------------
+// getLikelyClasses: find the most likely classes at a given IL offset
+//
+// Arguments:
+//    pLikelyClasses       - [out] array receiving the classes, most likely first
+//    maxLikelyClasses     - size of pLikelyClasses
+//    schema               - pgo schema
+//    countSchemaItems     - number of items in the schema
+//    pInstrumentationData - pgo data
+//    ilOffset             - IL offset of the call
+//    pNumberOfClasses     - [out] estimate of the number of classes seen at runtime
+//
+// Returns:
+//    Number of entries written to pLikelyClasses.
+//
+// Notes:
+//    Unlike getLikelyClass, this reports every known class of a class profile
+//    histogram (up to maxLikelyClasses), so callers can guess for more than one.
+//
+UINT32 getLikelyClasses(LikelyClassRecord*                     pLikelyClasses,
+                        UINT32                                 maxLikelyClasses,
+                        ICorJitInfo::PgoInstrumentationSchema* schema,
+                        UINT32                                 countSchemaItems,
+                        BYTE*                                  pInstrumentationData,
+                        int32_t                                ilOffset,
+                        UINT32*                                pNumberOfClasses)
+{
+    *pNumberOfClasses = 0;
+
+    if ((schema == NULL) || (maxLikelyClasses == 0))
+        return 0;
+
+    for (COUNT_T i = 0; i < countSchemaItems; i++)
+    {
+        if (schema[i].ILOffset != (int32_t)ilOffset)
+            continue;
+
+        if ((schema[i].InstrumentationKind == ICorJitInfo::PgoInstrumentationKind::GetLikelyClass) &&
+            (schema[i].Count == 1))
+        {
+            // Only the single most likely class was kept for this site.
+            //
+            *pNumberOfClasses = (UINT32)schema[i].Other >> 8;
+            INT_PTR result    = *(INT_PTR*)(pInstrumentationData + schema[i].Offset);
+            if (ICorJitInfo::IsUnknownTypeHandle(result))
+                return 0;
+
+            pLikelyClasses[0].clsHandle  = (CORINFO_CLASS_HANDLE)result;
+            pLikelyClasses[0].likelihood = (UINT32)(schema[i].Other & 0xFF);
+            return 1;
+        }
+
+        if ((schema[i].InstrumentationKind == ICorJitInfo::PgoInstrumentationKind::TypeHandleHistogramCount) &&
+            (schema[i].Count == 1) && ((i + 1) < countSchemaItems) &&
+            (schema[i + 1].InstrumentationKind == ICorJitInfo::PgoInstrumentationKind::TypeHandleHistogramTypeHandle))
+        {
+            LikelyClassHistogram h(*(uint32_t*)(pInstrumentationData + schema[i].Offset),
+                                   (INT_PTR*)(pInstrumentationData + schema[i + 1].Offset), schema[i + 1].Count);
+
+            *pNumberOfClasses = (uint32_t)h.countHistogramElements + h.m_unknownTypes;
+
+            if (h.m_totalCount == 0)
+                return 0;
+
+            // Insertion sort the known classes by decreasing count, keeping the
+            // first maxLikelyClasses of them. Ties keep histogram order.
+            //
+            UINT32 count = 0;
+
+            for (unsigned m = 0; m < h.countHistogramElements; m++)
+            {
+                LikelyClassHistogramEntry const entry = h.HistogramEntryAt(m);
+
+                if (ICorJitInfo::IsUnknownTypeHandle(entry.m_mt))
+                    continue;
+
+                LikelyClassRecord record;
+                record.clsHandle  = (CORINFO_CLASS_HANDLE)entry.m_mt;
+                record.likelihood = (100 * entry.m_count) / h.m_totalCount;
+
+                UINT32 pos = (count < maxLikelyClasses) ? count : maxLikelyClasses;
+                while ((pos > 0) && (pLikelyClasses[pos - 1].likelihood < record.likelihood))
+                {
+                    if (pos < maxLikelyClasses)
+                    {
+                        pLikelyClasses[pos] = pLikelyClasses[pos - 1];
+                    }
+                    pos--;
+                }
+
+                if (pos < maxLikelyClasses)
+                {
+                    pLikelyClasses[pos] = record;
+                    if (count < maxLikelyClasses)
+                    {
+                        count++;
+                    }
+                }
+            }
+
+            return count;
+        }
+    }
+
+    // Failed to find histogram data for this method
+    //
+    return 0;
+}
@@ -350,6 +350,12 @@ void Compiler::fgPerNodeLocalVarLiveness(GenTree* tree)
                     modHeap = false;
                 }
             }
+            else if (call->HasNoHeapWrites())
+            {
+                // The callee only reads memory.
+                fgCurMemoryUse |= memoryKindSet(GcHeap, ByrefExposed);
+                modHeap = false;
+            }
             if (modHeap)
             {
                 fgCurMemoryUse |= memoryKindSet(GcHeap, ByrefExposed);
@@ -601,6 +607,40 @@ void Compiler::fgPerBlockLocalVarLiveness()
 #endif // DEBUG
 }
 
+//------------------------------------------------------------------------
+// fgReportNoHeapWrites: Tell the runtime if the method being compiled does
+//    not write to GcHeap/ByrefExposed memory.
+//
+// Notes:
+//    Relies on the per-block memory defs computed by fgPerBlockLocalVarLiveness.
+//    Calls, volatile accesses, memory barriers and atomics all count as memory
+//    defs there, so a method with no memory defs is a pure reader of the heap.
+//    The runtime caches the result and reports it back via getMethodAttribs as
+//    CORINFO_FLG_NO_HEAP_WRITES, which lets direct calls to the method keep
+//    heap value numbers and loop memory dependence intact.
+//
+//    Only full method compiles are summarized: inlinees are covered by the
+//    summary of their root, and OSR methods only see part of the method.
+//
+void Compiler::fgReportNoHeapWrites()
+{
+    if (compIsForInlining() || opts.IsOSR() || opts.IsReadyToRun() || (JitConfig.JitEnableNoHeapWritesSummary() == 0))
+    {
+        return;
+    }
+
+    for (BasicBlock* block = fgFirstBB; block != nullptr; block = block->bbNext)
+    {
+        if ((block->bbMemoryDef & memoryKindSet(GcHeap, ByrefExposed)) != emptyMemoryKindSet)
+        {
+            return;
+        }
+    }
+
+    JITDUMP("Method does not write to the heap; reporting CORINFO_FLG_HAS_NO_HEAP_WRITES\n");
+    info.compCompHnd->setMethodAttribs(info.compMethodHnd, CORINFO_FLG_HAS_NO_HEAP_WRITES);
+}
+
 // Helper functions to mark variables live over their entire scope
 
 void Compiler::fgBeginScopeLife(VARSET_TP* inScope, VarScopeDsc* var)
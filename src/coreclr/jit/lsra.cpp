@@ -698,7 +698,8 @@ LinearScan::LinearScan(Compiler* theCompiler)
     // after the first liveness analysis - either by optimizations or by Lowering, and the tracked
     // set won't be recomputed until after Lowering (and this constructor is called prior to Lowering),
     // so we don't want to check that yet.
-    enregisterLocalVars = ((compiler->opts.compFlags & CLFLG_REGVAR) != 0);
+    enregisterLocalVars   = ((compiler->opts.compFlags & CLFLG_REGVAR) != 0);
+    fastRegisterSelection = false;
 #ifdef TARGET_ARM64
     availableIntRegs = (RBM_ALLINT & ~(RBM_PR | RBM_FP | RBM_LR) & ~compiler->codeGen->regSet.rsMaskResvd);
 #else
@@ -1265,6 +1266,12 @@ void LinearScan::doLinearScan()
         enregisterLocalVars = false;
     }
 
+    // When we're not optimizing (Tier0, and methods that fell back to MinOpts because they are
+    // too large), everything we allocate is a short-lived tree temp. The full set of register
+    // selection heuristics buys little there, so just pick the first suitable free register.
+    fastRegisterSelection = !enregisterLocalVars && compiler->opts.OptimizationDisabled() &&
+                            (JitConfig.JitLsraFastRegisterSelection() != 0);
+
     splitBBNumToTargetBBNumMap = nullptr;
 
     // This is complicated by the fact that physical registers have refs associated
@@ -2799,10 +2806,11 @@ regNumber LinearScan::allocateReg(Interval* currentInterval, RefPosition* refPos
     assert(candidates != RBM_NONE);
 
     Interval* relatedInterval = currentInterval->relatedInterval;
-    if (currentInterval->isSpecialPutArg)
+    if (currentInterval->isSpecialPutArg || fastRegisterSelection)
     {
         // This is not actually a preference, it's merely to track the lclVar that this
         // "specialPutArg" is using.
+        // Under fastRegisterSelection we don't walk the chain of related intervals at all.
         relatedInterval = nullptr;
     }
     Interval* nextRelatedInterval  = relatedInterval;
@@ -3104,6 +3112,35 @@ regNumber LinearScan::allocateReg(Interval* currentInterval, RefPosition* refPos
         INTRACK_STATS_IF(found, updateLsraStat(LsraStat::REGSEL_THIS_ASSIGNED, refPosition->bbNum));
     }
 
+    // Under fastRegisterSelection, pick the free register that comes first in allocation order,
+    // among our own preferences if any are free. This skips the per-register range computations
+    // of the COVERS through BEST_FIT heuristics.
+    if (!found && fastRegisterSelection && (freeCandidates != RBM_NONE))
+    {
+        regMaskTP fastCandidates = selector.candidates & preferences;
+        if (fastCandidates == RBM_NONE)
+        {
+            fastCandidates = selector.candidates;
+        }
+
+        unsigned  lowestRegOrder    = UINT_MAX;
+        regMaskTP lowestRegOrderBit = RBM_NONE;
+        for (; fastCandidates != RBM_NONE;)
+        {
+            regMaskTP fastCandidateBit = genFindLowestBit(fastCandidates);
+            fastCandidates &= ~fastCandidateBit;
+            unsigned thisRegOrder = getRegisterRecord(genRegNumFromMask(fastCandidateBit))->regOrder;
+            if (thisRegOrder < lowestRegOrder)
+            {
+                lowestRegOrder    = thisRegOrder;
+                lowestRegOrderBit = fastCandidateBit;
+            }
+        }
+        assert(lowestRegOrderBit != RBM_NONE);
+        found = selector.applySingleRegSelection(REG_ORDER, lowestRegOrderBit);
+        INTRACK_STATS_IF(found, updateLsraStat(LsraStat::REGSEL_FAST_REG_ORDER, refPosition->bbNum));
+    }
+
     // Compute the sets for COVERS, OWN_PREFERENCE, COVERS_RELATED, COVERS_FULL and UNASSIGNED together,
     // as they all require similar computation.
     regMaskTP coversSet        = RBM_NONE;
@@ -10657,7 +10694,7 @@ void LinearScan::dumpRegRecordTitle()
 
 void LinearScan::dumpRegRecords()
 {
-    static char columnFormatArray[18];
+    thread_local char columnFormatArray[18];
 
     for (regNumber regNum = REG_FIRST; regNum <= (regNumber)lastUsedRegNumIndex; regNum = REG_NEXT(regNum))
     {
@@ -10764,7 +10801,7 @@ void LinearScan::dumpNewBlock(BasicBlock* currentBlock, LsraLocation location)
 //
 void LinearScan::dumpRefPositionShort(RefPosition* refPosition, BasicBlock* currentBlock)
 {
-    static RefPosition* lastPrintedRefPosition = nullptr;
+    thread_local RefPosition* lastPrintedRefPosition = nullptr;
     if (refPosition == lastPrintedRefPosition)
     {
         dumpEmptyRefPosition();
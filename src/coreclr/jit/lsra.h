@@ -1460,6 +1460,10 @@ private:
     // True if there are any register candidate lclVars available for allocation.
     bool enregisterLocalVars;
 
+    // True if registers should be selected with the cheap subset of the heuristics
+    // (used when optimization is disabled and no lclVars are enregistered).
+    bool fastRegisterSelection;
+
     virtual bool willEnregisterLocalVars() const
     {
         return enregisterLocalVars;
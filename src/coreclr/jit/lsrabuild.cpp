@@ -681,6 +681,13 @@ bool LinearScan::isContainableMemoryOp(GenTree* node)
 {
     if (node->isMemoryOp())
     {
+        // Thread pointer relative loads are only encoded by genCodeForIndir, so they can't be folded into
+        // the memory operand of their user.
+        if (node->OperIs(GT_IND) && node->AsIndir()->Addr()->IsCnsIntOrI() &&
+            node->AsIndir()->Addr()->IsIconHandle(GTF_ICON_TLS_HDL))
+        {
+            return false;
+        }
         return true;
     }
     if (node->IsLocal())
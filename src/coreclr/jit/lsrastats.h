@@ -45,6 +45,7 @@ LSRA_STAT_DEF(REGSEL_SPILL_COST,            "SPILL_COST")
 LSRA_STAT_DEF(REGSEL_FAR_NEXT_REF,          "FAR_NEXT_REF")
 LSRA_STAT_DEF(REGSEL_PREV_REG_OPT,          "PREV_REG_OPT")
 LSRA_STAT_DEF(REGSEL_REG_NUM,               "REG_NUM")
+LSRA_STAT_DEF(REGSEL_FAST_REG_ORDER,        "FAST_REG_ORDER")
 
 LSRA_STAT_DEF(COUNT,                        "COUNT")
 
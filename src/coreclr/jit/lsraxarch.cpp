@@ -1300,7 +1300,7 @@ int LinearScan::BuildBlockStore(GenTreeBlk* blkNode)
                 if (size >= XMM_REGSIZE_BYTES)
                 {
                     buildInternalFloatRegisterDefForNode(blkNode, internalFloatRegCandidates());
-                    SetContainsAVXFlags();
+                    SetContainsAVXFlags(size >= YMM_REGSIZE_BYTES ? YMM_REGSIZE_BYTES : XMM_REGSIZE_BYTES);
                 }
 
 #ifdef TARGET_X86
@@ -1373,7 +1373,7 @@ int LinearScan::BuildBlockStore(GenTreeBlk* blkNode)
                     if (size >= XMM_REGSIZE_BYTES)
                     {
                         buildInternalFloatRegisterDefForNode(blkNode, internalFloatRegCandidates());
-                        SetContainsAVXFlags();
+                        SetContainsAVXFlags(size >= YMM_REGSIZE_BYTES ? YMM_REGSIZE_BYTES : XMM_REGSIZE_BYTES);
                     }
                     break;
 
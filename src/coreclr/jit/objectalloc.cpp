@@ -124,6 +124,9 @@ void ObjectAllocator::DoAnalysis()
     {
         m_EscapingPointers         = BitVecOps::MakeEmpty(&m_bitVecTraits);
         m_ConnGraphAdjacencyMatrix = new (comp->getAllocator(CMK_ObjectAllocator)) BitSetShortLongRep[comp->lvaCount];
+        m_LclVarFirstStmt          = new (comp->getAllocator(CMK_ObjectAllocator)) Statement*[comp->lvaCount]();
+        m_LclVarBlock              = new (comp->getAllocator(CMK_ObjectAllocator)) BasicBlock*[comp->lvaCount]();
+        m_LclVarsInMultipleBlocks  = BitVecOps::MakeEmpty(&m_bitVecTraits);
 
         MarkEscapingVarsAndBuildConnGraph();
         ComputeEscapingNodes(&m_bitVecTraits, m_EscapingPointers);
@@ -153,6 +156,8 @@ void ObjectAllocator::MarkEscapingVarsAndBuildConnGraph()
     class BuildConnGraphVisitor final : public GenTreeVisitor<BuildConnGraphVisitor>
     {
         ObjectAllocator* m_allocator;
+        BasicBlock*      m_block;
+        Statement*       m_stmt;
 
     public:
         enum
@@ -162,8 +167,8 @@ void ObjectAllocator::MarkEscapingVarsAndBuildConnGraph()
             ComputeStack  = true,
         };
 
-        BuildConnGraphVisitor(ObjectAllocator* allocator)
-            : GenTreeVisitor<BuildConnGraphVisitor>(allocator->comp), m_allocator(allocator)
+        BuildConnGraphVisitor(ObjectAllocator* allocator, BasicBlock* block, Statement* stmt)
+            : GenTreeVisitor<BuildConnGraphVisitor>(allocator->comp), m_allocator(allocator), m_block(block), m_stmt(stmt)
         {
         }
 
@@ -173,6 +178,8 @@ void ObjectAllocator::MarkEscapingVarsAndBuildConnGraph()
             assert(tree != nullptr);
             assert(tree->IsLocal());
 
+            m_allocator->RecordLclVarAppearance(tree->AsLclVarCommon()->GetLclNum(), m_block, m_stmt);
+
             var_types type = tree->TypeGet();
             if ((tree->OperGet() == GT_LCL_VAR) && (type == TYP_REF || type == TYP_BYREF || type == TYP_I_IMPL))
             {
@@ -219,12 +226,87 @@ void ObjectAllocator::MarkEscapingVarsAndBuildConnGraph()
     {
         for (Statement* stmt : block->Statements())
         {
-            BuildConnGraphVisitor buildConnGraphVisitor(this);
+            BuildConnGraphVisitor buildConnGraphVisitor(this, block, stmt);
             buildConnGraphVisitor.WalkTree(stmt->GetRootNodePointer(), nullptr);
         }
     }
 }
 
+//------------------------------------------------------------------------------
+// RecordLclVarAppearance : Record that a local variable is mentioned in the given statement.
+//
+// Arguments:
+//    lclNum  - Local variable number
+//    block   - Basic block containing the statement
+//    stmt    - Statement mentioning the local
+//
+// Notes:
+//    Statements must be visited in order, so that the first statement recorded for
+//    a local is the first statement of its block that mentions it.
+
+void ObjectAllocator::RecordLclVarAppearance(unsigned int lclNum, BasicBlock* block, Statement* stmt)
+{
+    if ((lclNum >= BitVecTraits::GetSize(&m_bitVecTraits)) || (m_ConnGraphAdjacencyMatrix[lclNum] == nullptr))
+    {
+        // Only locals that may point to objects are interesting.
+        return;
+    }
+
+    if (m_LclVarFirstStmt[lclNum] == nullptr)
+    {
+        m_LclVarFirstStmt[lclNum] = stmt;
+        m_LclVarBlock[lclNum]     = block;
+    }
+    else if (m_LclVarBlock[lclNum] != block)
+    {
+        BitVecOps::AddElemD(&m_bitVecTraits, m_LclVarsInMultipleBlocks, lclNum);
+    }
+}
+
+//------------------------------------------------------------------------------
+// CanAllocateLclVarOnStackInLoop : Check whether a non-escaping allocation in a block that
+//                                  may be part of a loop can still use a stack slot.
+//
+// Arguments:
+//    lclNum     - Local variable the allocation is assigned to
+//    allocStmt  - The allocation statement
+//
+// Return Value:
+//    true if the object allocated by one execution of the statement can't be referenced
+//    once the statement executes again.
+//
+// Notes:
+//    The stack slot is reused (and zeroed) on every iteration, so the object must be dead
+//    by the time control gets back to the allocation. We check that conservatively: the
+//    allocation statement is the first one mentioning the local, all other mentions are
+//    in the same block, and no other local may point to the object.
+
+bool ObjectAllocator::CanAllocateLclVarOnStackInLoop(unsigned int lclNum, Statement* allocStmt)
+{
+    assert(m_AnalysisDone);
+
+    if ((m_LclVarFirstStmt == nullptr) || (m_LclVarFirstStmt[lclNum] != allocStmt) ||
+        BitVecOps::IsMember(&m_bitVecTraits, m_LclVarsInMultipleBlocks, lclNum))
+    {
+        return false;
+    }
+
+    // Locals created by stack allocation itself are not part of the connection graph.
+    const unsigned int lclCount = BitVecTraits::GetSize(&m_bitVecTraits);
+
+    for (unsigned int otherLclNum = 0; otherLclNum < lclCount; ++otherLclNum)
+    {
+        if ((otherLclNum != lclNum) && (m_ConnGraphAdjacencyMatrix[otherLclNum] != nullptr) &&
+            BitVecOps::IsMember(&m_bitVecTraits, m_ConnGraphAdjacencyMatrix[otherLclNum], lclNum))
+        {
+            JITDUMP("V%02u is allocated in a loop and may be copied to V%02u\n", lclNum, otherLclNum);
+            return false;
+        }
+    }
+
+    return true;
+}
+
 //------------------------------------------------------------------------------
 // ComputeEscapingNodes : Given an initial set of escaping nodes, update it to contain the full set
 //                        of escaping nodes by computing nodes reachable from the given set.
@@ -393,9 +475,10 @@ bool ObjectAllocator::MorphAllocObjNodes()
                 unsigned int         lclNum     = op1->AsLclVar()->GetLclNum();
                 CORINFO_CLASS_HANDLE clsHnd     = op2->AsAllocObj()->gtAllocObjClsHnd;
 
-                // Don't attempt to do stack allocations inside basic blocks that may be in a loop.
-                if (IsObjectStackAllocationEnabled() && !basicBlockHasBackwardJump &&
-                    CanAllocateLclVarOnStack(lclNum, clsHnd))
+                // Inside basic blocks that may be in a loop the same stack slot gets reused by
+                // every iteration, so only allocate there when no object can outlive its iteration.
+                if (IsObjectStackAllocationEnabled() && CanAllocateLclVarOnStack(lclNum, clsHnd) &&
+                    (!basicBlockHasBackwardJump || CanAllocateLclVarOnStackInLoop(lclNum, stmt)))
                 {
                     JITDUMP("Allocating local variable V%02u on the stack\n", lclNum);
 
@@ -35,6 +35,11 @@ class ObjectAllocator final : public Phase
     BitVec              m_DefinitelyStackPointingPointers;
     LocalToLocalMap     m_HeapLocalToStackLocalMap;
     BitSetShortLongRep* m_ConnGraphAdjacencyMatrix;
+    // For each local that may point to an object, the first statement that mentions it and the
+    // block that statement is in. Locals mentioned in more than one block are kept in a separate set.
+    Statement**  m_LclVarFirstStmt;
+    BasicBlock** m_LclVarBlock;
+    BitVec       m_LclVarsInMultipleBlocks;
 
     //===============================================================================
     // Methods
@@ -48,6 +53,8 @@ protected:
 
 private:
     bool CanAllocateLclVarOnStack(unsigned int lclNum, CORINFO_CLASS_HANDLE clsHnd);
+    bool CanAllocateLclVarOnStackInLoop(unsigned int lclNum, Statement* allocStmt);
+    void RecordLclVarAppearance(unsigned int lclNum, BasicBlock* block, Statement* stmt);
     bool CanLclVarEscape(unsigned int lclNum);
     void MarkLclVarAsPossiblyStackPointing(unsigned int lclNum);
     void MarkLclVarAsDefinitelyStackPointing(unsigned int lclNum);
@@ -85,6 +92,9 @@ inline ObjectAllocator::ObjectAllocator(Compiler* comp)
     m_PossiblyStackPointingPointers   = BitVecOps::UninitVal();
     m_DefinitelyStackPointingPointers = BitVecOps::UninitVal();
     m_ConnGraphAdjacencyMatrix        = nullptr;
+    m_LclVarFirstStmt                 = nullptr;
+    m_LclVarBlock                     = nullptr;
+    m_LclVarsInMultipleBlocks         = BitVecOps::UninitVal();
 }
 
 //------------------------------------------------------------------------
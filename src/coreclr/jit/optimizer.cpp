@@ -3599,6 +3599,8 @@ void Compiler::optUnrollLoops()
 
         if ((loopFlags & requiredFlags) != requiredFlags)
         {
+            // Loops with a bound only known at runtime may still be worth unrolling a few times.
+            change |= optPartiallyUnrollLoop(lnum, unrollLimitSz);
             continue;
         }
 
@@ -3993,6 +3995,844 @@ void Compiler::optUnrollLoops()
 #pragma warning(pop)
 #endif
 
+//------------------------------------------------------------------------
+// optLoopEstimatedTripCount: estimate how many iterations a loop runs each
+//    time it is entered, based on profile data
+//
+// Arguments:
+//    lnum - the loop
+//
+// Return Value:
+//    The ratio of the loop entry weight to the loop head weight, or 0 if
+//    the blocks have no profile weights.
+//
+BasicBlock::weight_t Compiler::optLoopEstimatedTripCount(unsigned lnum)
+{
+    const LoopDsc& loop = optLoopTable[lnum];
+
+    if ((loop.lpFlags & LPFLG_REMOVED) != 0)
+    {
+        return 0;
+    }
+
+    BasicBlock* const head  = loop.lpHead;
+    BasicBlock* const entry = loop.lpEntry;
+
+    if (!head->hasProfileWeight() || !entry->hasProfileWeight() || (head->bbWeight <= BB_ZERO_WEIGHT))
+    {
+        return 0;
+    }
+
+    return entry->bbWeight / head->bbWeight;
+}
+
+//------------------------------------------------------------------------
+// optPartiallyUnrollLoop: unroll a hot loop whose trip count is only known
+//    at runtime a few times, see optUnrollLoops
+//
+// Arguments:
+//    lnum          - the loop to unroll
+//    unrollLimitSz - the code size budget for the unrolled copy
+//
+// Return Value:
+//    true if the loop was unrolled.
+//
+// Notes:
+//    Handles single block, do-while shaped innermost loops of the form
+//
+//        for (i = init; i < limit; i++) { <body> }
+//
+//    where profile data shows that the loop runs many iterations each time
+//    it is entered. A copy of the loop containing the body N times is placed
+//    in front of the original one, which is kept for the remaining iterations:
+//
+//        if (limit < N) goto loop;
+//        if (i > limit - N) goto loop;
+//    unrolled:
+//        <body>; i++; ... (N times)
+//        if (i <= limit - N) goto unrolled;
+//        if (i >= limit) goto exit;
+//    loop:
+//        <original loop>
+//
+bool Compiler::optPartiallyUnrollLoop(unsigned lnum, int unrollLimitSz)
+{
+    if (JitConfig.JitDoPartialUnroll() == 0)
+    {
+        return false;
+    }
+
+    LoopDsc& loop = optLoopTable[lnum];
+
+    const unsigned requiredFlags = LPFLG_DO_WHILE | LPFLG_ONE_EXIT | LPFLG_ITER;
+    if (((loop.lpFlags & requiredFlags) != requiredFlags) ||
+        ((loop.lpFlags & (LPFLG_DONT_UNROLL | LPFLG_REMOVED)) != 0))
+    {
+        return false;
+    }
+
+    // Only innermost, top level loops: the new loop is not added to the loop table and must
+    // not end up inside the block range of another loop.
+    if ((loop.lpChild != BasicBlock::NOT_IN_LOOP) || (loop.lpParent != BasicBlock::NOT_IN_LOOP))
+    {
+        return false;
+    }
+
+    BasicBlock* const head   = loop.lpHead;
+    BasicBlock* const top    = loop.lpTop;
+    BasicBlock* const bottom = loop.lpBottom;
+    BasicBlock* const exit   = bottom->bbNext;
+
+    if ((top != bottom) || (loop.lpEntry != top) || (loop.lpFirst != top) || (head->bbNext != top) ||
+        !head->bbFallsThrough() || (exit == nullptr) || (bottom->bbJumpKind != BBJ_COND) ||
+        (bottom->bbJumpDest != top) || !BasicBlock::sameEHRegion(head, top) || top->isRunRarely())
+    {
+        return false;
+    }
+
+    // The new blocks go between head and top, so head has to be the only way into the loop.
+    for (flowList* pred = top->bbPreds; pred != nullptr; pred = pred->flNext)
+    {
+        if ((pred->getBlock() != head) && (pred->getBlock() != bottom))
+        {
+            return false;
+        }
+    }
+
+    const unsigned iterVar = loop.lpIterVar();
+    if ((loop.lpIterOper() != GT_ADD) || (loop.lpIterConst() != 1) || (loop.lpTestOper() != GT_LT) ||
+        ((loop.lpTestTree->gtFlags & GTF_UNSIGNED) != 0) || (lvaTable[iterVar].TypeGet() != TYP_INT) ||
+        lvaTable[iterVar].lvAddrExposed)
+    {
+        return false;
+    }
+
+    // The limit is evaluated again by the new checks, so it must not change inside the loop.
+    GenTree* const limit  = loop.lpLimit();
+    unsigned       arrLcl = BAD_VAR_NUM;
+    if (limit->OperIs(GT_LCL_VAR))
+    {
+        if (((loop.lpFlags & LPFLG_VAR_LIMIT) == 0) ||
+            lvaTable[limit->AsLclVarCommon()->GetLclNum()].lvAddrExposed)
+        {
+            return false;
+        }
+    }
+    else if (limit->OperIs(GT_ARR_LENGTH))
+    {
+        GenTree* const arrRef = limit->AsArrLen()->ArrRef();
+        if (!arrRef->OperIs(GT_LCL_VAR))
+        {
+            return false;
+        }
+
+        arrLcl = arrRef->AsLclVarCommon()->GetLclNum();
+        if (lvaTable[arrLcl].lvAddrExposed || optIsVarAssigned(top, bottom, nullptr, arrLcl))
+        {
+            return false;
+        }
+    }
+    else if (!limit->IsCnsIntOrI())
+    {
+        return false;
+    }
+
+    // The block must be "<body>; i++; if (i < limit) goto top;".
+    Statement* const firstStmt = top->firstStmt();
+    Statement* const testStmt  = top->lastStmt();
+    if ((firstStmt == nullptr) || (firstStmt == testStmt) || (testStmt->GetPrevStmt() == firstStmt) ||
+        (testStmt->GetPrevStmt()->GetRootNode() != loop.lpIterTree))
+    {
+        return false;
+    }
+
+    unsigned loopCostSz = 0;
+    for (Statement* stmt = firstStmt; stmt != testStmt; stmt = stmt->GetNextStmt())
+    {
+        gtSetStmtInfo(stmt);
+        loopCostSz += stmt->GetCostSz();
+    }
+
+    int unrollCount = 4;
+    while ((unrollCount > 1) && ((int)(loopCostSz * unrollCount) > unrollLimitSz))
+    {
+        unrollCount /= 2;
+    }
+
+    if (unrollCount == 1)
+    {
+        JITDUMP("Not partially unrolling " FMT_LP ": loop too large\n", lnum);
+        return false;
+    }
+
+    // Profitability: only unroll loops that profile data says run many iterations at a time,
+    // when the unrolled copy is not entered the extra checks and code are just overhead.
+    const BasicBlock::weight_t tripCount = optLoopEstimatedTripCount(lnum);
+    if (tripCount < (BasicBlock::weight_t)(2 * unrollCount))
+    {
+        JITDUMP("Not partially unrolling " FMT_LP ": estimated trip count %g\n", lnum, tripCount);
+        return false;
+    }
+
+    // Clone all the statements up front so that we can bail before changing the flow graph.
+    ArrayStack<GenTree*> unrolledTrees(getAllocator(CMK_LoopOpt));
+    for (int i = 0; i < unrollCount; i++)
+    {
+        for (Statement* stmt = firstStmt; stmt != testStmt; stmt = stmt->GetNextStmt())
+        {
+            GenTree* const clone = gtCloneExpr(stmt->GetRootNode());
+            if (clone == nullptr)
+            {
+                return false;
+            }
+
+            unrolledTrees.Push(clone);
+        }
+    }
+
+    JITDUMP("Partially unrolling " FMT_LP " in " FMT_BB " by %d, estimated trip count %g\n", lnum, top->bbNum,
+            unrollCount, tripCount);
+
+    const unsigned copiedFlags =
+        BBF_HAS_IDX_LEN | BBF_HAS_NULLCHECK | BBF_HAS_NEWOBJ | BBF_HAS_NEWARRAY | BBF_HAS_CALL;
+
+    auto addStmt = [&](BasicBlock* block, GenTree* stmtTree) {
+        Statement* const stmt = fgNewStmtAtEnd(block, stmtTree);
+        gtSetStmtInfo(stmt);
+        fgSetStmtSeq(stmt);
+    };
+
+    auto addBlock = [&](BasicBlock* insertAfter, BasicBlock* weightSrc, GenTree* stmtTree) -> BasicBlock* {
+        BasicBlock* const block = fgNewBBafter(BBJ_COND, insertAfter, /* extendRegion */ true);
+        block->inheritWeight(weightSrc);
+        block->bbFlags |= (top->bbFlags & copiedFlags);
+
+        if (stmtTree != nullptr)
+        {
+            addStmt(block, stmtTree);
+        }
+        return block;
+    };
+
+    auto newIter  = [&]() -> GenTree* { return gtNewLclvNode(iterVar, TYP_INT); };
+    auto newLimit = [&]() -> GenTree* { return gtCloneExpr(limit); };
+    auto newJump  = [&](genTreeOps oper, GenTree* op1, GenTree* op2) -> GenTree* {
+        GenTree* const cond = gtNewOperNode(oper, TYP_INT, op1, op2);
+        cond->gtFlags |= GTF_RELOP_JMP_USED;
+        return gtNewOperNode(GT_JTRUE, TYP_VOID, cond);
+    };
+    auto newLimitMinusCount = [&]() -> GenTree* {
+        return gtNewOperNode(GT_SUB, TYP_INT, newLimit(), gtNewIconNode(unrollCount));
+    };
+
+    BasicBlock* firstGuard = nullptr;
+    BasicBlock* lastGuard  = head;
+
+    // if (a == null) goto top; the original loop may throw elsewhere before reaching a.Length.
+    if (arrLcl != BAD_VAR_NUM)
+    {
+        GenTree* const nullCheck = newJump(GT_EQ, gtNewLclvNode(arrLcl, TYP_REF), gtNewIconNode(0, TYP_REF));
+        lastGuard                = addBlock(lastGuard, head, nullCheck);
+        lastGuard->bbJumpDest = top;
+        firstGuard            = lastGuard;
+    }
+
+    // if (limit < N) goto top;
+    lastGuard = addBlock(lastGuard, head, newJump(GT_LT, newLimit(), gtNewIconNode(unrollCount)));
+    lastGuard->bbJumpDest = top;
+    if (firstGuard == nullptr)
+    {
+        firstGuard = lastGuard;
+    }
+
+    // if (i > limit - N) goto top;
+    lastGuard = addBlock(lastGuard, head, newJump(GT_GT, newIter(), newLimitMinusCount()));
+    lastGuard->bbJumpDest = top;
+
+    // N copies of the body and increment, if (i <= limit - N) goto unrolled;
+    BasicBlock* const unrolled = addBlock(lastGuard, top, nullptr);
+    unrolled->scaleBBWeight(1.0f / unrollCount);
+    unrolled->bbFlags |= BBF_LOOP_HEAD;
+    unrolled->bbJumpDest = unrolled;
+
+    for (int i = 0; i < unrolledTrees.Height(); i++)
+    {
+        addStmt(unrolled, unrolledTrees.Bottom(i));
+    }
+
+    addStmt(unrolled, newJump(GT_LE, newIter(), newLimitMinusCount()));
+
+    // if (i >= limit) goto exit; otherwise run the remaining iterations in the original loop.
+    BasicBlock* const remainder = addBlock(unrolled, head, newJump(GT_GE, newIter(), newLimit()));
+    remainder->bbJumpDest       = exit;
+
+    assert(remainder->bbNext == top);
+
+    // The original loop is now entered from the remainder check.
+    loop.lpHead = remainder;
+    loop.lpFlags &= ~LPFLG_HAS_PREHEAD;
+    loop.lpFlags |= LPFLG_DONT_UNROLL;
+
+#ifdef DEBUG
+    if (verbose)
+    {
+        printf("Partially unrolled loop:\n");
+        fgDumpTrees(firstGuard, remainder);
+    }
+#endif // DEBUG
+
+    return true;
+}
+
+//------------------------------------------------------------------------
+// optVectorizeLoops: vectorize simple counted loops over arrays
+//
+// Notes:
+//    Handles single block, do-while shaped innermost loops of the form
+//
+//        for (i = c; i < limit; i++) { a[i] = <expr>; }
+//
+//    where <expr> is built from array elements indexed by the iterator,
+//    constants and element-wise arithmetic. The loop must have no bounds
+//    checks left, which after loop cloning means the fast path proved that
+//    every array access stays within [c, limit).
+//
+//    A Vector128 copy of the loop is placed in front of the original one,
+//    which is kept as the scalar remainder loop:
+//
+//        if (limit < N) goto scalar;
+//        if (i > limit - N) goto scalar;
+//    vector:
+//        a[i..i+N-1] = <vector expr>;
+//        i += N;
+//        if (i <= limit - N) goto vector;
+//        if (i >= limit) goto exit;
+//    scalar:
+//        <original loop>
+//
+void Compiler::optVectorizeLoops()
+{
+#ifdef FEATURE_HW_INTRINSICS
+    if (JitConfig.JitDoLoopVectorization() == 0)
+    {
+        return;
+    }
+
+    if ((compCodeOpt() == SMALL_CODE) || (optLoopCount == 0) || !supportSIMDTypes())
+    {
+        return;
+    }
+
+    JITDUMP("\n*************** In optVectorizeLoops()\n");
+
+    bool change = false;
+
+    for (unsigned lnum = 0; lnum < optLoopCount; lnum++)
+    {
+        change |= optVectorizeLoop(lnum);
+    }
+
+    if (change)
+    {
+        constexpr bool computePreds = true;
+        fgUpdateChangedFlowGraph(computePreds);
+    }
+
+#ifdef DEBUG
+    fgDebugCheckBBlist(true);
+#endif
+#endif // FEATURE_HW_INTRINSICS
+}
+
+#ifdef FEATURE_HW_INTRINSICS
+
+//------------------------------------------------------------------------
+// optVectorizeLoop: try to vectorize a single loop, see optVectorizeLoops
+//
+// Arguments:
+//    lnum - the loop to vectorize
+//
+// Return Value:
+//    true if the loop was vectorized.
+//
+bool Compiler::optVectorizeLoop(unsigned lnum)
+{
+    LoopDsc& loop = optLoopTable[lnum];
+
+    const unsigned requiredFlags = LPFLG_DO_WHILE | LPFLG_ONE_EXIT | LPFLG_ITER | LPFLG_CONST_INIT;
+    if (((loop.lpFlags & requiredFlags) != requiredFlags) || ((loop.lpFlags & LPFLG_REMOVED) != 0))
+    {
+        return false;
+    }
+
+    // Only innermost, top level loops: the new loop is not added to the loop table and must
+    // not end up inside the block range of another loop.
+    if ((loop.lpChild != BasicBlock::NOT_IN_LOOP) || (loop.lpParent != BasicBlock::NOT_IN_LOOP))
+    {
+        return false;
+    }
+
+    BasicBlock* const head   = loop.lpHead;
+    BasicBlock* const top    = loop.lpTop;
+    BasicBlock* const bottom = loop.lpBottom;
+    BasicBlock* const exit   = bottom->bbNext;
+
+    if ((top != bottom) || (loop.lpEntry != top) || (loop.lpFirst != top) || (head->bbNext != top) ||
+        !head->bbFallsThrough() || (exit == nullptr) || (bottom->bbJumpKind != BBJ_COND) ||
+        (bottom->bbJumpDest != top) || !BasicBlock::sameEHRegion(head, top) || top->isRunRarely())
+    {
+        return false;
+    }
+
+    // The new blocks go between head and top, so head has to be the only way into the loop.
+    for (flowList* pred = top->bbPreds; pred != nullptr; pred = pred->flNext)
+    {
+        if ((pred->getBlock() != head) && (pred->getBlock() != bottom))
+        {
+            return false;
+        }
+    }
+
+    const unsigned iterVar = loop.lpIterVar();
+    if ((loop.lpIterOper() != GT_ADD) || (loop.lpIterConst() != 1) || (loop.lpConstInit < 0) ||
+        (loop.lpTestOper() != GT_LT) || ((loop.lpTestTree->gtFlags & GTF_UNSIGNED) != 0) ||
+        (lvaTable[iterVar].TypeGet() != TYP_INT) || lvaTable[iterVar].lvAddrExposed)
+    {
+        return false;
+    }
+
+    GenTree* const limit = loop.lpLimit();
+    if (limit->OperIs(GT_LCL_VAR))
+    {
+        if (lvaTable[limit->AsLclVarCommon()->GetLclNum()].lvAddrExposed)
+        {
+            return false;
+        }
+    }
+    else if (limit->OperIs(GT_ARR_LENGTH))
+    {
+        GenTree* const arrRef = limit->AsArrLen()->ArrRef();
+        if (!arrRef->OperIs(GT_LCL_VAR) || lvaTable[arrRef->AsLclVarCommon()->GetLclNum()].lvAddrExposed)
+        {
+            return false;
+        }
+    }
+    else if (!limit->IsCnsIntOrI())
+    {
+        return false;
+    }
+
+    // The block must be exactly "a[i] = <expr>; i++; if (i < limit) goto top;".
+    Statement* const bodyStmt = top->firstStmt();
+    Statement* const testStmt = top->lastStmt();
+    if ((bodyStmt == nullptr) || (bodyStmt->GetNextStmt() == nullptr) ||
+        (bodyStmt->GetNextStmt()->GetRootNode() != loop.lpIterTree) ||
+        (bodyStmt->GetNextStmt()->GetNextStmt() != testStmt))
+    {
+        return false;
+    }
+
+    GenTree* const store = bodyStmt->GetRootNode();
+    if (!store->OperIs(GT_ASG) || !store->AsOp()->gtGetOp1()->OperIs(GT_IND))
+    {
+        return false;
+    }
+
+    const var_types elemType = store->AsOp()->gtGetOp1()->TypeGet();
+    if (!varTypeIsArithmetic(elemType) || (elemType == TYP_BOOL) ||
+        !optIsVectorizableTree(store->AsOp()->gtGetOp1(), iterVar, elemType) ||
+        !optIsVectorizableTree(store->AsOp()->gtGetOp2(), iterVar, elemType))
+    {
+        return false;
+    }
+
+    const unsigned simdSize  = 16;
+    const int      vectorLen = (int)(simdSize / genTypeSize(elemType));
+
+    // Profitability: a loop that profile data says runs only a few iterations at a time
+    // would just pay for the extra checks.
+    if (top->hasProfileWeight() && head->hasProfileWeight() &&
+        (top->bbWeight < head->bbWeight * (BasicBlock::weight_t)(2 * vectorLen)))
+    {
+        JITDUMP("Not vectorizing " FMT_LP ": low trip count\n", lnum);
+        return false;
+    }
+
+    GenTree* const vectorStore = optVectorizeTree(store, elemType, simdSize);
+    if (vectorStore == nullptr)
+    {
+        return false;
+    }
+
+    JITDUMP("Vectorizing " FMT_LP " in " FMT_BB " by %d\n", lnum, top->bbNum, vectorLen);
+
+    auto addBlock = [&](BasicBlock* insertAfter, BasicBlock* weightSrc, GenTree* stmtTree) -> BasicBlock* {
+        BasicBlock* const block = fgNewBBafter(BBJ_COND, insertAfter, /* extendRegion */ true);
+        block->inheritWeight(weightSrc);
+        block->bbFlags |= (top->bbFlags & (BBF_HAS_IDX_LEN | BBF_HAS_NULLCHECK));
+
+        Statement* const stmt = fgNewStmtAtEnd(block, stmtTree);
+        gtSetStmtInfo(stmt);
+        fgSetStmtSeq(stmt);
+        return block;
+    };
+
+    auto newIter  = [&]() -> GenTree* { return gtNewLclvNode(iterVar, TYP_INT); };
+    auto newLimit = [&]() -> GenTree* { return gtCloneExpr(limit); };
+    auto newJump  = [&](genTreeOps oper, GenTree* op1, GenTree* op2) -> GenTree* {
+        GenTree* const cond = gtNewOperNode(oper, TYP_INT, op1, op2);
+        cond->gtFlags |= GTF_RELOP_JMP_USED;
+        return gtNewOperNode(GT_JTRUE, TYP_VOID, cond);
+    };
+    auto newLimitMinusLen = [&]() -> GenTree* {
+        return gtNewOperNode(GT_SUB, TYP_INT, newLimit(), gtNewIconNode(vectorLen));
+    };
+
+    // if (limit < N) goto top;
+    BasicBlock* const guard1 = addBlock(head, head, newJump(GT_LT, newLimit(), gtNewIconNode(vectorLen)));
+    guard1->bbJumpDest       = top;
+
+    // if (i > limit - N) goto top;
+    BasicBlock* const guard2 = addBlock(guard1, head, newJump(GT_GT, newIter(), newLimitMinusLen()));
+    guard2->bbJumpDest       = top;
+
+    // vector body, i += N, if (i <= limit - N) goto vector body;
+    BasicBlock* const vectorBody = addBlock(guard2, top, vectorStore);
+    vectorBody->scaleBBWeight(1.0f / vectorLen);
+    vectorBody->bbFlags |= BBF_LOOP_HEAD;
+    vectorBody->bbJumpDest = vectorBody;
+
+    Statement* const incrStmt =
+        fgNewStmtAtEnd(vectorBody, gtNewAssignNode(newIter(), gtNewOperNode(GT_ADD, TYP_INT, newIter(),
+                                                                            gtNewIconNode(vectorLen))));
+    gtSetStmtInfo(incrStmt);
+    fgSetStmtSeq(incrStmt);
+
+    Statement* const vecTestStmt = fgNewStmtAtEnd(vectorBody, newJump(GT_LE, newIter(), newLimitMinusLen()));
+    gtSetStmtInfo(vecTestStmt);
+    fgSetStmtSeq(vecTestStmt);
+
+    // if (i >= limit) goto exit; otherwise run the remaining iterations in the scalar loop.
+    BasicBlock* const remainder = addBlock(vectorBody, head, newJump(GT_GE, newIter(), newLimit()));
+    remainder->bbJumpDest       = exit;
+
+    assert(remainder->bbNext == top);
+
+    // The scalar loop is now entered from the remainder check.
+    loop.lpHead = remainder;
+    loop.lpFlags &= ~LPFLG_HAS_PREHEAD;
+    loop.lpFlags |= LPFLG_DONT_UNROLL;
+
+    compFloatingPointUsed = true;
+
+#ifdef DEBUG
+    if (verbose)
+    {
+        printf("Vectorized loop:\n");
+        fgDumpTrees(guard1, remainder);
+    }
+#endif // DEBUG
+
+    return true;
+}
+
+//------------------------------------------------------------------------
+// optIsVectorizableTree: check whether a tree of a vectorization candidate
+//    only computes element-wise values, see optVectorizeLoops
+//
+// Arguments:
+//    tree     - the tree to check
+//    iterVar  - the loop iterator
+//    elemType - the type of the array elements the loop stores
+//
+// Return Value:
+//    true if optVectorizeTree can produce a vector version of the tree.
+//
+bool Compiler::optIsVectorizableTree(GenTree* tree, unsigned iterVar, var_types elemType)
+{
+    if (((tree->gtFlags & (GTF_CALL | GTF_ASG)) != 0) || tree->gtOverflowEx())
+    {
+        return false;
+    }
+
+    switch (tree->OperGet())
+    {
+        case GT_IND:
+            if ((genTypeSize(tree->TypeGet()) != genTypeSize(elemType)) ||
+                (varTypeIsFloating(tree->TypeGet()) != varTypeIsFloating(elemType)) ||
+                ((tree->gtFlags & (GTF_IND_VOLATILE | GTF_IND_UNALIGNED)) != 0) ||
+                ((tree->gtFlags & GTF_IND_ARR_INDEX) == 0))
+            {
+                return false;
+            }
+            return optIsVectorizableElemAddr(tree->AsIndir()->Addr(), iterVar, elemType);
+
+        case GT_CNS_INT:
+            return varTypeIsIntegral(elemType) && !tree->IsIconHandle();
+
+        case GT_CNS_DBL:
+            return varTypeIsFloating(elemType);
+
+        case GT_CAST:
+            // Only the narrowing the store would do anyway.
+            return varTypeIsSmall(elemType) && (genTypeSize(tree->CastToType()) == genTypeSize(elemType)) &&
+                   optIsVectorizableTree(tree->AsCast()->CastOp(), iterVar, elemType);
+
+        case GT_ADD:
+        case GT_SUB:
+        case GT_MUL:
+        case GT_AND:
+        case GT_OR:
+        case GT_XOR:
+        case GT_DIV:
+            if (genActualType(tree->TypeGet()) != genActualType(elemType))
+            {
+                return false;
+            }
+            return optIsVectorizableTree(tree->AsOp()->gtGetOp1(), iterVar, elemType) &&
+                   optIsVectorizableTree(tree->AsOp()->gtGetOp2(), iterVar, elemType);
+
+        default:
+            return false;
+    }
+}
+
+//------------------------------------------------------------------------
+// optIsVectorizableElemAddr: check whether an address is "&a[i]" for an array local
+//    and the loop iterator
+//
+// Arguments:
+//    addr     - the address
+//    iterVar  - the loop iterator
+//    elemType - the array element type
+//
+// Return Value:
+//    true if the address is the array base plus the element offset plus the
+//    iterator scaled by the element size.
+//
+bool Compiler::optIsVectorizableElemAddr(GenTree* addr, unsigned iterVar, var_types elemType)
+{
+    unsigned baseCount = 0;
+    ssize_t  scale     = 0;
+    ssize_t  offset    = 0;
+
+    ArrayStack<GenTree*> terms(getAllocator(CMK_LoopOpt));
+    terms.Push(addr);
+
+    while (!terms.Empty())
+    {
+        GenTree* term = terms.Pop();
+
+        if (term->OperIs(GT_ADD) && !term->gtOverflowEx())
+        {
+            terms.Push(term->AsOp()->gtGetOp1());
+            terms.Push(term->AsOp()->gtGetOp2());
+            continue;
+        }
+
+        if (term->IsCnsIntOrI() && !term->IsIconHandle())
+        {
+            offset += term->AsIntCon()->IconValue();
+            continue;
+        }
+
+        if (term->OperIs(GT_LCL_VAR) && (term->TypeGet() == TYP_REF))
+        {
+            const unsigned lclNum = term->AsLclVarCommon()->GetLclNum();
+            if ((lclNum == iterVar) || lvaTable[lclNum].lvAddrExposed)
+            {
+                return false;
+            }
+
+            baseCount++;
+            continue;
+        }
+
+        ssize_t termScale = 1;
+        if (term->OperIs(GT_MUL, GT_LSH) && term->AsOp()->gtGetOp2()->IsCnsIntOrI() && !term->gtOverflowEx())
+        {
+            const ssize_t value = term->AsOp()->gtGetOp2()->AsIntCon()->IconValue();
+            if (term->OperIs(GT_LSH) && ((value < 0) || (value > 3)))
+            {
+                return false;
+            }
+
+            termScale = term->OperIs(GT_MUL) ? value : ((ssize_t)1 << value);
+            term      = term->AsOp()->gtGetOp1();
+        }
+
+        // The iterator is known to be non-negative, so a widening cast doesn't change it.
+        if (term->OperIs(GT_CAST) && !term->gtOverflowEx() && (genTypeSize(term->CastToType()) >= genTypeSize(TYP_INT)))
+        {
+            term = term->AsCast()->CastOp();
+        }
+
+        if (!term->OperIs(GT_LCL_VAR) || (term->AsLclVarCommon()->GetLclNum() != iterVar))
+        {
+            return false;
+        }
+
+        scale += termScale;
+    }
+
+    return (baseCount == 1) && (scale == (ssize_t)genTypeSize(elemType)) &&
+           (offset == (ssize_t)eeGetArrayDataOffset(elemType));
+}
+
+//------------------------------------------------------------------------
+// optVectorizeTree: build the vector version of a tree accepted by optIsVectorizableTree
+//
+// Arguments:
+//    tree     - the tree to vectorize
+//    elemType - the array element type
+//    simdSize - the vector size in bytes
+//
+// Return Value:
+//    The vector tree, or nullptr if the target can't do one of the operations.
+//
+GenTree* Compiler::optVectorizeTree(GenTree* tree, var_types elemType, unsigned simdSize)
+{
+    const var_types simdType = getSIMDTypeForSize(simdSize);
+    CorInfoType     simdBaseJitType;
+
+    switch (elemType)
+    {
+        case TYP_BYTE:
+            simdBaseJitType = CORINFO_TYPE_BYTE;
+            break;
+        case TYP_UBYTE:
+            simdBaseJitType = CORINFO_TYPE_UBYTE;
+            break;
+        case TYP_SHORT:
+            simdBaseJitType = CORINFO_TYPE_SHORT;
+            break;
+        case TYP_USHORT:
+            simdBaseJitType = CORINFO_TYPE_USHORT;
+            break;
+        case TYP_INT:
+            simdBaseJitType = CORINFO_TYPE_INT;
+            break;
+        case TYP_UINT:
+            simdBaseJitType = CORINFO_TYPE_UINT;
+            break;
+        case TYP_LONG:
+            simdBaseJitType = CORINFO_TYPE_LONG;
+            break;
+        case TYP_ULONG:
+            simdBaseJitType = CORINFO_TYPE_ULONG;
+            break;
+        case TYP_FLOAT:
+            simdBaseJitType = CORINFO_TYPE_FLOAT;
+            break;
+        case TYP_DOUBLE:
+            simdBaseJitType = CORINFO_TYPE_DOUBLE;
+            break;
+        default:
+            return nullptr;
+    }
+
+    switch (tree->OperGet())
+    {
+        case GT_ASG:
+        {
+            GenTree* const dst = optVectorizeTree(tree->AsOp()->gtGetOp1(), elemType, simdSize);
+            GenTree* const src = optVectorizeTree(tree->AsOp()->gtGetOp2(), elemType, simdSize);
+            if ((dst == nullptr) || (src == nullptr))
+            {
+                return nullptr;
+            }
+            return gtNewAssignNode(dst, src);
+        }
+
+        case GT_IND:
+        {
+            // Loading or storing N elements at &a[i] covers a[i] .. a[i + N - 1].
+            GenTree* const ind = gtCloneExpr(tree);
+            ind->ChangeType(simdType);
+            ind->gtFlags &= ~GTF_IND_ARR_INDEX;
+            ind->gtFlags |= GTF_DONT_CSE;
+            return ind;
+        }
+
+        case GT_CNS_INT:
+        case GT_CNS_DBL:
+        {
+#if defined(TARGET_X86)
+            if (varTypeIsLong(elemType))
+            {
+                return nullptr;
+            }
+#endif // TARGET_X86
+            GenTree* const value = gtCloneExpr(tree);
+            if (value->OperIs(GT_CNS_DBL))
+            {
+                value->ChangeType(elemType);
+            }
+
+            GenTree* const vec = gtNewSimdCreateBroadcastNode(simdType, value, simdBaseJitType, simdSize,
+                                                              /* isSimdAsHWIntrinsic */ false);
+            vec->gtFlags |= GTF_DONT_CSE;
+            return vec;
+        }
+
+        case GT_CAST:
+            return optVectorizeTree(tree->AsCast()->CastOp(), elemType, simdSize);
+
+        default:
+        {
+            NamedIntrinsic intrinsic;
+            switch (tree->OperGet())
+            {
+                case GT_ADD:
+                    intrinsic = NI_VectorT128_op_Addition;
+                    break;
+                case GT_SUB:
+                    intrinsic = NI_VectorT128_op_Subtraction;
+                    break;
+                case GT_MUL:
+                    intrinsic = NI_VectorT128_op_Multiply;
+                    break;
+                case GT_AND:
+                    intrinsic = NI_VectorT128_op_BitwiseAnd;
+                    break;
+                case GT_OR:
+                    intrinsic = NI_VectorT128_op_BitwiseOr;
+                    break;
+                case GT_XOR:
+                    intrinsic = NI_VectorT128_op_ExclusiveOr;
+                    break;
+                case GT_DIV:
+                    intrinsic = NI_VectorT128_op_Division;
+                    break;
+                default:
+                    unreached();
+            }
+
+            // Operations that need special import handling (or aren't available for the
+            // element type) map to themselves or to NI_Illegal; leave those loops alone.
+            const NamedIntrinsic hwIntrinsic = SimdAsHWIntrinsicInfo::lookupHWIntrinsic(intrinsic, elemType);
+            if ((hwIntrinsic == NI_Illegal) || (hwIntrinsic == intrinsic) ||
+                !compOpportunisticallyDependsOn(HWIntrinsicInfo::lookupIsa(hwIntrinsic)))
+            {
+                return nullptr;
+            }
+
+            GenTree* const op1 = optVectorizeTree(tree->AsOp()->gtGetOp1(), elemType, simdSize);
+            GenTree* const op2 = optVectorizeTree(tree->AsOp()->gtGetOp2(), elemType, simdSize);
+            if ((op1 == nullptr) || (op2 == nullptr))
+            {
+                return nullptr;
+            }
+
+            GenTree* const vec = gtNewSimdHWIntrinsicNode(simdType, op1, op2, hwIntrinsic, simdBaseJitType, simdSize);
+            vec->gtFlags |= GTF_DONT_CSE;
+            return vec;
+        }
+    }
+}
+
+#endif // FEATURE_HW_INTRINSICS
+
 /*****************************************************************************
  *
  *  Return false if there is a code path from 'topBB' to 'botBB' that might
@@ -7171,10 +8011,17 @@ bool Compiler::optIsProfitableToHoistableTree(GenTree* tree, unsigned lnum)
     // as we believe it will be placed in the stack or one of the other
     // loopVars will be spilled into the stack
     //
+    // When profile data shows that the loop runs many iterations each time it is entered,
+    // a single stack reload per iteration is still cheaper than recomputing the expression,
+    // so we also hoist expressions that are only marginally more expensive than IND_COST_EX.
+    //
     if (loopVarCount >= availRegCount)
     {
-        // Don't hoist expressions that are not heavy: tree->GetCostEx() < (2*IND_COST_EX)
-        if (tree->GetCostEx() < (2 * IND_COST_EX))
+        const bool     highTripCount = optLoopEstimatedTripCount(lnum) >= 8;
+        const unsigned minCostEx     = highTripCount ? (IND_COST_EX + 1) : (2 * IND_COST_EX);
+
+        // Don't hoist expressions that are not heavy: tree->GetCostEx() < minCostEx
+        if (tree->GetCostEx() < minCostEx)
         {
             return false;
         }
@@ -8412,7 +9259,7 @@ bool Compiler::optComputeLoopSideEffectsOfBlock(BasicBlock* blk)
                                 }
                             }
                         }
-                        else
+                        else if (!call->HasNoHeapWrites())
                         {
                             memoryHavoc |= memoryKindSet(GcHeap, ByrefExposed);
                         }
@@ -22,8 +22,8 @@
 // Workarounds and limitations:
 //
 //   * no patchpoints in handler regions
-//   * no patchpoints for localloc methods
-//   * no patchpoints for synchronized methods (workaround)
+//   * no patchpoints for localloc methods (switched to optimized instead)
+//   * no patchpoints for synchronized methods (workaround, switched to optimized instead)
 //
 class PatchpointTransformer
 {
@@ -192,38 +192,25 @@ private:
 };
 
 //------------------------------------------------------------------------
-// fgTransformPatchpoints: expansion of patchpoints into control flow.
-//
-// Notes:
-//
-// Patchpoints are placed in the JIT IR during importation, and get expanded
-// here into normal JIT IR.
+// fgCanUsePatchpoints: determine if OSR can handle this method
 //
 // Returns:
-//   phase status indicating if changes were made
+//   true if patchpoints can be placed in the method
 //
-PhaseStatus Compiler::fgTransformPatchpoints()
+// Notes:
+//   Called both before importation, to decide whether a Tier0 method with loops
+//   should instead be switched to optimized, and by fgTransformPatchpoints.
+//
+bool Compiler::fgCanUsePatchpoints()
 {
-    if (!doesMethodHavePatchpoints())
-    {
-        JITDUMP("\n -- no patchpoints to transform\n");
-        return PhaseStatus::MODIFIED_NOTHING;
-    }
-
-    // We should only be adding patchpoints at Tier0, so should not be in an inlinee
-    assert(!compIsForInlining());
-
     // We currently can't do OSR in methods with localloc.
     // Such methods don't have a fixed relationship between frame and stack pointers.
     //
     // This is true whether or not the localloc was executed in the original method.
-    //
-    // TODO: handle this case, or else check this earlier and fall back to fully
-    // optimizing the method (ala QJFL=0).
-    if (compLocallocUsed)
+    if (compLocallocSeen || compLocallocUsed)
     {
         JITDUMP("\n -- unable to handle methods with localloc\n");
-        return PhaseStatus::MODIFIED_NOTHING;
+        return false;
     }
 
     // We currently can't do OSR in synchronized methods. We need to alter
@@ -233,12 +220,44 @@ PhaseStatus Compiler::fgTransformPatchpoints()
     if ((info.compFlags & CORINFO_FLG_SYNCH) != 0)
     {
         JITDUMP("\n -- unable to handle synchronized methods\n");
-        return PhaseStatus::MODIFIED_NOTHING;
+        return false;
     }
 
     if (opts.IsReversePInvoke())
     {
         JITDUMP(" -- unable to handle Reverse P/Invoke\n");
+        return false;
+    }
+
+    return true;
+}
+
+//------------------------------------------------------------------------
+// fgTransformPatchpoints: expansion of patchpoints into control flow.
+//
+// Notes:
+//
+// Patchpoints are placed in the JIT IR during importation, and get expanded
+// here into normal JIT IR.
+//
+// Returns:
+//   phase status indicating if changes were made
+//
+PhaseStatus Compiler::fgTransformPatchpoints()
+{
+    if (!doesMethodHavePatchpoints())
+    {
+        JITDUMP("\n -- no patchpoints to transform\n");
+        return PhaseStatus::MODIFIED_NOTHING;
+    }
+
+    // We should only be adding patchpoints at Tier0, so should not be in an inlinee
+    assert(!compIsForInlining());
+
+    // Methods OSR can't handle are normally switched to optimized before importation
+    // (see compCompileHelper), but keep the check here in case that was not possible.
+    if (!fgCanUsePatchpoints())
+    {
         return PhaseStatus::MODIFIED_NOTHING;
     }
 
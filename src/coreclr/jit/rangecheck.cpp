@@ -184,6 +184,150 @@ bool RangeCheck::BetweenBounds(Range& range, GenTree* upper, int arrSize)
     return false;
 }
 
+//------------------------------------------------------------------------
+// GetAddedConstant: Check if a value number is the sum of another value number and a constant
+//
+// Arguments:
+//    vn     - the value number to check
+//    baseVN - the value number that is expected to be one of the operands
+//    pCns   - [out] the constant that is added to baseVN
+//
+// Return Value:
+//    True iff vn is "baseVN + cns" or "baseVN - cns" for an int32 constant that can be negated.
+//
+bool RangeCheck::GetAddedConstant(ValueNum vn, ValueNum baseVN, int* pCns)
+{
+    ValueNumStore* vnStore = m_pCompiler->vnStore;
+
+    VNFuncApp funcApp;
+    if (!vnStore->GetVNFunc(vn, &funcApp) || (funcApp.m_arity != 2))
+    {
+        return false;
+    }
+
+    ValueNum cnsVN;
+    if ((funcApp.m_func == VNFunc(GT_ADD)) && (funcApp.m_args[0] == baseVN))
+    {
+        cnsVN = funcApp.m_args[1];
+    }
+    else if ((funcApp.m_func == VNFunc(GT_ADD)) && (funcApp.m_args[1] == baseVN))
+    {
+        cnsVN = funcApp.m_args[0];
+    }
+    else if ((funcApp.m_func == VNFunc(GT_SUB)) && (funcApp.m_args[0] == baseVN))
+    {
+        cnsVN = funcApp.m_args[1];
+    }
+    else
+    {
+        return false;
+    }
+
+    if (!vnStore->IsVNInt32Constant(cnsVN))
+    {
+        return false;
+    }
+
+    int cns = vnStore->ConstantValue<int>(cnsVN);
+    if (cns == INT_MIN)
+    {
+        return false;
+    }
+
+    *pCns = (funcApp.m_func == VNFunc(GT_SUB)) ? -cns : cns;
+    return true;
+}
+
+//------------------------------------------------------------------------
+// IsDecreasingIndexInBounds: Check if an index counts down from a value within bounds
+//
+// Arguments:
+//    index    - the index of the bounds check
+//    arrLenVN - the value number of the length
+//    arrSize  - the length, if it is known to be constant, or <= 0
+//
+// Return Value:
+//    True iff the index is known to be within [0, length - 1].
+//
+// Notes:
+//    The general range computation cannot bound a phi whose loop carried arguments decrease,
+//    its upper limit is "dependent". Such an index is in bounds when:
+//      * every value of the phi is asserted to be non-negative on its incoming edge, so the
+//        lower limit of the phi itself is a non-negative constant, and
+//      * every phi argument is either "phi - cns" for a positive cns, which cannot underflow
+//        given the lower limit and never exceeds the phi's initial values, or an initial value
+//        "length - cns" (resp. a constant below the known length) for a positive cns.
+//
+bool RangeCheck::IsDecreasingIndexInBounds(GenTree* index, ValueNum arrLenVN, int arrSize)
+{
+    if (!index->OperIs(GT_LCL_VAR))
+    {
+        return false;
+    }
+
+    LclSsaVarDsc* ssaDef = GetSsaDefAsg(index->AsLclVarCommon());
+    if (ssaDef == nullptr)
+    {
+        return false;
+    }
+
+    GenTree* phi = ssaDef->GetAssignment()->gtGetOp2();
+    if (!phi->OperIs(GT_PHI))
+    {
+        return false;
+    }
+
+    // The phi range is computed (and cached) while computing the range of the index.
+    Range* phiRange = nullptr;
+    if (!GetRangeMap()->Lookup(phi, &phiRange) || !phiRange->LowerLimit().IsConstant() ||
+        (phiRange->LowerLimit().GetConstant() < 0))
+    {
+        return false;
+    }
+
+    ValueNumStore* vnStore = m_pCompiler->vnStore;
+    ValueNum       idxVN   = vnStore->VNConservativeNormalValue(index->gtVNPair);
+
+    for (GenTreePhi::Use& use : phi->AsPhi()->Uses())
+    {
+        ValueNum argVN = vnStore->VNConservativeNormalValue(use.GetNode()->gtVNPair);
+        int      cns   = 0;
+
+        if (GetAddedConstant(argVN, idxVN, &cns))
+        {
+            // Loop carried value, it must decrease.
+            if (cns >= 0)
+            {
+                return false;
+            }
+        }
+        else if (vnStore->IsVNInt32Constant(argVN))
+        {
+            // Initial value is a constant, it must be below the known length.
+            cns = vnStore->ConstantValue<int>(argVN);
+            if ((arrSize <= 0) || (cns >= arrSize))
+            {
+                return false;
+            }
+        }
+        else if (GetAddedConstant(argVN, arrLenVN, &cns))
+        {
+            // Initial value is "length - cns".
+            if (cns >= 0)
+            {
+                return false;
+            }
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    JITDUMP("[%06d] decreases from an initial value within bounds\n", Compiler::dspTreeID(index));
+    return true;
+}
+
 void RangeCheck::OptimizeRangeCheck(BasicBlock* block, Statement* stmt, GenTree* treeParent)
 {
     // Check if we are dealing with a bounds check node.
@@ -282,6 +426,15 @@ void RangeCheck::OptimizeRangeCheck(BasicBlock* block, Statement* stmt, GenTree*
         return;
     }
 
+    // A loop that counts down leaves the upper limit dependent on the loop carried value.
+    if (range.UpperLimit().IsDependent() && !IsOverBudget() &&
+        IsDecreasingIndexInBounds(treeIndex, arrLenVn, arrSize))
+    {
+        JITDUMP("[RangeCheck::OptimizeRangeCheck] Decreasing index in bounds\n");
+        m_pCompiler->optRemoveRangeCheck(bndsChk, comma, stmt);
+        return;
+    }
+
     if (DoesOverflow(block, treeIndex))
     {
         JITDUMP("Method determined to overflow.\n");
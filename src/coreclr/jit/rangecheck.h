@@ -440,6 +440,13 @@ public:
     // TODO-CQ: This is not general enough.
     bool BetweenBounds(Range& range, GenTree* upper, int arrSize);
 
+    // Check whether "index" is an induction variable that counts down towards zero from an
+    // initial value within the bounds, as in "for (i = a.Length - 1; i >= 0; i--)".
+    bool IsDecreasingIndexInBounds(GenTree* index, ValueNum arrLenVN, int arrSize);
+
+    // Helper for IsDecreasingIndexInBounds: check whether "vn" is "baseVN + cns" and return "cns".
+    bool GetAddedConstant(ValueNum vn, ValueNum baseVN, int* pCns);
+
     // Entry point to optimize range checks in the block. Assumes value numbering
     // and assertion prop phases are completed.
     void OptimizeRangeChecks();
@@ -1547,6 +1547,7 @@ void SsaBuilder::Build()
 
     // Compute liveness on the graph.
     m_pCompiler->fgLocalVarLiveness();
+    m_pCompiler->fgReportNoHeapWrites();
     EndPhase(PHASE_BUILD_SSA_LIVENESS);
 
     m_pCompiler->optRemoveRedundantZeroInits();
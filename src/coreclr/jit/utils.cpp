@@ -720,6 +720,34 @@ bool ConfigMethodRange::Contains(unsigned hash)
     return false;
 }
 
+// Ranges are typically function statics shared by all compiling threads;
+// this lock serializes their initialization.
+static CritSecObject s_configMethodRangeInitLock;
+
+//------------------------------------------------------------------------
+// EnsureInit: parse the range string, if that has not been done yet
+//
+// Arguments:
+//    rangeStr -- string to parse (may be nullptr)
+//    capacity -- number ranges to allocate in the range array
+//
+// Notes:
+//    Safe to call from several compiling threads at once.
+
+void ConfigMethodRange::EnsureInit(const WCHAR* rangeStr, unsigned capacity)
+{
+    CritSecHolder initLock(s_configMethodRangeInitLock);
+
+    // Make sure that the memory was zero initialized
+    assert(m_inited == 0 || m_inited == 1);
+
+    if (!m_inited)
+    {
+        InitRanges(rangeStr, capacity);
+        assert(m_inited == 1);
+    }
+}
+
 //------------------------------------------------------------------------
 // InitRanges: parse the range string and set up the range info
 //
@@ -1396,6 +1424,7 @@ void HelperCallProperties::init()
             case CORINFO_HELP_CLASSINIT_SHARED_DYNAMICCLASS:
             case CORINFO_HELP_GETSHARED_GCTHREADSTATIC_BASE_DYNAMICCLASS:
             case CORINFO_HELP_GETSHARED_NONGCTHREADSTATIC_BASE_DYNAMICCLASS:
+            case CORINFO_HELP_GETSHARED_NONGCTHREADSTATIC_BASE_OPTIMIZED:
             case CORINFO_HELP_GETSTATICFIELDADDR_CONTEXT:
             case CORINFO_HELP_GETSTATICFIELDADDR_TLS:
             case CORINFO_HELP_GETGENERICS_GCSTATIC_BASE:
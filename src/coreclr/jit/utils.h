@@ -157,17 +157,7 @@ public:
     bool Contains(unsigned hash);
 
     // Ensure the range string has been parsed.
-    void EnsureInit(const WCHAR* rangeStr, unsigned capacity = DEFAULT_CAPACITY)
-    {
-        // Make sure that the memory was zero initialized
-        assert(m_inited == 0 || m_inited == 1);
-
-        if (!m_inited)
-        {
-            InitRanges(rangeStr, capacity);
-            assert(m_inited == 1);
-        }
-    }
+    void EnsureInit(const WCHAR* rangeStr, unsigned capacity = DEFAULT_CAPACITY);
 
     bool IsEmpty() const
     {
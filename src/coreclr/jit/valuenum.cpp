@@ -416,6 +416,7 @@ bool ValueNumStore::IsIntZero(T v)
 ValueNumStore::ValueNumStore(Compiler* comp, CompAllocator alloc)
     : m_pComp(comp)
     , m_alloc(alloc)
+    , m_mapAlloc(comp->getAllocator(CMK_ValueNumberMap))
     , m_nextChunkBase(0)
     , m_fixedPointMapSels(alloc, 8)
     , m_checkedBoundVNs(alloc)
@@ -9420,8 +9421,12 @@ void Compiler::fgValueNumberCall(GenTreeCall* call)
             call->gtVNPair.SetBoth(vnStore->VNForExpr(compCurBB, call->TypeGet()));
         }
 
-        // For now, arbitrary side effect on GcHeap/ByrefExposed.
-        fgMutateGcHeap(call DEBUGARG("CALL"));
+        // Calls to methods known not to write to the heap leave GcHeap/ByrefExposed unchanged.
+        if (!call->HasNoHeapWrites())
+        {
+            // For now, arbitrary side effect on GcHeap/ByrefExposed.
+            fgMutateGcHeap(call DEBUGARG("CALL"));
+        }
     }
 }
 
@@ -9600,6 +9605,9 @@ VNFunc Compiler::fgValueNumberJitHelperMethodVNFunc(CorInfoHelpFunc helpFunc)
         case CORINFO_HELP_GETSHARED_NONGCTHREADSTATIC_BASE_DYNAMICCLASS:
             vnf = VNF_GetsharedNongcthreadstaticBaseDynamicclass;
             break;
+        case CORINFO_HELP_GETSHARED_NONGCTHREADSTATIC_BASE_OPTIMIZED:
+            vnf = VNF_GetsharedNongcthreadstaticBaseOptimized;
+            break;
         case CORINFO_HELP_GETSTATICFIELDADDR_CONTEXT:
             vnf = VNF_GetStaticAddrContext;
             break;
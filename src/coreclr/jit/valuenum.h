@@ -96,26 +96,24 @@ public:
     // VNMap - map from something to ValueNum, where something is typically a constant value or a VNFunc
     //         This class has two purposes - to abstract the implementation and to validate the ValueNums
     //         being stored or retrieved.
+    //         These maps get very large for big methods, so they use open addressing, which stores
+    //         the entries inline rather than as one node per entry.
     template <class fromType, class keyfuncs = JitLargePrimitiveKeyFuncs<fromType>>
-    class VNMap : public JitHashTable<fromType, keyfuncs, ValueNum>
+    class VNMap : public JitOpenAddressingHashTable<fromType, keyfuncs, ValueNum>
     {
     public:
-        VNMap(CompAllocator alloc) : JitHashTable<fromType, keyfuncs, ValueNum>(alloc)
+        VNMap(CompAllocator alloc) : JitOpenAddressingHashTable<fromType, keyfuncs, ValueNum>(alloc)
         {
         }
-        ~VNMap()
-        {
-            ~VNMap<fromType, keyfuncs>::JitHashTable();
-        }
 
         bool Set(fromType k, ValueNum val)
         {
             assert(val != RecursiveVN);
-            return JitHashTable<fromType, keyfuncs, ValueNum>::Set(k, val);
+            return JitOpenAddressingHashTable<fromType, keyfuncs, ValueNum>::Set(k, val);
         }
         bool Lookup(fromType k, ValueNum* pVal = nullptr) const
         {
-            bool result = JitHashTable<fromType, keyfuncs, ValueNum>::Lookup(k, pVal);
+            bool result = JitOpenAddressingHashTable<fromType, keyfuncs, ValueNum>::Lookup(k, pVal);
             assert(!result || *pVal != RecursiveVN);
             return result;
         }
@@ -127,6 +125,9 @@ private:
     // For allocations.  (Other things?)
     CompAllocator m_alloc;
 
+    // For the VNMaps, so their memory is reported separately from the chunks.
+    CompAllocator m_mapAlloc;
+
     // TODO-Cleanup: should transform "attribs" into a struct with bit fields.  That would be simpler...
 
     enum VNFOpAttrib
@@ -1149,7 +1150,7 @@ private:
     {
         if (m_intCnsMap == nullptr)
         {
-            m_intCnsMap = new (m_alloc) IntToValueNumMap(m_alloc);
+            m_intCnsMap = new (m_mapAlloc) IntToValueNumMap(m_mapAlloc);
         }
         return m_intCnsMap;
     }
@@ -1160,7 +1161,7 @@ private:
     {
         if (m_longCnsMap == nullptr)
         {
-            m_longCnsMap = new (m_alloc) LongToValueNumMap(m_alloc);
+            m_longCnsMap = new (m_mapAlloc) LongToValueNumMap(m_mapAlloc);
         }
         return m_longCnsMap;
     }
@@ -1171,7 +1172,7 @@ private:
     {
         if (m_handleMap == nullptr)
         {
-            m_handleMap = new (m_alloc) HandleToValueNumMap(m_alloc);
+            m_handleMap = new (m_mapAlloc) HandleToValueNumMap(m_mapAlloc);
         }
         return m_handleMap;
     }
@@ -1190,7 +1191,7 @@ private:
     {
         if (m_floatCnsMap == nullptr)
         {
-            m_floatCnsMap = new (m_alloc) FloatToValueNumMap(m_alloc);
+            m_floatCnsMap = new (m_mapAlloc) FloatToValueNumMap(m_mapAlloc);
         }
         return m_floatCnsMap;
     }
@@ -1210,7 +1211,7 @@ private:
     {
         if (m_doubleCnsMap == nullptr)
         {
-            m_doubleCnsMap = new (m_alloc) DoubleToValueNumMap(m_alloc);
+            m_doubleCnsMap = new (m_mapAlloc) DoubleToValueNumMap(m_mapAlloc);
         }
         return m_doubleCnsMap;
     }
@@ -1221,7 +1222,7 @@ private:
     {
         if (m_byrefCnsMap == nullptr)
         {
-            m_byrefCnsMap = new (m_alloc) ByrefToValueNumMap(m_alloc);
+            m_byrefCnsMap = new (m_mapAlloc) ByrefToValueNumMap(m_mapAlloc);
         }
         return m_byrefCnsMap;
     }
@@ -1239,7 +1240,7 @@ private:
     {
         if (m_VNFunc0Map == nullptr)
         {
-            m_VNFunc0Map = new (m_alloc) VNFunc0ToValueNumMap(m_alloc);
+            m_VNFunc0Map = new (m_mapAlloc) VNFunc0ToValueNumMap(m_mapAlloc);
         }
         return m_VNFunc0Map;
     }
@@ -1257,7 +1258,7 @@ private:
     {
         if (m_VNFunc1Map == nullptr)
         {
-            m_VNFunc1Map = new (m_alloc) VNFunc1ToValueNumMap(m_alloc);
+            m_VNFunc1Map = new (m_mapAlloc) VNFunc1ToValueNumMap(m_mapAlloc);
         }
         return m_VNFunc1Map;
     }
@@ -1275,7 +1276,7 @@ private:
     {
         if (m_VNFunc2Map == nullptr)
         {
-            m_VNFunc2Map = new (m_alloc) VNFunc2ToValueNumMap(m_alloc);
+            m_VNFunc2Map = new (m_mapAlloc) VNFunc2ToValueNumMap(m_mapAlloc);
         }
         return m_VNFunc2Map;
     }
@@ -1293,7 +1294,7 @@ private:
     {
         if (m_VNFunc3Map == nullptr)
         {
-            m_VNFunc3Map = new (m_alloc) VNFunc3ToValueNumMap(m_alloc);
+            m_VNFunc3Map = new (m_mapAlloc) VNFunc3ToValueNumMap(m_mapAlloc);
         }
         return m_VNFunc3Map;
     }
@@ -1311,7 +1312,7 @@ private:
     {
         if (m_VNFunc4Map == nullptr)
         {
-            m_VNFunc4Map = new (m_alloc) VNFunc4ToValueNumMap(m_alloc);
+            m_VNFunc4Map = new (m_mapAlloc) VNFunc4ToValueNumMap(m_mapAlloc);
         }
         return m_VNFunc4Map;
     }
@@ -1493,6 +1493,7 @@ STDMETHODIMP RegMeta::GetTokenFromTypeSpec(   // [IN] S_OK or error.
         pTypeSpecRec,
         pvSig,
         cbSig));
+    IfFailGo(m_pStgdb->m_MiniMd.AddSignatureToHash(TBL_TypeSpec, *ptypespec));
     IfFailGo(UpdateENCLog(*ptypespec));
 
 ErrExit:
@@ -2385,6 +2386,7 @@ STDMETHODIMP RegMeta::DefineMethodSpec( // S_OK or error
 
     MethodSpecRec   *pRecord = 0;       // The MethodSpec record.
     RID             iRecord;            // RID of new MethodSpec record.
+    bool            fNewRecord = false; // Was a new MethodSpec record added?
 
 
     LOG((LOGMD, "MD RegMeta::DefineMethodSpec(0x%08x, 0x%08x, 0x%08x, 0x%08x)\n",
@@ -2429,6 +2431,7 @@ STDMETHODIMP RegMeta::DefineMethodSpec( // S_OK or error
     if (!pRecord)
     {   // Create the record.
         IfFailGo(m_pStgdb->m_MiniMd.AddMethodSpecRecord(&pRecord, &iRecord));
+        fNewRecord = true;
 
     /*GENERICS: do we need to do anything like this?
       Probably not, since SetMemberDefDirty is for ref to def optimization, and there are no method spec "refs".
@@ -2444,8 +2447,8 @@ STDMETHODIMP RegMeta::DefineMethodSpec( // S_OK or error
     IfFailGo(m_pStgdb->m_MiniMd.PutToken(TBL_MethodSpec, MethodSpecRec::COL_Method, pRecord, tkImport));
     IfFailGo(m_pStgdb->m_MiniMd.PutBlob(TBL_MethodSpec, MethodSpecRec::COL_Instantiation, pRecord,
                                 pvSigBlob, cbSigBlob));
-    /*@GENERICS: todo: update MethodSpec hash table  */
-    /* IfFailGo(m_pStgdb->m_MiniMd.AddMemberRefToHash(*pmi) ); */
+    if (fNewRecord)
+        IfFailGo(m_pStgdb->m_MiniMd.AddSignatureToHash(TBL_MethodSpec, *pmi));
 
     IfFailGo(UpdateENCLog(*pmi));
 
@@ -22,7 +22,6 @@
 //*******************************************************************************
 // Find the MethodSpec by Method and Instantiation
 //*******************************************************************************
-//@GENERICS: todo: look in hashtable (cf. MetaModelRW.cpp) if necessary
 HRESULT ImportHelper::FindMethodSpecByMethodAndInstantiation(
     CMiniMdRW   *pMiniMd,                   // [IN] the minimd to lookup
     /*mdMethodDefOrRef*/ mdToken tkMethod,  // [IN] MethodSpec method field
@@ -38,9 +37,18 @@ HRESULT ImportHelper::FindMethodSpecByMethodAndInstantiation(
     ULONG       cbInstantiationTmp;
     ULONG       cMethodSpecs;
     ULONG       i;
+    CMiniMdRW::HashSearchResult rtn;
 
     _ASSERTE(pMethodSpec);
 
+    *pMethodSpec = TokenFromRid(rid, mdtMethodSpec); // to know what to ignore
+    rtn = pMiniMd->FindSignatureFromHash(TBL_MethodSpec, tkMethod, pInstantiation, cbInstantiation, pMethodSpec);
+    if (rtn == CMiniMdRW::Found)
+        return S_OK;
+    else if (rtn == CMiniMdRW::NotFound)
+        return CLDB_E_RECORD_NOTFOUND;
+    _ASSERTE(rtn == CMiniMdRW::NoTable);
+
     cMethodSpecs = pMiniMd->getCountMethodSpecs();
 
     // linear scan through the MethodSpec table
@@ -511,11 +519,18 @@ HRESULT ImportHelper::FindStandAloneSig(
     StandAloneSigRec    *pRec;
     const COR_SIGNATURE *pbSigTmp;          // Signature.
     ULONG       cbSigTmp;                   // Size of signature.
-
+    CMiniMdRW::HashSearchResult rtn;
 
     _ASSERTE(cbSig &&  psa);
     *psa = mdSignatureNil;
 
+    rtn = pMiniMd->FindSignatureFromHash(TBL_StandAloneSig, 0, pbSig, cbSig, psa);
+    if (rtn == CMiniMdRW::Found)
+        return S_OK;
+    else if (rtn == CMiniMdRW::NotFound)
+        return CLDB_E_RECORD_NOTFOUND;
+    _ASSERTE(rtn == CMiniMdRW::NoTable);
+
     cRecs = pMiniMd->getCountStandAloneSigs();
 
     // Search for the StandAloneSignature
@@ -550,11 +565,19 @@ ImportHelper::FindTypeSpec(
     TypeSpecRec * pRec;
     const COR_SIGNATURE * pbSigTmp; // Signature.
     ULONG                 cbSigTmp; // Size of signature.
+    CMiniMdRW::HashSearchResult rtn;
 
     // cbSig can be 0
     _ASSERTE(pTypeSpec != NULL);
     *pTypeSpec = mdSignatureNil;
 
+    rtn = pMiniMd->FindSignatureFromHash(TBL_TypeSpec, 0, pbSig, cbSig, pTypeSpec);
+    if (rtn == CMiniMdRW::Found)
+        return S_OK;
+    else if (rtn == CMiniMdRW::NotFound)
+        return CLDB_E_RECORD_NOTFOUND;
+    _ASSERTE(rtn == CMiniMdRW::NoTable);
+
     cRecs = pMiniMd->getCountTypeSpecs();
 
     // Search for the TypeSpec
@@ -1913,6 +1936,7 @@ ImportHelper::MergeUpdateTokenInFieldSig(
                             (PCCOR_SIGNATURE) (qkTypeSpecSigEmit.Ptr()),
                             cbTypeSpecEmit));
                         tkRidTo = TokenFromRid( tkRidTo, mdtTypeSpec );
+                        IfFailGo(pMiniMdEmit->AddSignatureToHash(TBL_TypeSpec, tkRidTo));
                         IfFailGo(pMiniMdEmit->UpdateENCLog(tkRidTo));
                     }
                     IfFailGo( hr );
@@ -1187,6 +1187,7 @@ HRESULT RegMeta::_GetTokenFromSig(              // S_OK or error.
     // Save signature.
     IfFailGo(m_pStgdb->m_MiniMd.PutBlob(TBL_StandAloneSig, StandAloneSigRec::COL_Signature,
                                 pSigRec, pvSig, cbSig));
+    IfFailGo(m_pStgdb->m_MiniMd.AddSignatureToHash(TBL_StandAloneSig, *pmsig));
     IfFailGo(UpdateENCLog(*pmsig));
 ErrExit:
     return hr;
@@ -703,6 +703,9 @@ CMiniMdRW::CMiniMdRW()
  :  m_pMemberRefHash(0),
     m_pMemberDefHash(0),
     m_pNamedItemHash(0),
+    m_pTypeSpecHash(0),
+    m_pStandAloneSigHash(0),
+    m_pMethodSpecHash(0),
     m_pHandler(0),
     m_cbSaveSize(0),
     m_fIsReadOnly(false),
@@ -806,6 +809,12 @@ CMiniMdRW::~CMiniMdRW()
         delete m_pMemberDefHash;
     if (m_pNamedItemHash)
         delete m_pNamedItemHash;
+    if (m_pTypeSpecHash)
+        delete m_pTypeSpecHash;
+    if (m_pStandAloneSigHash)
+        delete m_pStandAloneSigHash;
+    if (m_pMethodSpecHash)
+        delete m_pMethodSpecHash;
     if (m_pMethodMap)
         delete m_pMethodMap;
     if (m_pFieldMap)
@@ -7722,6 +7731,201 @@ CMiniMdRW::CompareNamedItems(   // S_OK match, S_FALSE no match.
     return S_OK;
 } // CMiniMdRW::CompareNamedItems
 
+//*****************************************************************************
+// Return the hash slot of a table that is hashed by signature.
+//*****************************************************************************
+CMetaDataHashBase **
+CMiniMdRW::GetSignatureHashSlot(
+    ULONG ixTbl)        // Table with the item.
+{
+    switch (ixTbl)
+    {
+    case TBL_TypeSpec:
+        return &m_pTypeSpecHash;
+    case TBL_StandAloneSig:
+        return &m_pStandAloneSigHash;
+    case TBL_MethodSpec:
+        return &m_pMethodSpecHash;
+    default:
+        _ASSERTE(!"Table is not hashed by signature");
+        return NULL;
+    }
+} // CMiniMdRW::GetSignatureHashSlot
+
+//*****************************************************************************
+// Get the key of a row of a table that is hashed by signature.
+//*****************************************************************************
+__checkReturn
+HRESULT
+CMiniMdRW::GetSignatureItem(
+    ULONG            ixTbl,         // Table with the item.
+    RID              rid,           // Row of the item.
+    mdToken         *ptkParent,     // [OUT] Method of a MethodSpec, 0 otherwise.
+    PCCOR_SIGNATURE *ppbSig,        // [OUT] Signature.
+    ULONG           *pcbSig)        // [OUT] Size of signature.
+{
+    HRESULT hr;
+
+    *ptkParent = 0;
+    switch (ixTbl)
+    {
+    case TBL_TypeSpec:
+        {
+            TypeSpecRec *pRec;
+            IfFailRet(GetTypeSpecRecord(rid, &pRec));
+            return getSignatureOfTypeSpec(pRec, ppbSig, pcbSig);
+        }
+    case TBL_StandAloneSig:
+        {
+            StandAloneSigRec *pRec;
+            IfFailRet(GetStandAloneSigRecord(rid, &pRec));
+            return getSignatureOfStandAloneSig(pRec, ppbSig, pcbSig);
+        }
+    case TBL_MethodSpec:
+        {
+            MethodSpecRec *pRec;
+            IfFailRet(GetMethodSpecRecord(rid, &pRec));
+            *ptkParent = getMethodOfMethodSpec(pRec);
+            return getInstantiationOfMethodSpec(pRec, ppbSig, pcbSig);
+        }
+    default:
+        _ASSERTE(!"Table is not hashed by signature");
+        return E_INVALIDARG;
+    }
+} // CMiniMdRW::GetSignatureItem
+
+//*****************************************************************************
+// Create the hash of a table that is hashed by signature, once the table is
+// big enough for the linear duplicate search to matter.
+//*****************************************************************************
+__checkReturn
+HRESULT
+CMiniMdRW::CreateSignatureHash(
+    ULONG ixTbl)        // Table to hash.
+{
+    HRESULT             hr = S_OK;
+    CMetaDataHashBase **ppHash = GetSignatureHashSlot(ixTbl);
+
+    if (*ppHash == NULL)
+    {
+        ULONG ridEnd = GetCountRecs(ixTbl);
+        if (ridEnd + 1 > INDEX_ROW_COUNT_THRESHOLD)
+        {
+            // Create a new hash.
+            NewHolder<CMetaDataHashBase> pHash = new (nothrow) CMetaDataHashBase();
+            IfNullGo(pHash);
+            IfFailGo(pHash->NewInit(
+                g_HashSize[GetMetaDataSizeIndex(&m_OptionValue)]));
+
+            // Scan every entry already in the table, add it to the hash.
+            for (ULONG index = 1; index <= ridEnd; index++)
+            {
+                mdToken         tkPar;
+                PCCOR_SIGNATURE pbSig;
+                ULONG           cbSig;
+                IfFailGo(GetSignatureItem(ixTbl, index, &tkPar, &pbSig, &cbSig));
+
+                TOKENHASHENTRY * pEntry = pHash->Add(HashSignatureItem(tkPar, pbSig, cbSig));
+                IfNullGo(pEntry);
+                pEntry->tok = TokenFromRid(index, g_TblIndex[ixTbl].m_Token);
+            }
+
+            if (InterlockedCompareExchangeT<CMetaDataHashBase *>(ppHash, pHash, NULL) == NULL)
+            {   // We won the initialization race
+                pHash.SuppressRelease();
+            }
+        }
+    }
+
+ErrExit:
+    return hr;
+} // CMiniMdRW::CreateSignatureHash
+
+//*****************************************************************************
+// Add a new row of a table that is hashed by signature to its hash.
+//*****************************************************************************
+__checkReturn
+HRESULT
+CMiniMdRW::AddSignatureToHash(
+    ULONG   ixTbl,      // Table with the new item.
+    mdToken tk)         // Token of new guy.
+{
+    HRESULT hr = S_OK;
+
+    // If the hash exists, we will add to it - requires write-lock
+    INDEBUG(Debug_CheckIsLockedForWrite();)
+
+    CMetaDataHashBase *pHash = *GetSignatureHashSlot(ixTbl);
+
+    // If the hash table hasn't been built it, see if it should get faulted in.
+    if (pHash == NULL)
+    {
+        IfFailGo(CreateSignatureHash(ixTbl));
+    }
+    else
+    {
+        mdToken         tkPar;
+        PCCOR_SIGNATURE pbSig;
+        ULONG           cbSig;
+        IfFailGo(GetSignatureItem(ixTbl, RidFromToken(tk), &tkPar, &pbSig, &cbSig));
+
+        TOKENHASHENTRY * pEntry = pHash->Add(HashSignatureItem(tkPar, pbSig, cbSig));
+        IfNullGo(pEntry);
+        pEntry->tok = TokenFromRid(RidFromToken(tk), g_TblIndex[ixTbl].m_Token);
+    }
+
+ErrExit:
+    return hr;
+} // CMiniMdRW::AddSignatureToHash
+
+//*****************************************************************************
+// If the hash is built, search for the item. Ignore token *ptk.
+//*****************************************************************************
+CMiniMdRW::HashSearchResult
+CMiniMdRW::FindSignatureFromHash(
+    ULONG           ixTbl,      // Table with the item.
+    mdToken         tkParent,   // Method of a MethodSpec, 0 otherwise.
+    PCCOR_SIGNATURE pbSig,      // Signature.
+    ULONG           cbSig,      // Size of signature.
+    mdToken *       ptk)        // IN: Ignored token. OUT: Return if found.
+{
+    CMetaDataHashBase *pHash = *GetSignatureHashSlot(ixTbl);
+
+    // If the table is there, look for the item in the chain of items.
+    if (pHash != NULL)
+    {
+        TOKENHASHENTRY *p;
+        int             pos;
+
+        // Go through every entry in the hash chain looking for ours.
+        for (p = pHash->FindFirst(HashSignatureItem(tkParent, pbSig, cbSig), pos);
+             p != NULL;
+             p = pHash->FindNext(pos))
+        {
+            if (*ptk == p->tok)
+                continue;
+
+            mdToken         tkParTmp;
+            PCCOR_SIGNATURE pbSigTmp;
+            ULONG           cbSigTmp;
+            if (FAILED(GetSignatureItem(ixTbl, RidFromToken(p->tok), &tkParTmp, &pbSigTmp, &cbSigTmp)))
+                continue;
+
+            if ((tkParTmp == tkParent) && (cbSigTmp == cbSig) && (memcmp(pbSigTmp, pbSig, cbSig) == 0))
+            {
+                *ptk = p->tok;
+                return Found;
+            }
+        }
+
+        return NotFound;
+    }
+    else
+    {
+        return NoTable;
+    }
+} // CMiniMdRW::FindSignatureFromHash
+
 //*****************************************************************************
 // Add <md, td> entry to the MethodDef map look up table
 //*****************************************************************************
@@ -52,14 +52,14 @@ public:
         return m_BlobPool.InitOnMemReadOnly((void *)sourceData.GetDataPointer(), sourceData.GetSize());
     }
 
-#ifdef FEATURE_PREJIT
+#ifdef FEATURE_METADATA_HOT_DATA
     // Can be called multiple times.
     inline void InitializeHotData(
         HotHeap hotHeap)
     {
         m_BlobPool.InitHotData(hotHeap);
     }
-#endif //FEATURE_PREJIT
+#endif //FEATURE_METADATA_HOT_DATA
 
     inline void Delete()
     {
@@ -58,14 +58,14 @@ public:
         return m_GuidPool.InitOnMemReadOnly((void *)sourceData.GetDataPointer(), sourceData.GetSize());
     }
 
-#ifdef FEATURE_PREJIT
+#ifdef FEATURE_METADATA_HOT_DATA
     // Can be called multiple times.
     inline void InitializeHotData(
         HotHeap hotHeap)
     {
         m_GuidPool.InitHotData(hotHeap);
     }
-#endif //FEATURE_PREJIT
+#endif //FEATURE_METADATA_HOT_DATA
 
     // Destroys the guid heap and all its allocated data. Can run on uninitialized guid heap.
     inline void Delete()
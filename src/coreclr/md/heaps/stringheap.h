@@ -52,14 +52,14 @@ public:
         return m_StringPool.InitOnMemReadOnly((void *)sourceData.GetDataPointer(), sourceData.GetSize());
     }
 
-#ifdef FEATURE_PREJIT
+#ifdef FEATURE_METADATA_HOT_DATA
     // Can be called multiple times.
     inline void InitializeHotData(
         HotHeap hotHeap)
     {
         m_StringPool.InitHotData(hotHeap);
     }
-#endif //FEATURE_PREJIT
+#endif //FEATURE_METADATA_HOT_DATA
 
     inline void Delete()
     {
@@ -91,47 +91,115 @@ HotTable::GetData(
 } // HotTable::GetData
 
 // static
-void
-HotTable::CheckTables(struct HotTablesDirectory *pHotTablesDirectory)
+__checkReturn
+HRESULT
+HotTable::CheckTables(
+    struct HotTablesDirectory *pHotTablesDirectory,
+    UINT32                     cbHotTablesData,
+    const UINT32              *rgcRecords,
+    const UINT32              *rgcbRecordSize)
 {
-#ifdef _DEBUG
-    _ASSERTE(pHotTablesDirectory->m_nMagic == HotTablesDirectory::const_nMagic);
+    if (pHotTablesDirectory->m_nMagic != HotTablesDirectory::const_nMagic)
+    {
+        Debug_ReportError("Invalid hot tables directory - wrong magic number.");
+        return METADATA_E_INVALID_FORMAT;
+    }
 
     for (UINT32 nTableIndex = 0; nTableIndex < TBL_COUNT; nTableIndex++)
     {
-        if (pHotTablesDirectory->m_rgTableHeader_SignedOffset[nTableIndex] != 0)
+        INT32 nTableOffset = pHotTablesDirectory->m_rgTableHeader_SignedOffset[nTableIndex];
+        if (nTableOffset == 0)
+            continue;
+
+        // The table header and its data are in front of the directory.
+        if ((nTableOffset > 0) ||
+            ((UINT32)-(INT64)nTableOffset > cbHotTablesData) ||
+            ((UINT32)-(INT64)nTableOffset < sizeof(struct HotTableHeader)))
         {
-            struct HotTableHeader *pHotTableHeader = GetTableHeader(pHotTablesDirectory, nTableIndex);
+            Debug_ReportError("Invalid hot tables directory - table header offset out of range.");
+            return METADATA_E_INVALID_FORMAT;
+        }
+        UINT64 cbAvailable = (UINT64)-(INT64)nTableOffset;
+
+        struct HotTableHeader *pHotTableHeader = GetTableHeader(pHotTablesDirectory, nTableIndex);
+        BYTE  *pHotTableHeaderData = (BYTE *)pHotTableHeader;
+        UINT32 cHotRecords = pHotTableHeader->m_cTableRecordCount;
+        UINT32 cRecords = rgcRecords[nTableIndex];
 
-            _ASSERTE((pHotTableHeader->m_cTableRecordCount > 0) && (pHotTableHeader->m_cTableRecordCount <= USHRT_MAX));
-            if (pHotTableHeader->m_nFirstLevelTable_PositiveOffset == 0)
+        if ((cHotRecords == 0) || (cHotRecords > USHRT_MAX))
+        {
+            Debug_ReportError("Invalid hot table header - wrong record count.");
+            return METADATA_E_INVALID_FORMAT;
+        }
+
+        if (pHotTableHeader->m_nFirstLevelTable_PositiveOffset == 0)
+        {
+            // The whole table is replicated in the hot data.
+            if ((pHotTableHeader->m_nSecondLevelTable_PositiveOffset != 0) ||
+                (pHotTableHeader->m_offsIndexMappingTable != 0) ||
+                (pHotTableHeader->m_offsHotData != Align4(sizeof(struct HotTableHeader))) ||
+                (cHotRecords < cRecords))
             {
-                _ASSERTE(pHotTableHeader->m_nSecondLevelTable_PositiveOffset == 0);
-                _ASSERTE(pHotTableHeader->m_offsIndexMappingTable == 0);
-                _ASSERTE(pHotTableHeader->m_offsHotData == Align4(sizeof(struct HotTableHeader)));
+                Debug_ReportError("Invalid hot table header - inconsistent replicated table.");
+                return METADATA_E_INVALID_FORMAT;
             }
-            else
+        }
+        else
+        {
+            UINT32 nShiftCount = pHotTableHeader->m_shiftCount;
+            // The high order bits of the rids have to fit into the BYTE entries of the second level table.
+            if ((nShiftCount >= 16) || ((cRecords >> nShiftCount) > UCHAR_MAX))
             {
-                UINT32 nFirstLevelTableOffset = sizeof(struct HotTableHeader);
-                _ASSERTE(pHotTableHeader->m_nFirstLevelTable_PositiveOffset == nFirstLevelTableOffset);
-                UINT32 cbFirstLevelTableSize = sizeof(WORD) * ((1 << pHotTableHeader->m_shiftCount) + 1);
-
-                _ASSERTE(pHotTableHeader->m_nSecondLevelTable_PositiveOffset != 0);
-                UINT32 nSecondLevelTableOffset = nFirstLevelTableOffset + cbFirstLevelTableSize;
-                _ASSERTE(pHotTableHeader->m_nSecondLevelTable_PositiveOffset == nSecondLevelTableOffset);
-                UINT32 cbSecondLevelTableSize = sizeof(BYTE) * pHotTableHeader->m_cTableRecordCount;
-
-                _ASSERTE(pHotTableHeader->m_offsIndexMappingTable != 0);
-                UINT32 nIndexMappingTableOffset = nSecondLevelTableOffset + cbSecondLevelTableSize;
-                _ASSERTE(pHotTableHeader->m_offsIndexMappingTable == nIndexMappingTableOffset);
-                UINT32 cbIndexMappingTableSize = sizeof(WORD) * pHotTableHeader->m_cTableRecordCount;
-
-                UINT32 nHotDataOffset = nIndexMappingTableOffset + cbIndexMappingTableSize;
-                _ASSERTE(pHotTableHeader->m_offsHotData == Align4(nHotDataOffset));
+                Debug_ReportError("Invalid hot table header - wrong shift count.");
+                return METADATA_E_INVALID_FORMAT;
             }
+
+            UINT32 nFirstLevelTableOffset = sizeof(struct HotTableHeader);
+            UINT32 cFirstLevelTableCount = (1 << nShiftCount) + 1;
+            UINT32 nSecondLevelTableOffset = nFirstLevelTableOffset + sizeof(WORD) * cFirstLevelTableCount;
+            UINT32 nIndexMappingTableOffset = nSecondLevelTableOffset + sizeof(BYTE) * cHotRecords;
+            UINT32 nHotDataOffset = Align4(nIndexMappingTableOffset + sizeof(WORD) * cHotRecords);
+
+            if ((pHotTableHeader->m_nFirstLevelTable_PositiveOffset != nFirstLevelTableOffset) ||
+                (pHotTableHeader->m_nSecondLevelTable_PositiveOffset != nSecondLevelTableOffset) ||
+                (pHotTableHeader->m_offsIndexMappingTable != nIndexMappingTableOffset) ||
+                (pHotTableHeader->m_offsHotData != nHotDataOffset) ||
+                (nHotDataOffset > cbAvailable))
+            {
+                Debug_ReportError("Invalid hot table header - wrong table offsets.");
+                return METADATA_E_INVALID_FORMAT;
+            }
+
+            // The first level table holds ranges of the second level table.
+            WORD *pFirstLevelTable = (WORD *)(pHotTableHeaderData + nFirstLevelTableOffset);
+            for (UINT32 i = 0; i < cFirstLevelTableCount; i++)
+            {
+                if ((pFirstLevelTable[i] > cHotRecords) ||
+                    ((i > 0) && (pFirstLevelTable[i] < pFirstLevelTable[i - 1])))
+                {
+                    Debug_ReportError("Invalid hot table - first level table out of range.");
+                    return METADATA_E_INVALID_FORMAT;
+                }
+            }
+
+            WORD *pIndexMappingTable = (WORD *)(pHotTableHeaderData + nIndexMappingTableOffset);
+            for (UINT32 i = 0; i < cHotRecords; i++)
+            {
+                if (pIndexMappingTable[i] >= cHotRecords)
+                {
+                    Debug_ReportError("Invalid hot table - index mapping table out of range.");
+                    return METADATA_E_INVALID_FORMAT;
+                }
+            }
+        }
+
+        if ((UINT64)pHotTableHeader->m_offsHotData + (UINT64)cHotRecords * rgcbRecordSize[nTableIndex] > cbAvailable)
+        {
+            Debug_ReportError("Invalid hot table - hot records do not fit in front of the directory.");
+            return METADATA_E_INVALID_FORMAT;
         }
     }
-#endif //_DEBUG
+    return S_OK;
 } // HotTable::CheckTables
 
 };  // namespace MetaData
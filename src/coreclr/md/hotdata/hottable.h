@@ -49,7 +49,14 @@ public:
         return (struct HotTableHeader *)pHotTableHeaderData;
     }
 
-    static void CheckTables(struct HotTablesDirectory *pHotTablesDirectory);
+    // Verifies that the hot data of all tables lies within the cbHotTablesData bytes in front of
+    // the directory and that it can only map rows of the tables described by rgcRecords/rgcbRecordSize.
+    __checkReturn
+    static HRESULT CheckTables(
+        struct HotTablesDirectory *pHotTablesDirectory,
+        UINT32                     cbHotTablesData,
+        const UINT32              *rgcRecords,
+        const UINT32              *rgcbRecordSize);
 
 };  // class HotTable
 
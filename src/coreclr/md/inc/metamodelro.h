@@ -61,7 +61,32 @@ public:
         return m_UserStringHeap.GetBlob(nIndex, pData);
     }
 
-#ifdef FEATURE_PREJIT
+#ifdef FEATURE_METADATA_HOT_DATA
+    // Starts using the hot table data if it is consistent with the tables, hot rows are then
+    // read from the (usually few) hot pages instead of the full tables.
+    void InitHotTables(
+        struct MetaData::HotTablesDirectory *pHotTablesDirectory,
+        UINT32                               cbHotTablesData)
+    {
+        UINT32 rgcRecords[TBL_COUNT];
+        UINT32 rgcbRecordSize[TBL_COUNT];
+
+        for (UINT32 nTableIndex = 0; nTableIndex < TBL_COUNT; nTableIndex++)
+        {
+            rgcRecords[nTableIndex] = m_Schema.m_cRecs[nTableIndex];
+            rgcbRecordSize[nTableIndex] = m_TableDefs[nTableIndex].m_cbRec;
+        }
+
+        if (SUCCEEDED(MetaData::HotTable::CheckTables(
+            pHotTablesDirectory,
+            cbHotTablesData,
+            rgcRecords,
+            rgcbRecordSize)))
+        {
+            m_pHotTablesDirectory = pHotTablesDirectory;
+        }
+    }
+
     void DisableHotDataUsage()
     {
         MetaData::HotHeap emptyHotHeap;
@@ -73,15 +98,15 @@ public:
         // Disable usage of hot table data (throw it away)
         m_pHotTablesDirectory = NULL;
     }
-#endif //FEATURE_PREJIT
+#endif //FEATURE_METADATA_HOT_DATA
 
 protected:
     DAC_ALIGNAS(CMiniMdTemplate<CMiniMd>) // Align the first member to the alignment of the base class
     // Table info.
     MetaData::TableRO m_Tables[TBL_COUNT];
-#ifdef FEATURE_PREJIT
+#ifdef FEATURE_METADATA_HOT_DATA
     struct MetaData::HotTablesDirectory * m_pHotTablesDirectory;
-#endif //FEATURE_PREJIT
+#endif //FEATURE_METADATA_HOT_DATA
 
     __checkReturn
     HRESULT InitializeTables(MetaData::DataBlob tablesData);
@@ -135,9 +160,9 @@ protected:
             ppRecord,
             m_TableDefs[nTableIndex].m_cbRec,
             m_Schema.m_cRecs[nTableIndex],
-#ifdef FEATURE_PREJIT
+#ifdef FEATURE_METADATA_HOT_DATA
             m_pHotTablesDirectory,
-#endif //FEATURE_PREJIT
+#endif //FEATURE_METADATA_HOT_DATA
             nTableIndex);
     }
 
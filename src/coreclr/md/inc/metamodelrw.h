@@ -803,6 +803,44 @@ public:
 
     CMetaDataHashBase *m_pNamedItemHash;
 
+    //*************************************************************************
+    // Hash for signature items: TypeSpec, StandAloneSig and MethodSpec rows,
+    // keyed by their blob (and by the Method column for MethodSpec).
+    //*************************************************************************
+    __checkReturn
+    HRESULT CreateSignatureHash(            // Return code.
+        ULONG       ixTbl);                 // Table to hash.
+
+    __checkReturn
+    HRESULT AddSignatureToHash(             // Return code.
+        ULONG       ixTbl,                  // Table with the new item.
+        mdToken     tk);                    // Token of new guy.
+
+    // If the hash is built, search for the item. Ignore token *ptk.
+    HashSearchResult FindSignatureFromHash(
+        ULONG           ixTbl,      // Table with the item.
+        mdToken         tkParent,   // Method of a MethodSpec, 0 otherwise.
+        PCCOR_SIGNATURE pbSig,      // Signature.
+        ULONG           cbSig,      // Size of signature.
+        mdToken *       ptk);       // IN: Ignored token. OUT: Return if found.
+
+    __checkReturn
+    HRESULT GetSignatureItem(               // Return code.
+        ULONG            ixTbl,             // Table with the item.
+        RID              rid,               // Row of the item.
+        mdToken         *ptkParent,         // [OUT] Method of a MethodSpec, 0 otherwise.
+        PCCOR_SIGNATURE *ppbSig,            // [OUT] Signature.
+        ULONG           *pcbSig);           // [OUT] Size of signature.
+
+    CMetaDataHashBase **GetSignatureHashSlot(ULONG ixTbl);
+
+    FORCEINLINE ULONG HashSignatureItem(mdToken tkPar, PCCOR_SIGNATURE pbSig, ULONG cbSig)
+    {   return HashBytes((const BYTE *) &tkPar, sizeof(mdToken)) + HashBytes(pbSig, cbSig); }
+
+    CMetaDataHashBase *m_pTypeSpecHash;
+    CMetaDataHashBase *m_pStandAloneSigHash;
+    CMetaDataHashBase *m_pMethodSpecHash;
+
     //*****************************************************************************
     // IMetaModelCommon - RW specific versions for some of the functions.
     //*****************************************************************************
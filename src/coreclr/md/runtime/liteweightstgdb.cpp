@@ -38,6 +38,10 @@ CLiteWeightStgdb<MiniMd>::InitOnMem(
     int            bFoundMd = false;    // true when compressed data found.
     int            i;                   // Loop control.
     HRESULT        hr = S_OK;
+#ifdef FEATURE_METADATA_HOT_DATA
+    struct MetaData::HotTablesDirectory *pHotTablesDirectory = NULL;
+    UINT32         cbHotTablesData = 0; // Size of the hot table data in front of pHotTablesDirectory.
+#endif //FEATURE_METADATA_HOT_DATA
     ULONG          cbStreamBuffer;
 
     // Don't double open.
@@ -46,9 +50,9 @@ CLiteWeightStgdb<MiniMd>::InitOnMem(
     // Validate the signature of the format, or it isn't ours.
     IfFailGo(MDFormat::VerifySignature((PSTORAGESIGNATURE)pData, cbData));
 
-#ifdef FEATURE_PREJIT
+#ifdef FEATURE_METADATA_HOT_DATA
     m_MiniMd.m_pHotTablesDirectory = NULL;
-#endif //FEATURE_PREJIT
+#endif //FEATURE_METADATA_HOT_DATA
 
     // Remaining buffer size behind the stream header (pStream).
     cbStreamBuffer = cbData;
@@ -163,23 +167,40 @@ CLiteWeightStgdb<MiniMd>::InitOnMem(
         // Found the hot meta data stream
         else if (strcmp(pStream->GetName(), HOT_MODEL_STREAM_A) == 0)
         {
-#ifdef FEATURE_PREJIT
+#ifdef FEATURE_METADATA_HOT_DATA
+            // The hot stream ends with code:MetaData::HotMetaDataHeader, the hot tables directory
+            // ends where the hot heaps start.
+            if (cbCurrentData < sizeof(struct MetaData::HotMetaDataHeader))
+            {
+                Debug_ReportError("Invalid hot MetaData format - header doesn't fit into the hot stream.");
+                IfFailGo(METADATA_E_INVALID_FORMAT);
+            }
             BYTE * hotStreamEnd = reinterpret_cast< BYTE * >( pvCurrentData ) + cbCurrentData;
             ULONG * hotMetadataDir = reinterpret_cast< ULONG * >( hotStreamEnd ) - 2;
             ULONG hotPoolsSize = *hotMetadataDir;
 
-            m_MiniMd.m_pHotTablesDirectory = (struct MetaData::HotTablesDirectory *)
-                (reinterpret_cast<BYTE *>(hotMetadataDir) - hotPoolsSize - sizeof(struct MetaData::HotTablesDirectory));
-            MetaData::HotTable::CheckTables(m_MiniMd.m_pHotTablesDirectory);
+            S_UINT32 cbHotTablesEnd = S_UINT32(hotPoolsSize) +
+                S_UINT32(sizeof(struct MetaData::HotTablesDirectory)) +
+                S_UINT32(sizeof(struct MetaData::HotMetaDataHeader));
+            if (!cbHotTablesEnd.IsOverflow() && (cbHotTablesEnd.Value() <= cbCurrentData))
+            {
+                pHotTablesDirectory = (struct MetaData::HotTablesDirectory *)
+                    (reinterpret_cast<BYTE *>(hotMetadataDir) - hotPoolsSize - sizeof(struct MetaData::HotTablesDirectory));
+                cbHotTablesData = cbCurrentData - cbHotTablesEnd.Value();
+            }
+            else
+            {
+                Debug_ReportError("Invalid hot MetaData format - tables directory doesn't fit into the hot stream.");
+            }
 
             DataBuffer hotMetaData(
                 reinterpret_cast<BYTE *>(pvCurrentData),
                 cbCurrentData);
             IfFailGo(InitHotPools(hotMetaData));
-#else //!FEATURE_PREJIT
-            Debug_ReportError("MetaData hot stream is peresent, but ngen is not supported.");
+#else //!FEATURE_METADATA_HOT_DATA
+            Debug_ReportError("MetaData hot stream is present, but hot data is not supported.");
             // Ignore the stream
-#endif //!FEATURE_PREJIT
+#endif //!FEATURE_METADATA_HOT_DATA
         }
         // Pick off the next stream if there is one.
         pStream = pNext;
@@ -197,6 +218,14 @@ CLiteWeightStgdb<MiniMd>::InitOnMem(
         IfFailGo(m_MiniMd.PostInit(0));
     }
 
+#ifdef FEATURE_METADATA_HOT_DATA
+    // The hot tables can only be checked against the table schema, which is known by now.
+    if (pHotTablesDirectory != NULL)
+    {
+        m_MiniMd.InitHotTables(pHotTablesDirectory, cbHotTablesData);
+    }
+#endif //FEATURE_METADATA_HOT_DATA
+
     // Save off the location.
     m_pvMd = pData;
     m_cbMd = cbData;
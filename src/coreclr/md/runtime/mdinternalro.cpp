@@ -60,6 +60,8 @@ HRESULT MDApplyEditAndContinue(         // S_OK or error.
 //*****************************************************************************
 MDInternalRO::MDInternalRO()
  :  m_pMethodSemanticsMap(0),
+    m_pTypeDefNameMap(0),
+    m_pTypeRefNameMap(0),
     m_cRefs(1)
 {
 } // MDInternalRO::MDInternalRO
@@ -75,6 +77,12 @@ MDInternalRO::~MDInternalRO()
     if (m_pMethodSemanticsMap)
         delete[] m_pMethodSemanticsMap;
     m_pMethodSemanticsMap = 0;
+    if (m_pTypeDefNameMap)
+        delete[] m_pTypeDefNameMap;
+    m_pTypeDefNameMap = 0;
+    if (m_pTypeRefNameMap)
+        delete[] m_pTypeRefNameMap;
+    m_pTypeRefNameMap = 0;
 } // MDInternalRO::~MDInternalRO
 
 //*****************************************************************************
@@ -1153,34 +1161,50 @@ HRESULT MDInternalRO::FindTypeRefByName(  // S_OK or error.
     if (!szNamespace)
         szNamespace = "";
 
-    // Do a linear search on compressed version as we do not want to
-    // depends on ICR.
-    //
     ULONG       cTypeRefRecs = m_LiteWeightStgdb.m_MiniMd.getCountTypeRefs();
-    TypeRefRec *pTypeRefRec;
-    LPCUTF8     szNamespaceTmp;
-    LPCUTF8     szNameTmp;
-    mdToken     tkRes;
+    BOOL        fMatch;
 
-    for (ULONG i = 1; i <= cTypeRefRecs; i++)
+#ifndef DACCESS_COMPILE
+    CNameHashMap *pTypeRefNameMap;
+    IfFailGo(GetTypeNameMap(mdtTypeRef, &pTypeRefNameMap));
+
+    // Only look at the TypeRefs whose name hashes the same, in RID order.
+    if (pTypeRefNameMap != NULL)
     {
-        IfFailGo(m_LiteWeightStgdb.m_MiniMd.GetTypeRefRecord(i, &pTypeRefRec));
-        tkRes = m_LiteWeightStgdb.m_MiniMd.getResolutionScopeOfTypeRef(pTypeRefRec);
+        CNameHashMapSearcher searcher(pTypeRefNameMap, cTypeRefRecs);
+        CNameHashMap target;
+        const CNameHashMap * pScan;
+        target.m_ulHash = HashUtf8String(szName);
+        pScan = searcher.Find(&target);
 
-        if (IsNilToken(tkRes))
+        if (pScan != NULL)
         {
-            if (!IsNilToken(tkResolutionScope))
-                continue;
+            while ((pScan > pTypeRefNameMap) && ((pScan - 1)->m_ulHash == target.m_ulHash))
+                pScan--;
+
+            for (; (pScan < pTypeRefNameMap + cTypeRefRecs) && (pScan->m_ulHash == target.m_ulHash); pScan++)
+            {
+                IfFailGo(IsTypeRefMatch(pScan->m_rid, szNamespace, szName, tkResolutionScope, &fMatch));
+                if (fMatch)
+                {
+                    *ptk = TokenFromRid(pScan->m_rid, mdtTypeRef);
+                    goto ErrExit;
+                }
+            }
         }
-        else if (tkRes != tkResolutionScope)
-            continue;
 
-        IfFailGo(m_LiteWeightStgdb.m_MiniMd.getNamespaceOfTypeRef(pTypeRefRec, &szNamespaceTmp));
-        if (strcmp(szNamespace, szNamespaceTmp))
-            continue;
+        hr = CLDB_E_RECORD_NOTFOUND;
+        goto ErrExit;
+    }
+#endif //!DACCESS_COMPILE
 
-        IfFailGo(m_LiteWeightStgdb.m_MiniMd.getNameOfTypeRef(pTypeRefRec, &szNameTmp));
-        if (!strcmp(szNameTmp, szName))
+    // Do a linear search on compressed version as we do not want to
+    // depends on ICR.
+    //
+    for (ULONG i = 1; i <= cTypeRefRecs; i++)
+    {
+        IfFailGo(IsTypeRefMatch(i, szNamespace, szName, tkResolutionScope, &fMatch));
+        if (fMatch)
         {
             *ptk = TokenFromRid(i, mdtTypeRef);
             goto ErrExit;
@@ -1193,6 +1217,45 @@ ErrExit:
     return hr;
 }
 
+//*****************************************************************************
+// Check whether a TypeRef has the given name and resolution scope.
+//*****************************************************************************
+__checkReturn
+HRESULT MDInternalRO::IsTypeRefMatch(
+    RID         rid,                    // [IN] TypeRef to check.
+    LPCSTR      szNamespace,            // [IN] Namespace for the TypeRef.
+    LPCSTR      szName,                 // [IN] Name of the TypeRef.
+    mdToken     tkResolutionScope,      // [IN] Resolution Scope of the TypeRef.
+    BOOL      * pfMatch)                // [OUT] TRUE if the TypeRef matches.
+{
+    HRESULT     hr;
+    TypeRefRec *pTypeRefRec;
+    LPCUTF8     szNamespaceTmp;
+    LPCUTF8     szNameTmp;
+    mdToken     tkRes;
+
+    *pfMatch = FALSE;
+
+    IfFailRet(m_LiteWeightStgdb.m_MiniMd.GetTypeRefRecord(rid, &pTypeRefRec));
+    tkRes = m_LiteWeightStgdb.m_MiniMd.getResolutionScopeOfTypeRef(pTypeRefRec);
+
+    if (IsNilToken(tkRes))
+    {
+        if (!IsNilToken(tkResolutionScope))
+            return S_OK;
+    }
+    else if (tkRes != tkResolutionScope)
+        return S_OK;
+
+    IfFailRet(m_LiteWeightStgdb.m_MiniMd.getNamespaceOfTypeRef(pTypeRefRec, &szNamespaceTmp));
+    if (strcmp(szNamespace, szNamespaceTmp))
+        return S_OK;
+
+    IfFailRet(m_LiteWeightStgdb.m_MiniMd.getNameOfTypeRef(pTypeRefRec, &szNameTmp));
+    *pfMatch = !strcmp(szNameTmp, szName);
+    return S_OK;
+} // MDInternalRO::IsTypeRefMatch
+
 //*****************************************************************************
 // return flags for a given class
 //*****************************************************************************
@@ -1728,12 +1791,10 @@ MDInternalRO::FindTypeDef(
     if (szTypeDefNamespace == NULL)
         szTypeDefNamespace = "";
 
-    // Do a linear search
     ULONG        cTypeDefRecs = m_LiteWeightStgdb.m_MiniMd.getCountTypeDefs();
-    TypeDefRec * pTypeDefRec;
     LPCUTF8      szName;
     LPCUTF8      szNamespace;
-    DWORD        dwFlags;
+    BOOL         fMatch;
 
     // Get TypeDef of the tkEnclosingClass passed in
     if (TypeFromToken(tkEnclosingClass) == mdtTypeRef)
@@ -1755,55 +1816,206 @@ MDInternalRO::FindTypeDef(
         _ASSERTE(TypeFromToken(tkEnclosingClass) == mdtTypeDef);
     }
 
-    // Search for the TypeDef
-    for (ULONG i = 1; i <= cTypeDefRecs; i++)
+#ifndef DACCESS_COMPILE
+    CNameHashMap *pTypeDefNameMap;
+    IfFailRet(GetTypeNameMap(mdtTypeDef, &pTypeDefNameMap));
+
+    // Only look at the TypeDefs whose name hashes the same, in RID order.
+    if (pTypeDefNameMap != NULL)
     {
-        IfFailRet(m_LiteWeightStgdb.m_MiniMd.GetTypeDefRecord(i, &pTypeDefRec));
+        CNameHashMapSearcher searcher(pTypeDefNameMap, cTypeDefRecs);
+        CNameHashMap target;
+        const CNameHashMap * pScan;
+        target.m_ulHash = HashUtf8String(szTypeDefName);
+        pScan = searcher.Find(&target);
 
-        dwFlags = m_LiteWeightStgdb.m_MiniMd.getFlagsOfTypeDef(pTypeDefRec);
+        if (pScan == NULL)
+            return CLDB_E_RECORD_NOTFOUND;
 
-        if (!IsTdNested(dwFlags) && !IsNilToken(tkEnclosingClass))
-        {
-            // If the class is not Nested and EnclosingClass passed in is not nil
-            continue;
-        }
-        else if (IsTdNested(dwFlags) && IsNilToken(tkEnclosingClass))
-        {
-            // If the class is nested and EnclosingClass passed is nil
-            continue;
-        }
-        else if (!IsNilToken(tkEnclosingClass))
-        {
-            _ASSERTE(TypeFromToken(tkEnclosingClass) == mdtTypeDef);
-
-            RID              iNestedClassRec;
-            NestedClassRec * pNestedClassRec;
-            mdTypeDef        tkEnclosingClassTmp;
-
-            IfFailRet(m_LiteWeightStgdb.m_MiniMd.FindNestedClassFor(i, &iNestedClassRec));
-            if (InvalidRid(iNestedClassRec))
-                continue;
-            IfFailRet(m_LiteWeightStgdb.m_MiniMd.GetNestedClassRecord(iNestedClassRec, &pNestedClassRec));
-            tkEnclosingClassTmp = m_LiteWeightStgdb.m_MiniMd.getEnclosingClassOfNestedClass(pNestedClassRec);
-            if (tkEnclosingClass != tkEnclosingClassTmp)
-                continue;
-        }
+        while ((pScan > pTypeDefNameMap) && ((pScan - 1)->m_ulHash == target.m_ulHash))
+            pScan--;
 
-        IfFailRet(m_LiteWeightStgdb.m_MiniMd.getNameOfTypeDef(pTypeDefRec, &szName));
-        if (strcmp(szTypeDefName, szName) == 0)
+        for (; (pScan < pTypeDefNameMap + cTypeDefRecs) && (pScan->m_ulHash == target.m_ulHash); pScan++)
         {
-            IfFailRet(m_LiteWeightStgdb.m_MiniMd.getNamespaceOfTypeDef(pTypeDefRec, &szNamespace));
-            if (strcmp(szTypeDefNamespace, szNamespace) == 0)
+            IfFailRet(IsTypeDefMatch(pScan->m_rid, szTypeDefNamespace, szTypeDefName, tkEnclosingClass, &fMatch));
+            if (fMatch)
             {
-                *ptkTypeDef = TokenFromRid(i, mdtTypeDef);
+                *ptkTypeDef = TokenFromRid(pScan->m_rid, mdtTypeDef);
                 return S_OK;
             }
         }
+        return CLDB_E_RECORD_NOTFOUND;
+    }
+#endif //!DACCESS_COMPILE
+
+    // Do a linear search for the TypeDef
+    for (ULONG i = 1; i <= cTypeDefRecs; i++)
+    {
+        IfFailRet(IsTypeDefMatch(i, szTypeDefNamespace, szTypeDefName, tkEnclosingClass, &fMatch));
+        if (fMatch)
+        {
+            *ptkTypeDef = TokenFromRid(i, mdtTypeDef);
+            return S_OK;
+        }
     }
     // Cannot find the TypeDef by name
     return CLDB_E_RECORD_NOTFOUND;
 } // MDInternalRO::FindTypeDef
 
+//*****************************************************************************
+// Check whether a TypeDef has the given name and enclosing class.
+//*****************************************************************************
+__checkReturn
+HRESULT
+MDInternalRO::IsTypeDefMatch(
+    RID         rid,                    // [IN] TypeDef to check.
+    LPCSTR      szTypeDefNamespace,     // [IN] Namespace for the TypeDef.
+    LPCSTR      szTypeDefName,          // [IN] Name of the TypeDef.
+    mdToken     tkEnclosingClass,       // [IN] TypeDef of enclosing class, or nil.
+    BOOL      * pfMatch)                // [OUT] TRUE if the TypeDef matches.
+{
+    HRESULT      hr;
+    TypeDefRec * pTypeDefRec;
+    LPCUTF8      szName;
+    LPCUTF8      szNamespace;
+    DWORD        dwFlags;
+
+    *pfMatch = FALSE;
+
+    IfFailRet(m_LiteWeightStgdb.m_MiniMd.GetTypeDefRecord(rid, &pTypeDefRec));
+
+    dwFlags = m_LiteWeightStgdb.m_MiniMd.getFlagsOfTypeDef(pTypeDefRec);
+
+    if (!IsTdNested(dwFlags) && !IsNilToken(tkEnclosingClass))
+    {
+        // If the class is not Nested and EnclosingClass passed in is not nil
+        return S_OK;
+    }
+    else if (IsTdNested(dwFlags) && IsNilToken(tkEnclosingClass))
+    {
+        // If the class is nested and EnclosingClass passed is nil
+        return S_OK;
+    }
+    else if (!IsNilToken(tkEnclosingClass))
+    {
+        _ASSERTE(TypeFromToken(tkEnclosingClass) == mdtTypeDef);
+
+        RID              iNestedClassRec;
+        NestedClassRec * pNestedClassRec;
+        mdTypeDef        tkEnclosingClassTmp;
+
+        IfFailRet(m_LiteWeightStgdb.m_MiniMd.FindNestedClassFor(rid, &iNestedClassRec));
+        if (InvalidRid(iNestedClassRec))
+            return S_OK;
+        IfFailRet(m_LiteWeightStgdb.m_MiniMd.GetNestedClassRecord(iNestedClassRec, &pNestedClassRec));
+        tkEnclosingClassTmp = m_LiteWeightStgdb.m_MiniMd.getEnclosingClassOfNestedClass(pNestedClassRec);
+        if (tkEnclosingClass != tkEnclosingClassTmp)
+            return S_OK;
+    }
+
+    IfFailRet(m_LiteWeightStgdb.m_MiniMd.getNameOfTypeDef(pTypeDefRec, &szName));
+    if (strcmp(szTypeDefName, szName) == 0)
+    {
+        IfFailRet(m_LiteWeightStgdb.m_MiniMd.getNamespaceOfTypeDef(pTypeDefRec, &szNamespace));
+        *pfMatch = (strcmp(szTypeDefNamespace, szNamespace) == 0);
+    }
+    return S_OK;
+} // MDInternalRO::IsTypeDefMatch
+
+#ifndef DACCESS_COMPILE
+int MDInternalRO::CNameHashMapSearcher::Compare(
+    const CNameHashMap *psFirst,
+    const CNameHashMap *psSecond)
+{
+    if (psFirst->m_ulHash < psSecond->m_ulHash)
+        return -1;
+    if (psFirst->m_ulHash > psSecond->m_ulHash)
+        return 1;
+    return 0;
+} // MDInternalRO::CNameHashMapSearcher::Compare
+
+int MDInternalRO::CNameHashMapSorter::Compare(
+    CNameHashMap *psFirst,
+    CNameHashMap *psSecond)
+{
+    if (psFirst->m_ulHash < psSecond->m_ulHash)
+        return -1;
+    if (psFirst->m_ulHash > psSecond->m_ulHash)
+        return 1;
+    // Keep the records with the same hash in RID order, so lookups find the first match.
+    if (psFirst->m_rid < psSecond->m_rid)
+        return -1;
+    if (psFirst->m_rid > psSecond->m_rid)
+        return 1;
+    return 0;
+} // MDInternalRO::CNameHashMapSorter::Compare
+
+//*****************************************************************************
+// Get the map of name hashes for the TypeDef or TypeRef table, building it on first use.
+// *ppMap is NULL for small tables, or if the map could not be allocated, in which case
+// the callers fall back to a linear search.
+//*****************************************************************************
+__checkReturn
+HRESULT MDInternalRO::GetTypeNameMap(
+    ULONG           tkType,             // [IN] mdtTypeDef or mdtTypeRef.
+    CNameHashMap ** ppMap)              // [OUT] the map, NULL if there is none.
+{
+    HRESULT         hr;
+    CNameHashMap ** ppCachedMap;
+    ULONG           ridMax;
+    LPCUTF8         szName;
+
+    _ASSERTE((tkType == mdtTypeDef) || (tkType == mdtTypeRef));
+
+    if (tkType == mdtTypeDef)
+    {
+        ppCachedMap = &m_pTypeDefNameMap;
+        ridMax = m_LiteWeightStgdb.m_MiniMd.getCountTypeDefs();
+    }
+    else
+    {
+        ppCachedMap = &m_pTypeRefNameMap;
+        ridMax = m_LiteWeightStgdb.m_MiniMd.getCountTypeRefs();
+    }
+
+    // Lazy initialization of the map
+    if ((ridMax > 10) && (*ppCachedMap == NULL))
+    {
+        NewArrayHolder<CNameHashMap> pMap = new (nothrow) CNameHashMap[ridMax];
+        if (pMap != NULL)
+        {
+            for (RID ridCur = 1; ridCur <= ridMax; ridCur++)
+            {
+                if (tkType == mdtTypeDef)
+                {
+                    TypeDefRec *pTypeDefRec;
+                    IfFailRet(m_LiteWeightStgdb.m_MiniMd.GetTypeDefRecord(ridCur, &pTypeDefRec));
+                    IfFailRet(m_LiteWeightStgdb.m_MiniMd.getNameOfTypeDef(pTypeDefRec, &szName));
+                }
+                else
+                {
+                    TypeRefRec *pTypeRefRec;
+                    IfFailRet(m_LiteWeightStgdb.m_MiniMd.GetTypeRefRecord(ridCur, &pTypeRefRec));
+                    IfFailRet(m_LiteWeightStgdb.m_MiniMd.getNameOfTypeRef(pTypeRefRec, &szName));
+                }
+                pMap[ridCur-1].m_ulHash = HashUtf8String(szName);
+                pMap[ridCur-1].m_rid = ridCur;
+            }
+            CNameHashMapSorter sorter(pMap, ridMax);
+            sorter.Sort();
+
+            if (InterlockedCompareExchangeT<CNameHashMap *>(ppCachedMap, pMap, NULL) == NULL)
+            {   // The exchange did happen, supress of the allocated map
+                pMap.SuppressRelease();
+            }
+        }
+    }
+
+    *ppMap = (ridMax > 10) ? *ppCachedMap : NULL;
+    return S_OK;
+} // MDInternalRO::GetTypeNameMap
+#endif //!DACCESS_COMPILE
+
 //*****************************************************************************
 // Given a memberref, return a pointer to memberref's name and signature
 //*****************************************************************************
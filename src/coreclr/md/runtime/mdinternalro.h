@@ -70,7 +70,7 @@ public:
     STDMETHODIMP SetOptimizeAccessForSpeed(
         BOOL fOptSpeed)
     {
-#ifdef FEATURE_PREJIT
+#ifdef FEATURE_METADATA_HOT_DATA
         // The metadata cache of hot items is an optional working-set optimization
         // that has a large speed cost relative to direct table lookup
         if (fOptSpeed)
@@ -778,6 +778,53 @@ private:
         virtual int Compare(const CMethodSemanticsMap *psFirst, const CMethodSemanticsMap *psSecond);
     };
 
+    // Hash of the name of each TypeDef or TypeRef, ordered by hash and then by RID, so that the
+    // name lookups only have to check the records whose name hashes the same.
+    struct CNameHashMap
+    {
+        ULONG           m_ulHash;           // HashUtf8String of the name.
+        RID             m_rid;              // RID of the TypeDef or TypeRef record.
+    };
+    CNameHashMap *m_pTypeDefNameMap;        // Possible array of TypeDef name hashes.
+    CNameHashMap *m_pTypeRefNameMap;        // Possible array of TypeRef name hashes.
+
+#ifndef DACCESS_COMPILE
+    class CNameHashMapSorter : public CQuickSort<CNameHashMap>
+    {
+    public:
+         CNameHashMapSorter(CNameHashMap *pBase, int iCount) : CQuickSort<CNameHashMap>(pBase, iCount) {}
+         virtual int Compare(CNameHashMap *psFirst, CNameHashMap *psSecond);
+    };
+
+    class CNameHashMapSearcher : public CBinarySearch<CNameHashMap>
+    {
+    public:
+        CNameHashMapSearcher(const CNameHashMap *pBase, int iCount) : CBinarySearch<CNameHashMap>(pBase, iCount) {}
+        virtual int Compare(const CNameHashMap *psFirst, const CNameHashMap *psSecond);
+    };
+
+    __checkReturn
+    HRESULT GetTypeNameMap(
+        ULONG           tkType,             // [IN] mdtTypeDef or mdtTypeRef.
+        CNameHashMap ** ppMap);             // [OUT] the map, NULL if there is none.
+#endif //!DACCESS_COMPILE
+
+    __checkReturn
+    HRESULT IsTypeDefMatch(
+        RID         rid,                    // [IN] TypeDef to check.
+        LPCSTR      szNamespace,            // [IN] Namespace for the TypeDef.
+        LPCSTR      szName,                 // [IN] Name of the TypeDef.
+        mdToken     tkEnclosingClass,       // [IN] TypeDef of enclosing class, or nil.
+        BOOL      * pfMatch);               // [OUT] TRUE if the TypeDef matches.
+
+    __checkReturn
+    HRESULT IsTypeRefMatch(
+        RID         rid,                    // [IN] TypeRef to check.
+        LPCSTR      szNamespace,            // [IN] Namespace for the TypeRef.
+        LPCSTR      szName,                 // [IN] Name of the TypeRef.
+        mdToken     tkResolutionScope,      // [IN] Resolution Scope of the TypeRef.
+        BOOL      * pfMatch);               // [OUT] TRUE if the TypeRef matches.
+
     static BOOL CompareSignatures(PCCOR_SIGNATURE pvFirstSigBlob, DWORD cbFirstSigBlob,
                                   PCCOR_SIGNATURE pvSecondSigBlob, DWORD cbSecondSigBlob,
                                   void* SigARguments);
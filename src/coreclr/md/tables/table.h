@@ -65,9 +65,9 @@ public:
         __deref_out_opt BYTE **ppRecord,
                         UINT32 cbRecordSize,
                         UINT32 cRecordCount,
-#ifdef FEATURE_PREJIT
+#ifdef FEATURE_METADATA_HOT_DATA
                         struct HotTablesDirectory *pHotTablesDirectory,
-#endif //FEATURE_PREJIT
+#endif //FEATURE_METADATA_HOT_DATA
                         UINT32 nTableIndex)
     {
         if ((nRowIndex == 0) || (nRowIndex > cRecordCount))
@@ -76,7 +76,7 @@ public:
             *ppRecord = NULL;
             return CLDB_E_INDEX_NOTFOUND;
         }
-#ifdef FEATURE_PREJIT
+#ifdef FEATURE_METADATA_HOT_DATA
         if ((pHotTablesDirectory != NULL) && (pHotTablesDirectory->m_rgTableHeader_SignedOffset[nTableIndex] != 0))
         {
             HRESULT hr = HotTable::GetData(
@@ -100,7 +100,7 @@ public:
             }
             _ASSERTE(hr == S_FALSE);
         }
-#endif //FEATURE_PREJIT
+#endif //FEATURE_METADATA_HOT_DATA
         *ppRecord = m_pData + (nRowIndex - 1) * cbRecordSize;
         return S_OK;
     } // TableRO::GetRecord
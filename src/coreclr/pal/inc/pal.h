@@ -2291,6 +2291,16 @@ BOOL
 PALAPI
 PAL_GetCpuLimit(UINT* val);
 
+PALIMPORT
+VOID
+PALAPI
+PAL_RefreshCGroup();
+
+PALIMPORT
+BOOL
+PALAPI
+PAL_GetMemoryPressure(UINT* stall_some, UINT* stall_full, UINT64* high_limit);
+
 PALIMPORT
 size_t
 PALAPI
@@ -2618,6 +2628,11 @@ LPCVOID
 PALAPI
 PAL_GetSymbolModuleBase(PVOID symbol);
 
+PALIMPORT
+SIZE_T
+PALAPI
+PAL_CopyModuleData(PVOID moduleBase, PVOID destinationBufferStart, PVOID destinationBufferEnd);
+
 PALIMPORT
 LPCSTR
 PALAPI
@@ -2631,6 +2646,13 @@ PAL_VirtualReserveFromExecutableMemoryAllocatorWithinRange(
     IN LPCVOID lpEndAddress,
     IN SIZE_T dwSize);
 
+PALIMPORT
+BOOL
+PALAPI
+PAL_VirtualPreferLargePages(
+    IN LPVOID lpAddress,
+    IN SIZE_T dwSize);
+
 PALIMPORT
 LPVOID
 PALAPI
@@ -389,6 +389,9 @@ MIDL_DEFINE_GUID(IID, IID_ICorDebugArrayValue,0x0405B0DF,0xA660,0x11d2,0xBD,0x02
 MIDL_DEFINE_GUID(IID, IID_ICorDebugVariableHome,0x50847b8d,0xf43f,0x41b0,0x92,0x4c,0x63,0x83,0xa5,0xf2,0x27,0x8b);
 
 
+MIDL_DEFINE_GUID(IID, IID_ICorDebugFunctionBreakpoint2,0x4C1E9B6A,0x7D2F,0x4E8B,0xA3,0xC5,0x9F,0x0D,0x1E,0x2B,0x7A,0x64);
+
+
 MIDL_DEFINE_GUID(IID, IID_ICorDebugHandleValue,0x029596E8,0x276B,0x46a1,0x98,0x21,0x73,0x2E,0x96,0xBB,0xB0,0x0B);
 
 
@@ -141,6 +141,9 @@ MIDL_DEFINE_GUID(IID, IID_ICorProfilerInfo11,0x06398876,0x8987,0x4154,0xB6,0x21,
 MIDL_DEFINE_GUID(IID, IID_ICorProfilerInfo12,0x27b24ccd,0x1cb1,0x47c5,0x96,0xee,0x98,0x19,0x0d,0xc3,0x09,0x59);
 
 
+MIDL_DEFINE_GUID(IID, IID_ICorProfilerInfo13,0x6e6c7ee2,0x0701,0x4ec2,0x9d,0x29,0x2e,0x87,0x33,0xb6,0x69,0x34);
+
+
 MIDL_DEFINE_GUID(IID, IID_ICorProfilerMethodEnum,0xFCCEE788,0x0088,0x454B,0xA8,0x11,0xC9,0x9F,0x29,0x8D,0x19,0x42);
 
 
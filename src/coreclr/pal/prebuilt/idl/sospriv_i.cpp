@@ -109,6 +109,9 @@ MIDL_DEFINE_GUID(IID, IID_ISOSDacInterface9,0x4eca42d8,0x7e7b,0x4c8a,0xa1,0x16,0
 MIDL_DEFINE_GUID(IID, IID_ISOSDacInterface10,0x90B8FCC3,0x7251,0x4B0A,0xAE,0x3D,0x5C,0x13,0xA6,0x7E,0xC9,0xAA);
 
 
+MIDL_DEFINE_GUID(IID, IID_ISOSDacInterface11,0xE2F6B1A4,0x5C7D,0x4F3E,0x8B,0x9A,0x1D,0x0C,0x6E,0x4F,0x7A,0x23);
+
+
 #undef MIDL_DEFINE_GUID
 
 #ifdef __cplusplus
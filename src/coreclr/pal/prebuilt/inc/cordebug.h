@@ -799,6 +799,13 @@ typedef interface ICorDebugVariableHome ICorDebugVariableHome;
 #endif 	/* __ICorDebugVariableHome_FWD_DEFINED__ */
 
 
+#ifndef __ICorDebugFunctionBreakpoint2_FWD_DEFINED__
+#define __ICorDebugFunctionBreakpoint2_FWD_DEFINED__
+typedef interface ICorDebugFunctionBreakpoint2 ICorDebugFunctionBreakpoint2;
+
+#endif 	/* __ICorDebugFunctionBreakpoint2_FWD_DEFINED__ */
+
+
 #ifndef __ICorDebugHandleValue_FWD_DEFINED__
 #define __ICorDebugHandleValue_FWD_DEFINED__
 typedef interface ICorDebugHandleValue ICorDebugHandleValue;
@@ -15814,6 +15821,111 @@ EXTERN_C const IID IID_ICorDebugVariableHome;
 #endif 	/* __ICorDebugVariableHome_INTERFACE_DEFINED__ */
 
 
+#ifndef __ICorDebugFunctionBreakpoint2_INTERFACE_DEFINED__
+#define __ICorDebugFunctionBreakpoint2_INTERFACE_DEFINED__
+
+/* interface ICorDebugFunctionBreakpoint2 */
+/* [unique][uuid][local][object] */ 
+
+typedef 
+enum CorDebugConditionOperator
+    {
+        CONDITION_EQUAL	= 0,
+        CONDITION_NOT_EQUAL	= ( CONDITION_EQUAL + 1 ) ,
+        CONDITION_LESS_THAN	= ( CONDITION_NOT_EQUAL + 1 ) ,
+        CONDITION_LESS_THAN_OR_EQUAL	= ( CONDITION_LESS_THAN + 1 ) ,
+        CONDITION_GREATER_THAN	= ( CONDITION_LESS_THAN_OR_EQUAL + 1 ) ,
+        CONDITION_GREATER_THAN_OR_EQUAL	= ( CONDITION_GREATER_THAN + 1 ) 
+    } 	CorDebugConditionOperator;
+
+typedef struct COR_DEBUG_BREAKPOINT_CONDITION
+    {
+    CORDB_ADDRESS codeStartAddress;
+    VariableLocationType locationType;
+    CorDebugRegister baseRegister;
+    LONG offset;
+    BOOL isFieldOfObject;
+    ULONG32 fieldOffset;
+    ULONG32 valueSize;
+    BOOL isSigned;
+    CorDebugConditionOperator conditionOperator;
+    ULONG64 constantValue;
+    } 	COR_DEBUG_BREAKPOINT_CONDITION;
+
+
+EXTERN_C const IID IID_ICorDebugFunctionBreakpoint2;
+
+#if defined(__cplusplus) && !defined(CINTERFACE)
+    
+    MIDL_INTERFACE("4C1E9B6A-7D2F-4E8B-A3C5-9F0D1E2B7A64")
+    ICorDebugFunctionBreakpoint2 : public IUnknown
+    {
+    public:
+        virtual HRESULT STDMETHODCALLTYPE SetCondition( 
+            /* [in] */ COR_DEBUG_BREAKPOINT_CONDITION *pCondition) = 0;
+        
+    };
+    
+    
+#else 	/* C style interface */
+
+    typedef struct ICorDebugFunctionBreakpoint2Vtbl
+    {
+        BEGIN_INTERFACE
+        
+        HRESULT ( STDMETHODCALLTYPE *QueryInterface )( 
+            ICorDebugFunctionBreakpoint2 * This,
+            /* [in] */ REFIID riid,
+            /* [annotation][iid_is][out] */ 
+            _COM_Outptr_  void **ppvObject);
+        
+        ULONG ( STDMETHODCALLTYPE *AddRef )( 
+            ICorDebugFunctionBreakpoint2 * This);
+        
+        ULONG ( STDMETHODCALLTYPE *Release )( 
+            ICorDebugFunctionBreakpoint2 * This);
+        
+        HRESULT ( STDMETHODCALLTYPE *SetCondition )( 
+            ICorDebugFunctionBreakpoint2 * This,
+            /* [in] */ COR_DEBUG_BREAKPOINT_CONDITION *pCondition);
+        
+        END_INTERFACE
+    } ICorDebugFunctionBreakpoint2Vtbl;
+
+    interface ICorDebugFunctionBreakpoint2
+    {
+        CONST_VTBL struct ICorDebugFunctionBreakpoint2Vtbl *lpVtbl;
+    };
+
+    
+
+#ifdef COBJMACROS
+
+
+#define ICorDebugFunctionBreakpoint2_QueryInterface(This,riid,ppvObject)	\
+    ( (This)->lpVtbl -> QueryInterface(This,riid,ppvObject) ) 
+
+#define ICorDebugFunctionBreakpoint2_AddRef(This)	\
+    ( (This)->lpVtbl -> AddRef(This) ) 
+
+#define ICorDebugFunctionBreakpoint2_Release(This)	\
+    ( (This)->lpVtbl -> Release(This) ) 
+
+
+#define ICorDebugFunctionBreakpoint2_SetCondition(This,pCondition)	\
+    ( (This)->lpVtbl -> SetCondition(This,pCondition) ) 
+
+#endif /* COBJMACROS */
+
+
+#endif 	/* C style interface */
+
+
+
+
+#endif 	/* __ICorDebugFunctionBreakpoint2_INTERFACE_DEFINED__ */
+
+
 #ifndef __ICorDebugHandleValue_INTERFACE_DEFINED__
 #define __ICorDebugHandleValue_INTERFACE_DEFINED__
 
@@ -143,6 +143,13 @@ typedef interface ISOSDacInterface10 ISOSDacInterface10;
 #endif  /* __ISOSDacInterface10_FWD_DEFINED__ */
 
 
+#ifndef __ISOSDacInterface11_FWD_DEFINED__
+#define __ISOSDacInterface11_FWD_DEFINED__
+typedef interface ISOSDacInterface11 ISOSDacInterface11;
+
+#endif  /* __ISOSDacInterface11_FWD_DEFINED__ */
+
+
 /* header files for imported files */
 #include "unknwn.h"
 #include "xclrdata.h"
@@ -2897,6 +2904,103 @@ EXTERN_C const IID IID_ISOSDacInterface10;
 #endif  /* __ISOSDacInterface10_INTERFACE_DEFINED__ */
 
 
+#ifndef __ISOSDacInterface11_INTERFACE_DEFINED__
+#define __ISOSDacInterface11_INTERFACE_DEFINED__
+
+/* interface ISOSDacInterface11 */
+/* [uuid][local][object] */ 
+
+typedef struct _SOSHeapObjectData
+    {
+    CLRDATA_ADDRESS Address;
+    CLRDATA_ADDRESS MethodTable;
+    ULONG64 Size;
+    }   SOSHeapObjectData;
+
+
+EXTERN_C const IID IID_ISOSDacInterface11;
+
+#if defined(__cplusplus) && !defined(CINTERFACE)
+    
+    MIDL_INTERFACE("E2F6B1A4-5C7D-4F3E-8B9A-1D0C6E4F7A23")
+    ISOSDacInterface11 : public IUnknown
+    {
+    public:
+        virtual HRESULT STDMETHODCALLTYPE GetHeapObjectsInRange( 
+            CLRDATA_ADDRESS start,
+            CLRDATA_ADDRESS end,
+            unsigned int count,
+            SOSHeapObjectData *objects,
+            unsigned int *pFetched,
+            CLRDATA_ADDRESS *pNext) = 0;
+        
+    };
+    
+    
+#else   /* C style interface */
+
+    typedef struct ISOSDacInterface11Vtbl
+    {
+        BEGIN_INTERFACE
+        
+        HRESULT ( STDMETHODCALLTYPE *QueryInterface )( 
+            ISOSDacInterface11 * This,
+            /* [in] */ REFIID riid,
+            /* [annotation][iid_is][out] */ 
+            _COM_Outptr_  void **ppvObject);
+        
+        ULONG ( STDMETHODCALLTYPE *AddRef )( 
+            ISOSDacInterface11 * This);
+        
+        ULONG ( STDMETHODCALLTYPE *Release )( 
+            ISOSDacInterface11 * This);
+        
+        HRESULT ( STDMETHODCALLTYPE *GetHeapObjectsInRange )( 
+            ISOSDacInterface11 * This,
+            CLRDATA_ADDRESS start,
+            CLRDATA_ADDRESS end,
+            unsigned int count,
+            SOSHeapObjectData *objects,
+            unsigned int *pFetched,
+            CLRDATA_ADDRESS *pNext);
+        
+        END_INTERFACE
+    } ISOSDacInterface11Vtbl;
+
+    interface ISOSDacInterface11
+    {
+        CONST_VTBL struct ISOSDacInterface11Vtbl *lpVtbl;
+    };
+
+    
+
+#ifdef COBJMACROS
+
+
+#define ISOSDacInterface11_QueryInterface(This,riid,ppvObject)  \
+    ( (This)->lpVtbl -> QueryInterface(This,riid,ppvObject) ) 
+
+#define ISOSDacInterface11_AddRef(This)  \
+    ( (This)->lpVtbl -> AddRef(This) ) 
+
+#define ISOSDacInterface11_Release(This)  \
+    ( (This)->lpVtbl -> Release(This) ) 
+
+
+#define ISOSDacInterface11_GetHeapObjectsInRange(This,start,end,count,objects,pFetched,pNext)  \
+    ( (This)->lpVtbl -> GetHeapObjectsInRange(This,start,end,count,objects,pFetched,pNext) ) 
+
+#endif /* COBJMACROS */
+
+
+#endif  /* C style interface */
+
+
+
+
+#endif  /* __ISOSDacInterface11_INTERFACE_DEFINED__ */
+
+
 /* Additional Prototypes for ALL interfaces */
 
 /* end of Additional Prototypes */
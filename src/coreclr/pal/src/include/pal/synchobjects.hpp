@@ -27,6 +27,15 @@ Abstract:
 
 #include <pthread.h>
 
+// On Linux the native wait of a thread is a futex on the wait predicate, so waking up
+// a thread blocked on an in-process object doesn't have to hand off the mutex of a
+// condition variable between the signaling and the waking thread.
+#if defined(__linux__) && HAVE_CLOCK_MONOTONIC && HAVE_PTHREAD_CONDATTR_SETCLOCK
+#define SYNCHMGR_FUTEX_NATIVE_WAIT 1
+#else
+#define SYNCHMGR_FUTEX_NATIVE_WAIT 0
+#endif
+
 #define SharedID SHMPTR
 #define SharedIDToPointer(shID) SHMPTR_TO_TYPED_PTR(PVOID, shID)
 #define SharedIDToTypePointer(TYPE,shID) SHMPTR_TO_TYPED_PTR(TYPE, shID)
@@ -90,11 +99,22 @@ namespace CorUnix
     {
         pthread_mutex_t     mutex;
         pthread_cond_t      cond;
+        // With SYNCHMGR_FUTEX_NATIVE_WAIT this is one of the NativeWaitPred* values
         int                 iPred;
         DWORD               dwObjectIndex;
         ThreadWakeupReason  twrWakeupReason;
         bool                fInitialized;
 
+#if SYNCHMGR_FUTEX_NATIVE_WAIT
+        enum
+        {
+            NativeWaitPredNotSignaled = 0,
+            NativeWaitPredSignaled = 1,
+            // Not signaled, and the owner thread is (about to be) sleeping on the futex
+            NativeWaitPredWaiting = 2,
+        };
+#endif // SYNCHMGR_FUTEX_NATIVE_WAIT
+
         _ThreadNativeWaitData() :
             iPred(0),
             dwObjectIndex(0),
@@ -48,6 +48,10 @@ SET_DEFAULT_DEBUG_CHANNEL(LOADER); // some headers have code with asserts, so do
 #include <mach-o/loader.h>
 #endif // __APPLE__
 
+#ifdef __linux__
+#include <link.h>
+#endif // __linux__
+
 #include <sys/types.h>
 #include <sys/mman.h>
 
@@ -913,6 +917,124 @@ PAL_GetSymbolModuleBase(PVOID symbol)
     return retval;
 }
 
+#ifdef __linux__
+struct CopyModuleDataParam
+{
+    uint8_t *moduleBase;
+    uint8_t *destinationBufferStart;
+    uint8_t *destinationBufferEnd;
+    SIZE_T size;
+    bool found;
+};
+
+static int CopyModuleDataCallback(struct dl_phdr_info *info, size_t size, void *data)
+{
+    CopyModuleDataParam *param = (CopyModuleDataParam *)data;
+
+    // The module base returned by dladdr is the start of the first loadable segment
+    uint8_t *firstSegment = nullptr;
+    for (int i = 0; i < info->dlpi_phnum; i++)
+    {
+        const ElfW(Phdr) *phdr = &info->dlpi_phdr[i];
+        if (phdr->p_type == PT_LOAD)
+        {
+            firstSegment = (uint8_t *)ALIGN_DOWN(info->dlpi_addr + phdr->p_vaddr, GetVirtualPageSize());
+            break;
+        }
+    }
+
+    if (firstSegment != param->moduleBase)
+    {
+        return 0;
+    }
+
+    param->found = true;
+    uint8_t *destination = param->destinationBufferStart;
+    SIZE_T capacity = param->destinationBufferEnd - param->destinationBufferStart;
+    for (int i = 0; i < info->dlpi_phnum; i++)
+    {
+        const ElfW(Phdr) *phdr = &info->dlpi_phdr[i];
+        if (phdr->p_type != PT_LOAD || (phdr->p_flags & PF_R) == 0)
+        {
+            continue;
+        }
+
+        // Keep the segments at their offsets from the module base so that addresses logged
+        // into the stress log can be resolved against the copy
+        uint8_t *segmentStart = (uint8_t *)(info->dlpi_addr + phdr->p_vaddr);
+        SIZE_T offset = segmentStart - param->moduleBase;
+        SIZE_T segmentSize = phdr->p_memsz;
+        if (offset >= capacity)
+        {
+            break;
+        }
+        if (segmentSize > capacity - offset)
+        {
+            segmentSize = capacity - offset;
+        }
+
+        memcpy(destination + offset, segmentStart, segmentSize);
+        if (offset + segmentSize > param->size)
+        {
+            param->size = offset + segmentSize;
+        }
+    }
+
+    return 1;
+}
+#endif // __linux__
+
+/*++
+    PAL_CopyModuleData
+
+    Copy the loaded image of a module into a buffer
+
+Parameters:
+    PVOID moduleBase - base address of the module, as returned by PAL_GetSymbolModuleBase
+    PVOID destinationBufferStart - start of the destination buffer
+    PVOID destinationBufferEnd - end of the destination buffer
+
+Return value:
+    number of bytes of the buffer used by the module image, 0 if the module was not found
+    or copying it is not supported on the platform
+--*/
+SIZE_T
+PALAPI
+PAL_CopyModuleData(PVOID moduleBase, PVOID destinationBufferStart, PVOID destinationBufferEnd)
+{
+    SIZE_T retval = 0;
+
+    PERF_ENTRY(PAL_CopyModuleData);
+    ENTRY("PAL_CopyModuleData(moduleBase=%p, destinationBufferStart=%p, destinationBufferEnd=%p)\n",
+        moduleBase, destinationBufferStart, destinationBufferEnd);
+
+#ifdef __linux__
+    CopyModuleDataParam param;
+    param.moduleBase = (uint8_t *)moduleBase;
+    param.destinationBufferStart = (uint8_t *)destinationBufferStart;
+    param.destinationBufferEnd = (uint8_t *)destinationBufferEnd;
+    param.size = 0;
+    param.found = false;
+
+    dl_iterate_phdr(CopyModuleDataCallback, &param);
+    if (param.found)
+    {
+        retval = param.size;
+    }
+    else
+    {
+        TRACE("Module with base address %p not found\n", moduleBase);
+        SetLastError(ERROR_INVALID_DATA);
+    }
+#else
+    SetLastError(ERROR_NOT_SUPPORTED);
+#endif // __linux__
+
+    LOGEXIT("PAL_CopyModuleData returns %zu\n", retval);
+    PERF_EXIT(PAL_CopyModuleData);
+    return retval;
+}
+
 /*++
     PAL_GetLoadLibraryError
 
@@ -2248,13 +2248,46 @@ void * MAPMapPEFile(HANDLE hFile, off_t offset)
         forceOveralign = true;
     }
 
+    // Images that are not marked as relocatable (e.g. composite ReadyToRun images of the framework that were built with a
+    // fixed base to be shared between processes) are loaded at their preferred base when it is free, like the Windows
+    // loader does. No base relocations are applied then, so none of the file backed pages is copied on write.
+    if ((VAL16(ntHeader.OptionalHeader.DllCharacteristics) & IMAGE_DLLCHARACTERISTICS_DYNAMIC_BASE) == 0
+#if _DEBUG
+        && !forceRelocs
+#endif // _DEBUG
+        )
+    {
+        // No MAP_FIXED, an existing mapping at the preferred base must not be replaced
+        int mapFlags = MAP_ANON|MAP_PRIVATE;
+#ifdef __APPLE__
+        if (IsRunningOnMojaveHardenedRuntime())
+        {
+            mapFlags |= MAP_JIT;
+        }
+#endif // __APPLE__
+        loadedBase = mmap((void*)preferredBase, reserveSize, PROT_NONE, mapFlags, -1, 0);
+        if (loadedBase == MAP_FAILED)
+        {
+            loadedBase = NULL;
+        }
+        else if ((SIZE_T)loadedBase != preferredBase)
+        {
+            TRACE_(LOADER)("Preferred base %p of a fixed base image is not available\n", (void*)preferredBase);
+            munmap(loadedBase, reserveSize);
+            loadedBase = NULL;
+        }
+    }
+
 #ifdef HOST_64BIT
-    // First try to reserve virtual memory using ExecutableAllocator. This allows all PE images to be
+    // Otherwise try to reserve virtual memory using ExecutableAllocator. This allows all PE images to be
     // near each other and close to the coreclr library which also allows the runtime to generate
     // more efficient code (by avoiding usage of jump stubs). Alignment to a 64 KB granularity should
     // not be necessary (alignment to page size should be sufficient), but see
     // ExecutableMemoryAllocator::AllocateMemory() for the reason why it is done.
-    loadedBase = ReserveMemoryFromExecutableAllocator(pThread, ALIGN_UP(reserveSize, VIRTUAL_64KB));
+    if (loadedBase == NULL)
+    {
+        loadedBase = ReserveMemoryFromExecutableAllocator(pThread, ALIGN_UP(reserveSize, VIRTUAL_64KB));
+    }
 #endif // HOST_64BIT
 
     if (loadedBase == NULL)
@@ -2447,6 +2480,15 @@ void * MAPMapPEFile(HANDLE hFile, off_t offset)
             goto doneReleaseMappingCriticalSection;
         }
 
+#ifdef MADV_HUGEPAGE
+        // Sections of an image that was laid out with a large section alignment start on a huge page boundary, let the
+        // kernel back the read only ones (code in particular) with huge pages where the file system supports it
+        if (forceOveralign && ((prot & PROT_WRITE) == 0))
+        {
+            madvise(sectionData, currentHeader.SizeOfRawData, MADV_HUGEPAGE);
+        }
+#endif // MADV_HUGEPAGE
+
 #if _DEBUG
         {
             // Ensure null termination of section name (which is allowed to not be null terminated if exactly 8 characters long)
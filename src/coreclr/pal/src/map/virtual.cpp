@@ -51,6 +51,12 @@ CRITICAL_SECTION virtual_critsec;
 // The first node in our list of allocated blocks.
 static PCMI pVirtualMemory;
 
+// The entries of the list above sorted by start address in an array, so that the region
+// containing an address can be found with a binary search. Protected by virtual_critsec.
+static PCMI * s_pVirtualMemoryIndex;
+static SIZE_T s_virtualMemoryIndexCount;
+static SIZE_T s_virtualMemoryIndexCapacity;
+
 static size_t s_virtualPageSize = 0;
 
 /* We need MAP_ANON. However on some platforms like HP-UX, it is defined as MAP_ANONYMOUS */
@@ -172,6 +178,9 @@ VIRTUALInitialize(bool initializeExecutableMemoryAllocator)
     InternalInitializeCriticalSection(&virtual_critsec);
 
     pVirtualMemory = NULL;
+    s_pVirtualMemoryIndex = NULL;
+    s_virtualMemoryIndexCount = 0;
+    s_virtualMemoryIndexCapacity = 0;
 
     if (initializeExecutableMemoryAllocator)
     {
@@ -210,6 +219,11 @@ void VIRTUALCleanup()
     }
     pVirtualMemory = NULL;
 
+    free(s_pVirtualMemoryIndex);
+    s_pVirtualMemoryIndex = NULL;
+    s_virtualMemoryIndexCount = 0;
+    s_virtualMemoryIndexCapacity = 0;
+
     InternalLeaveCriticalSection(pthrCurrent, &virtual_critsec);
 
     TRACE( "Deleting the Virtual Critical Sections. \n" );
@@ -465,6 +479,38 @@ static BOOL VIRTUALSetAllocState( UINT nAction, SIZE_T nStartingBit,
                               nNumberOfBits, pInformation->pAllocState);
 }
 
+/****
+ *
+ * VIRTUALFindIndexPosition( )
+ *
+ *          IN UINT_PTR address - The address to look for.
+ *
+ *          Returns the number of regions starting at or below the address,
+ *          i.e. the position in the index at which a region starting at the
+ *          address would be inserted.
+ *          NOTE: The caller must own the critical section.
+ */
+static SIZE_T VIRTUALFindIndexPosition( IN UINT_PTR address )
+{
+    SIZE_T low = 0;
+    SIZE_T high = s_virtualMemoryIndexCount;
+
+    while ( low < high )
+    {
+        SIZE_T middle = low + (high - low) / 2;
+        if ( s_pVirtualMemoryIndex[middle]->startBoundary <= address )
+        {
+            low = middle + 1;
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+
+    return low;
+}
+
 /****
  *
  * VIRTUALFindRegionInformation( )
@@ -476,26 +522,20 @@ static BOOL VIRTUALSetAllocState( UINT nAction, SIZE_T nStartingBit,
 static PCMI VIRTUALFindRegionInformation( IN UINT_PTR address )
 {
     PCMI pEntry = NULL;
+    SIZE_T index;
 
     TRACE( "VIRTUALFindRegionInformation( %#x )\n", address );
 
-    pEntry = pVirtualMemory;
-
-    while( pEntry )
+    index = VIRTUALFindIndexPosition( address );
+    if ( index > 0 )
     {
-        if ( pEntry->startBoundary > address )
+        pEntry = s_pVirtualMemoryIndex[index - 1];
+        if ( pEntry->startBoundary + pEntry->memSize <= address )
         {
-            /* Gone past the possible location in the list. */
             pEntry = NULL;
-            break;
-        }
-        if ( pEntry->startBoundary + pEntry->memSize > address )
-        {
-            break;
         }
-
-        pEntry = pEntry->pNext;
     }
+
     return pEntry;
 }
 
@@ -518,6 +558,12 @@ static BOOL VIRTUALReleaseMemory( PCMI pMemoryToBeReleased )
         return FALSE;
     }
 
+    SIZE_T index = VIRTUALFindIndexPosition( pMemoryToBeReleased->startBoundary );
+    _ASSERTE( index > 0 && s_pVirtualMemoryIndex[index - 1] == pMemoryToBeReleased );
+    memmove( &s_pVirtualMemoryIndex[index - 1], &s_pVirtualMemoryIndex[index],
+             (s_virtualMemoryIndexCount - index) * sizeof(PCMI) );
+    s_virtualMemoryIndexCount--;
+
     if ( pMemoryToBeReleased == pVirtualMemory )
     {
         /* This is either the first entry, or the only entry. */
@@ -720,8 +766,8 @@ static BOOL VIRTUALStoreAllocationInfo(
             IN DWORD flProtection )     /* Protections flags on the memory. */
 {
     PCMI pNewEntry       = nullptr;
-    PCMI pMemInfo        = nullptr;
     SIZE_T nBufferSize   = 0;
+    SIZE_T index         = 0;
 
     if (!IS_ALIGNED(memSize, GetVirtualPageSize()))
     {
@@ -729,6 +775,20 @@ static BOOL VIRTUALStoreAllocationInfo(
         return FALSE;
     }
 
+    if (s_virtualMemoryIndexCount == s_virtualMemoryIndexCapacity)
+    {
+        SIZE_T newCapacity = (s_virtualMemoryIndexCapacity == 0) ? 64 : s_virtualMemoryIndexCapacity * 2;
+        PCMI * pNewIndex = (PCMI *)InternalRealloc(s_pVirtualMemoryIndex, newCapacity * sizeof(PCMI));
+        if (pNewIndex == nullptr)
+        {
+            ERROR( "Unable to allocate memory for the region index.\n");
+            return FALSE;
+        }
+
+        s_pVirtualMemoryIndex = pNewIndex;
+        s_virtualMemoryIndexCapacity = newCapacity;
+    }
+
     if (!(pNewEntry = (PCMI)InternalMalloc(sizeof(*pNewEntry))))
     {
         ERROR( "Unable to allocate memory for the structure.\n");
@@ -773,39 +833,29 @@ static BOOL VIRTUALStoreAllocationInfo(
         return FALSE;
     }
 
-    pMemInfo = pVirtualMemory;
+    /* The neighbours in the index are the neighbours in the list. */
+    index = VIRTUALFindIndexPosition(startBoundary);
+    memmove(&s_pVirtualMemoryIndex[index + 1], &s_pVirtualMemoryIndex[index],
+            (s_virtualMemoryIndexCount - index) * sizeof(PCMI));
+    s_pVirtualMemoryIndex[index] = pNewEntry;
+    s_virtualMemoryIndexCount++;
 
-    if (pMemInfo && pMemInfo->startBoundary < startBoundary)
-    {
-        /* Look for the correct insert point */
-        TRACE("Looking for the correct insert location.\n");
-        while (pMemInfo->pNext && (pMemInfo->pNext->startBoundary < startBoundary))
-        {
-            pMemInfo = pMemInfo->pNext;
-        }
+    pNewEntry->pPrevious = (index > 0) ? s_pVirtualMemoryIndex[index - 1] : nullptr;
+    pNewEntry->pNext = (index + 1 < s_virtualMemoryIndexCount) ? s_pVirtualMemoryIndex[index + 1] : nullptr;
 
-        pNewEntry->pNext = pMemInfo->pNext;
-        pNewEntry->pPrevious = pMemInfo;
-
-        if (pNewEntry->pNext)
-        {
-            pNewEntry->pNext->pPrevious = pNewEntry;
-        }
+    if (pNewEntry->pNext)
+    {
+        pNewEntry->pNext->pPrevious = pNewEntry;
+    }
 
-        pMemInfo->pNext = pNewEntry;
+    if (pNewEntry->pPrevious)
+    {
+        pNewEntry->pPrevious->pNext = pNewEntry;
     }
     else
     {
         /* This is the first entry in the list. */
-        pNewEntry->pNext = pMemInfo;
-        pNewEntry->pPrevious = nullptr;
-
-        if (pNewEntry->pNext)
-        {
-            pNewEntry->pNext->pPrevious = pNewEntry;
-        }
-
-        pVirtualMemory = pNewEntry ;
+        pVirtualMemory = pNewEntry;
     }
 
 #ifdef DEBUG
@@ -1319,6 +1369,38 @@ PAL_VirtualReserveFromExecutableMemoryAllocatorWithinRange(
 #endif // HOST_64BIT
 }
 
+/*++
+Function:
+  PAL_VirtualPreferLargePages
+
+  This function hints the OS that a reserved region should be backed by transparent huge pages
+  as it gets committed. The region keeps working with normal pages if the hint is not honored.
+  Returns TRUE if the hint was accepted.
+
+  lpAddress - Start of the region, should be aligned to the huge page size
+  dwSize - Size of the region, should be a multiple of the huge page size
+--*/
+BOOL
+PALAPI
+PAL_VirtualPreferLargePages(
+    IN LPVOID lpAddress,
+    IN SIZE_T dwSize)
+{
+    BOOL bRetVal = FALSE;
+
+    PERF_ENTRY(PAL_VirtualPreferLargePages);
+    ENTRY("PAL_VirtualPreferLargePages(lpAddress = %p, dwSize = %Iu)\n", lpAddress, dwSize);
+
+#ifdef MADV_HUGEPAGE
+    // The advice is recorded on the mapping, committing the pages later with mprotect keeps it.
+    bRetVal = (madvise(lpAddress, dwSize, MADV_HUGEPAGE) == 0);
+#endif
+
+    LOGEXIT("PAL_VirtualPreferLargePages returning %d\n", bRetVal);
+    PERF_EXIT(PAL_VirtualPreferLargePages);
+    return bRetVal;
+}
+
 /*++
 Function:
   VirtualAlloc
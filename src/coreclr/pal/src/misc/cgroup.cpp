@@ -39,6 +39,8 @@ SET_DEFAULT_DEBUG_CHANNEL(MISC);
 #define CGROUP2_MEMORY_LIMIT_FILENAME "/memory.max"
 #define CGROUP1_MEMORY_USAGE_FILENAME "/memory.usage_in_bytes"
 #define CGROUP2_MEMORY_USAGE_FILENAME "/memory.current"
+#define CGROUP2_MEMORY_HIGH_FILENAME "/memory.high"
+#define CGROUP2_MEMORY_PRESSURE_FILENAME "/memory.pressure"
 #define CGROUP1_CFS_QUOTA_FILENAME "/cpu.cfs_quota_us"
 #define CGROUP1_CFS_PERIOD_FILENAME "/cpu.cfs_period_us"
 #define CGROUP2_CPU_MAX_FILENAME "/cpu.max"
@@ -58,6 +60,18 @@ public:
         s_cpu_cgroup_path = FindCGroupPath(s_cgroup_version == 1 ? &IsCGroup1CpuSubsystem : nullptr);
     }
 
+    // Re-reads the cgroup hierarchy of the process, e.g. after it was restored from a checkpoint into another cgroup.
+    // The previous paths are not freed, other threads may still be reading the limits through them.
+    static void Refresh()
+    {
+        s_cgroup_version = FindCGroupVersion();
+        char *memory_cgroup_path = FindCGroupPath(s_cgroup_version == 1 ? &IsCGroup1MemorySubsystem : nullptr);
+        char *cpu_cgroup_path = FindCGroupPath(s_cgroup_version == 1 ? &IsCGroup1CpuSubsystem : nullptr);
+
+        s_memory_cgroup_path = memory_cgroup_path;
+        s_cpu_cgroup_path = cpu_cgroup_path;
+    }
+
     static void Cleanup()
     {
         PAL_free(s_memory_cgroup_path);
@@ -94,6 +108,32 @@ public:
         }
     }
 
+    static bool GetMemoryPressure(UINT *stall_some, UINT *stall_full, UINT64 *high_limit)
+    {
+        // memory.pressure (PSI) and memory.high only exist in the unified hierarchy
+        if (s_cgroup_version != 2 || s_memory_cgroup_path == nullptr)
+            return false;
+
+        bool result = false;
+
+        *stall_some = 0;
+        *stall_full = 0;
+        *high_limit = 0;
+
+        // "max" means there is no memory.high throttling limit and doesn't parse as a number
+        uint64_t high;
+        if (GetCGroupMemoryLimit(&high, CGROUP2_MEMORY_HIGH_FILENAME) && high <= 0x7FFFFFFF00000000)
+        {
+            *high_limit = high;
+            result = true;
+        }
+
+        if (GetCGroup2MemoryStall(stall_some, stall_full))
+            result = true;
+
+        return result;
+    }
+
     static bool GetCpuLimit(UINT *val)
     {
         if (s_cgroup_version == 0)
@@ -424,6 +464,55 @@ private:
         return ::ReadMemoryValueFromFile(filename, val);
     }
 
+    static bool GetCGroup2MemoryStall(UINT *stall_some, UINT *stall_full)
+    {
+        char *filename = nullptr;
+        FILE *file = nullptr;
+        char *line = nullptr;
+        size_t lineLen = 0;
+        bool result = false;
+
+        if (asprintf(&filename, "%s%s", s_memory_cgroup_path, CGROUP2_MEMORY_PRESSURE_FILENAME) < 0)
+            return false;
+
+        file = fopen(filename, "r");
+        if (file == nullptr)
+            goto done;
+
+        // The expected format is:
+        //     some avg10=0.00 avg60=0.00 avg300=0.00 total=0
+        //     full avg10=0.00 avg60=0.00 avg300=0.00 total=0
+        // where avg10 is the percentage of the last 10 seconds in which at least one ("some") or all ("full")
+        // non-idle tasks in the cgroup were stalled waiting on memory. We report it in hundredths of a percent.
+        while (getline(&line, &lineLen, file) != -1)
+        {
+            char kind[8];
+            unsigned int whole;
+            unsigned int fraction;
+            if (sscanf_s(line, "%7s avg10=%u.%2u", kind, (unsigned)sizeof(kind), &whole, &fraction) != 3)
+                continue;
+
+            UINT stall = (UINT)(whole * 100 + fraction);
+            if (strcmp(kind, "some") == 0)
+            {
+                *stall_some = stall;
+                result = true;
+            }
+            else if (strcmp(kind, "full") == 0)
+            {
+                *stall_full = stall;
+            }
+        }
+
+    done:
+        if (file)
+            fclose(file);
+        free(filename);
+        free(line);
+
+        return result;
+    }
+
     static bool GetCGroup1CpuLimit(UINT *val)
     {
         long long quota;
@@ -693,3 +782,20 @@ PAL_GetCpuLimit(UINT* val)
 
     return CGroup::GetCpuLimit(val);
 }
+
+VOID
+PALAPI
+PAL_RefreshCGroup()
+{
+    CGroup::Refresh();
+}
+
+BOOL
+PALAPI
+PAL_GetMemoryPressure(UINT* stall_some, UINT* stall_full, UINT64* high_limit)
+{
+    if (stall_some == nullptr || stall_full == nullptr || high_limit == nullptr)
+        return FALSE;
+
+    return CGroup::GetMemoryPressure(stall_some, stall_full, high_limit);
+}
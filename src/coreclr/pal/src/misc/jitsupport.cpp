@@ -63,7 +63,9 @@ static const CpuCapability CpuCapabilities[] = {
     { "asimddp", HWCAP_ASIMDDP },
 #endif
     //{ "sha512", HWCAP_SHA512 },
-    //{ "sve", HWCAP_SVE },
+#ifdef HWCAP_SVE
+    { "sve", HWCAP_SVE },
+#endif
     //{ "asimdfhm", HWCAP_ASIMDFHM },
     //{ "dit", HWCAP_DIT },
     //{ "uscat", HWCAP_USCAT },
@@ -252,8 +254,8 @@ PAL_GetJitCpuCapabilityFlags(CORJIT_FLAGS *flags)
 //        flags->Set(CORJIT_FLAGS::CORJIT_FLAG_HAS_ARM64_SM4);
 #endif
 #ifdef HWCAP_SVE
-//    if (hwCap & HWCAP_SVE)
-//        flags->Set(CORJIT_FLAGS::CORJIT_FLAG_HAS_ARM64_SVE);
+    if (hwCap & HWCAP_SVE)
+        flags->Set(InstructionSet_Sve);
 #endif
 #else // !HAVE_AUXV_HWCAP_H
 #if HAVE_SYSCTLBYNAME
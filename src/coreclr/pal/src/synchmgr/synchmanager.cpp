@@ -38,6 +38,11 @@ SET_DEFAULT_DEBUG_CHANNEL(SYNC); // some headers have code with asserts, so do t
 #include "pal/fakepoll.h"
 #endif // HAVE_POLL
 
+#if SYNCHMGR_FUTEX_NATIVE_WAIT
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#endif // SYNCHMGR_FUTEX_NATIVE_WAIT
+
 #include <algorithm>
 
 const int CorUnix::CThreadSynchronizationInfo::PendingSignalingsArraySize;
@@ -461,6 +466,12 @@ namespace CorUnix
             }
         }
 
+#if SYNCHMGR_FUTEX_NATIVE_WAIT
+        palErr = ThreadNativeFutexWait(ptnwdNativeWaitData,
+            (INFINITE == dwTimeout) ? NULL : &tsAbsTmo, ptwrWakeupReason, pdwSignaledObject);
+        goto TNW_exit;
+#endif // SYNCHMGR_FUTEX_NATIVE_WAIT
+
         // Lock the mutex
         iRet = pthread_mutex_lock(&ptnwdNativeWaitData->mutex);
         if (0 != iRet)
@@ -547,6 +558,70 @@ namespace CorUnix
         return palErr;
     }
 
+#if SYNCHMGR_FUTEX_NATIVE_WAIT
+    /*++
+    Method:
+      CPalSynchronizationManager::ThreadNativeFutexWait
+
+    Futex based implementation of ThreadNativeWait. ptsAbsTmo is an absolute
+    CLOCK_MONOTONIC timeout, or NULL for an infinite wait.
+    --*/
+    PAL_ERROR CPalSynchronizationManager::ThreadNativeFutexWait(
+        ThreadNativeWaitData * ptnwdNativeWaitData,
+        const struct timespec * ptsAbsTmo,
+        ThreadWakeupReason * ptwrWakeupReason,
+        DWORD * pdwSignaledObject)
+    {
+        int * piPred = &ptnwdNativeWaitData->iPred;
+
+        while (true)
+        {
+            int iPred = ThreadNativeWaitData::NativeWaitPredSignaled;
+            if (__atomic_compare_exchange_n(piPred, &iPred, ThreadNativeWaitData::NativeWaitPredNotSignaled,
+                                            false, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED))
+            {
+                // The wakeup reason and object index are published before the predicate
+                *ptwrWakeupReason  = ptnwdNativeWaitData->twrWakeupReason;
+                *pdwSignaledObject = ptnwdNativeWaitData->dwObjectIndex;
+                return NO_ERROR;
+            }
+
+            // Let the signaling thread know that it has to wake us up
+            if (ThreadNativeWaitData::NativeWaitPredNotSignaled == iPred &&
+                !__atomic_compare_exchange_n(piPred, &iPred, ThreadNativeWaitData::NativeWaitPredWaiting,
+                                             false, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+            {
+                // Signaled in the meantime
+                continue;
+            }
+
+            int iRet = syscall(SYS_futex, piPred, FUTEX_WAIT_BITSET_PRIVATE,
+                               ThreadNativeWaitData::NativeWaitPredWaiting, ptsAbsTmo, NULL, FUTEX_BITSET_MATCH_ANY);
+            if (0 != iRet)
+            {
+                if (ETIMEDOUT == errno)
+                {
+                    _ASSERT_MSG(NULL != ptsAbsTmo, "Got ETIMEDOUT despite timeout being INFINITE\n");
+
+                    // A signal racing with the timeout is left in the predicate for the
+                    // 'second native wait' (see comments in BlockThread)
+                    iPred = ThreadNativeWaitData::NativeWaitPredWaiting;
+                    __atomic_compare_exchange_n(piPred, &iPred, ThreadNativeWaitData::NativeWaitPredNotSignaled,
+                                                false, __ATOMIC_RELAXED, __ATOMIC_RELAXED);
+                    *ptwrWakeupReason = WaitTimeout;
+                    return NO_ERROR;
+                }
+                else if (EAGAIN != errno && EINTR != errno)
+                {
+                    ERROR("futex wait failed [errno=%d (%s)]\n", errno, strerror(errno));
+                    *ptwrWakeupReason = WaitFailed;
+                    return ERROR_INTERNAL_ERROR;
+                }
+            }
+        }
+    }
+#endif // SYNCHMGR_FUTEX_NATIVE_WAIT
+
     /*++
     Method:
       CPalSynchronizationManager::AbandonObjectsOwnedByThread
@@ -2475,6 +2550,22 @@ namespace CorUnix
         PAL_ERROR palErr = NO_ERROR;
         int iRet;
 
+#if SYNCHMGR_FUTEX_NATIVE_WAIT
+        // Publishes twrWakeupReason and dwObjectIndex along with the predicate
+        if (ThreadNativeWaitData::NativeWaitPredWaiting ==
+            __atomic_exchange_n(&ptnwdNativeWaitData->iPred, ThreadNativeWaitData::NativeWaitPredSignaled, __ATOMIC_RELEASE))
+        {
+            iRet = syscall(SYS_futex, &ptnwdNativeWaitData->iPred, FUTEX_WAKE_PRIVATE, 1, NULL, NULL, 0);
+            if (-1 == iRet)
+            {
+                ERROR("futex wake failed [errno=%d (%s)]\n", errno, strerror(errno));
+                palErr = ERROR_INTERNAL_ERROR;
+            }
+        }
+
+        return palErr;
+#endif // SYNCHMGR_FUTEX_NATIVE_WAIT
+
         // Lock the mutex
         iRet = pthread_mutex_lock(&ptnwdNativeWaitData->mutex);
         if (0 != iRet)
@@ -941,6 +941,14 @@ namespace CorUnix
             ThreadWakeupReason * ptwrWakeupReason,
             DWORD * pdwSignaledObject);
 
+#if SYNCHMGR_FUTEX_NATIVE_WAIT
+        static PAL_ERROR ThreadNativeFutexWait(
+            ThreadNativeWaitData * ptnwdNativeWaitData,
+            const struct timespec * ptsAbsTmo,
+            ThreadWakeupReason * ptwrWakeupReason,
+            DWORD * pdwSignaledObject);
+#endif // SYNCHMGR_FUTEX_NATIVE_WAIT
+
         static void ThreadPrepareForShutdown(void);
 
 #ifndef CORECLR
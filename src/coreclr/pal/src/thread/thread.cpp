@@ -2521,6 +2521,63 @@ CPalThread::WaitForStartStatus(
 }
 
 #if !HAVE_MACH_EXCEPTIONS
+
+// Alternate signal stacks of exited threads are kept for reuse by new threads, so that
+// bursts of short lived threads do not pay for an mmap, mprotect and munmap each.
+#define MAX_CACHED_ALTERNATE_STACKS 16
+
+static pthread_mutex_t s_alternateStackCacheLock = PTHREAD_MUTEX_INITIALIZER;
+static void *s_alternateStackCache[MAX_CACHED_ALTERNATE_STACKS];
+static int s_alternateStackCacheCount = 0;
+
+static
+int
+GetSignalAlternateStackSize()
+{
+    // We include the size of the SignalHandlerWorkerReturnPoint in the alternate stack size since the
+    // context contained in it is large and the SIGSTKSZ was not sufficient on ARM64 during testing.
+    int altStackSize = SIGSTKSZ + ALIGN_UP(sizeof(SignalHandlerWorkerReturnPoint), 16) + GetVirtualPageSize();
+#ifdef HAS_ASAN
+    // Asan also uses alternate stack so we increase its size on the SIGSTKSZ * 4 that enough for asan
+    // (see kAltStackSize in compiler-rt/lib/sanitizer_common/sanitizer_posix_libcdep.cc)
+    altStackSize += SIGSTKSZ * 4;
+#endif
+    return ALIGN_UP(altStackSize, GetVirtualPageSize());
+}
+
+static
+void *
+TakeCachedSignalAlternateStack()
+{
+    void *altStack = nullptr;
+
+    pthread_mutex_lock(&s_alternateStackCacheLock);
+    if (s_alternateStackCacheCount > 0)
+    {
+        altStack = s_alternateStackCache[--s_alternateStackCacheCount];
+    }
+    pthread_mutex_unlock(&s_alternateStackCacheLock);
+
+    return altStack;
+}
+
+static
+bool
+CacheSignalAlternateStack(void *altStack)
+{
+    bool cached = false;
+
+    pthread_mutex_lock(&s_alternateStackCacheLock);
+    if (s_alternateStackCacheCount < MAX_CACHED_ALTERNATE_STACKS)
+    {
+        s_alternateStackCache[s_alternateStackCacheCount++] = altStack;
+        cached = true;
+    }
+    pthread_mutex_unlock(&s_alternateStackCacheLock);
+
+    return cached;
+}
+
 /*++
 Function :
     EnsureSignalAlternateStack
@@ -2546,34 +2603,38 @@ CPalThread::EnsureSignalAlternateStack()
         st = sigaltstack(NULL, &oss);
         if ((st == 0) && (oss.ss_flags == SS_DISABLE))
         {
-            // There is no alternate stack for SIGSEGV handling installed yet so allocate one
+            // There is no alternate stack for SIGSEGV handling installed yet so allocate one,
+            // preferably by reusing the one of a thread that has exited
+            int altStackSize = GetSignalAlternateStackSize();
 
-            // We include the size of the SignalHandlerWorkerReturnPoint in the alternate stack size since the
-            // context contained in it is large and the SIGSTKSZ was not sufficient on ARM64 during testing.
-            int altStackSize = SIGSTKSZ + ALIGN_UP(sizeof(SignalHandlerWorkerReturnPoint), 16) + GetVirtualPageSize();
-#ifdef HAS_ASAN
-            // Asan also uses alternate stack so we increase its size on the SIGSTKSZ * 4 that enough for asan
-            // (see kAltStackSize in compiler-rt/lib/sanitizer_common/sanitizer_posix_libcdep.cc)
-            altStackSize += SIGSTKSZ * 4;
-#endif
-            altStackSize = ALIGN_UP(altStackSize, GetVirtualPageSize());
-            int flags = MAP_ANONYMOUS | MAP_PRIVATE;
+            void* altStack = TakeCachedSignalAlternateStack();
+            if (altStack == nullptr)
+            {
+                int flags = MAP_ANONYMOUS | MAP_PRIVATE;
 #ifdef MAP_STACK
-            flags |= MAP_STACK;
+                flags |= MAP_STACK;
 #endif
-            void* altStack = mmap(NULL, altStackSize, PROT_READ | PROT_WRITE, flags, -1, 0);
-            if (altStack != MAP_FAILED)
-            {
-                // create a guard page for the alternate stack
-                st = mprotect(altStack, GetVirtualPageSize(), PROT_NONE);
-                if (st == 0)
+                altStack = mmap(NULL, altStackSize, PROT_READ | PROT_WRITE, flags, -1, 0);
+                if (altStack != MAP_FAILED)
                 {
-                    stack_t ss;
-                    ss.ss_sp = (char*)altStack;
-                    ss.ss_size = altStackSize;
-                    ss.ss_flags = 0;
-                    st = sigaltstack(&ss, NULL);
+                    // create a guard page for the alternate stack
+                    st = mprotect(altStack, GetVirtualPageSize(), PROT_NONE);
+                    if (st != 0)
+                    {
+                        int st2 = munmap(altStack, altStackSize);
+                        _ASSERTE(st2 == 0);
+                        altStack = MAP_FAILED;
+                    }
                 }
+            }
+
+            if (altStack != MAP_FAILED)
+            {
+                stack_t ss;
+                ss.ss_sp = (char*)altStack;
+                ss.ss_size = altStackSize;
+                ss.ss_flags = 0;
+                st = sigaltstack(&ss, NULL);
 
                 if (st == 0)
                 {
@@ -2624,8 +2685,11 @@ CPalThread::FreeSignalAlternateStack()
             // Make sure this altstack is this PAL's before freeing.
             if (oss.ss_sp == altstack)
             {
-                int st = munmap(oss.ss_sp, oss.ss_size);
-                _ASSERTE(st == 0);
+                if ((oss.ss_size != (size_t)GetSignalAlternateStackSize()) || !CacheSignalAlternateStack(oss.ss_sp))
+                {
+                    int st = munmap(oss.ss_sp, oss.ss_size);
+                    _ASSERTE(st == 0);
+                }
             }
         }
     }
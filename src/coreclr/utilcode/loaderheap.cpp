@@ -14,6 +14,8 @@
 
 INDEBUG(DWORD UnlockedLoaderHeap::s_dwNumInstancesOfLoaderHeaps = 0;)
 
+LONG64 UnlockedLoaderHeap::s_totalCommittedBytes = 0;
+
 #ifdef RANDOMIZE_ALLOC
 #include <time.h>
 static class Random
@@ -699,7 +701,7 @@ struct LoaderHeapFreeBlock
         size_t                 m_dwSize;   // Total size of this block (including this header)
 //! Try not to grow the size of this structure. It places a minimum size on LoaderHeap allocations.
 
-        static void InsertFreeBlock(LoaderHeapFreeBlock **ppHead, void *pMem, size_t dwTotalSize, UnlockedLoaderHeap *pHeap)
+        static void InsertFreeBlock(LoaderHeapFreeBlock **ppHead, void *pMem, size_t dwTotalSize, UnlockedLoaderHeap *pHeap, BOOL fMerge = TRUE)
         {
             STATIC_CONTRACT_NOTHROW;
             STATIC_CONTRACT_GC_NOTRIGGER;
@@ -728,7 +730,11 @@ struct LoaderHeapFreeBlock
             pNewBlock->m_dwSize = dwTotalSize;
             *ppHead = pNewBlock;
 
-            MergeBlock(pNewBlock, pHeap);
+            // Blocks on exact size lists must keep their size, so they are never merged
+            if (fMerge)
+            {
+                MergeBlock(pNewBlock, pHeap);
+            }
 
             LOADER_HEAP_END_TRAP_FAULT
         }
@@ -942,6 +948,7 @@ UnlockedLoaderHeap::UnlockedLoaderHeap(DWORD dwReserveBlockSize,
 #endif // CROSSGEN_COMPILE
 
     m_pFirstFreeBlock            = NULL;
+    memset(m_pSmallFreeBlocks, 0, sizeof(m_pSmallFreeBlocks));
 
     if (dwReservedRegionAddress != NULL && dwReservedRegionSize > 0)
     {
@@ -991,6 +998,8 @@ UnlockedLoaderHeap::~UnlockedLoaderHeap()
         _ASSERTE(fSuccess);
     }
 
+    InterlockedExchangeAdd64(&s_totalCommittedBytes, -(LONG64)m_dwTotalAlloc);
+
     INDEBUG(s_dwNumInstancesOfLoaderHeaps --;)
 }
 
@@ -1025,6 +1034,17 @@ void UnlockedLoaderHeap::DebugGuardHeap()
 }
 #endif
 
+// Returns the exact size free list for blocks of dwTotalSize bytes, or NULL if such blocks belong on the general free list
+LoaderHeapFreeBlock **UnlockedLoaderHeap::GetSmallFreeList(size_t dwTotalSize)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    _ASSERTE(0 == (dwTotalSize & ALLOC_ALIGN_CONSTANT));
+
+    size_t index = dwTotalSize / (ALLOC_ALIGN_CONSTANT + 1);
+    return (index < LOADER_HEAP_SMALL_FREE_LIST_COUNT) ? &m_pSmallFreeBlocks[index] : NULL;
+}
+
 size_t UnlockedLoaderHeap::GetBytesAvailCommittedRegion()
 {
     LIMITED_METHOD_CONTRACT;
@@ -1156,6 +1176,7 @@ BOOL UnlockedLoaderHeap::UnlockedReservePages(size_t dwSizeToCommit)
     }
 
     m_dwTotalAlloc += dwSizeToCommit;
+    InterlockedExchangeAdd64(&s_totalCommittedBytes, (LONG64)dwSizeToCommit);
 
     LoaderHeapBlock *pNewBlock;
 
@@ -1226,6 +1247,7 @@ BOOL UnlockedLoaderHeap::GetMoreCommittedPages(size_t dwMinSize)
             return FALSE;
 
         m_dwTotalAlloc += dwSizeToCommit;
+        InterlockedExchangeAdd64(&s_totalCommittedBytes, (LONG64)dwSizeToCommit);
 
         m_pPtrToEndOfCommittedRegion += dwSizeToCommit;
         return TRUE;
@@ -1323,8 +1345,18 @@ void *UnlockedLoaderHeap::UnlockedAllocMem_NoThrow(size_t dwSize
 again:
 
     {
-        // Any memory available on the free list?
-        void *pData = LoaderHeapFreeBlock::AllocFromFreeList(&m_pFirstFreeBlock, dwSize, TRUE /*fRemoveFromFreeList*/, this);
+        // Any memory available on the free lists? Blocks on an exact size list always match, so this is
+        // just a pop when the list isn't empty.
+        void *pData = NULL;
+        LoaderHeapFreeBlock **ppSmallFreeList = GetSmallFreeList(dwSize);
+        if (ppSmallFreeList != NULL && *ppSmallFreeList != NULL)
+        {
+            pData = LoaderHeapFreeBlock::AllocFromFreeList(ppSmallFreeList, dwSize, TRUE /*fRemoveFromFreeList*/, this);
+        }
+        if (!pData)
+        {
+            pData = LoaderHeapFreeBlock::AllocFromFreeList(&m_pFirstFreeBlock, dwSize, TRUE /*fRemoveFromFreeList*/, this);
+        }
         if (!pData)
         {
             // Enough bytes available in committed region?
@@ -1527,7 +1559,15 @@ void UnlockedLoaderHeap::UnlockedBackoutMem(void *pMem,
     }
     else
     {
-        LoaderHeapFreeBlock::InsertFreeBlock(&m_pFirstFreeBlock, pMem, dwSize, this);
+        LoaderHeapFreeBlock **ppSmallFreeList = GetSmallFreeList(dwSize);
+        if (ppSmallFreeList != NULL)
+        {
+            LoaderHeapFreeBlock::InsertFreeBlock(ppSmallFreeList, pMem, dwSize, this, FALSE /*fMerge*/);
+        }
+        else
+        {
+            LoaderHeapFreeBlock::InsertFreeBlock(&m_pFirstFreeBlock, pMem, dwSize, this);
+        }
     }
 
 }
@@ -1815,13 +1855,17 @@ void UnlockedLoaderHeap::EnumPageRegions (EnumPageRegionsCallback *pCallback, PT
 void UnlockedLoaderHeap::DumpFreeList()
 {
     LIMITED_METHOD_CONTRACT;
-    if (m_pFirstFreeBlock == NULL)
-    {
-        printf("FREEDUMP: FreeList is empty\n");
-    }
-    else
+    for (int iList = -1; iList < LOADER_HEAP_SMALL_FREE_LIST_COUNT; iList++)
     {
-        LoaderHeapFreeBlock *pBlock = m_pFirstFreeBlock;
+        LoaderHeapFreeBlock *pBlock = (iList < 0) ? m_pFirstFreeBlock : m_pSmallFreeBlocks[iList];
+        if (iList < 0 && pBlock == NULL)
+        {
+            printf("FREEDUMP: FreeList is empty\n");
+        }
+        else if (iList >= 0 && pBlock != NULL)
+        {
+            printf("FREEDUMP: Small free list %d\n", iList);
+        }
         while (pBlock != NULL)
         {
             size_t dwsize = pBlock->m_dwSize;
@@ -1950,21 +1994,36 @@ void LoaderHeapSniffer::ValidateFreeList(UnlockedLoaderHeap *pHeap)
     // This contract violation is permanent.
     CONTRACT_VIOLATION(ThrowsViolation|FaultViolation|GCViolation|ModeViolation);  // This violation won't be removed
 
-    LoaderHeapFreeBlock *pFree     = pHeap->m_pFirstFreeBlock;
+    LoaderHeapFreeBlock **ppHead   = &pHeap->m_pFirstFreeBlock;
+    LoaderHeapFreeBlock *pFree     = *ppHead;
     LoaderHeapFreeBlock *pPrev     = NULL;
+    int                  iNextSmallFreeList = 0;
 
 
     void                *pBadAddr = NULL;
     LoaderHeapFreeBlock *pProbeThis = NULL;
     const char          *pExpected = NULL;
 
-    while (pFree != NULL)
+    for (;;)
     {
+        if (pFree == NULL)
+        {
+            // Done with this list, move on to the next exact size list
+            if (iNextSmallFreeList == LOADER_HEAP_SMALL_FREE_LIST_COUNT)
+            {
+                break;
+            }
+            ppHead = &pHeap->m_pSmallFreeBlocks[iNextSmallFreeList++];
+            pFree  = *ppHead;
+            pPrev  = NULL;
+            continue;
+        }
+
         if ( 0 != ( ((ULONG_PTR)pFree) & ALLOC_ALIGN_CONSTANT ))
         {
             // Not aligned - can't be a valid freeblock. Most likely we followed a bad pointer from the previous block.
             pProbeThis = pPrev;
-            pBadAddr = pPrev ? &(pPrev->m_pNext) : &(pHeap->m_pFirstFreeBlock);
+            pBadAddr = pPrev ? &(pPrev->m_pNext) : ppHead;
             pExpected = "a pointer to a valid LoaderHeapFreeBlock";
             break;
         }
@@ -226,7 +226,13 @@ void StressLog::Initialize(unsigned facilities, unsigned level, unsigned maxByte
         theLog.hMapView = MapViewOfFileEx(hMap, FILE_MAP_ALL_ACCESS, 0, 0, fileSize, (void*)0x400000000000);
         if (theLog.hMapView == NULL)
         {
-            return;
+            // The fixed address is only a convenience for the analyzer, the log is self describing
+            // through memoryBase. The PAL does not support mapping at a requested address.
+            theLog.hMapView = MapViewOfFile(hMap, FILE_MAP_ALL_ACCESS, 0, 0, fileSize);
+            if (theLog.hMapView == NULL)
+            {
+                return;
+            }
         }
 
         StressLogHeader* hdr = (StressLogHeader*)(uint8_t*)(void*)theLog.hMapView;
@@ -271,6 +277,9 @@ void StressLog::AddModule(uint8_t* moduleBase)
         return;
     }
     hdr->modules[moduleIndex].baseAddress = moduleBase;
+#ifdef HOST_UNIX
+    hdr->modules[moduleIndex].size = PAL_CopyModuleData(moduleBase, &hdr->moduleImage[cumSize], &hdr->moduleImage[sizeof(hdr->moduleImage)]);
+#else
     uint8_t* addr = moduleBase;
     while (true)
     {
@@ -286,6 +295,7 @@ void StressLog::AddModule(uint8_t* moduleBase)
         addr += mbi.RegionSize;
         hdr->modules[moduleIndex].size = (size_t)(addr - (uint8_t*)moduleBase);
     }
+#endif //HOST_UNIX
 #endif //MEMORY_MAPPED_STRESSLOG
 }
 
@@ -899,15 +909,38 @@ void* StressLog::AllocMemoryMapped(size_t n)
 
 void* __cdecl ThreadStressLog::operator new(size_t n, const NoThrow&) NOEXCEPT
 {
+#ifdef HOST_WINDOWS
     if (StressLogChunk::s_LogChunkHeap != NULL)
     {
         //no need to zero memory because we could handle garbage contents
         return HeapAlloc(StressLogChunk::s_LogChunkHeap, 0, n);
     }
-    else
+#else
+    if (StressLog::theLog.stressLogHeader == nullptr)
     {
-        return StressLog::AllocMemoryMapped(n);
+        return malloc(n);
     }
+#endif //HOST_WINDOWS
+
+    return StressLog::AllocMemoryMapped(n);
+}
+
+void __cdecl ThreadStressLog::operator delete(void* p)
+{
+    if (StressLog::theLog.stressLogHeader != nullptr)
+    {
+        // the memory mapped file is only released when the process exits
+        return;
+    }
+
+#ifdef HOST_WINDOWS
+    if (StressLogChunk::s_LogChunkHeap != NULL)
+    {
+        HeapFree(StressLogChunk::s_LogChunkHeap, 0, p);
+    }
+#else
+    free(p);
+#endif //HOST_WINDOWS
 }
 #endif //MEMORY_MAPPED_STRESSLOG
 
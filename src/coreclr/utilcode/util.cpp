@@ -1236,6 +1236,8 @@ BOOL CPUGroupInfo::GetCPUGroupRange(WORD group_number, WORD* group_begin, WORD*
 }
 #endif // HOST_WINDOWS
 
+static int cCPUs = 0;
+
 //******************************************************************************
 // Returns the number of processors that a process has been configured to run on
 //******************************************************************************
@@ -1248,8 +1250,6 @@ int GetCurrentProcessCpuCount()
     }
     CONTRACTL_END;
 
-    static int cCPUs = 0;
-
     if (cCPUs != 0)
         return cCPUs;
 
@@ -1296,6 +1296,17 @@ int GetCurrentProcessCpuCount()
     return count;
 }
 
+//******************************************************************************
+// Discards the cached processor count, so the next GetCurrentProcessCpuCount
+// detects it again
+//******************************************************************************
+void ResetCurrentProcessCpuCount()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    VolatileStore(&cCPUs, 0);
+}
+
 #ifdef HOST_WINDOWS
 DWORD_PTR GetCurrentProcessCpuMask()
 {
@@ -12,16 +12,25 @@
 ; ***********************************************************************
 
 include AsmMacros.inc
+include asmconstants.inc
 
 extern memset:proc
 extern memmove:proc
 
+extern g_jitMemHelperFeatures:dword
+
 ; JIT_MemSet/JIT_MemCpy
 ;
 ; It is IMPORTANT that the exception handling code is able to find these guys
 ; on the stack, but on windows platforms we can just defer to the platform
 ; implementation.
 ;
+; Small blocks and, with JIT_MEMHELPER_AVX2, medium sized blocks are handled
+; inline, see crthelpers.S. Unlike there, rep movsb/stosb are not used for large
+; blocks: they need rdi and rsi, which are nonvolatile here and can't be saved
+; without a frame in a helper that must be able to take an AV. The CRT uses
+; them on its own where they pay off.
+;
 
 ; void JIT_MemSet(void* dest, int c, size_t count)
 ;
@@ -37,6 +46,7 @@ extern memmove:proc
 ; Exit:
 ;
 ; Uses:
+;    RAX, R9, XMM0, YMM0
 ;
 ; Exceptions:
 ;
@@ -46,6 +56,68 @@ LEAF_ENTRY JIT_MemSet, _TEXT
 
         cmp     byte ptr [rcx], 0       ; check dest for null
 
+        ; Replicate the value to all 8 bytes of rax
+        movzx   eax, dl
+        mov     r9, 0101010101010101h
+        imul    rax, r9
+
+        cmp     r8, 16
+        ja      Above16_MemSet
+
+        cmp     r8, 8
+        jb      Below8_MemSet
+        mov     [rcx], rax
+        mov     [rcx + r8 - 8], rax
+        ret
+
+Below8_MemSet:
+        cmp     r8, 4
+        jb      Below4_MemSet
+        mov     [rcx], eax
+        mov     [rcx + r8 - 4], eax
+        ret
+
+Below4_MemSet:
+        mov     [rcx], al
+        mov     [rcx + r8 - 1], al
+        cmp     r8, 2
+        jbe     Exit_MemSet
+        mov     [rcx + 1], al
+        ret
+
+Above16_MemSet:
+        movq    xmm0, rax
+        punpcklqdq xmm0, xmm0
+
+        cmp     r8, 32
+        ja      Above32_MemSet
+        movdqu  [rcx], xmm0
+        movdqu  [rcx + r8 - 16], xmm0
+        ret
+
+Above32_MemSet:
+        cmp     r8, JIT_MEMHELPER_ERMS_THRESHOLD
+        jae     Crt_MemSet
+        test    dword ptr [g_jitMemHelperFeatures], JIT_MEMHELPER_AVX2
+        jz      Crt_MemSet
+
+        vinsertf128 ymm0, ymm0, xmm0, 1
+
+        ; Store the last 32 bytes up front, the loop then stops as soon as less
+        ; than 32 bytes are left.
+        vmovdqu [rcx + r8 - 32], ymm0
+
+Avx2Loop_MemSet:
+        vmovdqu [rcx], ymm0
+        add     rcx, 32
+        sub     r8, 32
+        cmp     r8, 32
+        ja      Avx2Loop_MemSet
+
+        vzeroupper
+        ret
+
+Crt_MemSet:
         jmp     memset                  ; forward to the CRT implementation
 
 Exit_MemSet:
@@ -67,6 +139,7 @@ LEAF_END_MARKED JIT_MemSet, _TEXT
 ; Exit:
 ;
 ; Uses:
+;    RAX, R9, R10, R11, XMM0-XMM3, YMM0-YMM1
 ;
 ; Exceptions:
 ;
@@ -77,6 +150,94 @@ LEAF_ENTRY JIT_MemCpy, _TEXT
         cmp     byte ptr [rcx], 0       ; check dest for null
         cmp     byte ptr [rdx], 0       ; check src for null
 
+        ; Each size class below does all of its loads before its stores, so
+        ; overlapping blocks are copied correctly.
+        cmp     r8, 16
+        ja      Above16_MemCpy
+
+        cmp     r8, 8
+        jb      Below8_MemCpy
+        mov     rax, [rdx]
+        mov     r9, [rdx + r8 - 8]
+        mov     [rcx], rax
+        mov     [rcx + r8 - 8], r9
+        ret
+
+Below8_MemCpy:
+        cmp     r8, 4
+        jb      Below4_MemCpy
+        mov     eax, [rdx]
+        mov     r9d, [rdx + r8 - 4]
+        mov     [rcx], eax
+        mov     [rcx + r8 - 4], r9d
+        ret
+
+Below4_MemCpy:
+        ; The first, the last and the middle byte cover 1 to 3 bytes
+        mov     r10, r8
+        shr     r10, 1
+        movzx   eax, byte ptr [rdx]
+        movzx   r9d, byte ptr [rdx + r8 - 1]
+        movzx   r11d, byte ptr [rdx + r10]
+        mov     [rcx], al
+        mov     [rcx + r8 - 1], r9b
+        mov     [rcx + r10], r11b
+        ret
+
+Above16_MemCpy:
+        cmp     r8, 32
+        ja      Above32_MemCpy
+        movdqu  xmm0, [rdx]
+        movdqu  xmm1, [rdx + r8 - 16]
+        movdqu  [rcx], xmm0
+        movdqu  [rcx + r8 - 16], xmm1
+        ret
+
+Above32_MemCpy:
+        cmp     r8, 64
+        ja      Above64_MemCpy
+        movdqu  xmm0, [rdx]
+        movdqu  xmm1, [rdx + 16]
+        movdqu  xmm2, [rdx + r8 - 32]
+        movdqu  xmm3, [rdx + r8 - 16]
+        movdqu  [rcx], xmm0
+        movdqu  [rcx + 16], xmm1
+        movdqu  [rcx + r8 - 32], xmm2
+        movdqu  [rcx + r8 - 16], xmm3
+        ret
+
+Above64_MemCpy:
+        cmp     r8, JIT_MEMHELPER_ERMS_THRESHOLD
+        jae     Crt_MemCpy
+        test    dword ptr [g_jitMemHelperFeatures], JIT_MEMHELPER_AVX2
+        jz      Crt_MemCpy
+
+        ; The loop copies forward, which is wrong if dest starts inside of src.
+        mov     rax, rcx
+        sub     rax, rdx
+        cmp     rax, r8
+        jb      Crt_MemCpy
+
+        ; Load the last 32 bytes up front, the loop then stops as soon as less
+        ; than 32 bytes are left. That is correct for a dest below src as well,
+        ; the loop never stores over source bytes it has not loaded yet.
+        vmovdqu ymm1, ymmword ptr [rdx + r8 - 32]
+        lea     r9, [rcx + r8 - 32]
+
+Avx2Loop_MemCpy:
+        vmovdqu ymm0, ymmword ptr [rdx]
+        vmovdqu ymmword ptr [rcx], ymm0
+        add     rdx, 32
+        add     rcx, 32
+        sub     r8, 32
+        cmp     r8, 32
+        ja      Avx2Loop_MemCpy
+
+        vmovdqu ymmword ptr [r9], ymm1
+        vzeroupper
+        ret
+
+Crt_MemCpy:
         ; Use memmove to handle overlapping buffers for better
         ; compatibility with .NET Framework. Needing to handle
         ; overlapping buffers in cpblk is undefined by the spec.
@@ -204,6 +204,88 @@ LEAF_END_MARKED JIT_WriteBarrier_SVR64, _TEXT
 endif
 
 
+LEAF_ENTRY JIT_WriteBarrier_Region64, _TEXT
+        align 8
+        ;
+        ; Used when the GC uses regions, see the comments in
+        ; jithelpers_fastwritebarriers.S.
+        ;
+
+        ; Do the move into the GC .  It is correct to take an AV here, the EH code
+        ; figures out that this came from a WriteBarrier and correctly maps it back
+        ; to the managed method which called the WriteBarrier (see setup in
+        ; InitializeExceptionHandling, vm\exceptionhandling.cpp).
+        mov     [rcx], rdx
+
+        ; Keep the destination for the card table update, rcx is reused below
+        mov     r8, rcx
+
+PATCH_LABEL JIT_WriteBarrier_Region64_Patch_Label_RegionToGeneration
+        mov     rax, 0F0F0F0F0F0F0F0F0h
+
+        ; Nothing to do for stores into gen0. The shift count is patched at runtime.
+PATCH_LABEL JIT_WriteBarrier_Region64_Patch_Label_RegionShrDest
+        shr     rcx, 16h
+        mov     r10b, byte ptr [rcx + rax]
+        test    r10b, r10b
+        je      Exit
+
+        nop ; padding for alignment of constant
+
+        ; The region table only covers the heap, so check the source against
+        ; the heap bounds before looking up its generation.
+PATCH_LABEL JIT_WriteBarrier_Region64_Patch_Label_Lower
+        mov     rcx, 0F0F0F0F0F0F0F0F0h
+        cmp     rdx, rcx
+        jb      Exit
+
+        nop ; padding for alignment of constant
+
+PATCH_LABEL JIT_WriteBarrier_Region64_Patch_Label_Upper
+        mov     rcx, 0F0F0F0F0F0F0F0F0h
+        cmp     rdx, rcx
+        jae     Exit
+
+        ; Nothing to do unless the source is younger than the destination
+PATCH_LABEL JIT_WriteBarrier_Region64_Patch_Label_RegionShrSrc
+        shr     rdx, 16h
+        cmp     byte ptr [rdx + rax], r10b
+        jae     Exit
+
+        shr     r8, 0Bh
+
+        NOP_3_BYTE ; padding for alignment of constant
+
+PATCH_LABEL JIT_WriteBarrier_Region64_Patch_Label_CardTable
+        mov     rax, 0F0F0F0F0F0F0F0F0h
+
+        ; Touch the card table entry, if not already dirty.
+        cmp     byte ptr [r8 + rax], 0FFh
+        jne     UpdateCardTable
+        REPRET
+
+    UpdateCardTable:
+        mov     byte ptr [r8 + rax], 0FFh
+ifdef FEATURE_MANUALLY_MANAGED_CARD_BUNDLES
+        shr     r8, 0Ah
+        NOP_2_BYTE ; padding for alignment of constant
+        NOP_2_BYTE
+PATCH_LABEL JIT_WriteBarrier_Region64_Patch_Label_CardBundleTable
+        mov     rax, 0F0F0F0F0F0F0F0F0h
+        cmp     byte ptr [r8 + rax], 0FFh
+        jne     UpdateCardBundleTable
+        REPRET
+
+    UpdateCardBundleTable:
+        mov     byte ptr [r8 + rax], 0FFh
+endif
+        ret
+
+    Exit:
+        REPRET
+LEAF_END_MARKED JIT_WriteBarrier_Region64, _TEXT
+
+
 ifdef FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
 
 LEAF_ENTRY JIT_WriteBarrier_WriteWatch_PreGrow64, _TEXT
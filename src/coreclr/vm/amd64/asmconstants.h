@@ -47,6 +47,15 @@ ASMCONSTANTS_C_ASSERT(ASM_ELEMENT_TYPE_R4 == ELEMENT_TYPE_R4);
 ASMCONSTANTS_C_ASSERT(ASM_ELEMENT_TYPE_R8 == ELEMENT_TYPE_R8);
 
 
+#define JIT_MEMHELPER_ERMS                  0x1
+ASMCONSTANTS_C_ASSERT(JIT_MEMHELPER_ERMS == JitMemHelper_Erms);
+
+#define JIT_MEMHELPER_AVX2                  0x2
+ASMCONSTANTS_C_ASSERT(JIT_MEMHELPER_AVX2 == JitMemHelper_Avx2);
+
+// Blocks from this size on use rep movsb/stosb when JIT_MEMHELPER_ERMS is set
+#define JIT_MEMHELPER_ERMS_THRESHOLD        0x800
+
 #define METHODDESC_REGNUM                    10
 #define METHODDESC_REGISTER                 r10
 
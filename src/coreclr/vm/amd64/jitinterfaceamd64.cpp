@@ -20,6 +20,8 @@ extern uint8_t* g_ephemeral_low;
 extern uint8_t* g_ephemeral_high;
 extern uint32_t* g_card_table;
 extern uint32_t* g_card_bundle_table;
+extern uint8_t* g_region_to_generation_table;
+extern uint8_t g_region_shr;
 
 // Patch Labels for the various write barriers
 EXTERN_C void JIT_WriteBarrier_End();
@@ -50,6 +52,18 @@ EXTERN_C void JIT_WriteBarrier_SVR64_PatchLabel_CardBundleTable();
 EXTERN_C void JIT_WriteBarrier_SVR64_End();
 #endif // FEATURE_SVR_GC
 
+EXTERN_C void JIT_WriteBarrier_Region64(Object **dst, Object *ref);
+EXTERN_C void JIT_WriteBarrier_Region64_Patch_Label_RegionToGeneration();
+EXTERN_C void JIT_WriteBarrier_Region64_Patch_Label_RegionShrDest();
+EXTERN_C void JIT_WriteBarrier_Region64_Patch_Label_Lower();
+EXTERN_C void JIT_WriteBarrier_Region64_Patch_Label_Upper();
+EXTERN_C void JIT_WriteBarrier_Region64_Patch_Label_RegionShrSrc();
+EXTERN_C void JIT_WriteBarrier_Region64_Patch_Label_CardTable();
+#ifdef FEATURE_MANUALLY_MANAGED_CARD_BUNDLES
+EXTERN_C void JIT_WriteBarrier_Region64_Patch_Label_CardBundleTable();
+#endif
+EXTERN_C void JIT_WriteBarrier_Region64_End();
+
 #ifdef FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
 EXTERN_C void JIT_WriteBarrier_WriteWatch_PreGrow64(Object **dst, Object *ref);
 EXTERN_C void JIT_WriteBarrier_WriteWatch_PreGrow64_Patch_Label_WriteWatchTable();
@@ -152,6 +166,22 @@ void WriteBarrierManager::Validate()
 #endif // FEATURE_MANUALLY_MANAGED_CARD_BUNDLES
 #endif // FEATURE_SVR_GC
 
+    PBYTE pRegionToGenerationImmediate;
+
+    pRegionToGenerationImmediate = CALC_PATCH_LOCATION(JIT_WriteBarrier_Region64, Patch_Label_RegionToGeneration, 2);
+    pLowerBoundImmediate      = CALC_PATCH_LOCATION(JIT_WriteBarrier_Region64, Patch_Label_Lower, 2);
+    pUpperBoundImmediate      = CALC_PATCH_LOCATION(JIT_WriteBarrier_Region64, Patch_Label_Upper, 2);
+    pCardTableImmediate       = CALC_PATCH_LOCATION(JIT_WriteBarrier_Region64, Patch_Label_CardTable, 2);
+    _ASSERTE_ALL_BUILDS("clr/src/VM/AMD64/JITinterfaceAMD64.cpp", (reinterpret_cast<UINT64>(pRegionToGenerationImmediate) & 0x7) == 0);
+    _ASSERTE_ALL_BUILDS("clr/src/VM/AMD64/JITinterfaceAMD64.cpp", (reinterpret_cast<UINT64>(pLowerBoundImmediate) & 0x7) == 0);
+    _ASSERTE_ALL_BUILDS("clr/src/VM/AMD64/JITinterfaceAMD64.cpp", (reinterpret_cast<UINT64>(pUpperBoundImmediate) & 0x7) == 0);
+    _ASSERTE_ALL_BUILDS("clr/src/VM/AMD64/JITinterfaceAMD64.cpp", (reinterpret_cast<UINT64>(pCardTableImmediate) & 0x7) == 0);
+
+#ifdef FEATURE_MANUALLY_MANAGED_CARD_BUNDLES
+    pCardBundleTableImmediate = CALC_PATCH_LOCATION(JIT_WriteBarrier_Region64, Patch_Label_CardBundleTable, 2);
+    _ASSERTE_ALL_BUILDS("clr/src/VM/AMD64/JITinterfaceAMD64.cpp", (reinterpret_cast<UINT64>(pCardBundleTableImmediate) & 0x7) == 0);
+#endif
+
 #ifdef FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
     PBYTE pWriteWatchTableImmediate;
 
@@ -214,6 +244,8 @@ PCODE WriteBarrierManager::GetCurrentWriteBarrierCode()
         case WRITE_BARRIER_SVR64:
             return GetEEFuncEntryPoint(JIT_WriteBarrier_SVR64);
 #endif // FEATURE_SVR_GC
+        case WRITE_BARRIER_REGIONS64:
+            return GetEEFuncEntryPoint(JIT_WriteBarrier_Region64);
 #ifdef FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
         case WRITE_BARRIER_WRITE_WATCH_PREGROW64:
             return GetEEFuncEntryPoint(JIT_WriteBarrier_WriteWatch_PreGrow64);
@@ -246,6 +278,8 @@ size_t WriteBarrierManager::GetSpecificWriteBarrierSize(WriteBarrierType writeBa
         case WRITE_BARRIER_SVR64:
             return MARKED_FUNCTION_SIZE(JIT_WriteBarrier_SVR64);
 #endif // FEATURE_SVR_GC
+        case WRITE_BARRIER_REGIONS64:
+            return MARKED_FUNCTION_SIZE(JIT_WriteBarrier_Region64);
 #ifdef FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
         case WRITE_BARRIER_WRITE_WATCH_PREGROW64:
             return MARKED_FUNCTION_SIZE(JIT_WriteBarrier_WriteWatch_PreGrow64);
@@ -347,6 +381,36 @@ int WriteBarrierManager::ChangeWriteBarrierTo(WriteBarrierType newWriteBarrier,
         }
 #endif // FEATURE_SVR_GC
 
+        case WRITE_BARRIER_REGIONS64:
+        {
+            m_pRegionToGenerationImmediate = CALC_PATCH_LOCATION(JIT_WriteBarrier_Region64, Patch_Label_RegionToGeneration, 2);
+            m_pRegionShrDestImmediate   = CALC_PATCH_LOCATION(JIT_WriteBarrier_Region64, Patch_Label_RegionShrDest, 3);
+            m_pRegionShrSrcImmediate    = CALC_PATCH_LOCATION(JIT_WriteBarrier_Region64, Patch_Label_RegionShrSrc, 3);
+            m_pLowerBoundImmediate      = CALC_PATCH_LOCATION(JIT_WriteBarrier_Region64, Patch_Label_Lower, 2);
+            m_pUpperBoundImmediate      = CALC_PATCH_LOCATION(JIT_WriteBarrier_Region64, Patch_Label_Upper, 2);
+            m_pCardTableImmediate       = CALC_PATCH_LOCATION(JIT_WriteBarrier_Region64, Patch_Label_CardTable, 2);
+
+            // Make sure that we will be bashing the right places (immediates should be hardcoded to 0x0f0f0f0f0f0f0f0f0,
+            // the shift counts to 0x16).
+            _ASSERTE_ALL_BUILDS("clr/src/VM/AMD64/JITinterfaceAMD64.cpp", 0xf0f0f0f0f0f0f0f0 == *(UINT64*)m_pRegionToGenerationImmediate);
+            _ASSERTE_ALL_BUILDS("clr/src/VM/AMD64/JITinterfaceAMD64.cpp", 0x16 == *m_pRegionShrDestImmediate);
+            _ASSERTE_ALL_BUILDS("clr/src/VM/AMD64/JITinterfaceAMD64.cpp", 0x16 == *m_pRegionShrSrcImmediate);
+            _ASSERTE_ALL_BUILDS("clr/src/VM/AMD64/JITinterfaceAMD64.cpp", 0xf0f0f0f0f0f0f0f0 == *(UINT64*)m_pLowerBoundImmediate);
+            _ASSERTE_ALL_BUILDS("clr/src/VM/AMD64/JITinterfaceAMD64.cpp", 0xf0f0f0f0f0f0f0f0 == *(UINT64*)m_pUpperBoundImmediate);
+            _ASSERTE_ALL_BUILDS("clr/src/VM/AMD64/JITinterfaceAMD64.cpp", 0xf0f0f0f0f0f0f0f0 == *(UINT64*)m_pCardTableImmediate);
+
+#ifdef FEATURE_MANUALLY_MANAGED_CARD_BUNDLES
+            m_pCardBundleTableImmediate = CALC_PATCH_LOCATION(JIT_WriteBarrier_Region64, Patch_Label_CardBundleTable, 2);
+            _ASSERTE_ALL_BUILDS("clr/src/VM/AMD64/JITinterfaceAMD64.cpp", 0xf0f0f0f0f0f0f0f0 == *(UINT64*)m_pCardBundleTableImmediate);
+#endif
+
+            // The region table never moves, so unlike the other immediates these are only patched here.
+            *(UINT64*)m_pRegionToGenerationImmediate = (size_t)g_region_to_generation_table;
+            *m_pRegionShrDestImmediate = g_region_shr;
+            *m_pRegionShrSrcImmediate = g_region_shr;
+            break;
+        }
+
 #ifdef FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
         case WRITE_BARRIER_WRITE_WATCH_PREGROW64:
         {
@@ -437,6 +501,7 @@ void WriteBarrierManager::Initialize()
 #ifdef FEATURE_SVR_GC
     _ASSERTE_ALL_BUILDS("clr/src/VM/AMD64/JITinterfaceAMD64.cpp", cbWriteBarrierBuffer >= GetSpecificWriteBarrierSize(WRITE_BARRIER_SVR64));
 #endif // FEATURE_SVR_GC
+    _ASSERTE_ALL_BUILDS("clr/src/VM/AMD64/JITinterfaceAMD64.cpp", cbWriteBarrierBuffer >= GetSpecificWriteBarrierSize(WRITE_BARRIER_REGIONS64));
 #ifdef FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
     _ASSERTE_ALL_BUILDS("clr/src/VM/AMD64/JITinterfaceAMD64.cpp", cbWriteBarrierBuffer >= GetSpecificWriteBarrierSize(WRITE_BARRIER_WRITE_WATCH_PREGROW64));
     _ASSERTE_ALL_BUILDS("clr/src/VM/AMD64/JITinterfaceAMD64.cpp", cbWriteBarrierBuffer >= GetSpecificWriteBarrierSize(WRITE_BARRIER_WRITE_WATCH_POSTGROW64));
@@ -473,6 +538,14 @@ bool WriteBarrierManager::NeedDifferentWriteBarrier(bool bReqUpperBoundsCheck, W
             }
 #endif
 
+            if (g_region_to_generation_table != nullptr)
+            {
+                // The ephemeral range means nothing once generations are made of regions all over the heap,
+                // the region barrier looks up the generations instead. This applies to server GC as well.
+                writeBarrierType = WRITE_BARRIER_REGIONS64;
+                continue;
+            }
+
             writeBarrierType = GCHeapUtilities::IsServerHeap() ? WRITE_BARRIER_SVR64 : WRITE_BARRIER_PREGROW64;
             continue;
 
@@ -491,6 +564,9 @@ bool WriteBarrierManager::NeedDifferentWriteBarrier(bool bReqUpperBoundsCheck, W
             break;
 #endif // FEATURE_SVR_GC
 
+        case WRITE_BARRIER_REGIONS64:
+            break;
+
 #ifdef FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
         case WRITE_BARRIER_WRITE_WATCH_PREGROW64:
             if (bReqUpperBoundsCheck)
@@ -573,6 +649,24 @@ int WriteBarrierManager::UpdateEphemeralBounds(bool isRuntimeSuspended)
         }
 #endif // FEATURE_SVR_GC
 
+        case WRITE_BARRIER_REGIONS64:
+        {
+            // The region barrier checks against the whole heap rather than the ephemeral range, which the
+            // GC leaves wide open when it uses regions.
+            if (*(UINT64*)m_pLowerBoundImmediate != (size_t)g_lowest_address)
+            {
+                *(UINT64*)m_pLowerBoundImmediate = (size_t)g_lowest_address;
+                stompWBCompleteActions |= SWB_ICACHE_FLUSH;
+            }
+
+            if (*(UINT64*)m_pUpperBoundImmediate != (size_t)g_highest_address)
+            {
+                *(UINT64*)m_pUpperBoundImmediate = (size_t)g_highest_address;
+                stompWBCompleteActions |= SWB_ICACHE_FLUSH;
+            }
+            break;
+        }
+
         default:
             UNREACHABLE_MSG("unexpected m_currentWriteBarrier in UpdateEphemeralBounds");
     }
@@ -660,6 +754,13 @@ int WriteBarrierManager::SwitchToWriteWatchBarrier(bool isRuntimeSuspended)
             break;
 #endif // FEATURE_SVR_GC
 
+        case WRITE_BARRIER_REGIONS64:
+            // There is no write watch flavor of the region barrier. The ephemeral range is wide open with
+            // regions, so the post grow barrier marks cards for every store into the heap, which is correct
+            // if slower, until write watch is turned off again.
+            newWriteBarrierType = WRITE_BARRIER_WRITE_WATCH_POSTGROW64;
+            break;
+
         default:
             UNREACHABLE();
     }
@@ -681,7 +782,7 @@ int WriteBarrierManager::SwitchToNonWriteWatchBarrier(bool isRuntimeSuspended)
             break;
 
         case WRITE_BARRIER_WRITE_WATCH_POSTGROW64:
-            newWriteBarrierType = WRITE_BARRIER_POSTGROW64;
+            newWriteBarrierType = (g_region_to_generation_table != nullptr) ? WRITE_BARRIER_REGIONS64 : WRITE_BARRIER_POSTGROW64;
             break;
 
 #ifdef FEATURE_SVR_GC
@@ -24,6 +24,7 @@
 #include "assemblynative.hpp"
 #include "shimload.h"
 #include "stringliteralmap.h"
+#include "frozenobjectheap.h"
 #include "codeman.h"
 #include "comcallablewrapper.h"
 #include "eventtrace.h"
@@ -111,6 +112,7 @@ int                 BaseDomain::m_iNumberOfProcessors = 0;
 
 // System Domain Statics
 GlobalStringLiteralMap* SystemDomain::m_pGlobalStringLiteralMap = NULL;
+FrozenObjectHeapManager* SystemDomain::m_FrozenObjectHeapManager = NULL;
 
 DECLSPEC_ALIGN(16)
 static BYTE         g_pSystemDomainMemory[sizeof(SystemDomain)];
@@ -810,6 +812,90 @@ void AppDomain::RegisterLoaderAllocatorForDeletion(LoaderAllocator * pLoaderAllo
     m_pDelayedLoaderAllocatorUnloadList = pLoaderAllocator;
 }
 
+//---------------------------------------------------------------------------------------
+//
+// Queue collected loader allocators for code:LoaderAllocator::TearDownPendingLoaderAllocators.
+//
+void AppDomain::QueueLoaderAllocatorsForTeardown(LoaderAllocator * pFirstLoaderAllocator)
+{
+    CONTRACTL
+    {
+        GC_TRIGGERS;
+        NOTHROW;
+        MODE_ANY;
+        CAN_TAKE_LOCK;
+    }
+    CONTRACTL_END;
+
+    if (pFirstLoaderAllocator == NULL)
+        return;
+
+    DWORD cLoaderAllocators = 1;
+    LoaderAllocator * pLastLoaderAllocator = pFirstLoaderAllocator;
+    while (pLastLoaderAllocator->m_pLoaderAllocatorDestroyNext != NULL)
+    {
+        pLastLoaderAllocator = pLastLoaderAllocator->m_pLoaderAllocatorDestroyNext;
+        cLoaderAllocators++;
+    }
+
+    CrstHolder ch(GetLoaderAllocatorReferencesLock());
+
+    // Keep the queue in collection order, so the oldest unloads finish first
+    if (m_pPendingLoaderAllocatorTeardownTail != NULL)
+    {
+        m_pPendingLoaderAllocatorTeardownTail->m_pLoaderAllocatorDestroyNext = pFirstLoaderAllocator;
+    }
+    else
+    {
+        m_pPendingLoaderAllocatorTeardownHead = pFirstLoaderAllocator;
+    }
+    m_pPendingLoaderAllocatorTeardownTail = pLastLoaderAllocator;
+    m_cPendingLoaderAllocatorTeardown = m_cPendingLoaderAllocatorTeardown + cLoaderAllocators;
+}
+
+LoaderAllocator * AppDomain::DequeueLoaderAllocatorsForTeardown(DWORD cMaxLoaderAllocators, DWORD * pcRemaining)
+{
+    CONTRACTL
+    {
+        GC_TRIGGERS;
+        NOTHROW;
+        MODE_ANY;
+        CAN_TAKE_LOCK;
+    }
+    CONTRACTL_END;
+
+    _ASSERTE(cMaxLoaderAllocators > 0);
+
+    CrstHolder ch(GetLoaderAllocatorReferencesLock());
+
+    LoaderAllocator * pFirstLoaderAllocator = m_pPendingLoaderAllocatorTeardownHead;
+    LoaderAllocator * pLastLoaderAllocator = NULL;
+    DWORD cLoaderAllocators = 0;
+
+    LoaderAllocator * pLoaderAllocator = pFirstLoaderAllocator;
+    while (pLoaderAllocator != NULL && cLoaderAllocators < cMaxLoaderAllocators)
+    {
+        pLastLoaderAllocator = pLoaderAllocator;
+        pLoaderAllocator = pLoaderAllocator->m_pLoaderAllocatorDestroyNext;
+        cLoaderAllocators++;
+    }
+
+    if (pLastLoaderAllocator != NULL)
+    {
+        pLastLoaderAllocator->m_pLoaderAllocatorDestroyNext = NULL;
+    }
+
+    m_pPendingLoaderAllocatorTeardownHead = pLoaderAllocator;
+    if (pLoaderAllocator == NULL)
+    {
+        m_pPendingLoaderAllocatorTeardownTail = NULL;
+    }
+    m_cPendingLoaderAllocatorTeardown = m_cPendingLoaderAllocatorTeardown - cLoaderAllocators;
+
+    *pcRemaining = m_cPendingLoaderAllocatorTeardown;
+    return pFirstLoaderAllocator;
+}
+
 void AppDomain::SetNativeDllSearchDirectories(LPCWSTR wszNativeDllSearchDirectories)
 {
     STANDARD_VM_CONTRACT;
@@ -1317,6 +1403,25 @@ void SystemDomain::LazyInitGlobalStringLiteralMap()
     }
 }
 
+void SystemDomain::LazyInitFrozenObjectHeapManager()
+{
+    CONTRACTL
+    {
+        THROWS;
+        GC_NOTRIGGER;
+        MODE_ANY;
+        INJECT_FAULT(COMPlusThrowOM(););
+    }
+    CONTRACTL_END;
+
+    NewHolder<FrozenObjectHeapManager> pFoh(new FrozenObjectHeapManager());
+
+    if (InterlockedCompareExchangeT<FrozenObjectHeapManager *>(&m_FrozenObjectHeapManager, pFoh, NULL) == NULL)
+    {
+        pFoh.SuppressRelease();
+    }
+}
+
 /*static*/ void SystemDomain::EnumAllStaticGCRefs(promote_func* fn, ScanContext* sc)
 {
     CONTRACT_VOID
@@ -2179,6 +2284,9 @@ void AppDomain::Init()
     CONTRACTL_END;
 
     m_pDelayedLoaderAllocatorUnloadList = NULL;
+    m_pPendingLoaderAllocatorTeardownHead = NULL;
+    m_pPendingLoaderAllocatorTeardownTail = NULL;
+    m_cPendingLoaderAllocatorTeardown = 0;
 
     SetStage( STAGE_CREATING);
 
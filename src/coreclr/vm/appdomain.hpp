@@ -42,6 +42,7 @@ class SystemDomain;
 class AppDomain;
 class CompilationDomain;
 class GlobalStringLiteralMap;
+class FrozenObjectHeapManager;
 class StringLiteralMap;
 class MngStdInterfacesInfo;
 class DomainAssembly;
@@ -2189,11 +2190,29 @@ private:
     // List of unloaded LoaderAllocators, protected by code:GetLoaderAllocatorReferencesLock (for now)
     LoaderAllocator * m_pDelayedLoaderAllocatorUnloadList;
 
+    // Collected LoaderAllocators waiting for code:LoaderAllocator::TearDownPendingLoaderAllocators,
+    // protected by code:GetLoaderAllocatorReferencesLock
+    LoaderAllocator * m_pPendingLoaderAllocatorTeardownHead;
+    LoaderAllocator * m_pPendingLoaderAllocatorTeardownTail;
+    Volatile<DWORD> m_cPendingLoaderAllocatorTeardown;
+
 public:
 
     // Register the loader allocator for deletion in code:ShutdownFreeLoaderAllocators.
     void RegisterLoaderAllocatorForDeletion(LoaderAllocator * pLoaderAllocator);
 
+    // Queue a list of collected LoaderAllocators (linked through m_pLoaderAllocatorDestroyNext) for teardown.
+    void QueueLoaderAllocatorsForTeardown(LoaderAllocator * pFirstLoaderAllocator);
+
+    // Remove up to cMaxLoaderAllocators from the teardown queue and return them as a list.
+    LoaderAllocator * DequeueLoaderAllocatorsForTeardown(DWORD cMaxLoaderAllocators, DWORD * pcRemaining);
+
+    BOOL HasPendingLoaderAllocatorTeardown()
+    {
+        LIMITED_METHOD_CONTRACT;
+        return m_cPendingLoaderAllocatorTeardown != 0;
+    }
+
 public:
     void SetGCRefPoint(int gccounter)
     {
@@ -2525,6 +2544,7 @@ public:
     void Init();
     void Stop();
     static void LazyInitGlobalStringLiteralMap();
+    static void LazyInitFrozenObjectHeapManager();
 
     //****************************************************************************************
     //
@@ -2597,6 +2617,17 @@ public:
         _ASSERTE(m_pGlobalStringLiteralMap);
         return m_pGlobalStringLiteralMap;
     }
+    static FrozenObjectHeapManager *GetFrozenObjectHeapManager()
+    {
+        WRAPPER_NO_CONTRACT;
+
+        if (m_FrozenObjectHeapManager == NULL)
+        {
+            SystemDomain::LazyInitFrozenObjectHeapManager();
+        }
+        _ASSERTE(m_FrozenObjectHeapManager);
+        return m_FrozenObjectHeapManager;
+    }
 #endif // DACCESS_COMPILE
 
 #if defined(FEATURE_COMINTEROP_APARTMENT_SUPPORT) && !defined(CROSSGEN_COMPILE)
@@ -2777,6 +2808,7 @@ private:
     static CrstStatic       m_SystemDomainCrst;
 
     static GlobalStringLiteralMap *m_pGlobalStringLiteralMap;
+    static FrozenObjectHeapManager *m_FrozenObjectHeapManager;
 
     static ULONG       s_dNumAppDomains;  // Maintain a count of children app domains.
 
@@ -10,6 +10,16 @@
 
 #ifndef DACCESS_COMPILE
 extern "C" void STDCALL OnCallCountThresholdReachedStub();
+
+// Returns true if calls to code at the specified tier are counted for promotion to a higher tier
+static bool IsCallCountedOptimizationTier(NativeCodeVersion::OptimizationTier optimizationTier)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    return
+        optimizationTier == NativeCodeVersion::OptimizationTier0 ||
+        optimizationTier == NativeCodeVersion::OptimizationTier0Instrumented;
+}
 #endif
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -28,7 +38,8 @@ CallCountingManager::CallCountingInfo::CallCountingInfo(NativeCodeVersion codeVe
     : m_codeVersion(codeVersion),
     m_callCountingStub(nullptr),
     m_remainingCallCount(0),
-    m_stage(Stage::Disabled)
+    m_stage(Stage::Disabled),
+    m_callCountingTickCountOrDurationMs(TieredCompilationManager::UnknownCallCountingDurationMs)
 {
     WRAPPER_NO_CONTRACT;
     _ASSERTE(!codeVersion.IsNull());
@@ -52,7 +63,8 @@ CallCountingManager::CallCountingInfo::CallCountingInfo(NativeCodeVersion codeVe
     : m_codeVersion(codeVersion),
     m_callCountingStub(nullptr),
     m_remainingCallCount(callCountThreshold),
-    m_stage(Stage::StubIsNotActive)
+    m_stage(Stage::StubIsNotActive),
+    m_callCountingTickCountOrDurationMs(GetTickCount())
 {
     WRAPPER_NO_CONTRACT;
     _ASSERTE(!codeVersion.IsNull());
@@ -66,6 +78,65 @@ CallCountingManager::CallCountingInfo::~CallCountingInfo()
     _ASSERTE(m_callCountingStub == nullptr);
 }
 
+// Call counting infos are small and numerous, and are created and deleted in bursts. They are allocated in chunks and recycled
+// through a free list to avoid the overhead of a separate heap allocation for each one. All allocations and deletions occur while
+// the code versioning lock is held, which also synchronizes the free list. Chunks are not freed, so the memory held tracks the
+// peak number of call counting infos, which is typically reached early and reused thereafter.
+void *CallCountingManager::CallCountingInfo::s_freeList = nullptr;
+
+void *CallCountingManager::CallCountingInfo::operator new(size_t size)
+{
+    CONTRACTL
+    {
+        THROWS;
+        GC_NOTRIGGER;
+        MODE_ANY;
+    }
+    CONTRACTL_END;
+
+    _ASSERTE(size == sizeof(CallCountingInfo));
+    _ASSERTE(CodeVersionManager::IsLockOwnedByCurrentThread());
+    static_assert_no_msg(sizeof(CallCountingInfo) >= sizeof(void *));
+    static_assert_no_msg(sizeof(CallCountingInfo) % sizeof(void *) == 0);
+
+    if (s_freeList == nullptr)
+    {
+        const COUNT_T ChunkCount = 64;
+        UINT8 *chunk = new UINT8[sizeof(CallCountingInfo) * ChunkCount];
+        for (COUNT_T i = 0; i < ChunkCount; ++i)
+        {
+            void *block = chunk + sizeof(CallCountingInfo) * i;
+            *(void **)block = s_freeList;
+            s_freeList = block;
+        }
+    }
+
+    void *block = s_freeList;
+    s_freeList = *(void **)block;
+    return block;
+}
+
+void CallCountingManager::CallCountingInfo::operator delete(void *p)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+    }
+    CONTRACTL_END;
+
+    _ASSERTE(CodeVersionManager::IsLockOwnedByCurrentThread());
+
+    if (p == nullptr)
+    {
+        return;
+    }
+
+    *(void **)p = s_freeList;
+    s_freeList = p;
+}
+
 #endif // !DACCESS_COMPILE
 
 CallCountingManager::PTR_CallCountingInfo CallCountingManager::CallCountingInfo::From(PTR_CallCount remainingCallCountCell)
@@ -156,6 +227,18 @@ FORCEINLINE void CallCountingManager::CallCountingInfo::SetStage(Stage stage)
             {
                 ++s_activeCallCountingStubCount;
             }
+
+            if (stage == Stage::PendingCompletion)
+            {
+                // The call count threshold was reached. The time it took to get here is an inverse estimate of the method's
+                // call frequency and is used to prioritize promotion.
+                UINT32 durationMs = (UINT32)GetTickCount() - m_callCountingTickCountOrDurationMs;
+                if (durationMs == TieredCompilationManager::UnknownCallCountingDurationMs)
+                {
+                    --durationMs;
+                }
+                m_callCountingTickCountOrDurationMs = durationMs;
+            }
             break;
 
         case Stage::Complete:
@@ -177,6 +260,14 @@ FORCEINLINE void CallCountingManager::CallCountingInfo::SetStage(Stage stage)
 
     m_stage = stage;
 }
+
+UINT32 CallCountingManager::CallCountingInfo::GetCallCountingDurationMs() const
+{
+    WRAPPER_NO_CONTRACT;
+    _ASSERTE(m_stage >= Stage::PendingCompletion);
+
+    return m_callCountingTickCountOrDurationMs;
+}
 #endif
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -540,7 +631,7 @@ bool CallCountingManager::SetCodeEntryPoint(
             // For a default code version that is not tier 0, call counting will have been disabled by this time (checked
             // below). Avoid the redundant and not-insignificant expense of GetOptimizationTier() on a default code version.
             !activeCodeVersion.IsDefaultVersion() &&
-            activeCodeVersion.GetOptimizationTier() != NativeCodeVersion::OptimizationTier0
+            !IsCallCountedOptimizationTier(activeCodeVersion.GetOptimizationTier())
         ) ||
         !g_pConfig->TieredCompilation_CallCounting())
     {
@@ -568,7 +659,7 @@ bool CallCountingManager::SetCodeEntryPoint(
                 return true;
             }
 
-            _ASSERTE(activeCodeVersion.GetOptimizationTier() == NativeCodeVersion::OptimizationTier0);
+            _ASSERTE(IsCallCountedOptimizationTier(activeCodeVersion.GetOptimizationTier()));
 
             // If the tiering delay is active, postpone further work
             if (GetAppDomain()
@@ -600,7 +691,10 @@ bool CallCountingManager::SetCodeEntryPoint(
                 {
                     GetAppDomain()
                         ->GetTieredCompilationManager()
-                        ->AsyncPromoteToTier1(activeCodeVersion, createTieringBackgroundWorkerRef);
+                        ->AsyncPromoteToTier1(
+                            activeCodeVersion,
+                            callCountingInfo->GetCallCountingDurationMs(),
+                            createTieringBackgroundWorkerRef);
                 }
                 methodDesc->SetCodeEntryPoint(codeEntryPoint);
                 callCountingInfo->SetStage(CallCountingInfo::Stage::Complete);
@@ -615,7 +709,7 @@ bool CallCountingManager::SetCodeEntryPoint(
         }
         else
         {
-            _ASSERTE(activeCodeVersion.GetOptimizationTier() == NativeCodeVersion::OptimizationTier0);
+            _ASSERTE(IsCallCountedOptimizationTier(activeCodeVersion.GetOptimizationTier()));
 
             // If the tiering delay is active, postpone further work
             if (GetAppDomain()
@@ -749,7 +843,7 @@ PCODE CallCountingManager::OnCallCountThresholdReached(TransitionBlock *transiti
     // used going forward under appropriate locking to synchronize further with deletion.
     GCX_PREEMP_THREAD_EXISTS(CURRENT_THREAD);
 
-    _ASSERTE(codeVersion.GetOptimizationTier() == NativeCodeVersion::OptimizationTier0);
+    _ASSERTE(IsCallCountedOptimizationTier(codeVersion.GetOptimizationTier()));
 
     codeEntryPoint = codeVersion.GetNativeCode();
     do
@@ -789,6 +883,14 @@ PCODE CallCountingManager::OnCallCountThresholdReached(TransitionBlock *transiti
     return codeEntryPoint;
 }
 
+COUNT_T CallCountingManager::GetActiveCallCountingStubCount()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    // The count is updated under the code versioning lock, a stale value is fine for reporting
+    return VolatileLoadWithoutBarrier(&s_activeCallCountingStubCount);
+}
+
 COUNT_T CallCountingManager::GetCountOfCodeVersionsPendingCompletion()
 {
     CONTRACTL
@@ -837,6 +939,11 @@ void CallCountingManager::CompleteCallCounting()
     GCX_COOP();
     CodeVersionManager::LockHolder codeVersioningLockHolder;
 
+#if defined(HOST_OSX) && defined(HOST_ARM64)
+    // Enable writing to executable memory once for the whole batch of completions rather than per method
+    auto jitWriteEnableHolder = PAL_JITWriteEnable(true);
+#endif // defined(HOST_OSX) && defined(HOST_ARM64)
+
     for (auto itEnd = s_callCountingManagers->End(), it = s_callCountingManagers->Begin(); it != itEnd; ++it)
     {
         CallCountingManager *callCountingManager = *it;
@@ -866,7 +973,10 @@ void CallCountingManager::CompleteCallCounting()
                 if (!codeVersion.GetILCodeVersion().HasAnyOptimizedNativeCodeVersion(codeVersion))
                 {
                     bool createTieringBackgroundWorker = false;
-                    tieredCompilationManager->AsyncPromoteToTier1(codeVersion, &createTieringBackgroundWorker);
+                    tieredCompilationManager->AsyncPromoteToTier1(
+                        codeVersion,
+                        callCountingInfo->GetCallCountingDurationMs(),
+                        &createTieringBackgroundWorker);
                     _ASSERTE(!createTieringBackgroundWorker); // the current thread is the background worker thread
                 }
 
@@ -1006,6 +1116,11 @@ void CallCountingManager::StopAllCallCounting(TieredCompilationManager *tieredCo
     _ASSERTE(CodeVersionManager::IsLockOwnedByCurrentThread());
     _ASSERTE(tieredCompilationManager != nullptr);
 
+#if defined(HOST_OSX) && defined(HOST_ARM64)
+    // Every tracked method's entry point is reset below, so enable writing to executable memory once up front
+    auto jitWriteEnableHolder = PAL_JITWriteEnable(true);
+#endif // defined(HOST_OSX) && defined(HOST_ARM64)
+
     for (auto itEnd = s_callCountingManagers->End(), it = s_callCountingManagers->Begin(); it != itEnd; ++it)
     {
         CallCountingManager *callCountingManager = *it;
@@ -1036,7 +1151,10 @@ void CallCountingManager::StopAllCallCounting(TieredCompilationManager *tieredCo
                 if (!codeVersion.GetILCodeVersion().HasAnyOptimizedNativeCodeVersion(codeVersion))
                 {
                     bool createTieringBackgroundWorker = false;
-                    tieredCompilationManager->AsyncPromoteToTier1(codeVersion, &createTieringBackgroundWorker);
+                    tieredCompilationManager->AsyncPromoteToTier1(
+                        codeVersion,
+                        callCountingInfo->GetCallCountingDurationMs(),
+                        &createTieringBackgroundWorker);
                     _ASSERTE(!createTieringBackgroundWorker); // the current thread is the background worker thread
                 }
 
@@ -107,6 +107,10 @@ private:
         CallCount m_remainingCallCount;
         Stage m_stage;
 
+        // Until the call count threshold is reached, the tick count at which call counting started. Thereafter, the time in
+        // milliseconds that it took to reach the threshold.
+        UINT32 m_callCountingTickCountOrDurationMs;
+
     #ifndef DACCESS_COMPILE
     private:
         CallCountingInfo(NativeCodeVersion codeVersion);
@@ -114,6 +118,12 @@ private:
         static CallCountingInfo *CreateWithCallCountingDisabled(NativeCodeVersion codeVersion);
         CallCountingInfo(NativeCodeVersion codeVersion, CallCount callCountThreshold);
         ~CallCountingInfo();
+
+    public:
+        static void *operator new(size_t size);
+        static void operator delete(void *p);
+    private:
+        static void *s_freeList;
     #endif
 
     public:
@@ -133,6 +143,7 @@ private:
     #ifndef DACCESS_COMPILE
     public:
         void SetStage(Stage stage);
+        UINT32 GetCallCountingDurationMs() const;
     #endif
 
         ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -273,6 +284,7 @@ public:
         bool *createTieringBackgroundWorker);
     static PCODE OnCallCountThresholdReached(TransitionBlock *transitionBlock, TADDR stubIdentifyingToken);
     static COUNT_T GetCountOfCodeVersionsPendingCompletion();
+    static COUNT_T GetActiveCallCountingStubCount();
     static void CompleteCallCounting();
 
 public:
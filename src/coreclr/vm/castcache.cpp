@@ -13,6 +13,12 @@ BASEARRAYREF* CastCache::s_pTableRef = NULL;
 OBJECTHANDLE CastCache::s_sentinelTable = NULL;
 DWORD CastCache::s_lastFlushSize     = INITIAL_CACHE_SIZE;
 
+thread_local CastCache::ThreadCache CastCache::t_threadCache;
+// starts at 1 so that zero-initialized thread caches are considered flushed
+Volatile<DWORD> CastCache::s_flushEpoch = 1;
+INT64 CastCache::s_threadCacheHitCount  = 0;
+INT64 CastCache::s_threadCacheMissCount = 0;
+
 BASEARRAYREF CastCache::CreateCastCache(DWORD size)
 {
     CONTRACTL
@@ -112,6 +118,21 @@ void CastCache::FlushCurrentCache()
     s_lastFlushSize = max(INITIAL_CACHE_SIZE, CacheElementCount(tableData));
 
     SetObjectReference((OBJECTREF *)s_pTableRef, ObjectFromHandle(s_sentinelTable));
+
+    // invalidate the per-thread caches as well
+    FastInterlockIncrement((LONG*)&s_flushEpoch);
+}
+
+INT64 CastCache::GetThreadCacheHitCount()
+{
+    LIMITED_METHOD_CONTRACT;
+    return InterlockedCompareExchange64((LONGLONG *)&s_threadCacheHitCount, 0, 0); // prevent tearing
+}
+
+INT64 CastCache::GetThreadCacheMissCount()
+{
+    LIMITED_METHOD_CONTRACT;
+    return InterlockedCompareExchange64((LONGLONG *)&s_threadCacheMissCount, 0, 0); // prevent tearing
 }
 
 void CastCache::Initialize()
@@ -152,6 +173,20 @@ TypeHandle::CastResult CastCache::TryGet(TADDR source, TADDR target)
     }
     CONTRACTL_END;
 
+    ThreadCache* pThreadCache = GetThreadCache();
+    ThreadCacheEntry* pThreadEntry = &pThreadCache->entries[ThreadCacheIndex(source, target)];
+    if (pThreadEntry->source == source)
+    {
+        TADDR entryTargetAndResult = pThreadEntry->targetAndResult ^ target;
+        if (entryTargetAndResult <= 1)
+        {
+            CountThreadCacheHit(pThreadCache);
+            return TypeHandle::CastResult(entryTargetAndResult);
+        }
+    }
+
+    CountThreadCacheMiss(pThreadCache);
+
     DWORD* tableData = TableData(*s_pTableRef);
 
     DWORD index = KeyToBucket(tableData, source, target);
@@ -186,6 +221,9 @@ TypeHandle::CastResult CastCache::TryGet(TADDR source, TADDR target)
                     break;
                 }
 
+                // remember the result in the thread cache for subsequent lookups
+                pThreadEntry->source = source;
+                pThreadEntry->targetAndResult = target | entryTargetAndResult;
                 return TypeHandle::CastResult(entryTargetAndResult);
             }
         }
@@ -214,6 +252,12 @@ void CastCache::TrySet(TADDR source, TADDR target, BOOL result)
     }
     CONTRACTL_END;
 
+    {
+        ThreadCacheEntry* pThreadEntry = &GetThreadCache()->entries[ThreadCacheIndex(source, target)];
+        pThreadEntry->source = source;
+        pThreadEntry->targetAndResult = target | (result & 1);
+    }
+
     DWORD bucket;
     DWORD* tableData;
 
@@ -45,6 +45,11 @@
 // Whenever we need to replace or resize the table, we simply allocate a new one and atomically
 // update the static handle. The old table may be still in use, but will eventually be collected by GC.
 //
+// In front of the shared table every thread has a small direct-mapped cache. Lookups that hit there
+// need no versioned reads and do not touch cache lines that other threads write to. The thread caches
+// are filled from the shared table and on TrySet, and are invalidated together with the shared table
+// by bumping a flush epoch in FlushCurrentCache.
+//
 class CastCache
 {
 #if !defined(DACCESS_COMPILE) && !defined(CROSSGEN_COMPILE)
@@ -168,6 +173,11 @@ public:
     static void FlushCurrentCache();
     static void Initialize();
 
+    // Number of lookups that were satisfied by, or missed, the per-thread caches.
+    // Counts are published from each thread in batches, so they lag slightly behind.
+    static INT64 GetThreadCacheHitCount();
+    static INT64 GetThreadCacheMissCount();
+
 private:
 
 // The cache size is driven by demand and generally is fairly small. (casts are repetitive)
@@ -198,6 +208,36 @@ private:
 // We pick 8 as the probe limit (hoping for 4 probes on average), but the number can be refined further.
     static const DWORD BUCKET_SIZE = 8;
 
+    // The per-thread cache is direct-mapped and only needs to capture the few casts a thread is
+    // currently busy with. 32 entries fit in 1KB on 64bit.
+    static const DWORD THREAD_CACHE_SIZE_LOG2 = 5;
+    static const DWORD THREAD_CACHE_SIZE = 1 << THREAD_CACHE_SIZE_LOG2;
+
+    // Per-thread hit/miss counts are added to the global counters once they reach this value
+    static const DWORD THREAD_CACHE_COUNT_BATCH = 1024;
+
+    struct ThreadCacheEntry
+    {
+        TADDR               source;
+        // same encoding as CastCacheEntry::targetAndResult
+        TADDR               targetAndResult;
+    };
+
+    struct ThreadCache
+    {
+        DWORD               flushEpoch;
+        DWORD               hitCount;
+        DWORD               missCount;
+        ThreadCacheEntry    entries[THREAD_CACHE_SIZE];
+    };
+
+    static thread_local ThreadCache t_threadCache;
+
+    // incremented whenever the shared table is flushed, invalidating all thread caches
+    static Volatile<DWORD> s_flushEpoch;
+    static INT64          s_threadCacheHitCount;
+    static INT64          s_threadCacheMissCount;
+
     // current cache table
     static BASEARRAYREF*  s_pTableRef;
 
@@ -275,6 +315,55 @@ private:
 #endif
     }
 
+    FORCEINLINE static DWORD ThreadCacheIndex(TADDR source, TADDR target)
+    {
+        // same mixing as in KeyToBucket, reduced to the thread cache size
+#if HOST_64BIT
+        UINT64 hash = (((UINT64)source << 32) | ((UINT64)source >> 32)) ^ (UINT64)target;
+        return (DWORD)((hash * 11400714819323198485llu) >> (64 - THREAD_CACHE_SIZE_LOG2));
+#else
+        UINT32 hash = (((UINT32)source << 16) | ((UINT32)source >> 16)) ^ (UINT32)target;
+        return (DWORD)((hash * 2654435769ul) >> (32 - THREAD_CACHE_SIZE_LOG2));
+#endif
+    }
+
+    FORCEINLINE static ThreadCache* GetThreadCache()
+    {
+        LIMITED_METHOD_CONTRACT;
+
+        ThreadCache* pThreadCache = &t_threadCache;
+        DWORD flushEpoch = s_flushEpoch.LoadWithoutBarrier();
+        if (pThreadCache->flushEpoch != flushEpoch)
+        {
+            memset(pThreadCache->entries, 0, sizeof(pThreadCache->entries));
+            pThreadCache->flushEpoch = flushEpoch;
+        }
+
+        return pThreadCache;
+    }
+
+    FORCEINLINE static void CountThreadCacheHit(ThreadCache* pThreadCache)
+    {
+        LIMITED_METHOD_CONTRACT;
+
+        if (++pThreadCache->hitCount == THREAD_CACHE_COUNT_BATCH)
+        {
+            InterlockedExchangeAdd64((LONGLONG *)&s_threadCacheHitCount, THREAD_CACHE_COUNT_BATCH);
+            pThreadCache->hitCount = 0;
+        }
+    }
+
+    FORCEINLINE static void CountThreadCacheMiss(ThreadCache* pThreadCache)
+    {
+        LIMITED_METHOD_CONTRACT;
+
+        if (++pThreadCache->missCount == THREAD_CACHE_COUNT_BATCH)
+        {
+            InterlockedExchangeAdd64((LONGLONG *)&s_threadCacheMissCount, THREAD_CACHE_COUNT_BATCH);
+            pThreadCache->missCount = 0;
+        }
+    }
+
     FORCEINLINE static DWORD* TableData(BASEARRAYREF table)
     {
         LIMITED_METHOD_CONTRACT;
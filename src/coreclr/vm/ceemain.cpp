@@ -583,6 +583,58 @@ do { \
 #define IfFailGoLog(EXPR) IfFailGotoLog(EXPR, ErrExit)
 #endif
 
+//
+// Startup phase timeline. EEStartupHelper marks the end of each of its phases, and the durations are reported as
+// EEStartupPhase events once startup has completed. Event tracing is only initialized partway through startup, so the
+// events cannot be fired as the phases end.
+//
+struct StartupPhaseMark
+{
+    LPCWSTR m_name;
+    LARGE_INTEGER m_timestamp;
+};
+
+static const DWORD MaxStartupPhaseMarks = 16;
+static StartupPhaseMark s_startupPhaseMarks[MaxStartupPhaseMarks];
+static DWORD s_startupPhaseMarkCount = 0;
+static LARGE_INTEGER s_startupPhaseStart;
+
+static void MarkStartupPhase(LPCWSTR name)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    if (s_startupPhaseMarkCount < MaxStartupPhaseMarks)
+    {
+        StartupPhaseMark *mark = &s_startupPhaseMarks[s_startupPhaseMarkCount++];
+        mark->m_name = name;
+        QueryPerformanceCounter(&mark->m_timestamp);
+    }
+}
+
+static void FireStartupPhaseEvents()
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+    } CONTRACTL_END;
+
+    LARGE_INTEGER frequency;
+    QueryPerformanceFrequency(&frequency);
+
+    LONGLONG previous = s_startupPhaseStart.QuadPart;
+    for (DWORD i = 0; i < s_startupPhaseMarkCount; i++)
+    {
+        const StartupPhaseMark &mark = s_startupPhaseMarks[i];
+        ULONGLONG durationUs = (ULONGLONG)(mark.m_timestamp.QuadPart - previous) * 1000000 / frequency.QuadPart;
+        previous = mark.m_timestamp.QuadPart;
+
+        LOG((LF_STARTUP, LL_INFO10, "EEStartup phase %S: %I64u us\n", mark.m_name, durationUs));
+        FireEtwEEStartupPhase(mark.m_name, durationUs, GetClrInstanceId());
+    }
+}
+
 
 #ifndef CROSSGEN_COMPILE
 #ifdef TARGET_UNIX
@@ -635,6 +687,8 @@ void EEStartupHelper()
     {
         g_fEEInit = true;
 
+        QueryPerformanceCounter(&s_startupPhaseStart);
+
 #ifndef CROSSGEN_COMPILE
 
         // We cache the SystemInfo for anyone to use throughout the life of the EE.
@@ -658,6 +712,8 @@ void EEStartupHelper()
 
         IfFailGo(EEConfig::Setup());
 
+        MarkStartupPhase(W("Config"));
+
 #ifndef CROSSGEN_COMPILE
 
 #ifdef HOST_WINDOWS
@@ -687,6 +743,8 @@ void EEStartupHelper()
         InitThreadManager();
         STRESS_LOG0(LF_STARTUP, LL_ALWAYS, "Returned successfully from InitThreadManager");
 
+        MarkStartupPhase(W("ThreadManager"));
+
 #ifdef FEATURE_PERFTRACING
         // Initialize the event pipe.
         EventPipeAdapter::Initialize();
@@ -731,6 +789,8 @@ void EEStartupHelper()
 
         Frame::Init();
 
+        MarkStartupPhase(W("Diagnostics"));
+
 #endif // CROSSGEN_COMPILE
 
 
@@ -849,6 +909,8 @@ void EEStartupHelper()
 
 #ifndef CROSSGEN_COMPILE
 
+        MarkStartupPhase(W("Stubs"));
+
         InitializeGarbageCollector();
 
         if (!GCHandleUtilities::GetGCHandleManager()->Initialize())
@@ -856,6 +918,8 @@ void EEStartupHelper()
             IfFailGo(E_OUTOFMEMORY);
         }
 
+        MarkStartupPhase(W("GarbageCollector"));
+
         g_pEEShutDownEvent = new CLREvent();
         g_pEEShutDownEvent->CreateManualEvent(FALSE);
 
@@ -881,6 +945,8 @@ void EEStartupHelper()
 
 #ifndef CROSSGEN_COMPILE
 
+        MarkStartupPhase(W("ExecutionManager"));
+
 #ifndef TARGET_UNIX
         if (!RegisterOutOfProcessWatsonCallbacks())
         {
@@ -906,6 +972,8 @@ void EEStartupHelper()
         IfFailGo(hr);
 #endif // PROFILING_SUPPORTED
 
+        MarkStartupPhase(W("DebuggerAndProfiler"));
+
         InitializeExceptionHandling();
 
         //
@@ -947,12 +1015,16 @@ void EEStartupHelper()
 
         StackwalkCache::Init();
 
+        MarkStartupPhase(W("ThreadAndJitHelpers"));
+
         // This isn't done as part of InitializeGarbageCollector() above because it
         // requires write barriers to have been set up on x86, which happens as part
         // of InitJITHelpers1.
         hr = g_pGCHeap->Initialize();
         IfFailGo(hr);
 
+        MarkStartupPhase(W("GCHeap"));
+
 #ifdef FEATURE_PERFTRACING
         // Finish setting up rest of EventPipe - specifically enable SampleProfiler if it was requested at startup.
         // SampleProfiler needs to cooperate with the GC which hasn't fully finished setting up in the first part of the
@@ -967,6 +1039,8 @@ void EEStartupHelper()
         // Now we really have fully initialized the garbage collector
         SetGarbageCollectorFullyInitialized();
 
+        MarkStartupPhase(W("FinalizerThread"));
+
 #ifdef DEBUGGING_SUPPORTED
         // Make a call to publish the DefaultDomain for the debugger
         // This should be done before assemblies/modules are loaded into it (i.e. SystemDomain::Init)
@@ -1000,12 +1074,18 @@ void EEStartupHelper()
         SystemDomain::NotifyProfilerStartup();
 #endif // PROFILING_SUPPORTED
 
+        MarkStartupPhase(W("SystemDomain"));
+
         g_fEEInit = false;
 
         SystemDomain::System()->DefaultDomain()->LoadSystemAssemblies();
 
+        MarkStartupPhase(W("SystemAssemblies"));
+
         SystemDomain::System()->DefaultDomain()->SetupSharedStatics();
 
+        MarkStartupPhase(W("SharedStatics"));
+
 #ifdef FEATURE_STACK_SAMPLING
         StackSampler::Init();
 #endif
@@ -1032,11 +1112,15 @@ void EEStartupHelper()
 
 #endif // CROSSGEN_COMPILE
 
+        MarkStartupPhase(W("Finish"));
+
         g_fEEStarted = TRUE;
         g_EEStartupStatus = S_OK;
         hr = S_OK;
         STRESS_LOG0(LF_STARTUP, LL_ALWAYS, "===================EEStartup Completed===================");
 
+        FireStartupPhaseEvents();
+
 #ifndef CROSSGEN_COMPILE
 
 #ifdef _DEBUG
@@ -0,0 +1,65 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+//
+// File: checkpointrestore.cpp
+//
+
+#include "common.h"
+#include "checkpointrestore.h"
+#include "gcenv.os.h"
+
+#ifdef FEATURE_PERFTRACING
+#include "diagnosticserveradapter.h"
+#endif // FEATURE_PERFTRACING
+
+bool CheckpointRestore::IsEnabled()
+{
+    WRAPPER_NO_CONTRACT;
+
+    static ConfigDWORD checkpointRestore;
+    return checkpointRestore.val(CLRConfig::EXTERNAL_CheckpointRestore) != 0;
+}
+
+// Returns FALSE if checkpointing is not enabled, the process must not be checkpointed then
+BOOL QCALLTYPE CheckpointRestore::PrepareForCheckpoint()
+{
+    QCALL_CONTRACT;
+
+    BOOL result = FALSE;
+
+    BEGIN_QCALL;
+
+    if (IsEnabled())
+    {
+        STRESS_LOG0(LF_ALWAYS, LL_INFO10, "CheckpointRestore: preparing for checkpoint\n");
+
+#ifdef FEATURE_PERFTRACING
+        // The diagnostic ports are bound to this machine
+        DiagnosticServerAdapter::Shutdown();
+#endif // FEATURE_PERFTRACING
+
+        result = TRUE;
+    }
+
+    END_QCALL;
+
+    return result;
+}
+
+void QCALLTYPE CheckpointRestore::NotifyRestored()
+{
+    QCALL_CONTRACT;
+
+    BEGIN_QCALL;
+
+    if (IsEnabled())
+    {
+        STRESS_LOG0(LF_ALWAYS, LL_INFO10, "CheckpointRestore: restored\n");
+
+        // The cgroup limits and the processor count may differ on the machine the process was restored on.
+        // The GC heaps keep the layout they were created with, only later decisions use the new limits.
+        GCToOSInterface::RefreshResourceLimits();
+    }
+
+    END_QCALL;
+}
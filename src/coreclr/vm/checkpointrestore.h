@@ -0,0 +1,32 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+//
+// File: checkpointrestore.h
+//
+// Native part of checkpointing a running process and restoring it later, possibly on a different machine
+// (e.g. with CRIU). Before the checkpoint the runtime releases state that cannot survive it, after the
+// restore it detects again what it had cached about the machine.
+//
+// The managed side calls PrepareForCheckpoint after it has quiesced the thread pool and its timers, and
+// NotifyRestored before it lets them run again. Both require the CheckpointRestore config switch.
+//
+// The diagnostics server is not reopened on restore. Its thread may still be blocked in the listen poll
+// when the ports are torn down, so it cannot be started a second time in the same process.
+//
+
+#ifndef _CHECKPOINTRESTORE_H_
+#define _CHECKPOINTRESTORE_H_
+
+#include "qcall.h"
+
+class CheckpointRestore
+{
+public:
+    static BOOL QCALLTYPE PrepareForCheckpoint();
+    static void QCALLTYPE NotifyRestored();
+
+private:
+    static bool IsEnabled();
+};
+
+#endif // _CHECKPOINTRESTORE_H_
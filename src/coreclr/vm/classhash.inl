@@ -51,16 +51,7 @@ inline DWORD EEClassHashTable::Hash(LPCUTF8 pszNamespace, LPCUTF8 pszClassName)
     CONTRACTL_END;
 
 
-    DWORD dwHash = 5381;
-    DWORD dwChar;
-
-    while ((dwChar = *pszNamespace++) != 0)
-        dwHash = ((dwHash << 5) + dwHash) ^ dwChar;
-
-    while ((dwChar = *pszClassName++) != 0)
-        dwHash = ((dwHash << 5) + dwHash) ^ dwChar;
-
-    return  dwHash;
+    return HashUtf8String(pszClassName, HashUtf8String(pszNamespace));
 }
 
 #endif // CLASSHASH_INL
@@ -3613,6 +3613,19 @@ TypeHandle ClassLoader::LoadTypeHandleForTypeKey(TypeKey *pTypeKey,
 
     PushFinalLevels(typeHnd, targetLevel, pInstContext);
 
+#ifdef FEATURE_MULTICOREJIT
+    // Record types loaded by this call in the multi-core JIT profile so that they may be preloaded on a background thread
+    // during startup on the next run
+    if (currentLevel < CLASS_LOADED && typeHnd.GetLoadLevel() == CLASS_LOADED)
+    {
+        MulticoreJitManager & mcJitManager = GetAppDomain()->GetMulticoreJitManager();
+        if (mcJitManager.IsRecordingTypeLoads())
+        {
+            mcJitManager.RecordTypeLoad(typeHnd);
+        }
+    }
+#endif
+
 #if defined(FEATURE_EVENT_TRACE)
     if (ETW_EVENT_ENABLED(MICROSOFT_WINDOWS_DOTNETRUNTIME_PROVIDER_DOTNET_Context, TypeLoadStop))
     {
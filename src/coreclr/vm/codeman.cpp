@@ -57,6 +57,9 @@ SPTR_IMPL(ReadyToRunJitManager, ExecutionManager, m_pReadyToRunJitManager);
 Volatile<RangeSection *> ExecutionManager::m_CodeRangeList = NULL;
 Volatile<LONG> ExecutionManager::m_dwReaderCount = 0;
 Volatile<LONG> ExecutionManager::m_dwWriterLock = 0;
+Volatile<LONG> ExecutionManager::m_codeInfoCacheGeneration = 0;
+Volatile<ExecutionManager::RangeSectionSnapshot *> ExecutionManager::m_pRangeSectionSnapshot = NULL;
+ExecutionManager::RangeSectionSnapshot * ExecutionManager::m_pRetiredRangeSectionSnapshots = NULL;
 #else
 SPTR_IMPL(RangeSection, ExecutionManager, m_CodeRangeList);
 SVAL_IMPL(LONG, ExecutionManager, m_dwReaderCount);
@@ -1267,6 +1270,10 @@ bool DoesOSSupportAVX()
 extern "C" DWORD64 __stdcall GetDataCacheZeroIDReg();
 #endif
 
+#ifdef TARGET_AMD64
+extern "C" DWORD g_jitMemHelperFeatures = 0;
+#endif
+
 void EEJitManager::SetCpuInfo()
 {
     LIMITED_METHOD_CONTRACT;
@@ -1354,6 +1361,11 @@ void EEJitManager::SetCpuInfo()
     //   CORJIT_FLAG_USE_LZCNT if the following feature bits are set (input EAX of 80000001H)
     //      LZCNT - ECX bit 5
     // synchronously updating VM and JIT.
+    //
+    // On AMD64 this also selects the code paths of JIT_MemSet and JIT_MemCpy (g_jitMemHelperFeatures):
+    //   JitMemHelper_Erms if the following feature bit is set (input EAX of 0x07 and input ECX of 0):
+    //      ERMS - EBX bit 9
+    //   JitMemHelper_Avx2 if CORJIT_FLAG_USE_AVX2 is set
 
     int cpuidInfo[4];
 
@@ -1365,6 +1377,10 @@ void EEJitManager::SetCpuInfo()
     __cpuid(cpuidInfo, 0x00000000);
     uint32_t maxCpuId = static_cast<uint32_t>(cpuidInfo[EAX]);
 
+#ifdef TARGET_AMD64
+    DWORD memHelperFeatures = 0;
+#endif
+
     if (maxCpuId >= 1)
     {
         __cpuid(cpuidInfo, 0x00000001);
@@ -1458,6 +1474,13 @@ void EEJitManager::SetCpuInfo()
             {
                 CPUCompileFlags.Set(InstructionSet_BMI2);
             }
+
+#ifdef TARGET_AMD64
+            if ((cpuidInfo[EBX] & (1 << 9)) != 0)                                                           // ERMS
+            {
+                memHelperFeatures |= JitMemHelper_Erms;
+            }
+#endif // TARGET_AMD64
         }
     }
 
@@ -1474,6 +1497,16 @@ void EEJitManager::SetCpuInfo()
         }
     }
 
+#ifdef TARGET_AMD64
+    // JIT_MemSet and JIT_MemCpy use the same AVX2 code paths as jitted code, so they honor the same switches.
+    if (CPUCompileFlags.IsSet(InstructionSet_AVX2))
+    {
+        memHelperFeatures |= JitMemHelper_Avx2;
+    }
+
+    g_jitMemHelperFeatures = memHelperFeatures;
+#endif // TARGET_AMD64
+
     if (!CPUCompileFlags.IsSet(InstructionSet_SSE))
     {
         EEPOLICY_HANDLE_FATAL_ERROR_WITH_MESSAGE(COR_E_EXECUTIONENGINE, W("SSE is not supported on the processor."));
@@ -1517,6 +1550,13 @@ void EEJitManager::SetCpuInfo()
     {
         CPUCompileFlags.Set(InstructionSet_Crc32);
     }
+#ifdef PF_ARM_SVE_INSTRUCTIONS_AVAILABLE
+    // PF_ARM_SVE_INSTRUCTIONS_AVAILABLE (46)
+    if (IsProcessorFeaturePresent(PF_ARM_SVE_INSTRUCTIONS_AVAILABLE))
+    {
+        CPUCompileFlags.Set(InstructionSet_Sve);
+    }
+#endif // PF_ARM_SVE_INSTRUCTIONS_AVAILABLE
 #endif // HOST_64BIT
 #ifndef CROSSGEN_COMPILE
     if (GetDataCacheZeroIDReg() == 4)
@@ -2264,6 +2304,20 @@ HeapList* LoaderCodeHeap::CreateCodeHeap(CodeHeapRequestInfo *pInfo, LoaderHeap
             pBaseAddr = ClrVirtualAllocExecutable(reserveSize, MEM_RESERVE, PAGE_NOACCESS);
             if (!pBaseAddr)
                 ThrowOutOfMemory();
+
+#ifdef TARGET_UNIX
+            if (pInfo->PreferLargePages())
+            {
+                // Only the large page aligned part of the reservation can be backed by large pages.
+                // This is just a hint, the heap works the same way if it is not honored.
+                TADDR largePagesStart = ALIGN_UP((TADDR)pBaseAddr, CODE_HEAP_LARGE_PAGE_SIZE);
+                TADDR largePagesEnd = ALIGN_DOWN((TADDR)pBaseAddr + reserveSize, CODE_HEAP_LARGE_PAGE_SIZE);
+                if (largePagesStart < largePagesEnd)
+                {
+                    PAL_VirtualPreferLargePages((LPVOID)largePagesStart, largePagesEnd - largePagesStart);
+                }
+            }
+#endif // TARGET_UNIX
         }
         pCodeHeap->m_LoaderHeap.SetReservedRegion(pBaseAddr, reserveSize, TRUE);
     }
@@ -2338,6 +2392,8 @@ void CodeHeapRequestInfo::Init()
         m_pAllocator = m_pMD->GetLoaderAllocator();
     m_isDynamicDomain = (m_pMD != NULL) && m_pMD->IsLCGMethod();
     m_isCollectible = m_pAllocator->IsCollectible();
+    m_isTier0Code = false;
+    m_preferLargePages = false;
     m_throwOnOutOfMemoryWithinRange = true;
 }
 
@@ -2411,6 +2467,12 @@ HeapList* EEJitManager::NewCodeHeap(CodeHeapRequestInfo *pInfo, DomainCodeHeapLi
         {
             minReserveSize *= 8; // CodeHeaps are larger on AMD64 (256 KB to 2048 KB)
         }
+
+        // Reserve enough so that the heap contains at least one full, aligned large page
+        if (pInfo->PreferLargePages())
+        {
+            minReserveSize = max(minReserveSize, 2 * CODE_HEAP_LARGE_PAGE_SIZE);
+        }
     }
 #endif
 
@@ -2454,6 +2516,8 @@ HeapList* EEJitManager::NewCodeHeap(CodeHeapRequestInfo *pInfo, DomainCodeHeapLi
     _ASSERTE (pHp != NULL);
     _ASSERTE (pHp->maxCodeHeapSize >= initialRequestSize);
 
+    pHp->isTier0CodeHeap = pInfo->IsTier0Code();
+
     pHp->SetNext(GetCodeHeapList());
 
     EX_TRY
@@ -2525,6 +2589,11 @@ void* EEJitManager::allocCodeRaw(CodeHeapRequestInfo *pInfo,
         pCodeHeap = (HeapList *)pInfo->m_pAllocator->m_pLastUsedDynamicCodeHeap;
         pInfo->m_pAllocator->m_pLastUsedDynamicCodeHeap = NULL;
     }
+    else if (pInfo->IsTier0Code())
+    {
+        pCodeHeap = (HeapList *)pInfo->m_pAllocator->m_pLastUsedTier0CodeHeap;
+        pInfo->m_pAllocator->m_pLastUsedTier0CodeHeap = NULL;
+    }
     else
     {
         pCodeHeap = (HeapList *)pInfo->m_pAllocator->m_pLastUsedCodeHeap;
@@ -2585,6 +2654,10 @@ void* EEJitManager::allocCodeRaw(CodeHeapRequestInfo *pInfo,
     {
         pInfo->m_pAllocator->m_pLastUsedDynamicCodeHeap = pCodeHeap;
     }
+    else if (pInfo->IsTier0Code())
+    {
+        pInfo->m_pAllocator->m_pLastUsedTier0CodeHeap = pCodeHeap;
+    }
     else
     {
         pInfo->m_pAllocator->m_pLastUsedCodeHeap = pCodeHeap;
@@ -2604,7 +2677,7 @@ void* EEJitManager::allocCodeRaw(CodeHeapRequestInfo *pInfo,
     RETURN(mem);
 }
 
-CodeHeader* EEJitManager::allocCode(MethodDesc* pMD, size_t blockSize, size_t reserveForJumpStubs, CorJitAllocMemFlag flag
+CodeHeader* EEJitManager::allocCode(MethodDesc* pMD, size_t blockSize, size_t reserveForJumpStubs, CorJitAllocMemFlag flag, bool isTier0Code
 #ifdef FEATURE_EH_FUNCLETS
                                     , UINT nUnwindInfos
                                     , TADDR * pModuleBase
@@ -2658,6 +2731,31 @@ CodeHeader* EEJitManager::allocCode(MethodDesc* pMD, size_t blockSize, size_t re
 #endif
     requestInfo.setReserveForJumpStubs(reserveForJumpStubs);
 
+#ifdef FEATURE_TIERED_COMPILATION
+    // Tier0 code is short-lived: hot methods get rejitted and the tier0 body is no longer executed.
+    // Keep it in its own code heaps so that the optimized code that stays around is packed densely.
+    // Collectible allocators are excluded to avoid reserving an extra code heap for each of them.
+    if (isTier0Code &&
+        !requestInfo.IsDynamicDomain() &&
+        !requestInfo.IsCollectible() &&
+        g_pConfig->TieredCompilation_SeparateTier0CodeHeap())
+    {
+        requestInfo.SetTier0Code();
+    }
+#endif
+
+#if defined(TARGET_UNIX) && defined(HOST_64BIT)
+    // Optimized code is long lived and hot, reserve its code heaps so that they can be backed by
+    // large pages to reduce i-TLB misses.
+    if (!requestInfo.IsTier0Code() &&
+        !requestInfo.IsDynamicDomain() &&
+        !requestInfo.IsCollectible() &&
+        g_pConfig->JitLargePageCodeHeaps())
+    {
+        requestInfo.SetPreferLargePages();
+    }
+#endif
+
 #if defined(USE_INDIRECT_CODEHEADER)
     SIZE_T realHeaderSize = offsetof(RealCodeHeader, unwindInfos[0]) + (sizeof(T_RUNTIME_FUNCTION) * nUnwindInfos);
 
@@ -2777,6 +2875,13 @@ bool EEJitManager::CanUseCodeHeap(CodeHeapRequestInfo *pInfo, HeapList *pCodeHea
 
     if ((pInfo->m_loAddr == 0) && (pInfo->m_hiAddr == 0))
     {
+        // Method bodies only go to heaps of their own kind, jump stubs (which are
+        // always range constrained) may be placed in any heap near their target.
+        if (pCodeHeap->isTier0CodeHeap != pInfo->IsTier0Code())
+        {
+            return false;
+        }
+
         // We have no constraint so this non empty heap will be able to satisfy our request
         if (pInfo->IsDynamicDomain())
         {
@@ -3400,6 +3505,9 @@ void EEJitManager::FreeCodeMemory(HostCodeHeap *pCodeHeap, void * codeStart)
     // clean up the NibbleMap
     NibbleMapSet(pCodeHeap->m_pHeapList, (TADDR)codeStart, FALSE);
 
+    // The memory may be reused for other code
+    ExecutionManager::InvalidateCodeInfoCaches();
+
     // The caller of this method doesn't call HostCodeHeap->FreeMemForCode
     // directly because the operation should be protected by m_CodeHeapCritSec.
     pCodeHeap->FreeMemForCode(codeStart);
@@ -3417,6 +3525,8 @@ void ExecutionManager::CleanupCodeHeaps()
     _ASSERTE (g_fProcessDetach || (GCHeapUtilities::IsGCInProgress()  && ::IsGCThread()));
 
     GetEEJitManager()->CleanupCodeHeaps();
+
+    FreeRetiredRangeSectionSnapshots();
 }
 
 void EEJitManager::CleanupCodeHeaps()
@@ -3457,7 +3567,14 @@ void EEJitManager::CleanupCodeHeaps()
         HostCodeHeap *pNextHeap = pHeap->m_pNextHeapToRelease;
 
         DWORD allocCount = pHeap->m_AllocationCount;
-        if (allocCount == 0)
+        if (allocCount == 0 && IsLastDynamicCodeHeap(pHeap))
+        {
+            // Keep the last heap of the allocator, so that a workload that keeps creating and collecting
+            // dynamic methods reuses its committed pages instead of releasing and reserving a heap each GC.
+            // It is deleted with the other heaps of the allocator in code:EEJitManager::Unload.
+            LOG((LF_BCL, LL_INFO100, "Level2 - Keeping empty CodeHeap [0x%p, vt(0x%x)] for reuse\n", pHeap, *(size_t*)pHeap));
+        }
+        else if (allocCount == 0)
         {
             LOG((LF_BCL, LL_INFO100, "Level2 - Destryoing CodeHeap [0x%p, vt(0x%x)] - ref count 0\n", pHeap, *(size_t*)pHeap));
             RemoveCodeHeapFromDomainList(pHeap, pHeap->m_pAllocator);
@@ -3471,6 +3588,18 @@ void EEJitManager::CleanupCodeHeaps()
     }
 }
 
+bool EEJitManager::IsLastDynamicCodeHeap(HostCodeHeap *pCodeHeap)
+{
+    CONTRACTL {
+        NOTHROW;
+        GC_NOTRIGGER;
+        PRECONDITION(m_CodeHeapCritSec.OwnedByCurrentThread());
+    } CONTRACTL_END;
+
+    DomainCodeHeapList *pList = GetCodeHeapList(NULL, pCodeHeap->m_pAllocator, TRUE);
+    return (pList != NULL) && (pList->m_CodeHeapList.Count() == 1);
+}
+
 void EEJitManager::RemoveFromCleanupList(HostCodeHeap *pCodeHeap)
 {
     CONTRACTL {
@@ -4438,6 +4567,162 @@ LPCWSTR ExecutionManager::GetJitName()
 }
 #endif // !FEATURE_MERGE_JIT_AND_ENGINE
 
+#ifndef DACCESS_COMPILE
+//*****************************************************************************
+// Copies m_CodeRangeList into a new snapshot, leaving out the range that contains
+// excludeAddr (if any). Returns NULL if the snapshot would be empty or cannot be
+// allocated, in which case lookups fall back to walking the list.
+//*****************************************************************************
+ExecutionManager::RangeSectionSnapshot * ExecutionManager::BuildRangeSectionSnapshot(TADDR excludeAddr)
+{
+    CONTRACTL {
+        NOTHROW;
+        GC_NOTRIGGER;
+        PRECONDITION(m_RangeCrst.OwnedByCurrentThread());
+    } CONTRACTL_END;
+
+    DWORD count = 0;
+    for (RangeSection * pCurr = m_CodeRangeList; pCurr != NULL; pCurr = pCurr->pnext)
+    {
+        if (excludeAddr < pCurr->LowAddress || excludeAddr >= pCurr->HighAddress)
+            count++;
+    }
+
+    if (count == 0)
+        return NULL;
+
+    SIZE_T cbSnapshot = sizeof(RangeSectionSnapshot) + (count - 1) * sizeof(RangeSection *);
+    RangeSectionSnapshot * pSnapshot = (RangeSectionSnapshot *) new (nothrow) BYTE[cbSnapshot];
+    if (pSnapshot == NULL)
+        return NULL;
+
+    pSnapshot->pNextRetired = NULL;
+    pSnapshot->count = count;
+
+    // The list is sorted top down, the snapshot bottom up
+    DWORD index = count;
+    for (RangeSection * pCurr = m_CodeRangeList; pCurr != NULL; pCurr = pCurr->pnext)
+    {
+        if (excludeAddr < pCurr->LowAddress || excludeAddr >= pCurr->HighAddress)
+            pSnapshot->sections[--index] = pCurr;
+    }
+    _ASSERTE(index == 0);
+
+    return pSnapshot;
+}
+
+//*****************************************************************************
+// Makes pSnapshot visible to readers. The snapshot it replaces may still be in use
+// by lock-free readers, so it is retired rather than freed.
+//*****************************************************************************
+void ExecutionManager::PublishRangeSectionSnapshot(RangeSectionSnapshot * pSnapshot)
+{
+    CONTRACTL {
+        NOTHROW;
+        GC_NOTRIGGER;
+        PRECONDITION(m_RangeCrst.OwnedByCurrentThread());
+    } CONTRACTL_END;
+
+    RangeSectionSnapshot * pOldSnapshot = m_pRangeSectionSnapshot;
+
+    m_pRangeSectionSnapshot = pSnapshot;
+
+    if (pOldSnapshot != NULL)
+    {
+        pOldSnapshot->pNextRetired = NULL;
+        RetireRangeSectionSnapshots(pOldSnapshot);
+    }
+}
+
+void ExecutionManager::RetireRangeSectionSnapshots(RangeSectionSnapshot * pSnapshots)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    RangeSectionSnapshot * pTail = pSnapshots;
+    while (pTail->pNextRetired != NULL)
+        pTail = pTail->pNextRetired;
+
+    // Writers are serialized by m_RangeCrst, but the GC thread detaches the
+    // retired list without taking it
+    RangeSectionSnapshot * pHead;
+    do
+    {
+        pHead = VolatileLoad(&m_pRetiredRangeSectionSnapshots);
+        pTail->pNextRetired = pHead;
+    }
+    while (InterlockedCompareExchangeT(&m_pRetiredRangeSectionSnapshots, pSnapshots, pHead) != pHead);
+}
+
+//*****************************************************************************
+// Called while the EE is suspended for a GC. Threads that look up ranges without
+// the reader lock are either stopped in cooperative mode or are doing this GC, so
+// the only readers that may still hold a retired snapshot are reader lock holders
+// that started before the snapshots were detached here.
+//*****************************************************************************
+void ExecutionManager::FreeRetiredRangeSectionSnapshots()
+{
+    CONTRACTL {
+        NOTHROW;
+        GC_NOTRIGGER;
+    } CONTRACTL_END;
+
+    if (VolatileLoad(&m_pRetiredRangeSectionSnapshots) == NULL)
+        return;
+
+    RangeSectionSnapshot * pRetired = InterlockedExchangeT(&m_pRetiredRangeSectionSnapshots, (RangeSectionSnapshot *) NULL);
+    if (pRetired == NULL)
+        return;
+
+    // Readers are short, so a brief spin suffices; if they do not drain, try again at the next GC
+    bool fReadersDrained = false;
+    for (DWORD dwSpin = 0; dwSpin < 1000; dwSpin++)
+    {
+        if (m_dwReaderCount == 0)
+        {
+            fReadersDrained = true;
+            break;
+        }
+        YieldProcessorNormalized();
+    }
+
+    if (!fReadersDrained)
+    {
+        RetireRangeSectionSnapshots(pRetired);
+        return;
+    }
+
+    while (pRetired != NULL)
+    {
+        RangeSectionSnapshot * pNext = pRetired->pNextRetired;
+        delete [] (BYTE *) pRetired;
+        pRetired = pNext;
+    }
+}
+
+RangeSection * ExecutionManager::FindInRangeSectionSnapshot(RangeSectionSnapshot * pSnapshot, TADDR addr)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    // Find the last range whose LowAddress is not above addr
+    DWORD low = 0;
+    DWORD high = pSnapshot->count;
+    while (low < high)
+    {
+        DWORD mid = low + (high - low) / 2;
+        if (pSnapshot->sections[mid]->LowAddress <= addr)
+            low = mid + 1;
+        else
+            high = mid;
+    }
+
+    if (low == 0)
+        return NULL;
+
+    RangeSection * pRS = pSnapshot->sections[low - 1];
+    return (addr < pRS->HighAddress) ? pRS : NULL;
+}
+#endif // !DACCESS_COMPILE
+
 RangeSection* ExecutionManager::GetRangeSection(TADDR addr)
 {
     CONTRACTL {
@@ -4447,6 +4732,15 @@ RangeSection* ExecutionManager::GetRangeSection(TADDR addr)
         SUPPORTS_DAC;
     } CONTRACTL_END;
 
+#ifndef DACCESS_COMPILE
+    RangeSectionSnapshot * pSnapshot = m_pRangeSectionSnapshot;
+
+    if (pSnapshot != NULL)
+    {
+        return FindInRangeSectionSnapshot(pSnapshot, addr);
+    }
+#endif
+
     RangeSection * pHead = m_CodeRangeList;
 
     if (pHead == NULL)
@@ -4766,6 +5060,8 @@ void ExecutionManager::AddRangeHelper(TADDR          pStartRange,
         {
             m_CodeRangeList = pnewrange;
         }
+
+        PublishRangeSectionSnapshot(BuildRangeSectionSnapshot(NULL));
     }
 }
 
@@ -4778,6 +5074,7 @@ void ExecutionManager::DeleteRange(TADDR pStartRange)
     } CONTRACTL_END;
 
     RangeSection *pCurr = NULL;
+    RangeSectionSnapshot *pNewSnapshot = NULL;
     {
         // Acquire the Crst before unlinking a RangeList.
         // NOTE: The Crst must be acquired BEFORE we grab the writer lock, as the
@@ -4785,12 +5082,19 @@ void ExecutionManager::DeleteRange(TADDR pStartRange)
         // to enter a Crst after the forbid suspend thread region is entered
         CrstHolder ch(&m_RangeCrst);
 
+        // The snapshot has to be allocated before the writer lock is taken since
+        // allocations are not allowed while it is held
+        pNewSnapshot = BuildRangeSectionSnapshot(pStartRange);
+
         // Acquire the WriterLock and prevent any readers from walking the RangeList.
         // This also forces us to enter a forbid suspend thread region, to prevent
         // hijacking profilers from grabbing this thread and walking it (the walk may
         // require the reader lock, which would cause a deadlock).
         WriterLockHolder wlh;
 
+        // Cached lookups may refer to the code in the range being deleted
+        InvalidateCodeInfoCaches();
+
         RangeSection *pPrev = NULL;
 
         pCurr = GetRangeSectionAndPrev(m_CodeRangeList, pStartRange, &pPrev);
@@ -4818,6 +5122,9 @@ void ExecutionManager::DeleteRange(TADDR pStartRange)
                 head->pLastUsed = NULL;
             }
 
+            PublishRangeSectionSnapshot(pNewSnapshot);
+            pNewSnapshot = NULL;
+
             //
             // Cannot delete pCurr here because we own the WriterLock and if this is
             // a hosted scenario then the hosting api callback cannot occur in a forbid
@@ -4826,6 +5133,12 @@ void ExecutionManager::DeleteRange(TADDR pStartRange)
         }
     }
 
+    // The range was not found, so the snapshot was not published
+    if (pNewSnapshot != NULL)
+    {
+        delete [] (BYTE *) pNewSnapshot;
+    }
+
     //
     // Now delete the node
     //
@@ -4933,6 +5246,11 @@ void ExecutionManager::Unload(LoaderAllocator *pLoaderAllocator)
     */
     StackwalkCache::Invalidate(pLoaderAllocator);
 
+#ifdef GCINFO_SLOT_TABLE_CACHE
+    // The GC info of the unloaded code goes away with it
+    GcSlotTableCache::Flush();
+#endif
+
     JumpStubCache * pJumpStubCache = (JumpStubCache *) pLoaderAllocator->m_pJumpStubCache;
     if (pJumpStubCache != NULL)
     {
@@ -369,11 +369,19 @@ struct CodeHeapRequestInfo
     size_t       m_reserveForJumpStubs; // Amount to reserve for jump stubs (won't be allocated)
     bool         m_isDynamicDomain;
     bool         m_isCollectible;
+    bool         m_isTier0Code;     // code is expected to be replaced by a higher tier and is kept apart from optimized code
+    bool         m_preferLargePages; // new code heaps should be reserved so that they can be backed by large pages
     bool         m_throwOnOutOfMemoryWithinRange;
 
     bool   IsDynamicDomain()                    { return m_isDynamicDomain;    }
     void   SetDynamicDomain()                   { m_isDynamicDomain = true;    }
 
+    bool   IsTier0Code()                        { return m_isTier0Code;        }
+    void   SetTier0Code()                       { m_isTier0Code = true;        }
+
+    bool   PreferLargePages()                   { return m_preferLargePages;   }
+    void   SetPreferLargePages()                { m_preferLargePages = true;   }
+
     bool   IsCollectible()                      { return m_isCollectible;      }
 
     size_t getRequestSize()                     { return m_requestSize;        }
@@ -461,6 +469,9 @@ protected:
 // The number of code heaps at which we increase the size of new code heaps.
 #define CODE_HEAP_SIZE_INCREASE_THRESHOLD 5
 
+// The large page size that code heaps reserved with CodeHeapRequestInfo::PreferLargePages are laid out for.
+#define CODE_HEAP_LARGE_PAGE_SIZE 0x200000
+
 typedef DPTR(struct _HeapList) PTR_HeapList;
 
 typedef struct _HeapList
@@ -477,6 +488,7 @@ typedef struct _HeapList
 
     size_t              maxCodeHeapSize;// Size of the entire contiguous block of memory
     size_t              reserveForJumpStubs; // Amount of memory reserved for jump stubs in this block
+    bool                isTier0CodeHeap;     // Heap only holds tier0 code, see CodeHeapRequestInfo::m_isTier0Code
 
 #if defined(TARGET_AMD64)
     BYTE        CLRPersonalityRoutine[JUMP_ALLOCATE_SIZE];                 // jump thunk to personality routine
@@ -966,7 +978,7 @@ public:
 
     BOOL                LoadJIT();
 
-    CodeHeader*         allocCode(MethodDesc* pFD, size_t blockSize, size_t reserveForJumpStubs, CorJitAllocMemFlag flag
+    CodeHeader*         allocCode(MethodDesc* pFD, size_t blockSize, size_t reserveForJumpStubs, CorJitAllocMemFlag flag, bool isTier0Code
 #ifdef FEATURE_EH_FUNCLETS
                                   , UINT nUnwindInfos
                                   , TADDR * pModuleBase
@@ -1026,6 +1038,7 @@ public:
     void        FreeCodeMemory(HostCodeHeap *pCodeHeap, void * codeStart);
     void        RemoveFromCleanupList(HostCodeHeap *pCodeHeap);
     void        AddToCleanupList(HostCodeHeap *pCodeHeap);
+    bool        IsLastDynamicCodeHeap(HostCodeHeap *pCodeHeap);
     void        DeleteCodeHeap(HeapList *pHeapList);
     void        RemoveCodeHeapFromDomainList(CodeHeap *pHeap, LoaderAllocator *pAllocator);
 #endif // !DACCESS_COMPILE && !CROSSGEN_COMPILE
@@ -1212,6 +1225,22 @@ public:
     // Returns methodDesc for given PC
     static MethodDesc * GetCodeMethodDesc(PCODE currentPC);
 
+#ifndef DACCESS_COMPILE
+    // Generation of code memory, incremented whenever code is freed. Caches of code lookups
+    // (see code:EECodeInfoCache) are only valid for the generation they were filled in.
+    static LONG GetCodeInfoCacheGeneration()
+    {
+        LIMITED_METHOD_CONTRACT;
+        return m_codeInfoCacheGeneration;
+    }
+
+    static void InvalidateCodeInfoCaches()
+    {
+        LIMITED_METHOD_CONTRACT;
+        FastInterlockIncrement(&m_codeInfoCacheGeneration);
+    }
+#endif // !DACCESS_COMPILE
+
     static IJitManager* FindJitMan(PCODE currentPC)
     {
         CONTRACTL {
@@ -1342,6 +1371,7 @@ private:
     static Volatile<RangeSection *> m_CodeRangeList;
     static Volatile<LONG>   m_dwReaderCount;
     static Volatile<LONG>   m_dwWriterLock;
+    static Volatile<LONG>   m_codeInfoCacheGeneration;
 #else
     SPTR_DECL(RangeSection,  m_CodeRangeList);
     SVAL_DECL(LONG, m_dwReaderCount);
@@ -1355,6 +1385,26 @@ private:
         WriterLockHolder();
         ~WriterLockHolder();
     };
+
+    // Immutable copy of m_CodeRangeList sorted by ascending LowAddress. A new snapshot is
+    // published whenever the list changes so that GetRangeSection can binary search it
+    // instead of walking the list. Replaced snapshots stay on the retired list until
+    // FreeRetiredRangeSectionSnapshots finds that no reader can still be looking at them.
+    struct RangeSectionSnapshot
+    {
+        RangeSectionSnapshot *  pNextRetired;
+        DWORD                   count;
+        RangeSection *          sections[1];
+    };
+
+    static Volatile<RangeSectionSnapshot *> m_pRangeSectionSnapshot;
+    static RangeSectionSnapshot *           m_pRetiredRangeSectionSnapshots;
+
+    static RangeSectionSnapshot * BuildRangeSectionSnapshot(TADDR excludeAddr);
+    static void PublishRangeSectionSnapshot(RangeSectionSnapshot * pSnapshot);
+    static void RetireRangeSectionSnapshots(RangeSectionSnapshot * pSnapshots);
+    static void FreeRetiredRangeSectionSnapshots();
+    static RangeSection * FindInRangeSectionSnapshot(RangeSectionSnapshot * pSnapshot, TADDR addr);
 #endif
 
 #if defined(_DEBUG)
@@ -1704,6 +1754,7 @@ public:
 //
 class EECodeInfo
 {
+    friend class EECodeInfoCache;
     friend BOOL EEJitManager::JitCodeToMethodInfo(RangeSection * pRangeSection, PCODE currentPC, MethodDesc** ppMethodDesc, EECodeInfo * pCodeInfo);
 #ifdef FEATURE_PREJIT
     friend BOOL NativeImageJitManager::JitCodeToMethodInfo(RangeSection * pRangeSection, PCODE currentPC, MethodDesc** ppMethodDesc, EECodeInfo * pCodeInfo);
@@ -1841,6 +1892,38 @@ private:
 #endif // TARGET_AMD64
 };
 
+#if defined(FEATURE_EH_FUNCLETS) && !defined(DACCESS_COMPILE)
+//-----------------------------------------------------------------------------
+// EECodeInfoCache is a small direct-mapped cache of EECodeInfo lookups owned by a
+// single thread and used by exception dispatch. Code that throws for control flow
+// unwinds through the same return addresses on every throw; caching the lookup
+// together with its function entry saves the range section search, the nibble map
+// scan and the unwind info search for each of those frames.
+//
+// All entries are invalidated at once whenever code memory is freed, see
+// code:ExecutionManager::InvalidateCodeInfoCaches.
+//
+class EECodeInfoCache
+{
+public:
+    EECodeInfoCache();
+
+    // Initializes pCodeInfo for codeAddress, from the cache when possible.
+    void Init(PCODE codeAddress, EECodeInfo * pCodeInfo);
+
+private:
+    static const DWORD CacheSize = 64;
+
+    struct Entry
+    {
+        EECodeInfo  m_codeInfo;
+        LONG        m_generation;
+    };
+
+    Entry m_entries[CacheSize];
+};
+#endif // FEATURE_EH_FUNCLETS && !DACCESS_COMPILE
+
 #include "codeman.inl"
 
 
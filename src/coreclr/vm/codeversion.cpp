@@ -808,8 +808,11 @@ bool ILCodeVersion::HasAnyOptimizedNativeCodeVersion(NativeCodeVersion tier0Nati
     _ASSERTE(!tier0NativeCodeVersion.IsNull());
     _ASSERTE(tier0NativeCodeVersion.GetILCodeVersion() == *this);
     _ASSERTE(tier0NativeCodeVersion.GetMethodDesc()->IsEligibleForTieredCompilation());
-    _ASSERTE(tier0NativeCodeVersion.GetOptimizationTier() == NativeCodeVersion::OptimizationTier0);
+    _ASSERTE(
+        tier0NativeCodeVersion.GetOptimizationTier() == NativeCodeVersion::OptimizationTier0 ||
+        tier0NativeCodeVersion.GetOptimizationTier() == NativeCodeVersion::OptimizationTier0Instrumented);
 
+    bool isUninstrumentedTier0 = tier0NativeCodeVersion.GetOptimizationTier() == NativeCodeVersion::OptimizationTier0;
     NativeCodeVersionCollection nativeCodeVersions = GetNativeCodeVersions(tier0NativeCodeVersion.GetMethodDesc());
     for (auto itEnd = nativeCodeVersions.End(), it = nativeCodeVersions.Begin(); it != itEnd; ++it)
     {
@@ -823,7 +826,8 @@ bool ILCodeVersion::HasAnyOptimizedNativeCodeVersion(NativeCodeVersion tier0Nati
 
         NativeCodeVersion::OptimizationTier optimizationTier = nativeCodeVersion.GetOptimizationTier();
         if (optimizationTier == NativeCodeVersion::OptimizationTier1 ||
-            optimizationTier == NativeCodeVersion::OptimizationTierOptimized)
+            optimizationTier == NativeCodeVersion::OptimizationTierOptimized ||
+            (isUninstrumentedTier0 && optimizationTier == NativeCodeVersion::OptimizationTier0Instrumented))
         {
             return true;
         }
@@ -1013,6 +1017,8 @@ HRESULT ILCodeVersion::SetActiveNativeCodeVersion(NativeCodeVersion activeNative
         return S_OK;
     }
 
+    CodeVersionManager* pCodeVersionManager = GetModule()->GetCodeVersionManager();
+    pCodeVersionManager->InvalidateCachedActiveNativeCodeVersion(pMethodDesc);
     if (!prevActiveVersion.IsNull())
     {
         prevActiveVersion.SetActiveChildFlag(FALSE);
@@ -1020,7 +1026,6 @@ HRESULT ILCodeVersion::SetActiveNativeCodeVersion(NativeCodeVersion activeNative
     activeNativeCodeVersion.SetActiveChildFlag(TRUE);
 
     // If needed update the published code body for this method
-    CodeVersionManager* pCodeVersionManager = GetModule()->GetCodeVersionManager();
     if (pCodeVersionManager->GetActiveILCodeVersion(GetModule(), GetMethodDef()) == *this)
     {
         if (FAILED(hr = pCodeVersionManager->PublishNativeCodeVersion(pMethodDesc, activeNativeCodeVersion)))
@@ -1271,7 +1276,10 @@ bool CodeVersionManager::s_initialNativeCodeVersionMayNotBeTheDefaultNativeCodeV
 #endif
 
 CodeVersionManager::CodeVersionManager()
-{}
+{
+    LIMITED_METHOD_DAC_CONTRACT;
+    ZeroMemory(m_activeNativeCodeVersionCache, sizeof(m_activeNativeCodeVersionCache));
+}
 
 PTR_ILCodeVersioningState CodeVersionManager::GetILCodeVersioningState(PTR_Module pModule, mdMethodDef methodDef) const
 {
@@ -1344,6 +1352,84 @@ HRESULT CodeVersionManager::GetOrCreateMethodDescVersioningState(MethodDesc* pMe
     *ppMethodVersioningState = pMethodVersioningState;
     return S_OK;
 }
+
+//static
+COUNT_T CodeVersionManager::GetActiveNativeCodeVersionCacheIndex(MethodDesc* pMethodDesc)
+{
+    LIMITED_METHOD_CONTRACT;
+    static_assert_no_msg((ActiveNativeCodeVersionCacheSize & (ActiveNativeCodeVersionCacheSize - 1)) == 0);
+
+    // MethodDescs are allocated in chunks, so mix in some of the higher bits as well
+    TADDR address = dac_cast<TADDR>(pMethodDesc) / MethodDesc::ALIGNMENT;
+    return (COUNT_T)(address ^ (address >> 10)) & (ActiveNativeCodeVersionCacheSize - 1);
+}
+
+// This function is legal to call WITHOUT taking the lock. It returns the active native code version of the active IL code
+// version of the method if that is cached, and a null native code version otherwise, in which case the caller has to look it
+// up with the lock held. The active version may change at any time after it is returned, so a caller that acts on it must
+// validate it with the lock held before publishing anything.
+NativeCodeVersion CodeVersionManager::GetCachedActiveNativeCodeVersion(MethodDesc* pMethodDesc) const
+{
+    LIMITED_METHOD_CONTRACT;
+    _ASSERTE(pMethodDesc != NULL);
+
+    TADDR entry = VolatileLoad(&m_activeNativeCodeVersionCache[GetActiveNativeCodeVersionCacheIndex(pMethodDesc)]);
+    if (entry == NULL)
+    {
+        return NativeCodeVersion();
+    }
+
+    if ((entry & ActiveNativeCodeVersionCacheDefaultVersionTag) != 0)
+    {
+        return
+            entry == (dac_cast<TADDR>(pMethodDesc) | ActiveNativeCodeVersionCacheDefaultVersionTag)
+                ? NativeCodeVersion(pMethodDesc)
+                : NativeCodeVersion();
+    }
+
+    // The node is fully initialized before it is cached, and its MethodDesc does not change
+    PTR_NativeCodeVersionNode pNativeCodeVersionNode = PTR_NativeCodeVersionNode(entry);
+    return
+        pNativeCodeVersionNode->GetMethodDesc() == pMethodDesc
+            ? NativeCodeVersion(pNativeCodeVersionNode)
+            : NativeCodeVersion();
+}
+
+void CodeVersionManager::CacheActiveNativeCodeVersion(MethodDesc* pMethodDesc, NativeCodeVersion activeNativeCodeVersion)
+{
+    LIMITED_METHOD_CONTRACT;
+    _ASSERTE(IsLockOwnedByCurrentThread());
+    _ASSERTE(!activeNativeCodeVersion.IsNull());
+    _ASSERTE(activeNativeCodeVersion.GetMethodDesc() == pMethodDesc);
+    _ASSERTE(activeNativeCodeVersion == GetActiveILCodeVersion(pMethodDesc).GetActiveNativeCodeVersion(pMethodDesc));
+
+    TADDR entry =
+        activeNativeCodeVersion.IsDefaultVersion()
+            ? dac_cast<TADDR>(pMethodDesc) | ActiveNativeCodeVersionCacheDefaultVersionTag
+            : dac_cast<TADDR>(activeNativeCodeVersion.AsNode());
+    VolatileStore(&m_activeNativeCodeVersionCache[GetActiveNativeCodeVersionCacheIndex(pMethodDesc)], entry);
+}
+
+void CodeVersionManager::InvalidateCachedActiveNativeCodeVersion(MethodDesc* pMethodDesc)
+{
+    LIMITED_METHOD_CONTRACT;
+    _ASSERTE(IsLockOwnedByCurrentThread());
+
+    // The entry may be for a different method that maps to the same index, that is fine as it will be cached again the next
+    // time it is looked up
+    VolatileStore(&m_activeNativeCodeVersionCache[GetActiveNativeCodeVersionCacheIndex(pMethodDesc)], (TADDR)NULL);
+}
+
+void CodeVersionManager::InvalidateCachedActiveNativeCodeVersions()
+{
+    LIMITED_METHOD_CONTRACT;
+    _ASSERTE(IsLockOwnedByCurrentThread());
+
+    for (COUNT_T i = 0; i < ActiveNativeCodeVersionCacheSize; i++)
+    {
+        VolatileStore(&m_activeNativeCodeVersionCache[i], (TADDR)NULL);
+    }
+}
 #endif // DACCESS_COMPILE
 
 DWORD CodeVersionManager::GetNonDefaultILVersionCount()
@@ -1516,6 +1602,9 @@ HRESULT CodeVersionManager::SetActiveILCodeVersions(ILCodeVersion* pActiveVersio
             }
             pILCodeVersioningState->SetActiveVersion(activeVersion);
         }
+
+        // The active IL code version of each closed instantiation may have changed
+        InvalidateCachedActiveNativeCodeVersions();
     }
 
     // step 2 - determine the set of pre-existing method instantiations
@@ -1620,6 +1709,7 @@ HRESULT CodeVersionManager::AddNativeCodeVersion(
     // the first child added is automatically considered the active one.
     if (ilCodeVersion.GetActiveNativeCodeVersion(pClosedMethodDesc).IsNull())
     {
+        InvalidateCachedActiveNativeCodeVersion(pClosedMethodDesc);
         pNativeCodeVersionNode->SetActiveChildFlag(TRUE);
         _ASSERTE(!ilCodeVersion.GetActiveNativeCodeVersion(pClosedMethodDesc).IsNull());
 
@@ -1669,10 +1759,23 @@ PCODE CodeVersionManager::PublishVersionableCodeIfNecessary(
             return NULL;
         }
 
+        // Try the cached active code version without taking the lock. Only a version that already has native code is used, as
+        // that is always validated below under the lock before it is published.
+        activeVersion = GetCachedActiveNativeCodeVersion(pMethodDesc);
+        if (!activeVersion.IsNull())
+        {
+            pCode = activeVersion.GetNativeCode();
+            if (pCode != NULL)
+            {
+                break;
+            }
+        }
+
         LockHolder codeVersioningLockHolder;
 
         if (SUCCEEDED(hr = GetActiveILCodeVersion(pMethodDesc).GetOrCreateActiveNativeCodeVersion(pMethodDesc, &activeVersion)))
         {
+            CacheActiveNativeCodeVersion(pMethodDesc, activeVersion);
             pCode = activeVersion.GetNativeCode();
             break;
         }
@@ -1797,6 +1900,7 @@ PCODE CodeVersionManager::PublishVersionableCodeIfNecessary(
             {
                 break;
             }
+            CacheActiveNativeCodeVersion(pMethodDesc, newActiveVersion);
 
             // The common case is that newActiveCode == activeCode, however we did leave the lock so there is
             // possibility that the active version has changed. If it has we need to restart the compilation
@@ -46,6 +46,7 @@ class NativeCodeVersion
 #ifdef FEATURE_CODE_VERSIONING
     friend class MethodDescVersioningState;
     friend class ILCodeVersion;
+    friend class CodeVersionManager;
 #endif
 
 public:
@@ -74,6 +75,7 @@ public:
     enum OptimizationTier
     {
         OptimizationTier0,
+        OptimizationTier0Instrumented, // tier 0 with instrumentation, only for methods that reached the tier 0 call count threshold
         OptimizationTier1,
         OptimizationTier1OSR,
         OptimizationTierOptimized, // may do less optimizations than tier 1
@@ -599,6 +601,7 @@ public:
     HRESULT GetOrCreateMethodDescVersioningState(MethodDesc* pMethod, MethodDescVersioningState** ppMethodDescVersioningState);
     HRESULT GetOrCreateILCodeVersioningState(Module* pModule, mdMethodDef methodDef, ILCodeVersioningState** ppILCodeVersioningState);
     HRESULT SetActiveILCodeVersions(ILCodeVersion* pActiveVersions, DWORD cActiveVersions, CDynArray<CodePublishError> * pPublishErrors);
+    NativeCodeVersion GetCachedActiveNativeCodeVersion(MethodDesc* pMethodDesc) const;
     static HRESULT AddCodePublishError(Module* pModule, mdMethodDef methodDef, MethodDesc* pMD, HRESULT hrStatus, CDynArray<CodePublishError> * pErrors);
     static HRESULT AddCodePublishError(NativeCodeVersion nativeCodeVersion, HRESULT hrStatus, CDynArray<CodePublishError> * pErrors);
     static void OnAppDomainExit(AppDomain* pAppDomain);
@@ -634,10 +637,23 @@ private:
     void ReportCodePublishError(CodePublishError* pErrorRecord);
     void ReportCodePublishError(MethodDesc* pMD, HRESULT hrStatus);
     void ReportCodePublishError(Module* pModule, mdMethodDef methodDef, MethodDesc* pMD, HRESULT hrStatus);
+    static COUNT_T GetActiveNativeCodeVersionCacheIndex(MethodDesc* pMethodDesc);
+    void CacheActiveNativeCodeVersion(MethodDesc* pMethodDesc, NativeCodeVersion activeNativeCodeVersion);
+    void InvalidateCachedActiveNativeCodeVersion(MethodDesc* pMethodDesc);
+    void InvalidateCachedActiveNativeCodeVersions();
 
     static bool s_initialNativeCodeVersionMayNotBeTheDefaultNativeCodeVersion;
 #endif
 
+    // Direct-mapped cache of the active native code version of the active IL code version of recently published methods,
+    // readable without taking the lock. Each entry is either a NativeCodeVersionNode, or a MethodDesc tagged with
+    // ActiveNativeCodeVersionCacheDefaultVersionTag for its default native code version. Entries are only written with the
+    // lock held, and are invalidated whenever the active native code version of their method or the active IL code version
+    // could change. The referenced nodes and MethodDescs are never freed, as collectible methods are not versionable.
+    static const COUNT_T ActiveNativeCodeVersionCacheSize = 1024;
+    static const TADDR ActiveNativeCodeVersionCacheDefaultVersionTag = 1;
+    TADDR m_activeNativeCodeVersionCache[ActiveNativeCodeVersionCacheSize];
+
     //Module,MethodDef -> ILCodeVersioningState
     ILCodeVersioningStateHash m_ilCodeVersioningStateMap;
 
@@ -1177,6 +1177,53 @@ void InterfaceEntry::Free()
     m_pUnknown.Store(NULL);
 }
 
+bool IIDInterfaceEntry::Init(REFIID riid, IUnknown* pUnk)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+    }
+    CONTRACTL_END;
+
+    if (InterlockedCompareExchangeT(&m_state, (LONG)State_Initializing, (LONG)State_Free) == State_Free)
+    {
+        m_iid = riid;
+        m_pUnknown = pUnk;
+        m_state.Store(State_Ready);
+        return true;
+    }
+    return false;
+}
+
+IUnknown* IIDInterfaceEntry::Lookup(REFIID riid)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    if (m_state.Load() == State_Ready && IsEqualIID(m_iid, riid))
+        return m_pUnknown;
+
+    return NULL;
+}
+
+// Helper to determine if the entry is free.
+BOOL IIDInterfaceEntry::IsFree()
+{
+    LIMITED_METHOD_CONTRACT;
+    return m_state.Load() == State_Free;
+}
+
+IUnknown* IIDInterfaceEntry::Free()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    IUnknown* pUnk = (m_state.Load() == State_Ready) ? m_pUnknown : NULL;
+    m_pUnknown = NULL;
+    m_state.Store(State_Free);
+    return pUnk;
+}
+
 //================================================================
 // Constructor for the context entry.
 CtxEntry::CtxEntry(LPVOID pCtxCookie, Thread *pSTAThread)
@@ -252,6 +252,37 @@ struct InterfaceEntry
     Volatile<IUnknown*>          m_pUnknown;             // Result of query
 };
 
+//==============================================================
+// IID Interface Entry represents a single COM IP asked for by IID rather
+// than by MethodTable, e.g. the IDispatch used for late bound calls.
+struct IIDInterfaceEntry
+{
+    // Initialize the entry, returns true on success (i.e. the entry was free).
+    bool Init(REFIID riid, IUnknown* pUnk);
+
+    // Returns the cached IP (not AddRef'ed) if the entry holds riid, NULL otherwise.
+    IUnknown* Lookup(REFIID riid);
+
+    // Helper to determine if the entry is free.
+    BOOL IsFree();
+
+    // Mark the entry as free and return the IP it held, if any.
+    IUnknown* Free();
+
+    enum
+    {
+        State_Free,
+        State_Initializing,
+        State_Ready
+    };
+
+    // The state synchronizes access to the entry: m_iid and m_pUnknown are
+    // only read once the entry is State_Ready.
+    Volatile<LONG>               m_state;
+    IID                          m_iid;                  // Interface asked for
+    IUnknown*                    m_pUnknown;             // Result of query
+};
+
 class CtxEntryCacheTraits : public DefaultSHashTraits<CtxEntry *>
 {
 public:
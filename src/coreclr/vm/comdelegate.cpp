@@ -757,15 +757,11 @@ Stub* COMDelegate::SetupShuffleThunk(MethodTable * pDelMT, MethodDesc *pTargetMe
     StackSArray<ShuffleEntry> rShuffleEntryArray;
     GenerateShuffleArray(pMD, pTargetMeth, &rShuffleEntryArray);
 
-    ShuffleThunkCache* pShuffleThunkCache = m_pShuffleThunkCache;
-
-    LoaderAllocator* pLoaderAllocator = pDelMT->GetLoaderAllocator();
-    if (pLoaderAllocator->IsCollectible())
-    {
-        pShuffleThunkCache = ((AssemblyLoaderAllocator*)pLoaderAllocator)->GetShuffleThunkCache();
-    }
-
-    Stub* pShuffleThunk = pShuffleThunkCache->Canonicalize((const BYTE *)&rShuffleEntryArray[0]);
+    // A shuffle thunk only depends on the argument offsets in the shuffle array, never on the
+    // types involved, so the thunks are shared by delegates of all LoaderAllocators. The cache
+    // holds its own reference, which keeps a thunk alive when collectible delegate types that
+    // use it are unloaded.
+    Stub* pShuffleThunk = m_pShuffleThunkCache->Canonicalize((const BYTE *)&rShuffleEntryArray[0]);
     if (!pShuffleThunk)
     {
         COMPlusThrowOM();
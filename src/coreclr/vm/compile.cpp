@@ -5714,9 +5714,17 @@ void CEEPreloader::GenerateMethodStubs(
 
     // Do not generate IL stubs when generating ReadyToRun images except for System.Private.Corelib
     // This prevents versionability concerns around IL stubs exposing internal
-    // implementation details of the CLR.
-    if (IsReadyToRunCompilation() && (!GetAppDomain()->ToCompilationDomain()->GetTargetModule()->IsSystem() || !pMD->IsNDirect()))
-        return;
+    // implementation details of the CLR. Interop heavy applications that ship with a fixed runtime
+    // can opt into precompiling their P/Invoke stubs as well with ReadyToRunCompilePInvokeStubs.
+    if (IsReadyToRunCompilation())
+    {
+        if (!pMD->IsNDirect())
+            return;
+
+        if (!GetAppDomain()->ToCompilationDomain()->GetTargetModule()->IsSystem()
+            && !CLRConfig::GetConfigValue(CLRConfig::INTERNAL_ReadyToRunCompilePInvokeStubs))
+            return;
+    }
 
     DWORD dwNGenStubFlags = NDIRECTSTUB_FL_NGENEDSTUB;
 
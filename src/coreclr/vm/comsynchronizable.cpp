@@ -183,6 +183,26 @@ static void PulseAllHelper(Thread* pThread)
     EX_END_CATCH(SwallowAllExceptions)
 }
 
+// Time elapsed between Thread.Start requesting the thread and the thread running its
+// start routine, which covers the OS thread creation and the runtime's thread setup.
+static UINT32 GetThreadStartupTimeInMicroseconds(Thread* pThread)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    if (pThread->m_startRequestTimestamp.QuadPart == 0)
+        return 0;
+
+    static LARGE_INTEGER freq;
+    if (freq.QuadPart == 0)
+        QueryPerformanceFrequency(&freq);
+
+    LARGE_INTEGER now;
+    QueryPerformanceCounter(&now);
+
+    ULONGLONG elapsedMicroseconds = (ULONGLONG)(now.QuadPart - pThread->m_startRequestTimestamp.QuadPart) * 1000000 / freq.QuadPart;
+    return (UINT32)min(elapsedMicroseconds, (ULONGLONG)UINT32_MAX);
+}
+
 // When an exposed thread is started by Win32, this is where it starts.
 ULONG WINAPI ThreadNative::KickOffThread(void* pass)
 {
@@ -204,8 +224,8 @@ ULONG WINAPI ThreadNative::KickOffThread(void* pass)
         //
 
         // Fire ETW event to correlate with the thread that created current thread
-        if (ETW_EVENT_ENABLED(MICROSOFT_WINDOWS_DOTNETRUNTIME_PROVIDER_DOTNET_Context, ThreadRunning))
-            FireEtwThreadRunning(pThread, GetClrInstanceId());
+        if (ETW_EVENT_ENABLED(MICROSOFT_WINDOWS_DOTNETRUNTIME_PROVIDER_DOTNET_Context, ThreadRunning_V1))
+            FireEtwThreadRunning_V1(pThread, GetClrInstanceId(), GetThreadStartupTimeInMicroseconds(pThread));
 
         // We have a sticky problem here.
         //
@@ -269,6 +289,8 @@ void QCALLTYPE ThreadNative::Start(QCall::ThreadHandle thread, int threadStackSi
     if (ETW_EVENT_ENABLED(MICROSOFT_WINDOWS_DOTNETRUNTIME_PROVIDER_DOTNET_Context, ThreadCreating))
         FireEtwThreadCreating(pNewThread, GetClrInstanceId());
 
+    QueryPerformanceCounter(&pNewThread->m_startRequestTimestamp);
+
     // As soon as we create the new thread, it is eligible for suspension, etc.
     // So it gets transitioned to cooperative mode before this call returns to
     // us.  It is our duty to start it running immediately, so that GC isn't blocked.
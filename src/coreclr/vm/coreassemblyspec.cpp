@@ -18,6 +18,7 @@
 #include "domainfile.h"
 #include "holder.h"
 #include "bundle.h"
+#include "configuration.h"
 #include "strongnameinternal.h"
 #include "strongnameholders.h"
 
@@ -290,6 +291,197 @@ ErrExit:
     return hr;
 }
 
+//-----------------------------------------------------------------------------------------------------------
+// Startup prefetching of TPA assemblies
+//
+// Binding opens and maps assemblies lazily, one at a time, when they are first needed. When enabled, background
+// threads open the first StartupAssemblyPrefetchCount assemblies of the TPA list ahead of time, map them and
+// initialize their metadata so that the binds on the startup path find them ready in the PEImage cache. Prefetched
+// images are kept alive for the lifetime of the process.
+//
+// Single-file bundles do not list their bundled assemblies in the TPA. For them the host passes the compressed
+// bundled assemblies instead, whose first use would otherwise pay for decompression on the startup path.
+//
+namespace
+{
+    struct StartupAssemblyPrefetchList
+    {
+        COUNT_T             m_count;
+        SString            *m_paths;            // IL file paths of the assemblies to prefetch
+        BundleFileLocation *m_bundleLocations;  // Location within the bundle, or invalid for files on disk
+        LONG                m_next;             // Index of the next assembly to prefetch
+        LONG                m_refCount;         // One reference per prefetch thread, plus one for the creator
+
+        StartupAssemblyPrefetchList(COUNT_T count)
+            : m_count(0), m_paths(new SString[count]), m_bundleLocations(new BundleFileLocation[count]), m_next(0), m_refCount(1)
+        {
+            WRAPPER_NO_CONTRACT;
+        }
+
+        ~StartupAssemblyPrefetchList()
+        {
+            WRAPPER_NO_CONTRACT;
+            delete[] m_paths;
+            delete[] m_bundleLocations;
+        }
+
+        void Release()
+        {
+            WRAPPER_NO_CONTRACT;
+
+            if (InterlockedDecrement(&m_refCount) == 0)
+            {
+                delete this;
+            }
+        }
+    };
+
+    DWORD WINAPI StartupAssemblyPrefetchThreadStart(LPVOID args)
+    {
+        CONTRACTL
+        {
+            NOTHROW;
+            GC_TRIGGERS;
+            MODE_ANY;
+        }
+        CONTRACTL_END;
+
+        StartupAssemblyPrefetchList *pList = (StartupAssemblyPrefetchList *)args;
+
+        for (LONG i = InterlockedIncrement(&pList->m_next) - 1; i < (LONG)pList->m_count; i = InterlockedIncrement(&pList->m_next) - 1)
+        {
+            EX_TRY
+            {
+                PEImageHolder pImage(PEImage::OpenImage(pList->m_paths[i], MDInternalImport_Default, pList->m_bundleLocations[i]));
+                if (SUCCEEDED(pImage->TryOpenFile()))
+                {
+                    PEImageLayoutHolder pLayout(pImage->GetLayout(PEImageLayout::LAYOUT_ANY, PEImage::LAYOUT_CREATEIFNEEDED));
+                    if (pLayout->CheckCorHeader())
+                    {
+                        pImage->GetMDImport();
+                    }
+
+                    // Keep the reference so that the image stays in the cache until the binder asks for it
+                    pImage.SuppressRelease();
+                }
+            }
+            EX_CATCH
+            {
+                // Prefetching is only an optimization, the bind reports any real failure
+            }
+            EX_END_CATCH(SwallowAllExceptions)
+        }
+
+        pList->Release();
+        return 0;
+    }
+
+    void AddBundledAssembliesToPrefetch(StartupAssemblyPrefetchList *pList, COUNT_T count, LPCWSTR wszAssemblies)
+    {
+        STANDARD_VM_CONTRACT;
+
+        const SString sAssemblies(wszAssemblies);
+        SString::CIterator i = sAssemblies.Begin();
+        while (i != sAssemblies.End() && pList->m_count < count)
+        {
+            SString::CIterator start = i;
+            if (!sAssemblies.Find(i, PATH_SEPARATOR_CHAR_W))
+            {
+                i = sAssemblies.End();
+            }
+
+            SString relativePath(sAssemblies, start, i);
+            if (i != sAssemblies.End())
+            {
+                ++i;
+            }
+
+            BundleFileLocation location = Bundle::ProbeAppBundle(relativePath, /* pathIsBundleRelative */ true);
+            if (location.IsValid())
+            {
+                SString &path = pList->m_paths[pList->m_count];
+                path.Set(Bundle::AppBundle->BasePath());
+                path.Append(relativePath);
+
+                pList->m_bundleLocations[pList->m_count++] = location;
+            }
+        }
+    }
+}
+
+void StartStartupAssemblyPrefetch(CLRPrivBinderCoreCLR *pBinder)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_TRIGGERS;
+        MODE_ANY;
+    }
+    CONTRACTL_END;
+
+    _ASSERTE(pBinder != NULL);
+
+    DWORD maxCount = CLRConfig::GetConfigValue(CLRConfig::INTERNAL_StartupAssemblyPrefetchCount);
+    if (maxCount == 0)
+    {
+        return;
+    }
+
+    EX_TRY
+    {
+        NewHolder<StartupAssemblyPrefetchList> pList;
+
+        if (Bundle::AppIsBundle())
+        {
+            LPCWSTR wszAssemblies = Configuration::GetKnobStringValue(W("BUNDLE_COMPRESSED_ASSEMBLIES"));
+            if (wszAssemblies != NULL)
+            {
+                pList = new StartupAssemblyPrefetchList(maxCount);
+                AddBundledAssembliesToPrefetch(pList, maxCount, wszAssemblies);
+            }
+        }
+        else
+        {
+            BINDER_SPACE::SimpleNameToFileNameMap *pTpaMap = pBinder->GetAppContext()->GetTpaList();
+            COUNT_T count = min((COUNT_T)maxCount, pTpaMap->GetCount());
+
+            pList = new StartupAssemblyPrefetchList(count);
+            for (BINDER_SPACE::SimpleNameToFileNameMap::Iterator it = pTpaMap->Begin(), end = pTpaMap->End();
+                 it != end && pList->m_count < count;
+                 ++it)
+            {
+                if ((*it).m_wszILFileName != NULL)
+                {
+                    pList->m_paths[pList->m_count++].Set((*it).m_wszILFileName);
+                }
+            }
+        }
+
+        if (pList != NULL && pList->m_count != 0)
+        {
+            DWORD threadCount = min(max(CLRConfig::GetConfigValue(CLRConfig::INTERNAL_StartupAssemblyPrefetchThreads), (DWORD)1), (DWORD)pList->m_count);
+
+            for (DWORD i = 0; i < threadCount; i++)
+            {
+                InterlockedIncrement(&pList->m_refCount);
+
+                HandleHolder hThread(Thread::CreateUtilityThread(Thread::StackSize_Small, StartupAssemblyPrefetchThreadStart, pList, W(".NET Assembly prefetch")));
+                if (hThread == NULL)
+                {
+                    InterlockedDecrement(&pList->m_refCount);
+                    break;
+                }
+            }
+
+            pList.Extract()->Release();
+        }
+    }
+    EX_CATCH
+    {
+    }
+    EX_END_CATCH(SwallowAllExceptions)
+}
+
 HRESULT BaseAssemblySpec::ParseName()
 {
     CONTRACTL
@@ -88,6 +88,7 @@
 #endif //FEATURE_PERFTRACING
 
 #include "tailcallhelp.h"
+#include "checkpointrestore.h"
 
 #endif // CROSSGEN_CORELIB
 
@@ -688,6 +688,9 @@ HRESULT CorHost2::CreateAppDomainWithManager(
             sPlatformResourceRoots,
             sAppPaths,
             sAppNiPaths));
+
+        extern void StartStartupAssemblyPrefetch(CLRPrivBinderCoreCLR *pBinder);
+        StartStartupAssemblyPrefetch(pBinder);
     }
 
     *pAppDomainID=DefaultADID;
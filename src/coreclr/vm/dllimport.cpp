@@ -4232,6 +4232,33 @@ void NDirect::PopulateNDirectMethodDesc(NDirectMethodDesc* pNMD, PInvokeStaticSi
     pNMD->InterlockedSetNDirectFlags(ndirectflags);
 }
 
+// Blittable P/Invokes to exports listed in PInvokeNoGCTransitionList are treated as if they
+// were marked with SuppressGCTransitionAttribute, so the JIT can call them inline without
+// setting up a frame or switching the GC mode. The result is computed once and cached on
+// the method; MethodDesc::ShouldSuppressGCTransition picks it up from there.
+void NDirect::InferSuppressGCTransition(NDirectMethodDesc* pNMD)
+{
+    STANDARD_VM_CONTRACT;
+
+    if (pNMD->IsSuppressGCTransitionInferenceCached())
+        return;
+
+    BOOL fInferred = FALSE;
+    if (PInvokeOverride::HasNoGCTransitionImpls() && !pNMD->MethodDesc::IsVarArg())
+    {
+        LPCUTF8 szLibName = NULL, szEntryPointName = NULL;
+        PInvokeStaticSigInfo sigInfo(pNMD, &szLibName, &szEntryPointName);
+
+        fInferred = (szLibName != NULL)
+            && (szEntryPointName != NULL)
+            && PInvokeOverride::IsNoGCTransitionImpl(szLibName, szEntryPointName)
+            && !pNMD->MarshalingRequired();
+    }
+
+    pNMD->InterlockedSetNDirectFlags(NDirectMethodDesc::kIsSuppressGCTransitionInferredCached |
+        (fInferred ? NDirectMethodDesc::kCachedSuppressGCTransitionInferred : 0));
+}
+
 #ifdef FEATURE_COMINTEROP
 // Find the MethodDesc of the predefined IL stub method by either
 // 1) looking at redirected adapter interfaces, OR
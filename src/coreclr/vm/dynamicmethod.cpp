@@ -138,6 +138,16 @@ void DynamicMethodTable::Destroy()
     }
 #endif
 
+    // The resolvers are not destructed, free the chunks their allocators kept for reuse
+    DynamicMethodDesc *pMD = m_DynamicMethodList;
+    while (pMD != NULL)
+    {
+        LCGMethodResolver *pResolver = pMD->GetLCGMethodResolver();
+        pResolver->m_jitMetaHeap.Delete();
+        pResolver->m_jitTempData.Delete();
+        pMD = pResolver->m_next;
+    }
+
     m_Crst.Destroy();
     LOG((LF_BCL, LL_INFO10, "Level1 - DynamicMethodTable destroyed {0x%p}\n", this));
 }
@@ -983,8 +993,15 @@ void LCGMethodResolver::Destroy()
     // Note that we need to do this before m_jitTempData is deleted
     RecycleIndCells();
 
-    m_jitMetaHeap.Delete();
-    m_jitTempData.Delete();
+#ifdef GCINFO_SLOT_TABLE_CACHE
+    // The GC info of the method lives in m_jitMetaHeap
+    GcSlotTableCache::Flush();
+#endif
+
+    // The resolver is recycled together with the DynamicMethodDesc, so keep a chunk of each
+    // allocator for the next dynamic method that uses it
+    m_jitMetaHeap.Reset();
+    m_jitTempData.Reset();
 
 
     if (m_recordCodePointer)
@@ -1478,6 +1495,31 @@ void ChunkAllocator::Delete()
         delete[] m_pData;
         m_pData = next;
     }
+    m_pChunk = NULL;
+}
+
+void ChunkAllocator::Reset()
+{
+    LIMITED_METHOD_CONTRACT;
+    BYTE *next = NULL;
+    LOG((LF_BCL, LL_INFO10, "Level1 - DM - Allocator [0x%p] - resetting, keeping block {0x%p}\n", this, m_pChunk));
+    while (m_pData)
+    {
+        next = ((BYTE**)m_pData)[0];
+        if (m_pData != m_pChunk)
+        {
+            LOG((LF_BCL, LL_INFO10, "Level1 - DM - Allocator [0x%p] - delete block {0x%p}\n", this, m_pData));
+            delete[] m_pData;
+        }
+        m_pData = next;
+    }
+
+    if (m_pChunk)
+    {
+        m_pData = m_pChunk;
+        ((BYTE**)m_pData)[0] = NULL;
+        ((size_t*)m_pData)[1] = CHUNK_SIZE - (sizeof(void*) * 2);
+    }
 }
 
 void* ChunkAllocator::New(size_t size)
@@ -1517,6 +1559,7 @@ void* ChunkAllocator::New(size_t size)
         ((size_t*)pNewBlock)[1] = CHUNK_SIZE - size - (sizeof(void*) * 2);
         LOG((LF_BCL, LL_INFO10, "Level1 - DM - Allocator [0x%p] - new block {0x%p}\n", this, pNewBlock));
         newBlock.SuppressRelease();
+        m_pChunk = pNewBlock;
     }
     else
     {
@@ -25,16 +25,23 @@
 class ChunkAllocator
 {
 private:
-    #define CHUNK_SIZE 64
+    // Large enough for the GC info, EH info and resolved signatures of a typical small dynamic method
+    #define CHUNK_SIZE 256
 
     BYTE *m_pData;
 
+    // Most recently allocated CHUNK_SIZE block, kept by Reset
+    BYTE *m_pChunk;
+
 public:
-    ChunkAllocator() : m_pData(NULL) {}
+    ChunkAllocator() : m_pData(NULL), m_pChunk(NULL) {}
 
     ~ChunkAllocator();
     void* New(size_t size);
     void Delete();
+
+    // Free all the allocations, but keep one chunk for the next user of the allocator
+    void Reset();
 };
 
 //---------------------------------------------------------------------------------------
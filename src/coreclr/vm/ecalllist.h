@@ -680,6 +680,11 @@ FCFuncStart(gCastHelpers)
     FCFuncElement("WriteBarrier", ::WriteBarrier_Helper)
 FCFuncEnd()
 
+FCFuncStart(gCheckpointRestoreFuncs)
+    QCFuncElement("PrepareForCheckpoint", CheckpointRestore::PrepareForCheckpoint)
+    QCFuncElement("NotifyRestored", CheckpointRestore::NotifyRestored)
+FCFuncEnd()
+
 FCFuncStart(gArrayFuncs)
     FCFuncElement("GetCorElementTypeOfElementType", ArrayNative::GetCorElementTypeOfElementType)
     FCFuncElement("Initialize", ArrayNative::Initialize)
@@ -1010,6 +1015,7 @@ FCFuncStart(gNativeEventLogger)
     QCFuncElement("LogThreadPoolIOEnqueue", NativeEventLogger::LogThreadPoolIOEnqueue)
     QCFuncElement("LogThreadPoolIODequeue", NativeEventLogger::LogThreadPoolIODequeue)
     QCFuncElement("LogThreadPoolWorkingThreadCount", NativeEventLogger::LogThreadPoolWorkingThreadCount)
+    QCFuncElement("LogRuntimeCounters", NativeEventLogger::LogRuntimeCounters)
 FCFuncEnd()
 #endif // defined(FEATURE_PERFTRACING)
 
@@ -1120,6 +1126,7 @@ FCClassElement("AssemblyName", "System.Reflection", gAssemblyNameFuncs)
 FCClassElement("Buffer", "System", gBufferFuncs)
 FCClassElement("CLRConfig", "System", gClrConfig)
 FCClassElement("CastHelpers", "System.Runtime.CompilerServices", gCastHelpers)
+FCClassElement("CheckpointRestore", "System.Runtime", gCheckpointRestoreFuncs)
 #ifdef FEATURE_COMINTEROP
 FCClassElement("ComWrappers", "System.Runtime.InteropServices", gComWrappersFuncs)
 #endif // FEATURE_COMINTEROP
@@ -119,6 +119,7 @@ HRESULT EEConfig::Init()
     iJitOptimizeType = OPT_DEFAULT;
     fJitFramed = false;
     fJitMinOpts = false;
+    fJitLargePageCodeHeaps = false;
     fPInvokeRestoreEsp = (DWORD)-1;
 
     fNgenBindOptimizeNonGac = false;
@@ -196,6 +197,8 @@ HRESULT EEConfig::Init()
     dwDisableStackwalkCache = 1;
 #endif // TARGET_X86
 
+    dwDisableCallSiteUnwind = 0;
+
     szZapBBInstr     = NULL;
     szZapBBInstrDir  = NULL;
 
@@ -242,6 +245,7 @@ HRESULT EEConfig::Init()
     fTieredCompilation_QuickJitForLoops = false;
     fTieredCompilation_CallCounting = false;
     fTieredCompilation_UseCallCountingStubs = false;
+    fTieredCompilation_SeparateTier0CodeHeap = false;
     tieredCompilation_CallCountThreshold = 1;
     tieredCompilation_BackgroundWorkerTimeoutMs = 0;
     tieredCompilation_CallCountingDelayMs = 0;
@@ -583,6 +587,7 @@ HRESULT EEConfig::sync()
 
 
     dwDisableStackwalkCache = CLRConfig::GetConfigValue(CLRConfig::EXTERNAL_DisableStackwalkCache, dwDisableStackwalkCache);
+    dwDisableCallSiteUnwind = CLRConfig::GetConfigValue(CLRConfig::EXTERNAL_DisableCallSiteUnwind, dwDisableCallSiteUnwind);
 
 
 #ifdef _DEBUG
@@ -610,6 +615,7 @@ HRESULT EEConfig::sync()
 
     fJitFramed = (CLRConfig::GetConfigValue(CLRConfig::UNSUPPORTED_JitFramed) != 0);
     fJitMinOpts = (CLRConfig::GetConfigValue(CLRConfig::UNSUPPORTED_JITMinOpts) == 1);
+    fJitLargePageCodeHeaps = (CLRConfig::GetConfigValue(CLRConfig::EXTERNAL_JitLargePageCodeHeaps) != 0);
     iJitOptimizeType      =  CLRConfig::GetConfigValue(CLRConfig::EXTERNAL_JitOptimizeType);
     if (iJitOptimizeType > OPT_RANDOM)     iJitOptimizeType = OPT_DEFAULT;
 
@@ -846,6 +852,9 @@ HRESULT EEConfig::sync()
             }
         }
 
+        fTieredCompilation_SeparateTier0CodeHeap =
+            CLRConfig::GetConfigValue(CLRConfig::INTERNAL_TC_SeparateTier0CodeHeap) != 0;
+
         if (CLRConfig::GetConfigValue(CLRConfig::EXTERNAL_TC_AggressiveTiering) != 0)
         {
             // TC_AggressiveTiering may be used in some benchmarks to have methods be tiered up more quickly, for example when
@@ -89,15 +89,7 @@ DWORD EEUtf8HashTableHelper::Hash(LPCUTF8 pKey)
 {
     LIMITED_METHOD_DAC_CONTRACT;
 
-    DWORD dwHash = 0;
-
-    while (*pKey != 0)
-    {
-        dwHash = (dwHash << 5) + (dwHash >> 5) + (*pKey);
-        pKey++;
-    }
-
-    return dwHash;
+    return HashUtf8String(pKey);
 }
 
 
@@ -435,6 +435,7 @@ EEToProfInterfaceImpl::EEToProfInterfaceImpl() :
     m_pEnter3WithInfo(NULL),
     m_pLeave3WithInfo(NULL),
     m_pTailcall3WithInfo(NULL),
+    m_cEnterLeaveBufferRecords(0),
     m_fUnrevertiblyModifiedIL(FALSE),
     m_fModifiedRejitState(FALSE),
     m_pFunctionIDHashTable(NULL),
@@ -1978,7 +1979,8 @@ HRESULT EEToProfInterfaceImpl::EnsureProfilerDetachable()
         (m_pLeave3 != NULL)            ||
         (m_pLeave3WithInfo != NULL)    ||
         (m_pTailcall3 != NULL)         ||
-        (m_pTailcall3WithInfo != NULL))
+        (m_pTailcall3WithInfo != NULL) ||
+        (m_cEnterLeaveBufferRecords != 0))
     {
         LOG((
             LF_CORPROF,
@@ -2037,6 +2039,29 @@ HRESULT EEToProfInterfaceImpl::DetermineAndSetEnterLeaveFunctionHooksForJit()
     }
     CONTRACTL_END;
 
+    // Enter/leave buffering goes through the slow path intermediaries, which write the
+    // records instead of calling into the profiler.
+    if (m_cEnterLeaveBufferRecords != 0)
+    {
+        HRESULT hr = S_OK;
+
+        EX_TRY
+        {
+            hr = SetEnterLeaveFunctionHooksForJit(
+                PROFILECALLBACK(ProfileEnter),
+                PROFILECALLBACK(ProfileLeave),
+                PROFILECALLBACK(ProfileTailcall));
+        }
+        EX_CATCH
+        {
+            hr = E_FAIL;
+        }
+        // See below for why all exceptions are swallowed
+        EX_END_CATCH(SwallowAllExceptions);
+
+        return hr;
+    }
+
     // We're doing all ELT3 hooks, all-Whidbey hooks or all-Everett hooks.  No mixing and matching.
     BOOL fCLRv4Hooks = (m_pEnter3 != NULL)             ||
                        (m_pLeave3 != NULL)             ||
@@ -2313,7 +2338,8 @@ HRESULT EEToProfInterfaceImpl::SetEventMask(DWORD dwEventMask, DWORD dwEventMask
             (m_pTailcall3         != NULL) ||
             (m_pTailcall3WithInfo != NULL) ||
             (m_pTailcall2         != NULL) ||
-            (m_pTailcall          != NULL)
+            (m_pTailcall          != NULL) ||
+            (m_cEnterLeaveBufferRecords != 0)
         );
 
     BOOL fNeedToTurnOffConcurrentGC = FALSE;
@@ -2708,6 +2734,139 @@ HRESULT EEToProfInterfaceImpl::SetEnterLeaveFunctionHooks3WithInfo(FunctionEnter
     return DetermineAndSetEnterLeaveFunctionHooksForJit();
 }
 
+//---------------------------------------------------------------------------------------
+//
+// The Info method SetEnterLeaveBuffering() simply defers to this function to do the
+// real work.
+//
+// Arguments:
+//     (same as specified in the public API docs)
+//
+// Return Value:
+//     HRESULT indicating success / failure to return straight through to the profiler
+//
+
+HRESULT EEToProfInterfaceImpl::SetEnterLeaveBuffering(ULONG cRecordsPerThread)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+        EE_THREAD_NOT_REQUIRED;
+        CANNOT_TAKE_LOCK;
+    }
+    CONTRACTL_END;
+
+    // Keep the buffers reasonably sized, they are allocated for every thread running managed code
+    const ULONG kMaxRecordsPerThread = 1 << 20;
+
+    if ((cRecordsPerThread == 0) || (cRecordsPerThread > kMaxRecordsPerThread))
+    {
+        return E_INVALIDARG;
+    }
+
+    // The buffers are indexed with a mask
+    ULONG cRecords = 1;
+    while (cRecords < cRecordsPerThread)
+    {
+        cRecords <<= 1;
+    }
+
+    m_cEnterLeaveBufferRecords = cRecords;
+
+    // Buffering replaces all the hooks.
+    m_pEnter3WithInfo    = NULL;
+    m_pLeave3WithInfo    = NULL;
+    m_pTailcall3WithInfo = NULL;
+    m_pEnter3    = NULL;
+    m_pLeave3    = NULL;
+    m_pTailcall3 = NULL;
+    m_pEnter2    = NULL;
+    m_pLeave2    = NULL;
+    m_pTailcall2 = NULL;
+    m_pEnter     = NULL;
+    m_pLeave     = NULL;
+    m_pTailcall  = NULL;
+
+    return DetermineAndSetEnterLeaveFunctionHooksForJit();
+}
+
+//---------------------------------------------------------------------------------------
+//
+// Allocates an enter/leave buffer of cRecords records, which must be a power of 2.
+//
+// Return Value:
+//     The buffer, or NULL if out of memory
+//
+
+ProfilerEnterLeaveBuffer * ProfilerEnterLeaveBuffer::Create(ULONG cRecords)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+    }
+    CONTRACTL_END;
+
+    _ASSERTE((cRecords != 0) && ((cRecords & (cRecords - 1)) == 0));
+
+    size_t cbBuffer = offsetof(ProfilerEnterLeaveBuffer, m_records) + cRecords * sizeof(COR_PRF_ELT_RECORD);
+    BYTE * pMemory = new (nothrow) BYTE[cbBuffer];
+    if (pMemory == NULL)
+    {
+        return NULL;
+    }
+
+    ProfilerEnterLeaveBuffer * pBuffer = reinterpret_cast<ProfilerEnterLeaveBuffer *>(pMemory);
+    pBuffer->m_cRecords = cRecords;
+    pBuffer->m_head.RawValue() = 0;
+    pBuffer->m_tail.RawValue() = 0;
+    pBuffer->m_cLost.RawValue() = 0;
+    return pBuffer;
+}
+
+void ProfilerEnterLeaveBuffer::Destroy(ProfilerEnterLeaveBuffer * pBuffer)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    delete [] reinterpret_cast<BYTE *>(pBuffer);
+}
+
+//---------------------------------------------------------------------------------------
+//
+// Moves up to cRecords of the oldest records into pRecords.
+//
+// Arguments:
+//      * pRecords - [out] Receives the records
+//      * cRecords - Size of pRecords
+//      * pcLost - [out] Receives the number of records dropped since the last call
+//
+// Return Value:
+//     Number of records copied
+//
+
+ULONG ProfilerEnterLeaveBuffer::Read(COR_PRF_ELT_RECORD * pRecords, ULONG cRecords, ULONG * pcLost)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    ULONG tail = m_tail.LoadWithoutBarrier();
+    ULONG cAvailable = m_head.Load() - tail;
+    ULONG cRead = min(cAvailable, cRecords);
+
+    for (ULONG i = 0; i < cRead; i++)
+    {
+        pRecords[i] = m_records[(tail + i) & (m_cRecords - 1)];
+    }
+
+    // Hand the slots back to the writer
+    m_tail.Store(tail + cRead);
+
+    *pcLost = (ULONG)InterlockedExchange(m_cLost.GetPointer(), 0);
+    return cRead;
+}
+
 
 
 //---------------------------------------------------------------------------------------
@@ -35,6 +35,34 @@ struct AssemblyReferenceClosureWalkContextForProfAPI;
 
 const GUID k_guidZero = {0};
 
+//---------------------------------------------------------------------------------------
+// Ring buffer of enter/leave records of one thread, used when the profiler asked for
+// enter/leave buffering (ICorProfilerInfo13::SetEnterLeaveBuffering). Only the owning
+// thread writes to it, and the profiler drains it with GetEnterLeaveRecords.
+//
+
+struct ProfilerEnterLeaveBuffer
+{
+    // Number of records, always a power of 2
+    ULONG m_cRecords;
+
+    // Free running counts of records written and read. Only the owning thread updates
+    // m_head and only the drainer updates m_tail.
+    Volatile<ULONG> m_head;
+    Volatile<ULONG> m_tail;
+
+    // Records dropped because the buffer was full
+    Volatile<LONG> m_cLost;
+
+    COR_PRF_ELT_RECORD m_records[1];
+
+    static ProfilerEnterLeaveBuffer * Create(ULONG cRecords);
+    static void Destroy(ProfilerEnterLeaveBuffer * pBuffer);
+
+    void Write(COR_PRF_ELT_RECORD_KIND kind, UINT_PTR clientData);
+    ULONG Read(COR_PRF_ELT_RECORD * pRecords, ULONG cRecords, ULONG * pcLost);
+};
+
 class EEToProfInterfaceImpl
 {
 public:
@@ -92,6 +120,9 @@ public:
 
     BOOL IsClientIDToFunctionIDMappingEnabled();
 
+    BOOL IsEnterLeaveBufferingEnabled();
+    ULONG GetEnterLeaveBufferRecordCount();
+
     UINT_PTR LookupClientIDFromCache(FunctionID functionID);
 
     HRESULT SetEnterLeaveFunctionHooks(
@@ -114,6 +145,8 @@ public:
         FunctionLeave3WithInfo * pFuncLeave3WithInfo,
         FunctionTailcall3WithInfo * pFuncTailcall3WithInfo);
 
+    HRESULT SetEnterLeaveBuffering(ULONG cRecordsPerThread);
+
     BOOL RequiresGenericsContextForEnterLeave();
 
     UINT_PTR EEFunctionIDMapper(FunctionID funcId, BOOL * pbHookFunction);
@@ -621,6 +654,9 @@ private:
     FunctionLeave3WithInfo *    m_pLeave3WithInfo;
     FunctionTailcall3WithInfo * m_pTailcall3WithInfo;
 
+    // Size of the per-thread enter/leave buffers, 0 unless enter/leave buffering is on
+    ULONG m_cEnterLeaveBufferRecords;
+
 
     // Remembers whether the profiler used SetILFunctionBody() which modifies IL in a
     // way that cannot be reverted.  This prevents a detach from succeeding.
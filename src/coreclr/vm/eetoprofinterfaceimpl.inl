@@ -185,6 +185,43 @@ inline FunctionTailcall3WithInfo * EEToProfInterfaceImpl::GetTailcall3WithInfoHo
     return m_pTailcall3WithInfo;
 }
 
+inline BOOL EEToProfInterfaceImpl::IsEnterLeaveBufferingEnabled()
+{
+    LIMITED_METHOD_CONTRACT;
+    return m_cEnterLeaveBufferRecords != 0;
+}
+
+inline ULONG EEToProfInterfaceImpl::GetEnterLeaveBufferRecordCount()
+{
+    LIMITED_METHOD_CONTRACT;
+    return m_cEnterLeaveBufferRecords;
+}
+
+inline void ProfilerEnterLeaveBuffer::Write(COR_PRF_ELT_RECORD_KIND kind, UINT_PTR clientData)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    ULONG head = m_head.LoadWithoutBarrier();
+    if (head - m_tail.Load() >= m_cRecords)
+    {
+        // Full, the profiler has not drained the buffer fast enough
+        InterlockedIncrement(m_cLost.GetPointer());
+        return;
+    }
+
+    LARGE_INTEGER timestamp;
+    QueryPerformanceCounter(&timestamp);
+
+    COR_PRF_ELT_RECORD * pRecord = &m_records[head & (m_cRecords - 1)];
+    pRecord->functionIDOrClientID.clientID = clientData;
+    pRecord->timestamp = (UINT64)timestamp.QuadPart;
+    pRecord->kind = (UINT32)kind;
+    pRecord->reserved = 0;
+
+    // Publish the record to the drainer
+    m_head.Store(head + 1);
+}
+
 inline BOOL EEToProfInterfaceImpl::IsClientIDToFunctionIDMappingEnabled()
 {
     LIMITED_METHOD_CONTRACT;
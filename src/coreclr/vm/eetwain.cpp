@@ -3264,7 +3264,7 @@ unsigned SKIP_ALLOC_FRAME(int size, PTR_CBYTE base, unsigned offset)
 
 #if defined(FEATURE_EH_FUNCLETS) && !defined(CROSSGEN_COMPILE)
 
-void EECodeManager::EnsureCallerContextIsValid( PREGDISPLAY  pRD, StackwalkCacheEntry* pCacheEntry, EECodeInfo * pCodeInfo /*= NULL*/ )
+void EECodeManager::EnsureCallerContextIsValid( PREGDISPLAY  pRD, StackwalkCacheEntry* pCacheEntry, EECodeInfo * pCodeInfo /*= NULL*/, bool fIntegerRegistersOnly /*= false*/ )
 {
     CONTRACTL
     {
@@ -3284,6 +3284,16 @@ void EECodeManager::EnsureCallerContextIsValid( PREGDISPLAY  pRD, StackwalkCache
         }
         else
 #endif // !DACCESS_COMPILE
+#if !defined(DACCESS_COMPILE) && defined(TARGET_AMD64)
+        // The frame is at a call site and the caller only looks at the integer registers
+        if (fIntegerRegistersOnly &&
+            (pCodeInfo != NULL) &&
+            Thread::VirtualUnwindCallSiteFrame(pRD->pCurrentContext, pRD->pCurrentContextPointers,
+                                               pRD->pCallerContext, pRD->pCallerContextPointers, pCodeInfo))
+        {
+        }
+        else
+#endif // !DACCESS_COMPILE && TARGET_AMD64
         {
             // We need to make a copy here (instead of switching the pointers), in order to preserve the current context
             *(pRD->pCallerContext) = *(pRD->pCurrentContext);
@@ -8,6 +8,9 @@
 #include "ep-rt-coreclr.h"
 #include "ds-profiler-protocol.h"
 #include "ds-dump-protocol.h"
+#ifdef FEATURE_GDBJIT
+#include "gdbjit.h"
+#endif
 
 #undef DS_LOG_ALWAYS_0
 #define DS_LOG_ALWAYS_0(msg) STRESS_LOG0(LF_DIAGNOSTICS_PORT, LL_ALWAYS, msg "\n")
@@ -214,6 +217,23 @@ ds_rt_generate_core_dump (DiagnosticsGenerateCoreDumpCommandPayload *payload)
 	return result;
 }
 
+/*
+* DiagnosticsProcess.
+*/
+
+static
+ds_ipc_result_t
+ds_rt_emit_jit_debug_info (void)
+{
+	STATIC_CONTRACT_NOTHROW;
+
+#ifdef FEATURE_GDBJIT
+	if (NotifyGdb::IsOnDemand ())
+		return SUCCEEDED (NotifyGdb::EmitPendingMethods ()) ? DS_IPC_S_OK : DS_IPC_E_FAIL;
+#endif
+	return DS_IPC_E_NOTSUPPORTED;
+}
+
 /*
  * DiagnosticsIpc.
  */
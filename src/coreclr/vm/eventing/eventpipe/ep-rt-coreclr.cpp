@@ -34,6 +34,14 @@ walk_managed_stack_for_threads (
 	ep_rt_thread_handle_t sampling_thread,
 	EventPipeEvent *sampling_event);
 
+#ifdef FEATURE_EVENTPIPE_ASYNC_SAMPLING
+static
+void
+write_async_samples_for_threads (
+	ep_rt_thread_handle_t sampling_thread,
+	EventPipeEvent *sampling_event);
+#endif
+
 static
 StackWalkAction
 stack_walk_callback (
@@ -137,6 +145,69 @@ walk_managed_stack_for_threads (
 	ep_stack_contents_fini (current_stack_contents);
 }
 
+#ifdef FEATURE_EVENTPIPE_ASYNC_SAMPLING
+// Samples threads without suspending the runtime. Each pass writes out the samples that
+// threads captured since the previous pass and then signals the threads that are running
+// managed code to capture new ones, so samples are written one sampling period late.
+// Threads in preemptive mode are not sampled.
+static
+void
+write_async_samples_for_threads (
+	ep_rt_thread_handle_t sampling_thread,
+	EventPipeEvent *sampling_event)
+{
+	STATIC_CONTRACT_NOTHROW;
+	EP_ASSERT (sampling_thread != NULL);
+
+	EventPipeStackContents stack_contents;
+	EventPipeStackContents *current_stack_contents;
+	current_stack_contents = ep_stack_contents_init (&stack_contents);
+
+	EP_ASSERT (current_stack_contents != NULL);
+
+	// Keeps threads from being destroyed while we look at them, without stopping them.
+	ThreadStoreLockHolder thread_store_lock;
+
+	Thread *target_thread = NULL;
+	while ((target_thread = ThreadStore::GetThreadList (target_thread)) != NULL) {
+		if (target_thread == sampling_thread)
+			continue;
+
+		Thread::AsyncSampleBuffer *buffer = target_thread->GetOrCreateAsyncSampleBuffer ();
+		if (buffer == NULL)
+			continue;
+
+		if (buffer->m_state == Thread::AsyncSampleBuffer::Ready) {
+			ep_stack_contents_reset (current_stack_contents);
+			for (DWORD i = 0; i < buffer->m_frameCount; ++i)
+				ep_stack_contents_append (current_stack_contents, buffer->m_frames [i], NULL);
+
+			// The handler only captures samples while the thread is running managed code.
+			uint32_t payload_data = EP_SAMPLE_PROFILER_SAMPLE_TYPE_MANAGED;
+
+			ep_write_sample_profile_event (
+				sampling_thread,
+				sampling_event,
+				target_thread,
+				current_stack_contents,
+				(uint8_t *)&payload_data,
+				sizeof (payload_data));
+
+			buffer->m_state = Thread::AsyncSampleBuffer::Idle;
+		}
+
+		// A request the thread did not get to (it left managed code before the signal
+		// arrived) is dropped and made again below.
+		FastInterlockCompareExchange ((LONG *)&buffer->m_state, Thread::AsyncSampleBuffer::Idle, Thread::AsyncSampleBuffer::Requested);
+
+		if (target_thread->PreemptiveGCDisabled ())
+			target_thread->RequestAsyncSample ();
+	}
+
+	ep_stack_contents_fini (current_stack_contents);
+}
+#endif // FEATURE_EVENTPIPE_ASYNC_SAMPLING
+
 void
 ep_rt_coreclr_sample_profiler_write_sampling_event_for_threads (
 	ep_rt_thread_handle_t sampling_thread,
@@ -145,6 +216,14 @@ ep_rt_coreclr_sample_profiler_write_sampling_event_for_threads (
 	STATIC_CONTRACT_NOTHROW;
 	EP_ASSERT (sampling_thread != NULL);
 
+#ifdef FEATURE_EVENTPIPE_ASYNC_SAMPLING
+	static ConfigDWORD async_sampling;
+	if (async_sampling.val (CLRConfig::INTERNAL_EventPipeAsyncSampling) != 0) {
+		write_async_samples_for_threads (sampling_thread, sampling_event);
+		return;
+	}
+#endif // FEATURE_EVENTPIPE_ASYNC_SAMPLING
+
 	// Check to see if we can suspend managed execution.
 	if (ThreadSuspend::SysIsSuspendInProgress () || (ThreadSuspend::GetSuspensionThread () != 0))
 		return;
@@ -477,7 +477,8 @@ BOOL ETW::GCLog::ShouldWalkStaticsAndCOMForEtw()
     return s_forcedGCInProgress &&
         ETW_TRACING_CATEGORY_ENABLED(MICROSOFT_WINDOWS_DOTNETRUNTIME_PROVIDER_DOTNET_Context,
                                      TRACE_LEVEL_INFORMATION,
-                                     CLR_GCHEAPDUMP_KEYWORD);
+                                     CLR_GCHEAPDUMP_KEYWORD) &&
+        !ShouldLogHeapTypeStatisticsOnlyForEtw();
 }
 
 // Simple helpers called by the GC to decide whether it needs to do a walk of heap
@@ -498,7 +499,24 @@ BOOL ETW::GCLog::ShouldWalkHeapRootsForEtw()
     return s_forcedGCInProgress &&
         ETW_TRACING_CATEGORY_ENABLED(MICROSOFT_WINDOWS_DOTNETRUNTIME_PROVIDER_DOTNET_Context,
                                      TRACE_LEVEL_INFORMATION,
-                                     CLR_GCHEAPDUMP_KEYWORD);
+                                     CLR_GCHEAPDUMP_KEYWORD) &&
+        !ShouldLogHeapTypeStatisticsOnlyForEtw();
+}
+
+// A heap dump requested with GCHeapTypeStatisticsKeyword in addition to GCHeapDumpKeyword
+// only reports the object count and size per type (GCBulkTypeStatistics), instead of
+// every node and edge. Roots are not reported, and the references of each object don't
+// need to be enumerated, which makes the walk much cheaper on large heaps.
+BOOL ETW::GCLog::ShouldLogHeapTypeStatisticsOnlyForEtw()
+{
+    LIMITED_METHOD_CONTRACT;
+    return s_forcedGCInProgress &&
+        ETW_TRACING_CATEGORY_ENABLED(MICROSOFT_WINDOWS_DOTNETRUNTIME_PROVIDER_DOTNET_Context,
+                                     TRACE_LEVEL_INFORMATION,
+                                     CLR_GCHEAPDUMP_KEYWORD) &&
+        ETW_TRACING_CATEGORY_ENABLED(MICROSOFT_WINDOWS_DOTNETRUNTIME_PROVIDER_DOTNET_Context,
+                                     TRACE_LEVEL_INFORMATION,
+                                     CLR_GCHEAPTYPESTATISTICS_KEYWORD);
 }
 
 BOOL ETW::GCLog::ShouldTrackMovementForEtw()
@@ -2016,6 +2034,49 @@ void BulkTypeEventLogger::LogTypeAndParameters(ULONGLONG thAsAddr, ETW::TypeSyst
 
 #endif // FEATURE_REDHAWK
 
+// Accumulates the per type statistics of a GCBulkTypeStatistics heap dump, keyed by TypeID
+class EtwGcTypeStatisticsTraits : public NoRemoveSHashTraits< DefaultSHashTraits<EventStructGCBulkTypeStatisticsValue> >
+{
+public:
+    typedef NoRemoveSHashTraits< DefaultSHashTraits<EventStructGCBulkTypeStatisticsValue> > PARENT;
+    typedef PARENT::element_t element_t;
+    typedef PARENT::count_t count_t;
+
+    typedef ULONGLONG key_t;
+
+    static key_t GetKey(const element_t &e)
+    {
+        LIMITED_METHOD_CONTRACT;
+        return e.TypeID;
+    }
+
+    static BOOL Equals(key_t k1, key_t k2)
+    {
+        LIMITED_METHOD_CONTRACT;
+        return (k1 == k2);
+    }
+
+    static count_t Hash(key_t k)
+    {
+        LIMITED_METHOD_CONTRACT;
+        return (count_t) (k ^ (k >> 32));
+    }
+
+    static bool IsNull(const element_t &e)
+    {
+        LIMITED_METHOD_CONTRACT;
+        return (e.TypeID == 0);
+    }
+
+    static const element_t Null()
+    {
+        LIMITED_METHOD_CONTRACT;
+        element_t e = { 0, 0, 0 };
+        return e;
+    }
+};
+typedef SHash<EtwGcTypeStatisticsTraits> EtwGcTypeStatisticsHash;
+
 // Holds state that batches of roots, nodes, edges, and types as the GC walks the heap
 // at the end of a collection.
 class EtwGcHeapDumpContext
@@ -2048,6 +2109,7 @@ public:
         iCurBulkRootConditionalWeakTableElementEdge(0),
         iCurBulkNodeEvent(0),
         iCurBulkEdgeEvent(0),
+        typeStatistics(),
         bulkTypeEventLogger()
     {
         LIMITED_METHOD_CONTRACT;
@@ -2177,6 +2239,15 @@ public:
     // limit (leaving lots of room for non-struct fields that come before the edge data)
     EventStructGCBulkEdgeValue rgGcBulkEdgeValues[(cbMaxEtwEvent - 0x100) / sizeof(EventStructGCBulkEdgeValue)];
 
+    //---------------------------------------------------------------------------------------
+    // GCBulkTypeStatistics
+    //
+    // With GCHeapTypeStatisticsKeyword no nodes or edges are sent. The objects are
+    // aggregated per type during the walk, and the totals are sent in batches at the end
+    // of the heap dump.
+    //---------------------------------------------------------------------------------------
+
+    EtwGcTypeStatisticsHash typeStatistics;
 
     //---------------------------------------------------------------------------------------
     // BulkType
@@ -2425,6 +2496,66 @@ VOID ETW::GCLog::ObjectReference(
     }
 }
 
+//---------------------------------------------------------------------------------------
+//
+// Called during a heap walk for each object when only type statistics are collected
+// (see ShouldLogHeapTypeStatisticsOnlyForEtw). Adds the object to the totals of its type
+// in the ETW context.
+//
+// Arguments:
+//      profilerWalkHeapContext - Context containing data we've batched up
+//      pObj - Object encountered in the heap walk
+//      typeID - Type of pObj
+//
+
+// static
+VOID ETW::GCLog::ObjectTypeStatistic(
+    ProfilerWalkHeapContext * profilerWalkHeapContext,
+    Object * pObj,
+    ULONGLONG typeID)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+
+        // LogTypeAndParametersIfNecessary can take a lock
+        CAN_TAKE_LOCK;
+    }
+    CONTRACTL_END;
+
+    if (typeID == 0)
+        return;
+
+    EtwGcHeapDumpContext * pContext =
+        EtwGcHeapDumpContext::GetOrCreateInGCContext(&profilerWalkHeapContext->pvEtwContext);
+    if (pContext == NULL)
+        return;
+
+    EventStructGCBulkTypeStatisticsValue * pValue =
+        const_cast<EventStructGCBulkTypeStatisticsValue *>(pContext->typeStatistics.LookupPtr(typeID));
+    if (pValue != NULL)
+    {
+        pValue->ObjectCount++;
+        pValue->TotalSize += pObj->GetSize();
+        return;
+    }
+
+    EventStructGCBulkTypeStatisticsValue value = { typeID, 1, pObj->GetSize() };
+    if (!pContext->typeStatistics.AddNoThrow(value))
+    {
+        // Out of memory, the objects of this type will be missing from the statistics
+        return;
+    }
+
+    // Types are only sent the first time they are seen, like for the GCBulkNode events
+    ETW::TypeSystemLog::LogTypeAndParametersIfNecessary(
+        &pContext->bulkTypeEventLogger,
+        typeID,
+        ETW::TypeSystemLog::kTypeLogBehaviorTakeLockAndLogIfFirstTime);
+}
+
 //---------------------------------------------------------------------------------------
 //
 // Called by GC at end of heap dump to give us a convenient time to flush any remaining
@@ -2490,6 +2621,31 @@ VOID ETW::GCLog::EndHeapDump(ProfilerWalkHeapContext * profilerWalkHeapContext)
                 sizeof(pContext->rgGcBulkEdgeValues[0]),
                 &pContext->rgGcBulkEdgeValues[0]);
         }
+
+        // The statistics are sent in batches of the same size as the nodes, reusing the
+        // node buffer which is empty for this kind of heap dump
+        if (pContext->typeStatistics.GetCount() > 0)
+        {
+            EventStructGCBulkTypeStatisticsValue * rgValues = (EventStructGCBulkTypeStatisticsValue *) &pContext->rgGcBulkNodeValues[0];
+            const UINT cMaxValues = sizeof(pContext->rgGcBulkNodeValues) / sizeof(EventStructGCBulkTypeStatisticsValue);
+            UINT iEvent = 0;
+            UINT cValues = 0;
+
+            for (EtwGcTypeStatisticsHash::Iterator iter = pContext->typeStatistics.Begin(); iter != pContext->typeStatistics.End(); ++iter)
+            {
+                rgValues[cValues++] = *iter;
+                if (cValues == cMaxValues)
+                {
+                    FireEtwGCBulkTypeStatistics(iEvent++, cValues, GetClrInstanceId(), sizeof(rgValues[0]), rgValues);
+                    cValues = 0;
+                }
+            }
+
+            if (cValues > 0)
+            {
+                FireEtwGCBulkTypeStatistics(iEvent, cValues, GetClrInstanceId(), sizeof(rgValues[0]), rgValues);
+            }
+        }
     }
 
     // Ditto for type events
@@ -5533,6 +5689,45 @@ VOID ETW::MethodLog::MethodJitting(MethodDesc *pMethodDesc, SString *namespaceOr
     } EX_CATCH { } EX_END_CATCH(SwallowAllExceptions);
 }
 
+/**********************************************************************/
+/* This is called by the JIT host when the JIT reports the statistics of a method it has compiled */
+/**********************************************************************/
+VOID ETW::MethodLog::MethodJitStatistics(MethodDesc *pMethodDesc, const JitMethodStatistics *pStats)
+{
+    CONTRACTL {
+        NOTHROW;
+        GC_NOTRIGGER;
+        PRECONDITION(pStats != NULL);
+    } CONTRACTL_END;
+
+    if (ETW_EVENT_ENABLED(MICROSOFT_WINDOWS_DOTNETRUNTIME_PROVIDER_DOTNET_Context, MethodJitStatistics))
+    {
+        ULONGLONG ullModuleID = 0;
+        if (pMethodDesc != NULL)
+        {
+            ullModuleID = (ULONGLONG)(TADDR)pMethodDesc->GetModule_NoLogging();
+        }
+
+        static_assert_no_msg(sizeof(unsigned long long) == sizeof(ULONGLONG));
+        const USHORT cPhases = (USHORT)min(pStats->phaseCount, (unsigned)USHRT_MAX);
+
+        FireEtwMethodJitStatistics(
+            (ULONGLONG)pMethodDesc,
+            ullModuleID,
+            pStats->ilCodeSize,
+            pStats->nativeCodeSize,
+            pStats->totalTime,
+            pStats->arenaBytesAllocated,
+            pStats->arenaBytesUsed,
+            pStats->inlineCandidates,
+            pStats->inlineSuccesses,
+            cPhases,
+            pStats->phaseIds,
+            (const ULONGLONG*)pStats->phaseTimes,
+            GetClrInstanceId());
+    }
+}
+
 /**********************************************************************/
 /* This is called by the runtime when a single jit helper method with stub is initialized */
 /**********************************************************************/
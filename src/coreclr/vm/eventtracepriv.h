@@ -61,6 +61,13 @@ struct EventStructGCBulkNodeValue
     ULONGLONG EdgeCount;
 };
 
+struct EventStructGCBulkTypeStatisticsValue
+{
+    ULONGLONG TypeID;
+    ULONGLONG ObjectCount;
+    ULONGLONG TotalSize;
+};
+
 struct EventStructGCBulkEdgeValue
 {
     LPVOID Value;
@@ -3254,7 +3254,12 @@ void StackTraceInfo::FreeStackTrace()
 
     if (m_pStackTrace)
     {
-        delete [] m_pStackTrace;
+        // Hand the buffer to the current thread for its next exception
+        Thread * pThread = GetThreadNULLOk();
+        if (pThread == NULL || !pThread->CacheStackTrace(m_pStackTrace, m_cStackTrace))
+        {
+            delete [] m_pStackTrace;
+        }
         m_pStackTrace = NULL;
         m_cStackTrace = 0;
         m_dFrameCount = 0;
@@ -3297,9 +3302,22 @@ void StackTraceInfo::AllocateStackTrace()
         unsigned int allocSize = 30;
 #endif
 
-        SCAN_IGNORE_FAULT; // A fault of new is okay here. The rest of the system is cool if we don't have enough
-                           // memory to remember the stack as we run our first pass.
-        m_pStackTrace = new (nothrow) StackTraceElement[allocSize];
+        // Reuse the buffer of the last exception dispatched on this thread, if there is one.
+        Thread * pThread = GetThreadNULLOk();
+        unsigned cCached = 0;
+        StackTraceElement * pCached = (pThread != NULL) ? pThread->TakeCachedStackTrace(&cCached) : NULL;
+
+        if (pCached != NULL)
+        {
+            m_pStackTrace = pCached;
+            allocSize = cCached;
+        }
+        else
+        {
+            SCAN_IGNORE_FAULT; // A fault of new is okay here. The rest of the system is cool if we don't have enough
+                               // memory to remember the stack as we run our first pass.
+            m_pStackTrace = new (nothrow) StackTraceElement[allocSize];
+        }
 
         if (m_pStackTrace != NULL)
         {
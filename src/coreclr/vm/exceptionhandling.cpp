@@ -13,6 +13,7 @@
 #include "eetoprofinterfacewrapper.inl"
 #include "eedbginterfaceimpl.inl"
 #include "eventtrace.h"
+#include "runtimeprobes.h"
 #include "virtualcallstub.h"
 #include "utilcode.h"
 
@@ -195,10 +196,40 @@ static inline void UpdatePerformanceMetrics(CrawlFrame *pcfThisFrame, BOOL bIsRe
     WRAPPER_NO_CONTRACT;
     g_exceptionCount++;
 
+    RUNTIME_PROBE3(exception_throw,
+                   OBJECTREFToObject(pcfThisFrame->GetThread()->GetThrowable()),
+                   pcfThisFrame->GetFunction(),
+                   bIsRethrownException);
+
     // Fire an exception thrown ETW event when an exception occurs
     ETW::ExceptionLog::ExceptionThrown(pcfThisFrame, bIsRethrownException, bIsNewException);
 }
 
+// Initialize the code info of a frame being dispatched through, using the thread's
+// cache of code lookups when it has one. Exceptions thrown for control flow tend to
+// repeat the same frames, see code:EECodeInfoCache.
+static inline void InitCodeInfoForDispatch(EECodeInfo* pCodeInfo, PCODE controlPc)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+    }
+    CONTRACTL_END;
+
+    Thread* pThread = GetThreadNULLOk();
+    EECodeInfoCache* pCache = (pThread != NULL) ? pThread->GetEECodeInfoCache() : NULL;
+
+    if (pCache != NULL)
+    {
+        pCache->Init(controlPc, pCodeInfo);
+    }
+    else
+    {
+        pCodeInfo->Init(controlPc);
+    }
+}
+
 #ifdef TARGET_UNIX
 static LONG volatile g_termination_triggered = 0;
 
@@ -1534,7 +1565,7 @@ void ExceptionTracker::InitializeCrawlFrame(CrawlFrame* pcfThisFrame, Thread* pT
     }
 #endif // ADJUST_PC_UNWOUND_TO_CALL
 
-    pcfThisFrame->codeInfo.Init(ControlPCForEHSearch);
+    InitCodeInfoForDispatch(&pcfThisFrame->codeInfo, ControlPCForEHSearch);
 
     if (pcfThisFrame->codeInfo.IsValid())
     {
@@ -4308,6 +4339,55 @@ static void DoEHLog(
 
 #ifdef TARGET_UNIX
 
+//---------------------------------------------------------------------------------------
+//
+// Unwinds a managed frame in place for the dispatch loops below, when the frame is stopped at a call site.
+// Such frames are unwound straight from their unwind codes, see Thread::VirtualUnwindCallSiteFrame. The
+// integer registers it restores are all the nonvolatile state there is on Unix, so the result is the same
+// as that of RtlVirtualUnwind. Returns false if the frame needs the full unwind.
+//
+// Arguments:
+//      pContext           - the context of the frame, updated to the caller's context on success
+//      pScratchContext    - storage for the caller's context while it is being computed
+//      pCodeInfo          - the code info of the frame
+//      pEstablisherFrame  - receives the establisher frame of the frame
+//
+static bool VirtualUnwindCallSiteFrameForDispatch(CONTEXT* pContext, CONTEXT* pScratchContext, EECodeInfo* pCodeInfo, UINT_PTR* pEstablisherFrame)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+    }
+    CONTRACTL_END;
+
+#ifdef TARGET_AMD64
+    // The frame that caused a hardware exception can be anywhere in its body, including an epilog
+    if ((pContext->ContextFlags & CONTEXT_EXCEPTION_ACTIVE) != 0)
+    {
+        return false;
+    }
+
+    KNONVOLATILE_CONTEXT_POINTERS contextPointers;
+    KNONVOLATILE_CONTEXT_POINTERS callerContextPointers;
+    memset(&contextPointers, 0, sizeof(contextPointers));
+
+    TADDR establisherFrame;
+    if (!Thread::VirtualUnwindCallSiteFrame(pContext, &contextPointers, pScratchContext, &callerContextPointers, pCodeInfo, &establisherFrame))
+    {
+        return false;
+    }
+
+    pContext->ContextFlags = pScratchContext->ContextFlags;
+    memcpy(&pContext->Rax, &pScratchContext->Rax, offsetof(CONTEXT, Rip) + sizeof(pContext->Rip) - offsetof(CONTEXT, Rax));
+    *pEstablisherFrame = establisherFrame;
+
+    return true;
+#else // TARGET_AMD64
+    return false;
+#endif // TARGET_AMD64
+}
+
 //---------------------------------------------------------------------------------------
 //
 // This functions performs an unwind procedure for a managed exception. The stack is unwound
@@ -4328,6 +4408,7 @@ VOID UnwindManagedExceptionPass2(PAL_SEHException& ex, CONTEXT* unwindStartConte
     CONTEXT* currentFrameContext;
     CONTEXT* callerFrameContext;
     CONTEXT contextStorage;
+    CONTEXT scratchContext;
     DISPATCHER_CONTEXT dispatcherContext;
     EECodeInfo codeInfo;
     UINT_PTR establisherFrame = NULL;
@@ -4346,7 +4427,7 @@ VOID UnwindManagedExceptionPass2(PAL_SEHException& ex, CONTEXT* unwindStartConte
     {
         controlPc = GetIP(currentFrameContext);
 
-        codeInfo.Init(controlPc);
+        InitCodeInfoForDispatch(&codeInfo, controlPc);
 
         dispatcherContext.FunctionEntry = codeInfo.GetFunctionEntry();
         dispatcherContext.ControlPc = controlPc;
@@ -4361,14 +4442,17 @@ VOID UnwindManagedExceptionPass2(PAL_SEHException& ex, CONTEXT* unwindStartConte
             // Create a copy of the current context because we don't want
             // the current context record to be updated by RtlVirtualUnwind.
             memcpy(callerFrameContext, currentFrameContext, sizeof(CONTEXT));
-            RtlVirtualUnwind(UNW_FLAG_EHANDLER,
-                dispatcherContext.ImageBase,
-                dispatcherContext.ControlPc,
-                dispatcherContext.FunctionEntry,
-                callerFrameContext,
-                &handlerData,
-                &establisherFrame,
-                NULL);
+            if (!VirtualUnwindCallSiteFrameForDispatch(callerFrameContext, &scratchContext, &codeInfo, &establisherFrame))
+            {
+                RtlVirtualUnwind(UNW_FLAG_EHANDLER,
+                    dispatcherContext.ImageBase,
+                    dispatcherContext.ControlPc,
+                    dispatcherContext.FunctionEntry,
+                    callerFrameContext,
+                    &handlerData,
+                    &establisherFrame,
+                    NULL);
+            }
 
             // Make sure that the establisher frame pointer is within stack boundaries
             // and we did not go below that target frame.
@@ -4469,6 +4553,7 @@ VOID UnwindManagedExceptionPass2(PAL_SEHException& ex, CONTEXT* unwindStartConte
 VOID DECLSPEC_NORETURN UnwindManagedExceptionPass1(PAL_SEHException& ex, CONTEXT* frameContext)
 {
     CONTEXT unwindStartContext;
+    CONTEXT scratchContext;
     EXCEPTION_DISPOSITION disposition;
     DISPATCHER_CONTEXT dispatcherContext;
     EECodeInfo codeInfo;
@@ -4498,7 +4583,7 @@ VOID DECLSPEC_NORETURN UnwindManagedExceptionPass1(PAL_SEHException& ex, CONTEXT
 
     do
     {
-        codeInfo.Init(controlPc);
+        InitCodeInfoForDispatch(&codeInfo, controlPc);
         dispatcherContext.FunctionEntry = codeInfo.GetFunctionEntry();
         dispatcherContext.ControlPc = controlPc;
         dispatcherContext.ImageBase = codeInfo.GetModuleBase();
@@ -4516,14 +4601,17 @@ VOID DECLSPEC_NORETURN UnwindManagedExceptionPass1(PAL_SEHException& ex, CONTEXT
             CaptureNonvolatileRegisters(&currentNonVolatileContext, frameContext);
 #endif // USE_CURRENT_CONTEXT_IN_FILTER
 
-            RtlVirtualUnwind(UNW_FLAG_EHANDLER,
-                dispatcherContext.ImageBase,
-                dispatcherContext.ControlPc,
-                dispatcherContext.FunctionEntry,
-                frameContext,
-                &handlerData,
-                &establisherFrame,
-                NULL);
+            if (!VirtualUnwindCallSiteFrameForDispatch(frameContext, &scratchContext, &codeInfo, &establisherFrame))
+            {
+                RtlVirtualUnwind(UNW_FLAG_EHANDLER,
+                    dispatcherContext.ImageBase,
+                    dispatcherContext.ControlPc,
+                    dispatcherContext.FunctionEntry,
+                    frameContext,
+                    &handlerData,
+                    &establisherFrame,
+                    NULL);
+            }
 
             // Make sure that the establisher frame pointer is within stack boundaries.
             // TODO: make sure the establisher frame is properly aligned.
@@ -31,6 +31,27 @@ CLREvent * FinalizerThread::hEventFinalizerToShutDown = NULL;
 
 HANDLE FinalizerThread::MHandles[kHandleCount];
 
+// Number of objects a thread takes off the finalization queue at once while the
+// helper threads are draining it
+#define FINALIZER_BATCH_SIZE 64
+
+// The helper threads are only woken up for queues of at least this many objects
+#define FINALIZER_PARALLEL_THRESHOLD (4 * FINALIZER_BATCH_SIZE)
+
+#define MAX_FINALIZER_HELPER_THREADS 64
+
+extern VersionInfo g_gc_version_info;
+
+DWORD FinalizerThread::cHelperThreads = 0;
+CLREvent * FinalizerThread::hEventHelpersIdle = NULL;
+LONG FinalizerThread::fParallelDrain = FALSE;
+LONG FinalizerThread::cActiveHelpers = 0;
+LONG FinalizerThread::cHelperFinalized = 0;
+
+// The event a finalizer helper thread waits on for the next parallel drain
+static thread_local CLREvent* t_pHelperStartEvent = NULL;
+static CLREvent * s_helperStartEvents = NULL;
+
 BOOL FinalizerThread::IsCurrentThreadFinalizer()
 {
     LIMITED_METHOD_CONTRACT;
@@ -38,6 +59,13 @@ BOOL FinalizerThread::IsCurrentThreadFinalizer()
     return GetThreadNULLOk() == g_pFinalizerThread;
 }
 
+BOOL FinalizerThread::IsCurrentThreadFinalizerHelper()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    return t_pHelperStartEvent != NULL;
+}
+
 void FinalizerThread::EnableFinalization()
 {
     WRAPPER_NO_CONTRACT;
@@ -88,10 +116,17 @@ void FinalizerThread::FinalizeAllObjects()
     STATIC_CONTRACT_GC_TRIGGERS;
     STATIC_CONTRACT_MODE_COOPERATIVE;
 
-    FireEtwGCFinalizersBegin_V1(GetClrInstanceId());
+    size_t queueLength = GCHeapUtilities::GetGCHeap()->GetNumberOfFinalizable();
+    FireEtwGCFinalizersBegin_V2(GetClrInstanceId(), (UINT32)min(queueLength, (size_t)UINT32_MAX), (USHORT)cHelperThreads);
 
     unsigned int fcount = 0;
 
+    if (cHelperThreads != 0 && queueLength >= FINALIZER_PARALLEL_THRESHOLD)
+    {
+        fcount += FinalizeInParallel();
+    }
+
+    // Whatever is left, including all the objects with a critical finalizer, is run here
     Object* fobj = GCHeapUtilities::GetGCHeap()->GetNextFinalizable();
 
     Thread *pThread = GetThread();
@@ -114,6 +149,99 @@ void FinalizerThread::FinalizeAllObjects()
     FireEtwGCFinalizersEnd_V1(fcount, GetClrInstanceId());
 }
 
+// Runs the non critical finalizers on this thread and on the helper threads until no such
+// object is left on the queue. The objects with a critical finalizer are left on the queue
+// and since this only returns once every helper is done, they still run after the other
+// finalizers, as they do when the finalizer thread is on its own.
+// Returns the number of objects that were finalized.
+unsigned int FinalizerThread::FinalizeInParallel()
+{
+    STATIC_CONTRACT_THROWS;
+    STATIC_CONTRACT_GC_TRIGGERS;
+    STATIC_CONTRACT_MODE_COOPERATIVE;
+
+    _ASSERTE(IsCurrentThreadFinalizer());
+
+    FastInterlockExchange(&fParallelDrain, TRUE);
+    for (DWORD i = 0; i < cHelperThreads; i++)
+    {
+        s_helperStartEvents[i].Set();
+    }
+
+    unsigned int fcount = FinalizeBatches();
+
+    // A helper checks fParallelDrain after it has counted itself as active, so once this is
+    // cleared no helper that isn't counted yet starts running finalizers.
+    FastInterlockExchange(&fParallelDrain, FALSE);
+
+    {
+        GCX_PREEMP();
+        while (VolatileLoad(&cActiveHelpers) != 0)
+        {
+            hEventHelpersIdle->Wait(INFINITE, FALSE);
+        }
+    }
+
+    fcount += (unsigned int)FastInterlockExchange(&cHelperFinalized, 0);
+
+    STRESS_LOG1(LF_GC, LL_INFO100, "Finalized %u objects in parallel\n", fcount);
+    return fcount;
+}
+
+// Takes batches of objects without a critical finalizer off the queue and runs their
+// finalizers until the queue has none left or the parallel drain is over.
+unsigned int FinalizerThread::FinalizeBatches()
+{
+    STATIC_CONTRACT_THROWS;
+    STATIC_CONTRACT_GC_TRIGGERS;
+    STATIC_CONTRACT_MODE_COOPERATIVE;
+
+    Thread *pThread = GetThread();
+    unsigned int fcount = 0;
+
+    Object* objects[FINALIZER_BATCH_SIZE];
+    OBJECTREF batch[FINALIZER_BATCH_SIZE];
+    for (int i = 0; i < FINALIZER_BATCH_SIZE; i++)
+    {
+        batch[i] = NULL;
+    }
+
+    // The objects are off the queue once they are in the batch, so the batch has
+    // to keep the ones that are still waiting alive while the others are finalized.
+    GCPROTECT_ARRAY_BEGIN(batch[0], FINALIZER_BATCH_SIZE);
+
+    while (VolatileLoad(&fParallelDrain) && !fQuitFinalizer)
+    {
+        size_t count = GCHeapUtilities::GetGCHeap()->GetNextFinalizableBatch(objects, FINALIZER_BATCH_SIZE);
+        if (count == 0)
+        {
+            break;
+        }
+
+        for (size_t i = 0; i < count; i++)
+        {
+            batch[i] = ObjectToOBJECTREF(objects[i]);
+        }
+
+        for (size_t i = 0; i < count; i++)
+        {
+            OBJECTREF fobj = batch[i];
+            batch[i] = NULL;
+
+            CallFinalizer(OBJECTREFToObject(fobj));
+            fcount++;
+
+            _ASSERTE(!pThread->IsAbortRequested());
+
+            pThread->InternalReset();
+        }
+    }
+
+    GCPROTECT_END();
+
+    return fcount;
+}
+
 void FinalizerThread::WaitForFinalizerEvent (CLREvent *event)
 {
     // Non-host environment
@@ -411,6 +539,100 @@ DWORD WINAPI FinalizerThread::FinalizerThreadStart(void *args)
     return 0;
 }
 
+VOID FinalizerThread::FinalizerHelperThreadWorker(void *args)
+{
+    SCAN_IGNORE_THROW;
+    SCAN_IGNORE_TRIGGER;
+
+    while (!fQuitFinalizer)
+    {
+        {
+            GCX_PREEMP();
+            t_pHelperStartEvent->Wait(INFINITE, FALSE);
+        }
+
+        // See FinalizeInParallel for why this is counted before fParallelDrain is read.
+        // A helper that wakes up late for a drain that is already over gets nothing to do.
+        FastInterlockIncrement(&cActiveHelpers);
+
+        if (VolatileLoad(&fParallelDrain))
+        {
+            unsigned int fcount = FinalizeBatches();
+            FastInterlockExchangeAdd(&cHelperFinalized, (LONG)fcount);
+        }
+
+        if (FastInterlockDecrement(&cActiveHelpers) == 0)
+        {
+            hEventHelpersIdle->Set();
+        }
+    }
+}
+
+DWORD WINAPI FinalizerThread::FinalizerHelperThreadStart(void *args)
+{
+    ClrFlsSetThreadType (ThreadType_Finalizer);
+
+    SCAN_IGNORE_THROW;
+    SCAN_IGNORE_TRIGGER;
+
+    Thread *pThread = GetThread();
+    t_pHelperStartEvent = (CLREvent *)args;
+
+    if (pThread->HasStarted())
+    {
+        INSTALL_UNHANDLED_MANAGED_EXCEPTION_TRAP;
+        {
+            while (!fQuitFinalizer)
+            {
+                // Same policy for exceptions as on the finalizer thread
+                ManagedThreadBase::FinalizerBase(FinalizerHelperThreadWorker);
+            }
+        }
+        UNINSTALL_UNHANDLED_MANAGED_EXCEPTION_TRAP;
+
+        // Like the finalizer thread, stay around in preemptive mode once asked to quit
+        pThread->EnablePreemptiveGC();
+        while (1)
+        {
+            __SwitchToThread(INFINITE, CALLER_LIMITS_SPINNING);
+        }
+    }
+
+    return 0;
+}
+
+void FinalizerThread::CreateHelperThreads(DWORD count)
+{
+    CONTRACTL{
+        THROWS;
+        GC_TRIGGERS;
+        MODE_ANY;
+    } CONTRACTL_END;
+
+    hEventHelpersIdle = new CLREvent();
+    hEventHelpersIdle->CreateAutoEvent(FALSE);
+
+    s_helperStartEvents = new CLREvent[count];
+
+    for (DWORD i = 0; i < count; i++)
+    {
+        s_helperStartEvents[i].CreateAutoEvent(FALSE);
+
+        Thread *pHelperThread = SetupUnstartedThread();
+        pHelperThread->SetBackground(TRUE);
+
+        if (!pHelperThread->CreateNewThread(0, &FinalizerHelperThreadStart, &s_helperStartEvents[i], W(".NET Finalizer Helper")))
+        {
+            // Run with the helpers that could be started
+            pHelperThread->DecExternalCount(FALSE);
+            break;
+        }
+
+        pHelperThread->StartThread();
+        cHelperThreads++;
+    }
+}
+
 void FinalizerThread::FinalizerThreadCreate()
 {
     CONTRACTL{
@@ -456,6 +678,13 @@ void FinalizerThread::FinalizerThreadCreate()
         // and the moment we execute the test below.
         _ASSERTE(dwRet == 1 || dwRet == 2);
     }
+
+    // GetNextFinalizableBatch was added in minor version 5 of the GC interface
+    DWORD cThreads = CLRConfig::GetConfigValue(CLRConfig::EXTERNAL_FinalizerThreadCount);
+    if (cThreads > 1 && g_gc_version_info.MinorVersion >= 5)
+    {
+        CreateHelperThreads(min(cThreads - 1, (DWORD)MAX_FINALIZER_HELPER_THREADS));
+    }
 }
 
 void FinalizerThread::SignalFinalizationDone(BOOL fFinalizer)
@@ -477,7 +706,7 @@ void FinalizerThread::FinalizerThreadWait(DWORD timeout)
     ASSERT(GetFinalizerThread());
 
     // Can't call this from within a finalized method.
-    if (!IsCurrentThreadFinalizer())
+    if (!IsCurrentThreadFinalizer() && !IsCurrentThreadFinalizerHelper())
     {
 #ifdef FEATURE_COMINTEROP
         // To help combat finalizer thread starvation, we check to see if there are any wrappers
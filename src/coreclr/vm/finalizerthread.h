@@ -34,6 +34,18 @@ class FinalizerThread
 
     static void FinalizeAllObjects();
 
+    // Threads that run non critical finalizers together with the finalizer thread
+    // when the queue builds up, see code:FinalizerThread::FinalizeInParallel
+    static DWORD cHelperThreads;
+    static CLREvent *hEventHelpersIdle;
+    static LONG fParallelDrain;
+    static LONG cActiveHelpers;
+    static LONG cHelperFinalized;
+
+    static void CreateHelperThreads(DWORD count);
+    static unsigned int FinalizeInParallel();
+    static unsigned int FinalizeBatches();
+
 public:
     static Thread* GetFinalizerThread()
     {
@@ -73,6 +85,10 @@ public:
     static VOID FinalizerThreadWorker(void *args);
     static DWORD WINAPI FinalizerThreadStart(void *args);
 
+    static BOOL IsCurrentThreadFinalizerHelper();
+    static VOID FinalizerHelperThreadWorker(void *args);
+    static DWORD WINAPI FinalizerHelperThreadStart(void *args);
+
     static void FinalizerThreadCreate();
 };
 
@@ -0,0 +1,201 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+//
+// File: frozenobjectheap.cpp
+//
+
+#include "common.h"
+#include "frozenobjectheap.h"
+
+// Size of the reservation for each segment
+#define FOH_SEGMENT_SIZE (4 * 1024 * 1024)
+
+// Granularity of the commits within a segment
+#define FOH_COMMIT_SIZE (64 * 1024)
+
+// Larger objects go to the GC heap, they would waste the rest of the segment
+#define FOH_MAX_OBJECT_SIZE (FOH_COMMIT_SIZE / 2)
+
+extern VersionInfo g_gc_version_info;
+
+FrozenObjectHeapManager::FrozenObjectHeapManager()
+    : m_Crst(CrstFrozenObjectHeap, CRST_UNSAFE_ANYMODE)
+    , m_CurrentSegment(NULL)
+    , m_Disabled(false)
+{
+    WRAPPER_NO_CONTRACT;
+
+    // UpdateFrozenSegment was added in minor version 3 of the GC interface
+    if (!CLRConfig::GetConfigValue(CLRConfig::INTERNAL_FrozenObjectHeap) || g_gc_version_info.MinorVersion < 3)
+    {
+        m_Disabled = true;
+    }
+}
+
+Object* FrozenObjectHeapManager::TryAllocateObject(PTR_MethodTable type, size_t objectSize)
+{
+    CONTRACTL
+    {
+        THROWS;
+        GC_NOTRIGGER;
+        MODE_COOPERATIVE;
+        PRECONDITION(CheckPointer(type));
+        PRECONDITION(!type->ContainsPointers());
+        PRECONDITION(!type->HasFinalizer());
+        PRECONDITION(!type->Collectible());
+    }
+    CONTRACTL_END;
+
+#ifndef FEATURE_BASICFREEZE
+    return NULL;
+#else
+    if (m_Disabled)
+        return NULL;
+
+    objectSize = ALIGN_UP(objectSize, DATA_ALIGNMENT);
+    if (objectSize > FOH_MAX_OBJECT_SIZE)
+        return NULL;
+
+    CrstHolder ch(&m_Crst);
+
+    Object* obj = NULL;
+    if (m_CurrentSegment != NULL)
+    {
+        obj = m_CurrentSegment->TryAllocateObject(type, objectSize);
+    }
+
+    if (obj == NULL && !m_Disabled)
+    {
+        // The current segment is full (or there is none yet), the old one stays registered with the GC
+        NewHolder<FrozenObjectSegment> pSegment(new FrozenObjectSegment());
+        if (!pSegment->Initialize())
+        {
+            // Out of address space, or the GC refused the segment. Don't try again on every allocation.
+            m_Disabled = true;
+            return NULL;
+        }
+
+        m_CurrentSegment = pSegment.Extract();
+        obj = m_CurrentSegment->TryAllocateObject(type, objectSize);
+    }
+
+    return obj;
+#endif // FEATURE_BASICFREEZE
+}
+
+STRINGREF FrozenObjectHeapManager::TryAllocateString(LPCWSTR pChars, DWORD cchChars)
+{
+    CONTRACTL
+    {
+        THROWS;
+        GC_NOTRIGGER;
+        MODE_COOPERATIVE;
+    }
+    CONTRACTL_END;
+
+    StringObject* orString = (StringObject*)TryAllocateObject(g_pStringClass, StringObject::GetSize(cchChars));
+    if (orString == NULL)
+        return NULL;
+
+    // The terminating null is already there, the memory was committed zeroed
+    orString->SetStringLength(cchChars);
+    memcpyNoGCRefs(orString->GetBuffer(), pChars, cchChars * sizeof(WCHAR));
+
+    return ObjectToSTRINGREF(orString);
+}
+
+FrozenObjectSegment::FrozenObjectSegment()
+    : m_pStart(NULL)
+    , m_pCurrent(NULL)
+    , m_SizeCommitted(0)
+    , m_SegmentHandle(NULL)
+{
+    LIMITED_METHOD_CONTRACT;
+}
+
+FrozenObjectSegment::~FrozenObjectSegment()
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+    }
+    CONTRACTL_END;
+
+    // Only reached when the segment could not be registered, registered segments live forever
+    _ASSERTE(m_SegmentHandle == NULL);
+
+    if (m_pStart != NULL)
+    {
+        ClrVirtualFree(m_pStart, 0, MEM_RELEASE);
+    }
+}
+
+bool FrozenObjectSegment::Initialize()
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_COOPERATIVE;
+    }
+    CONTRACTL_END;
+
+    m_pStart = (uint8_t*)ClrVirtualAlloc(NULL, FOH_SEGMENT_SIZE, MEM_RESERVE, PAGE_NOACCESS);
+    if (m_pStart == NULL)
+        return false;
+
+    if (ClrVirtualAlloc(m_pStart, FOH_COMMIT_SIZE, MEM_COMMIT, PAGE_READWRITE) == NULL)
+        return false;
+
+    m_SizeCommitted = FOH_COMMIT_SIZE;
+
+    // The first object starts after its header, the segment is empty until the first allocation
+    m_pCurrent = m_pStart + sizeof(ObjHeader);
+
+    segment_info si;
+    si.pvMem = m_pStart;
+    si.ibFirstObject = sizeof(ObjHeader);
+    si.ibAllocated = si.ibFirstObject;
+    si.ibCommit = m_SizeCommitted;
+    si.ibReserved = FOH_SEGMENT_SIZE;
+
+    m_SegmentHandle = GCHeapUtilities::GetGCHeap()->RegisterFrozenSegment(&si);
+    return m_SegmentHandle != NULL;
+}
+
+Object* FrozenObjectSegment::TryAllocateObject(PTR_MethodTable type, size_t objectSize)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_COOPERATIVE;
+    }
+    CONTRACTL_END;
+
+    _ASSERTE(m_SegmentHandle != NULL);
+
+    // The object size covers the header of the next object
+    size_t spaceUsed = (size_t)(m_pCurrent - m_pStart);
+    if (spaceUsed + objectSize > FOH_SEGMENT_SIZE)
+        return NULL;
+
+    if (spaceUsed + objectSize > m_SizeCommitted)
+    {
+        _ASSERTE(m_SizeCommitted + FOH_COMMIT_SIZE <= FOH_SEGMENT_SIZE);
+        if (ClrVirtualAlloc(m_pStart + m_SizeCommitted, FOH_COMMIT_SIZE, MEM_COMMIT, PAGE_READWRITE) == NULL)
+            return NULL;
+
+        m_SizeCommitted += FOH_COMMIT_SIZE;
+    }
+
+    Object* obj = (Object*)m_pCurrent;
+    obj->SetMethodTable(type);
+    m_pCurrent += objectSize;
+
+    // Publish the method table before the GC can walk the object
+    GCHeapUtilities::GetGCHeap()->UpdateFrozenSegment(m_SegmentHandle, m_pCurrent, m_pStart + m_SizeCommitted);
+
+    return obj;
+}
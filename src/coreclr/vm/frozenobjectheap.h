@@ -0,0 +1,57 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+//
+// File: frozenobjectheap.h
+//
+// Frozen object heap: objects that live for the whole process and never point into the GC heap are
+// allocated into segments that are registered with the GC as read only (FEATURE_BASICFREEZE). The GC
+// neither collects nor scans them, so they cost nothing after startup.
+//
+// Only objects without GC references are allowed, the GC does not track stores into frozen objects.
+// The memory is never released, do not allocate anything owned by a collectible loader allocator here.
+//
+
+#ifndef _FROZENOBJECTHEAP_H_
+#define _FROZENOBJECTHEAP_H_
+
+#include "gcinterface.h"
+
+class FrozenObjectSegment;
+
+class FrozenObjectHeapManager
+{
+public:
+    FrozenObjectHeapManager();
+
+    // Returns NULL if the object can't be allocated on the frozen heap, the caller then allocates it on the
+    // GC heap. The object is zero initialized apart from its method table.
+    Object* TryAllocateObject(PTR_MethodTable type, size_t objectSize);
+
+    // Allocates a string with the given characters, or returns NULL like TryAllocateObject.
+    STRINGREF TryAllocateString(LPCWSTR pChars, DWORD cchChars);
+
+private:
+    Crst m_Crst;
+    FrozenObjectSegment* m_CurrentSegment;
+
+    // Set when the GC can't host frozen segments that grow, e.g. a standalone GC that predates it.
+    bool m_Disabled;
+};
+
+class FrozenObjectSegment
+{
+public:
+    FrozenObjectSegment();
+    ~FrozenObjectSegment();
+
+    bool Initialize();
+    Object* TryAllocateObject(PTR_MethodTable type, size_t objectSize);
+
+private:
+    uint8_t* m_pStart;
+    uint8_t* m_pCurrent;
+    size_t m_SizeCommitted;
+    segment_handle m_SegmentHandle;
+};
+
+#endif // _FROZENOBJECTHEAP_H_
@@ -11,6 +11,9 @@
  */
 
 #include "gcrefmap.h"
+#include "runtimeprobes.h"
+
+extern VersionInfo g_gc_version_info;
 
 void GCToEEInterface::SuspendEE(SUSPEND_REASON reason)
 {
@@ -144,6 +147,10 @@ static void ScanStackRoots(Thread * pThread, promote_func* fn, ScanContext* sc)
 #if defined(FEATURE_EH_FUNCLETS)
         flagsStackWalk |= GC_FUNCLET_REFERENCE_REPORTING;
 #endif // defined(FEATURE_EH_FUNCLETS)
+        if (!g_pConfig->DisableCallSiteUnwind())
+        {
+            flagsStackWalk |= CALL_SITE_UNWIND;
+        }
         pThread->StackWalkFrames( GcStackCrawlCallBack, &gcctx, flagsStackWalk);
     }
 
@@ -276,6 +283,8 @@ void GCToEEInterface::GcStartWork (int condemned, int max_gen)
     }
     CONTRACTL_END;
 
+    RUNTIME_PROBE2(gc_start, GCHeapUtilities::GetGCHeap()->GetGcCount(), condemned);
+
 #ifdef VERIFY_HEAP
     // Validate byrefs pinned by IL stubs since the last GC.
     StubHelpers::ProcessByrefValidationList();
@@ -309,6 +318,8 @@ void GCToEEInterface::GcDone(int condemned)
 #ifdef FEATURE_COMINTEROP
     Interop::OnGCFinished(condemned);
 #endif // FEATURE_COMINTEROP
+
+    RUNTIME_PROBE2(gc_end, GCHeapUtilities::GetGCHeap()->GetGcCount(), condemned);
 }
 
 bool GCToEEInterface::RefCountedHandleCallbacks(Object * pObject)
@@ -1020,6 +1031,13 @@ void GCToEEInterface::StompWriteBarrier(WriteBarrierParameters* args)
         g_card_bundle_table = args->card_bundle_table;
 #endif
 
+        // A GC from before minor version 4 doesn't fill in the region fields at all.
+        if (g_gc_version_info.MinorVersion >= 4 && args->region_to_generation_table != nullptr)
+        {
+            g_region_to_generation_table = args->region_to_generation_table;
+            g_region_shr = args->region_shr;
+        }
+
         g_lowest_address = args->lowest_address;
         g_highest_address = args->highest_address;
         stompWBCompleteActions |= ::StompWriteBarrierResize(true, false);
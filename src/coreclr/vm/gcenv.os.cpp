@@ -458,6 +458,26 @@ bool GCToOSInterface::VirtualReset(void * address, size_t size, bool unlock)
     return success;
 }
 
+// Ask for a virtual memory range to be backed by large pages where the OS can do that
+// without committing up front. This is only a hint, the range keeps working with normal
+// pages if no large pages are available.
+// Parameters:
+//  address - starting virtual address
+//  size    - size of the virtual memory range
+// Return:
+//  true if the OS accepted the hint, false otherwise
+bool GCToOSInterface::VirtualPreferLargePages(void* address, size_t size)
+{
+    LIMITED_METHOD_CONTRACT;
+
+#ifdef TARGET_UNIX
+    return PAL_VirtualPreferLargePages(address, size) != FALSE;
+#else
+    // Windows has no way to do this for memory that is committed piecemeal
+    return false;
+#endif
+}
+
 // Check if the OS supports write watching
 bool GCToOSInterface::SupportsWriteWatch()
 {
@@ -775,6 +795,19 @@ size_t GCToOSInterface::GetVirtualMemoryLimit()
 
 static size_t g_RestrictedPhysicalMemoryLimit = (size_t)MAX_PTR;
 
+// Discard the cached processor count and memory limit
+void GCToOSInterface::RefreshResourceLimits()
+{
+    LIMITED_METHOD_CONTRACT;
+
+#ifdef TARGET_UNIX
+    PAL_RefreshCGroup();
+#endif // TARGET_UNIX
+
+    ResetCurrentProcessCpuCount();
+    VolatileStore(&g_RestrictedPhysicalMemoryLimit, (size_t)MAX_PTR);
+}
+
 #ifndef TARGET_UNIX
 
 static size_t GetRestrictedPhysicalMemoryLimit()
@@ -912,6 +945,33 @@ uint64_t GCToOSInterface::GetPhysicalMemoryLimit(bool* is_restricted)
     return memStatus.ullTotalPhys;
 }
 
+// Get the memory pressure the OS reports for the process
+// Parameters:
+//  stall_some - Hundredths of a percent of recent time in which some tasks were stalled waiting on memory.
+//  stall_full - Hundredths of a percent of recent time in which all non-idle tasks were stalled waiting on memory.
+//  high_limit - The usage, in bytes, above which the OS throttles and reclaims aggressively, or 0 if there is none.
+// Return:
+//  true if any of the above is available
+bool GCToOSInterface::GetMemoryPressure(uint32_t* stall_some, uint32_t* stall_full, uint64_t* high_limit)
+{
+    LIMITED_METHOD_CONTRACT;
+
+#ifdef TARGET_UNIX
+    UINT some = 0;
+    UINT full = 0;
+    UINT64 high = 0;
+    if (!PAL_GetMemoryPressure(&some, &full, &high))
+        return false;
+
+    *stall_some = some;
+    *stall_full = full;
+    *high_limit = high;
+    return true;
+#else
+    return false;
+#endif
+}
+
 // Get memory status
 // Parameters:
 //  memory_load - A number between 0 and 100 that specifies the approximate percentage of physical memory
@@ -22,6 +22,10 @@ uint8_t* g_ephemeral_high = (uint8_t*)~0;
 uint32_t* g_card_bundle_table = nullptr;
 #endif
 
+// Only set when the GC uses regions, see WriteBarrierParameters::region_to_generation_table.
+uint8_t* g_region_to_generation_table = nullptr;
+uint8_t  g_region_shr = 0;
+
 // This is the global GC heap, maintained by the VM.
 GPTR_IMPL(IGCHeap, g_pGCHeap);
 
@@ -29,6 +29,8 @@ extern "C" gc_alloc_context g_global_alloc_context;
 extern "C" uint32_t* g_card_bundle_table;
 extern "C" uint8_t* g_ephemeral_low;
 extern "C" uint8_t* g_ephemeral_high;
+extern "C" uint8_t* g_region_to_generation_table;
+extern "C" uint8_t g_region_shr;
 
 #ifdef FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
 
@@ -94,6 +94,8 @@ GcInfoDecoder::GcInfoDecoder(
             , m_ReturnKind(RT_Illegal)
 #ifdef _DEBUG
             , m_Flags( flags )
+#endif
+#if defined(_DEBUG) || defined(GCINFO_SLOT_TABLE_CACHE)
             , m_GcInfoAddress(dac_cast<PTR_CBYTE>(gcInfoToken.Info))
 #endif
            , m_Version(gcInfoToken.Version)
@@ -616,7 +618,16 @@ bool GcInfoDecoder::EnumerateLiveSlots(
 
     _ASSERTE( m_Flags & DECODE_GC_LIFETIMES );
 
+    bool fCachedSlotTable = false;
+#ifdef GCINFO_SLOT_TABLE_CACHE
+    GcSlotTableCache::Entry* pCacheEntry = GcSlotTableCache::GetEntry(m_GcInfoAddress, &fCachedSlotTable);
+
+    // On a miss the table is decoded straight into the cache entry
+    GcSlotDecoder localSlotDecoder;
+    GcSlotDecoder& slotDecoder = (pCacheEntry != NULL) ? pCacheEntry->slotDecoder : localSlotDecoder;
+#else
     GcSlotDecoder slotDecoder;
+#endif
 
     UINT32 normBreakOffset = NORMALIZE_CODE_OFFSET(m_InstructionOffset);
 
@@ -636,11 +647,14 @@ bool GcInfoDecoder::EnumerateLiveSlots(
 
     if(m_SafePointIndex < m_NumSafePoints && !executionAborted)
     {
-        // Skip interruptibility information
-        for(UINT32 i=0; i<m_NumInterruptibleRanges; i++)
+        // Skip interruptibility information, a cached slot table has the position after it
+        if(!fCachedSlotTable)
         {
-            m_Reader.DecodeVarLengthUnsigned( INTERRUPTIBLE_RANGE_DELTA1_ENCBASE );
-            m_Reader.DecodeVarLengthUnsigned( INTERRUPTIBLE_RANGE_DELTA2_ENCBASE );
+            for(UINT32 i=0; i<m_NumInterruptibleRanges; i++)
+            {
+                m_Reader.DecodeVarLengthUnsigned( INTERRUPTIBLE_RANGE_DELTA1_ENCBASE );
+                m_Reader.DecodeVarLengthUnsigned( INTERRUPTIBLE_RANGE_DELTA2_ENCBASE );
+            }
         }
     }
     else
@@ -692,11 +706,14 @@ bool GcInfoDecoder::EnumerateLiveSlots(
     }
 #else   // !PARTIALLY_INTERRUPTIBLE_GC_SUPPORTED
 
-    // Skip interruptibility information
-    for(UINT32 i=0; i<m_NumInterruptibleRanges; i++)
+    // Skip interruptibility information, a cached slot table has the position after it
+    if(!fCachedSlotTable)
     {
-        m_Reader.DecodeVarLengthUnsigned( INTERRUPTIBLE_RANGE_DELTA1_ENCBASE );
-        m_Reader.DecodeVarLengthUnsigned( INTERRUPTIBLE_RANGE_DELTA2_ENCBASE );
+        for(UINT32 i=0; i<m_NumInterruptibleRanges; i++)
+        {
+            m_Reader.DecodeVarLengthUnsigned( INTERRUPTIBLE_RANGE_DELTA1_ENCBASE );
+            m_Reader.DecodeVarLengthUnsigned( INTERRUPTIBLE_RANGE_DELTA2_ENCBASE );
+        }
     }
 #endif
 
@@ -705,8 +722,22 @@ bool GcInfoDecoder::EnumerateLiveSlots(
     // Read the slot table
     //------------------------------------------------------------------------------
 
-
-    slotDecoder.DecodeSlotTable(m_Reader);
+#ifdef GCINFO_SLOT_TABLE_CACHE
+    if(fCachedSlotTable)
+    {
+        m_Reader.SetCurrentPos(pCacheEntry->slotTableEndPos);
+    }
+    else
+#endif
+    {
+        slotDecoder.DecodeSlotTable(m_Reader);
+#ifdef GCINFO_SLOT_TABLE_CACHE
+        if(pCacheEntry != NULL)
+        {
+            GcSlotTableCache::Fill(pCacheEntry, m_GcInfoAddress, m_Reader.GetCurrentPos());
+        }
+#endif
+    }
 
     {
         UINT32 numSlots = slotDecoder.GetNumTracked();
@@ -1870,5 +1901,133 @@ void GcInfoDecoder::ReportStackSlotToGC(
 }
 
 
+#ifdef GCINFO_SLOT_TABLE_CACHE
+
+Volatile<DWORD> GcSlotTableCache::s_flushEpoch = 1;
+INT64           GcSlotTableCache::s_hitCount = 0;
+INT64           GcSlotTableCache::s_missCount = 0;
+
+namespace
+{
+    // Most threads never scan a stack, so they only pay for the pointer
+    struct GcSlotTableCacheHolder
+    {
+        void* m_pCache;
+
+        ~GcSlotTableCacheHolder()
+        {
+            delete[] (BYTE*)m_pCache;
+        }
+    };
+
+    thread_local GcSlotTableCacheHolder t_slotTableCache;
+}
+
+GcSlotTableCache::ThreadCache* GcSlotTableCache::GetThreadCache()
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+    }
+    CONTRACTL_END;
+
+    ThreadCache* pThreadCache = (ThreadCache*)t_slotTableCache.m_pCache;
+    if (pThreadCache == NULL)
+    {
+        pThreadCache = (ThreadCache*)new (nothrow) BYTE[sizeof(ThreadCache)];
+        if (pThreadCache == NULL)
+        {
+            return NULL;
+        }
+
+        pThreadCache->flushEpoch = 0;
+        pThreadCache->hitCount = 0;
+        pThreadCache->missCount = 0;
+        t_slotTableCache.m_pCache = pThreadCache;
+    }
+
+    DWORD flushEpoch = s_flushEpoch.LoadWithoutBarrier();
+    if (pThreadCache->flushEpoch != flushEpoch)
+    {
+        for (DWORD i = 0; i < CACHE_SIZE; i++)
+        {
+            pThreadCache->entries[i].gcInfoAddress = NULL;
+        }
+        pThreadCache->flushEpoch = flushEpoch;
+    }
+
+    return pThreadCache;
+}
+
+GcSlotTableCache::Entry* GcSlotTableCache::GetEntry(PTR_CBYTE gcInfoAddress, bool* pHit)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+    }
+    CONTRACTL_END;
+
+    *pHit = false;
+
+    ThreadCache* pThreadCache = GetThreadCache();
+    if (pThreadCache == NULL)
+    {
+        return NULL;
+    }
+
+    // GC info of different methods is at least a few bytes apart
+    UINT64 hash = (UINT64)dac_cast<TADDR>(gcInfoAddress) >> 2;
+    Entry* pEntry = &pThreadCache->entries[(DWORD)((hash * 11400714819323198485llu) >> (64 - CACHE_SIZE_LOG2))];
+
+    if (pEntry->gcInfoAddress == gcInfoAddress)
+    {
+        *pHit = true;
+        if (++pThreadCache->hitCount == COUNT_BATCH)
+        {
+            InterlockedExchangeAdd64((LONGLONG *)&s_hitCount, COUNT_BATCH);
+            pThreadCache->hitCount = 0;
+        }
+    }
+    else
+    {
+        // The caller decodes over the old table
+        pEntry->gcInfoAddress = NULL;
+        if (++pThreadCache->missCount == COUNT_BATCH)
+        {
+            InterlockedExchangeAdd64((LONGLONG *)&s_missCount, COUNT_BATCH);
+            pThreadCache->missCount = 0;
+        }
+    }
+
+    return pEntry;
+}
+
+void GcSlotTableCache::Flush()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    // The threads that scan stacks pick this up on their next lookup. GC info is only freed when none
+    // of its frames can be on a stack any more, so no lookup can be in flight for it.
+    FastInterlockIncrement((LONG*)&s_flushEpoch);
+}
+
+INT64 GcSlotTableCache::GetHitCount()
+{
+    LIMITED_METHOD_CONTRACT;
+    return InterlockedCompareExchange64((LONGLONG *)&s_hitCount, 0, 0); // prevent tearing
+}
+
+INT64 GcSlotTableCache::GetMissCount()
+{
+    LIMITED_METHOD_CONTRACT;
+    return InterlockedCompareExchange64((LONGLONG *)&s_missCount, 0, 0); // prevent tearing
+}
+
+#endif // GCINFO_SLOT_TABLE_CACHE
+
 #endif // USE_GC_INFO_DECODER
 
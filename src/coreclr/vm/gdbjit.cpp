@@ -1863,6 +1863,11 @@ static inline bool isListedModule(const WCHAR *wszModuleFile)
 static NotifyGdb::AddrSet g_codeAddrs;
 static CrstStatic g_codeAddrsCrst;
 
+// Methods prepared in on-demand mode whose debug info has not been requested yet.
+static bool g_isOnDemand = false;
+static NotifyGdb::MethodSet g_pendingMethods;
+static CrstStatic g_pendingMethodsCrst;
+
 class Elf_SectionTracker
 {
     private:
@@ -2472,6 +2477,9 @@ void NotifyGdb::Initialize()
 {
     g_jitDescriptorCrst.Init(CrstNotifyGdb);
     g_codeAddrsCrst.Init(CrstNotifyGdb);
+    g_pendingMethodsCrst.Init(CrstNotifyGdb);
+
+    g_isOnDemand = CLRConfig::GetConfigValue(CLRConfig::INTERNAL_GDBJitOnDemand) != 0;
 
     // Get names of interesting modules from environment
     if (g_wszModuleNames == nullptr && g_cBytesNeeded == 0)
@@ -2503,6 +2511,56 @@ void NotifyGdb::Initialize()
 /* Create ELF/DWARF debug info for jitted method */
 void NotifyGdb::MethodPrepared(MethodDesc* methodDescPtr)
 {
+    if (g_isOnDemand)
+    {
+        // Only remember the method, the debug info is built if someone asks for it
+        EX_TRY
+        {
+            CrstHolder crst(&g_pendingMethodsCrst);
+            g_pendingMethods.AddOrReplace(methodDescPtr);
+        }
+        EX_CATCH
+        {
+        }
+        EX_END_CATCH(SwallowAllExceptions);
+
+        return;
+    }
+
+    EX_TRY
+    {
+        if (!tls_isSymReaderInProgress)
+        {
+            tls_isSymReaderInProgress = true;
+            NotifyGdb::OnMethodPrepared(methodDescPtr);
+            tls_isSymReaderInProgress = false;
+        }
+    }
+    EX_CATCH
+    {
+    }
+    EX_END_CATCH(SwallowAllExceptions);
+}
+
+bool NotifyGdb::IsOnDemand()
+{
+    return g_isOnDemand;
+}
+
+/* Create debug info for a method recorded in on-demand mode */
+void NotifyGdb::MethodRequested(MethodDesc* methodDescPtr)
+{
+    {
+        CrstHolder crst(&g_pendingMethodsCrst);
+
+        if (g_pendingMethods.Lookup(methodDescPtr) == NULL)
+        {
+            return;
+        }
+
+        g_pendingMethods.Remove(methodDescPtr);
+    }
+
     EX_TRY
     {
         if (!tls_isSymReaderInProgress)
@@ -2518,6 +2576,56 @@ void NotifyGdb::MethodPrepared(MethodDesc* methodDescPtr)
     EX_END_CATCH(SwallowAllExceptions);
 }
 
+/* Create debug info for all the methods recorded in on-demand mode */
+HRESULT NotifyGdb::EmitPendingMethods()
+{
+    if (!g_isOnDemand)
+    {
+        return E_NOTIMPL;
+    }
+
+    HRESULT hr = S_OK;
+
+    EX_TRY
+    {
+        NewArrayHolder<MethodDesc*> methods;
+        COUNT_T count = 0;
+
+        {
+            // Take the whole set so that the symbol reader does not run under the lock
+            CrstHolder crst(&g_pendingMethodsCrst);
+
+            methods = new MethodDesc*[g_pendingMethods.GetCount() + 1];
+            for (MethodSet::Iterator it = g_pendingMethods.Begin(), end = g_pendingMethods.End(); it != end; ++it)
+            {
+                methods[count++] = *it;
+            }
+
+            g_pendingMethods.RemoveAll();
+        }
+
+        for (COUNT_T i = 0; i < count; i++)
+        {
+            if (!tls_isSymReaderInProgress)
+            {
+                tls_isSymReaderInProgress = true;
+                EX_TRY
+                {
+                    NotifyGdb::OnMethodPrepared(methods[i]);
+                }
+                EX_CATCH
+                {
+                }
+                EX_END_CATCH(SwallowAllExceptions);
+                tls_isSymReaderInProgress = false;
+            }
+        }
+    }
+    EX_CATCH_HRESULT(hr);
+
+    return hr;
+}
+
 void NotifyGdb::OnMethodPrepared(MethodDesc* methodDescPtr)
 {
     PCODE pCode = methodDescPtr->GetNativeCode();
@@ -2947,6 +3055,15 @@ bool NotifyGdb::EmitDebugInfo(Elf_Builder &elfBuilder, MethodDesc* methodDescPtr
 
 void NotifyGdb::MethodPitched(MethodDesc* methodDescPtr)
 {
+    if (g_isOnDemand)
+    {
+        CrstHolder crst(&g_pendingMethodsCrst);
+        if (g_pendingMethods.Lookup(methodDescPtr) != NULL)
+        {
+            g_pendingMethods.Remove(methodDescPtr);
+        }
+    }
+
     PCODE pCode = methodDescPtr->GetNativeCode();
 
     if (pCode == NULL)
@@ -353,6 +353,12 @@ public:
     static void Initialize();
     static void MethodPrepared(MethodDesc* methodDescPtr);
     static void MethodPitched(MethodDesc* methodDescPtr);
+
+    // In on-demand mode (GDBJitOnDemand) prepared methods are only recorded, and their
+    // debug info is generated when it is requested with one of these.
+    static bool IsOnDemand();
+    static void MethodRequested(MethodDesc* methodDescPtr);
+    static HRESULT EmitPendingMethods();
     template <typename PARENT_TRAITS>
     class DeleteValuesOnDestructSHashTraits : public PARENT_TRAITS
     {
@@ -402,6 +408,9 @@ public:
                       NoRemoveSHashTraits <
                       NonDacAwareSHashTraits< SetSHashTraits <TADDR> >
                     > > AddrSet;
+    typedef SetSHash< MethodDesc*,
+                      NonDacAwareSHashTraits< SetSHashTraits <MethodDesc*> >
+                    > MethodSet;
 private:
 
     struct MemBuf
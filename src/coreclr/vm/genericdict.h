@@ -98,6 +98,9 @@ typedef DPTR(DictionaryLayout) PTR_DictionaryLayout;
 #define NUM_DICTIONARY_SLOTS 4
 #endif
 
+// Upper bound on the number of slots the IL size heuristic will preallocate in a generic method dictionary layout.
+#define MAX_ESTIMATED_DICTIONARY_SLOTS 32
+
 // The type of dictionary layouts. We don't include the number of type
 // arguments as this is obtained elsewhere
 class DictionaryLayout
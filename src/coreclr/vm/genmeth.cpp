@@ -64,6 +64,45 @@
 
 
 // Helper method that creates a method-desc off a template method desc
+// Estimate the number of slots to reserve up front in the dictionary layout shared by the generic
+// method instantiations of pMD. Running out of slots forces every later instantiation through the
+// slow dictionary expansion path (and the JIT to emit a size check before the lookup), so larger
+// method bodies, which tend to reference more generic handles, start out with a bigger layout.
+static WORD EstimateMethodDictionarySlots(MethodDesc * pMD)
+{
+    CONTRACTL
+    {
+        THROWS;
+        GC_NOTRIGGER;
+        PRECONDITION(CheckPointer(pMD));
+    }
+    CONTRACTL_END;
+
+#ifdef _DEBUG
+    // Keep the layout small to stress the dictionary expansion logic
+    return NUM_DICTIONARY_SLOTS;
+#else
+    if (!pMD->HasILHeader())
+        return NUM_DICTIONARY_SLOTS;
+
+    COR_ILMETHOD * pIL = pMD->GetILHeader();
+    if (pIL == NULL)
+        return NUM_DICTIONARY_SLOTS;
+
+    COR_ILMETHOD_DECODER header(pIL);
+
+    // Heuristics
+    //  - Roughly one generic lookup per 32 bytes of IL.
+    //  - Methods with more generic parameters tend to use more slots.
+    //      = multiply by 1.5 for 2 params or more
+    DWORD estNumSlots = header.GetCodeSize() / 32;
+    if (pMD->GetNumGenericMethodArgs() > 1)
+        estNumSlots = (estNumSlots * 3) / 2;
+
+    return static_cast<WORD>(min(max(estNumSlots, (DWORD)NUM_DICTIONARY_SLOTS), (DWORD)MAX_ESTIMATED_DICTIONARY_SLOTS));
+#endif
+}
+
 static MethodDesc* CreateMethodDesc(LoaderAllocator *pAllocator,
                                     MethodTable *pMT,
                                     MethodDesc *pTemplateMD,
@@ -381,7 +420,7 @@ InstantiatedMethodDesc::NewInstantiatedMethodDesc(MethodTable *pExactMT,
             }
             else if (getWrappedCode)
             {
-                pDL = DictionaryLayout::Allocate(NUM_DICTIONARY_SLOTS, pAllocator, &amt);
+                pDL = DictionaryLayout::Allocate(EstimateMethodDictionarySlots(pGenericMDescInRepMT), pAllocator, &amt);
 #ifdef _DEBUG
                 {
                     SString name;
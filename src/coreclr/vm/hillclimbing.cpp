@@ -18,6 +18,7 @@
 
 #include "common.h"
 #include "hillclimbing.h"
+#include "threadpoolrequest.h"
 #include "win32threadpool.h"
 
 //
@@ -67,6 +68,12 @@ void HillClimbing::Initialize()
     m_accumulatedCompletionCount = 0;
     m_accumulatedSampleDuration = 0;
 
+    m_mode = (CLRConfig::GetConfigValue(CLRConfig::INTERNAL_HillClimbing_Mode) == HillClimbingMode_QueueLatency)
+        ? HillClimbingMode_QueueLatency
+        : HillClimbingMode_Throughput;
+    m_queueLatencyTargetMs = max((DWORD)1, CLRConfig::GetConfigValue(CLRConfig::INTERNAL_HillClimbing_QueueLatencyTargetMs));
+    m_samplesBelowLatencyTarget = 0;
+
     m_samples = new double[m_samplesToMeasure];
     m_threadCounts = new double[m_samplesToMeasure];
 
@@ -92,6 +99,9 @@ int HillClimbing::Update(int currentThreadCount, double sampleDuration, int numC
     if (currentThreadCount != m_lastThreadCount)
         ForceChange(currentThreadCount, Initializing);
 
+    if (m_mode == HillClimbingMode_QueueLatency)
+        return UpdateQueueLatency(currentThreadCount, sampleDuration, numCompletions, pNewSampleInterval);
+
     //
     // Update the cumulative stats for this thread count
     //
@@ -347,6 +357,102 @@ int HillClimbing::Update(int currentThreadCount, double sampleDuration, int numC
 }
 
 
+//
+// Alternative controller for workloads where work items block now and then (typically on I/O). Throughput
+// alone is a poor signal there: blocked threads complete nothing, so adding threads shows no throughput
+// gain and hill climbing backs off while the queue keeps growing. Instead, this controller looks at how
+// long pending work has been waiting for a thread and whether the active threads appear to be blocked.
+//
+//  - If work has been waiting longer than the latency target, add threads in proportion to how far past
+//    the target we are.
+//  - If work is waiting, the CPU is mostly idle and fewer work items completed than there are threads,
+//    most threads are blocked rather than busy; add one thread per thread that made no progress.
+//  - Once pending work has stayed well within the target for a while, give back one thread per sample.
+//
+int HillClimbing::UpdateQueueLatency(int currentThreadCount, double sampleDuration, int numCompletions, int* pNewSampleInterval)
+{
+    LIMITED_METHOD_CONTRACT;
+    _ASSERTE(!ThreadpoolMgr::UsePortableThreadPool());
+    _ASSERTE(m_mode == HillClimbingMode_QueueLatency);
+
+#ifdef DACCESS_COMPILE
+    return 1;
+#else
+
+    m_elapsedSinceLastChange += sampleDuration;
+    m_completionsSinceLastChange += numCompletions;
+
+    double throughput = (sampleDuration > 0) ? ((double)numCompletions / sampleDuration) : 0;
+    FireEtwThreadPoolWorkerThreadAdjustmentSample(throughput, GetClrInstanceId());
+    m_totalSamples++;
+
+    //
+    // LastDequeueTime is refreshed every time a worker picks up work, so while requests are pending the time
+    // since the last dequeue bounds how long the oldest pending work item has been waiting for a thread.
+    //
+    bool requestsPending = PerAppDomainTPCountList::AreRequestsPendingInAnyAppDomains();
+    DWORD queueDelayMs = requestsPending ? (GetTickCount() - VolatileLoad(&ThreadpoolMgr::LastDequeueTime)) : 0;
+
+    int move = 0;
+    HillClimbingStateTransition transition = Stabilizing;
+
+    if (requestsPending && queueDelayMs > m_queueLatencyTargetMs)
+    {
+        move = (int)min((DWORD)m_maxChangePerSample, max((DWORD)1, queueDelayMs / m_queueLatencyTargetMs));
+        transition = QueueLatency;
+    }
+    else if (requestsPending &&
+             numCompletions < currentThreadCount &&
+             ThreadpoolMgr::cpuUtilization < CpuUtilizationLow)
+    {
+        move = min((int)m_maxChangePerSample, currentThreadCount - numCompletions);
+        transition = BlockedThreads;
+    }
+
+    //
+    // As with hill climbing, don't add threads when the CPU is already saturated; blocked threads are not
+    // the bottleneck then.
+    //
+    if (move > 0 && ThreadpoolMgr::cpuUtilization > CpuUtilizationHigh)
+        move = 0;
+
+    if (move == 0 && queueDelayMs <= m_queueLatencyTargetMs / 2)
+    {
+        //
+        // Only retire threads after the queue has stayed comfortably within the target for a full wave period,
+        // so that a burst of short blocking calls does not make the thread count oscillate.
+        //
+        if (++m_samplesBelowLatencyTarget >= m_wavePeriod)
+        {
+            move = -1;
+            m_samplesBelowLatencyTarget = 0;
+        }
+    }
+    else
+    {
+        m_samplesBelowLatencyTarget = 0;
+    }
+
+    int newThreadCount = currentThreadCount + move;
+    newThreadCount = min(ThreadpoolMgr::MaxLimitTotalWorkerThreads, newThreadCount);
+    newThreadCount = max(ThreadpoolMgr::MinLimitTotalWorkerThreads, newThreadCount);
+
+    m_currentControlSetting = newThreadCount;
+
+    if (newThreadCount != currentThreadCount)
+        ChangeThreadCount(newThreadCount, transition);
+
+    //
+    // Sample quickly while work is backing up, so we react within a few multiples of the latency target.
+    //
+    *pNewSampleInterval = (move > 0) ? (int)m_sampleIntervalLow : (int)m_currentSampleInterval;
+
+    return newThreadCount;
+
+#endif //DACCESS_COMPILE
+}
+
+
 void HillClimbing::ForceChange(int newThreadCount, HillClimbingStateTransition transition)
 {
     LIMITED_METHOD_CONTRACT;
@@ -28,9 +28,17 @@ enum HillClimbingStateTransition
     Stabilizing,
     Starvation, //used by ThreadpoolMgr
     ThreadTimedOut, //used by ThreadpoolMgr
+    QueueLatency, //used by the queue latency controller
+    BlockedThreads, //used by the queue latency controller
     Undefined,
 };
 
+enum HillClimbingMode
+{
+    HillClimbingMode_Throughput   = 0, // classic throughput-driven hill climbing
+    HillClimbingMode_QueueLatency = 1, // driven by queue wait time and blocked thread detection
+};
+
 
 class HillClimbing
 {
@@ -66,6 +74,11 @@ private:
     int m_accumulatedCompletionCount;
     double m_accumulatedSampleDuration;
 
+    HillClimbingMode m_mode;
+    DWORD m_queueLatencyTargetMs;
+    int m_samplesBelowLatencyTarget; //consecutive samples in which pending work did not wait longer than half the target
+
+    int UpdateQueueLatency(int currentThreadCount, double sampleDuration, int numCompletions, int* pNewSampleInterval);
     void ChangeThreadCount(int newThreadCount, HillClimbingStateTransition transition);
     void LogTransition(int threadCount, double throughput, HillClimbingStateTransition transition);
 
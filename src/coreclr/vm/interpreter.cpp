@@ -683,9 +683,15 @@ CorJitResult Interpreter::GenerateInterpreterStub(CEEInfo* comp,
     // If jmpCall, we only need to do computations involving method info.
     if (!jmpCall)
     {
+        MethodDesc* pMD = reinterpret_cast<MethodDesc*>(info->ftn);
+
+        // Class constructors run once, so interpreting them saves the JIT time without
+        // costing much in execution time. They do not need to be listed in 'Interpret'.
+        bool runsOnce = s_InterpreterClassConstructors && pMD->IsClassConstructor();
+
         const char* clsName;
         const char* methName = comp->getMethodName(info->ftn, &clsName);
-        if (   !s_InterpretMeths.contains(methName, clsName, info->args.pSig)
+        if (   (!runsOnce && !s_InterpretMeths.contains(methName, clsName, info->args.pSig))
             || s_InterpretMethsExclude.contains(methName, clsName, info->args.pSig))
         {
             TRACE_SKIPPED(clsName, methName, "not in set of methods to interpret");
@@ -700,8 +706,6 @@ CorJitResult Interpreter::GenerateInterpreterStub(CEEInfo* comp,
             return CORJIT_SKIPPED;
         }
 
-        MethodDesc* pMD = reinterpret_cast<MethodDesc*>(info->ftn);
-
 #if !INTERP_ILSTUBS
         if (pMD->IsILStub())
         {
@@ -1679,7 +1683,10 @@ void Interpreter::JitMethodIfAppropriate(InterpreterMethodInfo* interpMethInfo,
             if (activeCodeVersion.GetOptimizationTier() == NativeCodeVersion::OptimizationTier0 &&
                 !ilCodeVersion.HasAnyOptimizedNativeCodeVersion(activeCodeVersion))
             {
-                tieredCompilationManager->AsyncPromoteToTier1(activeCodeVersion, &scheduleTieringBackgroundWork);
+                tieredCompilationManager->AsyncPromoteToTier1(
+                    activeCodeVersion,
+                    TieredCompilationManager::UnknownCallCountingDurationMs,
+                    &scheduleTieringBackgroundWork);
             }
 #else
 #error FEATURE_INTERPRETER depends on FEATURE_TIERED_COMPILATION now
@@ -6533,6 +6540,7 @@ void Interpreter::Initialize()
     s_InterpreterUseCaching = (s_InterpreterUseCachingFlag.val(CLRConfig::INTERNAL_InterpreterUseCaching) != 0);
     s_InterpreterLooseRules = (s_InterpreterLooseRulesFlag.val(CLRConfig::INTERNAL_InterpreterLooseRules) != 0);
     s_InterpreterDoLoopMethods = (s_InterpreterDoLoopMethodsFlag.val(CLRConfig::INTERNAL_InterpreterDoLoopMethods) != 0);
+    s_InterpreterClassConstructors = (s_InterpreterClassConstructorsFlag.val(CLRConfig::INTERNAL_InterpreterClassConstructors) != 0);
 
     // Initialize the lock used to protect method locks.
     // TODO: it would be better if this were a reader/writer lock.
@@ -7648,7 +7656,8 @@ bool Interpreter::StaticFldAddrWork(CORINFO_ACCESS_FLAGS accessFlgs, /*out (byre
             NYI_INTERP("Thread-local static.");
         }
         else if (fldInfo.fieldAccessor == CORINFO_FIELD_STATIC_SHARED_STATIC_HELPER
-                 || fldInfo.fieldAccessor == CORINFO_FIELD_STATIC_GENERICS_STATIC_HELPER)
+                 || fldInfo.fieldAccessor == CORINFO_FIELD_STATIC_GENERICS_STATIC_HELPER
+                 || fldInfo.fieldAccessor == CORINFO_FIELD_STATIC_TLS_MANAGED)
         {
             *pStaticFieldAddr = fld->GetCurrentStaticAddress();
             isCacheable = false;
@@ -11213,10 +11222,12 @@ ConfigDWORD Interpreter::s_InterpretMethHashMin;
 ConfigDWORD Interpreter::s_InterpretMethHashMax;
 ConfigDWORD Interpreter::s_InterpreterJITThreshold;
 ConfigDWORD Interpreter::s_InterpreterDoLoopMethodsFlag;
+ConfigDWORD Interpreter::s_InterpreterClassConstructorsFlag;
 ConfigDWORD Interpreter::s_InterpreterUseCachingFlag;
 ConfigDWORD Interpreter::s_InterpreterLooseRulesFlag;
 
 bool Interpreter::s_InterpreterDoLoopMethods;
+bool Interpreter::s_InterpreterClassConstructors;
 bool Interpreter::s_InterpreterUseCaching;
 bool Interpreter::s_InterpreterLooseRules;
 
@@ -1537,6 +1537,8 @@ private:
     static ConfigDWORD s_InterpreterJITThreshold;
     static ConfigDWORD s_InterpreterDoLoopMethodsFlag;
     static bool        s_InterpreterDoLoopMethods;
+    static ConfigDWORD s_InterpreterClassConstructorsFlag;
+    static bool        s_InterpreterClassConstructors;
     static ConfigDWORD s_InterpreterUseCachingFlag;
     static bool        s_InterpreterUseCaching;
     static ConfigDWORD s_InterpreterLooseRulesFlag;
@@ -1809,6 +1809,28 @@ HCIMPL2(void*, JIT_GetSharedNonGCThreadStaticBase, DomainLocalModule *pDomainLoc
 HCIMPLEND
 #include <optdefault.h>
 
+#ifdef FEATURE_INLINED_THREAD_STATICS
+// *** This helper corresponds to CORINFO_HELP_GETSHARED_NONGCTHREADSTATIC_BASE_OPTIMIZED. JIT-ed code
+//     reads the non-GC statics base directly from the thread's inlined slot and only calls this helper
+//     while the slot is still empty. It goes through the regular lookup, which also runs the class
+//     constructor if needed, and then populates the slot for subsequent accesses on this thread.
+
+HCIMPL1(void*, JIT_GetSharedNonGCThreadStaticBaseOptimized, INT32 slotOffset)
+{
+    FCALL_CONTRACT;
+
+    MethodTable * pMT = ThreadStatics::GetInlinedThreadStaticType(slotOffset);
+    _ASSERTE(!pMT->Collectible());
+
+    ENDFORBIDGC();
+    void* base = HCCALL1(JIT_GetNonGCThreadStaticBase_Helper, pMT);
+
+    ThreadStatics::SetInlinedNonGCThreadStaticBase(slotOffset, base);
+    return base;
+}
+HCIMPLEND
+#endif // FEATURE_INLINED_THREAD_STATICS
+
 // *** This helper corresponds to both CORINFO_HELP_GETSHARED_GCTHREADSTATIC_BASE and
 //     CORINFO_HELP_GETSHARED_GCTHREADSTATIC_BASE_NOCTOR. Even though we always check
 //     if the class constructor has been run, we have a separate helper ID for the "no ctor"
@@ -5419,10 +5441,14 @@ void F_CALL_CONV HCCALL3(JIT_ReversePInvokeEnterTrackTransitions, ReversePInvoke
 {
     _ASSERTE(frame != NULL && handle != NULL);
 
+    // If we're in an IL stub, the secret argument is the UMEntryThunk of the target method. We want
+    // to report and trace the target method, not the stub.
     MethodDesc* pMD = GetMethod(handle);
+    UMEntryThunk* pThunk = NULL;
     if (pMD->IsILStub() && secretArg != NULL)
     {
-        pMD = ((UMEntryThunk*)secretArg)->GetMethod();
+        pThunk = (UMEntryThunk*)secretArg;
+        pMD = pThunk->GetMethod();
     }
     frame->pMD = pMD;
 
@@ -5446,16 +5472,12 @@ void F_CALL_CONV HCCALL3(JIT_ReversePInvokeEnterTrackTransitions, ReversePInvoke
         thread->m_fPreemptiveGCDisabled.StoreWithoutBarrier(1);
         if (g_TrapReturningThreads.LoadWithoutBarrier() != 0)
         {
-            // If we're in an IL stub, we want to trace the address of the target method,
-            // not the next instruction in the stub.
-            JIT_ReversePInvokeEnterRare2(frame, _ReturnAddress(), GetMethod(handle)->IsILStub() ? (UMEntryThunk*)secretArg : (UMEntryThunk*)NULL);
+            JIT_ReversePInvokeEnterRare2(frame, _ReturnAddress(), pThunk);
         }
     }
     else
     {
-        // If we're in an IL stub, we want to trace the address of the target method,
-        // not the next instruction in the stub.
-        JIT_ReversePInvokeEnterRare(frame, _ReturnAddress(), GetMethod(handle)->IsILStub() ? (UMEntryThunk*)secretArg  : (UMEntryThunk*)NULL);
+        JIT_ReversePInvokeEnterRare(frame, _ReturnAddress(), pThunk);
     }
 
 #ifndef FEATURE_EH_FUNCLETS
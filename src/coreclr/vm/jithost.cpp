@@ -50,6 +50,14 @@ void JitHost::freeStringConfigValue(const WCHAR* value)
     CLRConfig::FreeConfigString(const_cast<WCHAR*>(value));
 }
 
+void JitHost::reportMethodStatistics(const JitMethodStatistics* stats)
+{
+    WRAPPER_NO_CONTRACT;
+
+    // The JIT compiles on behalf of the runtime, so method handles are MethodDescs.
+    ETW::MethodLog::MethodJitStatistics((MethodDesc*)stats->method, stats);
+}
+
 //
 // Pool memory blocks for JIT to avoid frequent commit/decommit. The frequent commit/decommit has been
 // shown to slow down the JIT significantly (10% or more). The memory blocks used by the JIT tend to be too big
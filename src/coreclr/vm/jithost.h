@@ -38,6 +38,7 @@ public:
     virtual void freeStringConfigValue(const WCHAR* value);
     virtual void* allocateSlab(size_t size, size_t* pActualSize);
     virtual void freeSlab(void* slab, size_t actualSize);
+    virtual void reportMethodStatistics(const JitMethodStatistics* stats);
 
     static void Init() { s_theJitHost.init(); }
     static void Reclaim() { s_theJitHost.reclaim(); }
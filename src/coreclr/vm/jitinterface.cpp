@@ -1530,6 +1530,7 @@ void CEEInfo::getFieldInfo (CORINFO_RESOLVED_TOKEN * pResolvedToken,
     DWORD fieldFlags = 0;
 
     pResult->offset = pField->GetOffset();
+    pResult->threadStaticSlotOffset = 0;
     if (pField->IsStatic())
     {
         fieldFlags |= CORINFO_FLG_FIELD_STATIC;
@@ -1591,6 +1592,26 @@ void CEEInfo::getFieldInfo (CORINFO_RESOLVED_TOKEN * pResolvedToken,
                 fieldAccessor = CORINFO_FIELD_STATIC_SHARED_STATIC_HELPER;
 
                 pResult->helper = getSharedStaticsHelper(pField, pFieldMT);
+
+#ifdef FEATURE_INLINED_THREAD_STATICS
+                // Non-GC thread statics of non-collectible types can be read through the thread's
+                // inlined slot for the type instead of going through the shared statics helper.
+                if (pField->IsThreadStatic() && !pFieldMT->Collectible() &&
+                    !m_pMethodBeingCompiled->IsZapped() && !IsCompilingForNGen() &&
+                    (pResult->helper == CORINFO_HELP_GETSHARED_NONGCTHREADSTATIC_BASE ||
+                     pResult->helper == CORINFO_HELP_GETSHARED_NONGCTHREADSTATIC_BASE_NOCTOR ||
+                     pResult->helper == CORINFO_HELP_GETSHARED_NONGCTHREADSTATIC_BASE_DYNAMICCLASS))
+                {
+                    INT32 slotOffset;
+                    if (ThreadStatics::GetInlinedThreadStaticSlotOffset(pFieldMT, &slotOffset))
+                    {
+                        fieldAccessor = CORINFO_FIELD_STATIC_TLS_MANAGED;
+
+                        pResult->helper = CORINFO_HELP_GETSHARED_NONGCTHREADSTATIC_BASE_OPTIMIZED;
+                        pResult->threadStaticSlotOffset = slotOffset;
+                    }
+                }
+#endif // FEATURE_INLINED_THREAD_STATICS
             }
             else
             {
@@ -6773,6 +6794,11 @@ DWORD CEEInfo::getMethodAttribsInternal (CORINFO_METHOD_HANDLE ftn)
     {
         result |= CORINFO_FLG_DISABLE_TIER0_FOR_LOOPS;
     }
+
+    if (pMD->HasNoHeapWrites())
+    {
+        result |= CORINFO_FLG_NO_HEAP_WRITES;
+    }
 #endif
 
     return result;
@@ -6847,6 +6873,16 @@ void CEEInfo::setMethodAttribs (
 #endif
         }
     }
+
+    if (attribs & CORINFO_FLG_HAS_NO_HEAP_WRITES)
+    {
+        // The summary describes the code the JIT just produced, so only cache it when that
+        // code cannot later be replaced by a body with different side effects.
+        if (!ReJitManager::IsReJITEnabled() && !ftn->IsEnCAddedMethod() && !ftn->GetModule()->IsEditAndContinueEnabled())
+        {
+            ftn->SetHasNoHeapWrites();
+        }
+    }
 #endif // !CROSSGEN_COMPILE
 
     EE_TO_JIT_TRANSITION();
@@ -9945,6 +9981,9 @@ namespace
             {
                 if (pSuppressGCTransition)
                 {
+#ifndef CROSSGEN_COMPILE
+                    NDirect::InferSuppressGCTransition((NDirectMethodDesc*)pMD);
+#endif // !CROSSGEN_COMPILE
                     *pSuppressGCTransition = pMD->ShouldSuppressGCTransition();
                 }
 
@@ -12234,7 +12273,8 @@ void CEEJitInfo::allocMem (
             hotCodeSize + coldCodeSize, roDataSize, totalSize.Value(), flag, GetClrInstanceId());
     }
 
-    m_CodeHeader = m_jitManager->allocCode(m_pMethodBeingCompiled, totalSize.Value(), GetReserveForJumpStubs(), flag
+    m_CodeHeader = m_jitManager->allocCode(m_pMethodBeingCompiled, totalSize.Value(), GetReserveForJumpStubs(), flag,
+                                           m_jitFlags.IsSet(CORJIT_FLAGS::CORJIT_FLAG_TIER0)
 #ifdef FEATURE_EH_FUNCLETS
                                            , m_totalUnwindInfos
                                            , &m_moduleBase
@@ -12889,7 +12929,8 @@ CORJIT_FLAGS GetCompileFlags(MethodDesc * ftn, CORJIT_FLAGS flags, CORINFO_METHO
     // Instrument, if
     //
     // * We're writing pgo data and we're jitting at Tier0.
-    // * Tiered PGO is enabled and we're jitting at Tier0.
+    // * Tiered PGO is enabled and we're jitting at Tier0, unless only hot methods are instrumented. In that
+    //   case the tiering manager requests instrumentation for the instrumented tier.
     //
     if ((CLRConfig::GetConfigValue(CLRConfig::INTERNAL_WritePGOData) > 0)
         && flags.IsSet(CORJIT_FLAGS::CORJIT_FLAG_TIER0))
@@ -12897,11 +12938,19 @@ CORJIT_FLAGS GetCompileFlags(MethodDesc * ftn, CORJIT_FLAGS flags, CORINFO_METHO
         flags.Set(CORJIT_FLAGS::CORJIT_FLAG_BBINSTR);
     }
     else if ((CLRConfig::GetConfigValue(CLRConfig::INTERNAL_TieredPGO) > 0)
+        && (CLRConfig::GetConfigValue(CLRConfig::INTERNAL_TieredPGO_InstrumentOnlyHotCode) == 0)
         && flags.IsSet(CORJIT_FLAGS::CORJIT_FLAG_TIER0))
     {
         flags.Set(CORJIT_FLAGS::CORJIT_FLAG_BBINSTR);
     }
 
+    // Use profile data, if
+    //
+    // * We're reading pgo data.
+    // * Tiered PGO is enabled and we're jitting at Tier1.
+    // * We're jitting at Tier1 and the method's ReadyToRun image carries static profile data, so that
+    //   the first Tier1 compile does not have to wait for a profile to be collected at runtime.
+    //
     if (CLRConfig::GetConfigValue(CLRConfig::INTERNAL_ReadPGOData) > 0)
     {
         flags.Set(CORJIT_FLAGS::CORJIT_FLAG_BBOPT);
@@ -12911,6 +12960,13 @@ CORJIT_FLAGS GetCompileFlags(MethodDesc * ftn, CORJIT_FLAGS flags, CORINFO_METHO
     {
         flags.Set(CORJIT_FLAGS::CORJIT_FLAG_BBOPT);
     }
+    else if (flags.IsSet(CORJIT_FLAGS::CORJIT_FLAG_TIER1)
+        && ftn->GetModule()->IsReadyToRun()
+        && ftn->GetModule()->GetReadyToRunInfo()->HasPgoInstrumentationData()
+        && (CLRConfig::GetConfigValue(CLRConfig::INTERNAL_ReadyToRunPGOData) > 0))
+    {
+        flags.Set(CORJIT_FLAGS::CORJIT_FLAG_BBOPT);
+    }
 
 #endif
 
@@ -14115,6 +14171,61 @@ BOOL LoadDynamicInfoEntry(Module *currentModule,
         }
         break;
 
+    case ENCODE_CHECK_IL_BODY:
+    case ENCODE_VERIFY_IL_BODY:
+        {
+            DWORD dwExpectedCodeSize = CorSigUncompressData(pBlob);
+            DWORD dwExpectedHash = GET_UNALIGNED_VAL32(pBlob);
+            pBlob += sizeof(DWORD);
+
+            MethodDesc * pInlinee = ZapSig::DecodeMethod(currentModule, pInfoModule, pBlob);
+
+            bool fMatches = false;
+            DWORD dwCodeSize = 0;
+            DWORD dwHash = 0;
+            if (pInlinee->IsIL() && !pInlinee->IsDynamicMethod())
+            {
+                COR_ILMETHOD_DECODER header(pInlinee->GetILHeader());
+                dwCodeSize = header.GetCodeSize();
+                if (dwCodeSize == dwExpectedCodeSize)
+                {
+                    dwHash = ReadyToRunInfo::ComputeILBodyHash(pInlinee);
+                    fMatches = (dwHash == dwExpectedHash);
+                }
+            }
+
+            if (!fMatches)
+            {
+                if (kind == ENCODE_CHECK_IL_BODY)
+                {
+                    return FALSE;
+                }
+
+                // Verification failures are failfast events
+                SString methodName;
+                TypeString::AppendMethodInternal(methodName, pInlinee, TypeString::FormatNamespace | TypeString::FormatFullInst);
+
+                SString fatalErrorString;
+                fatalErrorString.Printf(W("Verify_IL_Body '%s' IL size %d!=%d(actual) || hash 0x%08x!=0x%08x(actual)"),
+                    methodName.GetUnicode(),
+                    dwExpectedCodeSize,
+                    dwCodeSize,
+                    dwExpectedHash,
+                    dwHash);
+
+#ifdef _DEBUG
+                {
+                    StackScratchBuffer buf;
+                    _ASSERTE_MSG(false, fatalErrorString.GetUTF8(buf));
+                }
+#endif
+
+                EEPOLICY_HANDLE_FATAL_ERROR_WITH_MESSAGE(-1, fatalErrorString.GetUnicode());
+                return FALSE;
+            }
+            result = 1;
+        }
+        break;
 
     case ENCODE_CHECK_INSTRUCTION_SET_SUPPORT:
         {
@@ -14635,6 +14746,50 @@ PTR_RUNTIME_FUNCTION EECodeInfo::GetFunctionEntry()
     return m_pFunctionEntry;
 }
 
+#ifndef DACCESS_COMPILE
+
+EECodeInfoCache::EECodeInfoCache()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    // No generation matches until the entries are filled in
+    for (DWORD i = 0; i < CacheSize; i++)
+    {
+        m_entries[i].m_generation = ExecutionManager::GetCodeInfoCacheGeneration() - 1;
+    }
+}
+
+void EECodeInfoCache::Init(PCODE codeAddress, EECodeInfo * pCodeInfo)
+{
+    CONTRACTL {
+        NOTHROW;
+        GC_NOTRIGGER;
+    } CONTRACTL_END;
+
+    // Read the generation before doing the lookup, so that code freed while we are
+    // looking it up invalidates the entry we are about to fill in.
+    LONG generation = ExecutionManager::GetCodeInfoCacheGeneration();
+
+    Entry * pEntry = &m_entries[((codeAddress >> 2) ^ (codeAddress >> 12)) % CacheSize];
+    if ((pEntry->m_generation == generation) && (pEntry->m_codeInfo.m_codeAddress == codeAddress))
+    {
+        *pCodeInfo = pEntry->m_codeInfo;
+        return;
+    }
+
+    pCodeInfo->Init(codeAddress);
+    if (!pCodeInfo->IsValid())
+        return;
+
+    // Decode the function entry now so that the cached copy carries it
+    pCodeInfo->GetFunctionEntry();
+
+    pEntry->m_codeInfo = *pCodeInfo;
+    pEntry->m_generation = generation;
+}
+
+#endif // !DACCESS_COMPILE
+
 #if defined(TARGET_AMD64)
 
 BOOL EECodeInfo::HasFrameRegister()
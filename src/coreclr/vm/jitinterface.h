@@ -264,6 +264,7 @@ public:
 #ifdef FEATURE_SVR_GC
         WRITE_BARRIER_SVR64,
 #endif // FEATURE_SVR_GC
+        WRITE_BARRIER_REGIONS64,
 #ifdef FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
         WRITE_BARRIER_WRITE_WATCH_PREGROW64,
         WRITE_BARRIER_WRITE_WATCH_POSTGROW64,
@@ -298,11 +299,14 @@ private:
 
     WriteBarrierType    m_currentWriteBarrier;
 
-    PBYTE   m_pWriteWatchTableImmediate;    // PREGROW | POSTGROW | SVR | WRITE_WATCH |
-    PBYTE   m_pLowerBoundImmediate;         // PREGROW | POSTGROW |     | WRITE_WATCH |
-    PBYTE   m_pCardTableImmediate;          // PREGROW | POSTGROW | SVR | WRITE_WATCH |
-    PBYTE   m_pCardBundleTableImmediate;    // PREGROW | POSTGROW | SVR | WRITE_WATCH |
-    PBYTE   m_pUpperBoundImmediate;         //         | POSTGROW |     | WRITE_WATCH |
+    PBYTE   m_pWriteWatchTableImmediate;    // PREGROW | POSTGROW | SVR | WRITE_WATCH |         |
+    PBYTE   m_pLowerBoundImmediate;         // PREGROW | POSTGROW |     | WRITE_WATCH | REGIONS |
+    PBYTE   m_pCardTableImmediate;          // PREGROW | POSTGROW | SVR | WRITE_WATCH | REGIONS |
+    PBYTE   m_pCardBundleTableImmediate;    // PREGROW | POSTGROW | SVR | WRITE_WATCH | REGIONS |
+    PBYTE   m_pUpperBoundImmediate;         //         | POSTGROW |     | WRITE_WATCH | REGIONS |
+    PBYTE   m_pRegionToGenerationImmediate; //         |          |     |             | REGIONS |
+    PBYTE   m_pRegionShrDestImmediate;      //         |          |     |             | REGIONS |
+    PBYTE   m_pRegionShrSrcImmediate;       //         |          |     |             | REGIONS |
 };
 
 #endif // TARGET_AMD64
@@ -404,6 +408,17 @@ extern "C"
 #endif // TARGET_ARM64
 };
 
+#ifdef TARGET_AMD64
+// The optional code paths of JIT_MemSet and JIT_MemCpy (crthelpers.S, CrtHelpers.asm). Set once by
+// EEJitManager::SetCpuInfo, until then the helpers only use SSE2. Mirrored in asmconstants.h.
+enum JitMemHelperFeatures
+{
+    JitMemHelper_Erms = 0x1,    // rep movsb/stosb are fast for large blocks
+    JitMemHelper_Avx2 = 0x2,    // 32 byte loops for medium sized blocks
+};
+
+extern "C" DWORD g_jitMemHelperFeatures;
+#endif // TARGET_AMD64
 
 
 /*********************************************************************/
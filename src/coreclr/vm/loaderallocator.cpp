@@ -7,7 +7,9 @@
 #include "virtualcallstub.h"
 #include "threadsuspend.h"
 #include "castcache.h"
+#include "finalizerthread.h"
 #include "mlinfo.h"
+#include "reflectioninvocation.h"
 #ifndef DACCESS_COMPILE
 #include "comdelegate.h"
 #endif
@@ -71,6 +73,7 @@ LoaderAllocator::LoaderAllocator()
     m_pVSDHeapInitialAlloc = NULL;
     m_pLastUsedCodeHeap = NULL;
     m_pLastUsedDynamicCodeHeap = NULL;
+    m_pLastUsedTier0CodeHeap = NULL;
     m_pJumpStubCache = NULL;
     m_IsCollectible = false;
 
@@ -81,6 +84,7 @@ LoaderAllocator::LoaderAllocator()
 #endif
 
     m_pUMEntryThunkCache = NULL;
+    m_pReflectionInvokePlanCache = NULL;
 
     m_nLoaderAllocator = InterlockedIncrement64((LONGLONG *)&LoaderAllocator::cLoaderAllocatorsCreated);
 
@@ -349,6 +353,20 @@ void LoaderAllocator::Mark()
     }
 }
 
+// Number of collected LoaderAllocators torn down per pass of the finalizer thread, 0 to tear them down
+// in code:LoaderAllocator::GCLoaderAllocators
+static DWORD GetTeardownBatchSize()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    static DWORD s_teardownBatchSize = (DWORD)-1;
+    if (s_teardownBatchSize == (DWORD)-1)
+    {
+        s_teardownBatchSize = CLRConfig::GetConfigValue(CLRConfig::EXTERNAL_LoaderAllocatorTeardownBatchSize);
+    }
+    return s_teardownBatchSize;
+}
+
 //---------------------------------------------------------------------------------------
 //
 // Collect unreferenced assemblies, remove them from the assembly list and return their loader allocator
@@ -579,8 +597,42 @@ void LoaderAllocator::GCLoaderAllocators(LoaderAllocator* pOriginalLoaderAllocat
         pFirstDestroyedLoaderAllocator = pOriginalLoaderAllocator;
     }
 
+    // The rest of the teardown deletes the DomainAssemblies and unloads code and stubs with the EE suspended.
+    // Unless the process is exiting, leave it to the finalizer thread, which spreads it over several
+    // shorter suspensions when many LoaderAllocators are collected together.
+    if (pFirstDestroyedLoaderAllocator != NULL && !IsAtProcessExit() && GetTeardownBatchSize() != 0)
+    {
+        pAppDomain->QueueLoaderAllocatorsForTeardown(pFirstDestroyedLoaderAllocator);
+        FinalizerThread::EnableFinalization();
+        return;
+    }
+
+    TearDownLoaderAllocators(pAppDomain, pFirstDestroyedLoaderAllocator, 0);
+} // LoaderAllocator::GCLoaderAllocators
+
+//---------------------------------------------------------------------------------------
+//
+// Delete the remaining resources of a list of collected LoaderAllocators. cPending is the number of
+// LoaderAllocators that are still queued for teardown after this list.
+//
+//static
+void LoaderAllocator::TearDownLoaderAllocators(AppDomain * pAppDomain, LoaderAllocator * pFirstLoaderAllocator, DWORD cPending)
+{
+    CONTRACTL
+    {
+        THROWS;
+        GC_TRIGGERS;
+        MODE_PREEMPTIVE;
+    }
+    CONTRACTL_END;
+
+    if (pFirstLoaderAllocator == NULL)
+        return;
+
+    DWORD cLoaderAllocators = 0;
+
     // Iterate through free list, deleting DomainAssemblies
-    pDomainLoaderAllocatorDestroyIterator = pFirstDestroyedLoaderAllocator;
+    LoaderAllocator * pDomainLoaderAllocatorDestroyIterator = pFirstLoaderAllocator;
     while (pDomainLoaderAllocatorDestroyIterator != NULL)
     {
         _ASSERTE(!pDomainLoaderAllocatorDestroyIterator->IsAlive());
@@ -597,44 +649,57 @@ void LoaderAllocator::GCLoaderAllocators(LoaderAllocator* pOriginalLoaderAllocat
 
         pDomainLoaderAllocatorDestroyIterator->ReleaseManagedAssemblyLoadContext();
 
-        // The following code was previously happening on delete ~DomainAssembly->Terminate
-        // We are moving this part here in order to make sure that we can unload a LoaderAllocator
-        // that didn't have a DomainAssembly
-        // (we have now a LoaderAllocator with 0-n DomainAssembly)
+        cLoaderAllocators++;
+        pDomainLoaderAllocatorDestroyIterator = pDomainLoaderAllocatorDestroyIterator->m_pLoaderAllocatorDestroyNext;
+    }
 
-        // This cleanup code starts resembling parts of AppDomain::Terminate too much.
-        // It would be useful to reduce duplication and also establish clear responsibilites
-        // for LoaderAllocator::Destroy, Assembly::Terminate, LoaderAllocator::Terminate
-        // and LoaderAllocator::~LoaderAllocator. We need to establish how these
-        // cleanup paths interact with app-domain unload and process tear-down, too.
+    // The following code was previously happening on delete ~DomainAssembly->Terminate
+    // We are moving this part here in order to make sure that we can unload a LoaderAllocator
+    // that didn't have a DomainAssembly
+    // (we have now a LoaderAllocator with 0-n DomainAssembly)
 
-        if (!IsAtProcessExit())
-        {
-            // Suspend the EE to do some clean up that can only occur
-            // while no threads are running.
-            GCX_COOP(); // SuspendEE may require current thread to be in Coop mode
-                        // SuspendEE cares about the reason flag only when invoked for a GC
-                        // Other values are typically ignored. If using SUSPEND_FOR_APPDOMAIN_SHUTDOWN
-                        // is inappropriate, we can introduce a new flag or hijack an unused one.
-            ThreadSuspend::SuspendEE(ThreadSuspend::SUSPEND_FOR_APPDOMAIN_SHUTDOWN);
-
-            // drop the cast cache while still in COOP mode.
-            CastCache::FlushCurrentCache();
-        }
+    // This cleanup code starts resembling parts of AppDomain::Terminate too much.
+    // It would be useful to reduce duplication and also establish clear responsibilites
+    // for LoaderAllocator::Destroy, Assembly::Terminate, LoaderAllocator::Terminate
+    // and LoaderAllocator::~LoaderAllocator. We need to establish how these
+    // cleanup paths interact with app-domain unload and process tear-down, too.
+
+    if (!IsAtProcessExit())
+    {
+        // Suspend the EE to do some clean up that can only occur
+        // while no threads are running.
+        GCX_COOP(); // SuspendEE may require current thread to be in Coop mode
+                    // SuspendEE cares about the reason flag only when invoked for a GC
+                    // Other values are typically ignored. If using SUSPEND_FOR_APPDOMAIN_SHUTDOWN
+                    // is inappropriate, we can introduce a new flag or hijack an unused one.
+        ThreadSuspend::SuspendEE(ThreadSuspend::SUSPEND_FOR_APPDOMAIN_SHUTDOWN);
 
+        // drop the cast cache while still in COOP mode.
+        CastCache::FlushCurrentCache();
+    }
+
+    // A single suspension covers the whole list, so the caches below are flushed once for all of it
+    pDomainLoaderAllocatorDestroyIterator = pFirstLoaderAllocator;
+    while (pDomainLoaderAllocatorDestroyIterator != NULL)
+    {
         ExecutionManager::Unload(pDomainLoaderAllocatorDestroyIterator);
         pDomainLoaderAllocatorDestroyIterator->UninitVirtualCallStubManager();
 
-        // TODO: Do we really want to perform this on each LoaderAllocator?
-        MethodTable::ClearMethodDataCache();
-        ClearJitGenericHandleCache(pAppDomain);
+        pDomainLoaderAllocatorDestroyIterator = pDomainLoaderAllocatorDestroyIterator->m_pLoaderAllocatorDestroyNext;
+    }
+
+    MethodTable::ClearMethodDataCache();
+    ClearJitGenericHandleCache(pAppDomain);
 
-        if (!IsAtProcessExit())
-        {
-            // Resume the EE.
-            ThreadSuspend::RestartEE(FALSE, TRUE);
-        }
+    if (!IsAtProcessExit())
+    {
+        // Resume the EE.
+        ThreadSuspend::RestartEE(FALSE, TRUE);
+    }
 
+    pDomainLoaderAllocatorDestroyIterator = pFirstLoaderAllocator;
+    while (pDomainLoaderAllocatorDestroyIterator != NULL)
+    {
         // Because RegisterLoaderAllocatorForDeletion is modifying m_pLoaderAllocatorDestroyNext, we are saving it here
         LoaderAllocator* pLoaderAllocatorDestroyNext = pDomainLoaderAllocatorDestroyIterator->m_pLoaderAllocatorDestroyNext;
 
@@ -648,7 +713,49 @@ void LoaderAllocator::GCLoaderAllocators(LoaderAllocator* pOriginalLoaderAllocat
     // Deleting the DomainAssemblies will have created a list of LoaderAllocator's on the AppDomain
     // Call this shutdown function to clean those up.
     pAppDomain->ShutdownFreeLoaderAllocators();
-} // LoaderAllocator::GCLoaderAllocators
+
+    FireEtwLoaderAllocatorUnloadProgress(cLoaderAllocators, cPending, GetClrInstanceId());
+} // LoaderAllocator::TearDownLoaderAllocators
+
+//---------------------------------------------------------------------------------------
+//
+//static
+BOOL LoaderAllocator::HasPendingTeardown()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    AppDomain * pAppDomain = AppDomain::GetCurrentDomain();
+    return pAppDomain != NULL && pAppDomain->HasPendingLoaderAllocatorTeardown();
+}
+
+//---------------------------------------------------------------------------------------
+//
+// Called on the finalizer thread, tears down one batch of the LoaderAllocators queued by
+// code:LoaderAllocator::GCLoaderAllocators and wakes the finalizer thread again while more are queued.
+//
+//static
+void LoaderAllocator::TearDownPendingLoaderAllocators()
+{
+    CONTRACTL
+    {
+        THROWS;
+        GC_TRIGGERS;
+        MODE_PREEMPTIVE;
+    }
+    CONTRACTL_END;
+
+    AppDomain * pAppDomain = AppDomain::GetCurrentDomain();
+
+    DWORD cRemaining = 0;
+    LoaderAllocator * pFirstLoaderAllocator = pAppDomain->DequeueLoaderAllocatorsForTeardown(max(GetTeardownBatchSize(), (DWORD)1), &cRemaining);
+
+    TearDownLoaderAllocators(pAppDomain, pFirstLoaderAllocator, cRemaining);
+
+    if (cRemaining != 0)
+    {
+        FinalizerThread::EnableFinalization();
+    }
+} // LoaderAllocator::TearDownPendingLoaderAllocators
 
 //---------------------------------------------------------------------------------------
 //
@@ -1340,6 +1447,9 @@ void LoaderAllocator::Terminate()
     delete m_pUMEntryThunkCache;
     m_pUMEntryThunkCache = NULL;
 
+    delete m_pReflectionInvokePlanCache;
+    m_pReflectionInvokePlanCache = NULL;
+
     m_crstLoaderAllocator.Destroy();
 #ifdef FEATURE_COMINTEROP
     m_ComCallWrapperCrst.Destroy();
@@ -1677,9 +1787,6 @@ void AssemblyLoaderAllocator::SetCollectible()
     CONTRACTL_END;
 
     m_IsCollectible = true;
-#ifndef DACCESS_COMPILE
-    m_pShuffleThunkCache = new ShuffleThunkCache(m_pStubHeap);
-#endif
 }
 
 #ifndef DACCESS_COMPILE
@@ -1693,9 +1800,6 @@ AssemblyLoaderAllocator::~AssemblyLoaderAllocator()
         VERIFY(m_binderToRelease->Release() == 0);
         m_binderToRelease = NULL;
     }
-
-    delete m_pShuffleThunkCache;
-    m_pShuffleThunkCache = NULL;
 }
 
 void AssemblyLoaderAllocator::RegisterBinder(CLRPrivBinderAssemblyLoadContext* binderToRelease)
@@ -1780,7 +1884,7 @@ STRINGREF *LoaderAllocator::IsStringInterned(STRINGREF *pString)
         LazyInitStringLiteralMap();
     }
     _ASSERTE(m_pStringLiteralMap);
-    return m_pStringLiteralMap->GetInternedString(pString, FALSE, !CanUnload());
+    return m_pStringLiteralMap->GetInternedString(pString, FALSE);
 }
 
 STRINGREF *LoaderAllocator::GetOrInternString(STRINGREF *pString)
@@ -1799,7 +1903,7 @@ STRINGREF *LoaderAllocator::GetOrInternString(STRINGREF *pString)
         LazyInitStringLiteralMap();
     }
     _ASSERTE(m_pStringLiteralMap);
-    return m_pStringLiteralMap->GetInternedString(pString, TRUE, !CanUnload());
+    return m_pStringLiteralMap->GetInternedString(pString, TRUE);
 }
 
 void AssemblyLoaderAllocator::RegisterHandleForCleanup(OBJECTHANDLE objHandle)
@@ -1993,6 +2097,31 @@ UMEntryThunkCache *LoaderAllocator::GetUMEntryThunkCache()
     return m_pUMEntryThunkCache;
 }
 
+ReflectionInvokePlanCache *LoaderAllocator::GetReflectionInvokePlanCache()
+{
+    CONTRACTL
+    {
+        THROWS;
+        GC_TRIGGERS;
+        MODE_ANY;
+        INJECT_FAULT(COMPlusThrowOM(););
+    }
+    CONTRACTL_END;
+
+    if (!m_pReflectionInvokePlanCache)
+    {
+        ReflectionInvokePlanCache *pReflectionInvokePlanCache = new ReflectionInvokePlanCache(this);
+
+        if (FastInterlockCompareExchangePointer(&m_pReflectionInvokePlanCache, pReflectionInvokePlanCache, NULL) != NULL)
+        {
+            // some thread swooped in and set the field
+            delete pReflectionInvokePlanCache;
+        }
+    }
+    _ASSERTE(m_pReflectionInvokePlanCache);
+    return m_pReflectionInvokePlanCache;
+}
+
 /* static */
 void LoaderAllocator::RemoveMemoryToLoaderAllocatorAssociation(LoaderAllocator* pLoaderAllocator)
 {
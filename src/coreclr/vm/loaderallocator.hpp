@@ -136,6 +136,7 @@ template <typename ELEMENT>
 class ListLockEntryBase;
 typedef ListLockEntryBase<void*> ListLockEntry;
 class UMEntryThunkCache;
+class ReflectionInvokePlanCache;
 
 #ifdef FEATURE_COMINTEROP
 class ComCallWrapperCache;
@@ -190,6 +191,9 @@ protected:
     // The cache is keyed by MethodDesc pointers.
     UMEntryThunkCache * m_pUMEntryThunkCache;
 
+    // Argument layouts of methods invoked through reflection, keyed by MethodDesc pointers.
+    ReflectionInvokePlanCache * m_pReflectionInvokePlanCache;
+
     // IL stub cache with fabricated MethodTable parented by a random module in this LoaderAllocator.
     ILStubCache         m_ILStubCache;
 
@@ -207,6 +211,7 @@ public:
     // ExecutionManager caches
     void * m_pLastUsedCodeHeap;
     void * m_pLastUsedDynamicCodeHeap;
+    void * m_pLastUsedTier0CodeHeap;
     void * m_pJumpStubCache;
 
     // LoaderAllocator GC Structures
@@ -394,6 +399,16 @@ public:
     // Collect unreferenced assemblies, delete all their remaining resources.
     static void GCLoaderAllocators(LoaderAllocator* firstLoaderAllocator);
 
+    // The code, stubs and DomainAssemblies of collected LoaderAllocators are torn down in batches
+    // on the finalizer thread, see code:LoaderAllocator::TearDownPendingLoaderAllocators.
+    static BOOL HasPendingTeardown();
+    static void TearDownPendingLoaderAllocators();
+
+private:
+    static void TearDownLoaderAllocators(AppDomain * pAppDomain, LoaderAllocator * pFirstLoaderAllocator, DWORD cPending);
+
+public:
+
     UINT64 GetCreationNumber() { LIMITED_METHOD_DAC_CONTRACT; return m_nLoaderAllocator; }
 
     // Ensure this LoaderAllocator has a reference to another LoaderAllocator
@@ -595,6 +610,7 @@ public:
     }
 
     UMEntryThunkCache *GetUMEntryThunkCache();
+    ReflectionInvokePlanCache *GetReflectionInvokePlanCache();
 
 #endif
 
@@ -703,10 +719,9 @@ class AssemblyLoaderAllocator : public LoaderAllocator
 protected:
     DAC_ALIGNAS(LoaderAllocator) // Align the first member to the alignment of the base class
     LoaderAllocatorID  m_Id;
-    ShuffleThunkCache* m_pShuffleThunkCache;
 public:
     virtual LoaderAllocatorID* Id();
-    AssemblyLoaderAllocator() : m_Id(LAT_Assembly), m_pShuffleThunkCache(NULL)
+    AssemblyLoaderAllocator() : m_Id(LAT_Assembly)
 #if !defined(DACCESS_COMPILE) && !defined(CROSSGEN_COMPILE)
         , m_binderToRelease(NULL)
 #endif
@@ -722,11 +737,6 @@ public:
         m_Id.AddDomainAssembly(pDomainAssembly);
     }
 
-    ShuffleThunkCache* GetShuffleThunkCache()
-    {
-        return m_pShuffleThunkCache;
-    }
-
 #if !defined(DACCESS_COMPILE) && !defined(CROSSGEN_COMPILE)
     virtual void RegisterHandleForCleanup(OBJECTHANDLE objHandle);
     virtual void UnregisterHandleFromCleanup(OBJECTHANDLE objHandle);
@@ -5491,6 +5491,9 @@ BOOL MethodDesc::ShouldSuppressGCTransition()
     }
 
     _ASSERTE(tgt != nullptr);
+    if (tgt->IsNDirect() && dac_cast<PTR_NDirectMethodDesc>(tgt)->IsSuppressGCTransitionInferred())
+        return TRUE;
+
     HRESULT hr = tgt->GetCustomAttribute(
         WellKnownAttribute::SuppressGCTransition,
         nullptr,
@@ -1835,7 +1835,7 @@ protected:
         enum_flag2_HasPrecode                           = 0x02,   // Precode has been allocated for this method
 
         enum_flag2_IsUnboxingStub                       = 0x04,
-        // unused                                       = 0x08,
+        enum_flag2_HasNoHeapWrites                      = 0x08,   // Jitted code for the method was found not to write to the heap
 
         enum_flag2_IsJitIntrinsic                       = 0x10,   // Jit may expand method as an intrinsic
 
@@ -1905,6 +1905,21 @@ public:
         m_bFlags2 |= enum_flag2_IsJitIntrinsic;
     }
 
+    // Set by the JIT (via setMethodAttribs) once it has proven that the optimized code
+    // for this method does not write to the GC heap. Callers may rely on this summary
+    // when optimizing calls to the method.
+    inline BOOL HasNoHeapWrites()
+    {
+        LIMITED_METHOD_DAC_CONTRACT;
+        return (m_bFlags2 & enum_flag2_HasNoHeapWrites) != 0;
+    }
+
+    inline void SetHasNoHeapWrites()
+    {
+        WRAPPER_NO_CONTRACT;
+        InterlockedUpdateFlags2(enum_flag2_HasNoHeapWrites, TRUE);
+    }
+
     BOOL RequiresCovariantReturnTypeChecking()
     {
         LIMITED_METHOD_DAC_CONTRACT;
@@ -2166,6 +2181,7 @@ public:
         QuickJitted,
         OptimizedTier1,
         OptimizedTier1OSR,
+        QuickJittedInstrumented,
 
         Count
     };
@@ -3027,6 +3043,9 @@ public:
         kIsQCall                        = 0x1000,
 
         kDefaultDllImportSearchPathsStatus = 0x2000, // either method has custom attribute or not.
+
+        kIsSuppressGCTransitionInferredCached = 0x4000, // Set if we have checked PInvokeNoGCTransitionList for this method
+        kCachedSuppressGCTransitionInferred   = 0x8000, // The method is blittable and its target is allow-listed as non-blocking
     };
 
     // Resolve the import to the NDirect target and set it on the NDirectMethodDesc.
@@ -3053,6 +3072,22 @@ public:
 
     BOOL ComputeMarshalingRequired();
 
+    // Whether the GC transition was found to be unnecessary for this method even though it is not
+    // marked with SuppressGCTransitionAttribute. See NDirect::InferSuppressGCTransition.
+    BOOL IsSuppressGCTransitionInferenceCached() const
+    {
+        LIMITED_METHOD_DAC_CONTRACT;
+
+        return (ndirect.m_wFlags & kIsSuppressGCTransitionInferredCached) != 0;
+    }
+
+    BOOL IsSuppressGCTransitionInferred() const
+    {
+        LIMITED_METHOD_DAC_CONTRACT;
+
+        return (ndirect.m_wFlags & kCachedSuppressGCTransitionInferred) != 0;
+    }
+
     // Atomically set specified flags. Only setting of the bits is supported.
     void InterlockedSetNDirectFlags(WORD wFlags);
 
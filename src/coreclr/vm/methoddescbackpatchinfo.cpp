@@ -80,6 +80,11 @@ void MethodDescBackpatchInfoTracker::Backpatch_Locked(MethodDesc *pMethodDesc, P
 
     GCX_COOP();
 
+#if defined(HOST_OSX) && defined(HOST_ARM64)
+    // Keep executable memory writable for the whole batch instead of toggling it for each slot
+    auto jitWriteEnableHolder = PAL_JITWriteEnable(true);
+#endif // defined(HOST_OSX) && defined(HOST_ARM64)
+
     auto lambda = [&entryPoint](OBJECTREF obj, MethodDesc *pMethodDesc, UINT_PTR slotData)
     {
 
@@ -1522,6 +1522,9 @@ BOOL MethodTable::CanCastToInterface(MethodTable *pTargetMT, TypeHandlePairList
         if (IsInterface() && IsEquivalentTo(pTargetMT))
             return TRUE;
 
+        // Cast cache misses for types with many interfaces end up here, make the next ones cheaper
+        EnsureInterfaceIndex();
+
         return ImplementsEquivalentInterface(pTargetMT);
     }
     else
@@ -2055,6 +2058,54 @@ NOINLINE BOOL MethodTable::ImplementsInterface(MethodTable *pInterface)
     return ImplementsInterfaceInline(pInterface);
 }
 
+//==========================================================================================
+void MethodTable::EnsureInterfaceIndex()
+{
+    CONTRACTL
+    {
+        THROWS;
+        GC_NOTRIGGER;
+        INJECT_FAULT(COMPlusThrowOM(););
+    }
+    CONTRACTL_END;
+
+    DWORD numInterfaces = GetNumInterfaces();
+    if (numInterfaces < InterfaceIndex::MinInterfaces)
+        return;
+
+    if (VolatileLoad(&GetWriteableData_NoLogging()->m_pInterfaceIndex) != NULL)
+        return;
+
+    // The interface map of a type that is not fully loaded may still hold approximate interfaces
+    if (!IsFullyLoaded())
+        return;
+
+    DWORD dwBuckets = 1;
+    while (dwBuckets < numInterfaces * 2)
+        dwBuckets <<= 1;
+
+    S_SIZE_T cbIndex = S_SIZE_T(offsetof(InterfaceIndex, m_pBuckets)) + S_SIZE_T(dwBuckets) * S_SIZE_T(sizeof(PTR_MethodTable));
+    InterfaceIndex *pIndex = (InterfaceIndex *)(void *)GetLoaderAllocator()->GetLowFrequencyHeap()->AllocMem(cbIndex);
+
+    // Memory allocated on loader heap is zero filled, so all the buckets start empty
+    pIndex->m_dwMask = dwBuckets - 1;
+
+    InterfaceMapIterator it = IterateInterfaceMap();
+    while (it.Next())
+    {
+        MethodTable *pItfMT = it.GetInterface();
+
+        DWORD dwBucket = InterfaceIndex::GetBucket(pItfMT, pIndex->m_dwMask);
+        while (pIndex->m_pBuckets[dwBucket] != NULL && pIndex->m_pBuckets[dwBucket] != pItfMT)
+            dwBucket = (dwBucket + 1) & pIndex->m_dwMask;
+
+        pIndex->m_pBuckets[dwBucket] = pItfMT;
+    }
+
+    // A thread that loses the race leaves its copy on the loader heap, it's freed with the loader allocator
+    InterlockedCompareExchangeT(&GetWriteableDataForWrite_NoLogging()->m_pInterfaceIndex, (PTR_InterfaceIndex)pIndex, (PTR_InterfaceIndex)NULL);
+}
+
 //==========================================================================================
 BOOL MethodTable::ImplementsEquivalentInterface(MethodTable *pInterface)
 {
@@ -4883,6 +4934,7 @@ void MethodTableWriteableData::Fixup(DataImage *image, MethodTable *pMT, BOOL ne
     STANDARD_VM_CONTRACT;
 
     image->ZeroField(this, offsetof(MethodTableWriteableData, m_hExposedClassObject), sizeof(m_hExposedClassObject));
+    image->ZeroPointerField(this, offsetof(MethodTableWriteableData, m_pInterfaceIndex));
 
     MethodTableWriteableData *pNewNgenPrivateMT = (MethodTableWriteableData*) image->GetImagePointer(this);
     _ASSERTE(pNewNgenPrivateMT != NULL);
@@ -288,6 +288,46 @@ typedef DPTR(CrossModuleGenericsStaticsInfo) PTR_CrossModuleGenericsStaticsInfo;
 // so that we can layout a read-only MethodTable with a pointer
 // to the writeable parts of the MethodTable in an ngen image
 //
+//
+// Set of the interfaces in the interface map of a type with many interfaces, so that a cast to an interface
+// the type does not implement doesn't have to scan the whole map. Open addressing with linear probing, the
+// table is at most half full. Built lazily, once the type is fully loaded and its interface map is exact.
+//
+struct InterfaceIndex
+{
+    // Types with fewer interfaces are scanned linearly, which is cheaper than hashing
+    static const DWORD MinInterfaces = 16;
+
+    DWORD m_dwMask;                 // Number of buckets - 1, the number of buckets is a power of 2
+    PTR_MethodTable m_pBuckets[1];  // NULL for an empty bucket
+
+    static DWORD GetBucket(MethodTable *pInterface, DWORD dwMask)
+    {
+        LIMITED_METHOD_CONTRACT;
+
+        // Method tables are pointer aligned, fold the high bits into the low ones
+        TADDR addr = dac_cast<TADDR>(pInterface);
+        return (DWORD)((addr >> 3) ^ (addr >> 11)) & dwMask;
+    }
+
+    BOOL Contains(MethodTable *pInterface)
+    {
+        LIMITED_METHOD_CONTRACT;
+
+        DWORD dwBucket = GetBucket(pInterface, m_dwMask);
+        for (;;)
+        {
+            MethodTable *pCurrent = m_pBuckets[dwBucket];
+            if (pCurrent == pInterface)
+                return TRUE;
+            if (pCurrent == NULL)
+                return FALSE;
+            dwBucket = (dwBucket + 1) & m_dwMask;
+        }
+    }
+};
+typedef DPTR(InterfaceIndex) PTR_InterfaceIndex;
+
 struct MethodTableWriteableData
 {
     friend class MethodTable;
@@ -343,6 +383,9 @@ struct MethodTableWriteableData
      */
     LOADERHANDLE m_hExposedClassObject;
 
+    // Set of the interfaces of types with many interfaces, see InterfaceIndex. NULL until built.
+    PTR_InterfaceIndex m_pInterfaceIndex;
+
 #ifdef _DEBUG
     // to avoid verify same method table too many times when it's not changing, we cache the GC count
     // on which the method table is verified. When fast GC STRESS is turned on, we only verify the MT if
@@ -2092,6 +2135,9 @@ public:
     BOOL ImplementsInterface(MethodTable *pInterface);
     BOOL ImplementsEquivalentInterface(MethodTable *pInterface);
 
+    // Builds the InterfaceIndex of a fully loaded type with many interfaces, if it doesn't have one yet
+    void EnsureInterfaceIndex();
+
     MethodDesc *GetMethodDescForInterfaceMethod(TypeHandle ownerType, MethodDesc *pInterfaceMD, BOOL throwOnConflict);
     MethodDesc *GetMethodDescForInterfaceMethod(MethodDesc *pInterfaceMD, BOOL throwOnConflict); // You can only use this one for non-generic interfaces
 
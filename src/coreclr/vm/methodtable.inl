@@ -1536,6 +1536,15 @@ FORCEINLINE BOOL MethodTable::ImplementsInterfaceInline(MethodTable *pInterface)
     if (numInterfaces == 0)
         return FALSE;
 
+#ifndef DACCESS_COMPILE
+    if (numInterfaces >= InterfaceIndex::MinInterfaces)
+    {
+        PTR_InterfaceIndex pIndex = VolatileLoadWithoutBarrier(&GetWriteableData_NoLogging()->m_pInterfaceIndex);
+        if (pIndex != NULL)
+            return pIndex->Contains(pInterface);
+    }
+#endif // !DACCESS_COMPILE
+
     InterfaceInfo_t *pInfo = GetInterfaceMap();
 
     do
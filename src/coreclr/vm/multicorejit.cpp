@@ -373,6 +373,152 @@ HRESULT MulticoreJitRecorder::WriteModuleRecord(IStream * pStream, const Recorde
 }
 
 
+// Write one record per encoded signature: <recordID> <info> <signature> <padding>
+static HRESULT WriteSignatureRecords(IStream * pStream, unsigned recordType, const RecorderGenericInfo * pInfos, LONG count)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_PREEMPTIVE;
+    }
+    CONTRACTL_END;
+
+    HRESULT hr = S_OK;
+
+    for (LONG i = 0 ; i < count && SUCCEEDED(hr); i++)
+    {
+        unsigned info = pInfos[i].genericInfo;
+        BYTE * pSignature = pInfos[i].genericSignature;
+        if (info == 0 && pSignature == nullptr)
+        {
+            continue;
+        }
+
+        DWORD sigSize = info & 0xFFFFFF;
+        DWORD dataSize = sigSize * sizeof(BYTE) + sizeof(DWORD) * 2;
+        DWORD dwSize = ((DWORD)(dataSize + sizeof(DWORD) - 1) / sizeof(DWORD)) * sizeof(DWORD);
+        _ASSERTE(dwSize <= 0xFFFFFF);
+        DWORD dwData = Pack8_24(recordType, dwSize);
+        hr = WriteData(pStream, &dwData, sizeof(dwData));
+        if (SUCCEEDED(hr))
+        {
+            hr = WriteData(pStream, &info, sizeof(unsigned));
+        }
+
+        if (SUCCEEDED(hr))
+        {
+            hr = WriteData(pStream, pSignature, sizeof(BYTE) * sigSize);
+        }
+
+        if (SUCCEEDED(hr))
+        {
+            DWORD init = 0;
+            hr = WriteData(pStream, &init, dwSize - dataSize);
+        }
+    }
+
+    return hr;
+}
+
+static void DeleteSignatureRecords(RecorderGenericInfo * pInfos, LONG count)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    if (pInfos != nullptr)
+    {
+        for (LONG i = 0; i < count; i++)
+        {
+            delete [] pInfos[i].genericSignature;
+        }
+        delete [] pInfos;
+    }
+}
+
+// Encode the types recorded by MulticoreJitManager::RecordTypeLoad, adding their modules as dependencies
+RecorderGenericInfo * MulticoreJitRecorder::EncodeRecordedTypes(LONG * pTypeInfoCount)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_TRIGGERS;
+        MODE_PREEMPTIVE;
+        CAN_TAKE_LOCK;
+    }
+    CONTRACTL_END;
+
+    LONG typeCount = 0;
+    TypeHandle * pTypes = m_pDomain->GetMulticoreJitManager().GetRecordedTypes(& typeCount);
+
+    * pTypeInfoCount = 0;
+
+    if ((pTypes == NULL) || (typeCount == 0))
+    {
+        return nullptr;
+    }
+
+    RecorderGenericInfo * typeInfoArray = new (nothrow) RecorderGenericInfo[typeCount]();
+    if (typeInfoArray == nullptr)
+    {
+        return nullptr;
+    }
+
+    for (LONG i = 0 ; i < typeCount; i++)
+    {
+        TypeHandle th = pTypes[i];
+        if (th.IsNull())
+        {
+            continue;
+        }
+
+        Module * pModule = th.GetModule();
+        if (! MulticoreJitManager::IsSupportedModule(pModule, false, m_fAppxMode))
+        {
+            continue;
+        }
+
+        SigBuilder sigBuilder;
+        DWORD moduleIndex = ENCODE_MODULE_FAILED;
+
+        BOOL fSuccess = false;
+        EX_TRY
+        {
+            moduleIndex = EncodeModule(pModule);
+            if (moduleIndex != ENCODE_MODULE_FAILED)
+            {
+                ZapSig zapSig(pModule, (LPVOID)this, ZapSig::MulticoreJitTokens, MulticoreJitManager::EncodeModuleHelper, NULL);
+                fSuccess = zapSig.GetSignatureForTypeHandle(th, &sigBuilder);
+            }
+        }
+        EX_CATCH
+        {
+        }
+        EX_END_CATCH(SwallowAllExceptions);
+
+        if (!fSuccess)
+        {
+            continue;
+        }
+
+        DWORD dwLength;
+        BYTE * pBlob = (BYTE*)sigBuilder.GetSignature(&dwLength);
+        _ASSERTE(dwLength <= 0xFFFFFF);
+        BYTE * pSignature = new (nothrow) BYTE[dwLength];
+        if (pSignature == nullptr)
+        {
+            continue;
+        }
+
+        memcpy(pSignature, pBlob, dwLength);
+        typeInfoArray[i].genericInfo = Pack8_24(moduleIndex, dwLength & 0xFFFFFF);
+        typeInfoArray[i].genericSignature = pSignature;
+    }
+
+    * pTypeInfoCount = typeCount;
+
+    return typeInfoArray;
+}
+
 HRESULT MulticoreJitRecorder::WriteOutput(IStream * pStream)
 {
     CONTRACTL
@@ -439,6 +585,10 @@ HRESULT MulticoreJitRecorder::WriteOutput(IStream * pStream)
         skippedGeneric = m_GenericInfoCount;
     }
 
+    // Preprocessing types, which may add modules and module dependencies as well
+    LONG typeInfoCount = 0;
+    RecorderGenericInfo * typeInfoArray = EncodeRecordedTypes(& typeInfoCount);
+
     {
         HeaderRecord header;
 
@@ -515,51 +665,21 @@ HRESULT MulticoreJitRecorder::WriteOutput(IStream * pStream)
         }
     }
 
-    if (SUCCEEDED(hr) && genericInfoArray != nullptr)
+    // Types are played back after module dependencies and methods, and before generic methods, which may depend on them
+    if (SUCCEEDED(hr) && typeInfoArray != nullptr)
     {
-        for (LONG i = 0 ; i < m_GenericInfoCount && SUCCEEDED(hr); i++)
-        {
-            unsigned info = genericInfoArray[i].genericInfo;
-            BYTE * pSignature = genericInfoArray[i].genericSignature;
-            if (info == 0 && pSignature == nullptr)
-            {
-                continue;
-            }
-
-            DWORD sigSize = info & 0xFFFFFF;
-            DWORD dataSize = sigSize * sizeof(BYTE) + sizeof(DWORD) * 2;
-            DWORD dwSize = ((DWORD)(dataSize + sizeof(DWORD) - 1) / sizeof(DWORD)) * sizeof(DWORD);
-            _ASSERTE(dwSize <= 0xFFFFFF);
-            dwData = Pack8_24(MULTICOREJIT_GENERICINF_RECORD_ID, dwSize);
-            hr = WriteData(pStream, &dwData, sizeof(dwData));
-            if (SUCCEEDED(hr))
-            {
-                hr = WriteData(pStream, &info, sizeof(unsigned));
-            }
-
-            if (SUCCEEDED(hr))
-            {
-                hr = WriteData(pStream, pSignature, sizeof(BYTE) * sigSize);
-            }
-
-            if (SUCCEEDED(hr))
-            {
-                DWORD init = 0;
-                hr = WriteData(pStream, &init, dwSize - dataSize);
-            }
-        }
+        hr = WriteSignatureRecords(pStream, MULTICOREJIT_TYPEINF_RECORD_ID, typeInfoArray, typeInfoCount);
     }
 
-    if (genericInfoArray != nullptr)
+    if (SUCCEEDED(hr) && genericInfoArray != nullptr)
     {
-        for (LONG i = 0; i < m_GenericInfoCount; i++)
-        {
-            delete [] genericInfoArray[i].genericSignature;
-        }
-        delete [] genericInfoArray;
+        hr = WriteSignatureRecords(pStream, MULTICOREJIT_GENERICINF_RECORD_ID, genericInfoArray, m_GenericInfoCount);
     }
 
-    MulticoreJitTrace(("New profile: %d modules, %d methods", m_ModuleCount, m_JitInfoCount));
+    DeleteSignatureRecords(typeInfoArray, typeInfoCount);
+    DeleteSignatureRecords(genericInfoArray, m_GenericInfoCount);
+
+    MulticoreJitTrace(("New profile: %d modules, %d methods, %d types", m_ModuleCount, m_JitInfoCount, typeInfoCount));
 
     _FireEtwMulticoreJit(W("WRITEPROFILE"), m_fullFileName.GetUnicode(), m_ModuleCount, m_JitInfoCount, 0);
 
@@ -1208,6 +1328,24 @@ void MulticoreJitManager::StartProfile(AppDomain * pDomain, ICLRPrivBinder *pBin
         {
             m_pMulticoreJitRecorder = pRecorder;
 
+            // The type buffer is never freed while the manager is alive, as type loads are recorded without taking m_playerLock
+            if (CLRConfig::GetConfigValue(CLRConfig::INTERNAL_MultiCoreJitTypeLoads) != 0)
+            {
+                if (m_pRecordedTypes == NULL)
+                {
+                    m_pRecordedTypes = new (nothrow) TypeHandle[MAX_TYPE_ARRAY];
+                }
+                else
+                {
+                    for (unsigned i = 0; i < MAX_TYPE_ARRAY; i ++)
+                    {
+                        m_pRecordedTypes[i] = TypeHandle();
+                    }
+                }
+
+                m_nRecordedTypeCount = 0;
+            }
+
             LONG sessionID = m_ProfileSession.Increment();
 
             HRESULT hr = m_pMulticoreJitRecorder->StartProfile(m_profileRoot, pProfile, suffix, sessionID);
@@ -1364,6 +1502,8 @@ MulticoreJitManager::MulticoreJitManager()
     m_fAutoStartCalled      = 0;
     m_fRecorderActive       = false;
     m_fAppxMode             = false;
+    m_pRecordedTypes        = NULL;
+    m_nRecordedTypeCount    = 0;
 
     m_playerLock.Init(CrstMulticoreJitManager, (CrstFlags)(CRST_TAKEN_DURING_SHUTDOWN));
     m_MulticoreJitCodeStorage.Init();
@@ -1382,6 +1522,8 @@ MulticoreJitManager::~MulticoreJitManager()
         m_pMulticoreJitRecorder = NULL;
     }
 
+    delete [] m_pRecordedTypes;
+
     m_playerLock.Destroy();
 }
 
@@ -1458,6 +1600,57 @@ void MulticoreJitManager::RecordMethodJit(MethodDesc * pMethod)
 }
 
 
+// Call back from ClassLoader::LoadTypeHandleForTypeKey when a type is fully loaded
+// Threading: lock free. The class loader may be holding locks that are not ordered before m_playerLock, so slots in
+// m_pRecordedTypes are claimed with an interlocked increment instead. The buffer is only reset by StartProfile, a type
+// recorded concurrently with that is only a hint for the player and does no harm.
+
+void MulticoreJitManager::RecordTypeLoad(TypeHandle th)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+    }
+    CONTRACTL_END;
+
+    TypeHandle * pRecordedTypes = VolatileLoad(& m_pRecordedTypes);
+
+    if ((pRecordedTypes == NULL) || ! m_fRecorderActive)
+    {
+        return;
+    }
+
+    // Types in collectible assemblies may be unloaded before the profile is written
+    if (th.IsTypeDesc() || th.ContainsGenericVariables() || th.GetLoaderAllocator()->IsCollectible())
+    {
+        return;
+    }
+
+    LONG index = InterlockedIncrement(& m_nRecordedTypeCount) - 1;
+
+    if (index < (LONG) MAX_TYPE_ARRAY)
+    {
+        pRecordedTypes[index] = th;
+    }
+}
+
+
+// Threading: protected by m_playerLock
+
+TypeHandle * MulticoreJitManager::GetRecordedTypes(LONG * pCount) const
+{
+    LIMITED_METHOD_CONTRACT;
+
+    LONG count = VolatileLoad(& m_nRecordedTypeCount);
+
+    * pCount = (count < (LONG) MAX_TYPE_ARRAY) ? count : (LONG) MAX_TYPE_ARRAY;
+
+    return m_pRecordedTypes;
+}
+
+
 // static
 bool MulticoreJitManager::IsMethodSupported(MethodDesc * pMethod)
 {
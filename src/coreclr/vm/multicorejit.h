@@ -56,6 +56,7 @@ struct MulticoreJitPlayerStat
 {
     unsigned short    m_nTotalMethod;
     unsigned short    m_nHasNativeCode;
+    unsigned short    m_nReadyToRunFixups;
     unsigned short    m_nTryCompiling;
     unsigned short    m_nFilteredMethods;
     unsigned short    m_nMissingModuleSkip;
@@ -211,6 +212,9 @@ private:
     CrstExplicitInit        m_playerLock;              // Thread protection (accessing m_pMulticoreJitRecorder)
     MulticoreJitPlayerStat  m_stats;                   // Statistics: normally gathered by player, written to profile
 
+    TypeHandle            * m_pRecordedTypes;          // Types loaded while recording, allocated when recording type loads is enabled
+    LONG                    m_nRecordedTypeCount;      // Number of slots claimed in m_pRecordedTypes, may exceed its capacity
+
     MulticoreJitCodeStorage m_MulticoreJitCodeStorage;
 
 public:
@@ -230,6 +234,8 @@ public:
         m_fAutoStartCalled      = 0;
         m_fRecorderActive       = false;
         m_fAppxMode             = false;
+        m_pRecordedTypes        = NULL;
+        m_nRecordedTypeCount    = 0;
     }
 
     ~MulticoreJitManager()
@@ -283,6 +289,17 @@ public:
 
     void RecordMethodJit(MethodDesc * pMethod);
 
+    inline bool IsRecordingTypeLoads() const
+    {
+        LIMITED_METHOD_CONTRACT;
+
+        return m_fRecorderActive && (m_pRecordedTypes != NULL);
+    }
+
+    void RecordTypeLoad(TypeHandle th);
+
+    TypeHandle * GetRecordedTypes(LONG * pCount) const;
+
     MulticoreJitPlayerStat & GetStats()
     {
         LIMITED_METHOD_CONTRACT;
@@ -36,6 +36,8 @@ const int      MULTICOREJITLIFE  = 60 * 1000;       // 60 seconds
 const int      MULTICOREJITBLOCKLIMIT = 10 * 1000;  // 10 seconds
 
 const unsigned MAX_GENERIC_ARRAY  = 16384;          // Maximum number of generics
+
+const unsigned MAX_TYPE_ARRAY     = 16384;          // Maximum number of types
                                                     //  8-bit module index
 
                                                     // Method JIT information: 8-bit module 4-bit flag 20-bit method index
@@ -55,12 +57,13 @@ const unsigned SIGNATURELENGTH_MASK  = 0x0FFFFFF;        // 24-bit signature len
 
 enum
 {
-    MULTICOREJIT_PROFILE_VERSION   = 101,
+    MULTICOREJIT_PROFILE_VERSION   = 102,
 
     MULTICOREJIT_HEADER_RECORD_ID          = 1,
     MULTICOREJIT_MODULE_RECORD_ID          = 2,
     MULTICOREJIT_JITINF_RECORD_ID          = 3,
-    MULTICOREJIT_GENERICINF_RECORD_ID      = 4
+    MULTICOREJIT_GENERICINF_RECORD_ID      = 4,
+    MULTICOREJIT_TYPEINF_RECORD_ID         = 5
 };
 
 
@@ -73,7 +76,7 @@ inline unsigned Pack8_24(unsigned up, unsigned low)
 
 // Multicore JIT profile format
 
-// <profile>::= <HeaderRecord> { <ModuleRecord> | <JitInfRecord> }
+// <profile>::= <HeaderRecord> { <ModuleRecord> | <JitInfRecord> | <TypeInfRecord> | <GenericInfRecord> }
 //
 //  1. Each record is DWORD aligned
 //  2. Each record starts with a DWORD <recordID> with Pack8_24(record type, record size)
@@ -86,6 +89,8 @@ inline unsigned Pack8_24(unsigned up, unsigned low)
 // <HeaderRecord>::= <recordID> <version> <timeStamp> <moduleCount> <methodCount> <DependencyCount> <unsigned short counter>*14 <unsigned counter>*3
 // <ModuleRecord>::= <recordID> <ModuleVersion> <JitMethodCount> <loadLevel> <lenModuleName> char*lenModuleName <padding>
 // <JifInfRecord>::= <recordID> { <moduleDependency> | <methodJitInfo> }
+// <TypeInfRecord>::= <recordID> <typeInfo> <signature> <padding>
+// <GenericInfRecord>::= <recordID> <methodInfo> <signature> <padding>
 
 // <moduleDependency>::
 //    8-bit source module index,  current always 0 until we track per module dependency
@@ -98,6 +103,10 @@ inline unsigned Pack8_24(unsigned up, unsigned low)
 //    4-bit flag                  MODULE_DEPENDENCY is 0, JIT_BY_APP_THREAD could be 1
 //   20-bit method index
 
+// <typeInfo>:: and <methodInfo>::
+//    8-bit module index
+//   24-bit signature length
+
 
 struct HeaderRecord
 {
@@ -255,6 +264,7 @@ private:
     MulticoreJitCounter              & m_appdomainSession;
     bool                               m_shouldAbort;
     bool                               m_fAppxMode;
+    bool                               m_fResolveReadyToRunFixups;
 
     Thread                           * m_pThread;
 
@@ -274,8 +284,12 @@ private:
     HRESULT HandleModuleRecord(const ModuleRecord * pModule);
     HRESULT HandleMethodRecord(unsigned * buffer, int count);
     HRESULT HandleGenericMethodRecord(unsigned moduleIndex, BYTE * signature, unsigned length);
+    HRESULT HandleTypeRecord(unsigned moduleIndex, BYTE * signature, unsigned length);
 
     bool CompileMethodDesc(Module * pModule, MethodDesc * pMD);
+#ifdef FEATURE_READYTORUN
+    bool ResolveReadyToRunFixups(Module * pModule, MethodDesc * pMD);
+#endif
     HRESULT PlayProfile();
 
     bool GroupWaitForModuleLoad(int pos);
@@ -333,6 +347,7 @@ struct RecorderModuleInfo
     bool SetModule(Module * pModule);
 };
 
+// Encoded signature of a generic method or a type, and the index of the module used to resolve its tokens
 struct RecorderGenericInfo
 {
     unsigned        genericInfo;
@@ -380,6 +395,7 @@ private:
 
     void RecordJitInfo(unsigned module, unsigned method);
     void RecordGenericInfo(MethodDesc * pMethod);
+    RecorderGenericInfo * EncodeRecordedTypes(LONG * pTypeInfoCount);
 
     void AddAllModulesInAsm(DomainAssembly * pAssembly);
 
@@ -384,6 +384,7 @@ MulticoreJitProfilePlayer::MulticoreJitProfilePlayer(ICLRPrivBinder * pBinderCon
     m_nLoadedModuleCount = 0;
     m_shouldAbort        = false;
     m_fAppxMode          = fAppxMode;
+    m_fResolveReadyToRunFixups = CLRConfig::GetConfigValue(CLRConfig::INTERNAL_MultiCoreJitReadyToRun) != 0;
 
     m_pThread            = NULL;
     m_pFileBuffer        = NULL;
@@ -602,6 +603,30 @@ bool MulticoreJitProfilePlayer::CompileMethodDesc(Module * pModule, MethodDesc *
 }
 
 
+#ifdef FEATURE_READYTORUN
+// Resolve the fixups of a method that has ReadyToRun code instead of jitting it
+bool MulticoreJitProfilePlayer::ResolveReadyToRunFixups(Module * pModule, MethodDesc * pMD)
+{
+    STANDARD_VM_CONTRACT;
+
+    bool resolved = false;
+
+    EX_TRY
+    {
+        // Reset the flag to allow managed code to be called in multicore JIT background thread from this routine
+        ThreadStateNCStackHolder holder(-1, Thread::TSNC_CallingManagedCodeDisabled);
+
+        resolved = pModule->GetReadyToRunInfo()->ResolveEntryPointFixups(pMD);
+    }
+    EX_CATCH
+    {
+    }
+    EX_END_CATCH(SwallowAllExceptions);
+
+    return resolved;
+}
+#endif // FEATURE_READYTORUN
+
 // Conditional JIT of a method
 void MulticoreJitProfilePlayer::JITMethod(Module * pModule, unsigned methodIndex)
 {
@@ -647,6 +672,15 @@ void MulticoreJitProfilePlayer::JITMethod(Module * pModule, unsigned methodIndex
 
                 return;
             }
+#ifdef FEATURE_READYTORUN
+            else if (m_fResolveReadyToRunFixups && pModule->IsReadyToRun() && ResolveReadyToRunFixups(pModule, pMethod))
+            {
+                // The application thread will use the precompiled code, its fixups are now resolved
+                m_stats.m_nReadyToRunFixups ++;
+
+                return;
+            }
+#endif
             else
             {
                 m_busyWith = methodIndex;
@@ -1196,6 +1230,46 @@ HRESULT MulticoreJitProfilePlayer::HandleGenericMethodRecord(unsigned moduleInde
     return hr;
 }
 
+// Load a type recorded by MulticoreJitManager::RecordTypeLoad ahead of the application thread needing it
+HRESULT MulticoreJitProfilePlayer::HandleTypeRecord(unsigned moduleIndex, BYTE * signature, unsigned length)
+{
+    STANDARD_VM_CONTRACT;
+
+    HRESULT hr = E_ABORT;
+
+    if (moduleIndex >= m_moduleCount)
+    {
+        m_stats.m_nMissingModuleSkip += 1;
+    }
+    else
+    {
+        PlayerModuleInfo & mod = m_pModules[moduleIndex];
+        if (mod.IsModuleLoaded())
+        {
+            Module * pModule = mod.m_pModule;
+
+            SigTypeContext typeContext;   // empty type context
+            ZapSig::Context zapSigContext(pModule, (void *)this, ZapSig::MulticoreJitTokens);
+            TypeHandle th;
+            EX_TRY
+            {
+                SigPointer sig((PCCOR_SIGNATURE)signature, length);
+                th = sig.GetTypeHandleThrowing(pModule, &typeContext, ClassLoader::LoadTypes, CLASS_LOADED, FALSE, NULL, &zapSigContext);
+            }
+            EX_CATCH
+            {
+            }
+            EX_END_CATCH(SwallowAllExceptions);
+
+            MulticoreJitTrace(("TypeRecord(%d) %s", moduleIndex, th.IsNull() ? "failed" : "loaded"));
+        }
+
+        hr = S_OK;
+    }
+
+    return hr;
+}
+
 void MulticoreJitProfilePlayer::TraceSummary()
 {
     LIMITED_METHOD_CONTRACT;
@@ -1208,12 +1282,13 @@ void MulticoreJitProfilePlayer::TraceSummary()
 
     unsigned compiled =   curStorage.GetStored();
 
-    MulticoreJitTrace(("PlayerSummary: %d total: %d no mod, %d filtered out, %d had code, %d other, %d tried, %d compiled, %d returned, %d%% efficiency, %d mod loaded, %d ms delay(%d)",
+    MulticoreJitTrace(("PlayerSummary: %d total: %d no mod, %d filtered out, %d had code, %d r2r fixups, %d other, %d tried, %d compiled, %d returned, %d%% efficiency, %d mod loaded, %d ms delay(%d)",
         m_stats.m_nTotalMethod,
         m_stats.m_nMissingModuleSkip,
         m_stats.m_nFilteredMethods,
         m_stats.m_nHasNativeCode,
-        m_stats.m_nTotalMethod - m_stats.m_nMissingModuleSkip - m_stats.m_nFilteredMethods - m_stats.m_nHasNativeCode - m_stats.m_nTryCompiling,
+        m_stats.m_nReadyToRunFixups,
+        m_stats.m_nTotalMethod - m_stats.m_nMissingModuleSkip - m_stats.m_nFilteredMethods - m_stats.m_nHasNativeCode - m_stats.m_nReadyToRunFixups - m_stats.m_nTryCompiling,
         m_stats.m_nTryCompiling,
         compiled,
         returned,
@@ -1388,6 +1463,20 @@ HRESULT MulticoreJitProfilePlayer::PlayProfile()
                 unsigned signatureLength = info & SIGNATURELENGTH_MASK;
                 hr = HandleGenericMethodRecord(moduleIndex, (BYTE *) (pBuffer + sizeof(unsigned) * 2), signatureLength);
             }
+            else if (rcdTyp == MULTICOREJIT_TYPEINF_RECORD_ID)
+            {
+                unsigned info = *(unsigned *)(pBuffer + sizeof(unsigned));
+                unsigned moduleIndex = info >> 24;
+                unsigned signatureLength = info & SIGNATURELENGTH_MASK;
+                if (signatureLength > rcdLen - sizeof(unsigned) * 2)
+                {
+                    hr = COR_E_BADIMAGEFORMAT;
+                }
+                else
+                {
+                    hr = HandleTypeRecord(moduleIndex, (BYTE *) (pBuffer + sizeof(unsigned) * 2), signatureLength);
+                }
+            }
             else
             {
                 hr = COR_E_BADIMAGEFORMAT;
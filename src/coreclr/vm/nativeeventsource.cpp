@@ -10,6 +10,7 @@
 
 #include "common.h"
 #include "nativeeventsource.h"
+#include "runtimecounters.h"
 
 #if defined(FEATURE_EVENTSOURCE_XPLAT)
 
@@ -133,4 +134,15 @@ void QCALLTYPE NativeEventLogger::LogThreadPoolWorkingThreadCount(__in_z uint co
 
     END_QCALL;
 }
+
+// Called on the managed event counter polling interval to publish the native runtime counters, see runtimecounters.h
+void QCALLTYPE NativeEventLogger::LogRuntimeCounters()
+{
+    QCALL_CONTRACT;
+    BEGIN_QCALL;
+
+    RuntimeCounters::FireCounterEvents();
+
+    END_QCALL;
+}
 #endif // FEATURE_PERFTRACING
@@ -184,6 +184,7 @@ protected:
                                         // PTR_.
         DWORD   m_eType;                // The entry types we're currently walking (Hot, Warm, Cold in that order)
         DWORD   m_cRemainingEntries;    // The remaining entries in the bucket chain (Hot or Cold entries only)
+        DWORD   m_dwWarmGrowVersion;    // The value of m_dwWarmGrowVersion when the walk of the warm entries started
     };
 
     // This opaque structure provides enumeration context when walking all entries in the table. Initialized
@@ -431,6 +432,11 @@ private:
     // the provided LookupContext to allow enumeration of any further matches.
     DPTR(VALUE) FindVolatileEntryByHash(NgenHashValue iHash, LookupContext *pContext);
 
+    // Determines whether a walk of the warm entries that started at the given grow version may have been
+    // disrupted by a concurrent GrowTable() and so could have missed entries. Waits for any such grow to
+    // complete, after which the caller should restart its walk of the warm entries.
+    bool ShouldRetryVolatileLookup(DWORD dwWarmGrowVersion);
+
 #ifndef DACCESS_COMPILE
     // Determine loader heap to be used for allocation of entries and bucket lists.
     LoaderHeap *GetHeap();
@@ -535,6 +541,9 @@ private:
     RelativePointer<DPTR(PTR_VolatileEntry)> m_pWarmBuckets;  // Pointer to a simple bucket list (array of VolatileEntry pointers)
     DWORD                                    m_cWarmBuckets;  // Count of buckets in the above array (always non-zero)
     DWORD                                    m_cWarmEntries;  // Count of elements in the warm section of the hash
+    DWORD                                    m_dwWarmGrowVersion; // Incremented before and after GrowTable()
+                                                                  // rearranges the warm bucket chains, so that
+                                                                  // it's odd while a grow is in progress
 
 #ifdef FEATURE_PREJIT
     PersistedEntries        m_sHotEntries;      // Hot persisted hash entries (if any)
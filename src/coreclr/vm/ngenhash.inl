@@ -54,6 +54,7 @@ NgenHashTable<NGEN_HASH_ARGS>::NgenHashTable(Module *pModule, LoaderHeap *pHeap,
 
     m_cWarmEntries = 0;
     m_cWarmBuckets = cInitialBuckets;
+    m_dwWarmGrowVersion = 0;
     m_pWarmBuckets.SetValue((PTR_VolatileEntry*)(void*)GetHeap()->AllocMem(cbBuckets));
 
     // Note: Memory allocated on loader heap is zero filled
@@ -194,10 +195,16 @@ void NgenHashTable<NGEN_HASH_ARGS>::GrowTable()
     // Note: Memory allocated on loader heap is zero filled
     // memset(pNewBuckets, 0, cNewBuckets * sizeof(PTR_VolatileEntry));
 
+    // Let concurrent readers know that the bucket chains are about to be rearranged. A reader that misses
+    // while a grow is in progress, or after one has started since the reader started walking, waits for the
+    // grow to complete and then walks the new bucket chains (see ShouldRetryVolatileLookup), rather than
+    // reporting a miss and falling back to looking up under the lock that is held here.
+    m_dwWarmGrowVersion++;
+    MemoryBarrier();
+
     // Run through the old table and transfer all the entries. Be sure not to mess with the integrity of the
-    // old table while we are doing this, as there can be concurrent readers! Note that it is OK if the
-    // concurrent reader misses out on a match, though - they will have to acquire the lock on a miss & try
-    // again.
+    // old table while we are doing this, as there can be concurrent readers! Entries are never freed, so a
+    // reader that wanders amongst the rearranged chains will only ever see valid entries.
     for (DWORD i = 0; i < m_cWarmBuckets; i++)
     {
         PTR_VolatileEntry pEntry = (GetWarmBuckets())[i];
@@ -228,10 +235,14 @@ void NgenHashTable<NGEN_HASH_ARGS>::GrowTable()
 
     // The new number of buckets has to be published last (prior to this readers may miscalculate a bucket
     // index, but the result will always be in range and they'll simply walk the wrong chain and get a miss,
-    // prompting a retry under the lock). If we let the count become visible unordered wrt to the bucket array
-    // itself a reader could potentially read buckets from beyond the end of the old bucket list).
+    // prompting a retry). If we let the count become visible unordered wrt to the bucket array itself a reader
+    // could potentially read buckets from beyond the end of the old bucket list).
     MemoryBarrier();
     m_cWarmBuckets = cNewBuckets;
+
+    // The grow is complete, readers waiting on it may now retry.
+    MemoryBarrier();
+    m_dwWarmGrowVersion++;
 }
 
 // Returns the next prime larger (or equal to) than the number given.
@@ -383,7 +394,16 @@ DPTR(VALUE) NgenHashTable<NGEN_HASH_ARGS>::BaseFindNextEntryByHash(LookupContext
             }
         }
 
-        // We didn't find a match, fall through to the cold entries.
+        // We didn't find a match. If the bucket chains were rearranged while we were walking them, walk them
+        // again. This may return entries that were already seen, the caller compares keys anyway.
+        if (ShouldRetryVolatileLookup(pContext->m_dwWarmGrowVersion))
+        {
+            DPTR(VALUE) pRetry = FindVolatileEntryByHash(iHash, pContext);
+            if (pRetry)
+                return pRetry;
+        }
+
+        // Fall through to the cold entries.
 #ifdef FEATURE_PREJIT
         return FindPersistedEntryByHash(&m_sColdEntries, iHash, pContext);
 #else
@@ -1001,6 +1021,7 @@ void NgenHashTable<NGEN_HASH_ARGS>::BaseSave(DataImage *pImage, CorProfileData *
     NgenHashTable<NGEN_HASH_ARGS> *pNewTable = (NgenHashTable<NGEN_HASH_ARGS>*)pImage->GetImagePointer(this);
     pNewTable->m_cWarmEntries = 0;
     pNewTable->m_cWarmBuckets = cNewWarmBuckets;
+    pNewTable->m_dwWarmGrowVersion = 0;
 
     // Zero-out the ngen version of the warm buckets.
     VolatileEntry *pNewBuckets = (VolatileEntry*)pImage->GetImagePointer(GetWarmBuckets());
@@ -1258,37 +1279,82 @@ DPTR(VALUE) NgenHashTable<NGEN_HASH_ARGS>::FindVolatileEntryByHash(NgenHashValue
     // Since there is at least one entry there must be at least one bucket.
     _ASSERTE(m_cWarmBuckets > 0);
 
-    // Compute which bucket the entry belongs in based on the hash.
-    DWORD dwBucket = iHash % VolatileLoad(&m_cWarmBuckets);
+    DWORD dwWarmGrowVersion;
+    do
+    {
+        // Remember the grow version before reading the bucket list, to detect a concurrent GrowTable().
+        dwWarmGrowVersion = VolatileLoad(&m_dwWarmGrowVersion);
 
-    // Point at the first entry in the bucket chain which would contain any entries with the given hash code.
-    PTR_VolatileEntry pEntry = (GetWarmBuckets())[dwBucket];
+        // Compute which bucket the entry belongs in based on the hash.
+        DWORD dwBucket = iHash % VolatileLoad(&m_cWarmBuckets);
 
-    // Walk the bucket chain one entry at a time.
-    while (pEntry)
-    {
-        if (pEntry->m_iHashValue == iHash)
+        // Point at the first entry in the bucket chain which would contain any entries with the given hash code.
+        PTR_VolatileEntry pEntry = (GetWarmBuckets())[dwBucket];
+
+        // Walk the bucket chain one entry at a time.
+        while (pEntry)
         {
-            // We've found our match.
+            if (pEntry->m_iHashValue == iHash)
+            {
+                // We've found our match.
 
-            // Record our current search state into the provided context so that a subsequent call to
-            // BaseFindNextEntryByHash can pick up the search where it left off.
-            pContext->m_pEntry = dac_cast<TADDR>(pEntry);
-            pContext->m_eType = Warm;
+                // Record our current search state into the provided context so that a subsequent call to
+                // BaseFindNextEntryByHash can pick up the search where it left off.
+                pContext->m_pEntry = dac_cast<TADDR>(pEntry);
+                pContext->m_eType = Warm;
+                pContext->m_dwWarmGrowVersion = dwWarmGrowVersion;
 
-            // Return the address of the sub-classes' embedded entry structure.
-            return VALUE_FROM_VOLATILE_ENTRY(pEntry);
+                // Return the address of the sub-classes' embedded entry structure.
+                return VALUE_FROM_VOLATILE_ENTRY(pEntry);
+            }
+
+            // Move to the next entry in the chain.
+            pEntry = pEntry->m_pNextEntry;
         }
 
-        // Move to the next entry in the chain.
-        pEntry = pEntry->m_pNextEntry;
-    }
+        // If we get here then none of the entries in the target bucket matched the hash code. Unless the
+        // bucket chains were rearranged while we walked them, we have a miss (for this section of the table
+        // at least).
+    } while (ShouldRetryVolatileLookup(dwWarmGrowVersion));
 
-    // If we get here then none of the entries in the target bucket matched the hash code and we have a miss
-    // (for this section of the table at least).
     return NULL;
 }
 
+template <NGEN_HASH_PARAMS>
+bool NgenHashTable<NGEN_HASH_ARGS>::ShouldRetryVolatileLookup(DWORD dwWarmGrowVersion)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+        SUPPORTS_DAC;
+    }
+    CONTRACTL_END;
+
+#ifdef DACCESS_COMPILE
+    // The target is not running, the table cannot change beneath us.
+    return false;
+#else
+    // Order the loads of the walk before the load of the grow version below.
+    VolatileLoadBarrier();
+
+    DWORD dwCurrentVersion = VolatileLoad(&m_dwWarmGrowVersion);
+    if (dwCurrentVersion == dwWarmGrowVersion && (dwCurrentVersion & 1) == 0)
+        return false;
+
+    // A grow started after we started walking, or was already in progress. It does not take long and is done
+    // by the thread holding the writer lock, so wait for it to complete without taking any lock.
+    DWORD dwSwitchCount = 0;
+    while (VolatileLoad(&m_dwWarmGrowVersion) & 1)
+    {
+        __SwitchToThread(0, ++dwSwitchCount);
+    }
+
+    return true;
+#endif // DACCESS_COMPILE
+}
+
 // Initializes the iterator context passed by the caller to make it ready to walk every entry in the table in
 // an arbitrary order. Call pIterator->Next() to retrieve the first entry.
 template <NGEN_HASH_PARAMS>
@@ -24,6 +24,18 @@
 Volatile<bool> PerfMap::s_enabled = false;
 PerfMap * PerfMap::s_Current = nullptr;
 bool PerfMap::s_ShowOptimizationTiers = false;
+bool PerfMap::s_WritePerfMap = true;
+bool PerfMap::s_WriteJitDump = true;
+bool PerfMap::s_StubsOnly = false;
+
+// Values of PerfMapEnabled.
+enum
+{
+    PERFMAP_DISABLED = 0,
+    PERFMAP_ALL = 1,
+    PERFMAP_JITDUMP_ONLY = 2,
+    PERFMAP_PERFMAP_ONLY = 3,
+};
 
 // Initialize the map for the process - called from EEStartupHelper.
 void PerfMap::Initialize()
@@ -31,8 +43,13 @@ void PerfMap::Initialize()
     LIMITED_METHOD_CONTRACT;
 
     // Only enable the map if requested.
-    if (CLRConfig::GetConfigValue(CLRConfig::EXTERNAL_PerfMapEnabled))
+    DWORD perfMapEnabled = CLRConfig::GetConfigValue(CLRConfig::EXTERNAL_PerfMapEnabled);
+    if (perfMapEnabled != PERFMAP_DISABLED)
     {
+        s_WritePerfMap = (perfMapEnabled != PERFMAP_JITDUMP_ONLY);
+        s_WriteJitDump = (perfMapEnabled != PERFMAP_PERFMAP_ONLY);
+        s_StubsOnly = (CLRConfig::GetConfigValue(CLRConfig::EXTERNAL_PerfMapStubsOnly) != 0);
+
         // Get the current process id.
         int currentPid = GetCurrentProcessId();
 
@@ -54,19 +71,22 @@ void PerfMap::Initialize()
         s_enabled = true;
 
 #ifndef CROSSGEN_COMPILE
-        char jitdumpPath[4096];
+        if (s_WriteJitDump)
+        {
+            char jitdumpPath[4096];
 
         // CLRConfig::GetConfigValue(CLRConfig::EXTERNAL_PerfMapJitDumpPath) returns a LPWSTR
         // Use GetEnvironmentVariableA because it is simpler.
         // Keep comment here to make it searchable.
-        DWORD len = GetEnvironmentVariableA("COMPlus_PerfMapJitDumpPath", jitdumpPath, sizeof(jitdumpPath) - 1);
+            DWORD len = GetEnvironmentVariableA("COMPlus_PerfMapJitDumpPath", jitdumpPath, sizeof(jitdumpPath) - 1);
 
-        if (len == 0)
-        {
-            GetTempPathA(sizeof(jitdumpPath) - 1, jitdumpPath);
-        }
+            if (len == 0)
+            {
+                GetTempPathA(sizeof(jitdumpPath) - 1, jitdumpPath);
+            }
 
-        PAL_PerfJitDump_Start(jitdumpPath);
+            PAL_PerfJitDump_Start(jitdumpPath);
+        }
 #endif // CROSSGEN_COMPILE
     }
 }
@@ -79,6 +99,12 @@ void PerfMap::Destroy()
     if (s_enabled)
     {
         s_enabled = false;
+
+#ifndef CROSSGEN_COMPILE
+        s_Current->StopWriter();
+#endif // CROSSGEN_COMPILE
+        s_Current->Flush();
+
         // PAL_PerfJitDump_Finish is lock protected and can safely be called multiple times
         PAL_PerfJitDump_Finish();
     }
@@ -86,6 +112,9 @@ void PerfMap::Destroy()
 
 // Construct a new map for the process.
 PerfMap::PerfMap(int pid)
+  : m_FileStream(nullptr)
+  , m_PerfInfo(nullptr)
+  , m_BufferLock(CrstLeafLock, CRST_UNSAFE_ANYMODE)
 {
     LIMITED_METHOD_CONTRACT;
 
@@ -94,6 +123,13 @@ PerfMap::PerfMap(int pid)
 
     m_StubsMapped = 0;
 
+    InitializeBuffers();
+
+    if (!s_WritePerfMap)
+    {
+        return;
+    }
+
     // Build the path to the map file on disk.
     WCHAR tempPath[MAX_LONGPATH+1];
     if(!GetTempPathW(MAX_LONGPATH, tempPath))
@@ -108,6 +144,17 @@ PerfMap::PerfMap(int pid)
     OpenFile(path);
 
     m_PerfInfo = new PerfInfo(pid);
+
+#ifndef CROSSGEN_COMPILE
+    if (m_FileStream != nullptr && m_Buffer != nullptr && m_FlushEvent.CreateAutoEventNoThrow(FALSE))
+    {
+        m_WriterThread = Thread::CreateUtilityThread(Thread::StackSize_Small, WriterThreadStart, this, W(".NET Perf map writer"));
+        if (m_WriterThread == NULL)
+        {
+            m_FlushEvent.CloseEvent();
+        }
+    }
+#endif // CROSSGEN_COMPILE
 }
 
 // Construct a new map without a specified file name.
@@ -115,6 +162,7 @@ PerfMap::PerfMap(int pid)
 PerfMap::PerfMap()
   : m_FileStream(nullptr)
   , m_PerfInfo(nullptr)
+  , m_BufferLock(CrstLeafLock, CRST_UNSAFE_ANYMODE)
 {
     LIMITED_METHOD_CONTRACT;
 
@@ -122,6 +170,8 @@ PerfMap::PerfMap()
     m_ErrorEncountered = false;
 
     m_StubsMapped = 0;
+
+    InitializeBuffers();
 }
 
 // Clean-up resources.
@@ -129,6 +179,17 @@ PerfMap::~PerfMap()
 {
     LIMITED_METHOD_CONTRACT;
 
+#ifndef CROSSGEN_COMPILE
+    StopWriter();
+#endif // CROSSGEN_COMPILE
+    Flush();
+
+    delete [] m_Buffer;
+    m_Buffer = nullptr;
+
+    delete [] m_SpareBuffer;
+    m_SpareBuffer = nullptr;
+
     delete m_FileStream;
     m_FileStream = nullptr;
 
@@ -154,6 +215,174 @@ void PerfMap::OpenFile(SString& path)
     }
 }
 
+// Allocate the line buffers. Lines are written directly to the file if this fails.
+void PerfMap::InitializeBuffers()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    m_BufferUsed = 0;
+    m_SpareUsed = 0;
+    m_Buffer = new (nothrow) BYTE[s_BufferSize];
+    m_SpareBuffer = new (nothrow) BYTE[s_BufferSize];
+
+    if (m_Buffer == nullptr || m_SpareBuffer == nullptr)
+    {
+        delete [] m_Buffer;
+        m_Buffer = nullptr;
+
+        delete [] m_SpareBuffer;
+        m_SpareBuffer = nullptr;
+    }
+
+#ifndef CROSSGEN_COMPILE
+    m_WriterThread = NULL;
+    m_StopWriter = false;
+#endif // CROSSGEN_COMPILE
+}
+
+// Write raw bytes to the map file.
+void PerfMap::WriteToFile(const BYTE * pData, size_t size)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    if (m_FileStream == nullptr || m_ErrorEncountered || size == 0)
+    {
+        return;
+    }
+
+    // The PAL already takes a lock when writing, so we don't need to do so here.
+    ULONG inCount = (ULONG)size;
+    ULONG outCount;
+    HRESULT hr = m_FileStream->Write(pData, inCount, &outCount);
+
+    if (FAILED(hr) || inCount != outCount)
+    {
+        // This will cause us to stop writing to the file.
+        // The file will still remain open until shutdown so that we don't have to take a lock at this level when we touch the file stream.
+        m_ErrorEncountered = true;
+    }
+}
+
+// Hand the current buffer to the writer thread or write it out. Must be called with m_BufferLock held.
+void PerfMap::FlushBufferLocked()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    _ASSERTE(m_BufferLock.OwnedByCurrentThread());
+
+#ifndef CROSSGEN_COMPILE
+    if (m_WriterThread != NULL && !m_StopWriter && m_SpareUsed == 0)
+    {
+        // The writer is idle, give it the full buffer and keep going with the empty one.
+        BYTE * pFull = m_Buffer;
+        m_Buffer = m_SpareBuffer;
+        m_SpareBuffer = pFull;
+        m_SpareUsed = m_BufferUsed;
+        m_BufferUsed = 0;
+
+        m_FlushEvent.Set();
+        return;
+    }
+#endif // CROSSGEN_COMPILE
+
+    // No writer thread, or it has not caught up yet. Write the buffer out on this thread.
+    WriteToFile(m_Buffer, m_BufferUsed);
+    m_BufferUsed = 0;
+}
+
+// Write out everything that is buffered.
+void PerfMap::Flush()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    if (m_Buffer == nullptr)
+    {
+        return;
+    }
+
+    CrstHolder ch(&m_BufferLock);
+
+#ifndef CROSSGEN_COMPILE
+    // Only reached once the writer thread is gone, so the spare buffer is not in use.
+    if (m_WriterThread == NULL)
+#endif // CROSSGEN_COMPILE
+    {
+        WriteToFile(m_SpareBuffer, m_SpareUsed);
+        m_SpareUsed = 0;
+    }
+
+    WriteToFile(m_Buffer, m_BufferUsed);
+    m_BufferUsed = 0;
+}
+
+#ifndef CROSSGEN_COMPILE
+// Stop the writer thread, writing out what it has been given.
+void PerfMap::StopWriter()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    if (m_WriterThread == NULL)
+    {
+        return;
+    }
+
+    m_StopWriter = true;
+    m_FlushEvent.Set();
+
+    // Do not hold up shutdown indefinitely if the writer is stuck on the file.
+    if (WaitForSingleObject(m_WriterThread, 5000) == WAIT_OBJECT_0)
+    {
+        CloseHandle(m_WriterThread);
+        m_WriterThread = NULL;
+        m_FlushEvent.CloseEvent();
+    }
+}
+
+// Writes the buffers handed over by FlushBufferLocked, and partially filled buffers
+// every s_FlushIntervalMs so that the map stays reasonably up to date.
+DWORD WINAPI PerfMap::WriterThreadStart(LPVOID pArg)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    PerfMap * pThis = (PerfMap *)pArg;
+
+    while (true)
+    {
+        pThis->m_FlushEvent.Wait(s_FlushIntervalMs, FALSE);
+
+        bool stop = pThis->m_StopWriter;
+
+        {
+            CrstHolder ch(&pThis->m_BufferLock);
+
+            if (pThis->m_SpareUsed == 0 && pThis->m_BufferUsed > 0)
+            {
+                BYTE * pFull = pThis->m_Buffer;
+                pThis->m_Buffer = pThis->m_SpareBuffer;
+                pThis->m_SpareBuffer = pFull;
+                pThis->m_SpareUsed = pThis->m_BufferUsed;
+                pThis->m_BufferUsed = 0;
+            }
+        }
+
+        // Appenders never touch the spare buffer while m_SpareUsed is not zero.
+        pThis->WriteToFile(pThis->m_SpareBuffer, pThis->m_SpareUsed);
+
+        {
+            CrstHolder ch(&pThis->m_BufferLock);
+            pThis->m_SpareUsed = 0;
+        }
+
+        if (stop)
+        {
+            break;
+        }
+    }
+
+    return 0;
+}
+#endif // CROSSGEN_COMPILE
+
 // Write a line to the map file.
 void PerfMap::WriteLine(SString& line)
 {
@@ -161,21 +390,32 @@ void PerfMap::WriteLine(SString& line)
 
     EX_TRY
     {
-        // Write the line.
-        // The PAL already takes a lock when writing, so we don't need to do so here.
         StackScratchBuffer scratch;
         const char * strLine = line.GetANSI(scratch);
-        ULONG inCount = line.GetCount();
-        ULONG outCount;
-        m_FileStream->Write(strLine, inCount, &outCount);
+        size_t count = line.GetCount();
+        bool buffered = false;
 
-        if (inCount != outCount)
+        if (m_Buffer != nullptr)
         {
-            // This will cause us to stop writing to the file.
-            // The file will still remain open until shutdown so that we don't have to take a lock at this level when we touch the file stream.
-            m_ErrorEncountered = true;
+            CrstHolder ch(&m_BufferLock);
+
+            if (m_BufferUsed + count > s_BufferSize)
+            {
+                FlushBufferLocked();
+            }
+
+            if (count <= s_BufferSize - m_BufferUsed)
+            {
+                memcpy(m_Buffer + m_BufferUsed, strLine, count);
+                m_BufferUsed += count;
+                buffered = true;
+            }
         }
 
+        if (!buffered)
+        {
+            WriteToFile((const BYTE *)strLine, count);
+        }
     }
     EX_CATCH{} EX_END_CATCH(SwallowAllExceptions);
 }
@@ -192,7 +432,8 @@ void PerfMap::LogMethod(MethodDesc * pMethod, PCODE pCode, size_t codeSize, cons
         PRECONDITION(codeSize > 0);
     } CONTRACTL_END;
 
-    if (m_FileStream == nullptr || m_ErrorEncountered)
+    bool writeMap = (m_FileStream != nullptr && !m_ErrorEncountered);
+    if (!writeMap && !s_WriteJitDump)
     {
         // A failure occurred, do not log.
         return;
@@ -211,12 +452,19 @@ void PerfMap::LogMethod(MethodDesc * pMethod, PCODE pCode, size_t codeSize, cons
         {
             name.AppendPrintf("[%s]", optimizationTier);
         }
-        SString line;
-        line.Printf(FMT_CODE_ADDR " %x %s\n", pCode, codeSize, name.GetANSI(scratch));
+        if (writeMap)
+        {
+            SString line;
+            line.Printf(FMT_CODE_ADDR " %x %s\n", pCode, codeSize, name.GetANSI(scratch));
 
-        // Write the line.
-        WriteLine(line);
-        PAL_PerfJitDump_LogMethod((void*)pCode, codeSize, name.GetANSI(scratch), nullptr, nullptr);
+            // Write the line.
+            WriteLine(line);
+        }
+
+        if (s_WriteJitDump)
+        {
+            PAL_PerfJitDump_LogMethod((void*)pCode, codeSize, name.GetANSI(scratch), nullptr, nullptr);
+        }
     }
     EX_CATCH{} EX_END_CATCH(SwallowAllExceptions);
 }
@@ -263,7 +511,7 @@ void PerfMap::LogJITCompiledMethod(MethodDesc * pMethod, PCODE pCode, size_t cod
 {
     LIMITED_METHOD_CONTRACT;
 
-    if (!s_enabled)
+    if (!s_enabled || s_StubsOnly)
     {
         return;
     }
@@ -284,7 +532,7 @@ void PerfMap::LogPreCompiledMethod(MethodDesc * pMethod, PCODE pCode)
 {
     LIMITED_METHOD_CONTRACT;
 
-    if (!s_enabled)
+    if (!s_enabled || s_StubsOnly || !s_WriteJitDump)
     {
         return;
     }
@@ -335,7 +583,13 @@ void PerfMap::LogStubs(const char* stubType, const char* stubOwner, PCODE pCode,
 {
     LIMITED_METHOD_CONTRACT;
 
-    if (!s_enabled || s_Current->m_FileStream == nullptr)
+    if (!s_enabled)
+    {
+        return;
+    }
+
+    bool writeMap = (s_Current->m_FileStream != nullptr && !s_Current->m_ErrorEncountered);
+    if (!writeMap && !s_WriteJitDump)
     {
         return;
     }
@@ -356,12 +610,19 @@ void PerfMap::LogStubs(const char* stubType, const char* stubOwner, PCODE pCode,
         StackScratchBuffer scratch;
         SString name;
         name.Printf("stub<%d> %s<%s>", ++(s_Current->m_StubsMapped), stubType, stubOwner);
-        SString line;
-        line.Printf(FMT_CODE_ADDR " %x %s\n", pCode, codeSize, name.GetANSI(scratch));
+        if (writeMap)
+        {
+            SString line;
+            line.Printf(FMT_CODE_ADDR " %x %s\n", pCode, codeSize, name.GetANSI(scratch));
 
-        // Write the line.
-        s_Current->WriteLine(line);
-        PAL_PerfJitDump_LogMethod((void*)pCode, codeSize, name.GetANSI(scratch), nullptr, nullptr);
+            // Write the line.
+            s_Current->WriteLine(line);
+        }
+
+        if (s_WriteJitDump)
+        {
+            PAL_PerfJitDump_LogMethod((void*)pCode, codeSize, name.GetANSI(scratch), nullptr, nullptr);
+        }
     }
     EX_CATCH{} EX_END_CATCH(SwallowAllExceptions);
 }
@@ -24,6 +24,19 @@ private:
     // Indicates whether optimization tiers should be shown for methods in perf maps
     static bool s_ShowOptimizationTiers;
 
+    // Indicates which outputs PerfMapEnabled selected.
+    static bool s_WritePerfMap;
+    static bool s_WriteJitDump;
+
+    // Indicates that only stubs should be logged.
+    static bool s_StubsOnly;
+
+    // Size of each of the two line buffers.
+    static const size_t s_BufferSize = 64 * 1024;
+
+    // How often the writer thread flushes a partially filled buffer.
+    static const DWORD s_FlushIntervalMs = 1000;
+
     // The file stream to write the map to.
     CFileStream * m_FileStream;
 
@@ -33,15 +46,51 @@ private:
     // Set to true if an error is encountered when writing to the file.
     bool m_ErrorEncountered;
 
-    // Set to true if an error is encountered when writing to the file.
+    // The number of stubs logged so far, used to name them.
     unsigned m_StubsMapped;
 
+    // Protects m_Buffer, m_BufferUsed and m_SpareUsed.
+    Crst m_BufferLock;
+
+    // Lines are appended to m_Buffer. When it fills up it is swapped with m_SpareBuffer,
+    // which the writer thread then writes to the file outside of the lock.
+    BYTE * m_Buffer;
+    size_t m_BufferUsed;
+    BYTE * m_SpareBuffer;
+    size_t m_SpareUsed;
+
+#ifndef CROSSGEN_COMPILE
+    // The background thread that writes the buffers and the event used to wake it up.
+    HANDLE m_WriterThread;
+    CLREvent m_FlushEvent;
+    Volatile<bool> m_StopWriter;
+#endif // CROSSGEN_COMPILE
+
     // Construct a new map for the specified pid.
     PerfMap(int pid);
 
+    // Allocate the line buffers.
+    void InitializeBuffers();
+
     // Write a line to the map file.
     void WriteLine(SString & line);
 
+    // Write raw bytes to the map file.
+    void WriteToFile(const BYTE * pData, size_t size);
+
+    // Hand the current buffer to the writer thread or write it out. Must be called with m_BufferLock held.
+    void FlushBufferLocked();
+
+    // Write out everything that is buffered.
+    void Flush();
+
+#ifndef CROSSGEN_COMPILE
+    // Stop the writer thread, writing out what it has been given.
+    void StopWriter();
+
+    static DWORD WINAPI WriterThreadStart(LPVOID pArg);
+#endif // CROSSGEN_COMPILE
+
 protected:
     // Construct a new map without a specified file name.
     // Used for offline creation of NGEN map files.
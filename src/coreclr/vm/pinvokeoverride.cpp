@@ -50,3 +50,75 @@ const void* PInvokeOverride::GetMethodImpl(const char* libraryName, const char*
 
     return DefaultResolveDllImport(libraryName, entrypointName);
 }
+
+// UTF-8 copy of the PInvokeNoGCTransitionList value, or an empty string if it is not set
+static char* s_noGCTransitionList = nullptr;
+static char s_emptyNoGCTransitionList[1] = "";
+
+static const char* GetNoGCTransitionList()
+{
+    STANDARD_VM_CONTRACT;
+
+    if (s_noGCTransitionList == nullptr)
+    {
+        char* list = s_emptyNoGCTransitionList;
+
+        NewArrayHolder<WCHAR> wszList = CLRConfig::GetConfigValue(CLRConfig::INTERNAL_PInvokeNoGCTransitionList);
+        if (wszList != NULL && *wszList != W('\0'))
+        {
+            int cbList = WideCharToMultiByte(CP_UTF8, 0, wszList, -1, NULL, 0, NULL, NULL);
+            if (cbList > 0)
+            {
+                NewArrayHolder<char> utf8List = new char[cbList];
+                if (WideCharToMultiByte(CP_UTF8, 0, wszList, -1, utf8List, cbList, NULL, NULL) == cbList)
+                {
+                    list = utf8List.Extract();
+                }
+            }
+        }
+
+        if (InterlockedCompareExchangeT(&s_noGCTransitionList, list, nullptr) != nullptr && list != s_emptyNoGCTransitionList)
+        {
+            delete[] list;
+        }
+    }
+
+    return s_noGCTransitionList;
+}
+
+bool PInvokeOverride::HasNoGCTransitionImpls()
+{
+    STANDARD_VM_CONTRACT;
+
+    return *GetNoGCTransitionList() != '\0';
+}
+
+bool PInvokeOverride::IsNoGCTransitionImpl(const char* libraryName, const char* entrypointName)
+{
+    STANDARD_VM_CONTRACT;
+
+    size_t cchLibraryName = strlen(libraryName);
+    size_t cchEntrypointName = strlen(entrypointName);
+
+    // Entries have the form library!entrypoint and are separated by semicolons
+    const char* entry = GetNoGCTransitionList();
+    while (*entry != '\0')
+    {
+        const char* entryEnd = strchr(entry, ';');
+        if (entryEnd == nullptr)
+            entryEnd = entry + strlen(entry);
+
+        if ((size_t)(entryEnd - entry) == cchLibraryName + 1 + cchEntrypointName
+            && strncmp(entry, libraryName, cchLibraryName) == 0
+            && entry[cchLibraryName] == '!'
+            && strncmp(entry + cchLibraryName + 1, entrypointName, cchEntrypointName) == 0)
+        {
+            LOG((LF_INTEROP, LL_INFO1000, "PInvoke allowed without GC transition: lib: %s, entry: %s \n", libraryName, entrypointName));
+            return true;
+        }
+
+        entry = (*entryEnd == ';') ? entryEnd + 1 : entryEnd;
+    }
+
+    return false;
+}
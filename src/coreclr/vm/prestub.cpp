@@ -18,6 +18,7 @@
 #include "dbginterface.h"
 #include "stubgen.h"
 #include "eventtrace.h"
+#include "runtimeprobes.h"
 #include "array.h"
 #include "compile.h"
 #include "ecall.h"
@@ -393,25 +394,25 @@ PCODE MethodDesc::PrepareILBasedCode(PrepareCodeConfig* pConfig)
 #ifdef FEATURE_READYTORUN
         if (IsDynamicMethod() && GetLoaderModule()->IsSystem() && MayUsePrecompiledILStub())
         {
-            // Images produced using crossgen2 have non-shareable pinvoke stubs which can't be used with the IL
-            // stubs that the runtime generates (they take no secret parameter, and each pinvoke has a separate code)
-            if (GetModule()->IsReadyToRun() && !GetModule()->GetReadyToRunInfo()->HasNonShareablePInvokeStubs())
+            DynamicMethodDesc* stubMethodDesc = this->AsDynamicMethodDesc();
+            if (stubMethodDesc->IsILStub() && stubMethodDesc->IsPInvokeStub())
             {
-                DynamicMethodDesc* stubMethodDesc = this->AsDynamicMethodDesc();
-                if (stubMethodDesc->IsILStub() && stubMethodDesc->IsPInvokeStub())
+                ILStubResolver* pStubResolver = stubMethodDesc->GetILStubResolver();
+                if (pStubResolver->GetStubType() == ILStubResolver::CLRToNativeInteropStub)
                 {
-                    ILStubResolver* pStubResolver = stubMethodDesc->GetILStubResolver();
-                    if (pStubResolver->GetStubType() == ILStubResolver::CLRToNativeInteropStub)
+                    // The precompiled stub lives in the image of the P/Invoke it was generated for, which is not
+                    // necessarily System.Private.CoreLib (see ReadyToRunCompilePInvokeStubs).
+                    // Images produced using crossgen2 have non-shareable pinvoke stubs which can't be used with the IL
+                    // stubs that the runtime generates (they take no secret parameter, and each pinvoke has a separate code)
+                    MethodDesc* pTargetMD = stubMethodDesc->GetILStubResolver()->GetStubTargetMethodDesc();
+                    Module* pTargetModule = (pTargetMD != NULL) ? pTargetMD->GetModule() : NULL;
+                    if (pTargetModule != NULL && pTargetModule->IsReadyToRun() && !pTargetModule->GetReadyToRunInfo()->HasNonShareablePInvokeStubs())
                     {
-                        MethodDesc* pTargetMD = stubMethodDesc->GetILStubResolver()->GetStubTargetMethodDesc();
-                        if (pTargetMD != NULL)
+                        pCode = pTargetMD->GetPrecompiledR2RCode(pConfig);
+                        if (pCode != NULL)
                         {
-                            pCode = pTargetMD->GetPrecompiledR2RCode(pConfig);
-                            if (pCode != NULL)
-                            {
-                                LOG_USING_R2R_CODE(this);
-                                pConfig->SetNativeCode(pCode, &pCode);
-                            }
+                            LOG_USING_R2R_CODE(this);
+                            pConfig->SetNativeCode(pCode, &pCode);
                         }
                     }
                 }
@@ -475,6 +476,21 @@ PCODE MethodDesc::GetPrecompiledCode(PrepareCodeConfig* pConfig, bool shouldTier
 #ifdef FEATURE_CODE_VERSIONING
                 pConfig->SetGeneratedOrLoadedNewCode();
 #endif
+#ifdef FEATURE_MULTICOREJIT
+                // Record the method so that the multi-core JIT player can resolve its fixups ahead of time
+                if (pConfig->NeedsMulticoreJitNotification())
+                {
+                    _ASSERTE(pConfig->GetCodeVersion().IsDefaultVersion());
+
+                    MulticoreJitManager & mcJitManager = GetAppDomain()->GetMulticoreJitManager();
+                    if (mcJitManager.IsRecorderActive() &&
+                        MulticoreJitManager::IsMethodSupported(this) &&
+                        CLRConfig::GetConfigValue(CLRConfig::INTERNAL_MultiCoreJitReadyToRun) != 0)
+                    {
+                        mcJitManager.RecordMethodJit(this);
+                    }
+                }
+#endif
 #ifdef FEATURE_TIERED_COMPILATION
                 if (shouldTier)
                 {
@@ -601,6 +617,19 @@ PCODE MethodDesc::GetPrecompiledR2RCode(PrepareCodeConfig* pConfig)
             pCode = pModule->GetReadyToRunInfo()->GetEntryPoint(this, pConfig, TRUE /* fFixups */);
         }
     }
+
+    // Lookup in the loader module of the instantiation. Instantiations over the types of an assembly, e.g. a framework
+    // collection over an app value type, are compiled into that assembly's image when the generic definition is in its
+    // version bubble.
+    if (pCode == NULL && HasClassOrMethodInstantiation())
+    {
+        Module * pLoaderModule = GetLoaderModule();
+        if (pLoaderModule != GetModule() && pLoaderModule != pModule &&
+            pLoaderModule->IsReadyToRun() && pLoaderModule->IsInSameVersionBubble(GetModule()))
+        {
+            pCode = pLoaderModule->GetReadyToRunInfo()->GetEntryPoint(this, pConfig, TRUE /* fFixups */);
+        }
+    }
 #endif
     return pCode;
 }
@@ -885,6 +914,8 @@ PCODE MethodDesc::JitCompileCodeLockedEventWrapper(PrepareCodeConfig* pConfig, J
     }
 #endif // PROFILING_SUPPORTED
 
+    RUNTIME_PROBE1(jit_start, this);
+
     if (!ETW_TRACING_CATEGORY_ENABLED(MICROSOFT_WINDOWS_DOTNETRUNTIME_PROVIDER_DOTNET_Context,
         TRACE_LEVEL_VERBOSE,
         CLR_JIT_KEYWORD))
@@ -927,6 +958,8 @@ PCODE MethodDesc::JitCompileCodeLockedEventWrapper(PrepareCodeConfig* pConfig, J
 
     }
 
+    RUNTIME_PROBE3(jit_end, this, pCode, sizeOfCode);
+
 #ifdef FEATURE_STACK_SAMPLING
     StackSampler::RecordJittingInfo(this, flags);
 #endif // FEATURE_STACK_SAMPLING
@@ -1287,6 +1320,9 @@ PrepareCodeConfig::JitOptimizationTier PrepareCodeConfig::GetJitOptimizationTier
                 case NativeCodeVersion::OptimizationTier0:
                     return JitOptimizationTier::QuickJitted;
 
+                case NativeCodeVersion::OptimizationTier0Instrumented:
+                    return JitOptimizationTier::QuickJittedInstrumented;
+
                 case NativeCodeVersion::OptimizationTier1:
                     return JitOptimizationTier::OptimizedTier1;
 
@@ -1318,6 +1354,7 @@ const char *PrepareCodeConfig::GetJitOptimizationTierStr(PrepareCodeConfig *conf
         case JitOptimizationTier::QuickJitted: return "QuickJitted";
         case JitOptimizationTier::OptimizedTier1: return "OptimizedTier1";
         case JitOptimizationTier::OptimizedTier1OSR: return "OptimizedTier1OSR";
+        case JitOptimizationTier::QuickJittedInstrumented: return "QuickJittedInstrumented";
 
         default:
             UNREACHABLE();
@@ -2776,6 +2813,116 @@ EXTERN_C PCODE STDCALL ExternalMethodFixupWorker(TransitionBlock * pTransitionBl
     return pCode;
 }
 
+//==========================================================================================
+// Patches the not yet resolved call cells of a ReadyToRun image whose targets already have a stable
+// entry point, so that the first call through them does not have to go through ExternalMethodFixupWorker.
+// Only targets that can be found without loading anything are bound, everything else is left to the
+// lazy path. Returns the number of cells that were patched.
+//
+COUNT_T ReadyToRunInfo::BindExternalMethodCells()
+{
+    STANDARD_VM_CONTRACT;
+
+#ifdef FEATURE_JIT_PITCHING
+    // Pitched methods must be removed from the candidate list by the fixup worker
+    return 0;
+#else
+    // Cells of composite images are shared by all the component assemblies, leave them to the lazy path
+    if (m_readyToRunCodeDisabled || m_isComponentAssembly || m_pSectionDelayLoadMethodCallThunks == NULL)
+    {
+        return 0;
+    }
+
+    PEImageLayout *pNativeImage = m_pModule->GetNativeOrReadyToRunImage();
+
+    TADDR pThunksStart = dac_cast<TADDR>(pNativeImage->GetRvaData(m_pSectionDelayLoadMethodCallThunks->VirtualAddress));
+    TADDR pThunksEnd = pThunksStart + m_pSectionDelayLoadMethodCallThunks->Size;
+
+    COUNT_T cBound = 0;
+
+    for (DWORD iSection = 0; iSection < m_nImportSections; iSection++)
+    {
+        PTR_CORCOMPILE_IMPORT_SECTION pImportSection = m_pImportSections + iSection;
+
+        // Method call cells are the only sections that carry a GC ref map. Cells that are patched in place as code, and
+        // cells of other kinds that also hold code pointers (e.g. ldftn targets), are not touched.
+        if ((pImportSection->Flags & (CORCOMPILE_IMPORT_FLAGS_PCODE | CORCOMPILE_IMPORT_FLAGS_CODE | CORCOMPILE_IMPORT_FLAGS_EAGER))
+                != CORCOMPILE_IMPORT_FLAGS_PCODE ||
+            pImportSection->AuxiliaryData == NULL ||
+            pImportSection->EntrySize != sizeof(TADDR))
+        {
+            continue;
+        }
+
+        COUNT_T cCells = pImportSection->Section.Size / sizeof(TADDR);
+        TADDR pCells = dac_cast<TADDR>(pNativeImage->GetRvaData(pImportSection->Section.VirtualAddress));
+        PTR_DWORD pSignatures = dac_cast<PTR_DWORD>(pNativeImage->GetRvaData(pImportSection->Signatures));
+
+        for (COUNT_T iCell = 0; iCell < cCells; iCell++)
+        {
+            TADDR pIndirection = pCells + iCell * sizeof(TADDR);
+
+            TADDR cellValue = VolatileLoadWithoutBarrier((TADDR *)pIndirection);
+            if (cellValue < pThunksStart || cellValue >= pThunksEnd)
+            {
+                // Already resolved
+                continue;
+            }
+
+            PCCOR_SIGNATURE pBlob = (BYTE *)pNativeImage->GetRvaData(pSignatures[iCell]);
+
+            BYTE kind = *pBlob++;
+
+            Module * pInfoModule = m_pModule;
+            if (kind & ENCODE_MODULE_OVERRIDE)
+            {
+                DWORD moduleIndex = CorSigUncompressData(pBlob);
+                pInfoModule = m_pModule->GetModuleFromIndexIfLoaded(moduleIndex);
+                if (pInfoModule == NULL)
+                {
+                    continue;
+                }
+                kind &= ~ENCODE_MODULE_OVERRIDE;
+            }
+
+            MethodDesc * pMD = NULL;
+            switch (kind)
+            {
+            case ENCODE_METHOD_ENTRY_DEF_TOKEN:
+                pMD = pInfoModule->LookupMethodDef(TokenFromRid(CorSigUncompressData(pBlob), mdtMethodDef));
+                break;
+
+            case ENCODE_METHOD_ENTRY_REF_TOKEN:
+                pMD = pInfoModule->LookupMemberRefAsMethod(TokenFromRid(CorSigUncompressData(pBlob), mdtMemberRef));
+                break;
+
+            default:
+                // Instantiated and virtual targets need the full signature decoding of the fixup worker
+                break;
+            }
+
+            if (pMD == NULL || pMD->IsVersionableWithVtableSlotBackpatch())
+            {
+                continue;
+            }
+
+            // The same check as in ExternalMethodFixupWorker. Methods that still call the prestub have not run yet and
+            // are bound on their first call.
+            PCODE pCode = pMD->GetMethodEntryPoint();
+            if (DoesSlotCallPrestub(pCode))
+            {
+                continue;
+            }
+
+            PatchNonVirtualExternalMethod(pMD, pCode, pImportSection, pIndirection);
+            cBound++;
+        }
+    }
+
+    return cBound;
+#endif // FEATURE_JIT_PITCHING
+}
+
 
 #if !defined(TARGET_X86) && !defined(TARGET_AMD64) && defined(FEATURE_PREJIT)
 
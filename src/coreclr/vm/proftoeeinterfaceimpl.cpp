@@ -567,6 +567,10 @@ COM_METHOD ProfToEEInterfaceImpl::QueryInterface(REFIID id, void ** pInterface)
     {
         *pInterface = static_cast<ICorProfilerInfo12 *>(this);
     }
+    else if (id == IID_ICorProfilerInfo13)
+    {
+        *pInterface = static_cast<ICorProfilerInfo13 *>(this);
+    }
     else if (id == IID_IUnknown)
     {
         *pInterface = static_cast<IUnknown *>(static_cast<ICorProfilerInfo *>(this));
@@ -1091,6 +1095,20 @@ bool HeapWalkHelper(Object * pBO, void * pvContext)
 
     ProfilerWalkHeapContext * pProfilerWalkHeapContext = (ProfilerWalkHeapContext *) pvContext;
 
+#ifdef FEATURE_EVENT_TRACE
+    // A type statistics heap dump doesn't need the references of each object, skip
+    // enumerating them unless a profapi profiler wants them
+    BOOL fEtwTypeStatisticsOnly = ETW::GCLog::ShouldLogHeapTypeStatisticsOnlyForEtw();
+    if (fEtwTypeStatisticsOnly && !pProfilerWalkHeapContext->fProfilerPinned)
+    {
+        ETW::GCLog::ObjectTypeStatistic(
+            pProfilerWalkHeapContext,
+            pBO,
+            (ULONGLONG) SafeGetClassIDFromObject(pBO));
+        return TRUE;
+    }
+#endif // FEATURE_EVENT_TRACE
+
     if (pMT->ContainsPointersOrCollectible())
     {
         // First round through calculates the number of object refs for this class
@@ -1140,7 +1158,14 @@ bool HeapWalkHelper(Object * pBO, void * pvContext)
 #endif
 
 #ifdef FEATURE_EVENT_TRACE
-    if (s_forcedGCInProgress &&
+    if (fEtwTypeStatisticsOnly)
+    {
+        ETW::GCLog::ObjectTypeStatistic(
+            pProfilerWalkHeapContext,
+            pBO,
+            (ULONGLONG) SafeGetClassIDFromObject(pBO));
+    }
+    else if (s_forcedGCInProgress &&
         ETW_TRACING_CATEGORY_ENABLED(MICROSOFT_WINDOWS_DOTNETRUNTIME_PROVIDER_DOTNET_Context,
                                      TRACE_LEVEL_INFORMATION,
                                      CLR_GCHEAPDUMP_KEYWORD))
@@ -5871,6 +5896,82 @@ HRESULT ProfToEEInterfaceImpl::SetEnterLeaveFunctionHooks3WithInfo(FunctionEnter
 }
 
 
+HRESULT ProfToEEInterfaceImpl::SetEnterLeaveBuffering(ULONG cRecordsPerThread)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+        EE_THREAD_NOT_REQUIRED;
+        CANNOT_TAKE_LOCK;
+    }
+    CONTRACTL_END;
+
+    // Like the hooks, buffering can only be turned on during initialization, since the
+    // JIT bakes the enter/leave calls into the code.
+    PROFILER_TO_CLR_ENTRYPOINT_SET_ELT((LF_CORPROF,
+                                        LL_INFO10,
+                                        "**PROF: SetEnterLeaveBuffering %u.\n",
+                                        cRecordsPerThread));
+
+    return g_profControlBlock.pProfInterface->SetEnterLeaveBuffering(cRecordsPerThread);
+}
+
+HRESULT ProfToEEInterfaceImpl::GetEnterLeaveRecords(ThreadID threadId,
+                                                    ULONG cRecords,
+                                                    ULONG *pcRecords,
+                                                    COR_PRF_ELT_RECORD records[],
+                                                    ULONG *pcLost)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+        EE_THREAD_NOT_REQUIRED;
+        CANNOT_TAKE_LOCK;
+        PRECONDITION(CheckPointer(pcRecords, NULL_OK));
+        PRECONDITION(CheckPointer(records, NULL_OK));
+        PRECONDITION(CheckPointer(pcLost, NULL_OK));
+    }
+    CONTRACTL_END;
+
+    PROFILER_TO_CLR_ENTRYPOINT_ASYNC_EX(kP2EEAllowableAfterAttach,
+        (LF_CORPROF,
+         LL_INFO1000,
+         "**PROF: GetEnterLeaveRecords 0x%p.\n",
+         threadId));
+
+    if (!g_profControlBlock.pProfInterface->IsEnterLeaveBufferingEnabled())
+    {
+        return CORPROF_E_INCONSISTENT_WITH_FLAGS;
+    }
+
+    if (!IsManagedThread(threadId) || (pcRecords == NULL) || ((records == NULL) && (cRecords != 0)))
+    {
+        return E_INVALIDARG;
+    }
+
+    ULONG cLost = 0;
+    *pcRecords = 0;
+
+    // The thread has not entered or left a method yet if it has no buffer
+    ProfilerEnterLeaveBuffer * pBuffer = ((Thread *)threadId)->GetProfilerEnterLeaveBuffer();
+    if (pBuffer != NULL)
+    {
+        *pcRecords = pBuffer->Read(records, cRecords, &cLost);
+    }
+
+    if (pcLost != NULL)
+    {
+        *pcLost = cLost;
+    }
+
+    return S_OK;
+}
+
+
 HRESULT ProfToEEInterfaceImpl::SetFunctionIDMapper(FunctionIDMapper *pFunc)
 {
     CONTRACTL
@@ -10463,6 +10564,39 @@ void __stdcall ProfilerUnmanagedToManagedTransitionMD(MethodDesc *pMD,
 // These do a lot of work for us, setting up Frames, gathering arg info and resolving generics.
   //*******************************************************************************************
 
+#ifdef PROFILING_SUPPORTED
+//---------------------------------------------------------------------------------------
+//
+// Writes an enter/leave record to the buffer of the current thread when the profiler
+// uses enter/leave buffering. This is the whole slow path in that mode: no frame is
+// set up and the profiler is not called.
+//
+
+static void ProfileRecordEnterLeave(COR_PRF_ELT_RECORD_KIND kind, UINT_PTR clientData)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    Thread * pThread = GetThread();
+    ProfilerEnterLeaveBuffer * pBuffer = pThread->GetProfilerEnterLeaveBuffer();
+
+    if (pBuffer == NULL)
+    {
+        // Can handle running out of memory, the event is simply lost.
+        FAULT_NOT_FATAL();
+
+        pBuffer = ProfilerEnterLeaveBuffer::Create(g_profControlBlock.pProfInterface->GetEnterLeaveBufferRecordCount());
+        if (pBuffer == NULL)
+        {
+            return;
+        }
+
+        pThread->SetProfilerEnterLeaveBuffer(pBuffer);
+    }
+
+    pBuffer->Write(kind, clientData);
+}
+#endif // PROFILING_SUPPORTED
+
 HCIMPL2(EXTERN_C void, ProfileEnter, UINT_PTR clientData, void * platformSpecificHandle)
 {
     FCALL_CONTRACT;
@@ -10489,6 +10623,12 @@ HCIMPL2(EXTERN_C void, ProfileEnter, UINT_PTR clientData, void * platformSpecifi
     }
 #endif // PROF_TEST_ONLY_FORCE_ELT
 
+    if (g_profControlBlock.pProfInterface->IsEnterLeaveBufferingEnabled())
+    {
+        ProfileRecordEnterLeave(COR_PRF_ELT_RECORD_ENTER, clientData);
+        return;
+    }
+
     // ELT3 Fast-Path hooks should be NULL when ELT intermediary is used.
     _ASSERTE(g_profControlBlock.pProfInterface->GetEnter3Hook() == NULL);
     _ASSERTE(GetThread()->PreemptiveGCDisabled());
@@ -10661,6 +10801,12 @@ HCIMPL2(EXTERN_C void, ProfileLeave, UINT_PTR clientData, void * platformSpecifi
     }
 #endif // PROF_TEST_ONLY_FORCE_ELT
 
+    if (g_profControlBlock.pProfInterface->IsEnterLeaveBufferingEnabled())
+    {
+        ProfileRecordEnterLeave(COR_PRF_ELT_RECORD_LEAVE, clientData);
+        return;
+    }
+
     // ELT3 Fast-Path hooks should be NULL when ELT intermediary is used.
     _ASSERTE(g_profControlBlock.pProfInterface->GetLeave3Hook() == NULL);
     _ASSERTE(GetThread()->PreemptiveGCDisabled());
@@ -10793,6 +10939,12 @@ HCIMPL2(EXTERN_C void, ProfileTailcall, UINT_PTR clientData, void * platformSpec
     }
 #endif // PROF_TEST_ONLY_FORCE_ELT
 
+    if (g_profControlBlock.pProfInterface->IsEnterLeaveBufferingEnabled())
+    {
+        ProfileRecordEnterLeave(COR_PRF_ELT_RECORD_TAILCALL, clientData);
+        return;
+    }
+
     // ELT3 fast-path hooks should be NULL when ELT intermediary is used.
     _ASSERTE(g_profControlBlock.pProfInterface->GetTailcall3Hook() == NULL);
     _ASSERTE(GetThread()->PreemptiveGCDisabled());
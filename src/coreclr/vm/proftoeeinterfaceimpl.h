@@ -143,7 +143,7 @@ typedef struct _PROFILER_STACK_WALK_DATA PROFILER_STACK_WALK_DATA;
 // from the profiler implementation.  The profiler will call back on the v-table
 // to get at EE internals as required.
 
-class ProfToEEInterfaceImpl : public ICorProfilerInfo12
+class ProfToEEInterfaceImpl : public ICorProfilerInfo13
 {
 public:
 
@@ -691,6 +691,20 @@ public:
 
     // end ICorProfilerInfo12
 
+    // begin ICorProfilerInfo13
+
+    COM_METHOD SetEnterLeaveBuffering(
+        ULONG cRecordsPerThread);
+
+    COM_METHOD GetEnterLeaveRecords(
+        ThreadID threadId,
+        ULONG cRecords,
+        ULONG *pcRecords,
+        COR_PRF_ELT_RECORD records[],
+        ULONG *pcLost);
+
+    // end ICorProfilerInfo13
+
 protected:
 
     // Internal Helper Functions
@@ -891,32 +891,16 @@ bool ReadyToRunInfo::GetPgoInstrumentationData(MethodDesc * pMD, BYTE** pAllocat
 #endif // !CROSSGEN_COMPILE
 
 
-PCODE ReadyToRunInfo::GetEntryPoint(MethodDesc * pMD, PrepareCodeConfig* pConfig, BOOL fFixups)
+// Finds the offset of the entry point data for pMD in the native reader
+bool ReadyToRunInfo::TryGetMethodEntryOffset(MethodDesc * pMD, uint * pOffset)
 {
     STANDARD_VM_CONTRACT;
 
-    PCODE pEntryPoint = NULL;
-#ifndef CROSSGEN_COMPILE
-#ifdef PROFILING_SUPPORTED
-    BOOL fShouldSearchCache = TRUE;
-#endif // PROFILING_SUPPORTED
-#endif // CROSSGEN_COMPILE
-    mdToken token = pMD->GetMemberDef();
-    int rid = RidFromToken(token);
-    if (rid == 0)
-        goto done;
-
-    // If R2R code is disabled for this module, simply behave as if it is never found
-    if (m_readyToRunCodeDisabled)
-        goto done;
-
-    ETW::MethodLog::GetR2RGetEntryPointStart(pMD);
-
     uint offset;
     if (pMD->HasClassOrMethodInstantiation())
     {
         if (m_instMethodEntryPoints.IsNull())
-            goto done;
+            return false;
 
         NativeHashtable::Enumerator lookup = m_instMethodEntryPoints.Lookup(GetVersionResilientMethodHashCode(pMD));
         NativeParser entryParser;
@@ -935,14 +919,73 @@ PCODE ReadyToRunInfo::GetEntryPoint(MethodDesc * pMD, PrepareCodeConfig* pConfig
         }
 
         if (offset == (uint)-1)
-            goto done;
+            return false;
     }
     else
     {
-        if (!m_methodDefEntryPoints.TryGetAt(rid - 1, &offset))
-            goto done;
+        if (!m_methodDefEntryPoints.TryGetAt(RidFromToken(pMD->GetMemberDef()) - 1, &offset))
+            return false;
+    }
+
+    *pOffset = offset;
+    return true;
+}
+
+bool ReadyToRunInfo::ResolveEntryPointFixups(MethodDesc * pMD)
+{
+    STANDARD_VM_CONTRACT;
+
+    if (RidFromToken(pMD->GetMemberDef()) == 0 || m_readyToRunCodeDisabled)
+        return false;
+
+    uint offset;
+    if (!TryGetMethodEntryOffset(pMD, &offset))
+        return false;
+
+    uint id;
+    offset = m_nativeReader.DecodeUnsigned(offset, &id);
+
+    if (id & 1)
+    {
+        if (id & 2)
+        {
+            uint val;
+            m_nativeReader.DecodeUnsigned(offset, &val);
+            offset -= val;
+        }
+
+        if (!m_pModule->FixupDelayList(dac_cast<TADDR>(GetImage()->GetBase()) + offset))
+            return false;
     }
 
+    return true;
+}
+
+PCODE ReadyToRunInfo::GetEntryPoint(MethodDesc * pMD, PrepareCodeConfig* pConfig, BOOL fFixups)
+{
+    STANDARD_VM_CONTRACT;
+
+    PCODE pEntryPoint = NULL;
+#ifndef CROSSGEN_COMPILE
+#ifdef PROFILING_SUPPORTED
+    BOOL fShouldSearchCache = TRUE;
+#endif // PROFILING_SUPPORTED
+#endif // CROSSGEN_COMPILE
+    mdToken token = pMD->GetMemberDef();
+    int rid = RidFromToken(token);
+    if (rid == 0)
+        goto done;
+
+    // If R2R code is disabled for this module, simply behave as if it is never found
+    if (m_readyToRunCodeDisabled)
+        goto done;
+
+    ETW::MethodLog::GetR2RGetEntryPointStart(pMD);
+
+    uint offset;
+    if (!TryGetMethodEntryOffset(pMD, &offset))
+        goto done;
+
 #ifndef CROSSGEN_COMPILE
 #ifdef PROFILING_SUPPORTED
         {
@@ -1228,6 +1271,55 @@ DWORD ReadyToRunInfo::GetFieldBaseOffset(MethodTable * pMT)
     return OBJECT_SIZE + dwCumulativeInstanceFieldPos - dwOffsetBias;
 }
 
+static DWORD HashBytesWithSeed(DWORD hash, BYTE const * pbData, size_t cbData)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    for (BYTE const * pbDataEnd = pbData + cbData; pbData < pbDataEnd; pbData++)
+    {
+        hash = ((hash << 5) + hash) ^ *pbData;
+    }
+    return hash;
+}
+
+//
+// Computes the hash of the IL body of a method that is recorded by the Check_IL_Body and
+// Verify_IL_Body fixups. The hash covers everything that can change the code generated for
+// the method when it is inlined into a different version bubble: the IL stream, the max
+// stack, the local signature and the exception handling clauses.
+//
+DWORD ReadyToRunInfo::ComputeILBodyHash(MethodDesc * pMD)
+{
+    STANDARD_VM_CONTRACT;
+
+    _ASSERTE(pMD->IsIL());
+
+    COR_ILMETHOD_DECODER::DecoderStatus status = COR_ILMETHOD_DECODER::FORMAT_ERROR;
+    COR_ILMETHOD_DECODER header(pMD->GetILHeader(), pMD->GetMDImport(), &status);
+    if (status != COR_ILMETHOD_DECODER::SUCCESS)
+    {
+        COMPlusThrowHR(COR_E_BADIMAGEFORMAT);
+    }
+
+    DWORD hash = 5381;
+
+    DWORD dwMaxStack = header.GetMaxStack();
+    hash = HashBytesWithSeed(hash, (BYTE const *)&dwMaxStack, sizeof(dwMaxStack));
+    hash = HashBytesWithSeed(hash, header.Code, header.GetCodeSize());
+
+    if (header.LocalVarSig != NULL)
+    {
+        hash = HashBytesWithSeed(hash, header.LocalVarSig, header.cbLocalVarSig);
+    }
+
+    if (header.EH != NULL)
+    {
+        hash = HashBytesWithSeed(hash, (BYTE const *)header.EH, header.EH->DataSize());
+    }
+
+    return hash;
+}
+
 BOOL ReadyToRunInfo::IsImageVersionAtLeast(int majorVersion, int minorVersion)
 {
     LIMITED_METHOD_CONTRACT;
@@ -82,6 +82,8 @@ class ReadyToRunInfo
 
     PTR_PersistentInlineTrackingMapR2R m_pPersistentInlineTrackingMap;
 
+    bool TryGetMethodEntryOffset(MethodDesc * pMD, uint * pOffset);
+
 public:
     ReadyToRunInfo(Module * pModule, LoaderAllocator* pLoaderAllocator, PEImageLayout * pLayout, READYTORUN_HEADER * pHeader, NativeImage * pNativeImage, AllocMemTracker *pamTracker);
 
@@ -104,9 +106,23 @@ public:
 
     PCODE GetEntryPoint(MethodDesc * pMD, PrepareCodeConfig* pConfig, BOOL fFixups);
 
+    // Resolves the fixups of pMD's precompiled code without publishing the code. Returns false if the image has no
+    // usable code for the method.
+    bool ResolveEntryPointFixups(MethodDesc * pMD);
+
+    // Binds the method call cells whose targets already have stable code, see prestub.cpp
+    COUNT_T BindExternalMethodCells();
+
     PTR_MethodDesc GetMethodDescForEntryPoint(PCODE entryPoint);
     bool GetPgoInstrumentationData(MethodDesc * pMD, BYTE** pAllocatedMemory, ICorJitInfo::PgoInstrumentationSchema**ppSchema, UINT *pcSchema, BYTE** pInstrumentationData);
 
+    // Returns true if the image carries static profile data that can be used when jitting its methods
+    bool HasPgoInstrumentationData()
+    {
+        LIMITED_METHOD_CONTRACT;
+        return !m_readyToRunCodeDisabled && !m_pgoInstrumentationDataHashtable.IsNull();
+    }
+
     BOOL HasHashtableOfTypes();
     BOOL TryLookupTypeTokenFromName(const NameHandle *pName, mdToken * pFoundTypeToken);
 
@@ -205,6 +221,8 @@ public:
 
     static DWORD GetFieldBaseOffset(MethodTable * pMT);
 
+    static DWORD ComputeILBodyHash(MethodDesc * pMD);
+
     PTR_PersistentInlineTrackingMapR2R GetInlineTrackingMap()
     {
         return m_pPersistentInlineTrackingMap;
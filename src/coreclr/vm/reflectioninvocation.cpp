@@ -641,6 +641,140 @@ public:
 };
 
 
+ReflectionInvokePlanCache::ReflectionInvokePlanCache(LoaderAllocator *pLoaderAllocator)
+    : m_pLoaderAllocator(pLoaderAllocator), m_table()
+{
+    CONTRACTL
+    {
+        THROWS;
+        GC_NOTRIGGER;
+        MODE_ANY;
+    }
+    CONTRACTL_END;
+
+    m_lock.Init(CrstReflection, CRST_UNSAFE_ANYMODE);
+
+    LockOwner lock = {&m_lock, IsOwnerOfCrst};
+    m_table.Init(INITIAL_TABLE_SIZE, &lock);
+}
+
+ReflectionInvokePlanCache::~ReflectionInvokePlanCache()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    // The plans themselves live in the LoaderAllocator's heap.
+    m_lock.Destroy();
+}
+
+ReflectionInvokePlan *ReflectionInvokePlanCache::Lookup(MethodDesc *pMD)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+    }
+    CONTRACTL_END;
+
+    HashDatum pPlan;
+    if (m_table.GetValue(pMD, &pPlan))
+        return (ReflectionInvokePlan *)pPlan;
+
+    return NULL;
+}
+
+ReflectionInvokePlan *ReflectionInvokePlanCache::Insert(MethodDesc *pMD, ReflectionInvokePlan *pPlan)
+{
+    CONTRACTL
+    {
+        THROWS;
+        GC_NOTRIGGER;
+        MODE_ANY;
+        INJECT_FAULT(COMPlusThrowOM(););
+    }
+    CONTRACTL_END;
+
+    CrstHolder ch(&m_lock);
+
+    HashDatum pExistingPlan;
+    if (m_table.GetValue(pMD, &pExistingPlan))
+        return (ReflectionInvokePlan *)pExistingPlan;
+
+    SIZE_T cbPlan = ReflectionInvokePlan::GetSize(pPlan->m_numArgs);
+    ReflectionInvokePlan *pCachedPlan = (ReflectionInvokePlan *)(void *)m_pLoaderAllocator->GetLowFrequencyHeap()->AllocMem(S_SIZE_T(cbPlan));
+    memcpy(pCachedPlan, pPlan, cbPlan);
+
+    m_table.InsertValue(pMD, (HashDatum)pCachedPlan);
+
+    return pCachedPlan;
+}
+
+// Returns the argument layout for invoking pMeth with the signature pArgit was created for,
+// computing it with pArgit the first time the method is invoked. pArgit must not have been
+// advanced yet.
+static ReflectionInvokePlan *GetReflectionInvokePlan(MethodDesc *pMeth, SIGNATURENATIVEREF *ppSig, ArgIteratorForMethodInvoke *pArgit)
+{
+    CONTRACTL
+    {
+        THROWS;
+        GC_TRIGGERS;
+        MODE_COOPERATIVE;
+        INJECT_FAULT(COMPlusThrowOM(););
+    }
+    CONTRACTL_END;
+
+    ReflectionInvokePlanCache *pCache = pMeth->GetLoaderAllocator()->GetReflectionInvokePlanCache();
+
+    ReflectionInvokePlan *pPlan = pCache->Lookup(pMeth);
+    if (pPlan != NULL)
+        return pPlan;
+
+    UINT nNumArgs = (*ppSig)->NumFixedArgs();
+
+    NewArrayHolder<BYTE> pBuffer = new BYTE[ReflectionInvokePlan::GetSize(nNumArgs)];
+    pPlan = (ReflectionInvokePlan *)(BYTE *)pBuffer;
+
+    pPlan->m_numArgs = nNumArgs;
+    pPlan->m_fUsesFloatArgumentRegisters = FALSE;
+#ifdef CALLDESCR_REGTYPEMAP
+    pPlan->m_dwRegTypeMap = 0;
+#endif
+
+    for (UINT i = 0; i < nNumArgs; i++)
+    {
+        ReflectionInvokeArgInfo *pArgInfo = &pPlan->m_args[i];
+
+        int ofs = pArgit->GetNextOffset();
+        _ASSERTE(ofs != TransitionBlock::InvalidOffset);
+
+        pArgInfo->m_offset = ofs;
+        pArgInfo->m_size = pArgit->GetArgSize();
+#ifdef ENREGISTERED_PARAMTYPE_MAXSIZE
+        pArgInfo->m_fPassedByRef = pArgit->IsArgPassedByRef();
+#else
+        pArgInfo->m_fPassedByRef = FALSE;
+#endif
+
+        ArgLocDesc *pArgLocDesc = pArgit->GetArgLocDescForStructInRegs();
+#if defined(UNIX_AMD64_ABI) || defined(TARGET_ARM64)
+        pArgInfo->m_fHasArgLocDesc = (pArgLocDesc != NULL);
+        if (pArgLocDesc != NULL)
+            pArgInfo->m_argLocDesc = *pArgLocDesc;
+#endif
+
+#ifdef CALLDESCR_REGTYPEMAP
+        FillInRegTypeMap(ofs, pArgit->GetArgType(), (BYTE *)&pPlan->m_dwRegTypeMap);
+#endif
+
+#ifdef CALLDESCR_FPARGREGS
+        if (TransitionBlock::HasFloatRegister(ofs, pArgLocDesc))
+            pPlan->m_fUsesFloatArgumentRegisters = TRUE;
+#endif
+    }
+
+    return pCache->Insert(pMeth, pPlan);
+}
+
 void DECLSPEC_NORETURN ThrowInvokeMethodException(MethodDesc * pMethod, OBJECTREF targetException)
 {
     CONTRACTL {
@@ -837,10 +971,25 @@ FCIMPL5(Object*, RuntimeMethodHandle::InvokeMethod,
 #ifdef CALLDESCR_FPARGREGS
     callDescrData.pFloatArgumentRegisters = NULL;
 #endif
+    callDescrData.fpReturnSize = argit.GetFPReturnSize();
+
+    // The argument locations are computed once per method and cached
+    ReflectionInvokePlan *pInvokePlan = GetReflectionInvokePlan(pMeth, &gc.pSig, &argit);
+
 #ifdef CALLDESCR_REGTYPEMAP
-    callDescrData.dwRegTypeMap = 0;
+    callDescrData.dwRegTypeMap = pInvokePlan->m_dwRegTypeMap;
+#endif
+#ifdef CALLDESCR_FPARGREGS
+    // Under CALLDESCR_FPARGREGS -ve offsets indicate arguments in floating point registers. If we have at
+    // least one such argument we point the call worker at the floating point area of the frame (we leave
+    // it null otherwise since the worker can perform a useful optimization if it knows no floating point
+    // registers need to be set up).
+    if (pInvokePlan->m_fUsesFloatArgumentRegisters)
+    {
+        callDescrData.pFloatArgumentRegisters = (FloatArgumentRegisters*) (pTransitionBlock +
+                                                                           TransitionBlock::GetOffsetOfFloatArgumentRegisters());
+    }
 #endif
-    callDescrData.fpReturnSize = argit.GetFPReturnSize();
 
     // This is duplicated logic from MethodDesc::GetCallTarget
     PCODE pTarget;
@@ -973,28 +1122,17 @@ FCIMPL5(Object*, RuntimeMethodHandle::InvokeMethod,
 
         TypeHandle th = gc.pSig->GetArgumentAt(i);
 
-        int ofs = argit.GetNextOffset();
-        _ASSERTE(ofs != TransitionBlock::InvalidOffset);
+        ReflectionInvokeArgInfo *pArgInfo = &pInvokePlan->m_args[i];
 
-#ifdef CALLDESCR_REGTYPEMAP
-        FillInRegTypeMap(ofs, argit.GetArgType(), (BYTE *)&callDescrData.dwRegTypeMap);
-#endif
+        int ofs = pArgInfo->m_offset;
 
-#ifdef CALLDESCR_FPARGREGS
-        // Under CALLDESCR_FPARGREGS -ve offsets indicate arguments in floating point registers. If we have at
-        // least one such argument we point the call worker at the floating point area of the frame (we leave
-        // it null otherwise since the worker can perform a useful optimization if it knows no floating point
-        // registers need to be set up).
-
-        if (TransitionBlock::HasFloatRegister(ofs, argit.GetArgLocDescForStructInRegs()) &&
-            (callDescrData.pFloatArgumentRegisters == NULL))
-        {
-            callDescrData.pFloatArgumentRegisters = (FloatArgumentRegisters*) (pTransitionBlock +
-                                                                               TransitionBlock::GetOffsetOfFloatArgumentRegisters());
-        }
+#if defined(UNIX_AMD64_ABI) || defined(TARGET_ARM64)
+        ArgLocDesc *pArgLocDesc = pArgInfo->m_fHasArgLocDesc ? &pArgInfo->m_argLocDesc : NULL;
+#else
+        ArgLocDesc *pArgLocDesc = NULL;
 #endif
 
-        UINT structSize = argit.GetArgSize();
+        UINT structSize = pArgInfo->m_size;
 
         bool needsStackCopy = false;
 
@@ -1007,14 +1145,12 @@ FCIMPL5(Object*, RuntimeMethodHandle::InvokeMethod,
             structSize = th.GetSize();
             needsStackCopy = true;
         }
-#ifdef ENREGISTERED_PARAMTYPE_MAXSIZE
-        else if (argit.IsArgPassedByRef())
+        else if (pArgInfo->m_fPassedByRef)
         {
             needsStackCopy = true;
         }
-#endif
 
-        ArgDestination argDest(pTransitionBlock, ofs, argit.GetArgLocDescForStructInRegs());
+        ArgDestination argDest(pTransitionBlock, ofs, pArgLocDesc);
 
         if(needsStackCopy)
         {
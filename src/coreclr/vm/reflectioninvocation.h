@@ -13,6 +13,7 @@
 #include "stackwalktypes.h"
 #include "runtimehandles.h"
 #include "invokeutil.h"
+#include "eehash.h"
 
 // NOTE: The following constants are defined in BindingFlags.cs
 #define BINDER_IgnoreCase           0x01
@@ -78,6 +79,66 @@ public:
     static FCDECL3(Object*, AllocateValueType, ReflectClassBaseObject *targetType, Object *valueUNSAFE, CLR_BOOL fForceTypeChange);
 };
 
+#ifndef DACCESS_COMPILE
+// Location of one fixed argument of a method invoked through reflection, as computed by
+// the ArgIterator for the method's signature.
+struct ReflectionInvokeArgInfo
+{
+    int         m_offset;
+    UINT        m_size;
+    BOOL        m_fPassedByRef;
+#if defined(UNIX_AMD64_ABI) || defined(TARGET_ARM64)
+    BOOL        m_fHasArgLocDesc;
+    ArgLocDesc  m_argLocDesc;
+#endif
+};
+
+// The argument layout of a method invoked through reflection. It is computed on the first
+// invoke of the method and reused by RuntimeMethodHandle::InvokeMethod afterwards, so that
+// later calls copy the arguments straight to their locations instead of walking the
+// signature with an ArgIterator again.
+struct ReflectionInvokePlan
+{
+    UINT                    m_numArgs;
+    BOOL                    m_fUsesFloatArgumentRegisters;
+#ifdef CALLDESCR_REGTYPEMAP
+    UINT64                  m_dwRegTypeMap;
+#endif
+    ReflectionInvokeArgInfo m_args[1];
+
+    static SIZE_T GetSize(UINT numArgs)
+    {
+        LIMITED_METHOD_CONTRACT;
+        return offsetof(ReflectionInvokePlan, m_args) + max(numArgs, 1U) * sizeof(ReflectionInvokeArgInfo);
+    }
+};
+
+// Maps the MethodDescs of a LoaderAllocator to their ReflectionInvokePlans. Lookups are
+// lock-free, plans are only ever added.
+class ReflectionInvokePlanCache
+{
+public:
+    ReflectionInvokePlanCache(LoaderAllocator *pLoaderAllocator);
+    ~ReflectionInvokePlanCache();
+
+    ReflectionInvokePlan *Lookup(MethodDesc *pMD);
+
+    // Copies pPlan into the LoaderAllocator and adds it, unless another thread got there
+    // first. Returns the plan that is in the cache.
+    ReflectionInvokePlan *Insert(MethodDesc *pMD, ReflectionInvokePlan *pPlan);
+
+private:
+    enum
+    {
+        INITIAL_TABLE_SIZE = 32
+    };
+
+    LoaderAllocator    *m_pLoaderAllocator;
+    CrstExplicitInit    m_lock;
+    EEPtrHashTable      m_table;
+};
+#endif // !DACCESS_COMPILE
+
 class ReflectionSerialization {
 public:
     static
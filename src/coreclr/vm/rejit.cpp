@@ -568,6 +568,11 @@ HRESULT ReJitManager::UpdateActiveILVersions(
     //contains them was unloaded.
     SHash<CodeActivationBatchTraits> mgrToCodeActivationBatch;
     CDynArray<CodeVersionManager::CodePublishError> errorRecords;
+
+    // Methods whose NGEN/R2R inliners need to be rejitted too. Finding those requires walking
+    // every loaded module, so it is done once for the whole request after the loop below
+    // rather than once per method.
+    CDynArray<MethodDesc *> nativeInlinees;
     for (ULONG i = 0; i < cFunctions; i++)
     {
         Module * pModule = reinterpret_cast< Module * >(rgModuleIDs[i]);
@@ -621,13 +626,14 @@ HRESULT ReJitManager::UpdateActiveILVersions(
             return hr;
         }
 
-        if ((flags & COR_PRF_REJIT_BLOCK_INLINING) == COR_PRF_REJIT_BLOCK_INLINING)
+        if ((flags & COR_PRF_REJIT_BLOCK_INLINING) == COR_PRF_REJIT_BLOCK_INLINING && pMD != NULL)
         {
-            hr = UpdateNativeInlinerActiveILVersions(&mgrToCodeActivationBatch, pMD, fIsRevert, flags);
-            if (FAILED(hr))
+            MethodDesc ** ppInlinee = nativeInlinees.Append();
+            if (ppInlinee == NULL)
             {
-                return hr;
+                return E_OUTOFMEMORY;
             }
+            *ppInlinee = pMD;
 
             hr = UpdateJitInlinerActiveILVersions(&mgrToCodeActivationBatch, pMD, fIsRevert, flags);
             if (FAILED(hr))
@@ -637,6 +643,15 @@ HRESULT ReJitManager::UpdateActiveILVersions(
         }
     }   // for (ULONG i = 0; i < cFunctions; i++)
 
+    if (nativeInlinees.Count() != 0)
+    {
+        hr = UpdateNativeInlinerActiveILVersions(&mgrToCodeActivationBatch, nativeInlinees.Ptr(), nativeInlinees.Count(), fIsRevert, flags);
+        if (FAILED(hr))
+        {
+            return hr;
+        }
+    }
+
     // For each code versioning mgr, if there's work to do,
     // enter the code versioning mgr's crst, and do the batched work.
     SHash<CodeActivationBatchTraits>::Iterator beginIter = mgrToCodeActivationBatch.Begin();
@@ -782,7 +797,8 @@ HRESULT ReJitManager::UpdateActiveILVersion(
 // static
 HRESULT ReJitManager::UpdateNativeInlinerActiveILVersions(
     SHash<CodeActivationBatchTraits>   *pMgrToCodeActivationBatch,
-    MethodDesc                         *pInlinee,
+    MethodDesc                        **rgInlinees,
+    int                                 cInlinees,
     BOOL                                fIsRevert,
     COR_PRF_REJIT_FLAGS                 flags)
 {
@@ -796,12 +812,12 @@ HRESULT ReJitManager::UpdateNativeInlinerActiveILVersions(
     CONTRACTL_END;
 
     _ASSERTE(pMgrToCodeActivationBatch != NULL);
-    _ASSERTE(pInlinee != NULL);
+    _ASSERTE(rgInlinees != NULL && cInlinees > 0);
 
     HRESULT hr = S_OK;
 
     // Iterate through all modules, for any that are NGEN or R2R need to check if there are inliners there and call
-    // RequestReJIT on them
+    // RequestReJIT on them. All the inlinees of a request are checked in the same pass over the modules.
     // TODO: is the default domain enough for coreclr?
     AppDomain::AssemblyIterator domainAssemblyIterator = SystemDomain::System()->DefaultDomain()->IterateAssembliesEx((AssemblyIterationFlags) (kIncludeLoaded | kIncludeExecution));
     CollectibleAssemblyHolder<DomainAssembly *> pDomainAssembly;
@@ -815,9 +831,14 @@ HRESULT ReJitManager::UpdateNativeInlinerActiveILVersions(
         while (domainModuleIterator.Next())
         {
             Module * pCurModule = domainModuleIterator.GetModule();
-            if (pCurModule->HasNativeOrReadyToRunInlineTrackingMap())
+            if (!pCurModule->HasNativeOrReadyToRunInlineTrackingMap())
+            {
+                continue;
+            }
+
+            for (int i = 0; i < cInlinees; i++)
             {
-                inlinerIter.Reset(pCurModule, pInlinee);
+                inlinerIter.Reset(pCurModule, rgInlinees[i]);
 
                 MethodDesc *pInliner = NULL;
                 while (inlinerIter.Next())
@@ -830,7 +851,7 @@ HRESULT ReJitManager::UpdateNativeInlinerActiveILVersions(
                         if (!ilVersion.HasDefaultIL())
                         {
                             // This method has already been ReJITted, no need to request another ReJIT at this point.
-                            // The ReJITted method will be in the JIT inliner check below.
+                            // The ReJITted method will be in the JIT inliner check.
                             continue;
                         }
                     }
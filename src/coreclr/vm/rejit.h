@@ -189,7 +189,8 @@ private:
 
     static HRESULT UpdateNativeInlinerActiveILVersions(
         SHash<CodeActivationBatchTraits> *pMgrToCodeActivationBatch,
-        MethodDesc         *pInlinee,
+        MethodDesc        **rgInlinees,
+        int                 cInlinees,
         BOOL                fIsRevert,
         COR_PRF_REJIT_FLAGS flags);
 
@@ -1907,7 +1907,7 @@ IUnknown* RCW::GetComIPFromRCW(REFIID iid)
     SafeComHolder<IUnknown> pRet = NULL;
     HRESULT hr = S_OK;
 
-    hr = SafeQueryInterfaceRemoteAware(iid, (IUnknown**)&pRet);
+    hr = SafeQueryInterfaceFromCache(iid, (IUnknown**)&pRet);
     if (hr != E_NOINTERFACE)
     {
         // We simply return NULL on E_NOINTERFACE which is much better for perf than throwing exceptions. Note
@@ -2003,7 +2003,7 @@ IUnknown *RCW::GetWellKnownInterface(REFIID riid)
     IUnknown *pUnk = NULL;
 
     // QI for riid.
-    HRESULT hr = SafeQueryInterfaceRemoteAware(riid, &pUnk);
+    HRESULT hr = SafeQueryInterfaceFromCache(riid, &pUnk);
     if ( S_OK !=  hr )
     {
         // If anything goes wrong simply set pUnk to NULL to indicate that
@@ -2201,6 +2201,66 @@ IUnknown* RCW::GetComIPForMethodTableFromCache(MethodTable* pMT)
     RETURN pUnk;
 }
 
+//-----------------------------------------------------------------
+// QI for the given IID in the current apartment. Late bound callers ask for the
+// same few IIDs (IDispatch in particular) over and over, so results obtained in the
+// context the RCW was created in are kept in a small lock-free cache on the RCW.
+HRESULT RCW::SafeQueryInterfaceFromCache(REFIID riid, IUnknown** ppUnk)
+{
+    CONTRACTL
+    {
+        THROWS;
+        GC_TRIGGERS;
+        MODE_ANY;
+        PRECONDITION(CheckPointer(ppUnk));
+    }
+    CONTRACTL_END;
+
+    ULONG cbRef;
+    int i;
+
+    RCW_VTABLEPTR(this);
+
+    // Aggregated components don't hold references in the interface caches, so keep it simple
+    // and don't cache for them at all.
+    LPVOID pCtxCookie = GetCurrentCtxCookie();
+    _ASSERTE(pCtxCookie != NULL);
+    bool fUseCache = !IsURTAggregated() && (pCtxCookie == GetWrapperCtxCookie() || IsFreeThreaded());
+
+    if (fUseCache)
+    {
+        for (i = 0; i < IID_INTERFACE_ENTRY_CACHE_SIZE; i++)
+        {
+            IUnknown* pUnk = m_aIIDInterfaceEntries[i].Lookup(riid);
+            if (pUnk != NULL)
+            {
+                cbRef = SafeAddRef(pUnk);
+                LogInteropAddRef(pUnk, cbRef, "RCW::SafeQueryInterfaceFromCache: Addref because returning pUnk fetched from IIDInterfaceEntry cache");
+                *ppUnk = pUnk;
+                return S_OK;
+            }
+        }
+    }
+
+    HRESULT hr = SafeQueryInterfaceRemoteAware(riid, ppUnk);
+
+    if (fUseCache && hr == S_OK && *ppUnk != NULL)
+    {
+        for (i = 0; i < IID_INTERFACE_ENTRY_CACHE_SIZE; i++)
+        {
+            if (m_aIIDInterfaceEntries[i].IsFree() && m_aIIDInterfaceEntries[i].Init(riid, *ppUnk))
+            {
+                // Get an extra addref to hold this reference alive in our cache
+                cbRef = SafeAddRef(*ppUnk);
+                LogInteropAddRef(*ppUnk, cbRef, "RCW::SafeQueryInterfaceFromCache: Addref because storing pUnk in IIDInterfaceEntry cache");
+                break;
+            }
+        }
+    }
+
+    return hr;
+}
+
 //----------------------------------------------------------
 // Determine if the COM object supports IProvideClassInfo.
 BOOL RCW::SupportsIProvideClassInfo()
@@ -2330,6 +2390,17 @@ void RCW::ReleaseAllInterfaces()
                 LogInteropRelease(m_aInterfaceEntries[i].m_pUnknown, cbRef, "RCW::ReleaseAllInterfaces: Releasing ref from InterfaceEntry table");
             }
         }
+
+        for (int i = 0; i < IID_INTERFACE_ENTRY_CACHE_SIZE; i++)
+        {
+            // Free the entry first so that we never try to release it again.
+            IUnknown* pUnk = m_aIIDInterfaceEntries[i].Free();
+            if (pUnk != NULL)
+            {
+                DWORD cbRef = SafeReleasePreemp(pUnk, this);
+                LogInteropRelease(pUnk, cbRef, "RCW::ReleaseAllInterfaces: Releasing ref from IIDInterfaceEntry table");
+            }
+        }
     }
 }
 
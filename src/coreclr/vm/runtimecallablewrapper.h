@@ -77,6 +77,7 @@ class Thread;
 #define GC_PRESSURE_REMOTE 4824
 
 enum {INTERFACE_ENTRY_CACHE_SIZE = 8};
+enum {IID_INTERFACE_ENTRY_CACHE_SIZE = 4};
 
 typedef DPTR(RCW) PTR_RCW;
 
@@ -288,6 +289,11 @@ struct RCW
     // use the cache /update the cache
     IUnknown* GetComIPForMethodTableFromCache(MethodTable * pMT);
 
+    //-----------------------------------------------------------------
+    // QI for the given IID in the current apartment, use the IID cache /update the cache.
+    // Returns an addref'd pointer in *ppUnk - caller must Release
+    HRESULT SafeQueryInterfaceFromCache(REFIID riid, IUnknown** ppUnk);
+
     // helpers to get to IUnknown, IDispatch interfaces
     // Returns an addref'd pointer - caller must Release
     IUnknown*  GetWellKnownInterface(REFIID riid);
@@ -531,6 +537,9 @@ public:
     // interface entries
     InterfaceEntry      m_aInterfaceEntries[INTERFACE_ENTRY_CACHE_SIZE];
 
+    // interface entries for IPs asked for by IID
+    IIDInterfaceEntry   m_aIIDInterfaceEntries[IID_INTERFACE_ENTRY_CACHE_SIZE];
+
     // Identity
     LPVOID              m_pIdentity;
 
@@ -0,0 +1,43 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+//
+// File: runtimecounterlist.h
+//
+// List of the native runtime counters, see runtimecounters.h
+//
+//   RUNTIME_COUNTER(id, name)        - a count that is accumulated with RuntimeCounters::Increment/Add
+//   RUNTIME_POLLED_COUNTER(id, name) - a gauge that is sampled from its subsystem when the counters are read
+//
+// Names follow the naming of the System.Runtime event counters.
+//
+
+#ifndef RUNTIME_POLLED_COUNTER
+#define RUNTIME_POLLED_COUNTER(id, name) RUNTIME_COUNTER(id, name)
+#endif
+
+// Virtual stub dispatch
+RUNTIME_COUNTER(LookupStubs, W("vsd-lookup-stub-count"))
+RUNTIME_COUNTER(DispatchStubs, W("vsd-dispatch-stub-count"))
+RUNTIME_COUNTER(ResolveStubs, W("vsd-resolve-stub-count"))
+RUNTIME_COUNTER(VTableCallStubs, W("vsd-vtable-call-stub-count"))
+
+// Monitor spinning
+RUNTIME_COUNTER(MonitorSpinAcquired, W("monitor-spin-acquired-count"))
+RUNTIME_COUNTER(MonitorSpinFailed, W("monitor-spin-failed-count"))
+
+// Tiered compilation
+RUNTIME_POLLED_COUNTER(ActiveCallCountingStubs, W("call-counting-stub-count"))
+
+// Loader
+RUNTIME_POLLED_COUNTER(LoaderHeapCommittedBytes, W("loader-heap-committed-bytes"))
+
+// Casting
+RUNTIME_POLLED_COUNTER(CastCacheHits, W("cast-cache-hit-count"))
+RUNTIME_POLLED_COUNTER(CastCacheMisses, W("cast-cache-miss-count"))
+
+// Stack scanning
+RUNTIME_POLLED_COUNTER(GcSlotTableCacheHits, W("gc-slot-table-cache-hit-count"))
+RUNTIME_POLLED_COUNTER(GcSlotTableCacheMisses, W("gc-slot-table-cache-miss-count"))
+
+#undef RUNTIME_POLLED_COUNTER
+#undef RUNTIME_COUNTER
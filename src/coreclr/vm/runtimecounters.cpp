@@ -0,0 +1,150 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+//
+// File: runtimecounters.cpp
+//
+
+#include "common.h"
+#include "runtimecounters.h"
+#include "castcache.h"
+#include "callcounting.h"
+#include "loaderheap.h"
+
+RuntimeCounters::Slot RuntimeCounters::s_slots[RuntimeCounters::SlotCount];
+
+LPCWSTR RuntimeCounters::GetName(RuntimeCounterId id)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    static const LPCWSTR s_names[] =
+    {
+#define RUNTIME_COUNTER(id, name) name,
+#include "runtimecounterlist.h"
+    };
+    static_assert_no_msg(_countof(s_names) == RuntimeCounter_Count);
+
+    _ASSERTE((DWORD)id < RuntimeCounter_Count);
+    return s_names[id];
+}
+
+bool RuntimeCounters::IsPolled(RuntimeCounterId id)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    static const bool s_isPolled[] =
+    {
+#define RUNTIME_COUNTER(id, name) false,
+#define RUNTIME_POLLED_COUNTER(id, name) true,
+#include "runtimecounterlist.h"
+    };
+    static_assert_no_msg(_countof(s_isPolled) == RuntimeCounter_Count);
+
+    _ASSERTE((DWORD)id < RuntimeCounter_Count);
+    return s_isPolled[id];
+}
+
+LONG64 RuntimeCounters::GetPolledValue(RuntimeCounterId id)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+    }
+    CONTRACTL_END;
+
+    switch (id)
+    {
+        case RuntimeCounter_ActiveCallCountingStubs:
+#ifdef FEATURE_TIERED_COMPILATION
+            return CallCountingManager::GetActiveCallCountingStubCount();
+#else
+            return 0;
+#endif
+
+        case RuntimeCounter_LoaderHeapCommittedBytes:
+            return (LONG64)UnlockedLoaderHeap::GetTotalCommittedBytes();
+
+        case RuntimeCounter_CastCacheHits:
+            return CastCache::GetThreadCacheHitCount();
+
+        case RuntimeCounter_CastCacheMisses:
+            return CastCache::GetThreadCacheMissCount();
+
+        case RuntimeCounter_GcSlotTableCacheHits:
+#ifdef GCINFO_SLOT_TABLE_CACHE
+            return GcSlotTableCache::GetHitCount();
+#else
+            return 0;
+#endif
+
+        case RuntimeCounter_GcSlotTableCacheMisses:
+#ifdef GCINFO_SLOT_TABLE_CACHE
+            return GcSlotTableCache::GetMissCount();
+#else
+            return 0;
+#endif
+
+        default:
+            UNREACHABLE_MSG_RET("Unexpected polled runtime counter");
+    }
+}
+
+LONG64 RuntimeCounters::GetValue(RuntimeCounterId id)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+    }
+    CONTRACTL_END;
+
+    _ASSERTE((DWORD)id < RuntimeCounter_Count);
+
+    if (IsPolled(id))
+    {
+        return GetPolledValue(id);
+    }
+
+    LONG64 value = 0;
+    for (DWORD i = 0; i < SlotCount; i++)
+    {
+        // Each slot is only updated with interlocked adds, a plain read on 32-bit platforms could tear
+#ifdef HOST_64BIT
+        value += VolatileLoadWithoutBarrier(&s_slots[i].m_values[id]);
+#else
+        value += InterlockedCompareExchange64(&s_slots[i].m_values[id], 0, 0);
+#endif
+    }
+
+    return value;
+}
+
+#ifdef FEATURE_PERFTRACING
+
+void RuntimeCounters::FireCounterEvents()
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+    }
+    CONTRACTL_END;
+
+    if (!ETW_TRACING_CATEGORY_ENABLED(MICROSOFT_WINDOWS_DOTNETRUNTIME_PROVIDER_DOTNET_Context,
+                                      TRACE_LEVEL_INFORMATION,
+                                      CLR_RUNTIMECOUNTERS_KEYWORD))
+    {
+        return;
+    }
+
+    for (DWORD i = 0; i < RuntimeCounter_Count; i++)
+    {
+        RuntimeCounterId id = (RuntimeCounterId)i;
+        FireEtwRuntimeCounter(GetName(id), (ULONGLONG)GetValue(id), GetClrInstanceId());
+    }
+}
+
+#endif // FEATURE_PERFTRACING
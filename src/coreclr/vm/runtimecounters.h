@@ -0,0 +1,73 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+//
+// File: runtimecounters.h
+//
+// Native counters for runtime subsystems that have no managed event counter.
+//
+// Accumulated counters are split into per-processor slots, so an update is an uncontended interlocked add
+// on a cache line that is owned by the current processor. Readers sum the slots, the result is not a
+// consistent snapshot across counters. Polled counters are gauges that are read from their subsystem when
+// the counters are published.
+//
+// The values are published as RuntimeCounter events (RuntimeCountersKeyword) through
+// NativeEventLogger::LogRuntimeCounters, which the managed runtime event source calls on its counter
+// polling interval.
+//
+
+#ifndef _RUNTIMECOUNTERS_H_
+#define _RUNTIMECOUNTERS_H_
+
+#include "util.hpp"
+
+enum RuntimeCounterId
+{
+#define RUNTIME_COUNTER(id, name) RuntimeCounter_##id,
+#include "runtimecounterlist.h"
+
+    RuntimeCounter_Count
+};
+
+class RuntimeCounters
+{
+public:
+    static void Increment(RuntimeCounterId id)
+    {
+        WRAPPER_NO_CONTRACT;
+        Add(id, 1);
+    }
+
+    static void Add(RuntimeCounterId id, LONG64 value)
+    {
+        LIMITED_METHOD_CONTRACT;
+        _ASSERTE((DWORD)id < RuntimeCounter_Count);
+
+        // GetCurrentProcessorNumber may fail and return -1, that just maps to the last slot
+        Slot *pSlot = &s_slots[(DWORD)GetCurrentProcessorNumber() & (SlotCount - 1)];
+        InterlockedExchangeAdd64(&pSlot->m_values[id], value);
+    }
+
+    static LONG64 GetValue(RuntimeCounterId id);
+    static LPCWSTR GetName(RuntimeCounterId id);
+
+#ifdef FEATURE_PERFTRACING
+    static void FireCounterEvents();
+#endif
+
+private:
+    static bool IsPolled(RuntimeCounterId id);
+    static LONG64 GetPolledValue(RuntimeCounterId id);
+
+private:
+    // Must be a power of two. Processors beyond this share slots, which only costs some contention.
+    static const DWORD SlotCount = 64;
+
+    struct DECLSPEC_ALIGN(MAX_CACHE_LINE_SIZE) Slot
+    {
+        LONG64 m_values[RuntimeCounter_Count];
+    };
+
+    static Slot s_slots[SlotCount];
+};
+
+#endif // _RUNTIMECOUNTERS_H_
@@ -0,0 +1,61 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+//
+// File: runtimeprobes.h
+//
+// Statically defined tracepoints (USDT) at runtime fast paths.
+//
+// A probe compiles to a nop plus a note in the .note.stapsdt section that describes where its
+// arguments live, so it costs next to nothing until a tracer such as bpftrace or perf attaches
+// to it. Unlike the EventPipe and LTTng events this doesn't need a session or any runtime
+// configuration:
+//
+//   bpftrace -l 'usdt:/path/to/libcoreclr.so:dotnet:*'
+//
+// Probes come in start/end pairs where that makes sense, so that latency can be measured by
+// the tracer. Arguments must be cheap to compute, they are evaluated even when nothing is
+// attached.
+//
+// The probes are only available on Linux when the systemtap sdt header was found at build
+// time (FEATURE_USDT_PROBES), elsewhere they compile away.
+//
+
+#ifndef _RUNTIMEPROBES_H_
+#define _RUNTIMEPROBES_H_
+
+#ifdef FEATURE_USDT_PROBES
+
+#include <sys/sdt.h>
+
+#define RUNTIME_PROBE0(name)                    STAP_PROBE(dotnet, name)
+#define RUNTIME_PROBE1(name, a1)                STAP_PROBE1(dotnet, name, a1)
+#define RUNTIME_PROBE2(name, a1, a2)            STAP_PROBE2(dotnet, name, a1, a2)
+#define RUNTIME_PROBE3(name, a1, a2, a3)        STAP_PROBE3(dotnet, name, a1, a2, a3)
+
+#else // FEATURE_USDT_PROBES
+
+#define RUNTIME_PROBE0(name)
+#define RUNTIME_PROBE1(name, a1)
+#define RUNTIME_PROBE2(name, a1, a2)
+#define RUNTIME_PROBE3(name, a1, a2, a3)
+
+#endif // FEATURE_USDT_PROBES
+
+//
+// Probes, with their arguments
+//
+//   gc_start(gc count, condemned generation)
+//   gc_end(gc count, condemned generation)
+//   suspend_ee_start(SUSPEND_REASON)
+//   suspend_ee_end(SUSPEND_REASON)
+//   restart_ee_start()
+//   restart_ee_end()
+//   jit_start(MethodDesc*)
+//   jit_end(MethodDesc*, code address, code size)
+//   contention_start(AwareLock*, Object* locked object)
+//   contention_end(AwareLock*, acquired)
+//   threadpool_dispatch(app domain index, -1 for the unmanaged work queue)
+//   exception_throw(Object* exception, MethodDesc* of the frame, rethrow)
+//
+
+#endif // _RUNTIMEPROBES_H_
@@ -39,6 +39,7 @@ StackingAllocator::StackingAllocator()
     m_FirstBlock = NULL;
     m_FirstFree = NULL;
     m_DeferredFreeBlock = NULL;
+    m_pBlockCache = StackBlockCache::GetForCurrentThread();
 
 #ifdef _DEBUG
         m_CheckpointDepth = 0;
@@ -77,6 +78,11 @@ StackingAllocator::~StackingAllocator()
         m_DeferredFreeBlock = NULL;
     }
 
+    if (m_pBlockCache != NULL)
+    {
+        m_pBlockCache->Trim();
+    }
+
 #ifdef _DEBUG
         INC_COUNTER(W("Allocs"), m_Allocs);
         INC_COUNTER(W("Checkpoints"), m_Checkpoints);
@@ -181,6 +187,10 @@ bool StackingAllocator::AllocNewBlockForBytes(unsigned n)
         // b->m_Length doesn't need init because its value is still valid
         // from the original allocation
     }
+    else if (m_pBlockCache != NULL && (b = m_pBlockCache->Take(n)) != NULL)
+    {
+        // Reusing a block released by an earlier allocator on this thread
+    }
     else
     {
         // Allocate a block four times as large as the request but with a lower
@@ -200,6 +210,11 @@ bool StackingAllocator::AllocNewBlockForBytes(unsigned n)
         // reserve space for the Block structure and then link it in
         b->m_Length = (unsigned) (allocSize - sizeof(StackBlock));
 
+        if (m_pBlockCache != NULL)
+        {
+            m_pBlockCache->NoteAllocated(b);
+        }
+
 #ifdef _DEBUG
         m_BlockAllocs++;
 #endif
@@ -352,6 +367,13 @@ void StackingAllocator::Clear(StackBlock *ToBlock)
 
         INDEBUG(Validate(q, q));
 
+        // Blocks go back to the thread's pool, which is shared by all its allocators
+        if (m_pBlockCache != NULL)
+        {
+            m_pBlockCache->Return(q);
+            continue;
+        }
+
         // we don't give the tail block back to the OS
         // because we can get into situations where we're growing
         // back and forth over a single seam for a tiny alloc
@@ -365,6 +387,128 @@ void StackingAllocator::Clear(StackBlock *ToBlock)
         m_DeferredFreeBlock->m_Next = NULL;
     }
 }
+StackBlockCache::StackBlockCache()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    m_pBlocks = NULL;
+    m_cbCached = 0;
+    m_cbInUse = 0;
+    m_cbPeakInUse = 0;
+    m_lastTrimTime = GetTickCount();
+}
+
+StackBlockCache::~StackBlockCache()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    while (m_pBlocks != NULL)
+    {
+        StackBlock *next = m_pBlocks->m_Next;
+        delete [] (char *)m_pBlocks;
+        m_pBlocks = next;
+    }
+}
+
+StackBlockCache *StackBlockCache::GetForCurrentThread()
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+    }
+    CONTRACTL_END;
+
+#ifndef CROSSGEN_COMPILE
+    Thread *pThread = GetThreadNULLOk();
+    if (pThread == NULL)
+        return NULL;
+
+    // Only the thread itself touches its cache, so no synchronization is needed
+    if (pThread->m_pStackBlockCache == NULL)
+    {
+        FAULT_NOT_FATAL();
+        pThread->m_pStackBlockCache = new (nothrow) StackBlockCache();
+    }
+
+    return pThread->m_pStackBlockCache;
+#else
+    return NULL;
+#endif
+}
+
+// Returns a cached block with at least minLength bytes of data space, or NULL
+StackBlock *StackBlockCache::Take(DWORD_PTR minLength)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    StackBlock **ppBlock = &m_pBlocks;
+    while (*ppBlock != NULL)
+    {
+        StackBlock *b = *ppBlock;
+        if (b->m_Length >= minLength)
+        {
+            *ppBlock = b->m_Next;
+            m_cbCached -= b->m_Length;
+            NoteAllocated(b);
+            return b;
+        }
+        ppBlock = &b->m_Next;
+    }
+
+    return NULL;
+}
+
+void StackBlockCache::NoteAllocated(StackBlock *block)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    m_cbInUse += block->m_Length;
+    m_cbPeakInUse = max(m_cbPeakInUse, m_cbInUse);
+}
+
+void StackBlockCache::Return(StackBlock *block)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    _ASSERTE(m_cbInUse >= block->m_Length);
+    m_cbInUse -= block->m_Length;
+
+    if (m_cbCached + block->m_Length > MaxCachedBytes)
+    {
+        delete [] (char *)block;
+        return;
+    }
+
+    block->m_Next = m_pBlocks;
+    m_pBlocks = block;
+    m_cbCached += block->m_Length;
+}
+
+// Called when an allocator goes away. Once every TrimIntervalMs, gives back the cached
+// blocks beyond the peak usage seen during the last interval, so a thread that hit an
+// unusually deep peak once does not hold on to that memory forever.
+void StackBlockCache::Trim()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    DWORD now = GetTickCount();
+    if (now - m_lastTrimTime < TrimIntervalMs)
+        return;
+
+    while (m_pBlocks != NULL && m_cbCached > m_cbPeakInUse)
+    {
+        StackBlock *b = m_pBlocks;
+        m_pBlocks = b->m_Next;
+        m_cbCached -= b->m_Length;
+        delete [] (char *)b;
+    }
+
+    m_cbPeakInUse = m_cbInUse;
+    m_lastTrimTime = now;
+}
+
 void * __cdecl operator new(size_t n, StackingAllocator * alloc)
 {
     STATIC_CONTRACT_THROWS;
@@ -56,6 +56,40 @@
     };
 
 
+// Per-thread pool of blocks released by StackingAllocators, so that the allocators created
+// for successive calls on the same thread (reflection invoke, marshaling, ...) reuse blocks
+// instead of going back to the heap every time their usage spills out of the initial block.
+// The pool keeps at most the peak number of bytes that were in use since it was last
+// trimmed, and is trimmed once TrimIntervalMs has passed when no allocator is active.
+class StackBlockCache
+{
+public:
+    enum
+    {
+        MaxCachedBytes  = 0x20000,
+        TrimIntervalMs  = 1000,
+    };
+
+#ifndef DACCESS_COMPILE
+    StackBlockCache();
+    ~StackBlockCache();
+
+    static StackBlockCache *GetForCurrentThread();
+
+    StackBlock *Take(DWORD_PTR minLength);
+    void Return(StackBlock *block);
+    void NoteAllocated(StackBlock *block);
+    void Trim();
+#endif
+
+private:
+    StackBlock *m_pBlocks;          // Cached blocks, linked through m_Next
+    SIZE_T      m_cbCached;         // Bytes held in m_pBlocks
+    SIZE_T      m_cbInUse;          // Bytes in blocks currently owned by allocators
+    SIZE_T      m_cbPeakInUse;      // High-water mark of m_cbInUse since the last trim
+    DWORD       m_lastTrimTime;
+};
+
 
 // Non-thread safe allocator designed for allocations with the following
 // pattern:
@@ -201,6 +235,7 @@ private:
     unsigned          m_BytesLeft;        // Number of free bytes left in head block
     InitialStackBlock m_InitialBlock;     // The first block is special, we never free it
     StackBlock       *m_DeferredFreeBlock; // Avoid going to the OS too often by deferring one free
+    StackBlockCache  *m_pBlockCache;      // Blocks shared with the other allocators of this thread, may be NULL
 
 #ifdef _DEBUG
     unsigned    m_CheckpointDepth;
@@ -697,6 +697,178 @@ PCODE Thread::VirtualUnwindNonLeafCallFrame(T_CONTEXT* pContext, KNONVOLATILE_CO
     return uControlPc;
 }
 
+#ifdef TARGET_AMD64
+
+// static
+//
+// Computes the caller context of a managed frame that is stopped at a call site. Such a frame is always
+// past its prolog and can at most be at the first instruction of an epilog, where nothing has been undone
+// yet. So the caller registers follow directly from the frame pointer (or the stack pointer of a frameless
+// method) and the unwind codes, without the epilog emulation of RtlVirtualUnwind.
+//
+// Only the integer registers and the context flags of pCallerContext are written, the rest of it is left
+// as it is. If pEstablisherFrame is given, it receives the establisher frame of the method, as computed by
+// RtlVirtualUnwind. Returns false if the unwind info is not handled here, the caller has to do a full unwind then.
+//
+bool Thread::VirtualUnwindCallSiteFrame(const T_CONTEXT* pContext, const T_KNONVOLATILE_CONTEXT_POINTERS* pContextPointers,
+    T_CONTEXT* pCallerContext, T_KNONVOLATILE_CONTEXT_POINTERS* pCallerContextPointers, EECodeInfo* pCodeInfo,
+    TADDR* pEstablisherFrame /*= NULL*/)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        PRECONDITION(CheckPointer(pContext));
+        PRECONDITION(CheckPointer(pContextPointers));
+        PRECONDITION(CheckPointer(pCallerContext));
+        PRECONDITION(CheckPointer(pCallerContextPointers));
+        PRECONDITION(CheckPointer(pCodeInfo));
+    }
+    CONTRACTL_END;
+
+    TADDR moduleBase = pCodeInfo->GetModuleBase();
+    PT_RUNTIME_FUNCTION pFunctionEntry = pCodeInfo->GetFunctionEntry();
+
+    // Cold code and chained unwind info describe the frame through another function entry
+    DWORD unwindInfoAddress = RUNTIME_FUNCTION__GetUnwindInfoAddress(pFunctionEntry);
+    if ((unwindInfoAddress & RUNTIME_FUNCTION_INDIRECT) != 0)
+    {
+        return false;
+    }
+
+    PTR_UNWIND_INFO pInfo = dac_cast<PTR_UNWIND_INFO>(moduleBase + unwindInfoAddress);
+    if ((pInfo->Flags & UNW_FLAG_CHAININFO) != 0)
+    {
+        return false;
+    }
+
+    // The stack probe helper is called from the prolog of methods with large frames
+    TADDR functionStart = moduleBase + RUNTIME_FUNCTION__BeginAddress(pFunctionEntry);
+    if ((TADDR)GetIP(pContext) - functionStart < pInfo->SizeOfProlog)
+    {
+        return false;
+    }
+
+    pCallerContext->ContextFlags = pContext->ContextFlags;
+    memcpy(&pCallerContext->Rax, &pContext->Rax, offsetof(T_CONTEXT, Rip) + sizeof(pContext->Rip) - offsetof(T_CONTEXT, Rax));
+    *pCallerContextPointers = *pContextPointers;
+
+    DWORD64* pRegisters = &pCallerContext->Rax;
+    PDWORD64* pRegisterPointers = pCallerContextPointers->IntegerContext;
+
+    // The offsets of UWOP_SAVE_NONVOL are relative to the frame pointer of the method if it has one
+    TADDR frameBase = pCallerContext->Rsp;
+    if (pInfo->FrameRegister != 0)
+    {
+        ULONG frameOffset = pInfo->FrameOffset;
+#ifdef TARGET_UNIX
+        if (frameOffset == 15)
+        {
+            for (ULONG i = 0; i < pInfo->CountOfUnwindCodes; i += 1 + UnwindOpExtraSlotTable[pInfo->UnwindCode[i].UnwindOp])
+            {
+                if (pInfo->UnwindCode[i].UnwindOp == UWOP_SET_FPREG_LARGE)
+                {
+                    frameOffset = pInfo->UnwindCode[i + 1].FrameOffset + (pInfo->UnwindCode[i + 2].FrameOffset << 16);
+                    break;
+                }
+            }
+        }
+#endif // TARGET_UNIX
+        frameBase = pRegisters[pInfo->FrameRegister] - frameOffset * 16;
+    }
+
+    // Past the prolog all the unwind codes apply, in order
+    TADDR sp = pCallerContext->Rsp;
+    for (ULONG i = 0; i < pInfo->CountOfUnwindCodes; i++)
+    {
+        ULONG opInfo = pInfo->UnwindCode[i].OpInfo;
+        TADDR saveAddress;
+
+        switch (pInfo->UnwindCode[i].UnwindOp)
+        {
+        case UWOP_PUSH_NONVOL:
+            pRegisters[opInfo] = *(PDWORD64)sp;
+            pRegisterPointers[opInfo] = (PDWORD64)sp;
+            sp += 8;
+            break;
+
+        case UWOP_ALLOC_SMALL:
+            sp += (opInfo * 8) + 8;
+            break;
+
+        case UWOP_ALLOC_LARGE:
+            if (opInfo == 0)
+            {
+                sp += pInfo->UnwindCode[i + 1].FrameOffset * 8;
+                i += 1;
+            }
+            else
+            {
+                sp += pInfo->UnwindCode[i + 1].FrameOffset + (pInfo->UnwindCode[i + 2].FrameOffset << 16);
+                i += 2;
+            }
+            break;
+
+        case UWOP_SET_FPREG:
+#ifdef TARGET_UNIX
+        case UWOP_SET_FPREG_LARGE:
+#endif // TARGET_UNIX
+            sp = frameBase;
+            i += UnwindOpExtraSlotTable[pInfo->UnwindCode[i].UnwindOp];
+            break;
+
+        case UWOP_SAVE_NONVOL:
+        case UWOP_SAVE_NONVOL_FAR:
+            if (pInfo->UnwindCode[i].UnwindOp == UWOP_SAVE_NONVOL)
+            {
+                saveAddress = frameBase + pInfo->UnwindCode[i + 1].FrameOffset * 8;
+                i += 1;
+            }
+            else
+            {
+                saveAddress = frameBase + pInfo->UnwindCode[i + 1].FrameOffset + (pInfo->UnwindCode[i + 2].FrameOffset << 16);
+                i += 2;
+            }
+            pRegisters[opInfo] = *(PDWORD64)saveAddress;
+            pRegisterPointers[opInfo] = (PDWORD64)saveAddress;
+            break;
+
+        case UWOP_EPILOG:
+        case UWOP_SPARE_CODE:
+        case UWOP_SAVE_XMM128:
+        case UWOP_SAVE_XMM128_FAR:
+            // Epilog descriptions don't apply to a call site and XMM registers are not unwound
+            i += UnwindOpExtraSlotTable[pInfo->UnwindCode[i].UnwindOp];
+            break;
+
+        default:
+            // UWOP_PUSH_MACHFRAME is only used by the OS
+            return false;
+        }
+    }
+
+    pCallerContext->Rip = *(PDWORD64)sp;
+    pCallerContext->Rsp = sp + 8;
+
+    if (pEstablisherFrame != NULL)
+    {
+        *pEstablisherFrame = frameBase;
+    }
+
+#ifdef _DEBUG
+    T_CONTEXT checkContext = *pContext;
+    T_KNONVOLATILE_CONTEXT_POINTERS checkContextPointers = *pContextPointers;
+    VirtualUnwindCallFrame(&checkContext, &checkContextPointers, pCodeInfo);
+
+    _ASSERTE(memcmp(&checkContext.Rax, &pCallerContext->Rax, offsetof(T_CONTEXT, Rip) + sizeof(pContext->Rip) - offsetof(T_CONTEXT, Rax)) == 0);
+    _ASSERTE(memcmp(checkContextPointers.IntegerContext, pCallerContextPointers->IntegerContext, sizeof(checkContextPointers.IntegerContext)) == 0);
+#endif // _DEBUG
+
+    return true;
+}
+
+#endif // TARGET_AMD64
+
 // static
 UINT_PTR Thread::VirtualUnwindToFirstManagedCallFrame(T_CONTEXT* pContext)
 {
@@ -2962,7 +3134,11 @@ BOOL StackFrameIterator::CheckForSkippedFrames(void)
     // frame will be reported before its containing method.
 
     // This should always succeed!  If it doesn't, it's a bug somewhere else!
-    EECodeManager::EnsureCallerContextIsValid(m_crawl.pRD, m_crawl.GetStackwalkCacheEntry(), &m_cachedCodeInfo);
+    //
+    // This is where the caller context of most managed frames gets computed. A frame that is neither the
+    // active one nor interrupted is stopped at a call site.
+    bool fCallSiteUnwind = (m_flags & CALL_SITE_UNWIND) && !m_crawl.isFirst && !m_crawl.isInterrupted;
+    EECodeManager::EnsureCallerContextIsValid(m_crawl.pRD, m_crawl.GetStackwalkCacheEntry(), &m_cachedCodeInfo, fCallSiteUnwind);
     pvReferenceSP = GetSP(m_crawl.pRD->pCallerContext);
 #endif // PROCESS_EXPLICIT_FRAME_BEFORE_MANAGED_FRAME
 
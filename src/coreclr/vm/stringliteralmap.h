@@ -41,11 +41,12 @@ public:
         return m_MemoryPool?m_MemoryPool->GetSize():0;
     }
 
-    // Method to retrieve a string from the map.
-    STRINGREF *GetStringLiteral(EEStringData *pStringData, BOOL bAddIfNotFound, BOOL bAppDomainWontUnload);
+    // Method to retrieve a string from the map. bPreferFrozenHeap is set by loader allocators that never
+    // unload, a new literal then comes from the frozen object heap.
+    STRINGREF *GetStringLiteral(EEStringData *pStringData, BOOL bAddIfNotFound, BOOL bPreferFrozenHeap);
 
     // Method to explicitly intern a string object.
-    STRINGREF *GetInternedString(STRINGREF *pString, BOOL bAddIfNotFound, BOOL bAppDomainWontUnload);
+    STRINGREF *GetInternedString(STRINGREF *pString, BOOL bAddIfNotFound);
 
 private:
     // Hash tables that maps a Unicode string to a COM+ string handle.
@@ -71,7 +72,7 @@ public:
     void Init();
 
     // Method to retrieve a string from the map. Takes a precomputed hash (for perf).
-    StringLiteralEntry *GetStringLiteral(EEStringData *pStringData, DWORD dwHash, BOOL bAddIfNotFound);
+    StringLiteralEntry *GetStringLiteral(EEStringData *pStringData, DWORD dwHash, BOOL bAddIfNotFound, BOOL bPreferFrozenHeap);
 
     // Method to explicitly intern a string object. Takes a precomputed hash (for perf).
     StringLiteralEntry *GetInternedString(STRINGREF *pString, DWORD dwHash, BOOL bAddIfNotFound);
@@ -92,7 +93,7 @@ public:
 
 private:
     // Helper method to add a string to the global string literal map.
-    StringLiteralEntry *AddStringLiteral(EEStringData *pStringData);
+    StringLiteralEntry *AddStringLiteral(EEStringData *pStringData, BOOL bPreferFrozenHeap);
 
     // Helper method to add an interned string.
     StringLiteralEntry *AddInternedString(STRINGREF *pString);
@@ -22,6 +22,8 @@
 #include "interoputil.h"
 #include "encee.h"
 #include "eventtrace.h"
+#include "runtimecounters.h"
+#include "runtimeprobes.h"
 #include "dllimportcallback.h"
 #include "comcallablewrapper.h"
 #include "eeconfig.h"
@@ -457,6 +459,42 @@ size_t BitMapSize (size_t cacheSize)
     return (cacheSize + card_size * card_word_width - 1)/ (card_size * card_word_width);
 }
 
+// ***************************************************************************
+//
+//              Live Bitmap Helper
+//
+// ***************************************************************************
+
+#define live_word_width 32
+
+size_t LiveBitMapSize (size_t cacheSize)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    return (cacheSize + live_word_width - 1) / live_word_width;
+}
+
+inline
+void SyncBlockCache::SetLive (size_t idx)
+{
+    WRAPPER_NO_CONTRACT;
+    m_LiveBitmap [idx / live_word_width] |= (1 << (idx % live_word_width));
+}
+
+inline
+void SyncBlockCache::ClearLive (size_t idx)
+{
+    WRAPPER_NO_CONTRACT;
+    m_LiveBitmap [idx / live_word_width] &= ~(1 << (idx % live_word_width));
+}
+
+inline
+BOOL SyncBlockCache::LiveP (size_t idx)
+{
+    WRAPPER_NO_CONTRACT;
+    return (m_LiveBitmap [idx / live_word_width] & (1 << (idx % live_word_width)));
+}
+
 // ***************************************************************************
 //
 //              SyncBlockCache class implementation
@@ -483,7 +521,8 @@ SyncBlockCache::SyncBlockCache()
       m_SyncTableSize(SYNC_TABLE_INITIAL_SIZE),
       m_OldSyncTables(0),
       m_bSyncBlockCleanupInProgress(FALSE),
-      m_EphemeralBitmap(0)
+      m_EphemeralBitmap(0),
+      m_LiveBitmap(0)
 {
     CONTRACTL
     {
@@ -647,6 +686,10 @@ void SyncBlockCache::Start()
 
     memset (bm, 0, BitMapSize (SYNC_TABLE_INITIAL_SIZE+1)*sizeof(DWORD));
 
+    DWORD* lbm = new DWORD [LiveBitMapSize(SYNC_TABLE_INITIAL_SIZE+1)];
+
+    memset (lbm, 0, LiveBitMapSize (SYNC_TABLE_INITIAL_SIZE+1)*sizeof(DWORD));
+
     SyncTableEntry::GetSyncTableEntryByRef() = new SyncTableEntry[SYNC_TABLE_INITIAL_SIZE+1];
 #ifdef _DEBUG
     for (int i=0; i<SYNC_TABLE_INITIAL_SIZE+1; i++) {
@@ -658,6 +701,7 @@ void SyncBlockCache::Start()
     SyncBlockCache::GetSyncBlockCache() = new (&g_SyncBlockCacheInstance) SyncBlockCache;
 
     SyncBlockCache::GetSyncBlockCache()->m_EphemeralBitmap = bm;
+    SyncBlockCache::GetSyncBlockCache()->m_LiveBitmap = lbm;
 
 #ifndef TARGET_UNIX
     InitializeSListHead(&InteropSyncBlockInfo::s_InteropInfoStandbyList);
@@ -822,6 +866,7 @@ void SyncBlockCache::Grow()
 
     NewArrayHolder<SyncTableEntry> newSyncTable (NULL);
     NewArrayHolder<DWORD>          newBitMap    (NULL);
+    NewArrayHolder<DWORD>          newLiveBitMap (NULL);
     DWORD *                        oldBitMap;
 
     // Compute the size of the new synctable. Normally, we double it - unless
@@ -845,6 +890,7 @@ void SyncBlockCache::Grow()
 
     newSyncTable = new SyncTableEntry[newSyncTableSize];
     newBitMap = new DWORD[BitMapSize (newSyncTableSize)];
+    newLiveBitMap = new DWORD[LiveBitMapSize (newSyncTableSize)];
 
 
     {
@@ -855,6 +901,7 @@ void SyncBlockCache::Grow()
 
         newSyncTable.SuppressRelease();
         newBitMap.SuppressRelease();
+        newLiveBitMap.SuppressRelease();
 
 
         // We chain old table because we can't delete
@@ -875,6 +922,14 @@ void SyncBlockCache::Grow()
         m_EphemeralBitmap = newBitMap;
         delete[] oldBitMap;
 
+        memset (newLiveBitMap, 0, LiveBitMapSize (newSyncTableSize)*sizeof (DWORD));
+        CopyMemory (newLiveBitMap, m_LiveBitmap,
+                    LiveBitMapSize (m_SyncTableSize)*sizeof (DWORD));
+
+        oldBitMap = m_LiveBitmap;
+        m_LiveBitmap = newLiveBitMap;
+        delete[] oldBitMap;
+
         _ASSERTE((m_SyncTableSize & MASK_SYNCBLOCKINDEX) == m_SyncTableSize);
         // note: we do not care if another thread does not see the new size
         // however we really do not want it to see the new size without seeing the new array
@@ -945,6 +1000,7 @@ DWORD SyncBlockCache::NewSyncBlockSlot(Object *obj)
 
 
     CardTableSetBit (indexNewEntry);
+    SetLive (indexNewEntry);
 
     // In debug builds the m_SyncBlock at indexNewEntry should already be null, since we should
     // start out with a null table and always null it out on delete.
@@ -1186,12 +1242,38 @@ void SyncBlockCache::GCWeakPtrScan(HANDLESCANPROC scanProc, uintptr_t lp1, uintp
     }
     else
     {
-        for (DWORD nb = 1; nb < m_FreeSyncTableIndex; nb++)
+        // Only visit the entries in use, so that the cost of a full GC scales with the number of
+        // live entries rather than with the high-water mark of the table
+        DWORD liveCount = 0;
+        DWORD freedCount = 0;
+        size_t liveWords = LiveBitMapSize (m_FreeSyncTableIndex);
+        for (size_t dw = 0; dw < liveWords; dw++)
         {
-            GCWeakPtrScanElement (nb, scanProc, lp1, lp2, fSetSyncBlockCleanup);
-        }
+            DWORD bits = m_LiveBitmap[dw];
+            while (bits != 0)
+            {
+                DWORD bit;
+                BitScanForward (&bit, bits);
+                bits &= bits - 1;
 
+                DWORD nb = (DWORD)(dw * live_word_width + bit);
+                _ASSERTE ((nb > 0) && (nb < m_FreeSyncTableIndex));
+                if (GCWeakPtrScanElement (nb, scanProc, lp1, lp2, fSetSyncBlockCleanup))
+                {
+                    freedCount++;
+                }
+                else
+                {
+                    liveCount++;
+                }
+            }
+        }
 
+        // If this scan left the table mostly free, compact the free list
+        if ((freedCount > 0) && (liveCount < m_FreeSyncTableIndex / 4))
+        {
+            CompactFreeSyncTableList();
+        }
     }
 
     if (fSetSyncBlockCleanup)
@@ -1307,6 +1389,7 @@ BOOL SyncBlockCache::GCWeakPtrScanElement (int nb, HANDLESCANPROC scanProc, LPAR
             SyncTableEntry::GetSyncTableEntry()[nb].m_Object = (Object *)(m_FreeSyncTableList | 1);
             m_FreeSyncTableList = nb << 1;
             SyncTableEntry::GetSyncTableEntry()[nb].m_SyncBlock = NULL;
+            ClearLive (nb);
             return TRUE;
         }
         else
@@ -1319,6 +1402,50 @@ BOOL SyncBlockCache::GCWeakPtrScanElement (int nb, HANDLESCANPROC scanProc, LPAR
     return FALSE;
 }
 
+// Rebuild the list of free SyncTableEntries after a full GC left the table sparse. Free entries at
+// the end of the table are returned to the never-used area, and the remaining free entries are
+// chained in ascending order so that new slots are packed at the start of the table. This keeps
+// m_FreeSyncTableIndex, and with it the ephemeral scan and the live bitmap scan, from staying at
+// the high-water mark.
+void SyncBlockCache::CompactFreeSyncTableList()
+{
+    CONTRACTL
+    {
+        INSTANCE_CHECK;
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+    }
+    CONTRACTL_END;
+
+    SyncTableEntry *syncTable = SyncTableEntry::GetSyncTableEntry();
+
+    DWORD freeSyncTableIndex = m_FreeSyncTableIndex;
+    while ((freeSyncTableIndex > 1) && !LiveP (freeSyncTableIndex - 1))
+    {
+        freeSyncTableIndex--;
+        _ASSERTE (syncTable[freeSyncTableIndex].m_SyncBlock == NULL);
+        syncTable[freeSyncTableIndex].m_Object = NULL;
+    }
+
+    size_t freeSyncTableList = 0;
+    for (DWORD nb = freeSyncTableIndex - 1; nb > 0; nb--)
+    {
+        if (!LiveP (nb))
+        {
+            _ASSERTE (syncTable[nb].m_SyncBlock == NULL);
+            syncTable[nb].m_Object = (Object *)(freeSyncTableList | 1);
+            freeSyncTableList = nb << 1;
+        }
+    }
+
+    STRESS_LOG2 (LF_GC | LF_SYNC, LL_INFO100, "SyncBlockCache::CompactFreeSyncTableList %d -> %d\n",
+                 m_FreeSyncTableIndex, freeSyncTableIndex);
+
+    m_FreeSyncTableIndex = freeSyncTableIndex;
+    m_FreeSyncTableList = freeSyncTableList;
+}
+
 void SyncBlockCache::GCDone(BOOL demoting, int max_gen)
 {
     CONTRACTL
@@ -1431,6 +1558,9 @@ void SyncBlockCache::VerifySyncTableEntry()
             _ASSERTE(idx == nb || ((0 == idx) && (loop == max_iterations)));
             _ASSERTE(!GCHeapUtilities::GetGCHeap()->IsEphemeral(o) || CardSetP(CardOf(nb)));
         }
+
+        // Every entry that is not on the free list must be visible to the full GC scan
+        _ASSERTE(((size_t)o & 1) || LiveP(nb));
     }
 }
 
@@ -1608,15 +1738,18 @@ AwareLock::EnterHelperResult ObjHeader::EnterObjMonitorHelperSpin(Thread* pCurTh
                 return result;
             }
 
+            // Once the lock is inflated, spin only as long as recent spinners needed to acquire it
+            const DWORD lockSpinCount = awareLock->GetSpinCount();
+
             ++spinIteration;
-            if (spinIteration < spinCount)
+            if (spinIteration < lockSpinCount)
             {
                 while (true)
                 {
                     AwareLock::SpinWait(normalizationInfo, spinIteration);
 
                     ++spinIteration;
-                    if (spinIteration >= spinCount)
+                    if (spinIteration >= lockSpinCount)
                     {
                         // The last lock attempt for this spin will be done after the loop
                         break;
@@ -1625,6 +1758,8 @@ AwareLock::EnterHelperResult ObjHeader::EnterObjMonitorHelperSpin(Thread* pCurTh
                     result = awareLock->TryEnterInsideSpinLoopHelper(pCurThread);
                     if (result == AwareLock::EnterHelperResult_Entered)
                     {
+                        awareLock->RecordSpinAcquired(spinIteration);
+                        RuntimeCounters::Increment(RuntimeCounter_MonitorSpinAcquired);
                         return AwareLock::EnterHelperResult_Entered;
                     }
                     if (result == AwareLock::EnterHelperResult_UseSlowPath)
@@ -1636,8 +1771,16 @@ AwareLock::EnterHelperResult ObjHeader::EnterObjMonitorHelperSpin(Thread* pCurTh
 
             if (awareLock->TryEnterAfterSpinLoopHelper(pCurThread))
             {
+                awareLock->RecordSpinAcquired(spinIteration);
+                RuntimeCounters::Increment(RuntimeCounter_MonitorSpinAcquired);
                 return AwareLock::EnterHelperResult_Entered;
             }
+
+            if (spinIteration >= lockSpinCount)
+            {
+                awareLock->RecordSpinFailed();
+                RuntimeCounters::Increment(RuntimeCounter_MonitorSpinFailed);
+            }
             break;
         }
 
@@ -2540,19 +2683,29 @@ BOOL AwareLock::EnterEpilogHelper(Thread* pCurThread, INT32 timeOut)
     BOOLEAN IsContentionKeywordEnabled = ETW_TRACING_CATEGORY_ENABLED(MICROSOFT_WINDOWS_DOTNETRUNTIME_PROVIDER_DOTNET_Context, TRACE_LEVEL_INFORMATION, CLR_CONTENTION_KEYWORD);
     LARGE_INTEGER startTicks = { {0} };
 
+    OBJECTREF obj = GetOwningObject();
+
     if (IsContentionKeywordEnabled)
     {
         QueryPerformanceCounter(&startTicks);
 
+        PTR_Thread holdingThread = m_HoldingThread;
+
         // Fire a contention start event for a managed contention
-        FireEtwContentionStart_V1(ETW::ContentionLog::ContentionStructs::ManagedContention, GetClrInstanceId());
+        FireEtwContentionStart_V2(
+            ETW::ContentionLog::ContentionStructs::ManagedContention,
+            GetClrInstanceId(),
+            this,
+            OBJECTREFToObject(obj),
+            obj != NULL ? obj->GetMethodTable() : NULL,
+            holdingThread != NULL ? (ULONGLONG)holdingThread->GetOSThreadId64() : 0);
     }
 
+    RUNTIME_PROBE2(contention_start, this, OBJECTREFToObject(obj));
+
     LogContention();
     Thread::IncrementMonitorLockContentionCount(pCurThread);
 
-    OBJECTREF obj = GetOwningObject();
-
     // We cannot allow the AwareLock to be cleaned up underneath us by the GC.
     IncrementTransientPrecious();
 
@@ -2691,6 +2844,7 @@ BOOL AwareLock::EnterEpilogHelper(Thread* pCurThread, INT32 timeOut)
         FireEtwContentionStop_V1(ETW::ContentionLog::ContentionStructs::ManagedContention, GetClrInstanceId(), elapsedTimeInNanosecond);
     }
 
+    RUNTIME_PROBE2(contention_end, this, ret != WAIT_TIMEOUT);
 
     if (ret == WAIT_TIMEOUT)
     {
@@ -444,6 +444,11 @@ private:
 
     DWORD m_waiterStarvationStartTimeMs;
 
+    // Number of spin iterations a thread spins on this lock before waiting. It starts at
+    // g_SpinConstants.dwMonitorSpinCount and is adjusted by how long recent spinners took to acquire the lock, see
+    // RecordSpinAcquired() and RecordSpinFailed(). Updates are not synchronized, a lost update is harmless.
+    DWORD m_spinCount;
+
     static const DWORD WaiterStarvationDurationMsBeforeStoppingPreemptingWaiters = 100;
 
     // Only SyncBlocks can create AwareLocks.  Hence this private constructor.
@@ -455,7 +460,8 @@ private:
 #endif // DACCESS_COMPILE
           m_TransientPrecious(0),
           m_dwSyncIndex(indx),
-          m_waiterStarvationStartTimeMs(0)
+          m_waiterStarvationStartTimeMs(0),
+          m_spinCount(g_SpinConstants.dwMonitorSpinCount)
     {
         LIMITED_METHOD_CONTRACT;
     }
@@ -520,6 +526,11 @@ private:
     void RecordWaiterStarvationStartTime();
     bool ShouldStopPreemptingWaiters() const;
 
+public:
+    DWORD GetSpinCount() const;
+    void RecordSpinAcquired(DWORD spinIteration);
+    void RecordSpinFailed();
+
 private: // friend access is required for this unsafe function
     void InitializeToLockedWithNoWaiters(ULONG recursionLevel, PTR_Thread holdingThread)
     {
@@ -1252,6 +1263,7 @@ class SyncBlockCache
 
     BOOL        m_bSyncBlockCleanupInProgress;  // A flag indicating if sync block cleanup is in progress.
     DWORD*      m_EphemeralBitmap;      // card table for ephemeral scanning
+    DWORD*      m_LiveBitmap;           // one bit per SyncTableEntry in use, for scanning during full GCs
 
     BOOL        GCWeakPtrScanElement(int elindex, HANDLESCANPROC scanProc, LPARAM lp1, LPARAM lp2, BOOL& cleanup);
 
@@ -1259,6 +1271,10 @@ class SyncBlockCache
     void ClearCard (size_t card);
     BOOL CardSetP (size_t card);
     void CardTableSetBit (size_t idx);
+    void SetLive (size_t idx);
+    void ClearLive (size_t idx);
+    BOOL LiveP (size_t idx);
+    void CompactFreeSyncTableList();
     void Grow();
 
 
@@ -457,6 +457,41 @@ FORCEINLINE bool AwareLock::ShouldStopPreemptingWaiters() const
         GetTickCount() - waiterStarvationStartTimeMs >= WaiterStarvationDurationMsBeforeStoppingPreemptingWaiters;
 }
 
+FORCEINLINE DWORD AwareLock::GetSpinCount() const
+{
+    LIMITED_METHOD_CONTRACT;
+
+    DWORD spinCount = VolatileLoadWithoutBarrier(&m_spinCount);
+    _ASSERTE(spinCount <= g_SpinConstants.dwMonitorSpinCount);
+    return spinCount;
+}
+
+FORCEINLINE void AwareLock::RecordSpinAcquired(DWORD spinIteration)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    // Move the spin count towards twice the number of iterations it took to acquire the lock, so that a lock that is held
+    // for short durations is not spun on for much longer than necessary, while a spinner that barely made it lets the spin
+    // count grow
+    DWORD maxSpinCount = g_SpinConstants.dwMonitorSpinCount;
+    DWORD targetSpinCount = min(maxSpinCount, (spinIteration + 1) * 2);
+    DWORD spinCount = VolatileLoadWithoutBarrier(&m_spinCount);
+    spinCount = (spinCount * 3 + targetSpinCount + 3) / 4;
+    VolatileStoreWithoutBarrier(&m_spinCount, min(maxSpinCount, spinCount));
+}
+
+FORCEINLINE void AwareLock::RecordSpinFailed()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    // Spinning did not acquire the lock, so it is likely held for longer than a spin. Spin less next time, but keep a minimum
+    // so that a lock that becomes short-held again can be detected through RecordSpinAcquired().
+    DWORD minSpinCount = min(g_SpinConstants.dwMonitorSpinCount, max((DWORD)2, g_SpinConstants.dwMonitorSpinCount / 8));
+    DWORD spinCount = VolatileLoadWithoutBarrier(&m_spinCount);
+    spinCount -= spinCount / 4;
+    VolatileStoreWithoutBarrier(&m_spinCount, max(minSpinCount, spinCount));
+}
+
 FORCEINLINE void AwareLock::SpinWait(const YieldProcessorNormalizationInfo &normalizationInfo, DWORD spinIteration)
 {
     WRAPPER_NO_CONTRACT;
@@ -565,10 +565,11 @@ void ManagedPerAppDomainTPCount::SetAppDomainRequestsActive()
     _ASSERTE(m_index.m_dwIndex != UNUSED_THREADPOOL_INDEX);
 
 #ifndef DACCESS_COMPILE
-        LONG count = VolatileLoad(&m_numRequestsPending);
+        LONG* pNumRequestsPending = &m_shards[GetCurrentShardIndex()].m_numRequestsPending;
+        LONG count = VolatileLoad(pNumRequestsPending);
         while (true)
         {
-            LONG prev = FastInterlockCompareExchange(&m_numRequestsPending, count+1, count);
+            LONG prev = FastInterlockCompareExchange(pNumRequestsPending, count+1, count);
             if (prev == count)
             {
                 ThreadpoolMgr::MaybeAddWorkingWorker();
@@ -590,13 +591,17 @@ void ManagedPerAppDomainTPCount::ClearAppDomainRequestsActive()
 
     _ASSERTE(m_index.m_dwIndex != UNUSED_THREADPOOL_INDEX);
 
-    LONG count = VolatileLoad(&m_numRequestsPending);
-    while (count > 0)
+    for (DWORD i = 0; i < m_numShards; i++)
     {
-        LONG prev = FastInterlockCompareExchange(&m_numRequestsPending, 0, count);
-        if (prev == count)
-            break;
-        count = prev;
+        LONG* pNumRequestsPending = &m_shards[i].m_numRequestsPending;
+        LONG count = VolatileLoad(pNumRequestsPending);
+        while (count > 0)
+        {
+            LONG prev = FastInterlockCompareExchange(pNumRequestsPending, 0, count);
+            if (prev == count)
+                break;
+            count = prev;
+        }
     }
 }
 
@@ -605,17 +610,42 @@ bool ManagedPerAppDomainTPCount::TakeActiveRequest()
     LIMITED_METHOD_CONTRACT;
     _ASSERTE(!ThreadpoolMgr::UsePortableThreadPool());
 
-    LONG count = VolatileLoad(&m_numRequestsPending);
-    while (count > 0)
+    // Prefer the local shard, then steal from the others so that a request credited on
+    // another processor is never lost.
+    DWORD startIndex = GetCurrentShardIndex();
+    for (DWORD i = 0; i < m_numShards; i++)
     {
-        LONG prev = FastInterlockCompareExchange(&m_numRequestsPending, count-1, count);
-        if (prev == count)
-            return true;
-        count = prev;
+        LONG* pNumRequestsPending = &m_shards[(startIndex + i) % m_numShards].m_numRequestsPending;
+        LONG count = VolatileLoad(pNumRequestsPending);
+        while (count > 0)
+        {
+            LONG prev = FastInterlockCompareExchange(pNumRequestsPending, count-1, count);
+            if (prev == count)
+                return true;
+            count = prev;
+        }
     }
     return false;
 }
 
+DWORD ManagedPerAppDomainTPCount::GetCurrentShardIndex()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    if (m_numShards == 1)
+        return 0;
+
+    DWORD processorNumber = 0;
+#ifndef TARGET_UNIX
+    processorNumber = GetCurrentProcessorNumber();
+#else // !TARGET_UNIX
+    if (PAL_HasGetCurrentProcessorNumber())
+        processorNumber = GetCurrentProcessorNumber();
+#endif // !TARGET_UNIX
+
+    return processorNumber % m_numShards;
+}
+
 #ifndef DACCESS_COMPILE
 
 //---------------------------------------------------------------------------
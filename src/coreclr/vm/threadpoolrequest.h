@@ -78,23 +78,45 @@ typedef DPTR(IPerAppDomainTPCount) PTR_IPerAppDomainTPCount;
 //actual work queue is in managed (implemented in threadpool.cs). This class
 //just provides heuristics to the thread pool scheduler, along with
 //synchronization to indicate start/end of requests to the scheduler.
+//
+//Since the counts are only heuristics, they are sharded by processor: each
+//request is credited to and taken from the shard of the processor the thread
+//is running on, falling back to the other shards only when the local one is
+//empty. This keeps the interlocked traffic from workers on different cores
+//off a single cache line.
+
+#define TP_REQUEST_COUNT_MAX_SHARDS 64
+
 class ManagedPerAppDomainTPCount : public IPerAppDomainTPCount {
 public:
 
-    ManagedPerAppDomainTPCount(TPIndex index) {ResetState(); m_index = index;}
+    ManagedPerAppDomainTPCount(TPIndex index)
+    {
+        LIMITED_METHOD_CONTRACT;
+
+        m_numShards = min((DWORD)TP_REQUEST_COUNT_MAX_SHARDS, max((DWORD)1, GetCurrentProcessCpuCount()));
+        ResetState();
+        m_index = index;
+    }
 
     inline void ResetState()
     {
         LIMITED_METHOD_CONTRACT;
-        VolatileStore(&m_numRequestsPending, (LONG)0);
+        for (DWORD i = 0; i < TP_REQUEST_COUNT_MAX_SHARDS; i++)
+            VolatileStore(&m_shards[i].m_numRequestsPending, (LONG)0);
     }
 
     inline BOOL IsRequestPending()
     {
         LIMITED_METHOD_CONTRACT;
 
-        LONG count = VolatileLoad(&m_numRequestsPending);
-        return count > 0;
+        for (DWORD i = 0; i < m_numShards; i++)
+        {
+            LONG count = VolatileLoad(&m_shards[i].m_numRequestsPending);
+            if (count > 0)
+                return TRUE;
+        }
+        return FALSE;
     }
 
     void SetAppDomainRequestsActive();
@@ -133,13 +155,18 @@ public:
     void DispatchWorkItem(bool* foundWork, bool* wasNotRecalled);
 
 private:
-    TPIndex m_index;
-    struct DECLSPEC_ALIGN(MAX_CACHE_LINE_SIZE) {
-        BYTE m_padding1[MAX_CACHE_LINE_SIZE - sizeof(LONG)];
+    DWORD GetCurrentShardIndex();
+
+    struct RequestCountShard {
         // Only use with VolatileLoad+VolatileStore+FastInterlockCompareExchange
         LONG m_numRequestsPending;
-        BYTE m_padding2[MAX_CACHE_LINE_SIZE];
+        BYTE m_padding[MAX_CACHE_LINE_SIZE - sizeof(LONG)];
     };
+
+    TPIndex m_index;
+    DWORD m_numShards;
+    BYTE m_padding1[MAX_CACHE_LINE_SIZE];
+    RequestCountShard m_shards[TP_REQUEST_COUNT_MAX_SHARDS];
 };
 
 //--------------------------------------------------------------------------
@@ -1436,6 +1436,7 @@ Thread::Thread()
     m_profilerCallbackState = 0;
 #if defined(PROFILING_SUPPORTED) || defined(PROFILING_SUPPORTED_DATA)
     m_dwProfilerEvacuationCounter = 0;
+    m_pProfilerEnterLeaveBuffer = NULL;
 #endif // defined(PROFILING_SUPPORTED) || defined(PROFILING_SUPPORTED_DATA)
 
     m_pProfilerFilterContext = NULL;
@@ -1596,8 +1597,18 @@ Thread::Thread()
 
     m_pAllLoggedTypes = NULL;
 
+#ifdef FEATURE_EH_FUNCLETS
+    m_pEECodeInfoCache = NULL;
+#endif // FEATURE_EH_FUNCLETS
+
+    m_pCachedStackTrace = NULL;
+    m_cCachedStackTrace = 0;
+
 #ifdef FEATURE_PERFTRACING
     memset(&m_activityId, 0, sizeof(m_activityId));
+#ifdef FEATURE_EVENTPIPE_ASYNC_SAMPLING
+    m_pAsyncSampleBuffer = NULL;
+#endif // FEATURE_EVENTPIPE_ASYNC_SAMPLING
 #endif // FEATURE_PERFTRACING
     m_HijackReturnKind = RT_Illegal;
 
@@ -2566,6 +2577,14 @@ Thread::~Thread()
     delete m_pTrackSync;
 #endif // TRACK_SYNC
 
+#ifdef PROFILING_SUPPORTED
+    if (m_pProfilerEnterLeaveBuffer != NULL)
+    {
+        ProfilerEnterLeaveBuffer::Destroy(m_pProfilerEnterLeaveBuffer);
+        m_pProfilerEnterLeaveBuffer = NULL;
+    }
+#endif // PROFILING_SUPPORTED
+
     _ASSERTE(IsDead() || IsUnstarted() || IsAtProcessExit());
 
     if (m_WaitEventLink.m_Next != NULL && !IsAtProcessExit())
@@ -2659,6 +2678,18 @@ Thread::~Thread()
     }
 #endif // FEATURE_EVENT_TRACE
 
+#ifdef FEATURE_EH_FUNCLETS
+    delete (EECodeInfoCache *)m_pEECodeInfoCache;
+#endif // FEATURE_EH_FUNCLETS
+
+    delete [] m_pCachedStackTrace;
+
+#ifdef FEATURE_EVENTPIPE_ASYNC_SAMPLING
+    delete m_pAsyncSampleBuffer;
+#endif // FEATURE_EVENTPIPE_ASYNC_SAMPLING
+
+    delete m_pStackBlockCache;
+
     // Wait for another thread to leave its loop in DeadlockAwareLock::TryBeginEnterLock
     CrstHolder lock(&g_DeadlockAwareCrst);
 }
@@ -7192,6 +7223,7 @@ BOOL Thread::HaveExtraWorkForFinalizer()
         || Thread::CleanupNeededForFinalizedThread()
         || (m_DetachCount > 0)
         || SystemDomain::System()->RequireAppDomainCleanup()
+        || LoaderAllocator::HasPendingTeardown()
         || ThreadStore::s_pThreadStore->ShouldTriggerGCForDeadThreads();
 }
 
@@ -7225,6 +7257,12 @@ void Thread::DoExtraWorkForFinalizer()
 
         SyncBlockCache::GetSyncBlockCache()->CleanupSyncBlocks();
     }
+    if (LoaderAllocator::HasPendingTeardown())
+    {
+        GCX_PREEMP();
+        LoaderAllocator::TearDownPendingLoaderAllocators();
+    }
+
     if (SystemDomain::System()->RequireAppDomainCleanup())
     {
         SystemDomain::System()->ProcessDelayedUnloadLoaderAllocators();
@@ -7786,6 +7824,13 @@ void Thread::DeleteThreadStaticData()
     }
     CONTRACTL_END;
 
+#ifdef FEATURE_INLINED_THREAD_STATICS
+    if (this == GetThreadNULLOk())
+    {
+        ThreadStatics::ClearInlinedThreadStaticBases();
+    }
+#endif
+
     m_ThreadLocalBlock.FreeTable();
 }
 
@@ -147,6 +147,7 @@ class     PrepareCodeConfig;
 class     NativeCodeVersion;
 
 struct    ThreadLocalBlock;
+struct    ProfilerEnterLeaveBuffer;
 typedef DPTR(struct ThreadLocalBlock) PTR_ThreadLocalBlock;
 typedef DPTR(PTR_ThreadLocalBlock) PTR_PTR_ThreadLocalBlock;
 
@@ -174,6 +175,7 @@ typedef DPTR(struct ThreadLocalModule) PTR_ThreadLocalModule;
 class ThreadStaticHandleTable;
 struct ThreadLocalModule;
 class Module;
+class StackBlockCache;
 
 struct ThreadLocalBlock
 {
@@ -1065,6 +1067,13 @@ public:
     // checkpoint is exited by the running thread.
     StackingAllocator* m_stackLocalAllocator = NULL;
 
+    // Blocks released by this thread's StackingAllocators, kept for reuse by the next ones
+    StackBlockCache* m_pStackBlockCache = NULL;
+
+    // QueryPerformanceCounter value taken when Thread.Start asked for this thread to be
+    // created, reported in the ThreadRunning event as the thread's startup latency
+    LARGE_INTEGER m_startRequestTimestamp = {};
+
     // If we are trying to suspend a thread, we set the appropriate pending bit to
     // indicate why we want to suspend it (TS_GCSuspendPending or TS_DebugSuspendPending).
     //
@@ -2971,6 +2980,11 @@ public:
     // may still execute GS cookie tracking/checking code paths.
     #define SKIP_GSCOOKIE_CHECK 0x10000
 
+    // Managed frames that are stopped at a call site are unwound straight from their frame pointer and
+    // unwind codes, and only their integer registers are restored (see Thread::VirtualUnwindCallSiteFrame).
+    // That is all GC root enumeration needs.
+    #define CALL_SITE_UNWIND 0x20000
+
     StackWalkAction StackWalkFramesEx(
                         PREGDISPLAY pRD,        // virtual register set at crawl start
                         PSTACKWALKFRAMESCALLBACK pCallback,
@@ -3006,6 +3020,11 @@ public:
     static PCODE VirtualUnwindNonLeafCallFrame(T_CONTEXT* pContext, T_KNONVOLATILE_CONTEXT_POINTERS* pContextPointers = NULL,
         PT_RUNTIME_FUNCTION pFunctionEntry = NULL, UINT_PTR uImageBase = NULL);
     static UINT_PTR VirtualUnwindToFirstManagedCallFrame(T_CONTEXT* pContext);
+#ifdef TARGET_AMD64
+    static bool VirtualUnwindCallSiteFrame(const T_CONTEXT* pContext, const T_KNONVOLATILE_CONTEXT_POINTERS* pContextPointers,
+        T_CONTEXT* pCallerContext, T_KNONVOLATILE_CONTEXT_POINTERS* pCallerContextPointers, EECodeInfo* pCodeInfo,
+        TADDR* pEstablisherFrame = NULL);
+#endif // TARGET_AMD64
 #endif // DACCESS_COMPILE
 #endif // FEATURE_EH_FUNCLETS
 
@@ -3623,6 +3642,12 @@ private:
     // Why volatile?
     // See code:ProfilingAPIUtility::InitializeProfiling#LoadUnloadCallbackSynchronization.
     Volatile<DWORD> m_dwProfilerEvacuationCounter;
+
+    //---------------------------------------------------------------
+    // Enter/leave records of this thread when the profiler uses enter/leave
+    // buffering. Allocated on the first enter/leave event of the thread.
+    //---------------------------------------------------------------
+    ProfilerEnterLeaveBuffer * m_pProfilerEnterLeaveBuffer;
 #endif // defined(PROFILING_SUPPORTED) || defined(PROFILING_SUPPORTED_DATA)
 
 private:
@@ -3816,6 +3841,19 @@ public:
         m_dwProfilerEvacuationCounter--;
     }
 
+    FORCEINLINE ProfilerEnterLeaveBuffer * GetProfilerEnterLeaveBuffer(void)
+    {
+        LIMITED_METHOD_CONTRACT;
+        return VolatileLoad(&m_pProfilerEnterLeaveBuffer);
+    }
+
+    FORCEINLINE void SetProfilerEnterLeaveBuffer(ProfilerEnterLeaveBuffer * pBuffer)
+    {
+        LIMITED_METHOD_CONTRACT;
+        _ASSERTE(m_pProfilerEnterLeaveBuffer == NULL);
+        VolatileStore(&m_pProfilerEnterLeaveBuffer, pBuffer);
+    }
+
 #endif // PROFILING_SUPPORTED
 
     //-------------------------------------------------------------------------
@@ -4525,6 +4563,77 @@ public:
         m_pAllLoggedTypes = pAllLoggedTypes;
     }
 
+#ifdef FEATURE_EH_FUNCLETS
+private:
+    // Cache of code lookups for frames unwound by exception dispatch on this thread.
+    // Allocated the first time the thread dispatches an exception.
+    PTR_VOID m_pEECodeInfoCache;
+
+#ifndef DACCESS_COMPILE
+public:
+    EECodeInfoCache * GetEECodeInfoCache()
+    {
+        CONTRACTL {
+            NOTHROW;
+            GC_NOTRIGGER;
+        } CONTRACTL_END;
+
+        // Only the thread itself may fill in its cache
+        _ASSERTE(this == GetThreadNULLOk());
+
+        if (m_pEECodeInfoCache == NULL)
+        {
+            FAULT_NOT_FATAL();
+            m_pEECodeInfoCache = new (nothrow) EECodeInfoCache();
+        }
+        return (EECodeInfoCache *)m_pEECodeInfoCache;
+    }
+#endif // !DACCESS_COMPILE
+#endif // FEATURE_EH_FUNCLETS
+
+private:
+    // Native stack trace buffer of the last exception dispatched on this thread, kept for the
+    // next one so that a throw does not have to allocate it. See StackTraceInfo.
+    StackTraceElement * m_pCachedStackTrace;
+    unsigned            m_cCachedStackTrace;
+
+    // Larger buffers are freed rather than cached.
+    static const unsigned MaxCachedStackTraceElements = 256;
+
+#ifndef DACCESS_COMPILE
+public:
+    StackTraceElement * TakeCachedStackTrace(unsigned * pcElements)
+    {
+        LIMITED_METHOD_CONTRACT;
+
+        // Only the thread itself may use its cache
+        _ASSERTE(this == GetThreadNULLOk());
+
+        StackTraceElement * pStackTrace = m_pCachedStackTrace;
+        *pcElements = m_cCachedStackTrace;
+        m_pCachedStackTrace = NULL;
+        m_cCachedStackTrace = 0;
+        return pStackTrace;
+    }
+
+    // Returns TRUE if the thread took ownership of the buffer.
+    BOOL CacheStackTrace(StackTraceElement * pStackTrace, unsigned cElements)
+    {
+        LIMITED_METHOD_CONTRACT;
+
+        _ASSERTE(this == GetThreadNULLOk());
+
+        if (m_pCachedStackTrace != NULL || cElements > MaxCachedStackTraceElements)
+        {
+            return FALSE;
+        }
+
+        m_pCachedStackTrace = pStackTrace;
+        m_cCachedStackTrace = cElements;
+        return TRUE;
+    }
+#endif // !DACCESS_COMPILE
+
 #ifdef FEATURE_PERFTRACING
 private:
 
@@ -4567,6 +4676,38 @@ public:
 
         m_activityId = *pActivityId;
     }
+
+#ifdef FEATURE_EVENTPIPE_ASYNC_SAMPLING
+public:
+    // A stack sample handed from the activation handler running on this thread to the
+    // EventPipe sampling thread. m_state moves Idle -> Requested on the sampling thread,
+    // Requested -> Capturing -> Ready in the handler and Ready -> Idle once the sample
+    // has been written out.
+    struct AsyncSampleBuffer
+    {
+        enum State : LONG
+        {
+            Idle,
+            Requested,
+            Capturing,
+            Ready
+        };
+
+        static const DWORD MaxFrames = 100;
+
+        Volatile<LONG>  m_state;
+        DWORD           m_frameCount;
+        UINT_PTR        m_frames[MaxFrames];
+    };
+
+    AsyncSampleBuffer *GetOrCreateAsyncSampleBuffer();
+    bool RequestAsyncSample();
+    bool TryCaptureAsyncSample(CONTEXT *interruptedContext);
+
+private:
+    // Allocated by the sampling thread on first use, since the signal handler cannot allocate
+    AsyncSampleBuffer * m_pAsyncSampleBuffer;
+#endif // FEATURE_EVENTPIPE_ASYNC_SAMPLING
 #endif // FEATURE_PERFTRACING
 
 #ifdef FEATURE_HIJACK
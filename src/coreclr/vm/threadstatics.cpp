@@ -719,4 +719,105 @@ PTR_ThreadLocalModule ThreadStatics::AllocateTLM(Module * pModule)
     return pThreadLocalModule;
 }
 
+#ifdef FEATURE_INLINED_THREAD_STATICS
+
+struct InlinedThreadStaticBases
+{
+    void * m_pNonGCStaticsBase[ThreadStatics::INLINED_THREAD_STATIC_SLOTS];
+};
+
+// The initial-exec model places the table in the static TLS block, so its distance from the thread
+// pointer is a load-time constant shared by all threads and JIT-ed code can read it as fs:[offset].
+static __thread InlinedThreadStaticBases t_inlinedThreadStaticBases __attribute__((tls_model("initial-exec")));
+
+// Types that have been handed a slot, in slot order. Entries are only ever claimed, never released.
+static MethodTable * s_inlinedThreadStaticTypes[ThreadStatics::INLINED_THREAD_STATIC_SLOTS];
+
+static INT64 GetInlinedThreadStaticBasesOffset()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    BYTE * pThreadPointer;
+    __asm__ ("movq %%fs:0, %0" : "=r"(pThreadPointer));
+
+    return (BYTE *)&t_inlinedThreadStaticBases - pThreadPointer;
+}
+
+static DWORD GetInlinedThreadStaticSlotIndex(INT32 slotOffset)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    DWORD index = (DWORD)((slotOffset - GetInlinedThreadStaticBasesOffset()) / (INT64)sizeof(void *));
+    _ASSERTE(index < ThreadStatics::INLINED_THREAD_STATIC_SLOTS);
+    _ASSERTE(s_inlinedThreadStaticTypes[index] != NULL);
+
+    return index;
+}
+
+bool ThreadStatics::GetInlinedThreadStaticSlotOffset(MethodTable * pMT, INT32 * pSlotOffset) //static
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+        PRECONDITION(!pMT->Collectible());
+    }
+    CONTRACTL_END;
+
+    INT64 basesOffset = GetInlinedThreadStaticBasesOffset();
+    if ((basesOffset < INT32_MIN) || (basesOffset + (INT64)sizeof(InlinedThreadStaticBases) > INT32_MAX))
+    {
+        // The JIT encodes the slot as a 32-bit displacement
+        return false;
+    }
+
+    // Claimed slots always precede free ones, so the first free slot seen ends the search for pMT.
+    for (DWORD i = 0; i < INLINED_THREAD_STATIC_SLOTS; i++)
+    {
+        MethodTable * pExisting = VolatileLoad(&s_inlinedThreadStaticTypes[i]);
+        if (pExisting == NULL)
+        {
+            pExisting = InterlockedCompareExchangeT(&s_inlinedThreadStaticTypes[i], pMT, (MethodTable *)NULL);
+            if (pExisting == NULL)
+            {
+                pExisting = pMT;
+            }
+        }
+
+        if (pExisting == pMT)
+        {
+            *pSlotOffset = (INT32)(basesOffset + (INT64)(i * sizeof(void *)));
+            return true;
+        }
+    }
+
+    return false;
+}
+
+MethodTable * ThreadStatics::GetInlinedThreadStaticType(INT32 slotOffset) //static
+{
+    LIMITED_METHOD_CONTRACT;
+
+    return VolatileLoad(&s_inlinedThreadStaticTypes[GetInlinedThreadStaticSlotIndex(slotOffset)]);
+}
+
+void ThreadStatics::SetInlinedNonGCThreadStaticBase(INT32 slotOffset, void * base) //static
+{
+    LIMITED_METHOD_CONTRACT;
+    _ASSERTE(base != NULL);
+
+    t_inlinedThreadStaticBases.m_pNonGCStaticsBase[GetInlinedThreadStaticSlotIndex(slotOffset)] = base;
+}
+
+void ThreadStatics::ClearInlinedThreadStaticBases() //static
+{
+    LIMITED_METHOD_CONTRACT;
+
+    // The cached bases point into thread local modules that are about to be freed
+    memset(&t_inlinedThreadStaticBases, 0, sizeof(t_inlinedThreadStaticBases));
+}
+
+#endif // FEATURE_INLINED_THREAD_STATICS
+
 #endif
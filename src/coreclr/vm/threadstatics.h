@@ -558,6 +558,19 @@ class ThreadStatics
     }
 #endif
 
+#if defined(FEATURE_INLINED_THREAD_STATICS) && !defined(DACCESS_COMPILE)
+    // The non-GC thread statics base of up to INLINED_THREAD_STATIC_SLOTS non-collectible types is
+    // cached in a per-thread table that JIT-ed code reads directly at a fixed offset from the thread
+    // pointer. Each type is handed a slot the first time a method accessing it is compiled; the slot
+    // is stable for the lifetime of the process, and is populated on each thread by the
+    // CORINFO_HELP_GETSHARED_NONGCTHREADSTATIC_BASE_OPTIMIZED helper on first access.
+    static const DWORD INLINED_THREAD_STATIC_SLOTS = 64;
+
+    static bool GetInlinedThreadStaticSlotOffset(MethodTable * pMT, INT32 * pSlotOffset);
+    static MethodTable * GetInlinedThreadStaticType(INT32 slotOffset);
+    static void SetInlinedNonGCThreadStaticBase(INT32 slotOffset, void * base);
+    static void ClearInlinedThreadStaticBases();
+#endif
 };
 
 /* static */
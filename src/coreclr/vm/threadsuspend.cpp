@@ -13,6 +13,7 @@
 #include "threadsuspend.h"
 
 #include "finalizerthread.h"
+#include "runtimeprobes.h"
 #include "dbginterface.h"
 
 // from ntstatus.h
@@ -24,6 +25,9 @@ bool ThreadSuspend::s_fSuspendRuntimeInProgress = false;
 
 bool ThreadSuspend::s_fSuspended = false;
 
+DWORD ThreadSuspend::s_lastTimeToSafepointUs = 0;
+DWORD ThreadSuspend::s_lastSignaledThreadCount = 0;
+
 CLREvent* ThreadSuspend::g_pGCSuspendEvent = NULL;
 
 ThreadSuspend::SUSPEND_REASON ThreadSuspend::m_suspendReason;
@@ -3196,6 +3200,22 @@ COR_PRF_SUSPEND_REASON GCSuspendReasonToProfSuspendReason(ThreadSuspend::SUSPEND
 // which leaves cooperative mode and waits for the GC to complete.
 //
 // See code:Thread#SuspendingTheRuntime for more
+
+static DWORD GetMicrosecondsSince(LARGE_INTEGER startTime)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    static LARGE_INTEGER freq;
+    if (freq.QuadPart == 0)
+        QueryPerformanceFrequency(&freq);
+
+    LARGE_INTEGER now;
+    QueryPerformanceCounter(&now);
+
+    ULONGLONG elapsedUs = (ULONGLONG)(now.QuadPart - startTime.QuadPart) * 1000000 / (ULONGLONG)freq.QuadPart;
+    return (elapsedUs > UINT32_MAX) ? UINT32_MAX : (DWORD)elapsedUs;
+}
+
 void ThreadSuspend::SuspendRuntime(ThreadSuspend::SUSPEND_REASON reason)
 {
     CONTRACTL {
@@ -3267,6 +3287,19 @@ void ThreadSuspend::SuspendRuntime(ThreadSuspend::SUSPEND_REASON reason)
     // in such a case.
     SuspendRuntimeInProgressHolder hldSuspendRuntimeInProgress;
 
+    LARGE_INTEGER suspendStartTime;
+    QueryPerformanceCounter(&suspendStartTime);
+    DWORD signaledThreadCount = 0;
+
+#if defined(FEATURE_HIJACK) && defined(TARGET_UNIX)
+    // When the JIT emits safepoint polls, threads running managed code notice g_TrapReturningThreads
+    // on their own.  Give them a chance to do so before falling back to activation injection, which
+    // gets expensive with thousands of threads.
+    static ConfigDWORD pollGracePeriodConfig;
+    DWORD pollGracePeriodUs = pollGracePeriodConfig.val(CLRConfig::INTERNAL_ThreadSuspendPollGracePeriodUs);
+    bool pollGracePeriodExpired = (pollGracePeriodUs == 0);
+#endif // FEATURE_HIJACK && TARGET_UNIX
+
     // Flush the store buffers on all CPUs, to ensure two things:
     // - we get a reliable reading of the threads' m_fPreemptiveGCDisabled state
     // - other threads see that g_TrapReturningThreads is set
@@ -3356,11 +3389,26 @@ void ThreadSuspend::SuspendRuntime(ThreadSuspend::SUSPEND_REASON reason)
             //       TrapReturningThreads.
 
 #if defined(FEATURE_HIJACK) && defined(TARGET_UNIX)
+            if (!pollGracePeriodExpired)
+            {
+                if (GetMicrosecondsSince(suspendStartTime) < pollGracePeriodUs)
+                {
+                    continue;
+                }
+
+                STRESS_LOG1(LF_SYNC, LL_INFO1000, "Thread::SuspendRuntime() -   Poll grace period expired, %d threads remaining\n", countThreads);
+                pollGracePeriodExpired = true;
+            }
+
             bool gcSuspensionSignalSuccess = thread->InjectGcSuspension();
             if (!gcSuspensionSignalSuccess)
             {
                 STRESS_LOG1(LF_SYNC, LL_INFO1000, "Thread::SuspendRuntime() -   Failed to raise GC suspension signal for thread %p.\n", thread);
             }
+            else
+            {
+                signaledThreadCount++;
+            }
 #endif // FEATURE_HIJACK && TARGET_UNIX
 
 #else // DISABLE_THREADSUSPEND
@@ -3585,6 +3633,9 @@ void ThreadSuspend::SuspendRuntime(ThreadSuspend::SUSPEND_REASON reason)
         g_pGCSuspendEvent->Reset();
     }
 
+    s_lastTimeToSafepointUs = GetMicrosecondsSince(suspendStartTime);
+    s_lastSignaledThreadCount = signaledThreadCount;
+
 #ifdef PROFILING_SUPPORTED
     // If a profiler is keeping track of GC events, notify it
     {
@@ -5451,6 +5502,7 @@ void ThreadSuspend::RestartEE(BOOL bFinishedGC, BOOL SuspendSucceded)
 #endif //TIME_SUSPEND
 
     FireEtwGCRestartEEBegin_V1(GetClrInstanceId());
+    RUNTIME_PROBE0(restart_ee_start);
 
 #if defined(TARGET_ARM) || defined(TARGET_ARM64)
     // Flush the store buffers on all CPUs, to ensure that they all see changes made
@@ -5526,6 +5578,7 @@ void ThreadSuspend::RestartEE(BOOL bFinishedGC, BOOL SuspendSucceded)
     ResumeRuntime(bFinishedGC, SuspendSucceded);
 
     FireEtwGCRestartEEEnd_V1(GetClrInstanceId());
+    RUNTIME_PROBE0(restart_ee_end);
 
 #ifdef TIME_SUSPEND
     g_SuspendStatistics.EndRestart();
@@ -5572,6 +5625,7 @@ void ThreadSuspend::SuspendEE(SUSPEND_REASON reason)
         (ULONG)GCHeapUtilities::GetGCHeap()->GetGcCount() : (ULONG)-1);
 
     FireEtwGCSuspendEEBegin_V1(Info.SuspendEE.Reason, Info.SuspendEE.GcCount, GetClrInstanceId());
+    RUNTIME_PROBE1(suspend_ee_start, (int)reason);
 
     LOG((LF_SYNC, INFO3, "Suspending the runtime for reason %d\n", reason));
 
@@ -5693,7 +5747,8 @@ retry_for_debugger:
 
     GC_ON_TRANSITIONS(gcOnTransitions);
 
-    FireEtwGCSuspendEEEnd_V1(GetClrInstanceId());
+    FireEtwGCSuspendEEEnd_V2(GetClrInstanceId(), s_lastTimeToSafepointUs, s_lastSignaledThreadCount);
+    RUNTIME_PROBE1(suspend_ee_end, (int)reason);
 
 #ifdef TIME_SUSPEND
     g_SuspendStatistics.EndSuspend(reason == SUSPEND_FOR_GC || reason == SUSPEND_FOR_GC_PREP);
@@ -5749,6 +5804,12 @@ void HandleGCSuspensionForInterruptedThread(CONTEXT *interruptedContext)
     if (pThread->PreemptiveGCDisabled() != TRUE)
         return;
 
+#ifdef FEATURE_EVENTPIPE_ASYNC_SAMPLING
+    // The EventPipe sampling thread may have interrupted this thread only to take a sample
+    if (pThread->TryCaptureAsyncSample(interruptedContext) && !g_TrapReturningThreads.LoadWithoutBarrier())
+        return;
+#endif // FEATURE_EVENTPIPE_ASYNC_SAMPLING
+
 #ifdef FEATURE_PERFTRACING
     // Mark that the thread is currently in managed code.
     pThread->SaveGCModeOnSuspension();
@@ -5848,6 +5909,110 @@ bool Thread::InjectGcSuspension()
     return false;
 }
 
+#ifdef FEATURE_EVENTPIPE_ASYNC_SAMPLING
+
+Thread::AsyncSampleBuffer *Thread::GetOrCreateAsyncSampleBuffer()
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+    }
+    CONTRACTL_END;
+
+    // Only the sampling thread creates the buffer, so there is no race to publish it
+    if (m_pAsyncSampleBuffer == NULL)
+    {
+        FAULT_NOT_FATAL();
+
+        AsyncSampleBuffer *pBuffer = new (nothrow) AsyncSampleBuffer();
+        if (pBuffer != NULL)
+        {
+            pBuffer->m_state = AsyncSampleBuffer::Idle;
+            pBuffer->m_frameCount = 0;
+            VolatileStore(&m_pAsyncSampleBuffer, pBuffer);
+        }
+    }
+
+    return m_pAsyncSampleBuffer;
+}
+
+// Called by the sampling thread to ask this thread for a stack sample. The sample
+// is captured asynchronously and picked up on a later sampling pass.
+bool Thread::RequestAsyncSample()
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+    }
+    CONTRACTL_END;
+
+    AsyncSampleBuffer *pBuffer = m_pAsyncSampleBuffer;
+    if (pBuffer == NULL)
+        return false;
+
+    if (FastInterlockCompareExchange((LONG *)&pBuffer->m_state, AsyncSampleBuffer::Requested, AsyncSampleBuffer::Idle) != AsyncSampleBuffer::Idle)
+        return false;
+
+    HANDLE hThread = GetThreadHandle();
+    if (hThread == INVALID_HANDLE_VALUE || !::PAL_InjectActivation(hThread))
+    {
+        FastInterlockCompareExchange((LONG *)&pBuffer->m_state, AsyncSampleBuffer::Idle, AsyncSampleBuffer::Requested);
+        return false;
+    }
+
+    return true;
+}
+
+// Runs in the activation signal handler on this thread. Records the interrupted IP followed
+// by the return addresses found by following the frame pointer chain. Only loads from the
+// thread's own stack are made, so this is safe to do at any instruction.
+bool Thread::TryCaptureAsyncSample(CONTEXT *interruptedContext)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    AsyncSampleBuffer *pBuffer = m_pAsyncSampleBuffer;
+    if (pBuffer == NULL)
+        return false;
+
+    if (FastInterlockCompareExchange((LONG *)&pBuffer->m_state, AsyncSampleBuffer::Capturing, AsyncSampleBuffer::Requested) != AsyncSampleBuffer::Requested)
+        return false;
+
+    TADDR stackBase = dac_cast<TADDR>(GetCachedStackBase());
+    TADDR stackLimit = dac_cast<TADDR>(GetCachedStackLimit());
+
+    DWORD frameCount = 0;
+    pBuffer->m_frames[frameCount++] = (UINT_PTR)GetIP(interruptedContext);
+
+    // Each frame record holds the caller's frame pointer followed by the return address
+    TADDR fp = GetFP(interruptedContext);
+    while (frameCount < AsyncSampleBuffer::MaxFrames &&
+           fp >= stackLimit && fp <= stackBase - 2 * sizeof(TADDR) &&
+           (fp & (sizeof(TADDR) - 1)) == 0)
+    {
+        TADDR callerFp = ((TADDR *)fp)[0];
+        TADDR returnAddress = ((TADDR *)fp)[1];
+        if (returnAddress == NULL)
+            break;
+
+        pBuffer->m_frames[frameCount++] = (UINT_PTR)returnAddress;
+
+        // Frames must move towards the stack base, anything else means the chain is broken
+        if (callerFp <= fp)
+            break;
+
+        fp = callerFp;
+    }
+
+    pBuffer->m_frameCount = frameCount;
+    pBuffer->m_state = AsyncSampleBuffer::Ready;
+
+    return true;
+}
+
+#endif // FEATURE_EVENTPIPE_ASYNC_SAMPLING
+
 #endif // FEATURE_HIJACK && TARGET_UNIX
 
 // Initialize thread suspension support
@@ -223,6 +223,10 @@ private:
 
     static bool     s_fSuspended;
 
+    // Statistics of the last SuspendRuntime, reported by the GCSuspendEEEnd event.
+    static DWORD    s_lastTimeToSafepointUs;
+    static DWORD    s_lastSignaledThreadCount;
+
     static void SetSuspendRuntimeInProgress();
     static void ResetSuspendRuntimeInProgress();
 
@@ -30,7 +30,8 @@
 //
 // Methods initially call into HandleCallCountingForFirstCall() and once the call count exceeds
 // a fixed limit we queue work on to our internal list of methods needing to
-// be recompiled (m_methodsToOptimize). If there is currently no thread
+// be recompiled (m_methodsToOptimize), ordered by an estimate of how frequently
+// each method is called. If there is currently no thread
 // servicing our queue asynchronously then we use the runtime threadpool
 // QueueUserWorkItem to recruit one. During the callback for each threadpool work
 // item we handle as many methods as possible in a fixed period of time, then
@@ -41,6 +42,10 @@
 // queue. For each method we jit it, then update the precode so that future
 // entrypoint callers will run the new code.
 //
+// With tiered PGO, a method that reaches the call count threshold is first rejitted
+// with instrumentation at an intermediate tier (OptimizationTier0Instrumented). Calls
+// to that code are counted again and the method then follows the same path to tier 1.
+//
 // # Error handling
 //
 // The overall principle is don't swallow terminal failures that may have corrupted the
@@ -239,6 +244,7 @@ bool TieredCompilationManager::TrySetCodeEntryPointAndRecordMethodForCallCountin
 
 void TieredCompilationManager::AsyncPromoteToTier1(
     NativeCodeVersion tier0NativeCodeVersion,
+    UINT32 callCountingDurationMs,
     bool *createTieringBackgroundWorkerRef)
 {
     CONTRACTL
@@ -251,12 +257,26 @@ void TieredCompilationManager::AsyncPromoteToTier1(
 
     _ASSERTE(CodeVersionManager::IsLockOwnedByCurrentThread());
     _ASSERTE(!tier0NativeCodeVersion.IsNull());
-    _ASSERTE(tier0NativeCodeVersion.GetOptimizationTier() == NativeCodeVersion::OptimizationTier0);
+    _ASSERTE(
+        tier0NativeCodeVersion.GetOptimizationTier() == NativeCodeVersion::OptimizationTier0 ||
+        tier0NativeCodeVersion.GetOptimizationTier() == NativeCodeVersion::OptimizationTier0Instrumented);
     _ASSERTE(createTieringBackgroundWorkerRef != nullptr);
 
     NativeCodeVersion t1NativeCodeVersion;
     HRESULT hr;
 
+    // With tiered PGO, tier 0 code is not instrumented by default. Instead, a method that reaches the call count threshold
+    // is first rejitted at an instrumented tier 0, which is call-counted again to collect a short profile before the method
+    // is promoted to tier 1. That way, only hot methods pay for instrumentation.
+    NativeCodeVersion::OptimizationTier nextOptimizationTier = NativeCodeVersion::OptimizationTier1;
+#ifdef FEATURE_PGO
+    if (tier0NativeCodeVersion.GetOptimizationTier() == NativeCodeVersion::OptimizationTier0 &&
+        IsInstrumentedTierEnabled())
+    {
+        nextOptimizationTier = NativeCodeVersion::OptimizationTier0Instrumented;
+    }
+#endif
+
     // Add an inactive native code entry in the versioning table to track the tier1
     // compilation we are going to create. This entry binds the compilation to a
     // particular version of the IL code regardless of any changes that may
@@ -265,7 +285,7 @@ void TieredCompilationManager::AsyncPromoteToTier1(
     MethodDesc *pMethodDesc = tier0NativeCodeVersion.GetMethodDesc();
     ILCodeVersion ilCodeVersion = tier0NativeCodeVersion.GetILCodeVersion();
     _ASSERTE(!ilCodeVersion.HasAnyOptimizedNativeCodeVersion(tier0NativeCodeVersion));
-    hr = ilCodeVersion.AddNativeCodeVersion(pMethodDesc, NativeCodeVersion::OptimizationTier1, &t1NativeCodeVersion);
+    hr = ilCodeVersion.AddNativeCodeVersion(pMethodDesc, nextOptimizationTier, &t1NativeCodeVersion);
     if (FAILED(hr))
     {
         ThrowHR(hr);
@@ -277,12 +297,13 @@ void TieredCompilationManager::AsyncPromoteToTier1(
     {
         LockHolder tieredCompilationLockHolder;
 
-        m_methodsToOptimize.InsertTail(pMethodListItem);
+        UINT32 priority = GetMethodToOptimizePriority(callCountingDurationMs);
+        m_methodsToOptimize[priority].InsertTail(pMethodListItem);
         ++m_countOfMethodsToOptimize;
 
-        LOG((LF_TIEREDCOMPILATION, LL_INFO10000, "TieredCompilationManager::AsyncPromoteToTier1 Method=0x%pM (%s::%s), code version id=0x%x queued\n",
+        LOG((LF_TIEREDCOMPILATION, LL_INFO10000, "TieredCompilationManager::AsyncPromoteToTier1 Method=0x%pM (%s::%s), code version id=0x%x queued, priority=%u\n",
             pMethodDesc, pMethodDesc->m_pszDebugClassName, pMethodDesc->m_pszDebugMethodName,
-            t1NativeCodeVersion.GetVersionId()));
+            t1NativeCodeVersion.GetVersionId(), priority));
 
         // The thread is in a GC_NOTRIGGER scope here. If the background worker is already running, we can schedule it inside
         // the same lock without triggering a GC.
@@ -627,9 +648,61 @@ bool TieredCompilationManager::TryDeactivateTieringDelay()
     }
 
     delete methodsPendingCounting;
+
+#ifdef FEATURE_READYTORUN
+    // Startup activity has settled, bind the call cells of code that ran during the delay so that later first calls into
+    // it from other methods do not each go through the fixup worker
+    if (CLRConfig::GetConfigValue(CLRConfig::INTERNAL_ReadyToRunBindCallCellsInBackground) != 0)
+    {
+        BindReadyToRunCallCells();
+    }
+#endif
+
     return true;
 }
 
+#ifdef FEATURE_READYTORUN
+void TieredCompilationManager::BindReadyToRunCallCells()
+{
+    CONTRACTL
+    {
+        THROWS;
+        GC_TRIGGERS;
+        MODE_PREEMPTIVE;
+    }
+    CONTRACTL_END;
+
+    _ASSERTE(GetThread() == s_backgroundWorkerThread);
+
+    COUNT_T cBound = 0;
+
+    AppDomain::AssemblyIterator i = GetAppDomain()->IterateAssembliesEx((AssemblyIterationFlags)(kIncludeLoaded | kIncludeExecution));
+    CollectibleAssemblyHolder<DomainAssembly *> pDomainAssembly;
+    while (i.Next(pDomainAssembly.This()))
+    {
+        Module *pModule = pDomainAssembly->GetModule();
+        if (!pModule->IsReadyToRun() || pModule->IsCollectible())
+        {
+            continue;
+        }
+
+        EX_TRY
+        {
+            cBound += pModule->GetReadyToRunInfo()->BindExternalMethodCells();
+        }
+        EX_CATCH
+        {
+            STRESS_LOG1(LF_TIEREDCOMPILATION, LL_WARNING, "TieredCompilationManager::BindReadyToRunCallCells: "
+                "Exception in ReadyToRunInfo::BindExternalMethodCells, hr=0x%x\n",
+                GET_EXCEPTION()->GetHR());
+        }
+        EX_END_CATCH(RethrowTerminalExceptions);
+    }
+
+    STRESS_LOG1(LF_TIEREDCOMPILATION, LL_INFO10, "TieredCompilationManager::BindReadyToRunCallCells: bound %u call cells\n", cBound);
+}
+#endif // FEATURE_READYTORUN
+
 void TieredCompilationManager::AsyncCompleteCallCounting()
 {
     CONTRACTL
@@ -929,6 +1002,13 @@ BOOL TieredCompilationManager::CompileCodeVersion(NativeCodeVersion nativeCodeVe
             // indicating that the method would not benefit from a rejit and avoid the rejit altogether.
             pCode = NULL;
         }
+        else if (config->JitSwitchedToOptimized())
+        {
+            // The JIT decided to optimize the instrumented tier 0 code (for instance, due to loops that cannot be handled at
+            // tier 0). The code is not instrumented, so don't count calls to it for promotion to tier 1.
+            _ASSERTE(nativeCodeVersion.GetOptimizationTier() == NativeCodeVersion::OptimizationTier0Instrumented);
+            nativeCodeVersion.SetOptimizationTier(NativeCodeVersion::OptimizationTierOptimized);
+        }
     }
     EX_CATCH
     {
@@ -998,18 +1078,49 @@ NativeCodeVersion TieredCompilationManager::GetNextMethodToOptimize()
 
     _ASSERTE(IsLockOwnedByCurrentThread());
 
-    SListElem<NativeCodeVersion>* pElem = m_methodsToOptimize.RemoveHead();
-    if (pElem != NULL)
+    if (m_countOfMethodsToOptimize == 0)
     {
-        NativeCodeVersion nativeCodeVersion = pElem->GetValue();
-        delete pElem;
-        _ASSERTE(m_countOfMethodsToOptimize != 0);
-        --m_countOfMethodsToOptimize;
-        return nativeCodeVersion;
+        return NativeCodeVersion();
     }
+
+    for (UINT32 priority = 0; priority < MethodsToOptimizePriorityCount; ++priority)
+    {
+        SListElem<NativeCodeVersion>* pElem = m_methodsToOptimize[priority].RemoveHead();
+        if (pElem != NULL)
+        {
+            NativeCodeVersion nativeCodeVersion = pElem->GetValue();
+            delete pElem;
+            --m_countOfMethodsToOptimize;
+            return nativeCodeVersion;
+        }
+    }
+
+    _ASSERTE(!"m_countOfMethodsToOptimize is nonzero but all queues are empty");
     return NativeCodeVersion();
 }
 
+// Maps the time a method took to reach the call count threshold to a priority bucket in m_methodsToOptimize. Lower values have
+// higher priority. Each bucket covers a doubling of the duration, such that [0, 1) ms maps to 0, [1, 2) ms maps to 1, [2, 4) ms
+// maps to 2, and so on. Methods with an unknown duration map to the lowest priority.
+//static
+UINT32 TieredCompilationManager::GetMethodToOptimizePriority(UINT32 callCountingDurationMs)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    if (callCountingDurationMs == UnknownCallCountingDurationMs)
+    {
+        return MethodsToOptimizePriorityCount - 1;
+    }
+
+    UINT32 priority = 0;
+    while (callCountingDurationMs != 0 && priority < MethodsToOptimizePriorityCount - 1)
+    {
+        callCountingDurationMs >>= 1;
+        ++priority;
+    }
+    return priority;
+}
+
 //static
 CORJIT_FLAGS TieredCompilationManager::GetJitFlags(PrepareCodeConfig *config)
 {
@@ -1075,6 +1186,13 @@ CORJIT_FLAGS TieredCompilationManager::GetJitFlags(PrepareCodeConfig *config)
             nativeCodeVersion.SetOptimizationTier(NativeCodeVersion::OptimizationTierOptimized);
             goto Optimized;
 
+        case NativeCodeVersion::OptimizationTier0Instrumented:
+            flags.Set(CORJIT_FLAGS::CORJIT_FLAG_TIER0);
+#ifdef FEATURE_PGO
+            flags.Set(CORJIT_FLAGS::CORJIT_FLAG_BBINSTR);
+#endif
+            break;
+
 #ifdef FEATURE_ON_STACK_REPLACEMENT
         case NativeCodeVersion::OptimizationTier1OSR:
             flags.Set(CORJIT_FLAGS::CORJIT_FLAG_OSR);
@@ -1098,6 +1216,19 @@ CORJIT_FLAGS TieredCompilationManager::GetJitFlags(PrepareCodeConfig *config)
     return flags;
 }
 
+#ifdef FEATURE_PGO
+// Returns true if tier 0 code is left uninstrumented and methods reaching the call count threshold go through an instrumented
+// tier before tier 1
+bool TieredCompilationManager::IsInstrumentedTierEnabled()
+{
+    WRAPPER_NO_CONTRACT;
+
+    return
+        CLRConfig::GetConfigValue(CLRConfig::INTERNAL_TieredPGO) > 0 &&
+        CLRConfig::GetConfigValue(CLRConfig::INTERNAL_TieredPGO_InstrumentOnlyHotCode) > 0;
+}
+#endif // FEATURE_PGO
+
 #ifdef _DEBUG
 bool TieredCompilationManager::IsLockOwnedByCurrentThread()
 {
@@ -39,11 +39,21 @@ public:
 
 #ifdef FEATURE_TIERED_COMPILATION
 
+public:
+    // Time taken to reach the call count threshold when it is not known, such methods are queued at the lowest priority
+    static const UINT32 UnknownCallCountingDurationMs = UINT32_MAX;
+
 public:
     void HandleCallCountingForFirstCall(MethodDesc* pMethodDesc);
     bool TrySetCodeEntryPointAndRecordMethodForCallCounting(MethodDesc* pMethodDesc, PCODE codeEntryPoint);
-    void AsyncPromoteToTier1(NativeCodeVersion tier0NativeCodeVersion, bool *createTieringBackgroundWorkerRef);
+    void AsyncPromoteToTier1(
+        NativeCodeVersion tier0NativeCodeVersion,
+        UINT32 callCountingDurationMs,
+        bool *createTieringBackgroundWorkerRef);
     static CORJIT_FLAGS GetJitFlags(PrepareCodeConfig *config);
+#ifdef FEATURE_PGO
+    static bool IsInstrumentedTierEnabled();
+#endif
 
 #if !defined(DACCESS_COMPILE) && defined(_DEBUG)
 public:
@@ -65,6 +75,9 @@ private:
 private:
     bool IsTieringDelayActive();
     bool TryDeactivateTieringDelay();
+#ifdef FEATURE_READYTORUN
+    static void BindReadyToRunCallCells();
+#endif
 
 public:
     void AsyncCompleteCallCounting();
@@ -76,6 +89,7 @@ private:
 private:
     void OptimizeMethod(NativeCodeVersion nativeCodeVersion);
     NativeCodeVersion GetNextMethodToOptimize();
+    static UINT32 GetMethodToOptimizePriority(UINT32 callCountingDurationMs);
     BOOL CompileCodeVersion(NativeCodeVersion nativeCodeVersion);
     void ActivateCodeVersion(NativeCodeVersion nativeCodeVersion);
 
@@ -122,7 +136,11 @@ private:
 #endif // !DACCESS_COMPILE
 
 private:
-    SList<SListElem<NativeCodeVersion>> m_methodsToOptimize;
+    // Methods to optimize are bucketed by priority, with the bucket at index 0 having the highest priority. A method's bucket is
+    // determined by the order of magnitude of the time it took to reach the call count threshold, such that methods that are
+    // called more frequently are optimized first. Methods within a bucket are optimized in the order they were queued.
+    static const UINT32 MethodsToOptimizePriorityCount = 16;
+    SList<SListElem<NativeCodeVersion>> m_methodsToOptimize[MethodsToOptimizePriorityCount];
     UINT32 m_countOfMethodsToOptimize;
     UINT32 m_countOfNewMethodsCalledDuringDelay;
     SArray<MethodDesc*>* m_methodsPendingCountingForTier1;
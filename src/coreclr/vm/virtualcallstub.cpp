@@ -95,6 +95,7 @@ extern size_t g_dispatch_cache_chain_success_counter;
 #include "profilepriv.h"
 #include "contractimpl.h"
 #include "dynamicinterfacecastable.h"
+#include "runtimecounters.h"
 
 SPTR_IMPL_INIT(VirtualCallStubManagerManager, VirtualCallStubManagerManager, g_pManager, NULL);
 
@@ -106,6 +107,9 @@ UINT32 STUB_COLLIDE_WRITE_PCT = 100;
 UINT32 STUB_COLLIDE_MONO_PCT  =   0;
 #endif // STUB_LOGGING
 
+// Maximum number of dispatch stubs chained at a single call site, see code:VirtualCallStubManager::ExtendPolymorphicSite
+UINT32 g_polymorphicSiteSize = 3;
+
 FastTable* BucketTable::dead = NULL;    //linked list of the abandoned buckets
 
 DispatchCache *g_resolveCache = NULL;    //cache of dispatch stubs for in line lookup by resolve stubs.
@@ -859,6 +863,8 @@ void VirtualCallStubManager::InitStatic()
     g_resetCacheIncr       = (INT32) CLRConfig::GetConfigValue(CLRConfig::INTERNAL_VirtualCallStubResetCacheIncr);
 #endif // STUB_LOGGING
 
+    g_polymorphicSiteSize  = CLRConfig::GetConfigValue(CLRConfig::INTERNAL_VirtualCallStubPolymorphicSiteSize);
+
 #ifndef STUB_DISPATCH_PORTABLE
     DispatchHolder::InitializeStatic();
     ResolveHolder::InitializeStatic();
@@ -1217,6 +1223,7 @@ VTableCallHolder* VirtualCallStubManager::GenerateVTableCallStub(DWORD slot)
 
     //incr our counters
     stats.stub_vtable_counter++;
+    RuntimeCounters::Increment(RuntimeCounter_VTableCallStubs);
     stats.stub_space += (UINT32)pHolder->stub()->size();
     LOG((LF_STUBS, LL_INFO10000, "GenerateVTableCallStub for slot " FMT_ADDR "at" FMT_ADDR "\n",
         DBG_ADDR(slot), DBG_ADDR(pHolder->stub())));
@@ -1493,7 +1500,7 @@ size_t VirtualCallStubManager::GetTokenFromStubQuick(VirtualCallStubManager * pM
     {
         _ASSERTE(pMgr->isDispatchingStub(stub));
         DispatchStub  * dispatchStub  = (DispatchStub *) PCODEToPINSTR(stub);
-        ResolveHolder * resolveHolder = ResolveHolder::FromFailEntry(dispatchStub->failTarget());
+        ResolveHolder * resolveHolder = ResolveHolder::FromFailEntry(GetResolveFailEntry(dispatchStub));
         _ASSERTE(pMgr->isResolvingStub(resolveHolder->stub()->resolveEntryPoint()));
         return resolveHolder->stub()->token();
     }
@@ -2141,6 +2148,10 @@ PCODE VirtualCallStubManager::ResolveWorker(StubCallSite* pCallSite,
             {
                 BackPatchSite(pCallSite, (PCODE)stub);
             }
+            else if (stubKind == SK_DISPATCH && bCreateDispatchStub)
+            {
+                ExtendPolymorphicSite(pCallSite, target, objectType, token.To_SIZE_T());
+            }
         }
     }
     EX_CATCH
@@ -2641,7 +2652,7 @@ void VirtualCallStubManager::BackPatchWorker(StubCallSite* pCallSite)
         //We can ignore the races now since we now know that the call site does go thru our
         //stub mechanisms, hence no matter who wins the race, we are correct.
         //We find the correct resolve stub by following the failure path in the dispatcher stub itself
-        PCODE failEntry    = dispatchStub->failTarget();
+        PCODE failEntry    = GetResolveFailEntry(dispatchStub);
         ResolveStub* resolveStub  = ResolveHolder::FromFailEntry(failEntry)->stub();
         PCODE resolveEntry = resolveStub->resolveEntryPoint();
         BackPatchSite(pCallSite, resolveEntry);
@@ -2710,6 +2721,85 @@ void VirtualCallStubManager::BackPatchSite(StubCallSite* pCallSite, PCODE stub)
     stats.site_write++;
 }
 
+//----------------------------------------------------------------------------
+/* A dispatch stub's failure target is either the fail entry of the shared resolve stub, or, for a
+polymorphic call site, the next dispatch stub of the site's chain. Follow the chain to the resolve stub.
+*/
+PCODE VirtualCallStubManager::GetResolveFailEntry(DispatchStub* pStub)
+{
+    CONTRACTL {
+        NOTHROW;
+        GC_NOTRIGGER;
+        FORBID_FAULT;
+        PRECONDITION(CheckPointer(pStub));
+    } CONTRACTL_END
+
+    PCODE failEntry = pStub->failTarget();
+    while (isDispatchingStubStatic(failEntry))
+    {
+        failEntry = DispatchHolder::FromDispatchEntry(failEntry)->stub()->failTarget();
+    }
+    return failEntry;
+}
+
+//----------------------------------------------------------------------------
+/* The call site is wired to a dispatch stub that just missed for objectType. Rather than leaving the
+site to the resolve cache, put a new dispatch stub for objectType in front of the current one, so that
+a site that sees a few types checks each of them inline. The chained stubs are private to the call site
+and are not entered into the dispatchers table. Once the chain holds g_polymorphicSiteSize types, further
+misses only feed the shared miss counter of the resolve stub, which eventually patches the site to it
+(see code:VirtualCallStubManager::BackPatchWorker).
+*/
+void VirtualCallStubManager::ExtendPolymorphicSite(StubCallSite* pCallSite,
+                                                   PCODE         target,
+                                                   MethodTable * objectType,
+                                                   size_t        dispatchToken)
+{
+    CONTRACTL {
+        THROWS;
+        GC_TRIGGERS;
+        INJECT_FAULT(COMPlusThrowOM(););
+        PRECONDITION(CheckPointer(pCallSite));
+        PRECONDITION(target != NULL);
+        PRECONDITION(CheckPointer(objectType));
+    } CONTRACTL_END
+
+    PCODE prior = pCallSite->GetSiteTarget();
+    if (!isDispatchingStub(prior))
+        return;
+
+    UINT32 siteSize = 0;
+    for (PCODE cur = prior; isDispatchingStub(cur); )
+    {
+        DispatchStub * dispatchStub = DispatchHolder::FromDispatchEntry(cur)->stub();
+
+        // Another thread may have already added this type to the site
+        if (dispatchStub->expectedMT() == (size_t)objectType)
+            return;
+
+        if (++siteSize >= g_polymorphicSiteSize)
+            return;
+
+        cur = dispatchStub->failTarget();
+    }
+
+    bool reenteredCooperativeGCMode = false;
+    DispatchHolder * pDispatchHolder = GenerateDispatchStub(
+        target, prior, objectType, dispatchToken, &reenteredCooperativeGCMode);
+    PCODE stub = pDispatchHolder->stub()->entryPoint();
+
+    // Only publish the new stub if the site has not been patched by someone else in the meantime,
+    // in particular it must not override a transition to the resolve stub.
+    if (InterlockedCompareExchangeT(pCallSite->GetIndirectCell(), stub, prior) == prior)
+    {
+        stats.site_write_mono++;
+        stats.site_write++;
+    }
+
+    LOG((LF_STUBS, LL_INFO10000, "ExtendPolymorphicSite call-site" FMT_ADDR "size %d dispatchStub" FMT_ADDR "\n",
+         DBG_ADDR(pCallSite->GetReturnAddress()), siteSize + 1, DBG_ADDR(pDispatchHolder->stub())));
+}
+
 //----------------------------------------------------------------------------
 void StubCallSite::SetSiteTarget(PCODE newTarget)
 {
@@ -2796,6 +2886,7 @@ DispatchHolder *VirtualCallStubManager::GenerateDispatchStub(PCODE            ad
 
     //incr our counters
     stats.stub_mono_counter++;
+    RuntimeCounters::Increment(RuntimeCounter_DispatchStubs);
     stats.stub_space += (UINT32)dispatchHolderSize;
     LOG((LF_STUBS, LL_INFO10000, "GenerateDispatchStub for token" FMT_ADDR "and pMT" FMT_ADDR "at" FMT_ADDR "\n",
                                  DBG_ADDR(dispatchToken), DBG_ADDR(pMTExpected), DBG_ADDR(holder->stub())));
@@ -2858,6 +2949,7 @@ DispatchHolder *VirtualCallStubManager::GenerateDispatchStubLong(PCODE
 
     //incr our counters
     stats.stub_mono_counter++;
+    RuntimeCounters::Increment(RuntimeCounter_DispatchStubs);
     stats.stub_space += static_cast<UINT32>(DispatchHolder::GetHolderSize(DispatchStub::e_TYPE_LONG));
     LOG((LF_STUBS, LL_INFO10000, "GenerateDispatchStub for token" FMT_ADDR "and pMT" FMT_ADDR "at" FMT_ADDR "\n",
                                  DBG_ADDR(dispatchToken), DBG_ADDR(pMTExpected), DBG_ADDR(holder->stub())));
@@ -2956,6 +3048,7 @@ ResolveHolder *VirtualCallStubManager::GenerateResolveStub(PCODE            addr
 
     //incr our counters
     stats.stub_poly_counter++;
+    RuntimeCounters::Increment(RuntimeCounter_ResolveStubs);
     stats.stub_space += sizeof(ResolveHolder)+sizeof(size_t);
     LOG((LF_STUBS, LL_INFO10000, "GenerateResolveStub  for token" FMT_ADDR "at" FMT_ADDR "\n",
                                  DBG_ADDR(dispatchToken), DBG_ADDR(holder->stub())));
@@ -2994,6 +3087,7 @@ LookupHolder *VirtualCallStubManager::GenerateLookupStub(PCODE addrOfResolver, s
 
     //incr our counters
     stats.stub_lookup_counter++;
+    RuntimeCounters::Increment(RuntimeCounter_LookupStubs);
     stats.stub_space += sizeof(LookupHolder);
     LOG((LF_STUBS, LL_INFO10000, "GenerateLookupStub   for token" FMT_ADDR "at" FMT_ADDR "\n",
                                  DBG_ADDR(dispatchToken), DBG_ADDR(holder->stub())));
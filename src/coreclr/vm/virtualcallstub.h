@@ -36,6 +36,7 @@ class VirtualCallStubManager;
 class VirtualCallStubManagerManager;
 struct LookupHolder;
 struct DispatchHolder;
+struct DispatchStub;
 struct ResolveHolder;
 struct VTableCallHolder;
 
@@ -207,6 +208,10 @@ typedef VPTR(class VirtualCallStubManager) PTR_VirtualCallStubManager;
 //     * On first call they get updated into a dispatch stub. When this misses, it calls a resolve stub,
 //         which populates a resovle stub's cache, but does not update the call site' cell (thus it is still
 //         pointing at the dispatch cell.
+//     * When the dispatch stub misses on a new type and the resolve cache does not have it yet, another
+//         dispatch stub for that type whose failure target is the current one is put in front of it, up
+//         to code:g_polymorphicSiteSize types per call site (see
+//         code:VirtualCallStubManager.ExtendPolymorphicSite). These chained stubs are not shared.
 //     * After code:STUB_MISS_COUNT_VALUE misses, we update the call site's cell to point directly at the
 //         resolve stub (thus avoiding the overhead of the quick check that always seems to be failing and
 //         the miss count update).
@@ -617,6 +622,12 @@ public:
     //Change the callsite to point to stub
     void BackPatchSite(StubCallSite* pCallSite, PCODE stub);
 
+    //Put a dispatch stub for objectType in front of the dispatch stub(s) the callsite points to
+    void ExtendPolymorphicSite(StubCallSite* pCallSite, PCODE target, MethodTable* objectType, size_t dispatchToken);
+
+    //Find the fail entry of the resolve stub that terminates the chain starting at pStub
+    static PCODE GetResolveFailEntry(DispatchStub* pStub);
+
 public:
     /* the following two public functions are to support tracing or stepping thru
     stubs via the debugger. */
@@ -1014,6 +1025,8 @@ extern UINT32 STUB_COLLIDE_MONO_PCT;
 #define STUB_COLLIDE_MONO_PCT     0
 #endif // !STUB_LOGGING
 
+extern UINT32 g_polymorphicSiteSize;
+
 //size and mask of the cache used by resolve stubs
 // CALL_STUB_CACHE_SIZE must be equal to 2^CALL_STUB_CACHE_NUM_BITS
 #define CALL_STUB_CACHE_NUM_BITS 12 //10
@@ -1276,7 +1289,7 @@ public:
         WRAPPER_NO_CONTRACT;
         if (stub)
         {
-            ResolveHolder * resolveHolder = ResolveHolder::FromFailEntry(stub->failTarget());
+            ResolveHolder * resolveHolder = ResolveHolder::FromFailEntry(VirtualCallStubManager::GetResolveFailEntry(stub));
             size_t token = resolveHolder->stub()->token();
             _ASSERTE(token == VirtualCallStubManager::GetTokenFromStub((PCODE)stub));
             return token;
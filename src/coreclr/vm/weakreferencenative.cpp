@@ -413,6 +413,53 @@ FORCEINLINE void ReleaseWeakHandleSpinLock(WEAKREFERENCEREF pThis, OBJECTHANDLE
     pThis->m_Handle = newHandle;
 }
 
+//
+// Readers wait for the spinlock to be released without taking it. A reader that took the spinlock would make
+// every other reader of the same weak reference fall back to the spinlock as well.
+//
+
+NOINLINE OBJECTHANDLE WaitForWeakHandleSpinLockRelease(WEAKREFERENCEREF pThis)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+    }
+    CONTRACTL_END;
+
+    DWORD dwSwitchCount = 0;
+    YieldProcessorNormalizationInfo normalizationInfo;
+
+    for (;;)
+    {
+        if (g_SystemInfo.dwNumberOfProcessors > 1)
+        {
+            DWORD spincount = g_SpinConstants.dwInitialDuration;
+
+            for (;;)
+            {
+                YieldProcessorNormalizedForPreSkylakeCount(normalizationInfo, spincount);
+
+                OBJECTHANDLE handle = pThis->m_Handle.LoadWithoutBarrier();
+                if (handle != SPECIAL_HANDLE_SPINLOCK)
+                    return handle;
+
+                spincount *= g_SpinConstants.dwBackoffFactor;
+                if (spincount > g_SpinConstants.dwMaximumDuration)
+                {
+                    break;
+                }
+            }
+        }
+
+        __SwitchToThread(0, ++dwSwitchCount);
+
+        OBJECTHANDLE handle = pThis->m_Handle.LoadWithoutBarrier();
+        if (handle != SPECIAL_HANDLE_SPINLOCK)
+            return handle;
+    }
+}
+
 //************************************************************************
 
 MethodTable *pWeakReferenceMT = NULL;
@@ -630,14 +677,18 @@ static FORCEINLINE OBJECTREF GetWeakReferenceTarget(WEAKREFERENCEREF pThis)
     CONTRACTL_END;
 
     OBJECTHANDLE rawHandle = pThis->m_Handle.LoadWithoutBarrier();
-    OBJECTHANDLE handle = GetHandleValue(rawHandle);
 
-    if (handle == NULL)
-        return NULL;
-
-    // Try a speculative lock-free read first
-    if (rawHandle != SPECIAL_HANDLE_SPINLOCK)
+    for (;;)
     {
+        // The target is only read lock-free. The spinlock is taken by the writers alone.
+        if (rawHandle == SPECIAL_HANDLE_SPINLOCK)
+            rawHandle = WaitForWeakHandleSpinLockRelease(pThis);
+
+        OBJECTHANDLE handle = GetHandleValue(rawHandle);
+
+        if (handle == NULL)
+            return NULL;
+
         //
         // There is a theoretic chance that the speculative lock-free read may AV while reading the value
         // of freed handle if the handle table decides to release the memory that the handle lives in.
@@ -654,23 +705,16 @@ static FORCEINLINE OBJECTREF GetWeakReferenceTarget(WEAKREFERENCEREF pThis)
         // We want to ensure that the handle was still alive when we fetched the target,
         // so we double check m_handle here. Note that the reading of the handle
         // value has to take memory barrier for this to work, but reading of m_handle does not.
+        // If the handle was replaced or finalized in the meantime, retry with the new one.
         //
-        if (rawHandle == pThis->m_Handle.LoadWithoutBarrier())
+        OBJECTHANDLE currentRawHandle = pThis->m_Handle.LoadWithoutBarrier();
+        if (rawHandle == currentRawHandle)
         {
             return OBJECTREF(pSpeculativeTarget);
         }
-    }
 
-
-    rawHandle = AcquireWeakHandleSpinLock(pThis);
-    GCX_NOTRIGGER();
-
-    handle = GetHandleValue(rawHandle);
-    OBJECTREF pTarget = OBJECTREF(*(Object **)(handle));
-
-    ReleaseWeakHandleSpinLock(pThis, rawHandle);
-
-    return pTarget;
+        rawHandle = currentRawHandle;
+    }
 }
 
 FCIMPL1(Object *, WeakReferenceNative::GetTarget, WeakReferenceObject * pThisUNSAFE)
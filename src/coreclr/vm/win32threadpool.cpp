@@ -32,6 +32,7 @@ Revision History:
 #include "nativeoverlapped.h"
 #include "hillclimbing.h"
 #include "configuration.h"
+#include "runtimeprobes.h"
 
 
 #ifndef TARGET_UNIX
@@ -102,6 +103,10 @@ LARGE_INTEGER ThreadpoolMgr::CurrentSampleStartTime;
 unsigned int ThreadpoolMgr::WorkerThreadSpinLimit;
 bool ThreadpoolMgr::IsHillClimbingDisabled;
 int ThreadpoolMgr::ThreadAdjustmentInterval;
+#ifndef TARGET_UNIX
+bool ThreadpoolMgr::AffinitizeWorkersToNumaNodes;
+LONG ThreadpoolMgr::NextWorkerNumaNode;
+#endif // !TARGET_UNIX
 
 #define INVALID_HANDLE ((HANDLE) -1)
 #define NEW_THREAD_THRESHOLD            7       // Number of requests outstanding before we start a new thread
@@ -370,6 +375,9 @@ BOOL ThreadpoolMgr::Initialize()
             WorkerThreadSpinLimit = CLRConfig::GetConfigValue(CLRConfig::INTERNAL_ThreadPool_UnfairSemaphoreSpinLimit);
             IsHillClimbingDisabled = CLRConfig::GetConfigValue(CLRConfig::INTERNAL_HillClimbing_Disable) != 0;
             ThreadAdjustmentInterval = CLRConfig::GetConfigValue(CLRConfig::INTERNAL_HillClimbing_SampleIntervalLow);
+#ifndef TARGET_UNIX
+            AffinitizeWorkersToNumaNodes = CLRConfig::GetConfigValue(CLRConfig::INTERNAL_ThreadPool_AffinitizeWorkersToNumaNodes) != 0;
+#endif // !TARGET_UNIX
 
             WaitThreadsCriticalSection.Init(CrstThreadpoolWaitThreads);
         }
@@ -1498,6 +1506,8 @@ void ThreadpoolMgr::ExecuteWorkRequest(bool* foundWork, bool* wasNotRecalled)
         _ASSERTE(pAdCount);
     }
 
+    RUNTIME_PROBE1(threadpool_dispatch, index);
+
     pAdCount->DispatchWorkItem(foundWork, wasNotRecalled);
 }
 
@@ -1795,6 +1805,57 @@ BOOL ThreadpoolMgr::CreateWorkerThread()
     return FALSE;
 }
 
+#ifndef TARGET_UNIX
+//
+// Restrict a new worker thread to the processors of a single NUMA node, distributing workers round-robin
+// across the nodes. Together with the per-processor request counts this keeps a worker's requests, and the
+// memory its work items touch, local to the node. Only nodes within the processor group the thread was
+// already assigned to are considered, so that the CPU group bookkeeping in Thread stays accurate.
+//
+void ThreadpoolMgr::AffinitizeWorkerThreadToNumaNode(Thread* pThread)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+    }
+    CONTRACTL_END;
+
+    _ASSERTE(!UsePortableThreadPool());
+
+    ULONG highestNode = 0;
+    if (!GetNumaHighestNodeNumber(&highestNode) || highestNode == 0)
+        return;
+
+    HANDLE hThread = pThread->GetThreadHandle();
+    if (hThread == INVALID_HANDLE_VALUE)
+        return;
+
+    GROUP_AFFINITY currentAffinity;
+    if (!CPUGroupInfo::GetThreadGroupAffinity(hThread, &currentAffinity))
+        return;
+
+    ULONG numNodes = highestNode + 1;
+    ULONG startNode = (ULONG)FastInterlockIncrement(&NextWorkerNumaNode);
+    for (ULONG i = 0; i < numNodes; i++)
+    {
+        GROUP_AFFINITY nodeAffinity;
+        if (!GetNumaNodeProcessorMaskEx((USHORT)((startNode + i) % numNodes), &nodeAffinity))
+            continue;
+
+        if (nodeAffinity.Group != currentAffinity.Group)
+            continue;
+
+        nodeAffinity.Mask &= currentAffinity.Mask;
+        if (nodeAffinity.Mask == 0)
+            continue;
+
+        CPUGroupInfo::SetThreadGroupAffinity(hThread, &nodeAffinity, NULL);
+        return;
+    }
+}
+#endif // !TARGET_UNIX
 
 DWORD WINAPI ThreadpoolMgr::WorkerThreadStart(LPVOID lpArgs)
 {
@@ -1846,6 +1907,11 @@ Work:
             // converted to CLRThread and added to ThreadStore, pick an group affinity for this thread
             pThread->ChooseThreadCPUGroupAffinity();
 
+#ifndef TARGET_UNIX
+            if (AffinitizeWorkersToNumaNodes)
+                AffinitizeWorkerThreadToNumaNode(pThread);
+#endif // !TARGET_UNIX
+
             #ifdef FEATURE_COMINTEROP
             if (pThread->SetApartment(Thread::AS_InMTA) != Thread::AS_InMTA)
             {
@@ -983,6 +983,10 @@ private:
                                                );
     static BOOL SufficientDelaySinceLastDequeue();
 
+#ifndef TARGET_UNIX
+    static void AffinitizeWorkerThreadToNumaNode(Thread* pThread);
+#endif // !TARGET_UNIX
+
     static LPVOID   GetRecycledMemory(enum MemType memType);
 
     static DWORD WINAPI TimerThreadStart(LPVOID args);
@@ -1042,6 +1046,10 @@ private:
     static unsigned int WorkerThreadSpinLimit;
     static bool IsHillClimbingDisabled;
     static int ThreadAdjustmentInterval;
+#ifndef TARGET_UNIX
+    static bool AffinitizeWorkersToNumaNodes;
+    static LONG NextWorkerNumaNode;
+#endif // !TARGET_UNIX
 
     SPTR_DECL(WorkRequest,WorkRequestHead);             // Head of work request queue
     SPTR_DECL(WorkRequest,WorkRequestTail);             // Head of work request queue
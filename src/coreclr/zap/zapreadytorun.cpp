@@ -846,6 +846,9 @@ static_assert_no_msg((int)READYTORUN_FIXUP_Check_InstructionSetSupport== (int)EN
 static_assert_no_msg((int)READYTORUN_FIXUP_Verify_FieldOffset         == (int)ENCODE_VERIFY_FIELD_OFFSET);
 static_assert_no_msg((int)READYTORUN_FIXUP_Verify_TypeLayout          == (int)ENCODE_VERIFY_TYPE_LAYOUT);
 
+static_assert_no_msg((int)READYTORUN_FIXUP_Check_IL_Body              == (int)ENCODE_CHECK_IL_BODY);
+static_assert_no_msg((int)READYTORUN_FIXUP_Verify_IL_Body             == (int)ENCODE_VERIFY_IL_BODY);
+
 //
 // READYTORUN_EXCEPTION
 //
@@ -32,6 +32,10 @@ static const Entry s_compressionNative[] =
     DllImportEntry(CompressionNative_Inflate)
     DllImportEntry(CompressionNative_InflateEnd)
     DllImportEntry(CompressionNative_InflateInit2_)
+    DllImportEntry(CompressionNative_ParallelDeflate)
+    DllImportEntry(CompressionNative_ParallelDeflateBound)
+    DllImportEntry(CompressionNative_ParallelDeflateCreate)
+    DllImportEntry(CompressionNative_ParallelDeflateDestroy)
 };
 
 EXTERN_C const void* CompressionResolveDllImport(const char* name);
@@ -131,3 +131,43 @@ updated CRC-32.
 Returns the updated CRC-32.
 */
 FUNCTIONEXPORT uint32_t FUNCTIONCALLINGCONVENCTION CompressionNative_Crc32(uint32_t crc, uint8_t* buffer, int32_t len);
+
+/*
+A deflate encoder that compresses blocks of the input on several threads.
+
+Like pigz, each block is compressed independently, primed with the window of data that
+precedes it, and the compressed blocks are joined with sync flushes, so the output is a
+single regular deflate, zlib or gzip stream.
+*/
+typedef struct PAL_ParallelDeflate PAL_ParallelDeflate;
+
+/*
+Creates a parallel deflate encoder. level, windowBits, memLevel and strategy have the same
+meaning as for DeflateInit2_; blockSize is the number of input bytes compressed by a thread
+at a time, at least 32 KB, and threadCount the maximum number of threads used by a call.
+
+Returns the encoder on success or NULL on failure.
+*/
+FUNCTIONEXPORT PAL_ParallelDeflate* FUNCTIONCALLINGCONVENCTION CompressionNative_ParallelDeflateCreate(
+    int32_t level, int32_t windowBits, int32_t memLevel, int32_t strategy, int32_t blockSize, int32_t threadCount);
+
+/*
+Frees the encoder. No-op if encoder is NULL.
+*/
+FUNCTIONEXPORT void FUNCTIONCALLINGCONVENCTION CompressionNative_ParallelDeflateDestroy(PAL_ParallelDeflate* encoder);
+
+/*
+Returns the output buffer size that is sufficient for a ParallelDeflate call with the given
+input length, including the stream header and trailer.
+*/
+FUNCTIONEXPORT int64_t FUNCTIONCALLINGCONVENCTION CompressionNative_ParallelDeflateBound(PAL_ParallelDeflate* encoder, int64_t inputLength);
+
+/*
+Compresses all of the input into output, which must be at least ParallelDeflateBound bytes.
+flush is PAL_Z_NOFLUSH when more input follows or PAL_Z_FINISH to end the stream.
+
+Returns PAL_Z_OK, PAL_Z_STREAMEND once the stream is finished, or an error code on failure;
+bytesWritten receives the number of bytes stored in output.
+*/
+FUNCTIONEXPORT int32_t FUNCTIONCALLINGCONVENCTION CompressionNative_ParallelDeflate(
+    PAL_ParallelDeflate* encoder, uint8_t* input, int64_t inputLength, uint8_t* output, int64_t outputLength, int64_t* bytesWritten, int32_t flush);
@@ -0,0 +1,464 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+#include "pal_zlib.h"
+
+#ifdef  _WIN32
+    #include "../../Windows/System.IO.Compression.Native/zlib/zlib.h"
+#else
+    #include <pthread.h>
+    #include <zlib.h>
+#endif
+
+#define MIN_BLOCK_SIZE (32 * 1024)
+#define MAX_THREAD_COUNT 64
+#define GZIP_HEADER_SIZE 10
+#define GZIP_TRAILER_SIZE 8
+#define ZLIB_HEADER_SIZE 2
+#define ZLIB_TRAILER_SIZE 4
+
+typedef enum
+{
+    Wrapper_Raw,
+    Wrapper_Zlib,
+    Wrapper_Gzip,
+} DeflateWrapper;
+
+struct PAL_ParallelDeflate
+{
+    int32_t level;
+    int32_t windowBits; // 8..15, the size of the raw deflate window
+    int32_t memLevel;
+    int32_t strategy;
+    int32_t blockSize;
+    int32_t threadCount;
+    DeflateWrapper wrapper;
+
+    int32_t headerWritten;
+    int32_t finished;
+    uint32_t check;  // running crc32 or adler32 of the input
+    uint64_t totalIn;
+
+    // The last (1 << windowBits) bytes of input, used to prime the first block of the next call.
+    int32_t dictionaryLength;
+    uint8_t dictionary[1 << 15];
+};
+
+typedef struct
+{
+    const uint8_t* input;
+    uint32_t inputLength;
+    const uint8_t* dictionary;
+    uint32_t dictionaryLength;
+    uint8_t* output;
+    uint32_t outputCapacity;
+    uint32_t outputLength;
+    uint32_t check;
+    int32_t last;
+    int32_t result;
+} DeflateBlock;
+
+typedef struct
+{
+    const PAL_ParallelDeflate* encoder;
+    DeflateBlock* blocks;
+    int32_t blockCount;
+    int32_t first;
+    int32_t stride;
+} DeflateWorker;
+
+/*
+Upper bound for a raw deflate block of the given length, followed by a sync flush marker.
+This is the conservative bound of deflateBound that holds for any memLevel and windowBits.
+*/
+static uint64_t BlockBound(uint64_t length)
+{
+    return length + ((length + 7) >> 3) + ((length + 63) >> 6) + 5 + 5;
+}
+
+static void CompressBlock(const PAL_ParallelDeflate* encoder, DeflateBlock* block)
+{
+    block->check = encoder->wrapper == Wrapper_Gzip ? (uint32_t)crc32(0, block->input, block->inputLength)
+                 : encoder->wrapper == Wrapper_Zlib ? (uint32_t)adler32(1, block->input, block->inputLength)
+                 : 0;
+
+    z_stream stream;
+    memset(&stream, 0, sizeof(stream));
+    block->result = deflateInit2(&stream, encoder->level, Z_DEFLATED, -encoder->windowBits, encoder->memLevel, encoder->strategy);
+    if (block->result != Z_OK)
+    {
+        return;
+    }
+
+    if (block->dictionaryLength > 0)
+    {
+        block->result = deflateSetDictionary(&stream, block->dictionary, block->dictionaryLength);
+    }
+
+    if (block->result == Z_OK)
+    {
+        // Blocks other than the last one end with a sync flush, which aligns the output to a
+        // byte boundary without marking the deflate block as final, so the next one can follow.
+        stream.next_in = (Bytef*)block->input;
+        stream.avail_in = block->inputLength;
+        stream.next_out = block->output;
+        stream.avail_out = block->outputCapacity;
+
+        int32_t flush = block->last ? Z_FINISH : Z_SYNC_FLUSH;
+        block->result = deflate(&stream, flush);
+        if ((flush == Z_FINISH && block->result == Z_STREAM_END) || (flush == Z_SYNC_FLUSH && block->result == Z_OK && stream.avail_in == 0))
+        {
+            block->result = Z_OK;
+        }
+        else if (block->result == Z_OK)
+        {
+            // The bound was too small, which can't happen for valid parameters.
+            block->result = Z_BUF_ERROR;
+        }
+
+        block->outputLength = block->outputCapacity - stream.avail_out;
+    }
+
+    deflateEnd(&stream);
+}
+
+#ifdef _WIN32
+static DWORD WINAPI DeflateWorkerThread(LPVOID context)
+#else
+static void* DeflateWorkerThread(void* context)
+#endif
+{
+    DeflateWorker* worker = (DeflateWorker*)context;
+    for (int32_t i = worker->first; i < worker->blockCount; i += worker->stride)
+    {
+        CompressBlock(worker->encoder, &worker->blocks[i]);
+    }
+
+    return 0;
+}
+
+/*
+Compresses all blocks, the calling thread takes its share of the blocks. If a thread can't be
+created, its blocks are compressed by the calling thread after its own.
+*/
+static void CompressBlocks(const PAL_ParallelDeflate* encoder, DeflateBlock* blocks, int32_t blockCount)
+{
+    assert(blockCount > 0);
+    int32_t threadCount = blockCount < encoder->threadCount ? blockCount : encoder->threadCount;
+    if (threadCount < 1)
+    {
+        threadCount = 1;
+    }
+
+    DeflateWorker workers[MAX_THREAD_COUNT];
+#ifdef _WIN32
+    HANDLE threads[MAX_THREAD_COUNT];
+#else
+    pthread_t threads[MAX_THREAD_COUNT];
+#endif
+    int32_t started[MAX_THREAD_COUNT];
+
+    for (int32_t i = 0; i < threadCount; i++)
+    {
+        workers[i].encoder = encoder;
+        workers[i].blocks = blocks;
+        workers[i].blockCount = blockCount;
+        workers[i].first = i;
+        workers[i].stride = threadCount;
+        started[i] = 0;
+
+        if (i > 0)
+        {
+#ifdef _WIN32
+            threads[i] = CreateThread(NULL, 0, DeflateWorkerThread, &workers[i], 0, NULL);
+            started[i] = threads[i] != NULL;
+#else
+            started[i] = pthread_create(&threads[i], NULL, DeflateWorkerThread, &workers[i]) == 0;
+#endif
+        }
+    }
+
+    DeflateWorkerThread(&workers[0]);
+
+    for (int32_t i = 1; i < threadCount; i++)
+    {
+        if (started[i])
+        {
+#ifdef _WIN32
+            WaitForSingleObject(threads[i], INFINITE);
+            CloseHandle(threads[i]);
+#else
+            pthread_join(threads[i], NULL);
+#endif
+        }
+        else
+        {
+            DeflateWorkerThread(&workers[i]);
+        }
+    }
+}
+
+static int32_t WriteHeader(const PAL_ParallelDeflate* encoder, uint8_t* output)
+{
+    if (encoder->wrapper == Wrapper_Gzip)
+    {
+        // No file name, modification time or extra fields; the OS is unknown.
+        static const uint8_t header[GZIP_HEADER_SIZE] = { 0x1f, 0x8b, 0x08, 0, 0, 0, 0, 0, 0, 0xff };
+        memcpy(output, header, sizeof(header));
+        output[8] = encoder->level == 1 ? 4 : encoder->level == 9 ? 2 : 0;
+        return GZIP_HEADER_SIZE;
+    }
+
+    if (encoder->wrapper == Wrapper_Zlib)
+    {
+        uint32_t levelFlags = (encoder->level >= 0 && encoder->level < 2) ? 0 : (encoder->level >= 2 && encoder->level < 6) ? 1 : (encoder->level == 6 || encoder->level < 0) ? 2 : 3;
+        uint32_t header = ((8 + (((uint32_t)encoder->windowBits - 8) << 4)) << 8) | (levelFlags << 6);
+        header += 31 - (header % 31);
+        output[0] = (uint8_t)(header >> 8);
+        output[1] = (uint8_t)header;
+        return ZLIB_HEADER_SIZE;
+    }
+
+    return 0;
+}
+
+static int32_t WriteTrailer(const PAL_ParallelDeflate* encoder, uint8_t* output)
+{
+    if (encoder->wrapper == Wrapper_Gzip)
+    {
+        uint32_t size = (uint32_t)encoder->totalIn;
+        for (int32_t i = 0; i < 4; i++)
+        {
+            output[i] = (uint8_t)(encoder->check >> (8 * i));
+            output[4 + i] = (uint8_t)(size >> (8 * i));
+        }
+        return GZIP_TRAILER_SIZE;
+    }
+
+    if (encoder->wrapper == Wrapper_Zlib)
+    {
+        for (int32_t i = 0; i < 4; i++)
+        {
+            output[i] = (uint8_t)(encoder->check >> (8 * (3 - i)));
+        }
+        return ZLIB_TRAILER_SIZE;
+    }
+
+    return 0;
+}
+
+static void UpdateDictionary(PAL_ParallelDeflate* encoder, const uint8_t* input, uint64_t inputLength)
+{
+    uint32_t windowSize = 1u << encoder->windowBits;
+    if (inputLength >= windowSize)
+    {
+        memcpy(encoder->dictionary, input + inputLength - windowSize, windowSize);
+        encoder->dictionaryLength = (int32_t)windowSize;
+        return;
+    }
+
+    uint32_t keep = windowSize - (uint32_t)inputLength;
+    if ((uint32_t)encoder->dictionaryLength > keep)
+    {
+        memmove(encoder->dictionary, encoder->dictionary + encoder->dictionaryLength - keep, keep);
+        encoder->dictionaryLength = (int32_t)keep;
+    }
+
+    memcpy(encoder->dictionary + encoder->dictionaryLength, input, (size_t)inputLength);
+    encoder->dictionaryLength += (int32_t)inputLength;
+}
+
+PAL_ParallelDeflate* CompressionNative_ParallelDeflateCreate(
+    int32_t level, int32_t windowBits, int32_t memLevel, int32_t strategy, int32_t blockSize, int32_t threadCount)
+{
+    DeflateWrapper wrapper;
+    if (windowBits >= -15 && windowBits <= -8)
+    {
+        wrapper = Wrapper_Raw;
+        windowBits = -windowBits;
+    }
+    else if (windowBits >= 8 && windowBits <= 15)
+    {
+        wrapper = Wrapper_Zlib;
+    }
+    else if (windowBits >= 16 + 8 && windowBits <= 16 + 15)
+    {
+        wrapper = Wrapper_Gzip;
+        windowBits -= 16;
+    }
+    else
+    {
+        return NULL;
+    }
+
+    if (blockSize < MIN_BLOCK_SIZE || threadCount < 1)
+    {
+        return NULL;
+    }
+
+    PAL_ParallelDeflate* encoder = (PAL_ParallelDeflate*)calloc(1, sizeof(PAL_ParallelDeflate));
+    if (encoder == NULL)
+    {
+        return NULL;
+    }
+
+    // zlib doesn't support a 256 byte window for raw deflate and uses 512 bytes for zlib streams.
+    encoder->windowBits = windowBits == 8 ? 9 : windowBits;
+    encoder->level = level;
+    encoder->memLevel = memLevel;
+    encoder->strategy = strategy;
+    encoder->blockSize = blockSize;
+    encoder->threadCount = threadCount < MAX_THREAD_COUNT ? threadCount : MAX_THREAD_COUNT;
+    encoder->wrapper = wrapper;
+    encoder->check = wrapper == Wrapper_Zlib ? 1 : 0;
+    return encoder;
+}
+
+void CompressionNative_ParallelDeflateDestroy(PAL_ParallelDeflate* encoder)
+{
+    free(encoder);
+}
+
+int64_t CompressionNative_ParallelDeflateBound(PAL_ParallelDeflate* encoder, int64_t inputLength)
+{
+    assert(encoder != NULL);
+
+    if (inputLength < 0)
+    {
+        return -1;
+    }
+
+    uint64_t blockCount = ((uint64_t)inputLength + (uint64_t)encoder->blockSize - 1) / (uint64_t)encoder->blockSize;
+    if (blockCount == 0)
+    {
+        blockCount = 1;
+    }
+
+    return (int64_t)(blockCount * BlockBound((uint64_t)encoder->blockSize) + GZIP_HEADER_SIZE + GZIP_TRAILER_SIZE);
+}
+
+int32_t CompressionNative_ParallelDeflate(
+    PAL_ParallelDeflate* encoder, uint8_t* input, int64_t inputLength, uint8_t* output, int64_t outputLength, int64_t* bytesWritten, int32_t flush)
+{
+    assert(encoder != NULL);
+    assert(input != NULL || inputLength == 0);
+    assert(output != NULL);
+    assert(bytesWritten != NULL);
+
+    *bytesWritten = 0;
+
+    if (encoder->finished || inputLength < 0 || (flush != PAL_Z_NOFLUSH && flush != PAL_Z_FINISH))
+    {
+        return PAL_Z_STREAMERROR;
+    }
+
+    if (outputLength < CompressionNative_ParallelDeflateBound(encoder, inputLength))
+    {
+        return PAL_Z_BUFERROR;
+    }
+
+    int32_t finish = flush == PAL_Z_FINISH;
+    if (inputLength == 0 && !finish)
+    {
+        return PAL_Z_OK;
+    }
+
+    int64_t blockCount = (inputLength + encoder->blockSize - 1) / encoder->blockSize;
+    if (blockCount == 0)
+    {
+        // An empty final block still has to be written to end the stream.
+        blockCount = 1;
+    }
+
+    DeflateBlock* blocks = (DeflateBlock*)calloc((size_t)blockCount, sizeof(DeflateBlock));
+    if (blocks == NULL)
+    {
+        return PAL_Z_MEMERROR;
+    }
+
+    int64_t written = 0;
+    if (!encoder->headerWritten)
+    {
+        written = WriteHeader(encoder, output);
+    }
+
+    uint32_t windowSize = 1u << encoder->windowBits;
+    uint64_t blockBound = BlockBound((uint64_t)encoder->blockSize);
+    for (int64_t i = 0; i < blockCount; i++)
+    {
+        DeflateBlock* block = &blocks[i];
+        int64_t offset = i * encoder->blockSize;
+        int64_t remaining = inputLength - offset;
+
+        block->input = input + offset;
+        block->inputLength = (uint32_t)(remaining < encoder->blockSize ? remaining : encoder->blockSize);
+        if (i == 0)
+        {
+            block->dictionary = encoder->dictionary;
+            block->dictionaryLength = (uint32_t)encoder->dictionaryLength;
+        }
+        else
+        {
+            // Blocks are at least as large as the window, so the whole window is in the input.
+            block->dictionary = block->input - windowSize;
+            block->dictionaryLength = windowSize;
+        }
+
+        // Every block is compressed into its own slot of the output and moved into place afterwards.
+        block->output = output + written + (uint64_t)i * blockBound;
+        block->outputCapacity = (uint32_t)blockBound;
+        block->last = finish && i == blockCount - 1;
+    }
+
+    CompressBlocks(encoder, blocks, (int32_t)blockCount);
+
+    int32_t result = PAL_Z_OK;
+    for (int64_t i = 0; i < blockCount; i++)
+    {
+        DeflateBlock* block = &blocks[i];
+        if (block->result != Z_OK)
+        {
+            result = block->result;
+            break;
+        }
+
+        // Slots only move towards the start of the output, so later slots are never overwritten.
+        memmove(output + written, block->output, block->outputLength);
+        written += block->outputLength;
+
+        if (encoder->wrapper == Wrapper_Gzip)
+        {
+            encoder->check = (uint32_t)crc32_combine(encoder->check, block->check, (z_off_t)block->inputLength);
+        }
+        else if (encoder->wrapper == Wrapper_Zlib)
+        {
+            encoder->check = (uint32_t)adler32_combine(encoder->check, block->check, (z_off_t)block->inputLength);
+        }
+    }
+
+    free(blocks);
+
+    if (result != PAL_Z_OK)
+    {
+        // The stream can't be continued once some of its input has been lost.
+        encoder->finished = 1;
+        return result;
+    }
+
+    encoder->headerWritten = 1;
+    encoder->totalIn += (uint64_t)inputLength;
+    UpdateDictionary(encoder, input, (uint64_t)inputLength);
+
+    if (finish)
+    {
+        written += WriteTrailer(encoder, output + written);
+        encoder->finished = 1;
+        result = PAL_Z_STREAMEND;
+    }
+
+    *bytesWritten = written;
+    return result;
+}
@@ -40,6 +40,9 @@ c_static_assert_msg(USEARCH_DONE == -1, "managed side requires -1 for not found"
 
 #define USED_STRING_SEARCH ((UStringSearch*) (-1))
 
+#define AsciiCollationTableSize 0x80
+#define NO_ASCII_COLLATION_TABLE ((AsciiCollationTable*) (-1))
+
 typedef struct { int32_t key; UCollator* UCollator; } TCollatorMap;
 
 typedef struct SearchIteratorNode
@@ -48,6 +51,20 @@ typedef struct SearchIteratorNode
     struct SearchIteratorNode* next;
 } SearchIteratorNode;
 
+/*
+ * The collation weights of the ASCII characters for a collator whose order of
+ * these characters is the one of the root collation (see CreateAsciiCollationTable).
+ * The weights are read from the collator itself, so the same ICU version and
+ * attributes decide the result as for ucol_strcoll. Characters that do not map to
+ * exactly one collation element have a primary weight of 0 and are not covered.
+ */
+typedef struct AsciiCollationTable
+{
+    UCollationStrength strength;
+    uint32_t primaryWeights[AsciiCollationTableSize];
+    uint16_t tertiaryWeights[AsciiCollationTableSize];
+} AsciiCollationTable;
+
 /*
  * For increased performance, we cache the UCollator objects for a locale and
  * share them across threads. This is safe (and supported in ICU) if we ensure
@@ -57,6 +74,7 @@ struct SortHandle
 {
     UCollator* collatorsPerOption[CompareOptionsMask + 1];
     SearchIteratorNode searchIteratorList[CompareOptionsMask + 1];
+    AsciiCollationTable* asciiTablesPerOption[CompareOptionsMask + 1];
 };
 
 // Hiragana character range
@@ -390,6 +408,232 @@ static int CanIgnoreAllCollationElements(const UCollator* pColl, const UChar* lp
     return U_SUCCESS(err) ? result : false;
 }
 
+// Returns TRUE if the character maps to exactly one collation element that is not ignorable
+static int HasSingleCollationElement(const UCollator* pColl, UChar character)
+{
+    int32_t count = 0;
+    int32_t firstCollElem = UCOL_IGNORABLE;
+    UErrorCode err = U_ZERO_ERROR;
+    UCollationElements* pCollElem = ucol_openElements(pColl, &character, 1, &err);
+
+    if (U_SUCCESS(err))
+    {
+        int32_t curCollElem = UCOL_NULLORDER;
+        while ((curCollElem = ucol_next(pCollElem, &err)) != UCOL_NULLORDER)
+        {
+            if (count++ == 0)
+            {
+                firstCollElem = curCollElem;
+            }
+        }
+
+        ucol_closeElements(pCollElem);
+    }
+
+    return U_SUCCESS(err) && count == 1 && (firstCollElem & UCOL_PRIMARYORDERMASK) != 0;
+}
+
+/*
+ * Builds the table CompareString uses to compare ASCII strings without calling into ICU.
+ *
+ * This is only done when the locale has no tailoring of its own (the collation rules
+ * are empty, like for the invariant culture and most of the locales using the root
+ * collation), so no contraction or prefix rule can apply to ASCII characters, and when
+ * the attributes keep the comparison a plain level by level comparison of the weights.
+ * The weights come from the sort key of each character, so they include any reordering
+ * the locale asks for.
+ */
+static AsciiCollationTable* CreateAsciiCollationTable(const UCollator* pBaseCollator, const UCollator* pCollator)
+{
+    UErrorCode err = U_ZERO_ERROR;
+    int32_t rulesLength = 0;
+    ucol_getRules(pBaseCollator, &rulesLength);
+    UCollationStrength strength = ucol_getStrength(pCollator);
+
+    if (rulesLength != 0 ||
+        strength > UCOL_TERTIARY ||
+        ucol_getAttribute(pCollator, UCOL_ALTERNATE_HANDLING, &err) != UCOL_NON_IGNORABLE ||
+        ucol_getAttribute(pCollator, UCOL_CASE_FIRST, &err) != UCOL_OFF ||
+        ucol_getAttribute(pCollator, UCOL_CASE_LEVEL, &err) != UCOL_OFF ||
+        ucol_getAttribute(pCollator, UCOL_NUMERIC_COLLATION, &err) != UCOL_OFF ||
+        U_FAILURE(err))
+    {
+        return NO_ASCII_COLLATION_TABLE;
+    }
+
+    AsciiCollationTable* pTable = (AsciiCollationTable*)calloc(1, sizeof(AsciiCollationTable));
+    if (pTable == NULL)
+    {
+        return NO_ASCII_COLLATION_TABLE;
+    }
+
+    pTable->strength = strength;
+
+    // The comparison skips the secondary level, so all the covered characters
+    // need the same secondary weight.
+    uint32_t commonSecondaryWeight = 0;
+    int32_t coveredCount = 0;
+
+    for (UChar character = 0; character < AsciiCollationTableSize; character++)
+    {
+        if (!HasSingleCollationElement(pCollator, character))
+        {
+            continue;
+        }
+
+        // The sort key holds the weights of each level separated by 0x01 and ends with 0x00,
+        // neither byte is used inside of a weight.
+        uint8_t sortKey[16];
+        int32_t sortKeyLength = ucol_getSortKey(pCollator, &character, 1, sortKey, (int32_t)sizeof(sortKey));
+        if (sortKeyLength <= 0 || sortKeyLength > (int32_t)sizeof(sortKey))
+        {
+            continue;
+        }
+
+        uint32_t weights[UCOL_TERTIARY + 1] = { 0 };
+        int32_t weightLengths[UCOL_TERTIARY + 1] = { 0 };
+        int32_t level = 0;
+        int32_t isValid = true;
+
+        for (int32_t i = 0; i < sortKeyLength && sortKey[i] != 0; i++)
+        {
+            if (sortKey[i] == 1)
+            {
+                level++;
+            }
+            else if (level > UCOL_TERTIARY || weightLengths[level] == 4)
+            {
+                isValid = false;
+                break;
+            }
+            else
+            {
+                weights[level] |= (uint32_t)sortKey[i] << (24 - 8 * weightLengths[level]);
+                weightLengths[level]++;
+            }
+        }
+
+        if (!isValid || weights[UCOL_PRIMARY] == 0 || weightLengths[UCOL_TERTIARY] > 2)
+        {
+            continue;
+        }
+
+        if (coveredCount == 0)
+        {
+            commonSecondaryWeight = weights[UCOL_SECONDARY];
+        }
+        else if (weights[UCOL_SECONDARY] != commonSecondaryWeight)
+        {
+            continue;
+        }
+
+        pTable->primaryWeights[character] = weights[UCOL_PRIMARY];
+        pTable->tertiaryWeights[character] = (uint16_t)(weights[UCOL_TERTIARY] >> 16);
+        coveredCount++;
+    }
+
+    if (coveredCount == 0)
+    {
+        free(pTable);
+        return NO_ASCII_COLLATION_TABLE;
+    }
+
+    return pTable;
+}
+
+static int IsCoveredByAsciiTable(const AsciiCollationTable* pTable, const UChar* lpStr, int32_t length)
+{
+    for (int32_t i = 0; i < length; i++)
+    {
+        UChar character = lpStr[i];
+        if (character >= AsciiCollationTableSize || pTable->primaryWeights[character] == 0)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/*
+ * Compares the strings with the weights of the table when it covers all of their characters.
+ * Every covered character has a single collation element with a primary weight, so the
+ * strings are ordered by the first different primary weight, then by their length and
+ * then by the first different tertiary weight. Returns FALSE when ICU has to compare them.
+ */
+static int TryCompareAsciiStrings(
+    const AsciiCollationTable* pTable, const UChar* lpStr1, int32_t cwStr1Length, const UChar* lpStr2, int32_t cwStr2Length, UCollationResult* pResult)
+{
+    int32_t minLength = cwStr1Length < cwStr2Length ? cwStr1Length : cwStr2Length;
+    UCollationResult primaryResult = UCOL_EQUAL;
+    UCollationResult tertiaryResult = UCOL_EQUAL;
+    int32_t i = 0;
+
+    for (; i < minLength; i++)
+    {
+        UChar char1 = lpStr1[i];
+        UChar char2 = lpStr2[i];
+        if ((char1 | char2) >= AsciiCollationTableSize)
+        {
+            return false;
+        }
+
+        if (char1 == char2)
+        {
+            if (pTable->primaryWeights[char1] == 0)
+            {
+                return false;
+            }
+            continue;
+        }
+
+        uint32_t primary1 = pTable->primaryWeights[char1];
+        uint32_t primary2 = pTable->primaryWeights[char2];
+        if (primary1 == 0 || primary2 == 0)
+        {
+            return false;
+        }
+
+        if (primary1 != primary2)
+        {
+            primaryResult = primary1 < primary2 ? UCOL_LESS : UCOL_GREATER;
+            i++;
+            break;
+        }
+
+        if (tertiaryResult == UCOL_EQUAL && pTable->strength == UCOL_TERTIARY)
+        {
+            uint16_t tertiary1 = pTable->tertiaryWeights[char1];
+            uint16_t tertiary2 = pTable->tertiaryWeights[char2];
+            if (tertiary1 != tertiary2)
+            {
+                tertiaryResult = tertiary1 < tertiary2 ? UCOL_LESS : UCOL_GREATER;
+            }
+        }
+    }
+
+    // The rest of the strings does not change the result, but it has to be covered as well.
+    if (!IsCoveredByAsciiTable(pTable, lpStr1 + i, cwStr1Length - i) || !IsCoveredByAsciiTable(pTable, lpStr2 + i, cwStr2Length - i))
+    {
+        return false;
+    }
+
+    if (primaryResult != UCOL_EQUAL)
+    {
+        *pResult = primaryResult;
+    }
+    else if (cwStr1Length != cwStr2Length)
+    {
+        *pResult = cwStr1Length < cwStr2Length ? UCOL_LESS : UCOL_GREATER;
+    }
+    else
+    {
+        *pResult = tertiaryResult;
+    }
+
+    return true;
+}
+
 static void CreateSortHandle(SortHandle** ppSortHandle)
 {
     *ppSortHandle = (SortHandle*)malloc(sizeof(SortHandle));
@@ -456,6 +700,15 @@ void GlobalizationNative_CloseSortHandle(SortHandle* pSortHandle)
             ucol_close(pSortHandle->collatorsPerOption[i]);
             pSortHandle->collatorsPerOption[i] = NULL;
         }
+
+        if (pSortHandle->asciiTablesPerOption[i] != NULL)
+        {
+            if (pSortHandle->asciiTablesPerOption[i] != NO_ASCII_COLLATION_TABLE)
+            {
+                free(pSortHandle->asciiTablesPerOption[i]);
+            }
+            pSortHandle->asciiTablesPerOption[i] = NULL;
+        }
     }
 
     free(pSortHandle);
@@ -490,6 +743,31 @@ static const UCollator* GetCollatorFromSortHandle(SortHandle* pSortHandle, int32
     }
 }
 
+// Returns the ASCII table for the options or NULL when CompareString can't use one for them.
+static const AsciiCollationTable* GetAsciiTableFromSortHandle(SortHandle* pSortHandle, const UCollator* pCollator, int32_t options)
+{
+    options &= CompareOptionsMask;
+    AsciiCollationTable* pTable = pSortHandle->asciiTablesPerOption[options];
+
+    if (pTable == NULL)
+    {
+        pTable = CreateAsciiCollationTable(pSortHandle->collatorsPerOption[0], pCollator);
+        AsciiCollationTable* pNull = NULL;
+
+        if (!pal_atomic_cas_ptr((void* volatile*)&pSortHandle->asciiTablesPerOption[options], pTable, pNull))
+        {
+            if (pTable != NO_ASCII_COLLATION_TABLE)
+            {
+                free(pTable);
+            }
+            pTable = pSortHandle->asciiTablesPerOption[options];
+            assert(pTable != NULL && "pTable not expected to be null here.");
+        }
+    }
+
+    return pTable != NO_ASCII_COLLATION_TABLE ? pTable : NULL;
+}
+
 // CreateNewSearchNode will create a new node in the linked list and mark this node search handle as borrowed handle.
 static inline int32_t CreateNewSearchNode(SortHandle* pSortHandle, int32_t options)
 {
@@ -690,6 +968,19 @@ int32_t GlobalizationNative_CompareString(
 
     if (U_SUCCESS(err))
     {
+        // Equal strings are equal for every collator.
+        if (cwStr1Length == cwStr2Length &&
+            (cwStr1Length == 0 || lpStr1 == lpStr2 || memcmp(lpStr1, lpStr2, (size_t)cwStr1Length * sizeof(UChar)) == 0))
+        {
+            return UCOL_EQUAL;
+        }
+
+        const AsciiCollationTable* pTable = GetAsciiTableFromSortHandle(pSortHandle, pColl, options);
+        if (pTable != NULL && TryCompareAsciiStrings(pTable, lpStr1, cwStr1Length, lpStr2, cwStr2Length, &result))
+        {
+            return result;
+        }
+
         // Workaround for https://unicode-org.atlassian.net/projects/ICU/issues/ICU-9396
         // The ucol_strcoll routine on some older versions of ICU doesn't correctly
         // handle nullptr inputs. We'll play defensively and always flow a non-nullptr.
@@ -1116,3 +1407,41 @@ int32_t GlobalizationNative_GetSortKey(
 
     return result;
 }
+
+int32_t GlobalizationNative_GetSortKeys(
+                        SortHandle* pSortHandle,
+                        const UChar** lpStrs,
+                        const int32_t* cwStrLengths,
+                        int32_t count,
+                        uint8_t* sortKeys,
+                        int32_t cbSortKeysLength,
+                        int32_t* pcbSortKeyLengths,
+                        int32_t options)
+{
+    UErrorCode err = U_ZERO_ERROR;
+    const UCollator* pColl = GetCollatorFromSortHandle(pSortHandle, options, &err);
+    int32_t result = 0;
+
+    if (U_FAILURE(err))
+    {
+        return 0;
+    }
+
+    for (int32_t i = 0; i < count; i++)
+    {
+        // Once the buffer is full the remaining keys are only measured.
+        int32_t cbRemaining = cbSortKeysLength - result;
+        uint8_t* sortKey = cbRemaining > 0 ? sortKeys + result : NULL;
+
+        int32_t cbSortKeyLength = ucol_getSortKey(pColl, lpStrs[i], cwStrLengths[i], sortKey, cbRemaining > 0 ? cbRemaining : 0);
+        if (cbSortKeyLength <= 0 || cbSortKeyLength > INT32_MAX - result)
+        {
+            return 0;
+        }
+
+        pcbSortKeyLengths[i] = cbSortKeyLength;
+        result += cbSortKeyLength;
+    }
+
+    return result;
+}
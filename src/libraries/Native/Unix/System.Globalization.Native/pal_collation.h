@@ -61,3 +61,16 @@ PALEXPORT int32_t GlobalizationNative_GetSortKey(SortHandle* pSortHandle,
                                                  uint8_t* sortKey,
                                                  int32_t cbSortKeyLength,
                                                  int32_t options);
+
+// Computes the sort keys of count strings with one call. The keys are stored one after
+// the other in sortKeys and the length of each key is returned in pcbSortKeyLengths.
+// Returns the number of bytes all the keys need, when that is more than cbSortKeysLength
+// the content of sortKeys is undefined.
+PALEXPORT int32_t GlobalizationNative_GetSortKeys(SortHandle* pSortHandle,
+                                                  const UChar** lpStrs,
+                                                  const int32_t* cwStrLengths,
+                                                  int32_t count,
+                                                  uint8_t* sortKeys,
+                                                  int32_t cbSortKeysLength,
+                                                  int32_t* pcbSortKeyLengths,
+                                                  int32_t options);
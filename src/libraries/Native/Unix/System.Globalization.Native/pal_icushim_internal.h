@@ -87,6 +87,7 @@ U_CAPI int32_t U_EXPORT2 ucal_getWindowsTimeZoneID(const UChar* id, int32_t len,
     PER_FUNCTION_BLOCK(ucal_setMillis, libicui18n, true) \
     PER_FUNCTION_BLOCK(ucol_close, libicui18n, true) \
     PER_FUNCTION_BLOCK(ucol_closeElements, libicui18n, true) \
+    PER_FUNCTION_BLOCK(ucol_getAttribute, libicui18n, true) \
     PER_FUNCTION_BLOCK(ucol_getOffset, libicui18n, true) \
     PER_FUNCTION_BLOCK(ucol_getRules, libicui18n, true) \
     PER_FUNCTION_BLOCK(ucol_getSortKey, libicui18n, true) \
@@ -232,6 +233,7 @@ FOR_ALL_ICU_FUNCTIONS
 #define ucal_setMillis(...) ucal_setMillis_ptr(__VA_ARGS__)
 #define ucol_close(...) ucol_close_ptr(__VA_ARGS__)
 #define ucol_closeElements(...) ucol_closeElements_ptr(__VA_ARGS__)
+#define ucol_getAttribute(...) ucol_getAttribute_ptr(__VA_ARGS__)
 #define ucol_getOffset(...) ucol_getOffset_ptr(__VA_ARGS__)
 #define ucol_getRules(...) ucol_getRules_ptr(__VA_ARGS__)
 #define ucol_getSortKey(...) ucol_getSortKey_ptr(__VA_ARGS__)
@@ -458,6 +458,7 @@ void ucal_set(UCalendar * cal, UCalendarDateFields field, int32_t value);
 void ucal_setMillis(UCalendar * cal, UDate dateTime, UErrorCode * status);	
 void ucol_close(UCollator * coll);
 void ucol_closeElements(UCollationElements * elems);
+UColAttributeValue ucol_getAttribute(const UCollator * coll, UColAttribute attr, UErrorCode * status);
 int32_t ucol_getOffset(const UCollationElements *elems);
 const UChar * ucol_getRules(const UCollator * coll, int32_t * length);
 int32_t ucol_getSortKey(const UCollator * coll, const UChar * source, int32_t sourceLength, uint8_t * result, int32_t resultLength);
@@ -14,6 +14,12 @@
 
 #if defined(TARGET_UNIX)
 #include <strings.h>
+#if !defined(__EMSCRIPTEN__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 #elif defined(TARGET_WINDOWS)
 #define strcasecmp _stricmp
 #define strncasecmp _strnicmp
@@ -98,21 +104,20 @@ static int32_t load_icu_data(void* pData)
     }
 }
 
-int32_t GlobalizationNative_LoadICUData(const char* path)
+static char* read_icu_data(const char* path)
 {
-    int32_t ret = -1;
     char* icu_data;
 
     FILE *fp = fopen(path, "rb");
     if (fp == NULL) {
         log_shim_error("Unable to load ICU dat file '%s'.", path);
-        return ret;
+        return NULL;
     }
 
     if (fseek(fp, 0L, SEEK_END) != 0) {
         fclose(fp);
         log_shim_error("Unable to determine size of the dat file");
-        return ret;
+        return NULL;
     }
 
     long bufsize = ftell(fp);
@@ -120,7 +125,7 @@ int32_t GlobalizationNative_LoadICUData(const char* path)
     if (bufsize == -1) {
         fclose(fp);
         log_shim_error("Unable to determine size of the ICU dat file.");
-        return ret;
+        return NULL;
     }
 
     icu_data = malloc(sizeof(char) * (bufsize + 1));
@@ -128,23 +133,80 @@ int32_t GlobalizationNative_LoadICUData(const char* path)
     if (icu_data == NULL) {
         fclose(fp);
         log_shim_error("Unable to allocate enough to read the ICU dat file");
-        return ret;
+        return NULL;
     }
 
     if (fseek(fp, 0L, SEEK_SET) != 0) {
         fclose(fp);
+        free(icu_data);
         log_shim_error("Unable to seek ICU dat file.");
-        return ret;
+        return NULL;
     }
 
     fread(icu_data, sizeof(char), bufsize, fp);
     if (ferror( fp ) != 0 ) {
         fclose(fp);
+        free(icu_data);
         log_shim_error("Unable to read ICU dat file");
-        return ret;
+        return NULL;
     }
 
     fclose(fp);
+    return icu_data;
+}
+
+#if defined(TARGET_UNIX) && !defined(__EMSCRIPTEN__)
+
+// The dat file is mapped rather than read, so only the pages of the items ICU looks up
+// (the cultures and services the app actually uses) are ever loaded. ICU keeps using
+// the data until the process exits, so the mapping is never released.
+// Returns NULL when the file can't be mapped, the caller then reads it.
+static char* map_icu_data(const char* path)
+{
+    int fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd == -1) {
+        return NULL;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size <= 0) {
+        close(fd);
+        return NULL;
+    }
+
+    void* icu_data = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+
+    if (icu_data == MAP_FAILED) {
+        return NULL;
+    }
+
+#if defined(MADV_RANDOM)
+    // The items are looked up through the table of contents at the start of the file,
+    // reading ahead around them would only load data of cultures that are not used.
+    madvise(icu_data, (size_t)st.st_size, MADV_RANDOM);
+#endif
+
+    return (char*)icu_data;
+}
+
+#endif
+
+int32_t GlobalizationNative_LoadICUData(const char* path)
+{
+    int32_t ret = -1;
+    char* icu_data = NULL;
+
+#if defined(TARGET_UNIX) && !defined(__EMSCRIPTEN__)
+    icu_data = map_icu_data(path);
+#endif
+
+    if (icu_data == NULL) {
+        icu_data = read_icu_data(path);
+        if (icu_data == NULL) {
+            return ret;
+        }
+    }
 
     if (load_icu_data(icu_data) == 0) {
         log_shim_error("ICU BAD EXIT %d.", ret);
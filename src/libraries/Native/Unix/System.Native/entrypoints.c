@@ -62,6 +62,8 @@ static const Entry s_sysNative[] =
     DllImportEntry(SystemNative_ShmUnlink)
     DllImportEntry(SystemNative_GetReadDirRBufferSize)
     DllImportEntry(SystemNative_ReadDirR)
+    DllImportEntry(SystemNative_ReadDirBatch)
+    DllImportEntry(SystemNative_LStatBatch)
     DllImportEntry(SystemNative_OpenDir)
     DllImportEntry(SystemNative_CloseDir)
     DllImportEntry(SystemNative_Pipe)
@@ -85,6 +87,7 @@ static const Entry s_sysNative[] =
     DllImportEntry(SystemNative_MMap)
     DllImportEntry(SystemNative_MUnmap)
     DllImportEntry(SystemNative_MAdvise)
+    DllImportEntry(SystemNative_MBind)
     DllImportEntry(SystemNative_MSync)
     DllImportEntry(SystemNative_SysConf)
     DllImportEntry(SystemNative_FTruncate)
@@ -96,6 +99,13 @@ static const Entry s_sysNative[] =
     DllImportEntry(SystemNative_RmDir)
     DllImportEntry(SystemNative_Sync)
     DllImportEntry(SystemNative_Write)
+    DllImportEntry(SystemNative_PRead)
+    DllImportEntry(SystemNative_PWrite)
+    DllImportEntry(SystemNative_PReadV)
+    DllImportEntry(SystemNative_PWriteV)
+    DllImportEntry(SystemNative_PReadVNoWait)
+    DllImportEntry(SystemNative_Splice)
+    DllImportEntry(SystemNative_Tee)
     DllImportEntry(SystemNative_CopyFile)
     DllImportEntry(SystemNative_INotifyInit)
     DllImportEntry(SystemNative_INotifyAddWatch)
@@ -145,6 +155,12 @@ static const Entry s_sysNative[] =
     DllImportEntry(SystemNative_ReceiveMessage)
     DllImportEntry(SystemNative_Send)
     DllImportEntry(SystemNative_SendMessage)
+    DllImportEntry(SystemNative_ReceiveMessages)
+    DllImportEntry(SystemNative_SendMessages)
+    DllImportEntry(SystemNative_SetUdpSegmentSize)
+    DllImportEntry(SystemNative_SetUdpReceiveOffload)
+    DllImportEntry(SystemNative_GetUdpSegmentControlMessageSize)
+    DllImportEntry(SystemNative_TryGetUdpReceiveSegmentSize)
     DllImportEntry(SystemNative_Accept)
     DllImportEntry(SystemNative_Bind)
     DllImportEntry(SystemNative_Connect)
@@ -167,6 +183,12 @@ static const Entry s_sysNative[] =
     DllImportEntry(SystemNative_FreeSocketEventBuffer)
     DllImportEntry(SystemNative_TryChangeSocketEventRegistration)
     DllImportEntry(SystemNative_WaitForSocketEvents)
+    DllImportEntry(SystemNative_CreateSocketCompletionRing)
+    DllImportEntry(SystemNative_CloseSocketCompletionRing)
+    DllImportEntry(SystemNative_RegisterSocketCompletionBuffers)
+    DllImportEntry(SystemNative_QueueSocketReceive)
+    DllImportEntry(SystemNative_QueueSocketSend)
+    DllImportEntry(SystemNative_SubmitAndWaitForSocketCompletions)
     DllImportEntry(SystemNative_PlatformSupportsDualModeIPv4PacketInfo)
     DllImportEntry(SystemNative_GetPeerUserName)
     DllImportEntry(SystemNative_GetDomainSocketSizes)
@@ -203,6 +225,7 @@ static const Entry s_sysNative[] =
     DllImportEntry(SystemNative_GetProcessPath)
     DllImportEntry(SystemNative_GetNonCryptographicallySecureRandomBytes)
     DllImportEntry(SystemNative_GetCryptographicallySecureRandomBytes)
+    DllImportEntry(SystemNative_ReseedNonCryptographicallySecureRandom)
     DllImportEntry(SystemNative_GetNodeName)
     DllImportEntry(SystemNative_GetUnixName)
     DllImportEntry(SystemNative_GetUnixRelease)
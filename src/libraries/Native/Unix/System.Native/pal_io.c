@@ -19,6 +19,7 @@
 #include <sys/stat.h>
 #include <sys/time.h>
 #include <sys/types.h>
+#include <sys/uio.h>
 #include <sys/file.h>
 #include <sys/ioctl.h>
 #include <sys/socket.h>
@@ -34,6 +35,13 @@
 #if HAVE_INOTIFY
 #include <sys/inotify.h>
 #endif
+#if HAVE_STATX
+#include <sys/sysmacros.h>
+#endif
+#if HAVE_LINUX_MEMPOLICY_H
+#include <linux/mempolicy.h>
+#include <sys/syscall.h>
+#endif
 
 #ifdef _AIX
 #include <alloca.h>
@@ -54,10 +62,12 @@ extern int     getpeereid(int, uid_t *__restrict__, gid_t *__restrict__);
 #if HAVE_STAT64
 #define stat_ stat64
 #define fstat_ fstat64
+#define fstatat_ fstatat64
 #define lstat_ lstat64
 #else
 #define stat_ stat
 #define fstat_ fstat
+#define fstatat_ fstatat
 #define lstat_ lstat
 #endif
 
@@ -474,6 +484,178 @@ int32_t SystemNative_ReadDirR(DIR* dir, uint8_t* buffer, int32_t bufferSize, Dir
     return 0;
 }
 
+int32_t SystemNative_ReadDirBatch(DIR* dir, uint8_t* buffer, int32_t bufferSize, DirectoryEntry* entries, int32_t entryCount)
+{
+    assert(dir != NULL);
+    assert(buffer != NULL);
+    assert(entries != NULL);
+
+    if (bufferSize < 0 || entryCount <= 0)
+    {
+        errno = EINVAL;
+        return -1;
+    }
+
+#if HAVE_GETDENTS64
+    // The kernel fills the buffer with as many records as fit. The names are used in place, so
+    // the buffer is aligned like the dirent64 records it holds.
+    uint8_t* start = (uint8_t*)(((size_t)buffer + 7) & ~(size_t)7);
+    size_t length = (size_t)(buffer + bufferSize - start);
+    if (start > buffer + bufferSize || length < sizeof(struct dirent64))
+    {
+        errno = EINVAL;
+        return -1;
+    }
+
+    int fd = dirfd(dir);
+    ssize_t bytesRead;
+    while ((bytesRead = getdents64(fd, start, length)) < 0 && errno == EINTR);
+    if (bytesRead <= 0)
+    {
+        return (int32_t)bytesRead;
+    }
+
+    int32_t count = 0;
+    size_t offset = 0;
+    off64_t nextOffset = 0;
+    while (offset < (size_t)bytesRead)
+    {
+        const struct dirent64* record = (const struct dirent64*)(start + offset);
+        if (count == entryCount)
+        {
+            // d_off of the last returned record is the position of the first one that didn't
+            // fit, seek back to it so that the next call returns it.
+            if (lseek64(fd, nextOffset, SEEK_SET) < 0)
+            {
+                return -1;
+            }
+            break;
+        }
+
+        entries[count].Name = record->d_name;
+        entries[count].NameLength = (int32_t)strlen(record->d_name);
+#if defined(TARGET_WASM)
+        entries[count].InodeType = PAL_DT_UNKNOWN;
+#else
+        entries[count].InodeType = (int32_t)record->d_type;
+#endif
+        count++;
+        offset += record->d_reclen;
+        nextOffset = record->d_off;
+    }
+
+    return count;
+#else
+    // Without getdents64 the entries are read one at a time and their names copied into the buffer,
+    // which still saves a transition to managed code per entry.
+    int32_t count = 0;
+    int32_t used = 0;
+    while (count < entryCount)
+    {
+        long position = telldir(dir);
+
+        errno = 0;
+        struct dirent* entry = readdir(dir);
+        if (entry == NULL)
+        {
+            if (errno != 0)
+            {
+                return count > 0 ? count : -1;
+            }
+            break;
+        }
+
+        size_t nameLength = strlen(entry->d_name);
+        if (nameLength + 1 > (size_t)(bufferSize - used))
+        {
+            if (count == 0)
+            {
+                errno = ERANGE;
+                return -1;
+            }
+
+            // Return this entry from the next call.
+            seekdir(dir, position);
+            break;
+        }
+
+        char* name = (char*)buffer + used;
+        memcpy(name, entry->d_name, nameLength + 1);
+        used += (int32_t)nameLength + 1;
+
+        DirectoryEntry* output = &entries[count++];
+        ConvertDirent(entry, output);
+        output->Name = name;
+        output->NameLength = (int32_t)nameLength;
+    }
+
+    return count;
+#endif
+}
+
+int32_t SystemNative_LStatBatch(DIR* dir, const DirectoryEntry* entries, int32_t entryCount, FileStatus* output, int32_t* errors)
+{
+    assert(dir != NULL);
+    assert(entries != NULL);
+    assert(output != NULL);
+    assert(errors != NULL);
+
+    int fd = dirfd(dir);
+    if (fd < 0)
+    {
+        return -1;
+    }
+
+    for (int32_t i = 0; i < entryCount; i++)
+    {
+        int ret;
+#if HAVE_STATX
+        // statx also returns the birth time, which stat doesn't have on Linux.
+        struct statx result;
+        while ((ret = statx(fd, entries[i].Name, AT_SYMLINK_NOFOLLOW | AT_NO_AUTOMOUNT, STATX_BASIC_STATS | STATX_BTIME, &result)) < 0 && errno == EINTR);
+        if (ret == 0)
+        {
+            FileStatus* dst = &output[i];
+            dst->Dev = (int64_t)makedev(result.stx_dev_major, result.stx_dev_minor);
+            dst->Ino = (int64_t)result.stx_ino;
+            dst->Flags = FILESTATUS_FLAGS_NONE;
+            dst->Mode = (int32_t)result.stx_mode;
+            dst->Uid = result.stx_uid;
+            dst->Gid = result.stx_gid;
+            dst->Size = (int64_t)result.stx_size;
+            dst->ATime = result.stx_atime.tv_sec;
+            dst->ATimeNsec = result.stx_atime.tv_nsec;
+            dst->MTime = result.stx_mtime.tv_sec;
+            dst->MTimeNsec = result.stx_mtime.tv_nsec;
+            dst->CTime = result.stx_ctime.tv_sec;
+            dst->CTimeNsec = result.stx_ctime.tv_nsec;
+            if (result.stx_mask & STATX_BTIME)
+            {
+                dst->BirthTime = result.stx_btime.tv_sec;
+                dst->BirthTimeNsec = result.stx_btime.tv_nsec;
+                dst->Flags |= FILESTATUS_FLAGS_HAS_BIRTHTIME;
+            }
+            else
+            {
+                dst->BirthTime = 0;
+                dst->BirthTimeNsec = 0;
+            }
+            dst->UserFlags = 0;
+        }
+#else
+        struct stat_ result;
+        while ((ret = fstatat_(fd, entries[i].Name, &result, AT_SYMLINK_NOFOLLOW)) < 0 && errno == EINTR);
+        if (ret == 0)
+        {
+            ConvertFileStatus(&result, &output[i]);
+        }
+#endif
+        errors[i] = ret == 0 ? Error_SUCCESS : SystemNative_ConvertErrorPlatformToPal(errno);
+    }
+
+    return 0;
+}
+
 DIR* SystemNative_OpenDir(const char* path)
 {
     DIR *result;
@@ -784,7 +966,7 @@ static int32_t ConvertMMapProtection(int32_t protection)
 
 static int32_t ConvertMMapFlags(int32_t flags)
 {
-    if (flags & ~(PAL_MAP_SHARED | PAL_MAP_PRIVATE | PAL_MAP_ANONYMOUS))
+    if (flags & ~(PAL_MAP_SHARED | PAL_MAP_PRIVATE | PAL_MAP_ANONYMOUS | PAL_MAP_POPULATE | PAL_MAP_HUGETLB))
     {
         assert_msg(false, "Unknown MMap flag", (int)flags);
         return -1;
@@ -797,6 +979,14 @@ static int32_t ConvertMMapFlags(int32_t flags)
         ret |= MAP_SHARED;
     if (flags & PAL_MAP_ANONYMOUS)
         ret |= MAP_ANON;
+#ifdef MAP_POPULATE
+    if (flags & PAL_MAP_POPULATE)
+        ret |= MAP_POPULATE;
+#endif
+#ifdef MAP_HUGETLB
+    if (flags & PAL_MAP_HUGETLB)
+        ret |= MAP_HUGETLB;
+#endif
 
     assert(ret != -1);
     return ret;
@@ -835,6 +1025,14 @@ void* SystemNative_MMap(void* address,
         return NULL;
     }
 
+#ifndef MAP_HUGETLB
+    if (flags & PAL_MAP_HUGETLB)
+    {
+        errno = ENOTSUP;
+        return NULL;
+    }
+#endif
+
     protection = ConvertMMapProtection(protection);
     flags = ConvertMMapFlags(flags);
 
@@ -895,6 +1093,18 @@ int32_t SystemNative_MAdvise(void* address, uint64_t length, int32_t advice)
             (void)address, (void)length, (void)advice;
             errno = ENOTSUP;
             return -1;
+#endif
+        case PAL_MADV_WILLNEED:
+            return madvise(address, (size_t)length, MADV_WILLNEED);
+        case PAL_MADV_SEQUENTIAL:
+            return madvise(address, (size_t)length, MADV_SEQUENTIAL);
+        case PAL_MADV_HUGEPAGE:
+#ifdef MADV_HUGEPAGE
+            return madvise(address, (size_t)length, MADV_HUGEPAGE);
+#else
+            (void)address, (void)length, (void)advice;
+            errno = ENOTSUP;
+            return -1;
 #endif
     }
 
@@ -903,6 +1113,35 @@ int32_t SystemNative_MAdvise(void* address, uint64_t length, int32_t advice)
     return -1;
 }
 
+int32_t SystemNative_MBind(void* address, uint64_t length, int32_t numaNode, int32_t strict)
+{
+    if (length > SIZE_MAX)
+    {
+        errno = ERANGE;
+        return -1;
+    }
+
+#if HAVE_LINUX_MEMPOLICY_H && defined(SYS_mbind)
+    const int BitsPerMask = (int)(sizeof(unsigned long) * 8);
+    unsigned long nodeMask[16] = { 0 };
+    if (numaNode < 0 || numaNode >= BitsPerMask * (int)ARRAY_SIZE(nodeMask))
+    {
+        errno = EINVAL;
+        return -1;
+    }
+
+    nodeMask[numaNode / BitsPerMask] = 1UL << (numaNode % BitsPerMask);
+
+    // The kernel expects one more than the number of bits in the mask.
+    unsigned long maxNode = (unsigned long)(BitsPerMask * (int)ARRAY_SIZE(nodeMask)) + 1;
+    return (int32_t)syscall(SYS_mbind, address, (unsigned long)length, strict ? MPOL_BIND : MPOL_PREFERRED, nodeMask, maxNode, MPOL_MF_MOVE);
+#else
+    (void)address, (void)numaNode, (void)strict;
+    errno = ENOTSUP;
+    return -1;
+#endif
+}
+
 int32_t SystemNative_MSync(void* address, uint64_t length, int32_t flags)
 {
     if (length > SIZE_MAX)
@@ -1037,6 +1276,183 @@ int32_t SystemNative_Write(intptr_t fd, const void* buffer, int32_t bufferSize)
     return Common_Write(fd, buffer, bufferSize);
 }
 
+int32_t SystemNative_PRead(intptr_t fd, void* buffer, int32_t bufferSize, int64_t fileOffset)
+{
+    assert(buffer != NULL || bufferSize == 0);
+    assert(bufferSize >= 0);
+
+    ssize_t count;
+    while ((count = pread(ToFileDescriptor(fd), buffer, (uint32_t)bufferSize, (off_t)fileOffset)) < 0 && errno == EINTR);
+
+    assert(count >= -1 && count <= bufferSize);
+    return (int32_t)count;
+}
+
+int32_t SystemNative_PWrite(intptr_t fd, const void* buffer, int32_t bufferSize, int64_t fileOffset)
+{
+    assert(buffer != NULL || bufferSize == 0);
+    assert(bufferSize >= 0);
+
+    ssize_t count;
+    while ((count = pwrite(ToFileDescriptor(fd), buffer, (uint32_t)bufferSize, (off_t)fileOffset)) < 0 && errno == EINTR);
+
+    assert(count >= -1 && count <= bufferSize);
+    return (int32_t)count;
+}
+
+static int GetVectorCount(int32_t vectorCount)
+{
+    // Passing more than IOV_MAX vectors fails with EINVAL, the remaining ones are left for the next call
+    return vectorCount > IOV_MAX ? IOV_MAX : (int)vectorCount;
+}
+
+int64_t SystemNative_PReadV(intptr_t fd, IOVector* vectors, int32_t vectorCount, int64_t fileOffset)
+{
+    assert(vectors != NULL || vectorCount == 0);
+    assert(vectorCount >= 0);
+
+    int fileDescriptor = ToFileDescriptor(fd);
+    int count = GetVectorCount(vectorCount);
+
+#if HAVE_PREADV
+    ssize_t result;
+    while ((result = preadv(fileDescriptor, (struct iovec*)vectors, count, (off_t)fileOffset)) < 0 && errno == EINTR);
+    return (int64_t)result;
+#else
+    int64_t total = 0;
+    for (int i = 0; i < count; i++)
+    {
+        ssize_t result;
+        while ((result = pread(fileDescriptor, vectors[i].Base, vectors[i].Count, (off_t)(fileOffset + total))) < 0 && errno == EINTR);
+        if (result < 0)
+        {
+            return total > 0 ? total : -1;
+        }
+
+        total += result;
+        if ((size_t)result < vectors[i].Count)
+        {
+            break;
+        }
+    }
+    return total;
+#endif
+}
+
+int64_t SystemNative_PWriteV(intptr_t fd, IOVector* vectors, int32_t vectorCount, int64_t fileOffset)
+{
+    assert(vectors != NULL || vectorCount == 0);
+    assert(vectorCount >= 0);
+
+    int fileDescriptor = ToFileDescriptor(fd);
+    int count = GetVectorCount(vectorCount);
+
+#if HAVE_PWRITEV
+    ssize_t result;
+    while ((result = pwritev(fileDescriptor, (struct iovec*)vectors, count, (off_t)fileOffset)) < 0 && errno == EINTR);
+    return (int64_t)result;
+#else
+    int64_t total = 0;
+    for (int i = 0; i < count; i++)
+    {
+        ssize_t result;
+        while ((result = pwrite(fileDescriptor, vectors[i].Base, vectors[i].Count, (off_t)(fileOffset + total))) < 0 && errno == EINTR);
+        if (result < 0)
+        {
+            return total > 0 ? total : -1;
+        }
+
+        total += result;
+        if ((size_t)result < vectors[i].Count)
+        {
+            break;
+        }
+    }
+    return total;
+#endif
+}
+
+int64_t SystemNative_PReadVNoWait(intptr_t fd, IOVector* vectors, int32_t vectorCount, int64_t fileOffset)
+{
+    assert(vectors != NULL || vectorCount == 0);
+    assert(vectorCount >= 0);
+
+#if HAVE_PREADV2 && defined(RWF_NOWAIT)
+    ssize_t result;
+    while ((result = preadv2(ToFileDescriptor(fd), (struct iovec*)vectors, GetVectorCount(vectorCount), (off_t)fileOffset, RWF_NOWAIT)) < 0 && errno == EINTR);
+
+    // Kernels and file systems without RWF_NOWAIT support report EOPNOTSUPP
+    if (result < 0 && errno == EOPNOTSUPP)
+    {
+        errno = ENOTSUP;
+    }
+    return (int64_t)result;
+#else
+    (void)fd;
+    (void)vectors;
+    (void)vectorCount;
+    (void)fileOffset;
+    errno = ENOTSUP;
+    return -1;
+#endif
+}
+
+#if HAVE_SPLICE
+static unsigned int ConvertSpliceFlags(int32_t flags)
+{
+    unsigned int ret = 0;
+    if (flags & PAL_SPLICE_F_MOVE)
+        ret |= SPLICE_F_MOVE;
+    if (flags & PAL_SPLICE_F_NONBLOCK)
+        ret |= SPLICE_F_NONBLOCK;
+    if (flags & PAL_SPLICE_F_MORE)
+        ret |= SPLICE_F_MORE;
+    return ret;
+}
+#endif
+
+int64_t SystemNative_Splice(intptr_t fdIn, intptr_t fdOut, int64_t count, int32_t flags)
+{
+    if (count < 0 || (flags & ~(PAL_SPLICE_F_MOVE | PAL_SPLICE_F_NONBLOCK | PAL_SPLICE_F_MORE)) != 0)
+    {
+        errno = EINVAL;
+        return -1;
+    }
+
+#if HAVE_SPLICE
+    size_t length = (uint64_t)count > SSIZE_MAX ? SSIZE_MAX : (size_t)count;
+    ssize_t result;
+    while ((result = splice(ToFileDescriptor(fdIn), NULL, ToFileDescriptor(fdOut), NULL, length, ConvertSpliceFlags(flags))) < 0 && errno == EINTR);
+    return (int64_t)result;
+#else
+    (void)fdIn;
+    (void)fdOut;
+    errno = ENOTSUP;
+    return -1;
+#endif
+}
+
+int64_t SystemNative_Tee(intptr_t fdIn, intptr_t fdOut, int64_t count, int32_t flags)
+{
+    if (count < 0 || (flags & ~(PAL_SPLICE_F_MOVE | PAL_SPLICE_F_NONBLOCK | PAL_SPLICE_F_MORE)) != 0)
+    {
+        errno = EINVAL;
+        return -1;
+    }
+
+#if HAVE_SPLICE
+    size_t length = (uint64_t)count > SSIZE_MAX ? SSIZE_MAX : (size_t)count;
+    ssize_t result;
+    while ((result = tee(ToFileDescriptor(fdIn), ToFileDescriptor(fdOut), length, ConvertSpliceFlags(flags))) < 0 && errno == EINTR);
+    return (int64_t)result;
+#else
+    (void)fdIn;
+    (void)fdOut;
+    errno = ENOTSUP;
+    return -1;
+#endif
+}
+
 #if !HAVE_FCOPYFILE
 // Read all data from inFd and write it to outFd
 static int32_t CopyFile_ReadWrite(int inFd, int outFd)
@@ -1107,9 +1523,7 @@ int32_t SystemNative_CopyFile(intptr_t sourceFd, intptr_t destinationFd)
     int ret;
     struct stat_ sourceStat;
     bool copied = false;
-#if HAVE_SENDFILE_4
-    // If sendfile is available (Linux), try to use it, as the whole copy
-    // can be performed in the kernel, without lots of unnecessary copying.
+#if HAVE_COPY_FILE_RANGE || HAVE_SENDFILE_4
     while ((ret = fstat_(inFd, &sourceStat)) < 0 && errno == EINTR);
     if (ret != 0)
     {
@@ -1121,10 +1535,55 @@ int32_t SystemNative_CopyFile(intptr_t sourceFd, intptr_t destinationFd)
     // `size_t' a 32-bit integer while the `st_size' field of the stat structure will be off64_t.
     // So `size' will have to be `uint64_t'. In all other cases, it will be `size_t'.
     uint64_t size = (uint64_t)sourceStat.st_size;
+#endif
 
+#if HAVE_COPY_FILE_RANGE
+    // copy_file_range lets the file system share extents (reflink) or copy on the server side
+    // for network file systems, so no data needs to pass through the page cache of this machine.
+    // It advances both file positions, so sendfile and the manual copy below pick up from
+    // wherever it stopped.
+    while (size > 0)
+    {
+        ssize_t sent = copy_file_range(inFd, NULL, outFd, NULL, (size >= SSIZE_MAX ? SSIZE_MAX : (size_t)size), 0);
+        if (sent < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+
+            // Copies across file systems (on older kernels), special files and file systems
+            // that don't support it fall back to sendfile.
+            if (errno != EXDEV && errno != EINVAL && errno != ENOSYS && errno != EOPNOTSUPP)
+            {
+                return -1;
+            }
+
+            break;
+        }
+        else if (sent == 0)
+        {
+            // The source is shorter than it was when it was stat'ed.
+            break;
+        }
+        else
+        {
+            assert((size_t)sent <= size);
+            size -= (size_t)sent;
+        }
+    }
+    if (size == 0)
+    {
+        copied = true;
+    }
+#endif // HAVE_COPY_FILE_RANGE
+
+#if HAVE_SENDFILE_4
+    // If sendfile is available (Linux), try to use it, as the whole copy
+    // can be performed in the kernel, without lots of unnecessary copying.
     // Note that per man page for large files, you have to iterate until the
     // whole file is copied (Linux has a limit of 0x7ffff000 bytes copied).
-    while (size > 0)
+    while (!copied && size > 0)
     {
         ssize_t sent = sendfile(outFd, inFd, NULL, (size >= SSIZE_MAX ? SSIZE_MAX : (size_t)size));
         if (sent < 0)
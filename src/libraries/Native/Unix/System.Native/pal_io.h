@@ -12,6 +12,14 @@
 #include <sys/types.h>
 #include <pal_io_common.h>
 
+// NOTE: the layout of this type is intended to exactly  match the layout of a `struct iovec`. There are
+//       assertions in pal_networking.c that validate this.
+typedef struct
+{
+    uint8_t* Base;
+    uintptr_t Count;
+} IOVector;
+
 /**
  * File status returned by Stat or FStat.
  */
@@ -192,6 +200,16 @@ typedef enum
     PAL_LOCK_UN = 8, /* unlock */
 } LockOperations;
 
+/**
+ * Constants from fcntl.h for Splice and Tee
+ */
+typedef enum
+{
+    PAL_SPLICE_F_MOVE = 1,     /* move pages instead of copying, a hint */
+    PAL_SPLICE_F_NONBLOCK = 2, /* don't block on the pipe */
+    PAL_SPLICE_F_MORE = 4,     /* more data will follow in a subsequent call */
+} SpliceFlags;
+
 /**
  * Constants for changing the access permissions of a path
  */
@@ -234,6 +252,8 @@ enum
     PAL_MAP_PRIVATE = 0x02, // private copy-on-write-mapping
 
     PAL_MAP_ANONYMOUS = 0x10, // mapping is not backed by any file
+    PAL_MAP_POPULATE = 0x20,  // prefault the mapping (read-ahead for file mappings), ignored where unsupported
+    PAL_MAP_HUGETLB = 0x40,   // back the mapping with huge pages, fails with ENOTSUP where unsupported
 };
 
 /**
@@ -253,7 +273,10 @@ enum
  */
 typedef enum
 {
-    PAL_MADV_DONTFORK = 1, // don't map pages in to forked process
+    PAL_MADV_DONTFORK = 1,   // don't map pages in to forked process
+    PAL_MADV_WILLNEED = 2,   // start reading the range in the background
+    PAL_MADV_SEQUENTIAL = 3, // the range will be accessed sequentially, read ahead aggressively
+    PAL_MADV_HUGEPAGE = 4,   // back the range with transparent huge pages
 } MemmoryAdvice;
 
 /**
@@ -384,6 +407,23 @@ PALEXPORT int32_t SystemNative_GetReadDirRBufferSize(void);
  */
 PALEXPORT int32_t SystemNative_ReadDirR(DIR* dir, uint8_t* buffer, int32_t bufferSize, DirectoryEntry* outputEntry);
 
+/**
+ * Reads as many entries as fit from the directory stream pointed to by dir. The names of the entries are stored in buffer,
+ * which must be at least SystemNative_GetReadDirRBufferSize bytes and should be several kilobytes to benefit from batching.
+ * A stream that is read with this function must not also be read with SystemNative_ReadDirR.
+ *
+ * Returns the number of entries stored, 0 when end-of-stream is reached, or -1 on failure; sets errno on fail.
+ */
+PALEXPORT int32_t SystemNative_ReadDirBatch(DIR* dir, uint8_t* buffer, int32_t bufferSize, DirectoryEntry* entries, int32_t entryCount);
+
+/**
+ * Gets the status of entries of the directory stream pointed to by dir, without following symbolic links, in a single call.
+ * The status of entries[i] is stored in output[i] and errors[i] receives 0 or the PAL error code of the entry.
+ *
+ * Returns 0 on success, or -1 if the directory could not be used; sets errno on fail.
+ */
+PALEXPORT int32_t SystemNative_LStatBatch(DIR* dir, const DirectoryEntry* entries, int32_t entryCount, FileStatus* output, int32_t* errors);
+
 /**
  * Returns a DIR struct containing info about the current path or NULL on failure; sets errno on fail.
  */
@@ -562,6 +602,15 @@ PALEXPORT int32_t SystemNative_MUnmap(void* address, uint64_t length);
  */
 PALEXPORT int32_t SystemNative_MAdvise(void* address, uint64_t length, int32_t advice);
 
+/**
+ * Sets the NUMA memory policy of a page aligned range to allocate from the given node. Implemented as shim to mbind(2).
+ * When strict is zero the node is only preferred, otherwise allocations fail rather than use other nodes. Pages of the
+ * range that are already resident are moved where possible.
+ *
+ * Returns 0 for success, -1 for failure. Sets errno on failure, to ENOTSUP where NUMA policies are not available.
+ */
+PALEXPORT int32_t SystemNative_MBind(void* address, uint64_t length, int32_t numaNode, int32_t strict);
+
 /**
  * Sycnhronize a file with a memory map. Implemented as shim to mmap(2).
  *
@@ -648,6 +697,65 @@ PALEXPORT void SystemNative_Sync(void);
  */
 PALEXPORT int32_t SystemNative_Write(intptr_t fd, const void* buffer, int32_t bufferSize);
 
+/**
+ * Reads into the buffer from the given offset of the file, without changing the file position.
+ *
+ * Returns the number of bytes read on success; otherwise, -1 is returned and errno is set.
+ */
+PALEXPORT int32_t SystemNative_PRead(intptr_t fd, void* buffer, int32_t bufferSize, int64_t fileOffset);
+
+/**
+ * Writes the buffer at the given offset of the file, without changing the file position.
+ *
+ * Returns the number of bytes written on success; otherwise, -1 is returned and errno is set.
+ */
+PALEXPORT int32_t SystemNative_PWrite(intptr_t fd, const void* buffer, int32_t bufferSize, int64_t fileOffset);
+
+/**
+ * Reads into the buffers in order, starting at the given offset of the file, without changing the file position.
+ * At most IOV_MAX buffers are filled by a call.
+ *
+ * Returns the number of bytes read on success; otherwise, -1 is returned and errno is set.
+ */
+PALEXPORT int64_t SystemNative_PReadV(intptr_t fd, IOVector* vectors, int32_t vectorCount, int64_t fileOffset);
+
+/**
+ * Writes the buffers in order, starting at the given offset of the file, without changing the file position.
+ * At most IOV_MAX buffers are written by a call.
+ *
+ * Returns the number of bytes written on success; otherwise, -1 is returned and errno is set.
+ */
+PALEXPORT int64_t SystemNative_PWriteV(intptr_t fd, IOVector* vectors, int32_t vectorCount, int64_t fileOffset);
+
+/**
+ * Same as SystemNative_PReadV but only reads data that is already in the page cache (RWF_NOWAIT).
+ *
+ * Returns the number of bytes read on success, which is less than requested when only part of the data was cached;
+ * otherwise, -1 is returned and errno is set, to EAGAIN when a read would have to block and to ENOTSUP where
+ * non-blocking reads are not available.
+ */
+PALEXPORT int64_t SystemNative_PReadVNoWait(intptr_t fd, IOVector* vectors, int32_t vectorCount, int64_t fileOffset);
+
+/**
+ * Moves up to count bytes between two file descriptors without copying through user space. One of the
+ * descriptors must refer to a pipe; flags is a combination of SpliceFlags. The file positions of non-pipe
+ * descriptors are used and advanced. Relaying between two sockets splices into and out of an intermediate
+ * pipe, whose capacity can be raised with SystemNative_FcntlSetPipeSz.
+ *
+ * Returns the number of bytes moved, 0 at end of input; otherwise, -1 is returned and errno is set,
+ * to ENOTSUP where splice is not available.
+ */
+PALEXPORT int64_t SystemNative_Splice(intptr_t fdIn, intptr_t fdOut, int64_t count, int32_t flags);
+
+/**
+ * Duplicates up to count bytes from one pipe to another without consuming them from the input pipe.
+ * flags is a combination of SpliceFlags.
+ *
+ * Returns the number of bytes duplicated, 0 when the input pipe is empty and has no writers; otherwise,
+ * -1 is returned and errno is set, to ENOTSUP where tee is not available.
+ */
+PALEXPORT int64_t SystemNative_Tee(intptr_t fdIn, intptr_t fdOut, int64_t count, int32_t flags);
+
 /**
  * Copies all data from the source file descriptor to the destination file descriptor.
  *
@@ -60,6 +60,14 @@
 #if HAVE_LINUX_CAN_H
 #include <linux/can.h>
 #endif
+#if HAVE_UDP_SEGMENT
+#include <netinet/udp.h>
+#endif
+#if HAVE_LINUX_IO_URING_H
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#endif
 #if HAVE_SYS_FILIO_H
 #include <sys/filio.h>
 #endif
@@ -1491,6 +1499,202 @@ int32_t SystemNative_SendMessage(intptr_t socket, MessageHeader* messageHeader,
     return SystemNative_ConvertErrorPlatformToPal(errno);
 }
 
+#if HAVE_RECVMMSG || HAVE_SENDMMSG
+// Messages handled by one recvmmsg/sendmmsg call, callers loop for larger batches.
+#define MAX_BATCHED_MESSAGES 64
+#endif
+
+static int32_t ValidateMessageHeaders(MessageHeader* messageHeaders, int64_t* messageLengths, int32_t count, int32_t* processed)
+{
+    if (messageHeaders == NULL || messageLengths == NULL || processed == NULL || count <= 0)
+    {
+        return Error_EFAULT;
+    }
+
+    for (int32_t i = 0; i < count; i++)
+    {
+        if (messageHeaders[i].SocketAddressLen < 0 || messageHeaders[i].ControlBufferLen < 0 || messageHeaders[i].IOVectorCount < 0)
+        {
+            return Error_EFAULT;
+        }
+    }
+
+    return Error_SUCCESS;
+}
+
+int32_t SystemNative_ReceiveMessages(
+    intptr_t socket, MessageHeader* messageHeaders, int64_t* messageLengths, int32_t count, int32_t flags, int32_t* received)
+{
+    int32_t error = ValidateMessageHeaders(messageHeaders, messageLengths, count, received);
+    if (error != Error_SUCCESS)
+    {
+        return error;
+    }
+
+#if HAVE_RECVMMSG
+    int fd = ToFileDescriptor(socket);
+
+    int socketFlags;
+    if (!ConvertSocketFlagsPalToPlatform(flags, &socketFlags))
+    {
+        return Error_ENOTSUP;
+    }
+
+    struct mmsghdr headers[MAX_BATCHED_MESSAGES];
+    unsigned int headerCount = (unsigned int)Min(count, MAX_BATCHED_MESSAGES);
+    for (unsigned int i = 0; i < headerCount; i++)
+    {
+        ConvertMessageHeaderToMsghdr(&headers[i].msg_hdr, &messageHeaders[i], fd);
+        headers[i].msg_len = 0;
+    }
+
+    int res;
+    while ((res = recvmmsg(fd, headers, headerCount, socketFlags, NULL)) < 0 && errno == EINTR);
+
+    if (res == -1)
+    {
+        *received = 0;
+        return SystemNative_ConvertErrorPlatformToPal(errno);
+    }
+
+    for (int i = 0; i < res; i++)
+    {
+        MessageHeader* messageHeader = &messageHeaders[i];
+        struct msghdr* header = &headers[i].msg_hdr;
+
+        assert((int32_t)header->msg_namelen <= messageHeader->SocketAddressLen);
+        messageHeader->SocketAddressLen = Min((int32_t)header->msg_namelen, messageHeader->SocketAddressLen);
+
+        assert(header->msg_controllen <= (size_t)messageHeader->ControlBufferLen);
+        messageHeader->ControlBufferLen = Min((int32_t)header->msg_controllen, messageHeader->ControlBufferLen);
+
+        messageHeader->Flags = ConvertSocketFlagsPlatformToPal(header->msg_flags);
+        messageLengths[i] = headers[i].msg_len;
+    }
+
+    *received = res;
+    return Error_SUCCESS;
+#else
+    error = SystemNative_ReceiveMessage(socket, messageHeaders, flags, messageLengths);
+    *received = error == Error_SUCCESS ? 1 : 0;
+    return error;
+#endif
+}
+
+int32_t SystemNative_SendMessages(
+    intptr_t socket, MessageHeader* messageHeaders, int64_t* messageLengths, int32_t count, int32_t flags, int32_t* sent)
+{
+    int32_t error = ValidateMessageHeaders(messageHeaders, messageLengths, count, sent);
+    if (error != Error_SUCCESS)
+    {
+        return error;
+    }
+
+#if HAVE_SENDMMSG
+    int fd = ToFileDescriptor(socket);
+
+    int socketFlags;
+    if (!ConvertSocketFlagsPalToPlatform(flags, &socketFlags))
+    {
+        return Error_ENOTSUP;
+    }
+
+    struct mmsghdr headers[MAX_BATCHED_MESSAGES];
+    unsigned int headerCount = (unsigned int)Min(count, MAX_BATCHED_MESSAGES);
+    for (unsigned int i = 0; i < headerCount; i++)
+    {
+        ConvertMessageHeaderToMsghdr(&headers[i].msg_hdr, &messageHeaders[i], fd);
+        headers[i].msg_len = 0;
+    }
+
+    int res;
+    while ((res = sendmmsg(fd, headers, headerCount, socketFlags)) < 0 && errno == EINTR);
+
+    if (res == -1)
+    {
+        *sent = 0;
+        return SystemNative_ConvertErrorPlatformToPal(errno);
+    }
+
+    for (int i = 0; i < res; i++)
+    {
+        messageLengths[i] = headers[i].msg_len;
+    }
+
+    *sent = res;
+    return Error_SUCCESS;
+#else
+    error = SystemNative_SendMessage(socket, messageHeaders, flags, messageLengths);
+    *sent = error == Error_SUCCESS ? 1 : 0;
+    return error;
+#endif
+}
+
+int32_t SystemNative_SetUdpSegmentSize(intptr_t socket, int32_t segmentSize)
+{
+    if (segmentSize < 0 || segmentSize > UINT16_MAX)
+    {
+        return Error_EINVAL;
+    }
+
+#if HAVE_UDP_SEGMENT
+    int fd = ToFileDescriptor(socket);
+    int value = segmentSize;
+    int err = setsockopt(fd, SOL_UDP, UDP_SEGMENT, &value, sizeof(value));
+    return err == 0 ? Error_SUCCESS : SystemNative_ConvertErrorPlatformToPal(errno);
+#else
+    return Error_ENOTSUP;
+#endif
+}
+
+int32_t SystemNative_SetUdpReceiveOffload(intptr_t socket, int32_t enabled)
+{
+#if HAVE_UDP_SEGMENT
+    int fd = ToFileDescriptor(socket);
+    int value = enabled != 0 ? 1 : 0;
+    int err = setsockopt(fd, SOL_UDP, UDP_GRO, &value, sizeof(value));
+    return err == 0 ? Error_SUCCESS : SystemNative_ConvertErrorPlatformToPal(errno);
+#else
+    return Error_ENOTSUP;
+#endif
+}
+
+int32_t SystemNative_GetUdpSegmentControlMessageSize(void)
+{
+#if HAVE_UDP_SEGMENT
+    return CMSG_SPACE(sizeof(int));
+#else
+    return 0;
+#endif
+}
+
+int32_t SystemNative_TryGetUdpReceiveSegmentSize(MessageHeader* messageHeader, int32_t* segmentSize)
+{
+    if (messageHeader == NULL || segmentSize == NULL)
+    {
+        return 0;
+    }
+
+#if HAVE_UDP_SEGMENT
+    struct msghdr header;
+    ConvertMessageHeaderToMsghdr(&header, messageHeader, -1);
+
+    for (struct cmsghdr* controlMessage = CMSG_FIRSTHDR(&header); controlMessage != NULL && controlMessage->cmsg_len > 0;
+         controlMessage = GET_CMSG_NXTHDR(&header, controlMessage))
+    {
+        if (controlMessage->cmsg_level == SOL_UDP && controlMessage->cmsg_type == UDP_GRO)
+        {
+            int value;
+            memcpy(&value, CMSG_DATA(controlMessage), sizeof(value));
+            *segmentSize = value;
+            return 1;
+        }
+    }
+#endif
+
+    return 0;
+}
+
 int32_t SystemNative_Accept(intptr_t socket, uint8_t* socketAddress, int32_t* socketAddressLen, intptr_t* acceptedSocket)
 {
     if (socketAddress == NULL || socketAddressLen == NULL || acceptedSocket == NULL || *socketAddressLen < 0)
@@ -3018,6 +3222,327 @@ int32_t SystemNative_WaitForSocketEvents(intptr_t port, SocketEvent* buffer, int
     return WaitForSocketEventsInner(fd, buffer, count);
 }
 
+#if HAVE_LINUX_IO_URING_H
+
+typedef struct
+{
+    int Fd;
+    uint32_t Entries;
+    uint32_t Unsubmitted;
+
+    uint32_t* SqHead;
+    uint32_t* SqTail;
+    uint32_t* SqMask;
+    uint32_t* SqArray;
+    struct io_uring_sqe* Sqes;
+
+    uint32_t* CqHead;
+    uint32_t* CqTail;
+    uint32_t* CqMask;
+    struct io_uring_cqe* Cqes;
+
+    void* SqRing;
+    size_t SqRingSize;
+    void* CqRing;
+    size_t CqRingSize;
+    size_t SqesSize;
+} SocketCompletionRing;
+
+static void FreeSocketCompletionRing(SocketCompletionRing* ring)
+{
+    if (ring->Sqes != NULL)
+    {
+        munmap(ring->Sqes, ring->SqesSize);
+    }
+    if (ring->CqRing != NULL)
+    {
+        munmap(ring->CqRing, ring->CqRingSize);
+    }
+    if (ring->SqRing != NULL)
+    {
+        munmap(ring->SqRing, ring->SqRingSize);
+    }
+    if (ring->Fd != -1)
+    {
+        close(ring->Fd);
+    }
+    free(ring);
+}
+
+static void* MapSocketCompletionRing(int fd, size_t size, off_t offset)
+{
+    void* mapping = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, offset);
+    return mapping == MAP_FAILED ? NULL : mapping;
+}
+
+static int32_t EnterSocketCompletionRing(SocketCompletionRing* ring, uint32_t minComplete)
+{
+    while (true)
+    {
+        uint32_t flags = minComplete > 0 ? IORING_ENTER_GETEVENTS : 0;
+        long res = syscall(__NR_io_uring_enter, ring->Fd, ring->Unsubmitted, minComplete, flags, NULL, 0);
+        if (res >= 0)
+        {
+            ring->Unsubmitted -= (uint32_t)res;
+            return Error_SUCCESS;
+        }
+
+        if (errno != EINTR)
+        {
+            return SystemNative_ConvertErrorPlatformToPal(errno);
+        }
+    }
+}
+
+static int32_t QueueSocketOperation(
+    intptr_t handle, intptr_t socket, uint8_t* buffer, int32_t bufferLen, int32_t bufferIndex, int32_t flags, uint64_t data, int8_t send)
+{
+    SocketCompletionRing* ring = (SocketCompletionRing*)handle;
+    if (ring == NULL || buffer == NULL || bufferLen < 0 || bufferIndex < -1)
+    {
+        return Error_EFAULT;
+    }
+
+    int socketFlags;
+    if (!ConvertSocketFlagsPalToPlatform(flags, &socketFlags) || (bufferIndex != -1 && socketFlags != 0))
+    {
+        return Error_ENOTSUP;
+    }
+
+    // The ring is full, submit what is queued to make room
+    uint32_t tail = *ring->SqTail;
+    if (tail - __atomic_load_n(ring->SqHead, __ATOMIC_ACQUIRE) >= ring->Entries)
+    {
+        int32_t error = EnterSocketCompletionRing(ring, 0);
+        if (error != Error_SUCCESS)
+        {
+            return error;
+        }
+        if (tail - __atomic_load_n(ring->SqHead, __ATOMIC_ACQUIRE) >= ring->Entries)
+        {
+            return Error_ENOBUFS;
+        }
+    }
+
+    uint32_t index = tail & *ring->SqMask;
+    struct io_uring_sqe* sqe = &ring->Sqes[index];
+    memset(sqe, 0, sizeof(struct io_uring_sqe));
+
+    // Registered buffers are read and written with the fixed buffer operations, which have no socket flags
+    if (bufferIndex != -1)
+    {
+        sqe->opcode = send ? IORING_OP_WRITE_FIXED : IORING_OP_READ_FIXED;
+        sqe->buf_index = (uint16_t)bufferIndex;
+    }
+    else
+    {
+        sqe->opcode = send ? IORING_OP_SEND : IORING_OP_RECV;
+        sqe->msg_flags = (uint32_t)socketFlags;
+    }
+    sqe->fd = ToFileDescriptor(socket);
+    sqe->addr = (uint64_t)(uintptr_t)buffer;
+    sqe->len = (uint32_t)bufferLen;
+    sqe->user_data = data;
+
+    ring->SqArray[index] = index;
+    __atomic_store_n(ring->SqTail, tail + 1, __ATOMIC_RELEASE);
+    ring->Unsubmitted++;
+    return Error_SUCCESS;
+}
+
+int32_t SystemNative_CreateSocketCompletionRing(int32_t entries, intptr_t* handle)
+{
+    if (handle == NULL || entries <= 0)
+    {
+        return Error_EFAULT;
+    }
+
+    *handle = 0;
+
+    struct io_uring_params params;
+    memset(&params, 0, sizeof(params));
+
+    int fd = (int)syscall(__NR_io_uring_setup, (uint32_t)entries, &params);
+    if (fd == -1)
+    {
+        return SystemNative_ConvertErrorPlatformToPal(errno);
+    }
+
+    SocketCompletionRing* ring = (SocketCompletionRing*)calloc(1, sizeof(SocketCompletionRing));
+    if (ring == NULL)
+    {
+        close(fd);
+        return Error_ENOMEM;
+    }
+
+    ring->Fd = fd;
+    ring->Entries = params.sq_entries;
+    ring->SqRingSize = params.sq_off.array + params.sq_entries * sizeof(uint32_t);
+    ring->CqRingSize = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+    ring->SqesSize = params.sq_entries * sizeof(struct io_uring_sqe);
+
+    ring->SqRing = MapSocketCompletionRing(fd, ring->SqRingSize, IORING_OFF_SQ_RING);
+    ring->CqRing = MapSocketCompletionRing(fd, ring->CqRingSize, IORING_OFF_CQ_RING);
+    ring->Sqes = (struct io_uring_sqe*)MapSocketCompletionRing(fd, ring->SqesSize, IORING_OFF_SQES);
+    if (ring->SqRing == NULL || ring->CqRing == NULL || ring->Sqes == NULL)
+    {
+        int32_t error = SystemNative_ConvertErrorPlatformToPal(errno);
+        FreeSocketCompletionRing(ring);
+        return error;
+    }
+
+    uint8_t* sq = (uint8_t*)ring->SqRing;
+    ring->SqHead = (uint32_t*)(sq + params.sq_off.head);
+    ring->SqTail = (uint32_t*)(sq + params.sq_off.tail);
+    ring->SqMask = (uint32_t*)(sq + params.sq_off.ring_mask);
+    ring->SqArray = (uint32_t*)(sq + params.sq_off.array);
+
+    uint8_t* cq = (uint8_t*)ring->CqRing;
+    ring->CqHead = (uint32_t*)(cq + params.cq_off.head);
+    ring->CqTail = (uint32_t*)(cq + params.cq_off.tail);
+    ring->CqMask = (uint32_t*)(cq + params.cq_off.ring_mask);
+    ring->Cqes = (struct io_uring_cqe*)(cq + params.cq_off.cqes);
+
+    *handle = (intptr_t)ring;
+    return Error_SUCCESS;
+}
+
+int32_t SystemNative_CloseSocketCompletionRing(intptr_t handle)
+{
+    SocketCompletionRing* ring = (SocketCompletionRing*)handle;
+    if (ring == NULL)
+    {
+        return Error_EFAULT;
+    }
+
+    FreeSocketCompletionRing(ring);
+    return Error_SUCCESS;
+}
+
+int32_t SystemNative_RegisterSocketCompletionBuffers(intptr_t handle, IOVector* buffers, int32_t count)
+{
+    SocketCompletionRing* ring = (SocketCompletionRing*)handle;
+    if (ring == NULL || buffers == NULL || count <= 0)
+    {
+        return Error_EFAULT;
+    }
+
+    int res;
+    while ((res = (int)syscall(__NR_io_uring_register, ring->Fd, IORING_REGISTER_BUFFERS, (struct iovec*)buffers, (uint32_t)count)) < 0 && errno == EINTR);
+    return res == 0 ? Error_SUCCESS : SystemNative_ConvertErrorPlatformToPal(errno);
+}
+
+int32_t SystemNative_QueueSocketReceive(
+    intptr_t ring, intptr_t socket, uint8_t* buffer, int32_t bufferLen, int32_t bufferIndex, int32_t flags, uint64_t data)
+{
+    return QueueSocketOperation(ring, socket, buffer, bufferLen, bufferIndex, flags, data, false);
+}
+
+int32_t SystemNative_QueueSocketSend(
+    intptr_t ring, intptr_t socket, uint8_t* buffer, int32_t bufferLen, int32_t bufferIndex, int32_t flags, uint64_t data)
+{
+    return QueueSocketOperation(ring, socket, buffer, bufferLen, bufferIndex, flags, data, true);
+}
+
+int32_t SystemNative_SubmitAndWaitForSocketCompletions(
+    intptr_t handle, int32_t waitCount, SocketCompletion* completions, int32_t* count)
+{
+    SocketCompletionRing* ring = (SocketCompletionRing*)handle;
+    if (ring == NULL || completions == NULL || count == NULL || *count < 0 || waitCount < 0)
+    {
+        return Error_EFAULT;
+    }
+
+    // Completions already queued count toward the wait, which never asks for more than fit in the buffer
+    uint32_t capacity = (uint32_t)*count;
+    uint32_t head = *ring->CqHead;
+    uint32_t available = __atomic_load_n(ring->CqTail, __ATOMIC_ACQUIRE) - head;
+    uint32_t minComplete = available >= (uint32_t)waitCount ? 0 : (uint32_t)waitCount - available;
+    if (minComplete > capacity)
+    {
+        minComplete = capacity;
+    }
+
+    *count = 0;
+
+    if (ring->Unsubmitted > 0 || minComplete > 0)
+    {
+        int32_t error = EnterSocketCompletionRing(ring, minComplete);
+        if (error != Error_SUCCESS)
+        {
+            return error;
+        }
+    }
+
+    uint32_t tail = __atomic_load_n(ring->CqTail, __ATOMIC_ACQUIRE);
+    uint32_t reaped = 0;
+    for (; head != tail && reaped < capacity; head++, reaped++)
+    {
+        const struct io_uring_cqe* cqe = &ring->Cqes[head & *ring->CqMask];
+        SocketCompletion* completion = &completions[reaped];
+        completion->Data = cqe->user_data;
+        if (cqe->res >= 0)
+        {
+            completion->BytesTransferred = cqe->res;
+            completion->ErrorCode = Error_SUCCESS;
+        }
+        else
+        {
+            completion->BytesTransferred = 0;
+            completion->ErrorCode = SystemNative_ConvertErrorPlatformToPal(-cqe->res);
+        }
+    }
+    __atomic_store_n(ring->CqHead, head, __ATOMIC_RELEASE);
+
+    *count = (int32_t)reaped;
+    return Error_SUCCESS;
+}
+
+#else
+
+int32_t SystemNative_CreateSocketCompletionRing(int32_t entries, intptr_t* handle)
+{
+    if (handle != NULL)
+    {
+        *handle = 0;
+    }
+    return Error_ENOSYS;
+}
+
+int32_t SystemNative_CloseSocketCompletionRing(intptr_t handle)
+{
+    return Error_ENOSYS;
+}
+
+int32_t SystemNative_RegisterSocketCompletionBuffers(intptr_t handle, IOVector* buffers, int32_t count)
+{
+    return Error_ENOSYS;
+}
+
+int32_t SystemNative_QueueSocketReceive(
+    intptr_t ring, intptr_t socket, uint8_t* buffer, int32_t bufferLen, int32_t bufferIndex, int32_t flags, uint64_t data)
+{
+    return Error_ENOSYS;
+}
+
+int32_t SystemNative_QueueSocketSend(
+    intptr_t ring, intptr_t socket, uint8_t* buffer, int32_t bufferLen, int32_t bufferIndex, int32_t flags, uint64_t data)
+{
+    return Error_ENOSYS;
+}
+
+int32_t SystemNative_SubmitAndWaitForSocketCompletions(
+    intptr_t handle, int32_t waitCount, SocketCompletion* completions, int32_t* count)
+{
+    if (count != NULL)
+    {
+        *count = 0;
+    }
+    return Error_ENOSYS;
+}
+
+#endif
+
 int32_t SystemNative_PlatformSupportsDualModeIPv4PacketInfo(void)
 {
 #if HAVE_SUPPORT_FOR_DUAL_MODE_IPV4_PACKET_INFO
@@ -6,6 +6,7 @@
 #include "pal_compiler.h"
 #include "pal_types.h"
 #include "pal_errno.h"
+#include "pal_io.h"
 #include <pal_networking_common.h>
 
 /**
@@ -275,14 +276,6 @@ typedef struct
     int32_t Seconds; // Number of seconds to linger for
 } LingerOption;
 
-// NOTE: the layout of this type is intended to exactly  match the layout of a `struct iovec`. There are
-//       assertions in pal_networking.cpp that validate this.
-typedef struct
-{
-    uint8_t* Base;
-    uintptr_t Count;
-} IOVector;
-
 typedef struct
 {
     uint8_t* SocketAddress;
@@ -301,6 +294,13 @@ typedef struct
     uint32_t Padding;    // Pad out to 8-byte alignment
 } SocketEvent;
 
+typedef struct
+{
+    uint64_t Data;             // User data of the completed operation
+    int32_t BytesTransferred;  // Number of bytes received or sent
+    int32_t ErrorCode;         // PAL error code of the operation
+} SocketCompletion;
+
 PALEXPORT int32_t SystemNative_GetHostEntryForName(const uint8_t* address, int32_t addressFamily, HostEntry* entry);
 
 PALEXPORT void SystemNative_FreeHostEntry(HostEntry* entry);
@@ -367,6 +367,32 @@ PALEXPORT int32_t SystemNative_Send(intptr_t socket, void* buffer, int32_t buffe
 
 PALEXPORT int32_t SystemNative_SendMessage(intptr_t socket, MessageHeader* messageHeader, int32_t flags, int64_t* sent);
 
+/**
+ * Receives or sends up to count datagrams in one call. messageLengths receives the number of bytes
+ * of each message and received/sent the number of messages that were processed, which may be less
+ * than count. Platforms without recvmmsg/sendmmsg process a single message per call.
+ */
+PALEXPORT int32_t SystemNative_ReceiveMessages(
+    intptr_t socket, MessageHeader* messageHeaders, int64_t* messageLengths, int32_t count, int32_t flags, int32_t* received);
+
+PALEXPORT int32_t SystemNative_SendMessages(
+    intptr_t socket, MessageHeader* messageHeaders, int64_t* messageLengths, int32_t count, int32_t flags, int32_t* sent);
+
+/**
+ * UDP segmentation offload. A non zero segment size makes the kernel split each sent datagram into
+ * segments of that size, enabling receive offload coalesces received datagrams of the same flow into
+ * one message whose segment size is reported by SystemNative_TryGetUdpReceiveSegmentSize. Both
+ * return Error_ENOTSUP where the platform has no UDP offload.
+ */
+PALEXPORT int32_t SystemNative_SetUdpSegmentSize(intptr_t socket, int32_t segmentSize);
+
+PALEXPORT int32_t SystemNative_SetUdpReceiveOffload(intptr_t socket, int32_t enabled);
+
+// Size of the control message carrying the segment size, to be added to the control buffer of received messages.
+PALEXPORT int32_t SystemNative_GetUdpSegmentControlMessageSize(void);
+
+PALEXPORT int32_t SystemNative_TryGetUdpReceiveSegmentSize(MessageHeader* messageHeader, int32_t* segmentSize);
+
 PALEXPORT int32_t SystemNative_Accept(intptr_t socket, uint8_t* socketAddress, int32_t* socketAddressLen, intptr_t* acceptedSocket);
 
 PALEXPORT int32_t SystemNative_Bind(intptr_t socket, int32_t protocolType, uint8_t* socketAddress, int32_t socketAddressLen);
@@ -416,6 +442,29 @@ PALEXPORT int32_t SystemNative_TryChangeSocketEventRegistration(
 
 PALEXPORT int32_t SystemNative_WaitForSocketEvents(intptr_t port, SocketEvent* buffer, int32_t* count);
 
+/**
+ * Completion based socket I/O, backed by io_uring on Linux.
+ *
+ * Receives and sends are queued on the ring without a system call and submitted as a batch by
+ * SystemNative_SubmitAndWaitForSocketCompletions, which also returns the completed operations.
+ * A ring must only be used by one thread at a time. Creating a ring fails with Error_ENOSYS
+ * where completion based I/O is not available, callers fall back to the socket event port.
+ */
+PALEXPORT int32_t SystemNative_CreateSocketCompletionRing(int32_t entries, intptr_t* ring);
+
+PALEXPORT int32_t SystemNative_CloseSocketCompletionRing(intptr_t ring);
+
+PALEXPORT int32_t SystemNative_RegisterSocketCompletionBuffers(intptr_t ring, IOVector* buffers, int32_t count);
+
+PALEXPORT int32_t SystemNative_QueueSocketReceive(
+    intptr_t ring, intptr_t socket, uint8_t* buffer, int32_t bufferLen, int32_t bufferIndex, int32_t flags, uint64_t data);
+
+PALEXPORT int32_t SystemNative_QueueSocketSend(
+    intptr_t ring, intptr_t socket, uint8_t* buffer, int32_t bufferLen, int32_t bufferIndex, int32_t flags, uint64_t data);
+
+PALEXPORT int32_t SystemNative_SubmitAndWaitForSocketCompletions(
+    intptr_t ring, int32_t waitCount, SocketCompletion* completions, int32_t* count);
+
 PALEXPORT int32_t SystemNative_PlatformSupportsDualModeIPv4PacketInfo(void);
 
 PALEXPORT char* SystemNative_GetPeerUserName(intptr_t socket);
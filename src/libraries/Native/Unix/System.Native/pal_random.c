@@ -17,6 +17,10 @@
 #include "pal_config.h"
 #include "pal_random.h"
 
+#if !HAVE_ARC4RANDOM_BUF
+static bool sInitializedMRand;
+#endif
+
 /*
 
 Generate random bytes. The generated bytes are not cryptographically strong.
@@ -31,7 +35,6 @@ void SystemNative_GetNonCryptographicallySecureRandomBytes(uint8_t* buffer, int3
     arc4random_buf(buffer, (size_t)bufferLength);
 #else
     long num = 0;
-    static bool sInitializedMRand;
 
     // Fall back to the secure version
     SystemNative_GetCryptographicallySecureRandomBytes(buffer, bufferLength);
@@ -60,6 +63,29 @@ void SystemNative_GetNonCryptographicallySecureRandomBytes(uint8_t* buffer, int3
 
 /*
 
+Reseed the generator behind SystemNative_GetNonCryptographicallySecureRandomBytes, so processes
+restored from the same checkpoint do not produce the same sequence.
+
+*/
+
+void SystemNative_ReseedNonCryptographicallySecureRandom(void)
+{
+#if !HAVE_ARC4RANDOM_BUF
+    long seed = (long)time(NULL);
+    long secureSeed;
+
+    if (SystemNative_GetCryptographicallySecureRandomBytes((uint8_t*)&secureSeed, (int32_t)sizeof(secureSeed)) == 0)
+    {
+        seed ^= secureSeed;
+    }
+
+    srand48(seed);
+    sInitializedMRand = true;
+#endif // !HAVE_ARC4RANDOM_BUF
+}
+
+/*
+
 Generate cryptographically strong random bytes.
 
 Return 0 on success, -1 on failure.
@@ -92,6 +92,8 @@ static const Entry s_cryptoNative[] =
     DllImportEntry(CryptoNative_ErrPeekError)
     DllImportEntry(CryptoNative_ErrPeekLastError)
     DllImportEntry(CryptoNative_ErrReasonErrorString)
+    DllImportEntry(CryptoNative_EvpAeadDecryptOneShot)
+    DllImportEntry(CryptoNative_EvpAeadEncryptOneShot)
     DllImportEntry(CryptoNative_EvpAes128Cbc)
     DllImportEntry(CryptoNative_EvpAes128Ccm)
     DllImportEntry(CryptoNative_EvpAes128Cfb128)
@@ -199,6 +201,7 @@ static const Entry s_cryptoNative[] =
     DllImportEntry(CryptoNative_HmacCurrent)
     DllImportEntry(CryptoNative_HmacDestroy)
     DllImportEntry(CryptoNative_HmacFinal)
+    DllImportEntry(CryptoNative_HmacOneShot)
     DllImportEntry(CryptoNative_HmacReset)
     DllImportEntry(CryptoNative_HmacUpdate)
     DllImportEntry(CryptoNative_LookupFriendlyNameByOid)
@@ -291,6 +294,8 @@ static const Entry s_cryptoNative[] =
     DllImportEntry(CryptoNative_SslCtxCheckPrivateKey)
     DllImportEntry(CryptoNative_SslCtxCreate)
     DllImportEntry(CryptoNative_SslCtxDestroy)
+    DllImportEntry(CryptoNative_SslCtxEnableKtls)
+    DllImportEntry(CryptoNative_SslCtxSetAsyncMode)
     DllImportEntry(CryptoNative_SslCtxSetAlpnProtos)
     DllImportEntry(CryptoNative_SslCtxSetAlpnSelectCb)
     DllImportEntry(CryptoNative_SslCtxSetQuietShutdown)
@@ -299,23 +304,29 @@ static const Entry s_cryptoNative[] =
     DllImportEntry(CryptoNative_SslCtxUsePrivateKey)
     DllImportEntry(CryptoNative_SslDestroy)
     DllImportEntry(CryptoNative_SslDoHandshake)
+    DllImportEntry(CryptoNative_SslGetAsyncFds)
     DllImportEntry(CryptoNative_SslGetClientCAList)
     DllImportEntry(CryptoNative_SslGetCurrentCipherId)
     DllImportEntry(CryptoNative_SslGetError)
     DllImportEntry(CryptoNative_SslGetFinished)
+    DllImportEntry(CryptoNative_SslGetKtlsRecv)
+    DllImportEntry(CryptoNative_SslGetKtlsSend)
     DllImportEntry(CryptoNative_SslGetPeerCertChain)
     DllImportEntry(CryptoNative_SslGetPeerCertificate)
     DllImportEntry(CryptoNative_SslGetPeerFinished)
     DllImportEntry(CryptoNative_SslGetVersion)
     DllImportEntry(CryptoNative_SslRead)
+    DllImportEntry(CryptoNative_SslSendFile)
     DllImportEntry(CryptoNative_SslSessionReused)
     DllImportEntry(CryptoNative_SslSetAcceptState)
     DllImportEntry(CryptoNative_SslSetBio)
     DllImportEntry(CryptoNative_SslSetConnectState)
     DllImportEntry(CryptoNative_SslSetQuietShutdown)
+    DllImportEntry(CryptoNative_SslSetSocket)
     DllImportEntry(CryptoNative_SslSetTlsExtHostName)
     DllImportEntry(CryptoNative_SslShutdown)
     DllImportEntry(CryptoNative_SslV2_3Method)
+    DllImportEntry(CryptoNative_SslWaitingForAsync)
     DllImportEntry(CryptoNative_SslWrite)
     DllImportEntry(CryptoNative_X509StoreCtxGetTargetCert)
     DllImportEntry(CryptoNative_Tls13Supported)
@@ -54,9 +54,11 @@ int32_t RSA_set0_key(RSA* rsa, BIGNUM* n, BIGNUM* e, BIGNUM* d);
 int SSL_CTX_config(SSL_CTX* ctx, const char* name);
 unsigned long SSL_CTX_set_options(SSL_CTX* ctx, unsigned long options);
 void SSL_CTX_set_security_level(SSL_CTX* ctx, int32_t level);
+int SSL_get_all_async_fds(SSL* s, int* fds, size_t* numfds);
 int32_t SSL_is_init_finished(SSL* ssl);
 int SSL_session_reused(SSL* ssl);
 const SSL_METHOD* TLS_method(void);
+int SSL_waiting_for_async(SSL* s);
 const ASN1_TIME* X509_CRL_get0_nextUpdate(const X509_CRL* crl);
 int32_t X509_NAME_get0_der(X509_NAME* x509Name, const uint8_t** pder, size_t* pderlen);
 int32_t X509_PUBKEY_get0_param(
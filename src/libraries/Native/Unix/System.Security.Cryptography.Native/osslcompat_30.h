@@ -5,6 +5,7 @@
 
 #pragma once
 #include "pal_types.h"
+#include <sys/types.h>
 
 #undef EVP_PKEY_CTX_set_rsa_keygen_bits
 #undef EVP_PKEY_CTX_set_rsa_oaep_md
@@ -26,3 +27,4 @@ int EVP_PKEY_CTX_set_rsa_pss_saltlen(EVP_PKEY_CTX* ctx, int saltlen);
 int EVP_PKEY_CTX_set_signature_md(EVP_PKEY_CTX* ctx, const EVP_MD* md);
 OSSL_PROVIDER* OSSL_PROVIDER_try_load(OSSL_LIB_CTX* , const char* name, int retain_fallbacks);
 X509* SSL_get1_peer_certificate(const SSL* ssl);
+ssize_t SSL_sendfile(SSL* s, int fd, off_t offset, size_t size, int flags);
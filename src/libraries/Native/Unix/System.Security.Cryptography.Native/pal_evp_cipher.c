@@ -198,6 +198,108 @@ int32_t CryptoNative_EvpCipherSetCcmTag(EVP_CIPHER_CTX* ctx, uint8_t* tag, int32
     return EVP_CIPHER_CTX_ctrl(ctx, EVP_CTRL_CCM_SET_TAG, tagLength, tag);
 }
 
+static int32_t EvpAeadStart(EVP_CIPHER_CTX* ctx, uint8_t* nonce, int32_t nonceLength, uint8_t* aad, int32_t aadLength, int32_t enc)
+{
+    // The key is not passed again, so only the nonce is processed and the key schedule is reused.
+    if (EVP_CIPHER_CTX_ctrl(ctx, EVP_CTRL_GCM_SET_IVLEN, nonceLength, NULL) != SUCCESS ||
+        EVP_CipherInit_ex(ctx, NULL, NULL, NULL, nonce, enc) != SUCCESS)
+    {
+        return 0;
+    }
+
+    int outLength;
+    if (aadLength > 0 && EVP_CipherUpdate(ctx, NULL, &outLength, aad, aadLength) != SUCCESS)
+    {
+        return 0;
+    }
+
+    return SUCCESS;
+}
+
+int32_t CryptoNative_EvpAeadEncryptOneShot(EVP_CIPHER_CTX* ctx,
+                                           uint8_t* nonce,
+                                           int32_t nonceLength,
+                                           uint8_t* aad,
+                                           int32_t aadLength,
+                                           uint8_t* plaintext,
+                                           int32_t plaintextLength,
+                                           uint8_t* ciphertext,
+                                           uint8_t* tag,
+                                           int32_t tagLength)
+{
+    assert(ctx != NULL);
+    assert(nonce != NULL);
+    assert(aad != NULL || aadLength == 0);
+    assert(plaintext != NULL || plaintextLength == 0);
+    assert(ciphertext != NULL || plaintextLength == 0);
+    assert(tag != NULL);
+
+    if (aadLength < 0 || plaintextLength < 0 || !EvpAeadStart(ctx, nonce, nonceLength, aad, aadLength, 1))
+    {
+        return 0;
+    }
+
+    int outLength = 0;
+    if (plaintextLength > 0 && EVP_CipherUpdate(ctx, ciphertext, &outLength, plaintext, plaintextLength) != SUCCESS)
+    {
+        return 0;
+    }
+
+    // GCM doesn't buffer, so nothing is written by the final call.
+    int finalLength;
+    if (EVP_CipherFinal_ex(ctx, ciphertext + outLength, &finalLength) != SUCCESS)
+    {
+        return 0;
+    }
+
+    assert(outLength + finalLength == plaintextLength);
+    return EVP_CIPHER_CTX_ctrl(ctx, EVP_CTRL_GCM_GET_TAG, tagLength, tag) == SUCCESS ? SUCCESS : 0;
+}
+
+int32_t CryptoNative_EvpAeadDecryptOneShot(EVP_CIPHER_CTX* ctx,
+                                           uint8_t* nonce,
+                                           int32_t nonceLength,
+                                           uint8_t* aad,
+                                           int32_t aadLength,
+                                           uint8_t* ciphertext,
+                                           int32_t ciphertextLength,
+                                           uint8_t* tag,
+                                           int32_t tagLength,
+                                           uint8_t* plaintext)
+{
+    assert(ctx != NULL);
+    assert(nonce != NULL);
+    assert(aad != NULL || aadLength == 0);
+    assert(ciphertext != NULL || ciphertextLength == 0);
+    assert(plaintext != NULL || ciphertextLength == 0);
+    assert(tag != NULL);
+
+    if (aadLength < 0 || ciphertextLength < 0 || !EvpAeadStart(ctx, nonce, nonceLength, aad, aadLength, 0))
+    {
+        return 0;
+    }
+
+    int outLength = 0;
+    if (ciphertextLength > 0 && EVP_CipherUpdate(ctx, plaintext, &outLength, ciphertext, ciphertextLength) != SUCCESS)
+    {
+        return 0;
+    }
+
+    if (EVP_CIPHER_CTX_ctrl(ctx, EVP_CTRL_GCM_SET_TAG, tagLength, tag) != SUCCESS)
+    {
+        return 0;
+    }
+
+    // The tag is verified by the final call, which fails without queueing an error on a mismatch.
+    int finalLength;
+    if (EVP_CipherFinal_ex(ctx, plaintext + outLength, &finalLength) != SUCCESS)
+    {
+        return -1;
+    }
+
+    return SUCCESS;
+}
+
 const EVP_CIPHER* CryptoNative_EvpAes128Ecb()
 {
     return EVP_aes_128_ecb();
@@ -94,6 +94,47 @@ Sets tag for authenticated decryption
 */
 PALEXPORT int32_t CryptoNative_EvpCipherSetCcmTag(EVP_CIPHER_CTX* ctx, uint8_t* tag, int32_t tagLength);
 
+/*
+Function:
+EvpAeadEncryptOneShot
+
+Encrypts a whole message with a GCM context created by EvpCipherCreate2 with a key and
+no IV, and retrieves the tag. The expanded key is kept, so the context can be used for
+any number of messages.
+
+Returns 1 on success, 0 on failure.
+*/
+PALEXPORT int32_t CryptoNative_EvpAeadEncryptOneShot(EVP_CIPHER_CTX* ctx,
+                                                     uint8_t* nonce,
+                                                     int32_t nonceLength,
+                                                     uint8_t* aad,
+                                                     int32_t aadLength,
+                                                     uint8_t* plaintext,
+                                                     int32_t plaintextLength,
+                                                     uint8_t* ciphertext,
+                                                     uint8_t* tag,
+                                                     int32_t tagLength);
+
+/*
+Function:
+EvpAeadDecryptOneShot
+
+Decrypts a whole message with a GCM context created by EvpCipherCreate2 with a key and
+no IV, and verifies the tag. The plaintext must not be used unless the call succeeds.
+
+Returns 1 on success, -1 if the tag does not match, 0 on other failures.
+*/
+PALEXPORT int32_t CryptoNative_EvpAeadDecryptOneShot(EVP_CIPHER_CTX* ctx,
+                                                     uint8_t* nonce,
+                                                     int32_t nonceLength,
+                                                     uint8_t* aad,
+                                                     int32_t aadLength,
+                                                     uint8_t* ciphertext,
+                                                     int32_t ciphertextLength,
+                                                     uint8_t* tag,
+                                                     int32_t tagLength,
+                                                     uint8_t* plaintext);
+
 /*
 Function:
 EvpAes128Ecb
@@ -130,3 +130,40 @@ int32_t CryptoNative_HmacCurrent(const HMAC_CTX* ctx, uint8_t* md, int32_t* len)
 
     return 0;
 }
+
+int32_t CryptoNative_HmacOneShot(const EVP_MD* md,
+                                 const uint8_t* key,
+                                 int32_t keyLen,
+                                 const uint8_t* data,
+                                 int32_t dataLen,
+                                 uint8_t* output,
+                                 int32_t* outputLen)
+{
+    assert(md != NULL);
+    assert(key != NULL || keyLen == 0);
+    assert(keyLen >= 0);
+    assert(data != NULL || dataLen == 0);
+    assert(dataLen >= 0);
+    assert(output != NULL);
+    assert(outputLen != NULL);
+
+    if (keyLen < 0 || dataLen < 0 || outputLen == NULL || *outputLen < EVP_MD_size(md))
+    {
+        return 0;
+    }
+
+    HMAC_CTX* ctx = CryptoNative_HmacCreate(key, keyLen, md);
+    if (ctx == NULL)
+    {
+        return 0;
+    }
+
+    int32_t ret = CryptoNative_HmacUpdate(ctx, data, dataLen);
+    if (ret == 1)
+    {
+        ret = CryptoNative_HmacFinal(ctx, output, outputLen);
+    }
+
+    HMAC_CTX_free(ctx);
+    return ret;
+}
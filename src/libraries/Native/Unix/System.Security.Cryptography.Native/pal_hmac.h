@@ -69,3 +69,19 @@ PALEXPORT int32_t CryptoNative_HmacFinal(HMAC_CTX* ctx, uint8_t* md, int32_t* le
  * Returns 1 for success or 0 for failure.
  */
 PALEXPORT int32_t CryptoNative_HmacCurrent(const HMAC_CTX* ctx, uint8_t* md, int32_t* len);
+
+/**
+ * Computes the HMAC of the data with the given key and EVP_MD in a single call.
+ *
+ * Implemented with a context that only lives for the call, see HmacCreate, HmacUpdate and HmacFinal.
+ * On input, len is the size of the md buffer; on output, the size of the HMAC.
+ *
+ * Returns 1 for success or 0 for failure.
+ */
+PALEXPORT int32_t CryptoNative_HmacOneShot(const EVP_MD* md,
+                                           const uint8_t* key,
+                                           int32_t keyLen,
+                                           const uint8_t* data,
+                                           int32_t dataLen,
+                                           uint8_t* output,
+                                           int32_t* outputLen);
@@ -384,12 +384,160 @@ void CryptoNative_SslSetBio(SSL* ssl, BIO* rbio, BIO* wbio)
     SSL_set_bio(ssl, rbio, wbio);
 }
 
+#ifndef SSL_OP_ENABLE_KTLS
+#define SSL_OP_ENABLE_KTLS 0x00000008U
+#endif
+#ifndef BIO_CTRL_GET_KTLS_SEND
+#define BIO_CTRL_GET_KTLS_SEND 73
+#endif
+#ifndef BIO_CTRL_GET_KTLS_RECV
+#define BIO_CTRL_GET_KTLS_RECV 76
+#endif
+
+int32_t CryptoNative_SslCtxEnableKtls(SSL_CTX* ctx)
+{
+    // Kernel TLS came with OpenSSL 3.0, which is also where SSL_sendfile was introduced.
+#ifdef NEED_OPENSSL_3_0
+    if (API_EXISTS(SSL_sendfile))
+    {
+        SSL_CTX_set_options(ctx, SSL_OP_ENABLE_KTLS);
+        return 1;
+    }
+#else
+    (void)ctx;
+#endif
+
+    return 0;
+}
+
+int32_t CryptoNative_SslSetSocket(SSL* ssl, intptr_t socket)
+{
+    BIO* bio = BIO_new_socket((int)socket, BIO_NOCLOSE);
+    if (bio == NULL)
+    {
+        return 0;
+    }
+
+    // SSL_set_bio takes one reference for each direction.
+    if (!BIO_up_ref(bio))
+    {
+        BIO_free(bio);
+        return 0;
+    }
+
+    SSL_set_bio(ssl, bio, bio);
+    return 1;
+}
+
+static int32_t SslGetKtls(BIO* bio, int cmd)
+{
+    return bio != NULL && BIO_ctrl(bio, cmd, 0, NULL) > 0 ? 1 : 0;
+}
+
+int32_t CryptoNative_SslGetKtlsSend(SSL* ssl)
+{
+    return SslGetKtls(SSL_get_wbio(ssl), BIO_CTRL_GET_KTLS_SEND);
+}
+
+int32_t CryptoNative_SslGetKtlsRecv(SSL* ssl)
+{
+    return SslGetKtls(SSL_get_rbio(ssl), BIO_CTRL_GET_KTLS_RECV);
+}
+
+int64_t CryptoNative_SslSendFile(SSL* ssl, intptr_t fd, int64_t offset, int64_t size)
+{
+#ifdef NEED_OPENSSL_3_0
+    if (API_EXISTS(SSL_sendfile) && size >= 0)
+    {
+        ERR_clear_error();
+        return (int64_t)SSL_sendfile(ssl, (int)fd, (off_t)offset, (size_t)size, 0);
+    }
+#else
+    (void)ssl, (void)fd, (void)offset, (void)size;
+#endif
+
+    return -1;
+}
+
 int32_t CryptoNative_SslDoHandshake(SSL* ssl)
 {
     ERR_clear_error();
     return SSL_do_handshake(ssl);
 }
 
+#ifndef SSL_MODE_ASYNC
+#define SSL_MODE_ASYNC 0x00000100U
+#endif
+
+int32_t CryptoNative_SslCtxSetAsyncMode(SSL_CTX* ctx)
+{
+    // The async job API came with OpenSSL 1.1.0.
+#if defined NEED_OPENSSL_1_1 || defined NEED_OPENSSL_3_0
+    if (API_EXISTS(SSL_get_all_async_fds) && API_EXISTS(SSL_waiting_for_async))
+    {
+        SSL_CTX_ctrl(ctx, SSL_CTRL_MODE, SSL_MODE_ASYNC, NULL);
+        return 1;
+    }
+#else
+    (void)ctx;
+#endif
+
+    return 0;
+}
+
+int32_t CryptoNative_SslWaitingForAsync(SSL* ssl)
+{
+#if defined NEED_OPENSSL_1_1 || defined NEED_OPENSSL_3_0
+    if (API_EXISTS(SSL_waiting_for_async))
+    {
+        return SSL_waiting_for_async(ssl) == 1;
+    }
+#else
+    (void)ssl;
+#endif
+
+    return 0;
+}
+
+int32_t CryptoNative_SslGetAsyncFds(SSL* ssl, int32_t* fds, int32_t* count)
+{
+    assert(count != NULL);
+
+    if (count == NULL || *count < 0)
+    {
+        return 0;
+    }
+
+#if defined NEED_OPENSSL_1_1 || defined NEED_OPENSSL_3_0
+    // The wait context is only created by the first paused operation.
+    if (API_EXISTS(SSL_get_all_async_fds) && CryptoNative_SslWaitingForAsync(ssl))
+    {
+        size_t numFds = 0;
+        if (!SSL_get_all_async_fds(ssl, NULL, &numFds))
+        {
+            return 0;
+        }
+
+        if (fds != NULL)
+        {
+            // OSSL_ASYNC_FD is an int on Unix.
+            if (numFds > (size_t)*count || !SSL_get_all_async_fds(ssl, fds, &numFds))
+            {
+                return 0;
+            }
+        }
+
+        *count = (int32_t)numFds;
+        return 1;
+    }
+#else
+    (void)ssl, (void)fds;
+#endif
+
+    *count = 0;
+    return 1;
+}
+
 int32_t CryptoNative_IsSslStateOK(SSL* ssl)
 {
     return SSL_is_init_finished(ssl);
@@ -108,6 +108,8 @@ typedef enum
     PAL_SSL_ERROR_WANT_WRITE = 3,
     PAL_SSL_ERROR_SYSCALL = 5,
     PAL_SSL_ERROR_ZERO_RETURN = 6,
+    PAL_SSL_ERROR_WANT_ASYNC = 9,
+    PAL_SSL_ERROR_WANT_ASYNC_JOB = 10,
 } SslErrorCode;
 
 // the function pointer definition for the callback used in SslCtxSetVerify
@@ -235,6 +237,40 @@ Shims the SSL_set_bio method.
 */
 PALEXPORT void CryptoNative_SslSetBio(SSL* ssl, BIO* rbio, BIO* wbio);
 
+/*
+Requests kernel TLS offload for connections created from the context (SSL_OP_ENABLE_KTLS).
+Offload only happens for connections that use a socket BIO, see SslSetSocket.
+
+Returns 1 if the loaded OpenSSL supports kernel TLS, otherwise 0 and the context is unchanged.
+*/
+PALEXPORT int32_t CryptoNative_SslCtxEnableKtls(SSL_CTX* ctx);
+
+/*
+Makes the connection read from and write to the socket directly through a socket BIO, instead of the
+memory BIOs set by SslSetBio. Must be called before the handshake. The socket is not closed with the SSL.
+
+Returns 1 on success, 0 on failure.
+*/
+PALEXPORT int32_t CryptoNative_SslSetSocket(SSL* ssl, intptr_t socket);
+
+/*
+Gets whether the record layer of the connection has been offloaded to the kernel. Once the handshake
+completed with send offload, data written to the socket with any system call, e.g. sendfile or splice,
+is encrypted by the kernel.
+
+Returns 1 if offloaded, otherwise 0.
+*/
+PALEXPORT int32_t CryptoNative_SslGetKtlsSend(SSL* ssl);
+PALEXPORT int32_t CryptoNative_SslGetKtlsRecv(SSL* ssl);
+
+/*
+Shims the SSL_sendfile method, sends size bytes of the file starting at offset through kernel TLS.
+
+Returns the number of bytes sent, or <= 0 on failure (see SslGetError); -1 with no queued error if
+SSL_sendfile is not available.
+*/
+PALEXPORT int64_t CryptoNative_SslSendFile(SSL* ssl, intptr_t fd, int64_t offset, int64_t size);
+
 /*
 Shims the SSL_do_handshake method.
 
@@ -246,6 +282,30 @@ and by the specifications of the TLS/SSL protocol;
 */
 PALEXPORT int32_t CryptoNative_SslDoHandshake(SSL* ssl);
 
+/*
+Enables asynchronous operations (SSL_MODE_ASYNC) for connections created from the context. When an
+engine or provider pauses a private key operation, SslDoHandshake, SslRead and SslWrite fail with
+PAL_SSL_ERROR_WANT_ASYNC and are called again once a descriptor from SslGetAsyncFds is readable.
+
+Returns 1 if the loaded OpenSSL supports asynchronous operations, otherwise 0 and the context is unchanged.
+*/
+PALEXPORT int32_t CryptoNative_SslCtxSetAsyncMode(SSL_CTX* ctx);
+
+/*
+Shims the SSL_waiting_for_async method.
+
+Returns 1 if an asynchronous operation of the connection is paused, otherwise 0.
+*/
+PALEXPORT int32_t CryptoNative_SslWaitingForAsync(SSL* ssl);
+
+/*
+Gets the descriptors that become readable when paused asynchronous operations of the connection can proceed.
+On input count is the capacity of fds; on output the number of descriptors, fds may be null to get the count.
+
+Returns 1 on success, 0 on failure.
+*/
+PALEXPORT int32_t CryptoNative_SslGetAsyncFds(SSL* ssl, int32_t* fds, int32_t* count);
+
 /*
 Gets a value indicating whether the SSL_state is SSL_ST_OK.
 
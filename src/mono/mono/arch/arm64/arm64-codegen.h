@@ -449,6 +449,8 @@ arm_encode_imm7 (int imm, int size)
 #define arm_strfpx(p, dt, xn, simm) arm_format_strfp_imm ((p), ARMSIZE_X, 0x0, (dt), (xn), (simm), 8)
 /* Store single */
 #define arm_strfpw(p, st, xn, simm) arm_format_strfp_imm ((p), ARMSIZE_W, 0x0, (st), (xn), (simm), 4)
+/* Store quad */
+#define arm_strfpq(p, qt, xn, simm) arm_format_strfp_imm ((p), ARMSIZE_B, 0x2, (qt), (xn), (simm), 16)
 
 /* C6.3.166 LDR (immediate, SIMD&FP) */
 #define arm_format_ldrfp_imm(p, size, opc, rt, rn, pimm, scale) arm_emit ((p), ((size) << 30) | (0xf << 26) | (0x1 << 24) | ((opc) << 22) | (arm_encode_pimm12 ((pimm), (scale)) << 10) | ((rn) << 5) | ((rt) << 0))
@@ -457,6 +459,8 @@ arm_encode_imm7 (int imm, int size)
 #define arm_ldrfpx(p, dt, xn, simm) arm_format_ldrfp_imm ((p), ARMSIZE_X, 0x1, dt, xn, simm, 8)
 /* Load single */
 #define arm_ldrfpw(p, dt, xn, simm) arm_format_ldrfp_imm ((p), ARMSIZE_W, 0x1, dt, xn, simm, 4)
+/* Load quad */
+#define arm_ldrfpq(p, qt, xn, simm) arm_format_ldrfp_imm ((p), ARMSIZE_B, 0x3, (qt), (xn), (simm), 16)
 
 /* Arithmetic (immediate) */
 static G_GNUC_UNUSED inline guint32
@@ -857,6 +861,33 @@ arm_encode_arith_imm (int imm, guint32 *shift)
 
 #define arm_mrs(p, rt, sysreg) arm_format_mrs ((p), (sysreg), (rt))
 
+/* AdvSIMD, all of these operate on the full 128 bit registers */
+
+/* Advanced SIMD three same */
+#define arm_format_neon_3same(p, q, u, size, opcode, rd, rn, rm) arm_emit ((p), ((q) << 30) | ((u) << 29) | (0xe << 24) | ((size) << 22) | (0x1 << 21) | ((rm) << 16) | ((opcode) << 11) | (0x1 << 10) | ((rn) << 5) | ((rd) << 0))
+
+/* ORR (vector, register) */
+#define arm_neon_orr(p, rd, rn, rm) arm_format_neon_3same ((p), 0x1, 0x0, 0x2, 0x3, (rd), (rn), (rm))
+/* MOV (vector), alias of ORR */
+#define arm_neon_mov(p, rd, rn) arm_neon_orr ((p), (rd), (rn), (rn))
+/* EOR (vector) */
+#define arm_neon_eor(p, rd, rn, rm) arm_format_neon_3same ((p), 0x1, 0x1, 0x0, 0x3, (rd), (rn), (rm))
+
+/* Advanced SIMD copy */
+#define arm_format_neon_copy(p, q, op, imm5, imm4, rd, rn) arm_emit ((p), ((q) << 30) | ((op) << 29) | (0x70 << 21) | ((imm5) << 16) | ((imm4) << 11) | (0x1 << 10) | ((rn) << 5) | ((rd) << 0))
+
+/* Encodes the element size (one of ARMSIZE_...) and the element index of the copy instructions */
+#define arm_neon_copy_imm5(size, index) ((0x1 << (size)) | ((index) << ((size) + 1)))
+
+/* DUP (element), vd.<size>[*] = vn.<size>[index] */
+#define arm_neon_dup_elem(p, size, rd, rn, index) arm_format_neon_copy ((p), 0x1, 0x0, arm_neon_copy_imm5 ((size), (index)), 0x0, (rd), (rn))
+/* DUP (general), vd.<size>[*] = rn */
+#define arm_neon_dup_gr(p, size, rd, rn) arm_format_neon_copy ((p), 0x1, 0x0, arm_neon_copy_imm5 ((size), 0), 0x1, (rd), (rn))
+/* INS (general), vd.<size>[index] = rn */
+#define arm_neon_ins_gr(p, size, rd, index, rn) arm_format_neon_copy ((p), 0x1, 0x0, arm_neon_copy_imm5 ((size), (index)), 0x3, (rd), (rn))
+/* INS (element), vd.<size>[dindex] = vn.<size>[sindex] */
+#define arm_neon_ins_elem(p, size, rd, dindex, rn, sindex) arm_format_neon_copy ((p), 0x1, 0x1, arm_neon_copy_imm5 ((size), (dindex)), ((sindex) << (size)), (rd), (rn))
+
 #ifdef MONO_ARCH_ILP32
 #define arm_strp arm_strw
 #define arm_ldrp arm_ldrw
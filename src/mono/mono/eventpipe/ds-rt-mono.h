@@ -176,6 +176,19 @@ ds_rt_generate_core_dump (DiagnosticsGenerateCoreDumpCommandPayload *payload)
 	return DS_IPC_E_NOTSUPPORTED;
 }
 
+/*
+* DiagnosticsProcess.
+*/
+
+static
+inline
+ds_ipc_result_t
+ds_rt_emit_jit_debug_info (void)
+{
+	// Mono has no gdb JIT interface support.
+	return DS_IPC_E_NOTSUPPORTED;
+}
+
 /*
  * DiagnosticsIpc.
  */
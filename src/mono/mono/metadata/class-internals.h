@@ -617,6 +617,7 @@ typedef struct {
 typedef struct {
 	gint32 initialized_class_count;
 	gint32 generic_vtable_count;
+	gint32 cached_generic_vtable_count;
 	gint32 used_class_count;
 	gint32 method_count;
 	gint32 class_vtable_size;
@@ -744,6 +745,8 @@ extern MonoStats mono_stats;
 
 typedef gboolean (*MonoGetCachedClassInfo) (MonoClass *klass, MonoCachedClassInfo *res);
 
+typedef gboolean (*MonoGetCachedVTable) (MonoClass *klass, MonoMethod **vtable, int vtable_size);
+
 typedef gboolean (*MonoGetClassFromName) (MonoImage *image, const char *name_space, const char *name, MonoClass **res);
 
 static inline gboolean
@@ -816,6 +819,9 @@ mono_runtime_create_delegate_trampoline (MonoClass *klass);
 void
 mono_install_get_cached_class_info (MonoGetCachedClassInfo func);
 
+void
+mono_install_get_cached_vtable (MonoGetCachedVTable func);
+
 void
 mono_install_get_class_from_name (MonoGetClassFromName func);
 
@@ -1456,6 +1462,8 @@ mono_class_set_type_load_failure_causedby_class (MonoClass *klass, const MonoCla
 
 gboolean mono_class_get_cached_class_info (MonoClass *klass, MonoCachedClassInfo *res);
 
+gboolean mono_class_get_cached_vtable (MonoClass *klass, MonoMethod **vtable, int vtable_size);
+
 MonoMethod* mono_find_method_in_metadata (MonoClass *klass, const char *name, int param_count, int flags);
 
 int
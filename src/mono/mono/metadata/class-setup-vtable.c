@@ -816,6 +816,9 @@ mono_class_setup_vtable (MonoClass *klass)
 	mono_class_setup_vtable_full (klass, NULL);
 }
 
+static gboolean
+setup_vtable_from_cache (MonoClass *klass, GList *in_setup);
+
 static void
 mono_class_setup_vtable_full (MonoClass *klass, GList *in_setup)
 {
@@ -864,6 +867,10 @@ mono_class_setup_vtable_full (MonoClass *klass, GList *in_setup)
 		type_token = klass->type_token;
 	}
 
+	/* AOT case, the vtable was computed at compile time */
+	if (!mono_class_is_ginst (klass) && !image_is_dynamic (klass->image) && setup_vtable_from_cache (klass, in_setup))
+		goto done;
+
 	if (image_is_dynamic (klass->image)) {
 		/* Generic instances can have zero method overrides without causing any harm.
 		 * This is true since we don't do layout all over again for them, we simply inflate
@@ -1620,6 +1627,70 @@ check_vtable_covariant_override_impls (MonoClass *klass, MonoMethod **vtable, in
 }
 #endif /* FEATURE_COVARIANT_RETURNS */
 
+/*
+ * Set klass->vtable to a copy of VTABLE, sharing the vtable of the parent class if they are equal.
+ */
+static void
+publish_vtable (MonoClass *klass, MonoMethod **vtable)
+{
+	if (klass->parent && (klass->parent->vtable_size == klass->vtable_size) && (memcmp (klass->parent->vtable, vtable, sizeof (gpointer) * klass->vtable_size) == 0)) {
+		mono_memory_barrier ();
+		klass->vtable = klass->parent->vtable;
+	} else {
+		MonoMethod **tmp = (MonoMethod **)mono_class_alloc0 (klass, sizeof (gpointer) * klass->vtable_size);
+		memcpy (tmp, vtable,  sizeof (gpointer) * klass->vtable_size);
+		mono_memory_barrier ();
+		klass->vtable = tmp;
+	}
+}
+
+/*
+ * setup_vtable_from_cache:
+ *
+ *   Create the generic vtable of KLASS from the copy saved by the AOT compiler. This avoids
+ * loading the method overrides and matching interface methods in mono_class_setup_vtable_general ().
+ * Return FALSE if there is no saved vtable, the caller should compute it in that case.
+ *
+ * LOCKING: this is supposed to be called with the loader lock held.
+ */
+static gboolean
+setup_vtable_from_cache (MonoClass *klass, GList *in_setup)
+{
+	ERROR_DECL (error);
+	MonoCachedClassInfo cached_info;
+	MonoMethod **vtable;
+	int cur_slot = 0, stelemref_slot = 0;
+
+	if (!mono_class_get_cached_class_info (klass, &cached_info))
+		return FALSE;
+
+	/* These need to run anyway, they set up the parent vtable and the interface offsets */
+	if (setup_class_vtsize (klass, in_setup, &cur_slot, &stelemref_slot, error) == -1)
+		return TRUE;
+	cur_slot = mono_class_setup_interface_offsets_internal (klass, cur_slot, TRUE);
+	if (cur_slot == -1)
+		return TRUE;
+
+	if (klass->vtable_size && klass->vtable_size != cached_info.vtable_size)
+		return FALSE;
+
+	vtable = (MonoMethod **)g_malloc0 (sizeof (gpointer) * cached_info.vtable_size);
+	if (!mono_class_get_cached_vtable (klass, vtable, cached_info.vtable_size)) {
+		g_free (vtable);
+		return FALSE;
+	}
+
+	UnlockedIncrement (&mono_stats.cached_generic_vtable_count);
+	klass->vtable_size = cached_info.vtable_size;
+	publish_vtable (klass, vtable);
+
+	if (mono_print_vtable)
+		print_vtable_layout_result (klass, vtable, klass->vtable_size);
+
+	g_free (vtable);
+	return TRUE;
+}
+
 /*
  * LOCKING: this is supposed to be called with the loader lock held.
  */
@@ -2103,15 +2174,7 @@ mono_class_setup_vtable_general (MonoClass *klass, MonoMethod **overrides, int o
 	}
 
 	/* Try to share the vtable with our parent. */
-	if (klass->parent && (klass->parent->vtable_size == klass->vtable_size) && (memcmp (klass->parent->vtable, vtable, sizeof (gpointer) * klass->vtable_size) == 0)) {
-		mono_memory_barrier ();
-		klass->vtable = klass->parent->vtable;
-	} else {
-		MonoMethod **tmp = (MonoMethod **)mono_class_alloc0 (klass, sizeof (gpointer) * klass->vtable_size);
-		memcpy (tmp, vtable,  sizeof (gpointer) * klass->vtable_size);
-		mono_memory_barrier ();
-		klass->vtable = tmp;
-	}
+	publish_vtable (klass, vtable);
 
 	DEBUG_INTERFACE_VTABLE (print_vtable_full (klass, klass->vtable, klass->vtable_size, first_non_interface_slot, "FINALLY", FALSE));
 	if (mono_print_vtable)
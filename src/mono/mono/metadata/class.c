@@ -4710,6 +4710,23 @@ mono_class_get_cached_class_info (MonoClass *klass, MonoCachedClassInfo *res)
 		return get_cached_class_info (klass, res);
 }
 
+static MonoGetCachedVTable get_cached_vtable = NULL;
+
+void
+mono_install_get_cached_vtable (MonoGetCachedVTable func)
+{
+	get_cached_vtable = func;
+}
+
+gboolean
+mono_class_get_cached_vtable (MonoClass *klass, MonoMethod **vtable, int vtable_size)
+{
+	if (!get_cached_vtable)
+		return FALSE;
+	else
+		return get_cached_vtable (klass, vtable, vtable_size);
+}
+
 void
 mono_install_get_class_from_name (MonoGetClassFromName func)
 {
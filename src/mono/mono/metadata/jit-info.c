@@ -52,6 +52,7 @@ static MonoJitInfoTable * volatile aot_modules;
 static GSList *jit_info_free_queue;
 static int num_jit_info_table_duplicates;
 static mono_mutex_t jit_info_mutex;
+static gint32 jit_info_lock_contended;
 
 #define JIT_INFO_TABLE_FILL_RATIO_NOM		3
 #define JIT_INFO_TABLE_FILL_RATIO_DENOM		4
@@ -69,7 +70,11 @@ static mono_mutex_t jit_info_mutex;
 static inline void
 jit_info_lock (void)
 {
-	mono_os_mutex_lock (&jit_info_mutex);
+	/* Readers never take the lock, so this only measures writers racing each other */
+	if (G_UNLIKELY (mono_os_mutex_trylock (&jit_info_mutex) != 0)) {
+		mono_atomic_inc_i32 (&jit_info_lock_contended);
+		mono_os_mutex_lock (&jit_info_mutex);
+	}
 }
 
 static inline void
@@ -98,6 +103,7 @@ mono_jit_info_tables_init (void)
 {
 	jit_info_table = mono_jit_info_table_new ();
 	mono_os_mutex_init_recursive (&jit_info_mutex);
+	mono_counters_register ("JIT info table lock contended", MONO_COUNTER_INT|MONO_COUNTER_JIT, &jit_info_lock_contended);
 }
 
 MonoJitInfoTable *
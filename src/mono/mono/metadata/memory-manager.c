@@ -3,6 +3,7 @@
 #include <mono/metadata/reflection-cache.h>
 #include <mono/metadata/mono-hash-internals.h>
 #include <mono/metadata/debug-internals.h>
+#include <mono/metadata/mempool-internals.h>
 #include <mono/utils/unlocked.h>
 
 static LockFreeMempool*
@@ -104,7 +105,14 @@ mono_mem_manager_new (MonoAssemblyLoadContext **alcs, int nalcs, gboolean collec
 	mono_coop_mutex_init_recursive (&memory_manager->lock);
 	mono_os_mutex_init (&memory_manager->mp_mutex);
 
-	memory_manager->_mp = mono_mempool_new ();
+	/*
+	 * Give each ALC's own memory manager, and every collectible one, a private arena, so class
+	 * loading in different ALCs doesn't serialize on malloc and unloading frees in bulk.
+	 */
+	if (collectible || nalcs == 1)
+		memory_manager->_mp = mono_mempool_new_private_arena ();
+	else
+		memory_manager->_mp = mono_mempool_new ();
 	memory_manager->code_mp = mono_code_manager_new ();
 	memory_manager->lock_free_mp = lock_free_mempool_new ();
 
@@ -75,6 +75,9 @@ g_list_append_mempool (MonoMemPool *mp, GList *list, gpointer data)
 	return list ? list : new_list;
 }
 
+MonoMemPool *
+mono_mempool_new_private_arena (void);
+
 char*
 mono_mempool_strdup_vprintf (MonoMemPool *pool, const char *format, va_list args);
 
@@ -21,6 +21,7 @@
 #include "mempool.h"
 #include "mempool-internals.h"
 #include "utils/unlocked.h"
+#include "utils/mono-jemalloc.h"
 
 /*
  * MonoMemPool is for fast allocation of memory. We free
@@ -76,28 +77,27 @@ struct _MonoMemPool {
 		// Used in "initial block" only: Number of bytes so far allocated (whether used or not) in the whole mempool
 		guint32 allocated;
 	} d;
+
+#ifdef MONO_JEMALLOC_ENABLED
+	// Used in "initial block" only: jemalloc arena all blocks are allocated from, or 0 to use g_malloc
+	guint arena;
+#endif
 };
 
 static gint64 total_bytes_allocated = 0;
 
-/**
- * mono_mempool_new:
- *
- * Returns: a new memory pool.
- */
-MonoMemPool *
-mono_mempool_new (void)
+static MonoMemPool *
+mempool_block_alloc (guint arena, guint size)
 {
-	return mono_mempool_new_size (MONO_MEMPOOL_PAGESIZE);
+#ifdef MONO_JEMALLOC_ENABLED
+	if (arena)
+		return (MonoMemPool *)mono_jemalloc_arena_malloc (arena, size);
+#endif
+	return (MonoMemPool *)g_malloc (size);
 }
 
-/**
- * mono_mempool_new_size:
- * \param initial_size the amount of memory to initially reserve for the memory pool.
- * \returns a new memory pool with a specific initial memory reservation.
- */
-MonoMemPool *
-mono_mempool_new_size (int initial_size)
+static MonoMemPool *
+mempool_new (int initial_size, guint arena)
 {
 	MonoMemPool *pool;
 
@@ -109,16 +109,69 @@ mono_mempool_new_size (int initial_size)
 		initial_size = MONO_MEMPOOL_MINSIZE;
 #endif
 
-	pool = (MonoMemPool *)g_malloc (initial_size);
+	pool = mempool_block_alloc (arena, initial_size);
 
 	pool->next = NULL;
 	pool->pos = (guint8*)pool + SIZEOF_MEM_POOL; // Start after header
 	pool->end = (guint8*)pool + initial_size;    // End at end of allocated space 
 	pool->d.allocated = pool->size = initial_size;
+#ifdef MONO_JEMALLOC_ENABLED
+	pool->arena = arena;
+#endif
 	UnlockedAdd64 (&total_bytes_allocated, initial_size);
 	return pool;
 }
 
+static guint
+mempool_get_arena (MonoMemPool *pool)
+{
+#ifdef MONO_JEMALLOC_ENABLED
+	return pool->arena;
+#else
+	return 0;
+#endif
+}
+
+/**
+ * mono_mempool_new:
+ *
+ * Returns: a new memory pool.
+ */
+MonoMemPool *
+mono_mempool_new (void)
+{
+	return mono_mempool_new_size (MONO_MEMPOOL_PAGESIZE);
+}
+
+/**
+ * mono_mempool_new_size:
+ * \param initial_size the amount of memory to initially reserve for the memory pool.
+ * \returns a new memory pool with a specific initial memory reservation.
+ */
+MonoMemPool *
+mono_mempool_new_size (int initial_size)
+{
+	return mempool_new (initial_size, 0);
+}
+
+/**
+ * mono_mempool_new_private_arena:
+ *
+ * Same as \c mono_mempool_new, but when jemalloc is in use the pool's blocks come from an
+ * arena of its own.  Threads filling different pools then don't contend on the allocator,
+ * and destroying the pool releases the whole arena at once.
+ */
+MonoMemPool *
+mono_mempool_new_private_arena (void)
+{
+	guint arena = 0;
+
+#ifdef MONO_JEMALLOC_ENABLED
+	arena = mono_jemalloc_arena_new ();
+#endif
+	return mempool_new (MONO_MEMPOOL_PAGESIZE, arena);
+}
+
 /**
  * mono_mempool_destroy:
  * \param pool the memory pool to destroy
@@ -132,6 +185,13 @@ mono_mempool_destroy (MonoMemPool *pool)
 
 	UnlockedSubtract64 (&total_bytes_allocated, pool->d.allocated);
 
+#ifdef MONO_JEMALLOC_ENABLED
+	if (pool->arena) {
+		mono_jemalloc_arena_destroy (pool->arena);
+		return;
+	}
+#endif
+
 	p = pool;
 	while (p) {
 		n = p->next;
@@ -282,7 +342,7 @@ gpointer
 		// (In individual allocation mode, the constant will be 0 and this path will always be taken)
 		if (size >= MONO_MEMPOOL_PREFER_INDIVIDUAL_ALLOCATION_SIZE) {
 			guint new_size = SIZEOF_MEM_POOL + size;
-			MonoMemPool *np = (MonoMemPool *)g_malloc (new_size);
+			MonoMemPool *np = mempool_block_alloc (mempool_get_arena (pool), new_size);
 
 			np->next = pool->next;
 			np->size = new_size;
@@ -294,7 +354,7 @@ gpointer
 		} else {
 			// Notice: any unused memory at the end of the old head becomes simply abandoned in this case until the mempool is freed (see Bugzilla #35136)
 			guint new_size = get_next_size (pool, size);
-			MonoMemPool *np = (MonoMemPool *)g_malloc (new_size);
+			MonoMemPool *np = mempool_block_alloc (mempool_get_arena (pool), new_size);
 
 			np->next = pool->next;
 			np->size = new_size;
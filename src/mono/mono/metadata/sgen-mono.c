@@ -1063,6 +1063,7 @@ mono_gc_get_managed_allocator (MonoClass *klass, gboolean for_box, gboolean know
 #ifdef MANAGED_ALLOCATION
 	ManagedAllocatorVariant variant = mono_profiler_allocations_enabled () ?
 		MANAGED_ALLOCATOR_PROFILER : MANAGED_ALLOCATOR_REGULAR;
+	MonoVTable *vtable;
 
 	if (sgen_collect_before_allocs)
 		return NULL;
@@ -1074,6 +1075,10 @@ mono_gc_get_managed_allocator (MonoClass *klass, gboolean for_box, gboolean know
 		return NULL;
 	if (m_class_get_rank (klass))
 		return NULL;
+	/* Let sgen_alloc_obj () send these to pinned space. */
+	vtable = mono_class_try_get_vtable (klass);
+	if (vtable && sgen_pinned_alloc_wanted (vtable, m_class_get_instance_size (klass)))
+		return NULL;
 	if (m_class_get_byval_arg (klass)->type == MONO_TYPE_STRING)
 		return mono_gc_get_managed_allocator_by_type (ATYPE_STRING, variant);
 	/* Generic classes have dynamic field and can go above MAX_SMALL_OBJ_SIZE. */
@@ -1323,6 +1328,14 @@ mono_gc_alloc_vector (MonoVTable *vtable, size_t size, uintptr_t max_length)
 	if (!SGEN_CAN_ALIGN_UP (size))
 		return NULL;
 
+	if (G_UNLIKELY (sgen_pinned_alloc_wanted (vtable, size))) {
+		arr = (MonoArray*)sgen_alloc_obj_pinned (vtable, size);
+		if (G_UNLIKELY (!arr))
+			return NULL;
+		arr->max_length = (mono_array_size_t)max_length;
+		goto done;
+	}
+
 #ifndef DISABLE_CRITICAL_REGION
 	ENTER_CRITICAL_REGION;
 	arr = (MonoArray*)sgen_try_alloc_obj_nolock (vtable, size);
@@ -2299,10 +2312,15 @@ extern gboolean mono_wasm_enable_gc;
 
 /*
  * Mark from thread stacks and registers.
+ *
+ * The threads are split into JOB_SPLIT_COUNT sets and only the JOB_INDEX-th one is
+ * scanned, so parallel collections can scan stacks on several workers.
  */
 void
-sgen_client_scan_thread_data (void *start_nursery, void *end_nursery, gboolean precise, ScanCopyContext ctx)
+sgen_client_scan_thread_data (void *start_nursery, void *end_nursery, gboolean precise, int job_index, int job_split_count, ScanCopyContext ctx)
 {
+	int thread_index = 0;
+
 	scan_area_arg_start = start_nursery;
 	scan_area_arg_end = end_nursery;
 #ifdef HOST_WASM
@@ -2316,14 +2334,21 @@ sgen_client_scan_thread_data (void *start_nursery, void *end_nursery, gboolean p
 
 	SGEN_TV_GETTIME (scan_thread_data_start);
 
-	if (gc_callbacks.interp_mark_func)
-		/* The interpreter code uses only compiler write barriers so have to synchronize with it */
+	/*
+	 * The interpreter code uses only compiler write barriers so have to synchronize with it.
+	 * The conservative pass already issued one in this pause, so when the precise scan is
+	 * split only the first job repeats it.
+	 */
+	if (gc_callbacks.interp_mark_func && job_index == 0)
 		mono_memory_barrier_process_wide ();
 
 	FOREACH_THREAD_EXCLUDE (info, MONO_THREAD_INFO_FLAGS_NO_GC) {
 		int skip_reason = 0;
 		void *aligned_stack_start;
 
+		if ((thread_index++ % job_split_count) != job_index)
+			continue;
+
 		if (info->client_info.skip) {
 			SGEN_LOG (3, "Skipping dead thread %p, range: %p-%p, size: %" G_GSIZE_FORMAT "d", info, info->client_info.stack_start, info->client_info.info.stack_end, (char*)info->client_info.info.stack_end - (char*)info->client_info.stack_start);
 			skip_reason = 1;
@@ -2935,6 +2960,18 @@ sgen_client_vtable_get_name (MonoVTable *vt)
 	return m_class_get_name (vt->klass);
 }
 
+gboolean
+sgen_client_vtable_is_pinned_alloc (MonoVTable *vt)
+{
+	return (vt->gc_bits & SGEN_GC_BIT_PINNED_ALLOC) == SGEN_GC_BIT_PINNED_ALLOC;
+}
+
+void
+sgen_client_vtable_set_pinned_alloc (MonoVTable *vt)
+{
+	vt->gc_bits |= SGEN_GC_BIT_PINNED_ALLOC;
+}
+
 /*
  * Initialization
  */
@@ -138,9 +138,9 @@ typedef struct _ScanData {
 	mword lock_word;
 
 	ColorData *color;
-	// If this object isn't the scc root, we still need to store the xref colors on it, after computing
-	// low index, so we can add them to the scc that this object is part of.
-	DynPtrArray xrefs;
+	// Size of pending_xrefs when this object was first scanned. When this object turns out to be an scc
+	// root, everything pushed to pending_xrefs since then belongs to its scc.
+	int xref_mark;
 
 	// Tarjan algorithm index (order visited)
 	int index;
@@ -181,6 +181,11 @@ color_visible_to_client (ColorData *data) {
 // and loop_stack is the stack structure used by the algorithm itself.
 static DynPtrArray scan_stack, loop_stack;
 
+// Xref colors of finished objects that aren't scc roots, waiting for the root of their scc to finish.
+// Every object finishing between the time an scc root is first scanned and the time it finishes is
+// either an scc root itself, or a member of that root's scc, so one shared stack is enough.
+static DynPtrArray pending_xrefs;
+
 // GCObjects on which register_finalized_object has been called
 static DynPtrArray registered_bridges;
 
@@ -563,15 +568,19 @@ find_in_cache (int *insert_index)
 }
 
 // Populate other_colors for a give color (other_colors represent the xrefs for this color)
+static void
+add_other_color (ColorData *color, ColorData *points_to)
+{
+	dyn_array_ptr_add (&color->other_colors, points_to);
+	// Inform targets
+	points_to->incoming_colors = MIN (points_to->incoming_colors + 1, INCOMING_COLORS_MAX);
+}
+
 static void
 add_other_colors (ColorData *color, DynPtrArray *other_colors)
 {
-	for (int i = 0; i < dyn_array_ptr_size (other_colors); ++i) {
-		ColorData *points_to = (ColorData *)dyn_array_ptr_get (other_colors, i);
-		dyn_array_ptr_add (&color->other_colors, points_to);
-		// Inform targets
-		points_to->incoming_colors = MIN (points_to->incoming_colors + 1, INCOMING_COLORS_MAX);
-	}
+	for (int i = 0; i < dyn_array_ptr_size (other_colors); ++i)
+		add_other_color (color, (ColorData *)dyn_array_ptr_get (other_colors, i));
 }
 
 // A color is needed for an SCC. If the SCC has bridges, the color MUST be newly allocated.
@@ -820,12 +829,6 @@ create_scc (ScanData *data)
 		if (other->is_bridge)
 			dyn_array_ptr_add (&color_data->bridges, other->obj);
 
-		// Maybe we should make sure we are not adding duplicates here. It is not really a problem
-		// since we will get rid of duplicates before submitting the SCCs to the client in gather_xrefs
-		if (color_data)
-			add_other_colors (color_data, &other->xrefs);
-		dyn_array_ptr_uninit (&other->xrefs);
-
 		if (other == data) {
 			found = TRUE;
 			break;
@@ -833,6 +836,15 @@ create_scc (ScanData *data)
 	}
 	g_assert (found);
 
+	// Collect the xrefs of the other members of the scc.
+	// Maybe we should make sure we are not adding duplicates here. It is not really a problem
+	// since we will get rid of duplicates before submitting the SCCs to the client in gather_xrefs
+	while (dyn_array_ptr_size (&pending_xrefs) > data->xref_mark) {
+		ColorData *points_to = (ColorData *)dyn_array_ptr_pop (&pending_xrefs);
+		if (color_data)
+			add_other_color (color_data, points_to);
+	}
+
 #if DUMP_GRAPH
 	printf ("\tpoints-to-colors: ");
 	for (int i = 0; i < dyn_array_ptr_size (&color_data->other_colors); i++)
@@ -846,6 +858,7 @@ dfs (void)
 {
 	g_assert (dyn_array_ptr_size (&scan_stack) == 1);
 	g_assert (dyn_array_ptr_size (&loop_stack) == 0);
+	g_assert (dyn_array_ptr_size (&pending_xrefs) == 0);
 
 	color_merge_array_empty ();
 
@@ -875,6 +888,7 @@ dfs (void)
 
 			data->state = SCANNED;
 			data->low_index = data->index = object_index++;
+			data->xref_mark = dyn_array_ptr_size (&pending_xrefs);
 			dyn_array_ptr_push (&scan_stack, data);
 			dyn_array_ptr_push (&loop_stack, data);
 
@@ -898,10 +912,10 @@ dfs (void)
 			if (data->index == data->low_index) {
 				create_scc (data);
 			} else {
-				// We need to clear colo_merge_array from all xrefs. We flush them to the current color
+				// We need to clear colo_merge_array from all xrefs. We flush them to pending_xrefs
 				// and will add them to the scc when we reach the root of the scc.
-				g_assert (dyn_array_ptr_size (&data->xrefs) == 0);
-				dyn_array_ptr_set_all (&data->xrefs, &color_merge_array);
+				for (int i = 0; i < dyn_array_ptr_size (&color_merge_array); i++)
+					dyn_array_ptr_push (&pending_xrefs, dyn_array_ptr_get (&color_merge_array, i));
 			}
 			// We populated color_merge_array while scanning the object with each neighbor color. Clear it now
 			for (int i = 0; i < dyn_array_ptr_size (&color_merge_array); i++) {
@@ -932,6 +946,7 @@ cleanup (void)
 {
 	dyn_array_ptr_empty (&scan_stack);
 	dyn_array_ptr_empty (&loop_stack);
+	dyn_array_ptr_empty (&pending_xrefs);
 	dyn_array_ptr_empty (&registered_bridges);
 	free_object_buckets ();
 	free_color_buckets ();
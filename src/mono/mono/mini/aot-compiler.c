@@ -243,6 +243,7 @@ typedef struct MonoAotOptions {
 	gboolean use_current_cpu;
 	gboolean dump_json;
 	gboolean profile_only;
+	gboolean profile_order;
 	gboolean no_opt;
 	char *clangxx;
 	char *depfile;
@@ -7382,6 +7383,31 @@ emit_klass_info (MonoAotCompile *acfg, guint32 token)
 			else
 				encode_value (0, p, &p);
 		}
+
+		/*
+		 * Emit the slots of the virtual methods declared by the class, this together with the
+		 * vtable above allows the runtime to create the generic vtable without resolving overrides.
+		 * 0 means the runtime has to compute the vtable itself.
+		 */
+		gboolean can_cache_slots = !m_class_has_dim_conflicts (klass);
+		int nvirt = 0;
+		MonoMethod *cm;
+
+		iter = NULL;
+		while ((cm = mono_class_get_virtual_methods (klass, &iter))) {
+			/* The covariant return checks of subclasses depend on this flag */
+			if (mono_method_get_is_covariant_override_impl (cm))
+				can_cache_slots = FALSE;
+			nvirt ++;
+		}
+		if (can_cache_slots) {
+			encode_value (nvirt + 1, p, &p);
+			iter = NULL;
+			while ((cm = mono_class_get_virtual_methods (klass, &iter)))
+				encode_value (cm->slot, p, &p);
+		} else {
+			encode_value (0, p, &p);
+		}
 	}
 
 	acfg->stats.class_info_size += p - buf;
@@ -8380,6 +8406,8 @@ mono_aot_parse_options (const char *aot_options, MonoAotOptions *opts)
 			opts->profile_files = g_list_append (opts->profile_files, g_strdup (arg + strlen ("profile=")));
 		} else if (!strcmp (arg, "profile-only")) {
 			opts->profile_only = TRUE;
+		} else if (!strcmp (arg, "profile-order")) {
+			opts->profile_order = TRUE;
 		} else if (!strcmp (arg, "verbose")) {
 			opts->verbose = TRUE;
 		} else if (str_begins_with (arg, "llvmopts=")){
@@ -8454,6 +8482,7 @@ mono_aot_parse_options (const char *aot_options, MonoAotOptions *opts)
 			printf ("    outfile=\n");
 			printf ("    profile=\n");
 			printf ("    profile-only\n");
+			printf ("    profile-order\n");
 			printf ("    print-skipped-methods\n");
 			printf ("    readonly-value=\n");
 			printf ("    save-temps\n");
@@ -13042,6 +13071,84 @@ add_profile_instances (MonoAotCompile *acfg, ProfileData *data)
 	printf ("Added %d methods from profile.\n", count);
 }
 
+typedef struct {
+	guint32 method_index;
+	int rank;
+	int order;
+} MethodOrderEntry;
+
+static int
+compare_method_order (const void *a, const void *b)
+{
+	const MethodOrderEntry *e1 = (const MethodOrderEntry*)a;
+	const MethodOrderEntry *e2 = (const MethodOrderEntry*)b;
+
+	if (e1->rank != e2->rank)
+		return e1->rank < e2->rank ? -1 : 1;
+	return e1->order - e2->order;
+}
+
+/*
+ * order_methods_by_profile:
+ *
+ *   Reorder acfg->method_order so the methods found in the profiles are emitted first, in the
+ * order they were first called, followed by all the other methods in their original order.
+ * This packs the code executed during startup into as few pages as possible.
+ */
+static void
+order_methods_by_profile (MonoAotCompile *acfg)
+{
+	GHashTable *ranks = g_hash_table_new (NULL, NULL);
+	GList *l;
+	int base = 0;
+
+	for (l = acfg->profile_data; l; l = l->next) {
+		ProfileData *data = (ProfileData*)l->data;
+		GHashTableIter iter;
+		gpointer key, value;
+		int max_id = 0;
+
+		g_hash_table_iter_init (&iter, data->methods);
+		while (g_hash_table_iter_next (&iter, &key, &value)) {
+			MethodProfileData *mdata = (MethodProfileData*)value;
+
+			if (!mdata->method)
+				continue;
+			/* The aot profiler records methods as they are JITted, so ids follow the first call order */
+			int rank = base + mdata->id + 1;
+			int prev_rank = GPOINTER_TO_INT (g_hash_table_lookup (ranks, mdata->method));
+			if (!prev_rank || rank < prev_rank)
+				g_hash_table_insert (ranks, mdata->method, GINT_TO_POINTER (rank));
+			max_id = MAX (max_id, mdata->id);
+		}
+		base += max_id + 1;
+	}
+
+	int len = acfg->method_order->len;
+	int nhot = 0;
+	MethodOrderEntry *entries = g_new0 (MethodOrderEntry, len);
+	for (int i = 0; i < len; ++i) {
+		guint32 index = GPOINTER_TO_UINT (g_ptr_array_index (acfg->method_order, i));
+		MonoCompile *cfg = acfg->cfgs [index];
+		int rank = cfg ? GPOINTER_TO_INT (g_hash_table_lookup (ranks, cfg->orig_method)) : 0;
+
+		entries [i].method_index = index;
+		entries [i].rank = rank ? rank : G_MAXINT32;
+		entries [i].order = i;
+		if (rank)
+			nhot ++;
+	}
+	qsort (entries, len, sizeof (MethodOrderEntry), compare_method_order);
+	for (int i = 0; i < len; ++i)
+		g_ptr_array_index (acfg->method_order, i) = GUINT_TO_POINTER (entries [i].method_index);
+
+	if (acfg->aot_opts.verbose)
+		printf ("Ordered %d methods from profile ahead of %d others.\n", nhot, len - nhot);
+
+	g_free (entries);
+	g_hash_table_destroy (ranks);
+}
+
 static void
 init_got_info (GotInfo *info)
 {
@@ -14304,6 +14411,9 @@ emit_aot_image (MonoAotCompile *acfg)
 	if (acfg->aot_opts.dedup)
 		mono_flush_method_cache (acfg);
 
+	if (acfg->aot_opts.profile_order && acfg->profile_data)
+		order_methods_by_profile (acfg);
+
 	emit_code (acfg);
 
 	emit_method_info_table (acfg);
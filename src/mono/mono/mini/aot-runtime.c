@@ -2504,6 +2504,81 @@ mono_aot_get_cached_class_info (MonoClass *klass, MonoCachedClassInfo *res)
 	return TRUE;
 }
 
+/*
+ * mono_aot_get_cached_vtable:
+ *
+ *   Fill in VTABLE with the generic vtable of KLASS saved by the AOT compiler, and set the
+ * slot of the virtual methods declared by KLASS. The AOT image is only loaded if the GUID of
+ * its assembly and of its dependencies match, so the saved layout is the one the runtime
+ * would compute.
+ * Return FALSE if there is no usable vtable, the methods of KLASS are not modified in that case.
+ */
+gboolean
+mono_aot_get_cached_vtable (MonoClass *klass, MonoMethod **vtable, int vtable_size)
+{
+	ERROR_DECL (error);
+	MonoAotModule *amodule = m_class_get_image (klass)->aot_module;
+	MonoCachedClassInfo class_info;
+	MonoMethod *cm;
+	MethodRef ref;
+	gpointer iter;
+	guint8 *p;
+	int i, nvirt;
+	int *slots;
+
+	if (m_class_get_rank (klass) || !m_class_get_type_token (klass) || !amodule)
+		return FALSE;
+
+	p = (guint8*)&amodule->blob [mono_aot_get_offset (amodule->class_info_offsets, mono_metadata_token_index (m_class_get_type_token (klass)) - 1)];
+
+	if (!decode_cached_class_info (amodule, &class_info, p, &p))
+		return FALSE;
+	if (class_info.vtable_size != vtable_size)
+		return FALSE;
+
+	for (i = 0; i < vtable_size; ++i) {
+		if (!decode_method_ref (amodule, &ref, p, &p, error)) {
+			mono_error_cleanup (error);
+			return FALSE;
+		}
+		if (ref.method) {
+			vtable [i] = ref.method;
+		} else if (mono_metadata_token_index (ref.token) == 0) {
+			vtable [i] = NULL;
+		} else {
+			vtable [i] = mono_get_method_checked (ref.image, ref.token, NULL, NULL, error);
+			if (!vtable [i]) {
+				mono_error_cleanup (error);
+				return FALSE;
+			}
+		}
+	}
+
+	nvirt = decode_value (p, &p);
+	if (nvirt == 0)
+		return FALSE;
+	nvirt --;
+
+	i = 0;
+	iter = NULL;
+	while ((cm = mono_class_get_virtual_methods (klass, &iter)))
+		i ++;
+	if (i != nvirt || mono_class_has_failure (klass))
+		return FALSE;
+
+	slots = g_new (int, nvirt);
+	for (i = 0; i < nvirt; ++i)
+		slots [i] = decode_value (p, &p);
+
+	i = 0;
+	iter = NULL;
+	while ((cm = mono_class_get_virtual_methods (klass, &iter)))
+		cm->slot = slots [i ++];
+	g_free (slots);
+
+	return TRUE;
+}
+
 /**
  * mono_aot_get_class_from_name:
  *
@@ -6228,6 +6303,12 @@ mono_aot_get_cached_class_info (MonoClass *klass, MonoCachedClassInfo *res)
 	return FALSE;
 }
 
+gboolean
+mono_aot_get_cached_vtable (MonoClass *klass, MonoMethod **vtable, int vtable_size)
+{
+	return FALSE;
+}
+
 gboolean
 mono_aot_get_class_from_name (MonoImage *image, const char *name_space, const char *name, MonoClass **klass)
 {
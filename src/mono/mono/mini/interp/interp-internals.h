@@ -133,6 +133,10 @@ struct InterpMethod {
 	unsigned int hasthis; // boolean
 	MonoProfilerCallInstrumentationFlags prof_flags;
 	InterpMethodCodeType code_type;
+	/* Calls plus backward branches, see INTERP_JIT_TIER_THRESHOLD */
+	guint32 hotness;
+	/* One of INTERP_JIT_TIER_*, not a bitfield since it is set by the calling thread */
+	gint32 jit_tier;
 #ifdef ENABLE_EXPERIMENT_TIERED
 	MiniTieredCounter tiered_counter;
 #endif
@@ -243,14 +247,71 @@ typedef struct {
 	gint32 added_pop_count;
 	gint32 inlined_methods;
 	gint32 inline_failures;
+	gint32 methods_tiered_up;
+	gint32 tier_up_failures;
 } MonoInterpStats;
 
 extern MonoInterpStats mono_interp_stats;
 
+/*
+ * Per call site cache of MINT_CALLVIRT_FAST, mapping the vtable of the receiver to the
+ * resolved target. Entries are keyed by the exact vtable, whose slots never change, so
+ * loading new classes doesn't invalidate them. Entries are only ever added, under the
+ * memory manager lock, and vtables of collectible classes are never cached since their
+ * memory can be reused once the class is unloaded. Once all entries are taken the call
+ * site is megamorphic and falls back to the per vtable method tables.
+ */
+#define INTERP_CALL_CACHE_SIZE 4
+
+typedef struct {
+	MonoVTable *vtable;
+	InterpMethod *target;
+} InterpCallCacheEntry;
+
+typedef struct {
+	InterpCallCacheEntry entries [INTERP_CALL_CACHE_SIZE];
+} InterpCallCache;
+
 extern int mono_interp_traceopt;
 extern int mono_interp_opt;
 extern GSList *mono_interp_jit_classes;
 
+/*
+ * Trace compilation tier. While a trace compiler is installed, the loop headers of newly
+ * transformed methods start with a MINT_TIER_PREPARE_TRACE. Once one of them was hit
+ * INTERP_TRACE_HIT_THRESHOLD times, the compiler is asked to compile the code starting at
+ * that ip. On success the opcode is patched to MINT_TIER_ENTER_TRACE, which runs the trace
+ * on the frame's locals. A trace returns the ip where the interpreter resumes execution,
+ * this is either the exit of the trace or the location of a guard that failed.
+ */
+typedef const guint16* (*InterpTraceFunc) (InterpFrame *frame, unsigned char *locals, const guint16 *ip);
+typedef InterpTraceFunc (*InterpTraceCompiler) (InterpMethod *imethod, const guint16 *ip);
+
+typedef struct {
+	InterpTraceFunc func;
+	guint32 hit_count;
+} InterpTraceInfo;
+
+#define INTERP_TRACE_HIT_THRESHOLD 1000
+
+/*
+ * JIT tier. When the JIT is available, methods whose hotness reaches INTERP_JIT_TIER_THRESHOLD
+ * are compiled with the JIT and further calls from interpreted code go through do_jit_call ().
+ * Frames already running in the interpreter keep running there, there is no OSR transition.
+ */
+#define INTERP_JIT_TIER_THRESHOLD 1000
+
+enum {
+	INTERP_JIT_TIER_NONE = 0,
+	INTERP_JIT_TIER_JITTED = 1,
+	INTERP_JIT_TIER_FAILED = -1
+};
+
+extern InterpTraceCompiler mono_interp_trace_compiler;
+
+void
+mono_interp_install_trace_compiler (InterpTraceCompiler compiler);
+
 void
 mono_interp_transform_method (InterpMethod *imethod, ThreadContext *context, MonoError *error);
 
@@ -239,6 +239,8 @@ reinit_frame (InterpFrame *frame, InterpFrame *parent, InterpMethod *imethod, gp
 GSList *mono_interp_jit_classes;
 /* Optimizations enabled with interpreter */
 int mono_interp_opt = INTERP_OPT_DEFAULT;
+/* Compiles hot loops of interpreted methods, see MINT_TIER_PREPARE_TRACE */
+InterpTraceCompiler mono_interp_trace_compiler;
 /* If TRUE, interpreted code will be interrupted at function entry/backward branches */
 static gboolean ss_enabled;
 
@@ -733,6 +735,53 @@ get_virtual_method_fast (InterpMethod *imethod, MonoVTable *vtable, int offset)
 	}
 }
 
+/*
+ * get_virtual_method_cached:
+ *
+ *   Same as get_virtual_method_fast, but first looks up the receiver vtable in the inline
+ * cache of the call site. CALLER is the method containing the call site, the cache is
+ * allocated from its memory manager.
+ */
+static InterpMethod*
+get_virtual_method_cached (InterpMethod *caller, InterpCallCache *cache, InterpMethod *imethod, MonoVTable *vtable, int offset)
+{
+	int i;
+	for (i = 0; i < INTERP_CALL_CACHE_SIZE; i++) {
+		MonoVTable *entry_vtable = cache->entries [i].vtable;
+		if (entry_vtable == vtable) {
+			mono_memory_read_barrier ();
+			return cache->entries [i].target;
+		}
+		// Entries are filled in order
+		if (!entry_vtable)
+			break;
+	}
+
+	InterpMethod *target_imethod = get_virtual_method_fast (imethod, vtable, offset);
+
+	// Megamorphic call site or receiver that might get unloaded
+	if (i == INTERP_CALL_CACHE_SIZE || m_class_get_mem_manager (vtable->klass)->collectible)
+		return target_imethod;
+
+	MonoMemoryManager *memory_manager = m_method_get_mem_manager (caller->method);
+	mono_mem_manager_lock (memory_manager);
+	for (i = 0; i < INTERP_CALL_CACHE_SIZE; i++) {
+		MonoVTable *entry_vtable = cache->entries [i].vtable;
+		if (entry_vtable == vtable)
+			break;
+		if (!entry_vtable) {
+			cache->entries [i].target = target_imethod;
+			/* Publish the target before the vtable, readers match on the latter */
+			mono_memory_barrier ();
+			cache->entries [i].vtable = vtable;
+			break;
+		}
+	}
+	mono_mem_manager_unlock (memory_manager);
+
+	return target_imethod;
+}
+
 // Returns the size it uses on the interpreter stack
 static int
 stackval_from_data (MonoType *type, stackval *result, const void *data, gboolean pinvoke)
@@ -2360,6 +2409,72 @@ do_jit_call (stackval *ret_sp, stackval *sp, InterpFrame *frame, InterpMethod *r
 	}
 }
 
+static gboolean
+jit_tier_supported (InterpMethod *imethod)
+{
+	MonoMethod *method = imethod->method;
+	MonoMethodSignature *sig = mono_method_signature_internal (method);
+
+	if (!sig || sig->pinvoke || sig->param_count > 16)
+		return FALSE;
+	if (imethod->vararg || method->string_ctor)
+		return FALSE;
+	/* Shared generic code would need an rgctx argument */
+	if (method->is_inflated)
+		return FALSE;
+	if (method->flags & METHOD_ATTRIBUTE_PINVOKE_IMPL)
+		return FALSE;
+	if (method->iflags & (METHOD_IMPL_ATTRIBUTE_INTERNAL_CALL | METHOD_IMPL_ATTRIBUTE_RUNTIME))
+		return FALSE;
+	if (method->wrapper_type != MONO_WRAPPER_NONE)
+		return FALSE;
+	/* The methods of interp-only classes are never JITted */
+	for (GSList *l = mono_interp_only_classes; l; l = l->next) {
+		if (!strcmp (m_class_get_name (method->klass), (const char*)l->data))
+			return FALSE;
+	}
+	return TRUE;
+}
+
+/*
+ * tier_up_method:
+ *
+ *   Compile IMETHOD with the JIT once it got hot, so the callers in interpreted code can
+ * call the JITted code instead. Returns TRUE if the call should go to the JITted code.
+ * FRAME is the calling frame, an LMF is pushed for it since compilation can run cctors.
+ */
+static MONO_NEVER_INLINE gboolean
+tier_up_method (InterpFrame *frame, InterpMethod *imethod)
+{
+	ERROR_DECL (error);
+	MonoLMFExt ext;
+	gpointer addr = NULL;
+
+	if (imethod->jit_tier != INTERP_JIT_TIER_NONE)
+		return imethod->jit_tier == INTERP_JIT_TIER_JITTED;
+
+	if (jit_tier_supported (imethod)) {
+		interp_push_lmf (&ext, frame);
+		addr = mono_jit_compile_method_jit_only (imethod->method, error);
+		// Compile the gsharedvt_out wrapper as well, so do_jit_call () doesn't need to
+		if (addr && is_ok (error) && !imethod->jit_call_info)
+			init_jit_call_info (imethod, error);
+		interp_pop_lmf (&ext);
+	}
+
+	if (!addr || !is_ok (error)) {
+		mono_error_cleanup (error);
+		imethod->jit_tier = INTERP_JIT_TIER_FAILED;
+		mono_interp_stats.tier_up_failures++;
+		return FALSE;
+	}
+
+	mono_memory_barrier ();
+	imethod->jit_tier = INTERP_JIT_TIER_JITTED;
+	mono_interp_stats.methods_tiered_up++;
+	return TRUE;
+}
+
 static MONO_NEVER_INLINE void
 do_debugger_tramp (void (*tramp) (void), InterpFrame *frame)
 {
@@ -3462,8 +3577,9 @@ main_loop:
 			this_arg = LOCAL_VAR (call_args_offset, MonoObject*);
 
 			slot = (gint16)ip [4];
-			ip += 5;
-			cmethod = get_virtual_method_fast (cmethod, this_arg->vtable, slot);
+			InterpCallCache *cache = (InterpCallCache*)frame->imethod->data_items [ip [5]];
+			ip += 6;
+			cmethod = get_virtual_method_cached (frame->imethod, cache, cmethod, this_arg->vtable, slot);
 			if (m_class_is_valuetype (this_arg->vtable->klass) && m_class_is_valuetype (cmethod->method->klass)) {
 				/* unbox */
 				gpointer unboxed = mono_object_unbox_internal (this_arg);
@@ -3546,6 +3662,22 @@ main_loop:
 			ip += 4;
 #endif
 call:
+			if (G_UNLIKELY (cmethod->jit_tier == INTERP_JIT_TIER_JITTED ||
+					((mono_interp_opt & INTERP_OPT_JIT_TIERING) && cmethod->jit_tier == INTERP_JIT_TIER_NONE &&
+					++cmethod->hotness >= INTERP_JIT_TIER_THRESHOLD && tier_up_method (frame, cmethod)))) {
+				error_init_reuse (error);
+				/* ip already points at the next instruction */
+				frame->state.ip = ip;
+				do_jit_call ((stackval*)(locals + return_offset), (stackval*)(locals + call_args_offset), frame, cmethod, error);
+				if (!is_ok (error)) {
+					MonoException *ex = mono_error_convert_to_exception (error);
+					/* Any ip inside the call instruction */
+					THROW_EX (ex, ip - 1);
+				}
+
+				CHECK_RESUME_STATE (context);
+				MINT_IN_BREAK;
+			}
 			/*
 			 * Make a non-recursive call by loading the new interpreter state based on child frame,
 			 * and going back to the main loop.
@@ -3658,7 +3790,11 @@ call:
 			mini_tiered_inc (frame->imethod->method, &frame->imethod->tiered_counter, 0); \
 	} while (0);
 #else
-#define BACK_BRANCH_PROFILE(offset)
+/* Loops count towards the hotness of the method for the JIT tier */
+#define BACK_BRANCH_PROFILE(offset) do { \
+		if (offset < 0 && (mono_interp_opt & INTERP_OPT_JIT_TIERING)) \
+			frame->imethod->hotness++; \
+	} while (0);
 #endif
 
 		MINT_IN_CASE(MINT_BR_S) {
@@ -4136,6 +4272,75 @@ call:
 			CONDBR(mono_isunordered (d1, d2) || d1 < d2)
 			MINT_IN_BREAK;
 		}
+
+#define BRELOP_IMM_S(datatype, op) \
+	if (LOCAL_VAR (ip [1], datatype) op (datatype)(gint16)ip [3]) { \
+		gint16 br_offset = (gint16) ip [2]; \
+		BACK_BRANCH_PROFILE (br_offset); \
+		ip += br_offset; \
+	} else \
+		ip += 4;
+
+		MINT_IN_CASE(MINT_BEQ_I4_IMM_S)
+			BRELOP_IMM_S(gint32, ==);
+			MINT_IN_BREAK;
+		MINT_IN_CASE(MINT_BEQ_I8_IMM_S)
+			BRELOP_IMM_S(gint64, ==);
+			MINT_IN_BREAK;
+		MINT_IN_CASE(MINT_BGE_I4_IMM_S)
+			BRELOP_IMM_S(gint32, >=);
+			MINT_IN_BREAK;
+		MINT_IN_CASE(MINT_BGE_I8_IMM_S)
+			BRELOP_IMM_S(gint64, >=);
+			MINT_IN_BREAK;
+		MINT_IN_CASE(MINT_BGT_I4_IMM_S)
+			BRELOP_IMM_S(gint32, >);
+			MINT_IN_BREAK;
+		MINT_IN_CASE(MINT_BGT_I8_IMM_S)
+			BRELOP_IMM_S(gint64, >);
+			MINT_IN_BREAK;
+		MINT_IN_CASE(MINT_BLT_I4_IMM_S)
+			BRELOP_IMM_S(gint32, <);
+			MINT_IN_BREAK;
+		MINT_IN_CASE(MINT_BLT_I8_IMM_S)
+			BRELOP_IMM_S(gint64, <);
+			MINT_IN_BREAK;
+		MINT_IN_CASE(MINT_BLE_I4_IMM_S)
+			BRELOP_IMM_S(gint32, <=);
+			MINT_IN_BREAK;
+		MINT_IN_CASE(MINT_BLE_I8_IMM_S)
+			BRELOP_IMM_S(gint64, <=);
+			MINT_IN_BREAK;
+		MINT_IN_CASE(MINT_BNE_UN_I4_IMM_S)
+			BRELOP_IMM_S(guint32, !=);
+			MINT_IN_BREAK;
+		MINT_IN_CASE(MINT_BNE_UN_I8_IMM_S)
+			BRELOP_IMM_S(guint64, !=);
+			MINT_IN_BREAK;
+		MINT_IN_CASE(MINT_BGE_UN_I4_IMM_S)
+			BRELOP_IMM_S(guint32, >=);
+			MINT_IN_BREAK;
+		MINT_IN_CASE(MINT_BGE_UN_I8_IMM_S)
+			BRELOP_IMM_S(guint64, >=);
+			MINT_IN_BREAK;
+		MINT_IN_CASE(MINT_BGT_UN_I4_IMM_S)
+			BRELOP_IMM_S(guint32, >);
+			MINT_IN_BREAK;
+		MINT_IN_CASE(MINT_BGT_UN_I8_IMM_S)
+			BRELOP_IMM_S(guint64, >);
+			MINT_IN_BREAK;
+		MINT_IN_CASE(MINT_BLE_UN_I4_IMM_S)
+			BRELOP_IMM_S(guint32, <=);
+			MINT_IN_BREAK;
+		MINT_IN_CASE(MINT_BLE_UN_I8_IMM_S)
+			BRELOP_IMM_S(guint64, <=);
+			MINT_IN_BREAK;
+		MINT_IN_CASE(MINT_BLT_UN_I4_IMM_S)
+			BRELOP_IMM_S(guint32, <);
+			MINT_IN_BREAK;
+		MINT_IN_CASE(MINT_BLT_UN_I8_IMM_S)
+			BRELOP_IMM_S(guint64, <);
+			MINT_IN_BREAK;
 		MINT_IN_CASE(MINT_SWITCH) {
 			guint32 val = LOCAL_VAR (ip [1], guint32);
 			guint32 n = READ32 (ip + 2);
@@ -6302,6 +6507,33 @@ call:
 			/* Just a placeholder for a breakpoint */
 			++ip;
 			MINT_IN_BREAK;
+		MINT_IN_CASE(MINT_TIER_PREPARE_TRACE) {
+			InterpTraceInfo *info = (InterpTraceInfo*)frame->imethod->data_items [ip [1]];
+			if (G_UNLIKELY (++info->hit_count == INTERP_TRACE_HIT_THRESHOLD)) {
+				InterpTraceFunc func = mono_interp_trace_compiler (frame->imethod, ip);
+				if (func) {
+					info->func = func;
+					mono_memory_barrier ();
+					*(guint16*)ip = MINT_TIER_ENTER_TRACE;
+					MINT_IN_BREAK;
+				}
+				// The loop can't be compiled, don't try again
+				*(guint16*)ip = MINT_TIER_NOP_TRACE;
+			}
+			ip += 2;
+			MINT_IN_BREAK;
+		}
+		MINT_IN_CASE(MINT_TIER_ENTER_TRACE) {
+			InterpTraceInfo *info = (InterpTraceInfo*)frame->imethod->data_items [ip [1]];
+			// The trace returns where execution of the method continues. If a guard failed
+			// this is an ip inside the trace, which the interpreter then executes normally.
+			// A trace bailing out right away returns ip + 2, never its own entry.
+			ip = info->func (frame, locals, ip);
+			MINT_IN_BREAK;
+		}
+		MINT_IN_CASE(MINT_TIER_NOP_TRACE)
+			ip += 2;
+			MINT_IN_BREAK;
 		MINT_IN_CASE(MINT_SDB_BREAKPOINT) {
 			typedef void (*T) (void);
 			static T bp_tramp;
@@ -6864,11 +7096,29 @@ interp_parse_options (const char *options)
 			mono_interp_opt &= ~INTERP_OPT_SUPER_INSTRUCTIONS;
 		else if (strncmp (arg, "-bblocks", 8) == 0)
 			mono_interp_opt &= ~INTERP_OPT_BBLOCKS;
+		else if (strncmp (arg, "-traces", 7) == 0)
+			mono_interp_opt &= ~INTERP_OPT_TRACES;
+		else if (strncmp (arg, "-tiering", 8) == 0)
+			mono_interp_opt &= ~INTERP_OPT_JIT_TIERING;
 		else if (strncmp (arg, "-all", 4) == 0)
 			mono_interp_opt = INTERP_OPT_NONE;
 	}
 }
 
+/*
+ * mono_interp_install_trace_compiler:
+ *
+ *   Install the compiler used to compile hot interpreter loops into traces. On WebAssembly
+ * this is where the runtime generated wasm modules get hooked up. Only methods transformed
+ * after this call get trace entry points.
+ */
+void
+mono_interp_install_trace_compiler (InterpTraceCompiler compiler)
+{
+	mono_memory_barrier ();
+	mono_interp_trace_compiler = compiler;
+}
+
 /*
  * interp_set_resume_state:
  *
@@ -7416,6 +7666,8 @@ register_interp_stats (void)
 	mono_counters_register ("Emitted instructions", MONO_COUNTER_INTERP | MONO_COUNTER_INT, &mono_interp_stats.emitted_instructions);
 	mono_counters_register ("Methods inlined", MONO_COUNTER_INTERP | MONO_COUNTER_INT, &mono_interp_stats.inlined_methods);
 	mono_counters_register ("Inline failures", MONO_COUNTER_INTERP | MONO_COUNTER_INT, &mono_interp_stats.inline_failures);
+	mono_counters_register ("Methods tiered up to the JIT", MONO_COUNTER_INTERP | MONO_COUNTER_INT, &mono_interp_stats.methods_tiered_up);
+	mono_counters_register ("JIT tier up failures", MONO_COUNTER_INTERP | MONO_COUNTER_INT, &mono_interp_stats.tier_up_failures);
 }
 
 #undef MONO_EE_CALLBACK
@@ -7439,6 +7691,12 @@ mono_ee_interp_init (const char *opts)
 	/* Don't do any optimizations if running under debugger */
 	if (mini_get_debug_options ()->mdb_optimizations)
 		mono_interp_opt = 0;
+#if !defined(MONO_ARCH_GSHAREDVT_SUPPORTED) || defined(HOST_WASM)
+	mono_interp_opt &= ~INTERP_OPT_JIT_TIERING;
+#endif
+	/* The JIT tier needs a JIT and is pointless when the method is in the AOT image anyway */
+	if (mono_aot_only || mono_llvm_only || mono_debug_enabled ())
+		mono_interp_opt &= ~INTERP_OPT_JIT_TIERING;
 	mono_interp_transform_init ();
 
 	mini_install_interp_callbacks (&mono_interp_callbacks);
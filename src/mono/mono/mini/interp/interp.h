@@ -34,7 +34,9 @@ enum {
 	INTERP_OPT_CPROP = 2,
 	INTERP_OPT_SUPER_INSTRUCTIONS = 4,
 	INTERP_OPT_BBLOCKS = 8,
-	INTERP_OPT_DEFAULT = INTERP_OPT_INLINE | INTERP_OPT_CPROP | INTERP_OPT_SUPER_INSTRUCTIONS | INTERP_OPT_BBLOCKS
+	INTERP_OPT_TRACES = 16,
+	INTERP_OPT_JIT_TIERING = 32,
+	INTERP_OPT_DEFAULT = INTERP_OPT_INLINE | INTERP_OPT_CPROP | INTERP_OPT_SUPER_INSTRUCTIONS | INTERP_OPT_BBLOCKS | INTERP_OPT_TRACES | INTERP_OPT_JIT_TIERING
 };
 
 typedef struct _InterpMethodArguments InterpMethodArguments;
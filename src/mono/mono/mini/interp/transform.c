@@ -3420,6 +3420,8 @@ interp_transform_call (TransformData *td, MonoMethod *method, MonoMethod *target
 					td->last_ins->data [1] = -2 * MONO_IMT_SIZE + mono_method_get_imt_slot (target_method);
 				else
 					td->last_ins->data [1] = mono_method_get_vtable_slot (target_method);
+				InterpCallCache *cache = (InterpCallCache*)mono_mem_manager_alloc0 (td->mem_manager, sizeof (InterpCallCache));
+				td->last_ins->data [2] = get_data_item_index (td, cache);
 			} else if (is_virtual) {
 				interp_add_ins (td, MINT_CALLVIRT);
 			} else {
@@ -7557,6 +7559,7 @@ emit_compacted_instruction (TransformData *td, guint16* start_ip, InterpInst *in
 		}
 	} else if ((opcode >= MINT_BRFALSE_I4_S && opcode <= MINT_BRTRUE_R8_S) ||
 			(opcode >= MINT_BEQ_I4_S && opcode <= MINT_BLT_UN_R8_S) ||
+			MINT_IS_BINOP_IMM_CONDITIONAL_BRANCH (opcode) ||
 			opcode == MINT_BR_S || opcode == MINT_LEAVE_S || opcode == MINT_LEAVE_S_CHECK || opcode == MINT_CALL_HANDLER_S) {
 		const int br_offset = start_ip - td->new_code;
 		for (int i = 0; i < mono_interp_op_sregs [opcode]; i++)
@@ -7576,6 +7579,8 @@ emit_compacted_instruction (TransformData *td, guint16* start_ip, InterpInst *in
 		}
 		if (opcode == MINT_CALL_HANDLER_S)
 			*ip++ = ins->data [1];
+		else if (MINT_IS_BINOP_IMM_CONDITIONAL_BRANCH (opcode))
+			*ip++ = ins->data [0];
 	} else if ((opcode >= MINT_BRFALSE_I4 && opcode <= MINT_BRTRUE_R8) ||
 			(opcode >= MINT_BEQ_I4 && opcode <= MINT_BLT_UN_R8) ||
 			opcode == MINT_BR || opcode == MINT_LEAVE || opcode == MINT_LEAVE_CHECK || opcode == MINT_CALL_HANDLER) {
@@ -8339,17 +8344,22 @@ retry:
 				ins = interp_fold_binop (td, local_defs, ins);
 			} else if (MINT_IS_BINOP_CONDITIONAL_BRANCH (opcode)) {
 				ins = interp_fold_binop_cond_br (td, bb, local_defs, ins);
-			} else if (MINT_IS_LDFLD (opcode) && ins->data [0] == 0) {
+			} else if (MINT_IS_LDFLD (opcode)) {
 				InterpInst *ldloca = local_defs [sregs [0]].ins;
-				if (ldloca != NULL && ldloca->opcode == MINT_LDLOCA_S &&
-						td->locals [ldloca->sregs [0]].mt == (ins->opcode - MINT_LDFLD_I1)) {
+				if (ldloca != NULL && ldloca->opcode == MINT_LDLOCA_S) {
 					int mt = ins->opcode - MINT_LDFLD_I1;
 					int local = ldloca->sregs [0];
-					// Replace LDLOCA + LDFLD with LDLOC, when the loading field represents
-					// the entire local. This is the case with loading the only field of an
-					// IntPtr. We don't handle value type loads.
-					ins->opcode = get_mov_for_type (mt, TRUE);
-					// The dreg of the MOV is the same as the dreg of the LDFLD
+					if (ins->data [0] == 0 && td->locals [local].mt == mt) {
+						// Replace LDLOCA + LDFLD with LDLOC, when the loading field represents
+						// the entire local. This is the case with loading the only field of an
+						// IntPtr. We don't handle value type loads.
+						ins->opcode = get_mov_for_type (mt, TRUE);
+					} else {
+						// Replace LDLOCA + LDFLD with LDFLD_VT, reading the field straight from
+						// the storage of the local instead of going through its address.
+						ins->opcode = MINT_LDFLD_VT_I1 + mt;
+					}
+					// The dreg of the MOV/LDFLD_VT is the same as the dreg of the LDFLD
 					local_ref_count [sregs [0]]--;
 					sregs [0] = local;
 
@@ -8446,6 +8456,65 @@ get_sreg_imm (TransformData *td, int sreg, gint16 *imm)
 	return FALSE;
 }
 
+static int
+get_binop_condbr_imm (int opcode)
+{
+	switch (opcode) {
+		case MINT_BEQ_I4_S: return MINT_BEQ_I4_IMM_S;
+		case MINT_BEQ_I8_S: return MINT_BEQ_I8_IMM_S;
+		case MINT_BGE_I4_S: return MINT_BGE_I4_IMM_S;
+		case MINT_BGE_I8_S: return MINT_BGE_I8_IMM_S;
+		case MINT_BGT_I4_S: return MINT_BGT_I4_IMM_S;
+		case MINT_BGT_I8_S: return MINT_BGT_I8_IMM_S;
+		case MINT_BLT_I4_S: return MINT_BLT_I4_IMM_S;
+		case MINT_BLT_I8_S: return MINT_BLT_I8_IMM_S;
+		case MINT_BLE_I4_S: return MINT_BLE_I4_IMM_S;
+		case MINT_BLE_I8_S: return MINT_BLE_I8_IMM_S;
+		case MINT_BNE_UN_I4_S: return MINT_BNE_UN_I4_IMM_S;
+		case MINT_BNE_UN_I8_S: return MINT_BNE_UN_I8_IMM_S;
+		case MINT_BGE_UN_I4_S: return MINT_BGE_UN_I4_IMM_S;
+		case MINT_BGE_UN_I8_S: return MINT_BGE_UN_I8_IMM_S;
+		case MINT_BGT_UN_I4_S: return MINT_BGT_UN_I4_IMM_S;
+		case MINT_BGT_UN_I8_S: return MINT_BGT_UN_I8_IMM_S;
+		case MINT_BLE_UN_I4_S: return MINT_BLE_UN_I4_IMM_S;
+		case MINT_BLE_UN_I8_S: return MINT_BLE_UN_I8_IMM_S;
+		case MINT_BLT_UN_I4_S: return MINT_BLT_UN_I4_IMM_S;
+		case MINT_BLT_UN_I8_S: return MINT_BLT_UN_I8_IMM_S;
+		default: return MINT_NOP;
+	}
+}
+
+// Returns the short conditional branch that jumps when the integer compare cmp_opcode
+// yields true (or false, if negate is set). Floating point compares are not handled
+// since negating them would change the result for unordered operands.
+static int
+get_binop_condbr_from_cmp (int cmp_opcode, gboolean negate)
+{
+	switch (cmp_opcode) {
+		case MINT_CEQ_I4: return negate ? MINT_BNE_UN_I4_S : MINT_BEQ_I4_S;
+		case MINT_CEQ_I8: return negate ? MINT_BNE_UN_I8_S : MINT_BEQ_I8_S;
+		case MINT_CNE_I4: return negate ? MINT_BEQ_I4_S : MINT_BNE_UN_I4_S;
+		case MINT_CNE_I8: return negate ? MINT_BEQ_I8_S : MINT_BNE_UN_I8_S;
+		case MINT_CGT_I4: return negate ? MINT_BLE_I4_S : MINT_BGT_I4_S;
+		case MINT_CGT_I8: return negate ? MINT_BLE_I8_S : MINT_BGT_I8_S;
+		case MINT_CGE_I4: return negate ? MINT_BLT_I4_S : MINT_BGE_I4_S;
+		case MINT_CGE_I8: return negate ? MINT_BLT_I8_S : MINT_BGE_I8_S;
+		case MINT_CLT_I4: return negate ? MINT_BGE_I4_S : MINT_BLT_I4_S;
+		case MINT_CLT_I8: return negate ? MINT_BGE_I8_S : MINT_BLT_I8_S;
+		case MINT_CLE_I4: return negate ? MINT_BGT_I4_S : MINT_BLE_I4_S;
+		case MINT_CLE_I8: return negate ? MINT_BGT_I8_S : MINT_BLE_I8_S;
+		case MINT_CGT_UN_I4: return negate ? MINT_BLE_UN_I4_S : MINT_BGT_UN_I4_S;
+		case MINT_CGT_UN_I8: return negate ? MINT_BLE_UN_I8_S : MINT_BGT_UN_I8_S;
+		case MINT_CGE_UN_I4: return negate ? MINT_BLT_UN_I4_S : MINT_BGE_UN_I4_S;
+		case MINT_CGE_UN_I8: return negate ? MINT_BLT_UN_I8_S : MINT_BGE_UN_I8_S;
+		case MINT_CLT_UN_I4: return negate ? MINT_BGE_UN_I4_S : MINT_BLT_UN_I4_S;
+		case MINT_CLT_UN_I8: return negate ? MINT_BGE_UN_I8_S : MINT_BLT_UN_I8_S;
+		case MINT_CLE_UN_I4: return negate ? MINT_BGT_UN_I4_S : MINT_BLE_UN_I4_S;
+		case MINT_CLE_UN_I8: return negate ? MINT_BGT_UN_I8_S : MINT_BLE_UN_I8_S;
+		default: return MINT_NOP;
+	}
+}
+
 static void
 interp_super_instructions (TransformData *td)
 {
@@ -8610,6 +8679,55 @@ interp_super_instructions (TransformData *td)
 						}
 					}
 				}
+			} else if (opcode == MINT_BRTRUE_I4_S || opcode == MINT_BRFALSE_I4_S) {
+				// cmp + brtrue/brfalse -> bcc, ceq0 + brtrue/brfalse -> brfalse/brtrue
+				// The compare must be right before the branch, so its sregs can't be redefined in between.
+				int sreg = ins->sregs [0];
+				InterpInst *def = td->locals [sreg].def;
+				if (def != NULL && local_ref_count [sreg] == 1 && interp_prev_ins (ins) == def) {
+					gboolean negate = opcode == MINT_BRFALSE_I4_S;
+					InterpInst *new_inst = NULL;
+					if (def->opcode == MINT_CEQ0_I4) {
+						new_inst = interp_insert_ins (td, ins, negate ? MINT_BRTRUE_I4_S : MINT_BRFALSE_I4_S);
+						new_inst->sregs [0] = def->sregs [0];
+					} else {
+						int condbr_op = get_binop_condbr_from_cmp (def->opcode, negate);
+						if (condbr_op != MINT_NOP) {
+							new_inst = interp_insert_ins (td, ins, condbr_op);
+							new_inst->sregs [0] = def->sregs [0];
+							new_inst->sregs [1] = def->sregs [1];
+						}
+					}
+					if (new_inst) {
+						new_inst->info.target_bb = ins->info.target_bb;
+						interp_clear_ins (def);
+						interp_clear_ins (ins);
+						local_ref_count [sreg]--;
+						mono_interp_stats.super_instructions++;
+						if (td->verbose_level) {
+							g_print ("superins: ");
+							dump_interp_inst (new_inst);
+						}
+					}
+				}
+			} else if (MINT_IS_BINOP_CONDITIONAL_BRANCH (opcode)) {
+				// ldc + bcc -> bcc.imm
+				int condbr_op = get_binop_condbr_imm (opcode);
+				int sreg_imm = ins->sregs [1];
+				gint16 imm;
+				if (condbr_op != MINT_NOP && get_sreg_imm (td, sreg_imm, &imm)) {
+					InterpInst *new_inst = interp_insert_ins (td, ins, condbr_op);
+					new_inst->sregs [0] = ins->sregs [0];
+					new_inst->data [0] = imm;
+					new_inst->info.target_bb = ins->info.target_bb;
+					interp_clear_ins (td->locals [sreg_imm].def);
+					interp_clear_ins (ins);
+					local_ref_count [sreg_imm]--;
+					if (td->verbose_level) {
+						g_print ("superins: ");
+						dump_interp_inst (new_inst);
+					}
+				}
 			} else if (MINT_IS_LDFLD (opcode)) {
 				// cknull + ldfld -> ldfld
 				// FIXME This optimization is very limited, it is meant mainly to remove cknull
@@ -8654,6 +8772,39 @@ interp_optimize_code (TransformData *td)
 		MONO_TIME_TRACK (mono_interp_stats.super_instructions_time, interp_super_instructions (td));
 }
 
+// Adds a MINT_TIER_PREPARE_TRACE at the start of every loop header, so hot loops can be
+// handed over to the trace compiler.
+static void
+interp_add_trace_entry_points (TransformData *td)
+{
+	InterpBasicBlock *bb;
+	int *bb_order = (int*)mono_mempool_alloc0 (td->mempool, td->bb_count * sizeof (int));
+	int order = 0;
+
+	for (bb = td->entry_bb; bb != NULL; bb = bb->next_bb)
+		bb_order [bb->index] = ++order;
+
+	for (bb = td->entry_bb; bb != NULL; bb = bb->next_bb) {
+		gboolean is_loop_header = FALSE;
+		for (int i = 0; i < bb->in_count; i++) {
+			// Predecessors laid out after this bblock reach it through a backward branch
+			if (bb_order [bb->in_bb [i]->index] >= bb_order [bb->index]) {
+				is_loop_header = TRUE;
+				break;
+			}
+		}
+		if (!is_loop_header || bb->eh_block)
+			continue;
+
+		InterpTraceInfo *info = (InterpTraceInfo*)mono_mem_manager_alloc0 (td->mem_manager, sizeof (InterpTraceInfo));
+		InterpInst *ins = interp_insert_ins_bb (td, bb, NULL, MINT_TIER_PREPARE_TRACE);
+		ins->il_offset = -1;
+		ins->data [0] = get_data_item_index (td, info);
+		if (td->verbose_level)
+			g_print ("trace entry point at BB%d\n", bb->index);
+	}
+}
+
 static void
 foreach_local_var (TransformData *td, InterpInst *ins, int data, void (*callback)(TransformData*, int, int))
 {
@@ -9190,6 +9341,11 @@ generate (MonoMethod *method, MonoMethodHeader *header, InterpMethod *rtm, MonoG
 
 	interp_optimize_code (td);
 
+	// Traces can't be unwound through, so methods with clauses are left to the interpreter
+	if ((mono_interp_opt & INTERP_OPT_TRACES) && mono_interp_trace_compiler &&
+			!td->gen_sdb_seq_points && header->num_clauses == 0)
+		interp_add_trace_entry_points (td);
+
 	interp_alloc_offsets (td);
 
 	generate_compacted_code (td);
@@ -712,6 +712,36 @@ emit_ldrfpx (guint8 *code, int rt, int rn, int imm)
 	return code;
 }
 
+#ifdef MONO_ARCH_SIMD_INTRINSICS
+static WARN_UNUSED_RESULT guint8*
+emit_ldrfpq (guint8 *code, int rt, int rn, int imm)
+{
+	if (arm_is_pimm12_scaled (imm, 16)) {
+		arm_ldrfpq (code, rt, rn, imm);
+	} else {
+		g_assert (rn != ARMREG_IP0);
+		code = emit_imm (code, ARMREG_IP0, imm);
+		arm_addx (code, ARMREG_IP0, rn, ARMREG_IP0);
+		arm_ldrfpq (code, rt, ARMREG_IP0, 0);
+	}
+	return code;
+}
+
+static WARN_UNUSED_RESULT guint8*
+emit_strfpq (guint8 *code, int rt, int rn, int imm)
+{
+	if (arm_is_pimm12_scaled (imm, 16)) {
+		arm_strfpq (code, rt, rn, imm);
+	} else {
+		g_assert (rn != ARMREG_IP0);
+		code = emit_imm (code, ARMREG_IP0, imm);
+		arm_addx (code, ARMREG_IP0, rn, ARMREG_IP0);
+		arm_strfpq (code, rt, ARMREG_IP0, 0);
+	}
+	return code;
+}
+#endif
+
 guint8*
 mono_arm_emit_ldrx (guint8 *code, int rt, int rn, int imm)
 {
@@ -2917,6 +2947,11 @@ mono_arch_lowering_pass (MonoCompile *cfg, MonoBasicBlock *bb)
 		case OP_LREM_IMM:
 			mono_decompose_op_imm (cfg, bb, ins);
 			break;
+#ifdef MONO_ARCH_SIMD_INTRINSICS
+		case OP_XCAST:
+			ins->opcode = OP_XMOVE;
+			break;
+#endif
 		case OP_LOCALLOC_IMM:
 			if (ins->inst_imm > 32) {
 				ADD_NEW_INS (cfg, temp, OP_ICONST);
@@ -4199,6 +4234,74 @@ mono_arch_output_basic_block (MonoCompile *cfg, MonoBasicBlock *bb)
 		case OP_MOVE_I8_TO_F:
 			arm_fmov_rx_to_double (code, ins->dreg, ins->sreg1);
 			break;
+#ifdef MONO_ARCH_SIMD_INTRINSICS
+			/* SIMD */
+		case OP_XMOVE:
+			if (dreg != sreg1)
+				arm_neon_mov (code, dreg, sreg1);
+			break;
+		case OP_XZERO:
+			arm_neon_eor (code, dreg, dreg, dreg);
+			break;
+		case OP_LOADX_MEMBASE:
+			code = emit_ldrfpq (code, dreg, ins->inst_basereg, ins->inst_offset);
+			break;
+		case OP_STOREX_MEMBASE:
+			code = emit_strfpq (code, sreg1, ins->inst_destbasereg, ins->inst_offset);
+			break;
+		case OP_EXPAND_I1:
+			arm_neon_dup_gr (code, ARMSIZE_B, dreg, sreg1);
+			break;
+		case OP_EXPAND_I2:
+			arm_neon_dup_gr (code, ARMSIZE_H, dreg, sreg1);
+			break;
+		case OP_EXPAND_I4:
+			arm_neon_dup_gr (code, ARMSIZE_W, dreg, sreg1);
+			break;
+		case OP_EXPAND_I8:
+			arm_neon_dup_gr (code, ARMSIZE_X, dreg, sreg1);
+			break;
+		case OP_EXPAND_R4:
+			if (cfg->r4fp) {
+				arm_neon_dup_elem (code, ARMSIZE_W, dreg, sreg1, 0);
+			} else {
+				arm_fcvt_ds (code, FP_TEMP_REG, sreg1);
+				arm_neon_dup_elem (code, ARMSIZE_W, dreg, FP_TEMP_REG, 0);
+			}
+			break;
+		case OP_EXPAND_R8:
+			arm_neon_dup_elem (code, ARMSIZE_X, dreg, sreg1, 0);
+			break;
+		case OP_INSERT_I1:
+		case OP_INSERT_I2:
+		case OP_INSERT_I4:
+		case OP_INSERT_I8: {
+			int size = ins->opcode == OP_INSERT_I1 ? ARMSIZE_B : ins->opcode == OP_INSERT_I2 ? ARMSIZE_H : ins->opcode == OP_INSERT_I4 ? ARMSIZE_W : ARMSIZE_X;
+
+			if (dreg != sreg1)
+				arm_neon_mov (code, dreg, sreg1);
+			arm_neon_ins_gr (code, size, dreg, ins->inst_c0, sreg2);
+			break;
+		}
+		case OP_INSERT_R4:
+		case OP_INSERT_R8: {
+			int size = ins->opcode == OP_INSERT_R4 ? ARMSIZE_W : ARMSIZE_X;
+			int src = sreg2;
+
+			/* The fp and the vector registers are the same, so sreg2 might be clobbered by the copy below */
+			if (ins->opcode == OP_INSERT_R4 && !cfg->r4fp) {
+				arm_fcvt_ds (code, FP_TEMP_REG, sreg2);
+				src = FP_TEMP_REG;
+			} else if (dreg == sreg2 && dreg != sreg1) {
+				arm_fmovd (code, FP_TEMP_REG, sreg2);
+				src = FP_TEMP_REG;
+			}
+			if (dreg != sreg1)
+				arm_neon_mov (code, dreg, sreg1);
+			arm_neon_ins_elem (code, size, dreg, ins->inst_c0, src, 0);
+			break;
+		}
+#endif
 		case OP_FCOMPARE:
 			arm_fcmpd (code, sreg1, sreg2);
 			break;
@@ -2134,7 +2134,7 @@ typedef struct {
 } JitCompilationEntry;
 
 typedef struct {
-	GPtrArray *in_flight_methods; //JitCompilationEntry*
+	GHashTable *in_flight_methods; //MonoMethod* -> JitCompilationEntry*
 	MonoCoopMutex lock;
 } JitCompilationData;
 
@@ -2147,18 +2147,23 @@ This value can't be too small or we won't see enough methods being reused and it
 
 static JitCompilationData compilation_data;
 static int jit_methods_waited, jit_methods_multiple, jit_methods_overload, jit_spurious_wakeups_or_timeouts;
+static int jit_compilation_lock_contended, jit_methods_in_flight_max;
 
 static void
 mini_jit_init_job_control (void)
 {
 	mono_coop_mutex_init (&compilation_data.lock);
-	compilation_data.in_flight_methods = g_ptr_array_new ();
+	compilation_data.in_flight_methods = g_hash_table_new (NULL, NULL);
 }
 
 static void
 lock_compilation_data (void)
 {
-	mono_coop_mutex_lock (&compilation_data.lock);
+	/* The lock only guards the placeholder table, compilation itself runs outside of it */
+	if (mono_coop_mutex_trylock (&compilation_data.lock) != 0) {
+		mono_atomic_inc_i32 (&jit_compilation_lock_contended);
+		mono_coop_mutex_lock (&compilation_data.lock);
+	}
 }
 
 static void
@@ -2170,14 +2175,7 @@ unlock_compilation_data (void)
 static JitCompilationEntry*
 find_method (MonoMethod *method)
 {
-	int i;
-	for (i = 0; i < compilation_data.in_flight_methods->len; ++i){
-		JitCompilationEntry *e = (JitCompilationEntry*)compilation_data.in_flight_methods->pdata [i];
-		if (e->method == method)
-			return e;
-	}
-
-	return NULL;
+	return (JitCompilationEntry*)g_hash_table_lookup (compilation_data.in_flight_methods, method);
 }
 
 static void
@@ -2212,6 +2210,8 @@ wait_or_register_method_to_compile (MonoMethod *method)
 		mono_counters_register ("JIT compile 1+ jobs", MONO_COUNTER_INT|MONO_COUNTER_JIT, &jit_methods_multiple);
 		mono_counters_register ("JIT compile overload wait", MONO_COUNTER_INT|MONO_COUNTER_JIT, &jit_methods_overload);
 		mono_counters_register ("JIT compile spurious wakeups or timeouts", MONO_COUNTER_INT|MONO_COUNTER_JIT, &jit_spurious_wakeups_or_timeouts);
+		mono_counters_register ("JIT compile lock contended", MONO_COUNTER_INT|MONO_COUNTER_JIT, &jit_compilation_lock_contended);
+		mono_counters_register ("JIT compile max methods in flight", MONO_COUNTER_INT|MONO_COUNTER_JIT, &jit_methods_in_flight_max);
 		inited = TRUE;
 	}
 
@@ -2221,8 +2221,9 @@ wait_or_register_method_to_compile (MonoMethod *method)
 		entry = g_new0 (JitCompilationEntry, 1);
 		entry->method = method;
 		entry->compilation_count = entry->ref_count = 1;
-		g_ptr_array_add (compilation_data.in_flight_methods, entry);
-		g_assert (find_method (method) == entry);
+		g_hash_table_insert (compilation_data.in_flight_methods, method, entry);
+		if ((int)g_hash_table_size (compilation_data.in_flight_methods) > jit_methods_in_flight_max)
+			jit_methods_in_flight_max = (int)g_hash_table_size (compilation_data.in_flight_methods);
 		add_current_thread (jit_tls);
 
 		unlock_compilation_data ();
@@ -2298,7 +2299,7 @@ unregister_method_for_compile (MonoMethod *method)
 	}
 
 	if (--entry->compilation_count == 0) {
-		g_ptr_array_remove (compilation_data.in_flight_methods, entry);
+		g_hash_table_remove (compilation_data.in_flight_methods, method);
 		unref_jit_entry (entry);
 	}
 
@@ -4394,6 +4395,7 @@ mini_init (const char *filename, const char *runtime_version)
 	mono_threads_install_cleanup (mini_thread_cleanup);
 
 	mono_install_get_cached_class_info (mono_aot_get_cached_class_info);
+	mono_install_get_cached_vtable (mono_aot_get_cached_vtable);
 	mono_install_get_class_from_name (mono_aot_get_class_from_name);
 	mono_install_jit_info_find_in_aot (mono_aot_find_jit_info);
 
@@ -4819,6 +4821,7 @@ mono_runtime_print_stats (void)
 		g_print ("Initialized classes:    %" G_GINT32_FORMAT "\n", mono_stats.initialized_class_count);
 		g_print ("Used classes:           %" G_GINT32_FORMAT "\n", mono_stats.used_class_count);
 		g_print ("Generic vtables:        %" G_GINT32_FORMAT "\n", mono_stats.generic_vtable_count);
+		g_print ("Cached generic vtables: %" G_GINT32_FORMAT "\n", mono_stats.cached_generic_vtable_count);
 		g_print ("Methods:                %" G_GINT32_FORMAT "\n", mono_stats.method_count);
 		g_print ("Static data size:       %" G_GINT32_FORMAT "\n", mono_stats.class_static_data_size);
 		g_print ("VTable data size:       %" G_GINT32_FORMAT "\n", mono_stats.class_vtable_size);
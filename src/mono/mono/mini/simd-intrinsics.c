@@ -537,8 +537,15 @@ is_create_from_half_vectors_overload (MonoMethodSignature *fsig)
 static MonoInst*
 emit_sri_vector (MonoCompile *cfg, MonoMethod *cmethod, MonoMethodSignature *fsig, MonoInst **args)
 {
-	if (!COMPILE_LLVM (cfg))
+	if (!COMPILE_LLVM (cfg)) {
+#ifdef TARGET_ARM64
+		/* Only the 16 byte vectors are kept in vector registers by the JIT */
+		if (strcmp (m_class_get_name (cmethod->klass), "Vector128"))
+			return NULL;
+#else
 		return NULL;
+#endif
+	}
 
 	MonoClass *klass = cmethod->klass;
 	int id = lookup_intrins (sri_vector_methods, sizeof (sri_vector_methods), cmethod);
@@ -566,13 +573,15 @@ emit_sri_vector (MonoCompile *cfg, MonoMethod *cmethod, MonoMethodSignature *fsi
 		MonoType *etype = get_vector_t_elem_type (fsig->ret);
 		if (fsig->param_count == 1 && mono_metadata_type_equal (fsig->params [0], etype))
 			return emit_simd_ins (cfg, klass, type_to_expand_op (etype), args [0]->dreg, -1);
-		else if (is_create_from_half_vectors_overload (fsig))
+		else if (is_create_from_half_vectors_overload (fsig) && COMPILE_LLVM (cfg))
 			return emit_simd_ins (cfg, klass, OP_XCONCAT, args [0]->dreg, args [1]->dreg);
 		else if (is_elementwise_create_overload (fsig, etype))
 			return emit_vector_create_elementwise (cfg, fsig, fsig->ret, etype, args);
 		break;
 	}
 	case SN_CreateScalarUnsafe:
+		if (!COMPILE_LLVM (cfg))
+			break;
 		return emit_simd_ins_for_sig (cfg, klass, OP_CREATE_SCALAR_UNSAFE, -1, arg0_type, fsig, args);
 	default:
 		break;
@@ -581,6 +590,100 @@ emit_sri_vector (MonoCompile *cfg, MonoMethod *cmethod, MonoMethodSignature *fsi
 	return NULL;
 }
 
+static guint16 vector_128_t_methods [] = {
+	SN_get_Count,
+	SN_get_Zero,
+};
+
+static MonoInst*
+emit_vector128_t (MonoCompile *cfg, MonoMethod *cmethod, MonoMethodSignature *fsig, MonoInst **args)
+{
+	MonoInst *ins;
+	MonoType *type, *etype;
+	MonoClass *klass;
+	int size, len, id;
+
+	id = lookup_intrins (vector_128_t_methods, sizeof (vector_128_t_methods), cmethod);
+	if (id == -1)
+		return NULL;
+
+	klass = cmethod->klass;
+	type = m_class_get_byval_arg (klass);
+	etype = mono_class_get_context (klass)->class_inst->type_argv [0];
+	size = mono_class_value_size (mono_class_from_mono_type_internal (etype), NULL);
+	g_assert (size);
+	len = 16 / size;
+
+	if (!MONO_TYPE_IS_PRIMITIVE (etype) || etype->type == MONO_TYPE_CHAR || etype->type == MONO_TYPE_BOOLEAN || etype->type == MONO_TYPE_I || etype->type == MONO_TYPE_U)
+		return NULL;
+
+	if (cfg->verbose_level > 1) {
+		char *name = mono_method_full_name (cmethod, TRUE);
+		printf ("  SIMD intrinsic %s\n", name);
+		g_free (name);
+	}
+
+	switch (id) {
+	case SN_get_Count:
+		if (!(fsig->param_count == 0 && fsig->ret->type == MONO_TYPE_I4))
+			break;
+		EMIT_NEW_ICONST (cfg, ins, len);
+		return ins;
+	case SN_get_Zero: {
+		return emit_simd_ins (cfg, klass, OP_XZERO, -1, -1);
+	}
+	default:
+		break;
+	}
+
+	return NULL;
+}
+
+static guint16 vector_256_t_methods [] = {
+	SN_get_Count,
+};
+
+static MonoInst*
+emit_vector256_t (MonoCompile *cfg, MonoMethod *cmethod, MonoMethodSignature *fsig, MonoInst **args)
+{
+	MonoInst *ins;
+	MonoType *type, *etype;
+	MonoClass *klass;
+	int size, len, id;
+
+	id = lookup_intrins (vector_256_t_methods, sizeof (vector_256_t_methods), cmethod);
+	if (id == -1)
+		return NULL;
+
+	klass = cmethod->klass;
+	type = m_class_get_byval_arg (klass);
+	etype = mono_class_get_context (klass)->class_inst->type_argv [0];
+	size = mono_class_value_size (mono_class_from_mono_type_internal (etype), NULL);
+	g_assert (size);
+	len = 32 / size;
+
+	if (!MONO_TYPE_IS_PRIMITIVE (etype) || etype->type == MONO_TYPE_CHAR || etype->type == MONO_TYPE_BOOLEAN || etype->type == MONO_TYPE_I || etype->type == MONO_TYPE_U)
+		return NULL;
+
+	if (cfg->verbose_level > 1) {
+		char *name = mono_method_full_name (cmethod, TRUE);
+		printf ("  SIMD intrinsic %s\n", name);
+		g_free (name);
+	}
+
+	switch (id) {
+	case SN_get_Count:
+		if (!(fsig->param_count == 0 && fsig->ret->type == MONO_TYPE_I4))
+			break;
+		EMIT_NEW_ICONST (cfg, ins, len);
+		return ins;
+	default:
+		break;
+	}
+
+	return NULL;
+}
+
 #endif // defined(TARGET_AMD64) || defined(TARGET_ARM64)
 
 #ifdef TARGET_AMD64
@@ -2725,100 +2828,6 @@ emit_x86_intrinsics (
 	return NULL;
 }
 
-static guint16 vector_128_t_methods [] = {
-	SN_get_Count,
-	SN_get_Zero,
-};
-
-static MonoInst*
-emit_vector128_t (MonoCompile *cfg, MonoMethod *cmethod, MonoMethodSignature *fsig, MonoInst **args)
-{
-	MonoInst *ins;
-	MonoType *type, *etype;
-	MonoClass *klass;
-	int size, len, id;
-
-	id = lookup_intrins (vector_128_t_methods, sizeof (vector_128_t_methods), cmethod);
-	if (id == -1)
-		return NULL;
-
-	klass = cmethod->klass;
-	type = m_class_get_byval_arg (klass);
-	etype = mono_class_get_context (klass)->class_inst->type_argv [0];
-	size = mono_class_value_size (mono_class_from_mono_type_internal (etype), NULL);
-	g_assert (size);
-	len = 16 / size;
-
-	if (!MONO_TYPE_IS_PRIMITIVE (etype) || etype->type == MONO_TYPE_CHAR || etype->type == MONO_TYPE_BOOLEAN || etype->type == MONO_TYPE_I || etype->type == MONO_TYPE_U)
-		return NULL;
-
-	if (cfg->verbose_level > 1) {
-		char *name = mono_method_full_name (cmethod, TRUE);
-		printf ("  SIMD intrinsic %s\n", name);
-		g_free (name);
-	}
-
-	switch (id) {
-	case SN_get_Count:
-		if (!(fsig->param_count == 0 && fsig->ret->type == MONO_TYPE_I4))
-			break;
-		EMIT_NEW_ICONST (cfg, ins, len);
-		return ins;
-	case SN_get_Zero: {
-		return emit_simd_ins (cfg, klass, OP_XZERO, -1, -1);
-	}
-	default:
-		break;
-	}
-
-	return NULL;
-}
-
-static guint16 vector_256_t_methods [] = {
-	SN_get_Count,
-};
-
-static MonoInst*
-emit_vector256_t (MonoCompile *cfg, MonoMethod *cmethod, MonoMethodSignature *fsig, MonoInst **args)
-{
-	MonoInst *ins;
-	MonoType *type, *etype;
-	MonoClass *klass;
-	int size, len, id;
-
-	id = lookup_intrins (vector_256_t_methods, sizeof (vector_256_t_methods), cmethod);
-	if (id == -1)
-		return NULL;
-
-	klass = cmethod->klass;
-	type = m_class_get_byval_arg (klass);
-	etype = mono_class_get_context (klass)->class_inst->type_argv [0];
-	size = mono_class_value_size (mono_class_from_mono_type_internal (etype), NULL);
-	g_assert (size);
-	len = 32 / size;
-
-	if (!MONO_TYPE_IS_PRIMITIVE (etype) || etype->type == MONO_TYPE_CHAR || etype->type == MONO_TYPE_BOOLEAN || etype->type == MONO_TYPE_I || etype->type == MONO_TYPE_U)
-		return NULL;
-
-	if (cfg->verbose_level > 1) {
-		char *name = mono_method_full_name (cmethod, TRUE);
-		printf ("  SIMD intrinsic %s\n", name);
-		g_free (name);
-	}
-
-	switch (id) {
-	case SN_get_Count:
-		if (!(fsig->param_count == 0 && fsig->ret->type == MONO_TYPE_I4))
-			break;
-		EMIT_NEW_ICONST (cfg, ins, len);
-		return ins;
-	default:
-		break;
-	}
-
-	return NULL;
-}
-
 static
 MonoInst*
 emit_amd64_intrinsics (const char *class_ns, const char *class_name, MonoCompile *cfg, MonoMethod *cmethod, MonoMethodSignature *fsig, MonoInst **args)
@@ -2852,13 +2861,20 @@ static
 MonoInst*
 emit_simd_intrinsics (const char *class_ns, const char *class_name, MonoCompile *cfg, MonoMethod *cmethod, MonoMethodSignature *fsig, MonoInst **args)
 {
-	// FIXME: implement Vector64<T>, Vector128<T> and Vector<T> for Arm64
+	// FIXME: implement Vector64<T> and Vector<T> for Arm64
 	if (!strcmp (class_ns, "System.Runtime.Intrinsics.Arm")) {
 		return emit_hardware_intrinsics(cfg, cmethod, fsig, args,
 			supported_arm_intrinsics, sizeof (supported_arm_intrinsics),
 			emit_arm64_intrinsics);
 	}
 
+	if (!strcmp (class_ns, "System.Runtime.Intrinsics")) {
+		if (!strcmp (class_name, "Vector128`1"))
+			return emit_vector128_t (cfg, cmethod, fsig, args);
+		if (!strcmp (class_name, "Vector256`1"))
+			return emit_vector256_t (cfg, cmethod, fsig, args);
+	}
+
 	return NULL;
 }
 #elif TARGET_AMD64
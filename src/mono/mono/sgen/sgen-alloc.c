@@ -35,6 +35,7 @@
 #include "mono/sgen/sgen-protocol.h"
 #include "mono/sgen/sgen-memory-governor.h"
 #include "mono/sgen/sgen-client.h"
+#include "mono/sgen/sgen-pinning.h"
 #include "mono/utils/mono-memory-model.h"
 #include "mono/utils/mono-tls-inline.h"
 
@@ -442,6 +443,9 @@ sgen_alloc_obj (GCVTable vtable, size_t size)
 		}
 	}
 
+	if (G_UNLIKELY (sgen_pinned_alloc_wanted (vtable, size)))
+		return sgen_alloc_obj_pinned (vtable, size);
+
 	ENTER_CRITICAL_REGION;
 	res = sgen_try_alloc_obj_nolock (vtable, size);
 	if (res) {
@@ -49,6 +49,8 @@ guint64 scanned_objects;
 guint64 remarked_cards;
 static guint64 large_objects;
 static guint64 bloby_objects;
+static guint64 wbarrier_arrayref_cards_marked;
+static guint64 wbarrier_arrayref_marks_skipped;
 #endif
 
 mword
@@ -67,6 +69,23 @@ sgen_card_table_wbarrier_set_field (GCObject *obj, gpointer field_ptr, GCObject*
 	sgen_dummy_use (value);
 }
 
+/*
+ * Consecutive elements mostly share a card, so skip the store when the card is already
+ * marked and large copies don't keep writing the same card table cache line.  While a
+ * concurrent collection is running cards can be cleared under us, so then always store.
+ */
+static inline void
+arrayref_copy_mark_card (gpointer *dest)
+{
+	guint8 *card = sgen_card_table_get_card_address ((mword)dest);
+	if (need_mod_union || *card != 1) {
+		*card = 1;
+		HEAVY_STAT (++wbarrier_arrayref_cards_marked);
+	} else {
+		HEAVY_STAT (++wbarrier_arrayref_marks_skipped);
+	}
+}
+
 static void
 sgen_card_table_wbarrier_arrayref_copy (gpointer dest_ptr, gconstpointer src_ptr, int count)
 {
@@ -83,7 +102,7 @@ sgen_card_table_wbarrier_arrayref_copy (gpointer dest_ptr, gconstpointer src_ptr
 			gpointer value = *src;
 			SGEN_UPDATE_REFERENCE_ALLOW_NULL (dest, value);
 			if (need_mod_union || sgen_ptr_in_nursery (value))
-				sgen_card_table_mark_address ((mword)dest);
+				arrayref_copy_mark_card (dest);
 			sgen_dummy_use (value);
 		}
 	} else {
@@ -92,7 +111,7 @@ sgen_card_table_wbarrier_arrayref_copy (gpointer dest_ptr, gconstpointer src_ptr
 			gpointer value = *src;
 			SGEN_UPDATE_REFERENCE_ALLOW_NULL (dest, value);
 			if (need_mod_union || sgen_ptr_in_nursery (value))
-				sgen_card_table_mark_address ((mword)dest);
+				arrayref_copy_mark_card (dest);
 			sgen_dummy_use (value);
 		}
 	}	
@@ -619,6 +638,8 @@ sgen_card_table_init (SgenRememberedSet *remset)
 	mono_counters_register ("cardtable scanned objects", MONO_COUNTER_GC | MONO_COUNTER_ULONG, &scanned_objects);
 	mono_counters_register ("cardtable large objects", MONO_COUNTER_GC | MONO_COUNTER_ULONG, &large_objects);
 	mono_counters_register ("cardtable bloby objects", MONO_COUNTER_GC | MONO_COUNTER_ULONG, &bloby_objects);
+	mono_counters_register ("cardtable wbarrier arrayref cards marked", MONO_COUNTER_GC | MONO_COUNTER_ULONG, &wbarrier_arrayref_cards_marked);
+	mono_counters_register ("cardtable wbarrier arrayref marks skipped", MONO_COUNTER_GC | MONO_COUNTER_ULONG, &wbarrier_arrayref_marks_skipped);
 #endif
 
 	remset->wbarrier_set_field = sgen_card_table_wbarrier_set_field;
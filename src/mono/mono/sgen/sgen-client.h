@@ -156,6 +156,13 @@ gboolean sgen_client_vtable_is_inited (GCVTable vtable);
 const char* sgen_client_vtable_get_namespace (GCVTable vtable);
 const char* sgen_client_vtable_get_name (GCVTable vtable);
 
+/*
+ * The client must provide storage for SGEN_GC_BIT_PINNED_ALLOC on every vtable.  The bit
+ * is only ever set, with the world stopped.
+ */
+gboolean sgen_client_vtable_is_pinned_alloc (GCVTable vtable);
+void sgen_client_vtable_set_pinned_alloc (GCVTable vtable);
+
 /*
  * Called before starting collections.  The world is already stopped.  No action is
  * necessary.
@@ -179,9 +186,10 @@ void sgen_client_thread_register_worker (void);
 
 /*
  * The least this function needs to do is scan all registers and thread stacks.  To do this
- * conservatively, use `sgen_conservatively_pin_objects_from()`.
+ * conservatively, use `sgen_conservatively_pin_objects_from()`.  Threads are divided into
+ * `job_split_count` sets and only the `job_index`-th set is scanned.
  */
-void sgen_client_scan_thread_data (void *start_nursery, void *end_nursery, gboolean precise, ScanCopyContext ctx);
+void sgen_client_scan_thread_data (void *start_nursery, void *end_nursery, gboolean precise, int job_index, int job_split_count, ScanCopyContext ctx);
 
 /*
  * Stop and restart the world, i.e., all threads that interact with the managed heap.  For
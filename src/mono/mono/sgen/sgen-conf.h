@@ -239,6 +239,19 @@ typedef target_mword SgenDescriptor;
 #define SGEN_CEMENT_HASH(hv)	(((hv) ^ ((hv) >> SGEN_CEMENT_HASH_SHIFT)) & (SGEN_CEMENT_HASH_SIZE - 1))
 #define SGEN_CEMENT_THRESHOLD	1000
 
+/*
+ * Pinned allocation
+ *
+ * Types whose nursery instances of at least SGEN_PINNED_ALLOC_MIN_OBJ_SIZE
+ * bytes are found pinned in SGEN_PINNED_ALLOC_DEFAULT_THRESHOLD different
+ * collections are from then on allocated directly in pinned major space, so
+ * that buffers that keep getting pinned (typically for I/O) stop fragmenting
+ * the nursery.  Smaller objects are left alone, since conservative stack
+ * scanning pins them more or less at random.
+ */
+#define SGEN_PINNED_ALLOC_MIN_OBJ_SIZE		1024
+#define SGEN_PINNED_ALLOC_DEFAULT_THRESHOLD	8
+
 /*
  * Default values for the nursery size
  */
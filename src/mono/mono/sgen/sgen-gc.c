@@ -724,6 +724,7 @@ pin_objects_from_nursery_pin_queue (gboolean do_scan_objects, ScanCopyContext ct
 			pin_object (obj_to_pin);
 			GRAY_OBJECT_ENQUEUE_SERIAL (queue, obj_to_pin, desc);
 			sgen_pin_stats_register_object (obj_to_pin, GENERATION_NURSERY);
+			sgen_pinned_alloc_register_pinned (obj_to_pin, obj_to_pin_size);
 			definitely_pinned [count] = obj_to_pin;
 			count++;
 		}
@@ -899,7 +900,7 @@ pin_from_roots (void *start_nursery, void *end_nursery, ScanCopyContext ctx)
 	 * *) the _last_ managed stack frame
 	 * *) pointers slots in managed frames
 	 */
-	sgen_client_scan_thread_data (start_nursery, end_nursery, FALSE, ctx);
+	sgen_client_scan_thread_data (start_nursery, end_nursery, FALSE, 0, 1, ctx);
 }
 
 static void
@@ -1448,6 +1449,7 @@ typedef struct {
 	ScanJob scan_job;
 	char *heap_start;
 	char *heap_end;
+	int job_index, job_split_count;
 } ScanThreadDataJob;
 
 static void
@@ -1456,7 +1458,7 @@ job_scan_thread_data (void *worker_data_untyped, SgenThreadPoolJob *job)
 	ScanThreadDataJob *job_data = (ScanThreadDataJob*)job;
 	ScanCopyContext ctx = scan_copy_context_for_scan_job (worker_data_untyped, &job_data->scan_job);
 
-	sgen_client_scan_thread_data (job_data->heap_start, job_data->heap_end, TRUE, ctx);
+	sgen_client_scan_thread_data (job_data->heap_start, job_data->heap_end, TRUE, job_data->job_index, job_data->job_split_count, ctx);
 }
 
 typedef struct {
@@ -1729,6 +1731,7 @@ enqueue_scan_from_roots_jobs (SgenGrayQueue *gc_thread_gray_queue, char *heap_st
 	ScanFromRegisteredRootsJob *scrrj;
 	ScanThreadDataJob *stdj;
 	ScanFinalizerEntriesJob *sfej;
+	int i, split_count = is_parallel ? sgen_workers_get_job_split_count (sgen_current_collection_generation) : 1;
 
 	/* registered roots, this includes static fields */
 
@@ -1751,14 +1754,18 @@ enqueue_scan_from_roots_jobs (SgenGrayQueue *gc_thread_gray_queue, char *heap_st
 		sgen_workers_enqueue_deferred_job (sgen_current_collection_generation, &scrrj->scan_job.job, is_parallel);
 	}
 
-	/* Threads */
+	/* Threads, split over the workers when collecting in parallel */
 
-	stdj = (ScanThreadDataJob*)sgen_thread_pool_job_alloc ("scan thread data", job_scan_thread_data, sizeof (ScanThreadDataJob));
-	stdj->scan_job.ops = ops;
-	stdj->scan_job.gc_thread_gray_queue = gc_thread_gray_queue;
-	stdj->heap_start = heap_start;
-	stdj->heap_end = heap_end;
-	sgen_workers_enqueue_deferred_job (sgen_current_collection_generation, &stdj->scan_job.job, is_parallel);
+	for (i = 0; i < split_count; i++) {
+		stdj = (ScanThreadDataJob*)sgen_thread_pool_job_alloc ("scan thread data", job_scan_thread_data, sizeof (ScanThreadDataJob));
+		stdj->scan_job.ops = ops;
+		stdj->scan_job.gc_thread_gray_queue = gc_thread_gray_queue;
+		stdj->heap_start = heap_start;
+		stdj->heap_end = heap_end;
+		stdj->job_index = i;
+		stdj->job_split_count = split_count;
+		sgen_workers_enqueue_deferred_job (sgen_current_collection_generation, &stdj->scan_job.job, is_parallel);
+	}
 
 	/* Scan the list of objects ready for finalization. */
 
@@ -3449,6 +3456,7 @@ sgen_gc_init (void)
 	gboolean debug_print_allowance = FALSE;
 	double allowance_ratio = 0, save_target = 0;
 	gboolean cement_enabled = TRUE;
+	int pinned_alloc_threshold = SGEN_PINNED_ALLOC_DEFAULT_THRESHOLD;
 
 	do {
 		result = mono_atomic_cas_i32 (&gc_initialized, -1, 0);
@@ -3623,6 +3631,17 @@ sgen_gc_init (void)
 				continue;
 			}
 
+			if (g_str_has_prefix (opt, "pinned-alloc-threshold=")) {
+				int val;
+				opt = strchr (opt, '=') + 1;
+				val = atoi (opt);
+				if (val < 0)
+					sgen_env_var_error (MONO_GC_PARAMS_NAME, "Using default value.", "`pinned-alloc-threshold` must be a non-negative integer.");
+				else
+					pinned_alloc_threshold = val;
+				continue;
+			}
+
 			if (!strcmp (opt, "cementing")) {
 				cement_enabled = TRUE;
 				continue;
@@ -3696,6 +3715,7 @@ sgen_gc_init (void)
 			fprintf (stderr, " Experimental options:\n");
 			fprintf (stderr, "  save-target-ratio=R (where R must be between %.2f - %.2f).\n", SGEN_MIN_SAVE_TARGET_RATIO, SGEN_MAX_SAVE_TARGET_RATIO);
 			fprintf (stderr, "  default-allowance-ratio=R (where R must be between %.2f - %.2f).\n", SGEN_MIN_ALLOWANCE_NURSERY_SIZE_RATIO, SGEN_MAX_ALLOWANCE_NURSERY_SIZE_RATIO);
+			fprintf (stderr, "  pinned-alloc-threshold=N (where N is the number of collections a type must be pinned in before it is allocated pinned, 0 disables)\n");
 			fprintf (stderr, "\n");
 
 			usage_printed = TRUE;
@@ -3708,7 +3728,7 @@ sgen_gc_init (void)
 
 	alloc_nursery (dynamic_nursery, min_nursery_size, max_nursery_size);
 
-	sgen_pinning_init ();
+	sgen_pinning_init (pinned_alloc_threshold);
 	sgen_cement_init (cement_enabled);
 
 	if ((env = g_getenv (MONO_GC_DEBUG_NAME)) || gc_debug_options) {
@@ -300,6 +300,8 @@ enum {
 	SGEN_GC_BIT_BRIDGE_OBJECT = 1,
 	SGEN_GC_BIT_BRIDGE_OPAQUE_OBJECT = 2,
 	SGEN_GC_BIT_FINALIZER_AWARE = 4,
+	// Set on types that keep getting pinned in the nursery; see sgen_pinned_alloc_register_pinned ().
+	SGEN_GC_BIT_PINNED_ALLOC = 8,
 };
 
 void sgen_gc_init (void)
@@ -332,6 +334,7 @@ enum {
 	INTERNAL_MEM_STAT_PINNED_CLASS,
 	INTERNAL_MEM_STAT_REMSET_CLASS,
 	INTERNAL_MEM_STAT_GCHANDLE_CLASS,
+	INTERNAL_MEM_PINNED_ALLOC_CLASS,
 	INTERNAL_MEM_GRAY_QUEUE,
 	INTERNAL_MEM_MS_TABLES,
 	INTERNAL_MEM_MS_BLOCK_INFO,
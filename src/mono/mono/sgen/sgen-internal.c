@@ -139,6 +139,7 @@ description_for_type (int type)
 	case INTERNAL_MEM_STAT_PINNED_CLASS: return "pinned-class";
 	case INTERNAL_MEM_STAT_REMSET_CLASS: return "remset-class";
 	case INTERNAL_MEM_STAT_GCHANDLE_CLASS: return "gchandle-class";
+	case INTERNAL_MEM_PINNED_ALLOC_CLASS: return "pinned-alloc-class";
 	case INTERNAL_MEM_GRAY_QUEUE: return "gray-queue";
 	case INTERNAL_MEM_MS_TABLES: return "marksweep-tables";
 	case INTERNAL_MEM_MS_BLOCK_INFO: return "marksweep-block-info";
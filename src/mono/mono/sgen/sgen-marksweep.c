@@ -279,6 +279,7 @@ static MonoNativeTlsKey worker_block_free_list_key;
 static guint64 stat_major_blocks_alloced = 0;
 static guint64 stat_major_blocks_freed = 0;
 static guint64 stat_major_blocks_lazy_swept = 0;
+static guint64 stat_major_blocks_swept_at_major_start = 0;
 
 static guint64 stat_major_blocks_freed_ideal = 0;
 static guint64 stat_major_blocks_freed_less_ideal = 0;
@@ -1543,6 +1544,8 @@ sweep_block (MSBlockInfo *block)
 
 	set_block_state (block, BLOCK_STATE_SWEPT, BLOCK_STATE_SWEEPING);
 
+	sgen_memgov_major_sweep_block_swept ();
+
 	return TRUE;
 }
 
@@ -1728,6 +1731,7 @@ ensure_block_is_checked_for_sweeping (guint32 block_index, gboolean wait, gboole
 		gboolean has_pinned = block->has_pinned;
 
 		set_block_state (block, BLOCK_STATE_NEED_SWEEPING, BLOCK_STATE_CHECKING);
+		sgen_memgov_major_sweep_block_pending ();
 
 		/*
 		 * FIXME: Go straight to SWEPT if there are no free slots.  We need
@@ -1885,6 +1889,7 @@ major_sweep (void)
 {
 	set_sweep_state (SWEEP_STATE_SWEEPING, SWEEP_STATE_NEED_SWEEPING);
 
+	sgen_memgov_major_sweep_start ();
 	sweep_start ();
 
 	num_major_sections_before_sweep = num_major_sections;
@@ -2118,8 +2123,20 @@ major_start_major_collection (void)
 		 * sweep_blocks_job set, it means that it has already been run.
 		 */
 		SgenThreadPoolJob *job = sweep_blocks_job;
-		if (job)
+		if (job) {
+			/*
+			 * Rather than waiting for the job to get through the whole heap, help it.
+			 * It sweeps from low to high indexes so we go from high to low, and only
+			 * collide on the block where we meet.
+			 */
+			guint32 block_index;
+			for (block_index = allocated_blocks.next_slot; block_index-- > 0;) {
+				block = BLOCK_UNTAG (*sgen_array_list_get_slot (&allocated_blocks, block_index));
+				if (block && sweep_block (block))
+					++stat_major_blocks_swept_at_major_start;
+			}
 			sgen_thread_pool_job_wait (sweep_pool_context, job);
+		}
 	}
 
 	if (lazy_sweep && !concurrent_sweep)
@@ -2899,6 +2916,7 @@ sgen_marksweep_init_internal (SgenMajorCollector *collector, gboolean is_concurr
 	mono_counters_register ("# major blocks allocated", MONO_COUNTER_GC | MONO_COUNTER_ULONG, &stat_major_blocks_alloced);
 	mono_counters_register ("# major blocks freed", MONO_COUNTER_GC | MONO_COUNTER_ULONG, &stat_major_blocks_freed);
 	mono_counters_register ("# major blocks lazy swept", MONO_COUNTER_GC | MONO_COUNTER_ULONG, &stat_major_blocks_lazy_swept);
+	mono_counters_register ("# major blocks swept at major start", MONO_COUNTER_GC | MONO_COUNTER_ULONG, &stat_major_blocks_swept_at_major_start);
 	mono_counters_register ("# major blocks freed ideally", MONO_COUNTER_GC | MONO_COUNTER_ULONG, &stat_major_blocks_freed_ideal);
 	mono_counters_register ("# major blocks freed less ideally", MONO_COUNTER_GC | MONO_COUNTER_ULONG, &stat_major_blocks_freed_less_ideal);
 	mono_counters_register ("# major blocks freed individually", MONO_COUNTER_GC | MONO_COUNTER_ULONG, &stat_major_blocks_freed_individual);
@@ -55,6 +55,13 @@ static mword total_alloc_max = 0;
 static SGEN_TV_DECLARE(last_minor_start);
 static SGEN_TV_DECLARE(last_major_start);
 
+/*
+ * Lazy sweep progress of the last major collection: the number of blocks the sweep marked
+ * as needing sweeping, and how many of them have been swept since.
+ */
+static volatile mword major_sweep_blocks_pending;
+static volatile mword major_sweep_blocks_swept;
+
 /* GC triggers. */
 
 static gboolean debug_print_allowance = FALSE;
@@ -243,6 +250,32 @@ sgen_memgov_major_post_sweep (mword used_slots_size)
 	last_used_slots_size = used_slots_size;
 }
 
+void
+sgen_memgov_major_sweep_start (void)
+{
+	major_sweep_blocks_pending = 0;
+	major_sweep_blocks_swept = 0;
+}
+
+void
+sgen_memgov_major_sweep_block_pending (void)
+{
+	SGEN_ATOMIC_ADD_P (major_sweep_blocks_pending, 1);
+}
+
+void
+sgen_memgov_major_sweep_block_swept (void)
+{
+	SGEN_ATOMIC_ADD_P (major_sweep_blocks_swept, 1);
+}
+
+void
+sgen_memgov_get_sweep_progress (mword *blocks_swept, mword *blocks_pending)
+{
+	*blocks_swept = major_sweep_blocks_swept;
+	*blocks_pending = major_sweep_blocks_pending;
+}
+
 void
 sgen_memgov_major_collection_start (gboolean concurrent, const char *reason)
 {
@@ -493,6 +526,8 @@ sgen_memgov_init (size_t max_heap, size_t soft_limit, gboolean debug_allowance,
 
 	mono_counters_register ("Memgov alloc", MONO_COUNTER_GC | MONO_COUNTER_WORD | MONO_COUNTER_BYTES | MONO_COUNTER_VARIABLE, (void*)&total_alloc);
 	mono_counters_register ("Memgov max alloc", MONO_COUNTER_GC | MONO_COUNTER_WORD | MONO_COUNTER_BYTES | MONO_COUNTER_MONOTONIC, (void*)&total_alloc_max);
+	mono_counters_register ("Memgov major sweep blocks pending", MONO_COUNTER_GC | MONO_COUNTER_WORD | MONO_COUNTER_VARIABLE, (void*)&major_sweep_blocks_pending);
+	mono_counters_register ("Memgov major sweep blocks swept", MONO_COUNTER_GC | MONO_COUNTER_WORD | MONO_COUNTER_VARIABLE, (void*)&major_sweep_blocks_swept);
 
 	mono_os_mutex_init (&log_entries_mutex);
 
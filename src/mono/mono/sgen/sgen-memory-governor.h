@@ -19,6 +19,10 @@ void sgen_memgov_minor_collection_end (const char *reason, gboolean is_overflow)
 
 void sgen_memgov_major_pre_sweep (void);
 void sgen_memgov_major_post_sweep (mword used_slots_size);
+void sgen_memgov_major_sweep_start (void);
+void sgen_memgov_major_sweep_block_pending (void);
+void sgen_memgov_major_sweep_block_swept (void);
+void sgen_memgov_get_sweep_progress (mword *blocks_swept, mword *blocks_pending);
 void sgen_memgov_major_collection_start (gboolean concurrent, const char *reason);
 void sgen_memgov_major_collection_end (gboolean forced, gboolean concurrent, const char *reason, gboolean is_overflow);
 
@@ -32,16 +32,34 @@ static mono_mutex_t pin_queue_mutex;
 #define PIN_HASH_SIZE 1024
 static void *pin_hash_filter [PIN_HASH_SIZE];
 
+typedef struct {
+	guint32 last_collection;
+	int num_collections;
+} PinnedAllocClassEntry;
+
+/*
+ * Keyed by vtable.  Entries are dropped once their type switches to pinned
+ * allocation, so this only holds types that have been pinned, but not often enough.
+ */
+static SgenHashTable pinned_alloc_class_hash_table = SGEN_HASH_TABLE_INIT (INTERNAL_MEM_PIN_QUEUE, INTERNAL_MEM_PINNED_ALLOC_CLASS, sizeof (PinnedAllocClassEntry), sgen_aligned_addr_hash, NULL);
+static int pinned_alloc_threshold = SGEN_PINNED_ALLOC_DEFAULT_THRESHOLD;
+static guint32 pinning_collection = 0;
+static guint64 stat_pinned_alloc_classes = 0;
+
 void
-sgen_pinning_init (void)
+sgen_pinning_init (int pinned_alloc_collections)
 {
 	mono_os_mutex_init (&pin_queue_mutex);
+	pinned_alloc_threshold = pinned_alloc_collections;
+
+	mono_counters_register ("# classes switched to pinned allocation", MONO_COUNTER_GC | MONO_COUNTER_ULONG, &stat_pinned_alloc_classes);
 }
 
 void
 sgen_init_pinning (void)
 {
 	memset (pin_hash_filter, 0, sizeof (pin_hash_filter));
+	++pinning_collection;
 	pin_queue.mem_type = INTERNAL_MEM_PIN_QUEUE;
 	sgen_client_pinning_start ();
 }
@@ -72,6 +90,52 @@ sgen_pinning_register_pinned_in_nursery (GCObject *obj)
 	sgen_pointer_queue_add (&pin_queue_objs, obj);
 }
 
+/*
+ * Called for every object pinned in the nursery from the pin queue.  Once objects of a
+ * type have been pinned in `pinned_alloc_threshold` different collections, we flag the
+ * type so that its large enough instances are allocated in pinned major space.  Objects
+ * can't be moved out of the nursery while they are pinned, so this only helps instances
+ * allocated after that.
+ */
+void
+sgen_pinned_alloc_register_pinned (GCObject *obj, size_t size)
+{
+	GCVTable vtable;
+	PinnedAllocClassEntry *entry;
+	PinnedAllocClassEntry empty_entry = { 0, 0 };
+
+	if (pinned_alloc_threshold <= 0 || size < SGEN_PINNED_ALLOC_MIN_OBJ_SIZE || size > SGEN_MAX_SMALL_OBJ_SIZE)
+		return;
+
+	vtable = SGEN_LOAD_VTABLE (obj);
+	if (sgen_client_vtable_is_pinned_alloc (vtable))
+		return;
+
+	entry = (PinnedAllocClassEntry *)sgen_hash_table_lookup (&pinned_alloc_class_hash_table, vtable);
+	if (!entry) {
+		sgen_hash_table_replace (&pinned_alloc_class_hash_table, vtable, &empty_entry, NULL);
+		entry = (PinnedAllocClassEntry *)sgen_hash_table_lookup (&pinned_alloc_class_hash_table, vtable);
+	}
+
+	if (entry->last_collection == pinning_collection)
+		return;
+	entry->last_collection = pinning_collection;
+
+	if (++entry->num_collections < pinned_alloc_threshold)
+		return;
+
+	SGEN_LOG (2, "Switching %s to pinned allocation", sgen_client_vtable_get_name (vtable));
+	sgen_client_vtable_set_pinned_alloc (vtable);
+	sgen_hash_table_remove (&pinned_alloc_class_hash_table, vtable, NULL);
+	++stat_pinned_alloc_classes;
+}
+
+gboolean
+sgen_pinned_alloc_wanted (GCVTable vtable, size_t size)
+{
+	return size >= SGEN_PINNED_ALLOC_MIN_OBJ_SIZE && size <= SGEN_MAX_SMALL_OBJ_SIZE && sgen_client_vtable_is_pinned_alloc (vtable);
+}
+
 void
 sgen_scan_pin_queue_objects (ScanCopyContext ctx)
 {
@@ -19,7 +19,7 @@ enum {
 	PIN_TYPE_MAX
 };
 
-void sgen_pinning_init (void);
+void sgen_pinning_init (int pinned_alloc_collections);
 void sgen_pin_stage_ptr (void *ptr);
 void sgen_optimize_pin_queue (void);
 void sgen_init_pinning (void);
@@ -40,6 +40,11 @@ void sgen_find_section_pin_queue_start_end (GCMemSection *section);
 void** sgen_pinning_get_entry (size_t index);
 void sgen_pin_objects_in_section (GCMemSection *section, ScanCopyContext ctx);
 
+/* Pinned allocation of types that are pinned repeatedly */
+
+void sgen_pinned_alloc_register_pinned (GCObject *obj, size_t size);
+gboolean sgen_pinned_alloc_wanted (GCVTable vtable, size_t size);
+
 /* Pinning stats */
 
 #ifndef DISABLE_SGEN_DEBUG_HELPERS
@@ -0,0 +1,233 @@
+/*
+ * test-lock-free-bench.c: Microbenchmarks for the hazard pointers, the lock free
+ * queue and the lock free allocator.
+ *
+ * Each benchmark runs with an increasing number of threads and prints the
+ * throughput, so the scalability of the primitives can be compared between changes.
+ *
+ * Licensed under the MIT license. See LICENSE file in the project root for full license information.
+ */
+
+#include <assert.h>
+#include <pthread.h>
+#include <stdio.h>
+
+#include <config.h>
+#include <mono/metadata/metadata.h>
+#include <mono/utils/mono-threads.h>
+#include <mono/utils/hazard-pointer.h>
+#include <mono/utils/lock-free-queue.h>
+#include <mono/utils/lock-free-alloc.h>
+#include <mono/utils/mono-mmap.h>
+#include <mono/utils/mono-time.h>
+#include <mono/utils/atomic.h>
+
+#define MAX_THREADS 16
+#define NUM_ITERS 200000
+
+/* Objects freed through the hazard pointer machinery */
+#define HAZARD_OBJECTS 64
+
+#define ALLOC_SLOT_SIZE 32
+#define ALLOC_BATCH 16
+
+typedef void* (*worker_func) (void *arg);
+
+typedef struct {
+	int index;
+	pthread_t thread;
+} thread_data_t;
+
+static volatile gint32 start_flag;
+static volatile gint32 num_ready;
+
+static gpointer volatile hazard_objects [HAZARD_OBJECTS];
+static volatile gint32 num_freed;
+
+static MonoLockFreeQueue queue;
+static volatile gint32 num_dequeued;
+
+static MonoLockFreeAllocSizeClass alloc_size_class;
+static MonoLockFreeAllocator allocator;
+
+static void
+wait_for_start (void)
+{
+	mono_atomic_inc_i32 (&num_ready);
+	while (!start_flag)
+		mono_thread_info_yield ();
+}
+
+static void
+free_object (gpointer p)
+{
+	mono_atomic_inc_i32 (&num_freed);
+	g_free (p);
+}
+
+/*
+ * Replace shared objects while other threads read them through hazard pointers,
+ * which is the pattern used by the JIT info table and the linked list set.
+ */
+static void*
+hazard_worker (void *arg)
+{
+	thread_data_t *data = (thread_data_t *)arg;
+	MonoThreadHazardPointers *hp;
+	int i;
+
+	mono_thread_info_register_small_id ();
+	hp = mono_hazard_pointer_get ();
+	wait_for_start ();
+
+	for (i = 0; i < NUM_ITERS; ++i) {
+		int slot = (i * 7 + data->index) % HAZARD_OBJECTS;
+
+		if (i % 4 == 0) {
+			gpointer old = mono_atomic_xchg_ptr ((gpointer*)&hazard_objects [slot], g_new0 (int, 1));
+			mono_thread_hazardous_try_free (old, free_object);
+		} else {
+			int *p = (int *)mono_get_hazardous_pointer ((gpointer volatile*)&hazard_objects [slot], hp, 0);
+			assert (p);
+			mono_atomic_inc_i32 (p);
+			mono_hazard_pointer_clear (hp, 0);
+		}
+
+		if (i % 64 == 0)
+			mono_thread_hazardous_try_free_some ();
+	}
+
+	return NULL;
+}
+
+static void*
+queue_worker (void *arg)
+{
+	MonoLockFreeQueueNode *node;
+	int i;
+
+	mono_thread_info_register_small_id ();
+	wait_for_start ();
+
+	for (i = 0; i < NUM_ITERS; ++i) {
+		if (i % 2 == 0) {
+			node = g_new0 (MonoLockFreeQueueNode, 1);
+			mono_lock_free_queue_node_init (node, FALSE);
+			mono_lock_free_queue_enqueue (&queue, node);
+		} else if ((node = mono_lock_free_queue_dequeue (&queue))) {
+			mono_atomic_inc_i32 (&num_dequeued);
+			/* Other dequeuers might still be looking at the node */
+			mono_thread_hazardous_try_free (node, g_free);
+		}
+
+		if (i % 64 == 0)
+			mono_thread_hazardous_try_free_some ();
+	}
+
+	return NULL;
+}
+
+static void*
+alloc_worker (void *arg)
+{
+	gpointer objects [ALLOC_BATCH];
+	int i, j;
+
+	mono_thread_info_register_small_id ();
+	wait_for_start ();
+
+	for (i = 0; i < NUM_ITERS / ALLOC_BATCH; ++i) {
+		for (j = 0; j < ALLOC_BATCH; ++j) {
+			objects [j] = mono_lock_free_alloc (&allocator);
+			assert (objects [j]);
+		}
+		for (j = 0; j < ALLOC_BATCH; ++j)
+			mono_lock_free_free (objects [j], alloc_size_class.block_size);
+
+		if (i % 4 == 0)
+			mono_thread_hazardous_try_free_some ();
+	}
+
+	return NULL;
+}
+
+static void
+run (const char *name, worker_func func, int num_threads, int ops_per_thread)
+{
+	thread_data_t thread_data [MAX_THREADS];
+	gint64 start, elapsed;
+	int i;
+
+	start_flag = 0;
+	num_ready = 0;
+
+	for (i = 0; i < num_threads; ++i) {
+		int result;
+
+		thread_data [i].index = i;
+		result = pthread_create (&thread_data [i].thread, NULL, func, &thread_data [i]);
+		assert (!result);
+	}
+
+	while (num_ready < num_threads)
+		mono_thread_info_yield ();
+
+	start = mono_100ns_ticks ();
+	mono_atomic_store_i32 (&start_flag, 1);
+
+	for (i = 0; i < num_threads; ++i) {
+		int result = pthread_join (thread_data [i].thread, NULL);
+		assert (!result);
+	}
+
+	elapsed = mono_100ns_ticks () - start;
+	if (elapsed <= 0)
+		elapsed = 1;
+
+	printf ("%-16s threads %2d  %8.0f ms  %10.0f ops/s\n", name, num_threads, elapsed / 10000.0,
+		(double)num_threads * ops_per_thread * 10000000.0 / elapsed);
+}
+
+#ifdef __cplusplus
+extern "C"
+#endif
+int
+test_lock_free_bench_main (void);
+
+int
+test_lock_free_bench_main (void)
+{
+	MonoLockFreeQueueNode *node;
+	int num_threads, i;
+
+	mono_metadata_init ();
+
+	mono_thread_info_init (0);
+
+	for (i = 0; i < HAZARD_OBJECTS; ++i)
+		hazard_objects [i] = g_new0 (int, 1);
+
+	mono_lock_free_queue_init (&queue);
+
+	mono_lock_free_allocator_init_size_class (&alloc_size_class, ALLOC_SLOT_SIZE, mono_pagesize ());
+	mono_lock_free_allocator_init_allocator (&allocator, &alloc_size_class, MONO_MEM_ACCOUNT_OTHER);
+
+	for (num_threads = 1; num_threads <= MAX_THREADS; num_threads *= 2) {
+		run ("hazard pointers", hazard_worker, num_threads, NUM_ITERS);
+		run ("lock free queue", queue_worker, num_threads, NUM_ITERS);
+		run ("lock free alloc", alloc_worker, num_threads, (NUM_ITERS / ALLOC_BATCH) * ALLOC_BATCH * 2);
+	}
+
+	/* Drain the queue and the delayed free list so the counts below are final */
+	while ((node = mono_lock_free_queue_dequeue (&queue))) {
+		mono_atomic_inc_i32 (&num_dequeued);
+		mono_thread_hazardous_try_free (node, g_free);
+	}
+	mono_thread_hazardous_try_free_all ();
+
+	assert (mono_lock_free_allocator_check_consistency (&allocator));
+
+	printf ("freed %d hazardous objects, dequeued %d nodes\n", num_freed, num_dequeued);
+
+	return 0;
+}
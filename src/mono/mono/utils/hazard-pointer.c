@@ -8,6 +8,7 @@
 
 #include <config.h>
 
+#include <stdlib.h>
 #include <string.h>
 
 #include <mono/utils/hazard-pointer.h>
@@ -64,6 +65,7 @@ static int small_id_next;
 static int highest_small_id = -1;
 static MonoBitSet *small_id_table;
 static int hazardous_pointer_count;
+static gint32 hazardous_pointer_scans, hazardous_pointer_requeues;
 
 /*
  * Allocate a small thread id.
@@ -356,36 +358,90 @@ mono_hazard_pointer_install_free_queue_size_callback (MonoHazardFreeQueueSizeCal
 	queue_size_cb = cb;
 }
 
+static int
+compare_pointers (const void *a, const void *b)
+{
+	gsize pa = (gsize)*(const gpointer*)a;
+	gsize pb = (gsize)*(const gpointer*)b;
+
+	return pa < pb ? -1 : (pa > pb ? 1 : 0);
+}
+
+/*
+ * Copy the non-NULL hazard pointers of all threads into a sorted array, so that
+ * checking a batch of delayed items costs one scan of the hazard table instead of one
+ * scan per item. Returns the number of pointers stored in *SNAPSHOT.
+ */
+static int
+snapshot_hazard_pointers (gpointer **snapshot)
+{
+	int i, j, n = 0;
+	int highest = highest_small_id;
+	gpointer *pointers;
+
+	g_assert (highest < hazard_table_size);
+
+	pointers = g_new (gpointer, (highest + 1) * HAZARD_POINTER_COUNT);
+	for (i = 0; i <= highest; ++i) {
+		for (j = 0; j < HAZARD_POINTER_COUNT; ++j) {
+			gpointer p = hazard_table [i].hazard_pointers [j];
+			if (p)
+				pointers [n ++] = p;
+			LOAD_LOAD_FENCE;
+		}
+	}
+
+	qsort (pointers, n, sizeof (gpointer), compare_pointers);
+
+	*snapshot = pointers;
+	return n;
+}
+
 static void
 try_free_delayed_free_items (guint32 limit)
 {
-	GArray *hazardous = NULL;
+	GArray *items;
 	DelayedFreeItem item;
-	guint32 freed = 0;
+	gpointer *snapshot;
+	int num_hazardous;
+	guint32 i, requeued = 0;
+
+	/*
+	 * Pop the items before taking the snapshot, they were all retired before this point so
+	 * a thread which sets a hazard pointer to one of them after the snapshot is taken
+	 * would fail the check in mono_get_hazardous_pointer ().
+	 */
+	items = g_array_sized_new (FALSE, FALSE, sizeof (DelayedFreeItem), limit ? limit : delayed_free_queue.num_used_entries);
+	while ((!limit || items->len < limit) && mono_lock_free_array_queue_pop (&delayed_free_queue, &item))
+		g_array_append_val (items, item);
+
+	if (!items->len) {
+		g_array_free (items, TRUE);
+		return;
+	}
+
+	mono_memory_barrier ();
+	num_hazardous = snapshot_hazard_pointers (&snapshot);
 
 	// Free all the items we can and re-add the ones we can't to the queue.
-	while (mono_lock_free_array_queue_pop (&delayed_free_queue, &item)) {
-		if (is_pointer_hazardous (item.p)) {
-			if (!hazardous)
-				hazardous = g_array_sized_new (FALSE, FALSE, sizeof (DelayedFreeItem), delayed_free_queue.num_used_entries);
+	for (i = 0; i < items->len; i++) {
+		DelayedFreeItem *it = &g_array_index (items, DelayedFreeItem, i);
 
-			g_array_append_val (hazardous, item);
+		if (num_hazardous && bsearch (&it->p, snapshot, num_hazardous, sizeof (gpointer), compare_pointers)) {
+			mono_lock_free_array_queue_push (&delayed_free_queue, it);
+			requeued++;
 			continue;
 		}
 
-		item.free_func (item.p);
-		freed++;
-
-		if (limit && freed == limit)
-			break;
+		it->free_func (it->p);
 	}
 
-	if (hazardous) {
-		for (gint i = 0; i < hazardous->len; i++)
-			mono_lock_free_array_queue_push (&delayed_free_queue, &g_array_index (hazardous, DelayedFreeItem, i));
+	mono_atomic_inc_i32 (&hazardous_pointer_scans);
+	if (requeued)
+		mono_atomic_add_i32 (&hazardous_pointer_requeues, requeued);
 
-		g_array_free (hazardous, TRUE);
-	}
+	g_free (snapshot);
+	g_array_free (items, TRUE);
 }
 
 void
@@ -407,6 +463,8 @@ mono_thread_smr_init (void)
 
 	mono_os_mutex_init (&small_id_mutex);
 	mono_counters_register ("Hazardous pointers", MONO_COUNTER_JIT | MONO_COUNTER_INT, &hazardous_pointer_count);
+	mono_counters_register ("Hazardous pointer table scans", MONO_COUNTER_JIT | MONO_COUNTER_INT, &hazardous_pointer_scans);
+	mono_counters_register ("Hazardous pointers requeued", MONO_COUNTER_JIT | MONO_COUNTER_INT, &hazardous_pointer_requeues);
 
 	for (i = 0; i < HAZARD_TABLE_OVERFLOW; ++i) {
 		int small_id = mono_thread_small_id_alloc ();
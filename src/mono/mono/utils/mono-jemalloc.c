@@ -9,11 +9,48 @@
 
 #ifdef MONO_JEMALLOC_ENABLED
 
+static gboolean jemalloc_inited;
+
 void 
 mono_init_jemalloc (void)
 {
 	GMemVTable g_mem_vtable = { MONO_JEMALLOC_MALLOC, MONO_JEMALLOC_REALLOC, MONO_JEMALLOC_FREE, MONO_JEMALLOC_CALLOC};
 	g_mem_set_vtable (&g_mem_vtable);
+	jemalloc_inited = TRUE;
+}
+
+guint
+mono_jemalloc_arena_new (void)
+{
+	unsigned arena;
+	size_t len = sizeof (arena);
+
+	if (!jemalloc_inited)
+		return 0;
+	if (MONO_JEMALLOC_MALLCTL ("arenas.create", &arena, &len, NULL, 0) != 0)
+		return 0;
+	return arena;
+}
+
+gpointer
+mono_jemalloc_arena_malloc (guint arena, size_t size)
+{
+	gpointer res;
+
+	/* Bypass the thread cache, destroying an arena requires that nothing of it is cached. */
+	res = MONO_JEMALLOC_MALLOCX (size, MALLOCX_ARENA (arena) | MALLOCX_TCACHE_NONE);
+	if (!res)
+		g_error ("%s: failed to allocate %" G_GSIZE_FORMAT "u bytes in arena %u", __func__, size, arena);
+	return res;
+}
+
+void
+mono_jemalloc_arena_destroy (guint arena)
+{
+	char cmd [64];
+
+	g_snprintf (cmd, sizeof (cmd), "arena.%u.destroy", arena);
+	MONO_JEMALLOC_MALLCTL (cmd, NULL, NULL, NULL, 0);
 }
 
 #else
@@ -9,6 +9,7 @@
 
 #if defined(MONO_JEMALLOC_ENABLED)
 
+#include <glib.h>
 #include <jemalloc/jemalloc.h>
 
 /* Jemalloc can be configured in three ways.
@@ -27,9 +28,20 @@
 #define MONO_JEMALLOC_REALLOC mono_jerealloc
 #define MONO_JEMALLOC_FREE mono_jefree
 #define MONO_JEMALLOC_CALLOC mono_jecalloc
+#define MONO_JEMALLOC_MALLOCX mono_jemallocx
+#define MONO_JEMALLOC_MALLCTL mono_jemallctl
 
 void mono_init_jemalloc (void);
 
+/*
+ * Private arenas, so that a set of allocations with a common lifetime can be released in
+ * one go, without freeing each block.  Arena 0 means "no arena": it is returned when
+ * jemalloc hasn't been enabled at run-time or when the arena can't be created.
+ */
+guint mono_jemalloc_arena_new (void);
+gpointer mono_jemalloc_arena_malloc (guint arena, size_t size);
+void mono_jemalloc_arena_destroy (guint arena);
+
 #endif
 
 #endif
@@ -206,6 +206,8 @@ typedef struct WasmAssembly_ WasmAssembly;
 
 struct WasmAssembly_ {
 	MonoBundledAssembly assembly;
+	/* Whether the assembly is part of the bundle registered by mono_wasm_load_runtime */
+	gboolean bundled;
 	WasmAssembly *next;
 };
 
@@ -233,6 +235,13 @@ mono_wasm_add_assembly (const char *name, const unsigned char *data, unsigned in
 	return mono_has_pdb_checksum ((char*)data, size);
 }
 
+static gboolean
+wasm_assembly_name_matches (WasmAssembly *entry, const char *assembly_name)
+{
+	int entry_name_minus_extn_len = strlen(entry->assembly.name) - 4;
+	return entry_name_minus_extn_len == strlen(assembly_name) && strncmp (entry->assembly.name, assembly_name, entry_name_minus_extn_len) == 0;
+}
+
 int
 mono_wasm_assembly_already_added (const char *assembly_name)
 {
@@ -241,8 +250,7 @@ mono_wasm_assembly_already_added (const char *assembly_name)
 
 	WasmAssembly *entry = assemblies;
 	while (entry != NULL) {
-		int entry_name_minus_extn_len = strlen(entry->assembly.name) - 4;
-		if (entry_name_minus_extn_len == strlen(assembly_name) && strncmp (entry->assembly.name, assembly_name, entry_name_minus_extn_len) == 0)
+		if (wasm_assembly_name_matches (entry, assembly_name))
 			return 1;
 		entry = entry->next;
 	}
@@ -250,6 +258,40 @@ mono_wasm_assembly_already_added (const char *assembly_name)
 	return 0;
 }
 
+/*
+ * wasm_lazy_assembly_preload_hook:
+ *
+ *   Assemblies marked as lazy are downloaded by mono_wasm_load_lazy_assembly () after the
+ * runtime has started, so they are not part of the bundle. Load them from the bytes added
+ * by mono_wasm_add_assembly () when they are first referenced.
+ */
+static MonoAssembly*
+wasm_lazy_assembly_preload_hook (MonoAssemblyName *aname, char **assemblies_path, void *user_data)
+{
+	const char *name = mono_assembly_name_get_name (aname);
+	const char *culture = mono_assembly_name_get_culture (aname);
+
+	if (culture && culture [0])
+		return NULL;
+
+	for (WasmAssembly *entry = assemblies; entry; entry = entry->next) {
+		if (entry->bundled || !wasm_assembly_name_matches (entry, name))
+			continue;
+
+		MonoImageOpenStatus status;
+		MonoImage *image = mono_image_open_from_data_with_name ((char*)entry->assembly.data, entry->assembly.size, FALSE, &status, FALSE, entry->assembly.name);
+		if (!image)
+			return NULL;
+
+		MonoAssembly *assembly = mono_assembly_load_from_full (image, entry->assembly.name, &status, FALSE);
+		if (!assembly)
+			mono_image_close (image);
+		return assembly;
+	}
+
+	return NULL;
+}
+
 typedef struct WasmSatelliteAssembly_ WasmSatelliteAssembly;
 
 struct WasmSatelliteAssembly_ {
@@ -556,11 +598,13 @@ mono_wasm_load_runtime (const char *unused, int debug_level)
 		int i = 0;
 		while (cur) {
 			bundle_array [i] = &cur->assembly;
+			cur->bundled = TRUE;
 			cur = cur->next;
 			++i;
 		}
 		mono_register_bundled_assemblies ((const MonoBundledAssembly **)bundle_array);
 	}
+	mono_install_assembly_preload_hook (wasm_lazy_assembly_preload_hook, NULL);
 
 	mono_wasm_register_bundled_satellite_assemblies ();
 	mono_trace_init ();
@@ -81,6 +81,7 @@ var MonoSupportLib = {
 			module ["mono_wasm_get_icudt_name"] = MONO.mono_wasm_get_icudt_name.bind(MONO);
 			module ["mono_wasm_globalization_init"] = MONO.mono_wasm_globalization_init.bind(MONO);
 			module ["mono_wasm_get_loaded_files"] = MONO.mono_wasm_get_loaded_files.bind(MONO);
+			module ["mono_wasm_load_lazy_assembly"] = MONO.mono_wasm_load_lazy_assembly.bind(MONO);
 			module ["mono_wasm_new_root_buffer"] = MONO.mono_wasm_new_root_buffer.bind(MONO);
 			module ["mono_wasm_new_root_buffer_from_pointer"] = MONO.mono_wasm_new_root_buffer_from_pointer.bind(MONO);
 			module ["mono_wasm_new_root"] = MONO.mono_wasm_new_root.bind(MONO);
@@ -1679,6 +1680,9 @@ var MonoSupportLib = {
 		//        virtual_path: (optional) if specified, overrides the path of the asset in
 		//          the virtual filesystem and similar data structures once loaded.
 		//        is_optional: (optional) if true, any failure to load this asset will be ignored.
+		//        is_lazy: (optional) only valid for "assembly" assets. if true, the asset is not
+		//          downloaded during startup, it is fetched by mono_wasm_load_lazy_assembly once
+		//          the application needs it and the runtime loads it when it is first referenced.
 		//    loaded_cb: (required) a function () invoked when loading has completed.
 		//    fetch_file_cb: (optional) a function (string) invoked to fetch a given file.
 		//      If no callback is provided a default implementation appropriate for the current
@@ -1738,6 +1742,91 @@ var MonoSupportLib = {
 			return Module.ccall ('mono_wasm_get_icudt_name', 'string', ['string'], [culture]);
 		},
 
+		_get_asset_url: function (args, asset, sourcePrefix) {
+			// HACK: Special-case because MSBuild doesn't allow "" as an attribute
+			if (sourcePrefix === "./")
+				sourcePrefix = "";
+
+			if (sourcePrefix.trim() !== "")
+				return sourcePrefix + asset.name;
+
+			if (asset.behavior === "assembly")
+				return locateFile (args.assembly_root + "/" + asset.name);
+			if (asset.behavior === "resource") {
+				var path = asset.culture !== '' ? `${asset.culture}/${asset.name}` : asset.name;
+				return locateFile (args.assembly_root + "/" + path);
+			}
+			return asset.name;
+		},
+
+		// Returns a promise resolving to { url, buffer } once @asset has been fetched from the
+		//  first source that provides it.
+		_fetch_asset: function (args, fetch_file_cb, asset) {
+			var sourcesList = asset.load_remote ? args.remote_sources : [""];
+			var sourceIndex = 0;
+
+			var attemptNextSource = function () {
+				if (sourceIndex >= sourcesList.length)
+					return Promise.reject (new Error ("MONO_WASM: Failed to load " + asset.name));
+
+				var attemptUrl = MONO._get_asset_url (args, asset, sourcesList[sourceIndex++]);
+				return Promise.resolve (fetch_file_cb (attemptUrl)).then (function (response) {
+					if (!response.ok)
+						return attemptNextSource ();
+					return response ['arrayBuffer'] ().then (function (buffer) {
+						return { url: response.url, buffer: buffer };
+					});
+				}, attemptNextSource);
+			};
+
+			return attemptNextSource ();
+		},
+
+		// Downloads an assembly which was passed to mono_load_runtime_and_bcl_args with
+		//  is_lazy: true, along with its pdb if debugging is enabled. The runtime loads the
+		//  assembly when it is first referenced after the returned promise resolves.
+		// @name is the name of the asset, with or without the extension.
+		mono_wasm_load_lazy_assembly: function (name) {
+			var lazy = this._lazy_assemblies;
+			if (!lazy)
+				return Promise.reject (new Error ("MONO_WASM: The runtime has not been started"));
+
+			var baseName = name.replace (/\.(dll|pdb)$/, "");
+			var asset = lazy.assets [baseName + ".dll"];
+			if (!asset)
+				return Promise.reject (new Error ("MONO_WASM: " + name + " is not a lazy assembly"));
+
+			if (!asset.pending) {
+				var toLoad = [asset];
+				var pdb = lazy.assets [baseName + ".pdb"];
+				if (pdb && lazy.args.debug_level)
+					toLoad.push (pdb);
+
+				asset.pending = Promise.all (toLoad.map (function (item) {
+					return MONO._fetch_asset (lazy.args, lazy.fetch_file_cb, item).then (function (result) {
+						return { asset: item, result: result };
+					}, function (exc) {
+						if (item !== asset)
+							return null;
+						throw exc;
+					});
+				})).then (function (loaded) {
+					// Add the pdb first, so the symbols are there when the assembly is opened
+					loaded.reverse ().forEach (function (entry) {
+						if (entry)
+							MONO._handle_loaded_asset (lazy.ctx, entry.asset, entry.result.url, entry.result.buffer);
+					});
+					MONO.loaded_files = lazy.ctx.loaded_files.map (value => value.url);
+					return true;
+				}, function (exc) {
+					asset.pending = null;
+					throw exc;
+				});
+			}
+
+			return asset.pending;
+		},
+
 		_finalize_startup: function (args, ctx) {
 			var loaded_files_with_debug_info = [];
 
@@ -1791,9 +1880,11 @@ var MonoSupportLib = {
 			if (!args.loaded_cb)
 				throw new Error ("loaded_cb not provided");
 
+			var assets = args.assets.filter (asset => !(asset.is_lazy && asset.behavior === "assembly"));
+
 			var ctx = {
 				tracing: args.diagnostic_tracing || false,
-				pending_count: args.assets.length,
+				pending_count: assets.length,
 				mono_wasm_add_assembly: Module.cwrap ('mono_wasm_add_assembly', 'number', ['string', 'number', 'number']),
 				mono_wasm_add_satellite_assembly: Module.cwrap ('mono_wasm_add_satellite_assembly', 'void', ['string', 'string', 'number', 'number']),
 				loaded_assets: Object.create (null),
@@ -1810,6 +1901,17 @@ var MonoSupportLib = {
 
 			var fetch_file_cb = this._get_fetch_file_cb_from_args (args);
 
+			this._lazy_assemblies = {
+				args: args,
+				ctx: ctx,
+				fetch_file_cb: fetch_file_cb,
+				assets: Object.create (null)
+			};
+			args.assets.forEach (function (asset) {
+				if (assets.indexOf (asset) < 0)
+					MONO._lazy_assemblies.assets [asset.name] = asset;
+			});
+
 			var onPendingRequestComplete = function () {
 				--ctx.pending_count;
 
@@ -1834,7 +1936,12 @@ var MonoSupportLib = {
 				}
 			};
 
-			args.assets.forEach (function (asset) {
+			if (ctx.pending_count === 0) {
+				this._finalize_startup (args, ctx);
+				return;
+			}
+
+			assets.forEach (function (asset) {
 				var attemptNextSource;
 				var sourceIndex = 0;
 				var sourcesList = asset.load_remote ? args.remote_sources : [""];
@@ -1877,27 +1984,9 @@ var MonoSupportLib = {
 						}
 					}
 
-					var sourcePrefix = sourcesList[sourceIndex];
+					var attemptUrl = MONO._get_asset_url (args, asset, sourcesList[sourceIndex]);
 					sourceIndex++;
 
-					// HACK: Special-case because MSBuild doesn't allow "" as an attribute
-					if (sourcePrefix === "./")
-						sourcePrefix = "";
-
-					var attemptUrl;
-					if (sourcePrefix.trim() === "") {
-						if (asset.behavior === "assembly")
-							attemptUrl = locateFile (args.assembly_root + "/" + asset.name);
-						else if (asset.behavior === "resource") {
-							var path = asset.culture !== '' ? `${asset.culture}/${asset.name}` : asset.name;
-							attemptUrl = locateFile (args.assembly_root + "/" + path);
-						}
-						else
-							attemptUrl = asset.name;
-					} else {
-						attemptUrl = sourcePrefix + asset.name;
-					}
-
 					try {
 						if (asset.name === attemptUrl) {
 							if (ctx.tracing)
@@ -5,6 +5,7 @@
 #include "trace.h"
 #include "dir_utils.h"
 #include "error_codes.h"
+#include "utils.h"
 
 using namespace bundle;
 
@@ -14,7 +15,7 @@ bool file_entry_t::is_valid() const
         static_cast<file_type_t>(m_type) < file_type_t::__last;
 }
 
-file_entry_t file_entry_t::read(reader_t &reader, uint32_t bundle_major_version, bool force_extraction)
+file_entry_t file_entry_t::read(reader_t &reader, uint32_t bundle_major_version, bool force_extraction, bool native_libraries_in_memory)
 {
     // First read the fixed-sized portion of file-entry
     file_entry_fixed_t fixed_data;
@@ -41,6 +42,19 @@ file_entry_t file_entry_t::read(reader_t &reader, uint32_t bundle_major_version,
     reader.read_path_string(entry.m_relative_path);
     dir_utils_t::fixup_path_separator(entry.m_relative_path);
 
+    // Only uncompressed shared libraries can be loaded from memory, other native files may be executed
+    // or opened by path and so still need to be extracted.
+    entry.m_load_from_memory = native_libraries_in_memory &&
+        !entry.m_force_extraction &&
+        entry.m_type == file_type_t::native_binary &&
+        entry.m_compressedSize == 0 &&
+        ends_with(entry.m_relative_path, _X(".so"), true);
+
+    if (entry.m_type == file_type_t::assembly && (entry.m_offset % assembly_mapping_alignment) != 0)
+    {
+        trace::verbose(_X("Assembly [%s] is not aligned for direct mapping from the bundle and will be copied when loaded."), entry.m_relative_path.c_str());
+    }
+
     return entry;
 }
 
@@ -56,6 +70,9 @@ bool file_entry_t::needs_extraction() const
     case file_type_t::assembly:
         return false;
 
+    case file_type_t::native_binary:
+        return !m_load_from_memory;
+
     default:
         return true;
     }
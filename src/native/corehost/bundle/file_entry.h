@@ -21,6 +21,10 @@ namespace bundle
     // Variable Size portion
     //   - relative path (7-bit extension encoded length prefixed string)
 
+    // Assemblies which start at this alignment within the bundle can be mapped by the runtime directly
+    // from the bundle file, others are copied into memory when loaded.
+    const int64_t assembly_mapping_alignment = 4096;
+
 #pragma pack(push, 1)
     struct file_entry_fixed_t
     {
@@ -42,6 +46,7 @@ namespace bundle
             , m_relative_path()
             , m_disabled(false)
             , m_force_extraction(false)
+            , m_load_from_memory(false)
         {
         }
 
@@ -51,6 +56,7 @@ namespace bundle
             : m_relative_path()
             , m_disabled(false)
             , m_force_extraction(force_extraction)
+            , m_load_from_memory(false)
         {
             // File_entries in the bundle-manifest are expected to be used 
             // beyond startup (for loading files directly from bundle, lazy extraction, etc.).
@@ -71,9 +77,10 @@ namespace bundle
         void disable() { m_disabled = true; }
         bool is_disabled() const { return m_disabled; }
         bool needs_extraction() const;
+        bool is_loaded_from_memory() const { return m_load_from_memory; }
         bool matches(const pal::string_t& path) const { return (pal::pathcmp(relative_path(), path) == 0) && !is_disabled(); }
 
-        static file_entry_t read(reader_t &reader, uint32_t bundle_major_version, bool force_extraction);
+        static file_entry_t read(reader_t &reader, uint32_t bundle_major_version, bool force_extraction, bool native_libraries_in_memory);
 
     private:
         int64_t m_offset;
@@ -87,6 +94,8 @@ namespace bundle
         // in such case, and the lookup logic will behave as if the file is not present in the bundle.
         bool m_disabled;
         bool m_force_extraction;
+        // Native libraries may be loaded from an in-memory copy of the bundled file instead of being extracted.
+        bool m_load_from_memory;
         bool is_valid() const;
     };
 }
@@ -2,6 +2,7 @@
 // The .NET Foundation licenses this file to you under the MIT license.
 
 #include "manifest.h"
+#include "pal.h"
 
 using namespace bundle;
 
@@ -9,11 +10,20 @@ manifest_t manifest_t::read(reader_t& reader, const header_t& header)
 {
     manifest_t manifest;
 
+    // Loading native libraries from memory is opt-in, since it only works for libraries which are
+    // reached through DllImport and not for those opened by path.
+    bool native_libraries_in_memory = false;
+#if defined(__linux__)
+    pal::string_t in_memory;
+    native_libraries_in_memory = pal::getenv(_X("DOTNET_BUNDLE_NATIVE_LIBS_IN_MEMORY"), &in_memory) && in_memory == _X("1");
+#endif
+
     for (int32_t i = 0; i < header.num_embedded_files(); i++)
     {
-        file_entry_t entry = file_entry_t::read(reader, header.major_version(), header.is_netcoreapp3_compat_mode());
-        manifest.files.push_back(std::move(entry));
+        file_entry_t entry = file_entry_t::read(reader, header.major_version(), header.is_netcoreapp3_compat_mode(), native_libraries_in_memory);
         manifest.m_files_need_extraction |= entry.needs_extraction();
+        manifest.m_native_libraries_in_memory |= entry.is_loaded_from_memory();
+        manifest.files.push_back(std::move(entry));
     }
 
     return manifest;
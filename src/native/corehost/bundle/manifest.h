@@ -18,6 +18,7 @@ namespace bundle
     public:
         manifest_t()
             : m_files_need_extraction(false)
+            , m_native_libraries_in_memory(false)
         {
         }
 
@@ -30,8 +31,14 @@ namespace bundle
             return m_files_need_extraction;
         }
 
+        bool native_libraries_in_memory() const
+        {
+            return m_native_libraries_in_memory;
+        }
+
     private:
         bool m_files_need_extraction;
+        bool m_native_libraries_in_memory;
     };
 }
 #endif // __MANIFEST_H__
@@ -9,6 +9,17 @@
 #include "manifest.h"
 #include "utils.h"
 
+#if defined(__linux__)
+#include <fcntl.h>
+#include <sys/sendfile.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#ifndef MFD_CLOEXEC
+#define MFD_CLOEXEC 0x0001U
+#endif
+#endif
+
 using namespace bundle;
 
 // This method processes the bundle manifest.
@@ -65,8 +76,9 @@ bool runner_t::probe(const pal::string_t& relative_path, int64_t* offset, int64_
 {
     const bundle::file_entry_t* entry = probe(relative_path);
 
-    // Do not report extracted entries - those should be reported through either TPA or resource paths
-    if (entry == nullptr || entry->needs_extraction())
+    // Do not report extracted entries - those should be reported through either TPA or resource paths.
+    // Native libraries loaded from memory are resolved by the host rather than the runtime.
+    if (entry == nullptr || entry->needs_extraction() || entry->is_loaded_from_memory())
     {
         return false;
     }
@@ -101,6 +113,27 @@ bool runner_t::locate(const pal::string_t& relative_path, pal::string_t& full_pa
     return true;
 }
 
+// Returns the separated list of compressed assemblies which are loaded directly from the bundle, in manifest order.
+pal::string_t runner_t::get_compressed_assemblies() const
+{
+    pal::string_t assemblies;
+    for (const file_entry_t& entry : m_manifest.files)
+    {
+        if (entry.type() == file_type_t::assembly && entry.compressedSize() != 0 &&
+            !entry.is_disabled() && !entry.needs_extraction())
+        {
+            if (!assemblies.empty())
+            {
+                assemblies.push_back(PATH_SEPARATOR);
+            }
+
+            assemblies.append(entry.relative_path());
+        }
+    }
+
+    return assemblies;
+}
+
 bool runner_t::disable(const pal::string_t& relative_path)
 {
     for (file_entry_t& entry : m_manifest.files)
@@ -115,3 +148,68 @@ bool runner_t::disable(const pal::string_t& relative_path)
     return false;
 }
 
+
+// Load a native library embedded in the bundle without extracting it to disk.
+// The contents are copied by the kernel from the bundle into an anonymous memory file, which is then
+// loaded through its /proc/self/fd path.
+bool runner_t::load_native_library(const pal::string_t& relative_path, pal::dll_t* dll) const
+{
+#if defined(__linux__) && defined(SYS_memfd_create)
+    const bundle::file_entry_t* entry = probe(relative_path);
+    if (entry == nullptr || !entry->is_loaded_from_memory())
+    {
+        return false;
+    }
+
+    int bundle_fd = open(m_bundle_path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (bundle_fd == -1)
+    {
+        trace::warning(_X("Failed to open the application bundle to load [%s], error: %d"), relative_path.c_str(), errno);
+        return false;
+    }
+
+    int memory_fd = static_cast<int>(syscall(SYS_memfd_create, get_filename(relative_path).c_str(), MFD_CLOEXEC));
+    if (memory_fd == -1)
+    {
+        trace::warning(_X("Failed to create an in-memory file to load [%s], error: %d"), relative_path.c_str(), errno);
+        close(bundle_fd);
+        return false;
+    }
+
+    off_t offset = static_cast<off_t>(entry->offset());
+    size_t remaining = to_size_t_dbgchecked(entry->size());
+    while (remaining > 0)
+    {
+        ssize_t copied = sendfile(memory_fd, bundle_fd, &offset, remaining);
+        if (copied <= 0)
+        {
+            break;
+        }
+
+        remaining -= static_cast<size_t>(copied);
+    }
+
+    close(bundle_fd);
+
+    if (remaining != 0)
+    {
+        trace::warning(_X("Failed to copy [%s] from the application bundle, error: %d"), relative_path.c_str(), errno);
+        close(memory_fd);
+        return false;
+    }
+
+    // The file descriptor is intentionally kept open for the lifetime of the process: the loader identifies
+    // libraries by path, so the /proc/self/fd path must not be reused for a different library.
+    pal::string_t memory_path = _X("/proc/self/fd/") + pal::to_string(memory_fd);
+    if (!pal::load_library(&memory_path, dll))
+    {
+        close(memory_fd);
+        return false;
+    }
+
+    trace::info(_X("Loaded [%s] from the application bundle without extraction."), relative_path.c_str());
+    return true;
+#else
+    return false;
+#endif
+}
@@ -36,6 +36,10 @@ namespace bundle
             return locate(relative_path, full_path, extracted_to_disk);
         }
         bool disable(const pal::string_t& relative_path);
+        pal::string_t get_compressed_assemblies() const;
+
+        bool native_libraries_in_memory() const { return m_manifest.native_libraries_in_memory(); }
+        bool load_native_library(const pal::string_t& relative_path, pal::dll_t* dll) const;
 
         static StatusCode process_manifest_and_extract()
         {
@@ -18,20 +18,15 @@ const std::array<const pal::char_t*, deps_entry_t::asset_types::count> deps_entr
 
 namespace
 {
-    pal::string_t get_optional_property(
-        const json_parser_t::value_t& properties,
-        const pal::string_t& key)
+    typedef json_parser_t::internal_encoding_type_t::Ch json_char_t;
+
+    bool key_equals(const json_char_t* str, rapidjson::SizeType length, const pal::char_t* key)
     {
-        const auto& prop = properties.FindMember(key.c_str());
-        return (prop != properties.MemberEnd() && prop->value.IsString()) ? prop->value.GetString() : _X("");
+        return pal::strlen(key) == length && pal::string_t::traits_type::compare(str, key, length) == 0;
     }
 
-    pal::string_t get_optional_path(
-        const json_parser_t::value_t& properties,
-        const pal::string_t& key)
+    pal::string_t to_native_path(pal::string_t path)
     {
-        pal::string_t path = get_optional_property(properties, key);
-
         if (path.length() > 0 && _X('/') != DIR_SEPARATOR)
         {
             replace_char(&path, _X('/'), DIR_SEPARATOR);
@@ -41,60 +36,445 @@ namespace
     }
 }
 
+// Collects the "runtimeTarget", "targets", "libraries" and "runtimes" of a deps file in a single pass
+// over the JSON, without building a document. The assets of every target are collected since the
+// runtime target's name may come after the targets; deps files usually have just one or two targets.
+//
+// The depth is the number of objects and arrays that are open, so for example the properties of an
+// asset (targets/<target>/<package>/runtime/<file>/assemblyVersion) are keys at depth 6.
+class deps_json_t::reader_t : public rapidjson::BaseReaderHandler<json_parser_t::internal_encoding_type_t, deps_json_t::reader_t>
+{
+public:
+    reader_t(bool is_framework_dependent)
+        : m_is_framework_dependent(is_framework_dependent)
+        , m_section(section_t::none)
+        , m_depth(0)
+        , m_skip_depth(0)
+        , m_skip_value(false)
+        , m_string_value(nullptr)
+        , m_bool_value(nullptr)
+        , m_fallback_rids(nullptr)
+        , m_asset_type_index(0)
+    {
+    }
+
+    const pal::string_t& runtime_target_name() const { return m_runtime_target_name; }
+    const std::vector<library_t>& libraries() const { return m_libraries; }
+    rid_fallback_graph_t& rid_fallback_graph() { return m_rid_fallback_graph; }
+
+    deps_assets_t take_assets(const pal::string_t& target_name)
+    {
+        auto iter = m_assets.find(target_name);
+        return iter != m_assets.end() ? std::move(iter->second) : deps_assets_t();
+    }
+
+    rid_specific_assets_t take_rid_assets(const pal::string_t& target_name)
+    {
+        auto iter = m_rid_assets.find(target_name);
+        return iter != m_rid_assets.end() ? std::move(iter->second) : rid_specific_assets_t();
+    }
+
+    bool Key(const json_char_t* str, rapidjson::SizeType length, bool copy)
+    {
+        if (m_skip_depth != 0)
+        {
+            return true;
+        }
+
+        m_skip_value = true;
+        m_string_value = nullptr;
+        m_bool_value = nullptr;
+
+        if (m_depth == 1)
+        {
+            m_section = section_t::none;
+            if (key_equals(str, length, _X("runtimeTarget")))
+            {
+                // Either the name of the target or an object with a "name" property
+                m_section = section_t::runtime_target;
+                m_string_value = &m_runtime_target_name;
+            }
+            else if (key_equals(str, length, _X("targets")))
+            {
+                m_section = section_t::targets;
+            }
+            else if (key_equals(str, length, _X("libraries")))
+            {
+                m_section = section_t::libraries;
+            }
+            else if (key_equals(str, length, _X("runtimes")) && !m_is_framework_dependent)
+            {
+                m_section = section_t::runtimes;
+            }
+
+            m_skip_value = m_section == section_t::none;
+            return true;
+        }
+
+        switch (m_section)
+        {
+        case section_t::runtime_target:
+            if (m_depth == 2 && key_equals(str, length, _X("name")))
+            {
+                m_skip_value = false;
+                m_string_value = &m_runtime_target_name;
+            }
+            break;
+
+        case section_t::targets:
+            if (m_depth == 2)
+            {
+                m_skip_value = false;
+                m_target_name.assign(str, length);
+            }
+            else if (m_depth == 3)
+            {
+                m_skip_value = false;
+                m_package_name.assign(str, length);
+            }
+            else if (m_depth == 4)
+            {
+                for (size_t i = 0; i < deps_entry_t::s_known_asset_types.size(); ++i)
+                {
+                    if (key_equals(str, length, deps_entry_t::s_known_asset_types[i]))
+                    {
+                        m_skip_value = false;
+                        m_asset_type_index = i;
+                    }
+                }
+
+                if (m_is_framework_dependent && key_equals(str, length, _X("runtimeTargets")))
+                {
+                    m_skip_value = false;
+                    m_asset_type_index = deps_entry_t::asset_types::count;
+                }
+            }
+            else if (m_depth == 5)
+            {
+                m_skip_value = false;
+                m_file_name.assign(str, length);
+                m_assembly_version.clear();
+                m_file_version.clear();
+                m_rid.clear();
+                m_asset_type.clear();
+            }
+            else if (m_depth == 6)
+            {
+                if (key_equals(str, length, _X("assemblyVersion")))
+                {
+                    m_string_value = &m_assembly_version;
+                }
+                else if (key_equals(str, length, _X("fileVersion")))
+                {
+                    m_string_value = &m_file_version;
+                }
+                else if (m_asset_type_index == deps_entry_t::asset_types::count && key_equals(str, length, _X("rid")))
+                {
+                    m_string_value = &m_rid;
+                }
+                else if (m_asset_type_index == deps_entry_t::asset_types::count && key_equals(str, length, _X("assetType")))
+                {
+                    m_string_value = &m_asset_type;
+                }
+
+                m_skip_value = m_string_value == nullptr;
+            }
+            break;
+
+        case section_t::libraries:
+            if (m_depth == 2)
+            {
+                m_skip_value = false;
+                m_library = library_t();
+                m_library.name.assign(str, length);
+            }
+            else if (m_depth == 3)
+            {
+                if (key_equals(str, length, _X("type")))
+                {
+                    m_string_value = &m_library.type;
+                }
+                else if (key_equals(str, length, _X("sha512")))
+                {
+                    m_string_value = &m_library.sha512;
+                }
+                else if (key_equals(str, length, _X("path")))
+                {
+                    m_string_value = &m_library.path;
+                }
+                else if (key_equals(str, length, _X("hashPath")))
+                {
+                    m_string_value = &m_library.hash_path;
+                }
+                else if (key_equals(str, length, _X("runtimeStoreManifestName")))
+                {
+                    m_string_value = &m_library.runtime_store_manifest_name;
+                }
+                else if (key_equals(str, length, _X("serviceable")))
+                {
+                    m_bool_value = &m_library.serviceable;
+                }
+
+                m_skip_value = m_string_value == nullptr && m_bool_value == nullptr;
+            }
+            break;
+
+        case section_t::runtimes:
+            if (m_depth == 2)
+            {
+                m_skip_value = false;
+                m_fallback_rids = &m_rid_fallback_graph[pal::string_t(str, length)];
+            }
+            break;
+
+        default:
+            break;
+        }
+
+        return true;
+    }
+
+    bool String(const json_char_t* str, rapidjson::SizeType length, bool copy)
+    {
+        if (m_skip_depth == 0)
+        {
+            if (m_string_value != nullptr)
+            {
+                m_string_value->assign(str, length);
+            }
+            else if (m_section == section_t::runtimes && m_depth == 3 && m_fallback_rids != nullptr)
+            {
+                m_fallback_rids->push_back(pal::string_t(str, length));
+            }
+        }
+
+        return Default();
+    }
+
+    bool Bool(bool value)
+    {
+        if (m_skip_depth == 0 && m_bool_value != nullptr)
+        {
+            *m_bool_value = value;
+        }
+
+        return Default();
+    }
+
+    // Any other value
+    bool Default()
+    {
+        m_skip_value = false;
+        m_string_value = nullptr;
+        m_bool_value = nullptr;
+
+        // The root has to be an object
+        return m_depth != 0;
+    }
+
+    bool StartObject()
+    {
+        return start_container();
+    }
+
+    bool EndObject(rapidjson::SizeType member_count)
+    {
+        if (m_skip_depth == 0)
+        {
+            if (m_section == section_t::targets && m_depth == 6)
+            {
+                add_asset();
+            }
+            else if (m_section == section_t::libraries && m_depth == 3)
+            {
+                m_libraries.push_back(std::move(m_library));
+            }
+        }
+
+        return end_container();
+    }
+
+    bool StartArray()
+    {
+        // The root has to be an object
+        return m_depth != 0 && start_container();
+    }
+
+    bool EndArray(rapidjson::SizeType element_count)
+    {
+        return end_container();
+    }
+
+private:
+    enum class section_t
+    {
+        none,
+        runtime_target,
+        targets,
+        libraries,
+        runtimes,
+    };
+
+    bool start_container()
+    {
+        m_depth++;
+        if (m_skip_depth == 0 && m_skip_value)
+        {
+            // Ignore everything up to the end of this object or array
+            m_skip_depth = m_depth;
+        }
+
+        m_skip_value = false;
+        m_string_value = nullptr;
+        m_bool_value = nullptr;
+        return true;
+    }
+
+    bool end_container()
+    {
+        if (m_skip_depth == m_depth)
+        {
+            m_skip_depth = 0;
+        }
+
+        m_depth--;
+        return true;
+    }
+
+    void add_asset()
+    {
+        version_t assembly_version, file_version;
+        if (!m_assembly_version.empty())
+        {
+            version_t::parse(m_assembly_version, &assembly_version);
+        }
+
+        if (!m_file_version.empty())
+        {
+            version_t::parse(m_file_version, &file_version);
+        }
+
+        if (m_asset_type_index < deps_entry_t::asset_types::count)
+        {
+            deps_asset_t asset(get_filename_without_ext(m_file_name), m_file_name, assembly_version, file_version);
+
+            if (trace::is_enabled())
+            {
+                trace::info(_X("Adding %s asset %s assemblyVersion=%s fileVersion=%s from %s"),
+                    deps_entry_t::s_known_asset_types[m_asset_type_index],
+                    asset.relative_path.c_str(),
+                    asset.assembly_version.as_str().c_str(),
+                    asset.file_version.as_str().c_str(),
+                    m_package_name.c_str());
+            }
+
+            m_assets[m_target_name].libs[m_package_name][m_asset_type_index].push_back(std::move(asset));
+            return;
+        }
+
+        for (size_t asset_type_index = 0; asset_type_index < deps_entry_t::s_known_asset_types.size(); ++asset_type_index)
+        {
+            if (pal::strcasecmp(m_asset_type.c_str(), deps_entry_t::s_known_asset_types[asset_type_index]) != 0)
+            {
+                continue;
+            }
+
+            deps_asset_t asset(get_filename_without_ext(m_file_name), m_file_name, assembly_version, file_version);
+
+            if (trace::is_enabled())
+            {
+                trace::info(_X("Adding runtimeTargets %s asset %s rid=%s assemblyVersion=%s fileVersion=%s from %s"),
+                    deps_entry_t::s_known_asset_types[asset_type_index],
+                    asset.relative_path.c_str(),
+                    m_rid.c_str(),
+                    asset.assembly_version.as_str().c_str(),
+                    asset.file_version.as_str().c_str(),
+                    m_package_name.c_str());
+            }
+
+            m_rid_assets[m_target_name].libs[m_package_name][asset_type_index].rid_assets[m_rid].push_back(std::move(asset));
+        }
+    }
+
+    const bool m_is_framework_dependent;
+
+    // Parsing state
+    section_t m_section;
+    int m_depth;
+    int m_skip_depth;           // Depth of the object or array being ignored, or 0
+    bool m_skip_value;          // The value of the current key is ignored
+    pal::string_t* m_string_value;  // Where to store the value of the current key if it is a string
+    bool* m_bool_value;             // Where to store the value of the current key if it is a boolean
+    std::vector<pal::string_t>* m_fallback_rids;
+
+    pal::string_t m_target_name;
+    pal::string_t m_package_name;
+    size_t m_asset_type_index;  // deps_entry_t::asset_types::count for runtimeTargets
+    pal::string_t m_file_name;
+    pal::string_t m_assembly_version;
+    pal::string_t m_file_version;
+    pal::string_t m_rid;
+    pal::string_t m_asset_type;
+    library_t m_library;
+
+    // Results
+    pal::string_t m_runtime_target_name;
+    std::unordered_map<pal::string_t, deps_assets_t> m_assets;
+    std::unordered_map<pal::string_t, rid_specific_assets_t> m_rid_assets;
+    std::vector<library_t> m_libraries;
+    rid_fallback_graph_t m_rid_fallback_graph;
+};
+
 void deps_json_t::reconcile_libraries_with_targets(
     const pal::string_t& deps_path,
-    const json_parser_t::value_t& json,
+    const std::vector<library_t>& libraries,
     const std::function<bool(const pal::string_t&)>& library_exists_fn,
     const std::function<const vec_asset_t&(const pal::string_t&, size_t, bool*)>& get_assets_fn)
 {
     pal::string_t deps_file = get_filename(deps_path);
 
-    for (const auto& library : json[_X("libraries")].GetObject())
+    for (const library_t& library : libraries)
     {
-        trace::info(_X("Reconciling library %s"), library.name.GetString());
+        trace::info(_X("Reconciling library %s"), library.name.c_str());
 
-        pal::string_t lib_name{library.name.GetString()};
+        const pal::string_t& lib_name = library.name;
         if (!library_exists_fn(lib_name))
         {
-            trace::info(_X("Library %s does not exist"), library.name.GetString());
+            trace::info(_X("Library %s does not exist"), library.name.c_str());
             continue;
         }
 
-        const pal::string_t& hash = library.value[_X("sha512")].GetString();
-        bool serviceable = library.value[_X("serviceable")].GetBool();
-
-        pal::string_t library_path = get_optional_path(library.value, _X("path"));
-        pal::string_t library_hash_path = get_optional_path(library.value, _X("hashPath"));
-        pal::string_t runtime_store_manifest_list = get_optional_path(library.value, _X("runtimeStoreManifestName"));
+        size_t pos = lib_name.find(_X("/"));
+        pal::string_t library_name = lib_name.substr(0, pos);
+        pal::string_t library_version = lib_name.substr(pos + 1);
+        pal::string_t library_type = pal::to_lower(library.type);
+        pal::string_t library_path = to_native_path(library.path);
+        pal::string_t library_hash_path = to_native_path(library.hash_path);
+        pal::string_t runtime_store_manifest_list = to_native_path(library.runtime_store_manifest_name);
 
         for (size_t i = 0; i < deps_entry_t::s_known_asset_types.size(); ++i)
         {
             bool rid_specific = false;
-            for (const auto& asset : get_assets_fn(library.name.GetString(), i, &rid_specific))
+            for (const auto& asset : get_assets_fn(lib_name, i, &rid_specific))
             {
-                auto asset_name = asset.name;
-                if (ends_with(asset_name, _X(".ni"), false))
-                {
-                    asset_name = strip_file_ext(asset_name);
-                }
-
-                deps_entry_t entry;
-                size_t pos = lib_name.find(_X("/"));
-                entry.library_name = lib_name.substr(0, pos);
-                entry.library_version = lib_name.substr(pos + 1);
-                entry.library_type = pal::to_lower(library.value[_X("type")].GetString());
-                entry.library_hash = hash;
+                m_deps_entries[i].emplace_back();
+                deps_entry_t& entry = m_deps_entries[i].back();
+                entry.library_name = library_name;
+                entry.library_version = library_version;
+                entry.library_type = library_type;
+                entry.library_hash = library.sha512;
                 entry.library_path = library_path;
                 entry.library_hash_path = library_hash_path;
                 entry.runtime_store_manifest_list = runtime_store_manifest_list;
                 entry.asset_type = static_cast<deps_entry_t::asset_types>(i);
-                entry.is_serviceable = serviceable;
+                entry.is_serviceable = library.serviceable;
                 entry.is_rid_specific = rid_specific;
                 entry.deps_file = deps_file;
                 entry.asset = asset;
-                entry.asset.name = asset_name;
-
-                m_deps_entries[i].push_back(entry);
+                if (ends_with(entry.asset.name, _X(".ni"), false))
+                {
+                    entry.asset.name = strip_file_ext(entry.asset.name);
+                }
 
                 if (trace::is_enabled())
                 {
@@ -194,126 +574,15 @@ bool deps_json_t::perform_rid_fallback(rid_specific_assets_t* portable_assets, c
     return true;
 }
 
-bool deps_json_t::process_runtime_targets(const json_parser_t::value_t& json, const pal::string_t& target_name, const rid_fallback_graph_t& rid_fallback_graph, rid_specific_assets_t* p_assets)
+bool deps_json_t::load_framework_dependent(const pal::string_t& deps_path, reader_t& reader, const rid_fallback_graph_t& rid_fallback_graph)
 {
-    rid_specific_assets_t& assets = *p_assets;
-    for (const auto& package : json[_X("targets")][target_name.c_str()].GetObject())
-    {
-        const auto& runtimeTargets = package.value.FindMember(_X("runtimeTargets"));
-        if (runtimeTargets == package.value.MemberEnd())
-        {
-            continue;
-        }
-
-        for (const auto& file : runtimeTargets->value.GetObject())
-        {
-            const auto& type = file.value[_X("assetType")].GetString();
-
-            for (size_t asset_type_index = 0; asset_type_index < deps_entry_t::s_known_asset_types.size(); ++asset_type_index)
-            {
-                if (pal::strcasecmp(type, deps_entry_t::s_known_asset_types[asset_type_index]) != 0)
-                {
-                    continue;
-                }
-
-                version_t assembly_version, file_version;
-
-                const pal::string_t& assembly_version_str = get_optional_property(file.value, _X("assemblyVersion"));
-                if (!assembly_version_str.empty())
-                {
-                    version_t::parse(assembly_version_str, &assembly_version);
-                }
-
-                const pal::string_t& file_version_str = get_optional_property(file.value, _X("fileVersion"));
-                if (!file_version_str.empty())
-                {
-                    version_t::parse(file_version_str, &file_version);
-                }
-
-                pal::string_t file_name{file.name.GetString()};
-                deps_asset_t asset(get_filename_without_ext(file_name), file_name, assembly_version, file_version);
-
-                const auto& rid = file.value[_X("rid")].GetString();
-
-                trace::info(_X("Adding runtimeTargets %s asset %s rid=%s assemblyVersion=%s fileVersion=%s from %s"),
-                    deps_entry_t::s_known_asset_types[asset_type_index],
-                    asset.relative_path.c_str(),
-                    rid,
-                    asset.assembly_version.as_str().c_str(),
-                    asset.file_version.as_str().c_str(),
-                    package.name.GetString());
-
-                assets.libs[package.name.GetString()][asset_type_index].rid_assets[rid].push_back(asset);
-            }
-        }
-    }
-
-    if (!perform_rid_fallback(&assets, rid_fallback_graph))
-    {
-        return false;
-    }
-
-    return true;
-}
-
-bool deps_json_t::process_targets(const json_parser_t::value_t& json, const pal::string_t& target_name, deps_assets_t* p_assets)
-{
-    deps_assets_t& assets = *p_assets;
-    for (const auto& package : json[_X("targets")][target_name.c_str()].GetObject())
-    {
-        const auto& asset_types = package.value.GetObject();
-        for (size_t i = 0; i < deps_entry_t::s_known_asset_types.size(); ++i)
-        {
-            const auto& iter = asset_types.FindMember(deps_entry_t::s_known_asset_types[i]);
-            if (iter == asset_types.MemberEnd())
-            {
-                continue;
-            }
-
-            for (const auto& file : iter->value.GetObject())
-            {
-                version_t assembly_version, file_version;
-
-                const pal::string_t& assembly_version_str = get_optional_property(file.value, _X("assemblyVersion"));
-                if (assembly_version_str.length() > 0)
-                {
-                    version_t::parse(assembly_version_str, &assembly_version);
-                }
-
-                const pal::string_t& file_version_str = get_optional_property(file.value, _X("fileVersion"));
-                if (file_version_str.length() > 0)
-                {
-                    version_t::parse(file_version_str, &file_version);
-                }
-
-                pal::string_t file_name{file.name.GetString()};
-                deps_asset_t asset(get_filename_without_ext(file_name), file_name, assembly_version, file_version);
-
-                trace::info(_X("Adding %s asset %s assemblyVersion=%s fileVersion=%s from %s"),
-                    deps_entry_t::s_known_asset_types[i],
-                    asset.relative_path.c_str(),
-                    asset.assembly_version.as_str().c_str(),
-                    asset.file_version.as_str().c_str(),
-                    package.name.GetString());
-
-                assets.libs[package.name.GetString()][i].push_back(asset);
-            }
-        }
-    }
-    return true;
-}
-
-bool deps_json_t::load_framework_dependent(const pal::string_t& deps_path, const json_parser_t::value_t& json, const pal::string_t& target_name, const rid_fallback_graph_t& rid_fallback_graph)
-{
-    if (!process_runtime_targets(json, target_name, rid_fallback_graph, &m_rid_assets))
+    m_rid_assets = reader.take_rid_assets(reader.runtime_target_name());
+    if (!perform_rid_fallback(&m_rid_assets, rid_fallback_graph))
     {
         return false;
     }
 
-    if (!process_targets(json, target_name, &m_assets))
-    {
-        return false;
-    }
+    m_assets = reader.take_assets(reader.runtime_target_name());
 
     auto package_exists = [&](const pal::string_t& package) -> bool {
         return m_rid_assets.libs.count(package) || m_assets.libs.count(package);
@@ -345,17 +614,14 @@ bool deps_json_t::load_framework_dependent(const pal::string_t& deps_path, const
         return empty;
     };
 
-    reconcile_libraries_with_targets(deps_path, json, package_exists, get_relpaths);
+    reconcile_libraries_with_targets(deps_path, reader.libraries(), package_exists, get_relpaths);
 
     return true;
 }
 
-bool deps_json_t::load_self_contained(const pal::string_t& deps_path, const json_parser_t::value_t& json, const pal::string_t& target_name)
+bool deps_json_t::load_self_contained(const pal::string_t& deps_path, reader_t& reader)
 {
-    if (!process_targets(json, target_name, &m_assets))
-    {
-        return false;
-    }
+    m_assets = reader.take_assets(reader.runtime_target_name());
 
     auto package_exists = [&](const pal::string_t& package) -> bool {
         return m_assets.libs.count(package);
@@ -366,20 +632,9 @@ bool deps_json_t::load_self_contained(const pal::string_t& deps_path, const json
         return m_assets.libs[package][type_index];
     };
 
-    reconcile_libraries_with_targets(deps_path, json, package_exists, get_relpaths);
+    reconcile_libraries_with_targets(deps_path, reader.libraries(), package_exists, get_relpaths);
 
-    const auto& json_object = json.GetObject();
-    if (json_object.HasMember(_X("runtimes")))
-    {
-        for (const auto& rid : json[_X("runtimes")].GetObject())
-        {
-            auto& vec = m_rid_fallback_graph[rid.name.GetString()];
-            for (const auto& fallback : rid.value.GetArray())
-            {
-                vec.push_back(fallback.GetString());
-            }
-        }
-    }
+    m_rid_fallback_graph = std::move(reader.rid_fallback_graph());
 
     if (trace::is_enabled())
     {
@@ -436,20 +691,17 @@ bool deps_json_t::load(bool is_framework_dependent, const pal::string_t& deps_pa
         return true;
     }
 
-    if (!json.parse_file(deps_path))
+    // The deps file is read in a single pass that only keeps what is needed for the entries
+    reader_t reader(is_framework_dependent);
+    if (!json.parse_file(deps_path, reader))
     {
         return false;
     }
 
-    const auto& runtime_target = json.document()[_X("runtimeTarget")];
-    const pal::string_t& name = runtime_target.IsString() ?
-        runtime_target.GetString() :
-        runtime_target[_X("name")].GetString();
-
     trace::verbose(_X("Loading deps file... %s as framework dependent=[%d]"), deps_path.c_str(), is_framework_dependent);
 
     if (is_framework_dependent)
-        return load_framework_dependent(deps_path, json.document(), name, rid_fallback_graph);
+        return load_framework_dependent(deps_path, reader, rid_fallback_graph);
 
-    return load_self_contained(deps_path, json.document(), name);
+    return load_self_contained(deps_path, reader);
 }
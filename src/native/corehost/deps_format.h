@@ -82,15 +82,29 @@ public:
     }
 
 private:
-    bool load_self_contained(const pal::string_t& deps_path, const json_parser_t::value_t& json, const pal::string_t& target_name);
-    bool load_framework_dependent(const pal::string_t& deps_path, const json_parser_t::value_t& json, const pal::string_t& target_name, const rid_fallback_graph_t& rid_fallback_graph);
+    struct library_t
+    {
+        library_t() : serviceable(false) { }
+
+        pal::string_t name;
+        pal::string_t type;
+        pal::string_t sha512;
+        pal::string_t path;
+        pal::string_t hash_path;
+        pal::string_t runtime_store_manifest_name;
+        bool serviceable;
+    };
+
+    // SAX handler that collects the targets, libraries and runtimes of the deps file (see deps_format.cpp)
+    class reader_t;
+
+    bool load_self_contained(const pal::string_t& deps_path, reader_t& reader);
+    bool load_framework_dependent(const pal::string_t& deps_path, reader_t& reader, const rid_fallback_graph_t& rid_fallback_graph);
     bool load(bool is_framework_dependent, const pal::string_t& deps_path, const rid_fallback_graph_t& rid_fallback_graph);
-    bool process_runtime_targets(const json_parser_t::value_t& json, const pal::string_t& target_name, const rid_fallback_graph_t& rid_fallback_graph, rid_specific_assets_t* p_assets);
-    bool process_targets(const json_parser_t::value_t& json, const pal::string_t& target_name, deps_assets_t* p_assets);
 
     void reconcile_libraries_with_targets(
         const pal::string_t& deps_path,
-        const json_parser_t::value_t& json,
+        const std::vector<library_t>& libraries,
         const std::function<bool(const pal::string_t&)>& library_exists_fn,
         const std::function<const vec_asset_t&(const pal::string_t&, size_t, bool*)>& get_assets_fn);
 
@@ -28,6 +28,10 @@
 #include "roll_fwd_on_no_candidate_fx_option.h"
 #include "bundle/info.h"
 
+#if !defined(_WIN32)
+#include <pthread.h>
+#endif
+
 namespace
 {
     // hostfxr tracks the context used to load hostpolicy and coreclr as the active host context. This is the first
@@ -49,6 +53,44 @@ namespace
     std::atomic<bool> g_context_initializing(false);
     std::condition_variable g_context_initializing_cv;
 
+#if !defined(_WIN32)
+    // Set in the child of a fork() of a process in which hostfxr has started loading the runtime. Only the forking
+    // thread survives in the child, so the runtime's own threads (finalizer, tiered compilation, diagnostics) are gone
+    // and locks held by other threads - including g_context_lock - are never released. The runtime cannot be used or
+    // loaded again in such a process, so the hosting components fail instead of blocking or calling into it.
+    std::atomic<bool> g_forked_after_runtime_load(false);
+
+    void register_fork_handler()
+    {
+        static std::once_flag fork_handler_registered;
+        std::call_once(fork_handler_registered, []
+            {
+                pthread_atfork(nullptr, nullptr, [] { g_forked_after_runtime_load.store(true); });
+            });
+    }
+#endif
+
+    bool is_forked_after_runtime_load()
+    {
+#if !defined(_WIN32)
+        if (g_forked_after_runtime_load.load())
+        {
+            trace::error(_X("Hosting components cannot be used in a process forked after the runtime was loaded."));
+            return true;
+        }
+#endif
+        return false;
+    }
+
+    // Marks the first host context as initializing. Must be called under g_context_lock.
+    void set_context_initializing()
+    {
+#if !defined(_WIN32)
+        register_fork_handler();
+#endif
+        g_context_initializing.store(true);
+    }
+
     void handle_initialize_failure_or_abort(const hostpolicy_contract_t *hostpolicy_contract = nullptr)
     {
         {
@@ -86,6 +128,9 @@ static int execute_app(
     const int argc,
     const pal::char_t* argv[])
 {
+    if (is_forked_after_runtime_load())
+        return StatusCode::HostInvalidState;
+
     {
         std::unique_lock<std::mutex> lock{ g_context_lock };
         g_context_initializing_cv.wait(lock, [] { return !g_context_initializing.load(); });
@@ -96,7 +141,7 @@ static int execute_app(
             return StatusCode::HostInvalidState;
         }
 
-        g_context_initializing.store(true);
+        set_context_initializing();
     }
 
     pal::dll_t hostpolicy_dll;
@@ -703,6 +748,9 @@ int fx_muxer_t::initialize_for_app(
     const opt_map_t &opts,
     hostfxr_handle *host_context_handle)
 {
+    if (is_forked_after_runtime_load())
+        return StatusCode::HostInvalidState;
+
     {
         std::unique_lock<std::mutex> lock{ g_context_lock };
         g_context_initializing_cv.wait(lock, [] { return !g_context_initializing.load(); });
@@ -713,7 +761,7 @@ int fx_muxer_t::initialize_for_app(
             return StatusCode::HostInvalidState;
         }
 
-        g_context_initializing.store(true);
+        set_context_initializing();
     }
 
     host_mode_t mode = host_mode_t::apphost;
@@ -755,6 +803,9 @@ int fx_muxer_t::initialize_for_runtime_config(
     const pal::char_t *runtime_config_path,
     hostfxr_handle *host_context_handle)
 {
+    if (is_forked_after_runtime_load())
+        return StatusCode::HostInvalidState;
+
     uint32_t initialization_options = initialization_options_t::none;
     const host_context_t *existing_context;
     {
@@ -764,7 +815,7 @@ int fx_muxer_t::initialize_for_runtime_config(
         existing_context = g_active_host_context.get();
         if (existing_context == nullptr)
         {
-            g_context_initializing.store(true);
+            set_context_initializing();
         }
         else if (existing_context->type == host_context_type::invalid)
         {
@@ -846,6 +897,9 @@ namespace
 
 int fx_muxer_t::run_app(host_context_t *context)
 {
+    if (is_forked_after_runtime_load())
+        return StatusCode::HostInvalidState;
+
     if (!context->is_app)
         return StatusCode::InvalidArgFailure;
 
@@ -869,6 +923,9 @@ int fx_muxer_t::run_app(host_context_t *context)
 
 int fx_muxer_t::get_runtime_delegate(host_context_t *context, coreclr_delegate_type type, void **delegate)
 {
+    if (is_forked_after_runtime_load())
+        return StatusCode::HostInvalidState;
+
     switch (type)
     {
     case coreclr_delegate_type::com_activation:
@@ -911,6 +968,9 @@ int fx_muxer_t::get_runtime_delegate(host_context_t *context, coreclr_delegate_t
 
 const host_context_t* fx_muxer_t::get_active_host_context()
 {
+    if (is_forked_after_runtime_load())
+        return nullptr;
+
     std::lock_guard<std::mutex> lock{ g_context_lock };
     if (g_active_host_context == nullptr)
         return nullptr;
@@ -950,6 +1010,9 @@ const host_context_t* fx_muxer_t::get_active_host_context()
 
 int fx_muxer_t::close_host_context(host_context_t *context)
 {
+    if (is_forked_after_runtime_load())
+        return StatusCode::HostInvalidState;
+
     if (context->type == host_context_type::initialized)
     {
         // The first context is being closed without being used to start the runtime
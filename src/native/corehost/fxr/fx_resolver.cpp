@@ -178,6 +178,112 @@ namespace
         return best_match;
     }
 
+    // Framework version index
+    //
+    // The available versions of a framework are kept in an index file next to the framework directory
+    // (<hive>/shared/<name>.versions), so that they can be read without listing the directory. The index
+    // records the last write time of the framework directory and is ignored when that no longer matches,
+    // which happens whenever a version is installed or removed. Stale indexes are rewritten; missing ones
+    // are only created when DOTNET_FRAMEWORK_VERSION_INDEX=1, since the hive is usually owned by the installer.
+    const char fx_version_index_signature[] = "fxversions 1";
+
+    std::string fx_version_index_time(int64_t dir_time)
+    {
+        std::stringstream time;
+        time << dir_time;
+        return time.str();
+    }
+
+    bool read_fx_version_index(const pal::string_t& index_path, int64_t dir_time, std::vector<pal::string_t>* list)
+    {
+        pal::ifstream_t file(index_path);
+        if (!file.good())
+        {
+            return false;
+        }
+
+        std::string line;
+        if (!std::getline(file, line) || line != fx_version_index_signature ||
+            !std::getline(file, line) || line != fx_version_index_time(dir_time))
+        {
+            trace::verbose(_X("Ignoring stale framework version index [%s]"), index_path.c_str());
+            return false;
+        }
+
+        while (std::getline(file, line))
+        {
+            pal::string_t version;
+            if (!line.empty() && pal::clr_palstring(line.c_str(), &version))
+            {
+                list->push_back(version);
+            }
+        }
+
+        trace::verbose(_X("Read %d framework versions from index [%s]"), static_cast<int>(list->size()), index_path.c_str());
+        return true;
+    }
+
+    void write_fx_version_index(const pal::string_t& index_path, int64_t dir_time, const std::vector<pal::string_t>& list)
+    {
+        pal::string_t temp_path = index_path + _X(".") + pal::to_string(pal::get_pid()) + _X(".tmp");
+        std::ofstream file(temp_path, std::ios::out | std::ios::trunc);
+        if (!file.good())
+        {
+            return;
+        }
+
+        file << fx_version_index_signature << '\n' << fx_version_index_time(dir_time) << '\n';
+        for (const auto& version : list)
+        {
+            std::vector<char> version_utf8;
+            if (pal::pal_clrstring(version, &version_utf8))
+            {
+                file << version_utf8.data() << '\n';
+            }
+        }
+
+        file.close();
+
+        // Replacing an existing file by renaming over it is not supported everywhere
+        pal::remove(index_path.c_str());
+        if (file.fail() || pal::rename(temp_path.c_str(), index_path.c_str()) != 0)
+        {
+            pal::remove(temp_path.c_str());
+        }
+    }
+
+    void get_framework_versions(const pal::string_t& fx_dir, std::vector<fx_ver_t>* version_list)
+    {
+        std::vector<pal::string_t> list;
+
+        int64_t dir_time;
+        bool has_time = pal::get_last_write_time(fx_dir, &dir_time);
+
+        pal::string_t index_path = fx_dir + _X(".versions");
+        if (!has_time || !read_fx_version_index(index_path, dir_time, &list))
+        {
+            list.clear();
+            pal::readdir_onlydirectories(fx_dir, &list);
+
+            pal::string_t create_index;
+            if (has_time &&
+                (pal::file_exists(index_path) ||
+                 (pal::getenv(_X("DOTNET_FRAMEWORK_VERSION_INDEX"), &create_index) && create_index == _X("1"))))
+            {
+                write_fx_version_index(index_path, dir_time, list);
+            }
+        }
+
+        for (const auto& version : list)
+        {
+            fx_ver_t ver;
+            if (fx_ver_t::parse(version, &ver, false))
+            {
+                version_list->push_back(ver);
+            }
+        }
+    }
+
     fx_definition_t* resolve_framework_reference(
         const fx_reference_t & fx_ref,
         const pal::string_t & oldest_requested_version,
@@ -235,18 +341,8 @@ namespace
             }
             else
             {
-                std::vector<pal::string_t> list;
                 std::vector<fx_ver_t> version_list;
-                pal::readdir_onlydirectories(fx_dir, &list);
-
-                for (const auto& version : list)
-                {
-                    fx_ver_t ver;
-                    if (fx_ver_t::parse(version, &ver, false))
-                    {
-                        version_list.push_back(ver);
-                    }
-                }
+                get_framework_versions(fx_dir, &version_list);
 
                 fx_ver_t resolved_ver = resolve_framework_reference_from_version_list(version_list, fx_ref);
 
@@ -273,6 +273,8 @@ namespace pal
     bool touch_file(const string_t& path);
     bool realpath(string_t* path, bool skip_error_logging = false);
     bool file_exists(const string_t& path);
+    // Returns an opaque timestamp of the last modification of the file or directory, comparable only for equality.
+    bool get_last_write_time(const string_t& path, int64_t* time);
     inline bool directory_exists(const string_t& path) { return file_exists(path); }
     void readdir(const string_t& path, const string_t& pattern, std::vector<string_t>* list);
     void readdir(const string_t& path, std::vector<string_t>* list);
@@ -149,7 +149,8 @@ namespace
         _X("RUNTIME_IDENTIFIER"),
         _X("BUNDLE_PROBE"),
         _X("HOSTPOLICY_EMBEDDED"),
-        _X("PINVOKE_OVERRIDE")
+        _X("PINVOKE_OVERRIDE"),
+        _X("BUNDLE_COMPRESSED_ASSEMBLIES")
     };
 
     static_assert((sizeof(PropertyNameMapping) / sizeof(*PropertyNameMapping)) == static_cast<size_t>(common_property::Last), "Invalid property count");
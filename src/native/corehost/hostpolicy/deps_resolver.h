@@ -213,8 +213,6 @@ public:
         }
     }
 
-private:
-
     static pal::string_t get_fx_deps(const pal::string_t& fx_dir, const pal::string_t& fx_name)
     {
         pal::string_t fx_deps = fx_dir;
@@ -223,6 +221,8 @@ private:
         return fx_deps;
     }
 
+private:
+
     // Resolve order for TPA lookup.
     bool resolve_tpa_list(
         pal::string_t* output,
@@ -910,10 +910,21 @@ SHARED_API int HOSTPOLICY_CALLTYPE corehost_resolve_component_dependencies(
 
     // The RID graph still has to come from the actuall root framework, so take that from the g_init.fx_definitions
     // which are the frameworks for the app.
+    // The root framework's deps are not parsed if the app's resolution was read from the host resolution cache,
+    // in that case parse a local copy to get the RID graph.
+    const fx_definition_t& root_framework = get_root_framework(g_init.fx_definitions);
+    const deps_json_t* root_framework_deps = &root_framework.get_deps();
+    deps_json_t parsed_root_framework_deps;
+    if (!root_framework_deps->is_valid() && !root_framework.get_deps_file().empty())
+    {
+        parsed_root_framework_deps.parse(false /* is_framework_dependent */, root_framework.get_deps_file());
+        root_framework_deps = &parsed_root_framework_deps;
+    }
+
     deps_resolver_t resolver(
         args,
         component_fx_definitions,
-        &get_root_framework(g_init.fx_definitions).get_deps().get_rid_fallback_graph(),
+        &root_framework_deps->get_rid_fallback_graph(),
         true);
 
     pal::string_t resolver_errors;
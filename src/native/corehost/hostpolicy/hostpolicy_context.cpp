@@ -4,6 +4,7 @@
 #include "hostpolicy_context.h"
 
 #include "deps_resolver.h"
+#include "resolution_cache.h"
 #include <error_codes.h>
 #include <trace.h>
 #include "bundle/runner.h"
@@ -43,6 +44,150 @@ namespace
         return bundle::runner_t::app()->probe(file_path, offset, size, compressedSize);
     }
 
+    // set_deps_files:
+    // Record the deps file locations on the framework definitions the same way the dependency resolver does.
+    void set_deps_files(const arguments_t &args, fx_definition_vector_t &fx_definitions)
+    {
+        for (size_t i = 0; i < fx_definitions.size(); ++i)
+        {
+            fx_definitions[i]->set_deps_file(i == 0
+                ? args.deps_path
+                : deps_resolver_t::get_fx_deps(fx_definitions[i]->get_dir(), fx_definitions[i]->get_name()));
+        }
+    }
+
+    // resolve_dependencies:
+    // Parse the deps files and probe for the app's dependencies.
+    int resolve_dependencies(hostpolicy_init_t &hostpolicy_init, const arguments_t &args, bool breadcrumbs_enabled, resolution_cache_entry_t *resolved)
+    {
+        deps_resolver_t resolver
+            {
+                args,
+                hostpolicy_init.fx_definitions,
+                /* root_framework_rid_fallback_graph */ nullptr, // This means that the fx_definitions contains the root framework
+                hostpolicy_init.is_framework_dependent
+            };
+
+        pal::string_t resolver_errors;
+        if (!resolver.valid(&resolver_errors))
+        {
+            trace::error(_X("Error initializing the dependency resolver: %s"), resolver_errors.c_str());
+            return StatusCode::ResolverInitFailure;
+        }
+
+        probe_paths_t &probe_paths = resolved->probe_paths;
+
+        // Setup breadcrumbs.
+        if (breadcrumbs_enabled)
+        {
+            pal::string_t policy_name = _STRINGIFY(HOST_POLICY_PKG_NAME);
+            pal::string_t policy_version = _STRINGIFY(HOST_POLICY_PKG_VER);
+
+            // Always insert the hostpolicy that the code is running on.
+            resolved->breadcrumbs.insert(policy_name);
+            resolved->breadcrumbs.insert(policy_name + _X(",") + policy_version);
+
+            if (!resolver.resolve_probe_paths(&probe_paths, &resolved->breadcrumbs))
+            {
+                return StatusCode::ResolverResolveFailure;
+            }
+        }
+        else
+        {
+            if (!resolver.resolve_probe_paths(&probe_paths, nullptr))
+            {
+                return StatusCode::ResolverResolveFailure;
+            }
+        }
+
+        const fx_definition_vector_t &fx_definitions = resolver.get_fx_definitions();
+
+        pal::string_t &fx_deps_str = resolved->fx_deps;
+        if (resolver.is_framework_dependent())
+        {
+            // Use the root fx to define FX_DEPS_FILE
+            fx_deps_str = get_root_framework(fx_definitions).get_deps_file();
+        }
+
+        fx_definition_vector_t::iterator fx_begin;
+        fx_definition_vector_t::iterator fx_end;
+        resolver.get_app_context_deps_files_range(&fx_begin, &fx_end);
+
+        pal::string_t &app_context_deps_str = resolved->app_context_deps;
+        fx_definition_vector_t::iterator fx_curr = fx_begin;
+        while (fx_curr != fx_end)
+        {
+            if (fx_curr != fx_begin)
+                app_context_deps_str += _X(';');
+
+            // For the application's .deps.json if this is single file, 3.1 backward compat
+            // then the path used internally is the bundle path, but externally we need to report
+            // the path to the extraction folder.
+            if (fx_curr == fx_begin && bundle::info_t::is_single_file_bundle() && bundle::runner_t::app()->is_netcoreapp3_compat_mode())
+            {
+                pal::string_t deps_path = bundle::runner_t::app()->extraction_path();
+                append_path(&deps_path, get_filename((*fx_curr)->get_deps_file()).c_str());
+                app_context_deps_str += deps_path;
+            }
+            else
+            {
+                app_context_deps_str += (*fx_curr)->get_deps_file();
+            }
+
+            ++fx_curr;
+        }
+
+        resolver.get_app_dir(&resolved->app_base);
+        resolved->probe_directories = resolver.get_lookup_probe_directories();
+
+        return StatusCode::Success;
+    }
+
+#if defined(__linux__)
+    // bundle_pinvoke_override:
+    // Resolve pinvokes into native libraries that are loaded from the app-bundle instead of being extracted.
+    const void* STDMETHODCALLTYPE bundle_pinvoke_override(const char* libraryName, const char* entrypointName)
+    {
+        const bundle::runner_t* app = bundle::runner_t::app();
+        if (libraryName == nullptr || app == nullptr || !app->native_libraries_in_memory())
+        {
+            return nullptr;
+        }
+
+        static pal::mutex_t lock;
+        static std::unordered_map<std::string, pal::dll_t> loaded_libraries;
+
+        pal::dll_t dll = nullptr;
+        {
+            std::lock_guard<pal::mutex_t> lock_guard(lock);
+
+            auto existing = loaded_libraries.find(libraryName);
+            if (existing != loaded_libraries.end())
+            {
+                dll = existing->second;
+            }
+            else
+            {
+                // Probe the same file name variations the runtime would try for the library.
+                pal::string_t name(libraryName);
+                const pal::string_t candidates[] = { name, name + _X(".so"), _X("lib") + name + _X(".so") };
+                for (const pal::string_t& candidate : candidates)
+                {
+                    if (app->load_native_library(candidate, &dll))
+                    {
+                        break;
+                    }
+                }
+
+                // Failures are remembered too, so that the bundle is not probed again for the same library.
+                loaded_libraries.emplace(libraryName, dll);
+            }
+        }
+
+        return dll == nullptr ? nullptr : pal::get_symbol(dll, entrypointName);
+    }
+#endif
+
 #if defined(NATIVE_LIBS_EMBEDDED)
     extern "C" const void* CompressionResolveDllImport(const char* name);
     extern "C" const void* SecurityResolveDllImport(const char* name);
@@ -88,7 +233,11 @@ namespace
         }
 #endif
 
+#if defined(__linux__)
+        return bundle_pinvoke_override(libraryName, entrypointName);
+#else
         return nullptr;
+#endif
     }
 #endif
 }
@@ -100,46 +249,34 @@ int hostpolicy_context_t::initialize(hostpolicy_init_t &hostpolicy_init, const a
     host_path = args.host_path;
     breadcrumbs_enabled = enable_breadcrumbs;
 
-    deps_resolver_t resolver
+    resolution_cache_t resolution_cache
         {
             args,
             hostpolicy_init.fx_definitions,
-            /* root_framework_rid_fallback_graph */ nullptr, // This means that the fx_definitions contains the root framework
-            hostpolicy_init.is_framework_dependent
+            hostpolicy_init.is_framework_dependent,
+            breadcrumbs_enabled
         };
 
-    pal::string_t resolver_errors;
-    if (!resolver.valid(&resolver_errors))
-    {
-        trace::error(_X("Error initializing the dependency resolver: %s"), resolver_errors.c_str());
-        return StatusCode::ResolverInitFailure;
-    }
-
-    probe_paths_t probe_paths;
-
-    // Setup breadcrumbs.
-    if (breadcrumbs_enabled)
+    resolution_cache_entry_t resolved;
+    if (resolution_cache.read(&resolved))
     {
-        pal::string_t policy_name = _STRINGIFY(HOST_POLICY_PKG_NAME);
-        pal::string_t policy_version = _STRINGIFY(HOST_POLICY_PKG_VER);
-
-        // Always insert the hostpolicy that the code is running on.
-        breadcrumbs.insert(policy_name);
-        breadcrumbs.insert(policy_name + _X(",") + policy_version);
-
-        if (!resolver.resolve_probe_paths(&probe_paths, &breadcrumbs))
-        {
-            return StatusCode::ResolverResolveFailure;
-        }
+        // The deps files are not parsed when the cached result is used, only record their locations.
+        set_deps_files(args, hostpolicy_init.fx_definitions);
     }
     else
     {
-        if (!resolver.resolve_probe_paths(&probe_paths, nullptr))
+        int rc = resolve_dependencies(hostpolicy_init, args, breadcrumbs_enabled, &resolved);
+        if (rc != StatusCode::Success)
         {
-            return StatusCode::ResolverResolveFailure;
+            return rc;
         }
+
+        resolution_cache.write(resolved);
     }
 
+    breadcrumbs.insert(resolved.breadcrumbs.begin(), resolved.breadcrumbs.end());
+
+    probe_paths_t &probe_paths = resolved.probe_paths;
     clr_path = probe_paths.coreclr;
     if (clr_path.empty() || !pal::realpath(&clr_path))
     {
@@ -179,53 +316,17 @@ int hostpolicy_context_t::initialize(hostpolicy_init_t &hostpolicy_init, const a
         probe_paths.tpa.append(corelib_path);
     }
 
-    const fx_definition_vector_t &fx_definitions = resolver.get_fx_definitions();
-
-    pal::string_t fx_deps_str;
-    if (resolver.is_framework_dependent())
-    {
-        // Use the root fx to define FX_DEPS_FILE
-        fx_deps_str = get_root_framework(fx_definitions).get_deps_file();
-    }
-
-    fx_definition_vector_t::iterator fx_begin;
-    fx_definition_vector_t::iterator fx_end;
-    resolver.get_app_context_deps_files_range(&fx_begin, &fx_end);
-
-    pal::string_t app_context_deps_str;
-    fx_definition_vector_t::iterator fx_curr = fx_begin;
-    while (fx_curr != fx_end)
-    {
-        if (fx_curr != fx_begin)
-            app_context_deps_str += _X(';');
-
-        // For the application's .deps.json if this is single file, 3.1 backward compat
-        // then the path used internally is the bundle path, but externally we need to report
-        // the path to the extraction folder.
-        if (fx_curr == fx_begin && bundle::info_t::is_single_file_bundle() && bundle::runner_t::app()->is_netcoreapp3_compat_mode())
-        {
-            pal::string_t deps_path = bundle::runner_t::app()->extraction_path();
-            append_path(&deps_path, get_filename((*fx_curr)->get_deps_file()).c_str());
-            app_context_deps_str += deps_path;
-        }
-        else
-        {
-            app_context_deps_str += (*fx_curr)->get_deps_file();
-        }
-
-        ++fx_curr;
-    }
-
     // Build properties for CoreCLR instantiation
-    pal::string_t app_base;
-    resolver.get_app_dir(&app_base);
+    const pal::string_t &app_base = resolved.app_base;
+    const pal::string_t &fx_deps_str = resolved.fx_deps;
+    const pal::string_t &app_context_deps_str = resolved.app_context_deps;
     coreclr_properties.add(common_property::TrustedPlatformAssemblies, probe_paths.tpa.c_str());
     coreclr_properties.add(common_property::NativeDllSearchDirectories, probe_paths.native.c_str());
     coreclr_properties.add(common_property::PlatformResourceRoots, probe_paths.resources.c_str());
     coreclr_properties.add(common_property::AppContextBaseDirectory, app_base.c_str());
     coreclr_properties.add(common_property::AppContextDepsFiles, app_context_deps_str.c_str());
     coreclr_properties.add(common_property::FxDepsFile, fx_deps_str.c_str());
-    coreclr_properties.add(common_property::ProbingDirectories, resolver.get_lookup_probe_directories().c_str());
+    coreclr_properties.add(common_property::ProbingDirectories, resolved.probe_directories.c_str());
     coreclr_properties.add(common_property::RuntimeIdentifier, get_current_runtime_id(true /*use_fallback*/).c_str());
 
     bool set_app_paths = false;
@@ -288,8 +389,32 @@ int hostpolicy_context_t::initialize(hostpolicy_init_t &hostpolicy_init, const a
             log_duplicate_property_error(coreclr_property_bag_t::common_property_to_string(common_property::StartUpHooks));
             return StatusCode::LibHostDuplicateProperty;
         }
+
+        // Compressed assemblies let the runtime decompress the ones needed at startup ahead of time.
+        pal::string_t compressed_assemblies = bundle::runner_t::app()->get_compressed_assemblies();
+        if (!compressed_assemblies.empty() &&
+            !coreclr_properties.add(common_property::BundleCompressedAssemblies, compressed_assemblies.c_str()))
+        {
+            log_duplicate_property_error(coreclr_property_bag_t::common_property_to_string(common_property::BundleCompressedAssemblies));
+            return StatusCode::LibHostDuplicateProperty;
+        }
     }
 
+#if defined(__linux__) && !defined(NATIVE_LIBS_EMBEDDED)
+    // PInvoke Override for native libraries loaded from the bundle
+    if (bundle::info_t::is_single_file_bundle() && bundle::runner_t::app()->native_libraries_in_memory())
+    {
+        pal::stringstream_t ptr_stream;
+        ptr_stream << "0x" << std::hex << (size_t)(&bundle_pinvoke_override);
+
+        if (!coreclr_properties.add(common_property::PInvokeOverride, ptr_stream.str().c_str()))
+        {
+            log_duplicate_property_error(coreclr_property_bag_t::common_property_to_string(common_property::PInvokeOverride));
+            return StatusCode::LibHostDuplicateProperty;
+        }
+    }
+#endif
+
 #if defined(NATIVE_LIBS_EMBEDDED)
     // PInvoke Override
     if (bundle::info_t::is_single_file_bundle())
@@ -0,0 +1,294 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+#include "resolution_cache.h"
+
+#include <trace.h>
+#include <utils.h>
+#include "bundle/info.h"
+
+namespace
+{
+    const uint32_t cache_signature = 0x43525444; // 'DTRC'
+    const uint32_t cache_version = 1;
+
+    // Key, 4 probe paths, fx deps, app context deps, app base and probe directories, followed by the breadcrumbs
+    const uint32_t cache_fixed_string_count = 9;
+
+    struct cache_header_t
+    {
+        uint32_t signature;
+        uint32_t version;
+        uint32_t char_size;
+        uint32_t string_count;
+        uint64_t size;
+    };
+
+    // FNV-1a
+    const uint64_t hash_offset_basis = 14695981039346656037ULL;
+    const uint64_t hash_prime = 1099511628211ULL;
+
+    uint64_t hash_bytes(uint64_t hash, const void* data, size_t size)
+    {
+        const unsigned char* bytes = static_cast<const unsigned char*>(data);
+        for (size_t i = 0; i < size; ++i)
+        {
+            hash ^= bytes[i];
+            hash *= hash_prime;
+        }
+
+        return hash;
+    }
+
+    bool hash_file(const pal::string_t& path, uint64_t* hash, uint64_t* size)
+    {
+        std::ifstream file(path, std::ios::in | std::ios::binary);
+        if (!file.good())
+        {
+            return false;
+        }
+
+        *hash = hash_offset_basis;
+        *size = 0;
+
+        char buffer[4096];
+        while (file.read(buffer, sizeof(buffer)) || file.gcount() > 0)
+        {
+            size_t read = static_cast<size_t>(file.gcount());
+            *hash = hash_bytes(*hash, buffer, read);
+            *size += read;
+        }
+
+        return true;
+    }
+
+    void append_string(std::vector<char>* buffer, const pal::string_t& value)
+    {
+        uint32_t length = static_cast<uint32_t>(value.length());
+        const char* length_bytes = reinterpret_cast<const char*>(&length);
+        buffer->insert(buffer->end(), length_bytes, length_bytes + sizeof(length));
+
+        const char* chars = reinterpret_cast<const char*>(value.data());
+        buffer->insert(buffer->end(), chars, chars + length * sizeof(pal::char_t));
+    }
+
+    bool read_string(const char* data, size_t size, size_t* offset, pal::string_t* value)
+    {
+        uint32_t length;
+        if (size - *offset < sizeof(length))
+        {
+            return false;
+        }
+
+        memcpy(&length, data + *offset, sizeof(length));
+        *offset += sizeof(length);
+
+        size_t byte_length = static_cast<size_t>(length) * sizeof(pal::char_t);
+        if (size - *offset < byte_length)
+        {
+            return false;
+        }
+
+        value->resize(length);
+        memcpy(&(*value)[0], data + *offset, byte_length);
+        *offset += byte_length;
+        return true;
+    }
+}
+
+resolution_cache_t::resolution_cache_t(
+    const arguments_t& args,
+    const fx_definition_vector_t& fx_definitions,
+    bool is_framework_dependent,
+    bool breadcrumbs_enabled)
+{
+    pal::string_t cache_dir;
+    if (!pal::getenv(_X("DOTNET_HOST_RESOLUTION_CACHE"), &cache_dir) || cache_dir.empty())
+    {
+        return;
+    }
+
+    // Single-file bundles resolve from the bundle manifest and additional deps are not tracked by the key.
+    if (bundle::info_t::is_single_file_bundle() || !args.additional_deps_serialized.empty())
+    {
+        trace::verbose(_X("Host resolution cache is not used for this app."));
+        return;
+    }
+
+    if (!pal::directory_exists(cache_dir))
+    {
+        trace::verbose(_X("Host resolution cache directory [%s] does not exist."), cache_dir.c_str());
+        return;
+    }
+
+    pal::stringstream_t key;
+    key << _STRINGIFY(HOST_POLICY_PKG_VER) << _X('\n');
+    key << static_cast<int>(args.host_mode) << _X('\n');
+    key << is_framework_dependent << _X('\n');
+    key << breadcrumbs_enabled << _X('\n');
+    key << get_current_runtime_id(true /*use_fallback*/) << _X('\n');
+    key << args.managed_application << _X('\n');
+    key << args.app_root << _X('\n');
+    key << args.deps_path << _X('\n');
+    key << args.core_servicing << _X('\n') << pal::directory_exists(args.core_servicing) << _X('\n');
+    key << args.dotnet_shared_store << _X('\n') << pal::directory_exists(args.dotnet_shared_store) << _X('\n');
+
+    for (const auto& probe : args.probe_paths)
+    {
+        key << probe << _X('\n');
+    }
+
+    for (const auto& shared : args.env_shared_store)
+    {
+        key << shared << _X('\n') << pal::directory_exists(shared) << _X('\n');
+    }
+
+    for (const auto& global_shared : args.global_shared_stores)
+    {
+        key << global_shared << _X('\n') << pal::directory_exists(global_shared) << _X('\n');
+    }
+
+    for (size_t i = 0; i < fx_definitions.size(); ++i)
+    {
+        const fx_definition_t& fx = *fx_definitions[i];
+        pal::string_t deps_file = (i == 0) ? args.deps_path : deps_resolver_t::get_fx_deps(fx.get_dir(), fx.get_name());
+
+        key << fx.get_name() << _X('\n') << fx.get_dir() << _X('\n') << fx.get_found_version() << _X('\n');
+        key << deps_file << _X('\n');
+
+        uint64_t hash;
+        uint64_t size;
+        if (hash_file(deps_file, &hash, &size))
+        {
+            key << std::hex << hash << _X(':') << std::dec << size << _X('\n');
+        }
+        else
+        {
+            key << _X("<missing>\n");
+        }
+    }
+
+    m_key = key.str();
+
+    pal::stringstream_t file_name;
+    file_name << std::hex << hash_bytes(hash_offset_basis, m_key.data(), m_key.length() * sizeof(pal::char_t)) << _X(".bin");
+
+    m_cache_path = cache_dir;
+    append_path(&m_cache_path, file_name.str().c_str());
+    trace::verbose(_X("Using host resolution cache file [%s]"), m_cache_path.c_str());
+}
+
+bool resolution_cache_t::read(resolution_cache_entry_t* entry) const
+{
+    if (!is_enabled() || !pal::file_exists(m_cache_path))
+    {
+        return false;
+    }
+
+    size_t size;
+    const void* view = pal::mmap_read(m_cache_path, &size);
+    if (view == nullptr)
+    {
+        return false;
+    }
+
+    const char* data = static_cast<const char*>(view);
+    bool matched = false;
+
+    cache_header_t header;
+    if (size >= sizeof(header))
+    {
+        memcpy(&header, data, sizeof(header));
+        matched = header.signature == cache_signature
+            && header.version == cache_version
+            && header.char_size == sizeof(pal::char_t)
+            && header.size == size
+            && header.string_count >= cache_fixed_string_count;
+    }
+
+    if (matched)
+    {
+        size_t offset = sizeof(header);
+        pal::string_t key;
+        matched = read_string(data, size, &offset, &key) && key == m_key
+            && read_string(data, size, &offset, &entry->probe_paths.tpa)
+            && read_string(data, size, &offset, &entry->probe_paths.native)
+            && read_string(data, size, &offset, &entry->probe_paths.resources)
+            && read_string(data, size, &offset, &entry->probe_paths.coreclr)
+            && read_string(data, size, &offset, &entry->fx_deps)
+            && read_string(data, size, &offset, &entry->app_context_deps)
+            && read_string(data, size, &offset, &entry->app_base)
+            && read_string(data, size, &offset, &entry->probe_directories);
+
+        entry->breadcrumbs.clear();
+        for (uint32_t i = cache_fixed_string_count; matched && i < header.string_count; ++i)
+        {
+            pal::string_t breadcrumb;
+            matched = read_string(data, size, &offset, &breadcrumb);
+            entry->breadcrumbs.insert(breadcrumb);
+        }
+    }
+
+    pal::munmap(const_cast<void*>(view), size);
+
+    trace::verbose(_X("Host resolution cache %s"), matched ? _X("hit") : _X("is stale"));
+    return matched;
+}
+
+void resolution_cache_t::write(const resolution_cache_entry_t& entry) const
+{
+    if (!is_enabled())
+    {
+        return;
+    }
+
+    cache_header_t header;
+    header.signature = cache_signature;
+    header.version = cache_version;
+    header.char_size = sizeof(pal::char_t);
+    header.string_count = cache_fixed_string_count + static_cast<uint32_t>(entry.breadcrumbs.size());
+    header.size = 0;
+
+    std::vector<char> buffer(sizeof(header));
+    append_string(&buffer, m_key);
+    append_string(&buffer, entry.probe_paths.tpa);
+    append_string(&buffer, entry.probe_paths.native);
+    append_string(&buffer, entry.probe_paths.resources);
+    append_string(&buffer, entry.probe_paths.coreclr);
+    append_string(&buffer, entry.fx_deps);
+    append_string(&buffer, entry.app_context_deps);
+    append_string(&buffer, entry.app_base);
+    append_string(&buffer, entry.probe_directories);
+    for (const auto& breadcrumb : entry.breadcrumbs)
+    {
+        append_string(&buffer, breadcrumb);
+    }
+
+    header.size = buffer.size();
+    memcpy(buffer.data(), &header, sizeof(header));
+
+    // Write to a process specific file first so that concurrent readers never observe a partial entry.
+    pal::string_t temp_path = m_cache_path + _X(".") + pal::to_string(pal::get_pid()) + _X(".tmp");
+    FILE* file = pal::file_open(temp_path, _X("wb"));
+    if (file == nullptr)
+    {
+        trace::verbose(_X("Failed to create host resolution cache file [%s]"), temp_path.c_str());
+        return;
+    }
+
+    bool written = fwrite(buffer.data(), 1, buffer.size(), file) == buffer.size();
+    written = (fclose(file) == 0) && written;
+
+    if (written)
+    {
+        // Renaming over an existing file is not supported everywhere, the stale entry is removed first.
+        pal::remove(m_cache_path.c_str());
+        written = pal::rename(temp_path.c_str(), m_cache_path.c_str()) == 0;
+    }
+
+    if (!written)
+    {
+        pal::remove(temp_path.c_str());
+        trace::verbose(_X("Failed to write host resolution cache file [%s]"), m_cache_path.c_str());
+    }
+}
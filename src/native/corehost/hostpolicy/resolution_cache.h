@@ -0,0 +1,51 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+#ifndef __RESOLUTION_CACHE_H__
+#define __RESOLUTION_CACHE_H__
+
+#include <pal.h>
+
+#include "args.h"
+#include "deps_resolver.h"
+
+// The outputs of dependency resolution which are needed to build the runtime properties of an app.
+struct resolution_cache_entry_t
+{
+    probe_paths_t probe_paths;
+    pal::string_t fx_deps;
+    pal::string_t app_context_deps;
+    pal::string_t app_base;
+    pal::string_t probe_directories;
+    std::unordered_set<pal::string_t> breadcrumbs;
+};
+
+// Binary cache of the dependency resolution result of an app.
+//
+// The cache is opt-in: it is enabled by pointing the DOTNET_HOST_RESOLUTION_CACHE environment variable
+// to a writable directory. Each entry is keyed by the host inputs (app, probe paths, frameworks and
+// their locations) and by the size and content hash of every .deps.json file involved, so that any
+// change to those invalidates the entry. Entries are memory-mapped when read.
+class resolution_cache_t
+{
+public:
+    resolution_cache_t(
+        const arguments_t& args,
+        const fx_definition_vector_t& fx_definitions,
+        bool is_framework_dependent,
+        bool breadcrumbs_enabled);
+
+    bool is_enabled() const { return !m_cache_path.empty(); }
+
+    // Reads the cached entry, returns false if there is none or it does not match the current inputs.
+    bool read(resolution_cache_entry_t* entry) const;
+
+    // Writes the entry for the current inputs, failures are not fatal.
+    void write(const resolution_cache_entry_t& entry) const;
+
+private:
+    pal::string_t m_cache_path;
+    pal::string_t m_key;
+};
+
+#endif // __RESOLUTION_CACHE_H__
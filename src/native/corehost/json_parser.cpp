@@ -78,27 +78,19 @@ bool json_parser_t::parse_raw_data(char* data, int64_t size, const pal::string_t
 {
     assert(data != nullptr);
 
-    constexpr auto flags = rapidjson::ParseFlag::kParseStopWhenDoneFlag | rapidjson::ParseFlag::kParseCommentsFlag;
 #ifdef _WIN32
     // Can't use in-situ parsing on Windows, as JSON data is encoded in
     // UTF-8 and the host expects wide strings.  m_document will store
     // data in UTF-16 (with pal::char_t as the character type), but it
     // has to know that data is encoded in UTF-8 to convert during parsing.
-    m_document.Parse<flags, rapidjson::UTF8<>>(data);
+    m_document.Parse<parse_flags, rapidjson::UTF8<>>(data);
 #else // _WIN32
-    m_document.ParseInsitu<flags>(data);
+    m_document.ParseInsitu<parse_flags>(data);
 #endif // _WIN32
 
     if (m_document.HasParseError())
     {
-        int line, column;
-        size_t offset = m_document.GetErrorOffset();
-
-        get_line_column_from_offset(data, size, offset, &line, &column);
-
-        trace::error(_X("A JSON parsing exception occurred in [%s], offset %zu (line %d, column %d): %s"),
-            context.c_str(), offset, line, column,
-            rapidjson::GetParseError_En(m_document.GetParseError()));
+        report_parse_error(data, size, m_document.GetErrorOffset(), m_document.GetParseError(), context);
         return false;
     }
 
@@ -111,7 +103,29 @@ bool json_parser_t::parse_raw_data(char* data, int64_t size, const pal::string_t
     return true;
 }
 
+void json_parser_t::report_parse_error(const char* data, int64_t size, size_t offset, rapidjson::ParseErrorCode code, const pal::string_t& context)
+{
+    int line, column;
+    get_line_column_from_offset(data, size, offset, &line, &column);
+
+    trace::error(_X("A JSON parsing exception occurred in [%s], offset %zu (line %d, column %d): %s"),
+        context.c_str(), offset, line, column,
+        rapidjson::GetParseError_En(code));
+}
+
 bool json_parser_t::parse_file(const pal::string_t& path)
+{
+    char* data;
+    int64_t size;
+    if (!load_file(path, &data, &size))
+    {
+        return false;
+    }
+
+    return parse_raw_data(data, size, path);
+}
+
+bool json_parser_t::load_file(const pal::string_t& path, char** data, int64_t* size)
 {
     // This code assumes that the caller has checked that the file `path` exists
     // either within the bundle, or as a real file on disk.
@@ -127,8 +141,9 @@ bool json_parser_t::parse_file(const pal::string_t& path)
 
         if (m_bundle_data != nullptr)
         {
-            bool result = parse_raw_data(m_bundle_data, m_bundle_location->size, path);
-            return result;
+            *data = m_bundle_data;
+            *size = m_bundle_location->size;
+            return true;
         }
     }
 
@@ -153,7 +168,9 @@ bool json_parser_t::parse_file(const pal::string_t& path)
     realloc_buffer(static_cast<size_t>(stream_size - current_pos));
     file.read(m_json.data(), stream_size - current_pos);
 
-    return parse_raw_data(m_json.data(), m_json.size(), path);
+    *data = m_json.data();
+    *size = m_json.size();
+    return true;
 }
 
 json_parser_t::~json_parser_t()
@@ -14,6 +14,7 @@
 
 #include "pal.h"
 #include "rapidjson/document.h"
+#include "rapidjson/reader.h"
 #include "rapidjson/fwd.h"
 #include <vector>
 #include "bundle/info.h"
@@ -33,6 +34,38 @@ class json_parser_t {
         bool parse_raw_data(char* data, int64_t size, const pal::string_t& context);
         bool parse_file(const pal::string_t& path);
 
+        // Parses the file without building a document, by passing the values to a rapidjson
+        // SAX handler whose string type is internal_encoding_type_t. On Unix the file is parsed
+        // in-situ so the strings passed to the handler point into the file data, which stays
+        // alive until this parser is destroyed; on Windows they are only valid during the call.
+        template<typename handler_t>
+        bool parse_file(const pal::string_t& path, handler_t& handler)
+        {
+            char* data;
+            int64_t size;
+            if (!load_file(path, &data, &size))
+            {
+                return false;
+            }
+
+            rapidjson::GenericReader<rapidjson::UTF8<>, internal_encoding_type_t> reader;
+#ifdef _WIN32
+            rapidjson::StringStream stream(data);
+            rapidjson::ParseResult result = reader.Parse<parse_flags>(stream, handler);
+#else // _WIN32
+            rapidjson::InsituStringStream stream(data);
+            rapidjson::ParseResult result = reader.Parse<parse_flags | rapidjson::kParseInsituFlag>(stream, handler);
+#endif // _WIN32
+
+            if (result.IsError())
+            {
+                report_parse_error(data, size, result.Offset(), result.Code(), path);
+                return false;
+            }
+
+            return true;
+        }
+
         json_parser_t()
             : m_bundle_data(nullptr)
             , m_bundle_location(nullptr) {}
@@ -51,7 +84,11 @@ class json_parser_t {
         char* m_bundle_data; // The memory mapped bytes of the application bundle.
         const bundle::location_t* m_bundle_location; // Location of this json file within the bundle.
 
+        static constexpr unsigned parse_flags = rapidjson::ParseFlag::kParseStopWhenDoneFlag | rapidjson::ParseFlag::kParseCommentsFlag;
+
         void realloc_buffer(size_t size);
+        bool load_file(const pal::string_t& path, char** data, int64_t* size);
+        static void report_parse_error(const char* data, int64_t size, size_t offset, rapidjson::ParseErrorCode code, const pal::string_t& context);
 };
 
 #endif // __JSON_PARSER_H__
@@ -46,6 +46,13 @@ eventpipe_collect_tracing_command_try_parse_rundown_requested (
 	uint32_t *buffer_len,
 	bool *rundown_requested);
 
+static
+bool
+eventpipe_collect_tracing_command_try_parse_session_flags (
+	uint8_t **buffer,
+	uint32_t *buffer_len,
+	uint32_t *session_flags);
+
 static
 bool
 eventpipe_collect_tracing_command_try_parse_config (
@@ -65,6 +72,12 @@ eventpipe_collect_tracing2_command_try_parse_payload (
 	uint8_t *buffer,
 	uint16_t buffer_len);
 
+static
+uint8_t *
+eventpipe_collect_tracing3_command_try_parse_payload (
+	uint8_t *buffer,
+	uint16_t buffer_len);
+
 static
 bool
 eventpipe_protocol_helper_stop_tracing (
@@ -83,6 +96,12 @@ eventpipe_protocol_helper_collect_tracing_2 (
 	DiagnosticsIpcMessage *message,
 	DiagnosticsIpcStream *stream);
 
+static
+bool
+eventpipe_protocol_helper_collect_tracing_3 (
+	DiagnosticsIpcMessage *message,
+	DiagnosticsIpcStream *stream);
+
 static
 bool
 eventpipe_protocol_helper_unknown_command (
@@ -143,6 +162,22 @@ eventpipe_collect_tracing_command_try_parse_rundown_requested (
 	return ds_ipc_message_try_parse_value (buffer, buffer_len, (uint8_t *)rundown_requested, (uint32_t)sizeof (bool));
 }
 
+static
+inline
+bool
+eventpipe_collect_tracing_command_try_parse_session_flags (
+	uint8_t **buffer,
+	uint32_t *buffer_len,
+	uint32_t *session_flags)
+{
+	EP_ASSERT (buffer != NULL);
+	EP_ASSERT (buffer_len != NULL);
+	EP_ASSERT (session_flags != NULL);
+
+	bool can_parse = ds_ipc_message_try_parse_uint32_t (buffer, buffer_len, session_flags);
+	return can_parse && ((*session_flags & ~(uint32_t)(EP_COLLECT_TRACING_FLAGS_COMPRESS_BLOCKS | EP_COLLECT_TRACING_FLAGS_SHARED_MEMORY)) == 0);
+}
+
 static
 bool
 eventpipe_collect_tracing_command_try_parse_config (
@@ -301,6 +336,42 @@ ep_on_error:
 	ep_exit_error_handler ();
 }
 
+/*
+* EventPipeCollectTracing3CommandPayload
+*/
+
+static
+uint8_t *
+eventpipe_collect_tracing3_command_try_parse_payload (
+	uint8_t *buffer,
+	uint16_t buffer_len)
+{
+	EP_ASSERT (buffer != NULL);
+
+	uint8_t * buffer_cursor = buffer;
+	uint32_t buffer_cursor_len = buffer_len;
+
+	EventPipeCollectTracing2CommandPayload *instance = ds_eventpipe_collect_tracing2_command_payload_alloc ();
+	ep_raise_error_if_nok (instance != NULL);
+
+	instance->incoming_buffer = buffer;
+
+	if (!eventpipe_collect_tracing_command_try_parse_circular_buffer_size (&buffer_cursor, &buffer_cursor_len, &instance->circular_buffer_size_in_mb ) ||
+		!eventpipe_collect_tracing_command_try_parse_serialization_format (&buffer_cursor, &buffer_cursor_len, &instance->serialization_format) ||
+		!eventpipe_collect_tracing_command_try_parse_rundown_requested (&buffer_cursor, &buffer_cursor_len, &instance->rundown_requested) ||
+		!eventpipe_collect_tracing_command_try_parse_session_flags (&buffer_cursor, &buffer_cursor_len, &instance->session_flags) ||
+		!eventpipe_collect_tracing_command_try_parse_config (&buffer_cursor, &buffer_cursor_len, &instance->provider_configs))
+		ep_raise_error ();
+
+ep_on_exit:
+	return (uint8_t *)instance;
+
+ep_on_error:
+	ds_eventpipe_collect_tracing2_command_payload_free (instance);
+	instance = NULL;
+	ep_exit_error_handler ();
+}
+
 EventPipeCollectTracing2CommandPayload *
 ds_eventpipe_collect_tracing2_command_payload_alloc (void)
 {
@@ -450,21 +521,28 @@ ep_on_error:
 
 static
 bool
-eventpipe_protocol_helper_collect_tracing_2 (
+eventpipe_protocol_helper_collect_tracing_from_payload2 (
 	DiagnosticsIpcMessage *message,
-	DiagnosticsIpcStream *stream)
+	DiagnosticsIpcStream *stream,
+	ds_ipc_parse_payload_func parse_func)
 {
 	ep_return_false_if_nok (message != NULL && stream != NULL);
 
 	bool result = false;
 	EventPipeCollectTracing2CommandPayload *payload;
-	payload = (EventPipeCollectTracing2CommandPayload *)ds_ipc_message_try_parse_payload (message, eventpipe_collect_tracing2_command_try_parse_payload);
+	payload = (EventPipeCollectTracing2CommandPayload *)ds_ipc_message_try_parse_payload (message, parse_func);
 
 	if (!payload) {
 		ds_ipc_message_send_error (stream, DS_IPC_E_BAD_ENCODING);
 		ep_raise_error ();
 	}
 
+	// Block compression is signaled in the block headers, which only exist in the nettrace format.
+	if ((payload->session_flags & EP_COLLECT_TRACING_FLAGS_COMPRESS_BLOCKS) && payload->serialization_format < EP_SERIALIZATION_FORMAT_NETTRACE_V4) {
+		ds_ipc_message_send_error (stream, DS_IPC_E_NOTSUPPORTED);
+		ep_raise_error ();
+	}
+
 	EventPipeSessionID session_id;
 	session_id = ep_enable (
 		NULL,
@@ -481,6 +559,22 @@ eventpipe_protocol_helper_collect_tracing_2 (
 		ds_ipc_message_send_error (stream, DS_IPC_E_FAIL);
 		ep_raise_error ();
 	} else {
+		// Nothing is written to the stream before streaming starts, the ring can still be attached.
+		// It is sized like the session buffer and handed to the client with the success response.
+		if (payload->session_flags & EP_COLLECT_TRACING_FLAGS_SHARED_MEMORY) {
+			uint32_t ring_size_in_mb = payload->circular_buffer_size_in_mb < 1024 ? payload->circular_buffer_size_in_mb : 1024;
+			if (!ds_ipc_stream_attach_shared_ring (stream, ring_size_in_mb * 1024 * 1024)) {
+				ds_ipc_message_send_error (stream, DS_IPC_E_NOTSUPPORTED);
+				// The session owns the stream, disabling it also frees the stream.
+				ep_disable (session_id);
+				ep_exit_error_handler ();
+			}
+		}
+
+		// Failing to compress is not fatal, the blocks are then streamed as is.
+		if ((payload->session_flags & EP_COLLECT_TRACING_FLAGS_COMPRESS_BLOCKS) && !ep_enable_block_compression (session_id))
+			DS_LOG_WARNING_0 ("Failed to enable EventPipe block compression, streaming uncompressed blocks.");
+
 		eventpipe_protocol_helper_send_start_tracing_success (stream, session_id);
 		ep_start_streaming (session_id);
 	}
@@ -497,6 +591,24 @@ ep_on_error:
 	ep_exit_error_handler ();
 }
 
+static
+bool
+eventpipe_protocol_helper_collect_tracing_2 (
+	DiagnosticsIpcMessage *message,
+	DiagnosticsIpcStream *stream)
+{
+	return eventpipe_protocol_helper_collect_tracing_from_payload2 (message, stream, eventpipe_collect_tracing2_command_try_parse_payload);
+}
+
+static
+bool
+eventpipe_protocol_helper_collect_tracing_3 (
+	DiagnosticsIpcMessage *message,
+	DiagnosticsIpcStream *stream)
+{
+	return eventpipe_protocol_helper_collect_tracing_from_payload2 (message, stream, eventpipe_collect_tracing3_command_try_parse_payload);
+}
+
 static
 bool
 eventpipe_protocol_helper_unknown_command (
@@ -532,6 +644,9 @@ ds_eventpipe_protocol_helper_handle_ipc_message (
 	case EP_COMMANDID_COLLECT_TRACING_2:
 		result = eventpipe_protocol_helper_collect_tracing_2 (message, stream);
 		break;
+	case EP_COMMANDID_COLLECT_TRACING_3:
+		result = eventpipe_protocol_helper_collect_tracing_3 (message, stream);
+		break;
 	case EP_COMMANDID_STOP_TRACING:
 		result = eventpipe_protocol_helper_stop_tracing (message, stream);
 		break;
@@ -54,7 +54,7 @@ ds_eventpipe_collect_tracing_command_payload_free (EventPipeCollectTracingComman
 * EventPipeCollectTracing2CommandPayload
 */
 
-// Command = 0x0202
+// Command = 0x0203, also used by CollectTracing3 (0x0204)
 #if defined(DS_INLINE_GETTER_SETTER) || defined(DS_IMPL_EVENTPIPE_PROTOCOL_GETTER_SETTER)
 struct _EventPipeCollectTracing2CommandPayload {
 #else
@@ -62,7 +62,8 @@ struct _EventPipeCollectTracing2CommandPayload_Internal {
 #endif
 	// The protocol buffer is defined as:
 	// X, Y, Z means encode bytes for X followed by bytes for Y followed by bytes for Z
-	// message = uint circularBufferMB, uint format, array<provider_config> providers
+	// message = uint circularBufferMB, uint format, bool rundownRequested, array<provider_config> providers
+	// CollectTracing3 message = uint circularBufferMB, uint format, bool rundownRequested, uint sessionFlags, array<provider_config> providers
 	// uint = 4 little endian bytes
 	// wchar = 2 little endian bytes, UTF16 encoding
 	// array<T> = uint length, length # of Ts
@@ -74,6 +75,8 @@ struct _EventPipeCollectTracing2CommandPayload_Internal {
 	uint32_t circular_buffer_size_in_mb;
 	EventPipeSerializationFormat serialization_format;
 	bool rundown_requested;
+	// EventPipeCollectTracingFlags, always none for CollectTracing2.
+	uint32_t session_flags;
 };
 
 #if !defined(DS_INLINE_GETTER_SETTER) && !defined(DS_IMPL_EVENTPIPE_PROTOCOL_GETTER_SETTER)
@@ -854,6 +854,14 @@ ds_ipc_stream_flush (DiagnosticsIpcStream *ipc_stream)
 	return ipc_stream_flush_func (ipc_stream);
 }
 
+bool
+ds_ipc_stream_attach_shared_ring (
+	DiagnosticsIpcStream *ipc_stream,
+	uint32_t ring_size)
+{
+	return false;
+}
+
 bool
 ds_ipc_stream_close (
 	DiagnosticsIpcStream *ipc_stream,
@@ -42,6 +42,15 @@
 #include <netinet/tcp.h>
 #include <netdb.h>
 #endif
+
+#if defined (DS_IPC_PAL_AF_UNIX) && defined (__linux__)
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#ifdef SYS_memfd_create
+#define DS_IPC_PAL_SHARED_RING
+#endif
+#endif
 #endif
 
 #ifdef HOST_WIN32
@@ -125,6 +134,35 @@ ep_rt_object_array_free (void *ptr)
 }
 #endif
 
+#ifdef DS_IPC_PAL_SHARED_RING
+#ifndef MFD_CLOEXEC
+#define MFD_CLOEXEC 0x0001U
+#endif
+
+#define DS_IPC_SHARED_RING_MAGIC 0x42525045 // 'EPRB'
+#define DS_IPC_SHARED_RING_VERSION 1
+#define DS_IPC_SHARED_RING_MIN_CAPACITY (64 * 1024)
+#define DS_IPC_SHARED_RING_MAX_CAPACITY (1024 * 1024 * 1024)
+
+// Interval at which a writer blocked on a full ring checks that the consumer is still connected.
+#define DS_IPC_SHARED_RING_WAIT_MS 10
+
+// Header at the start of the shared ring mapping, the data area follows it. Positions count the
+// bytes produced and consumed since the ring was created, write_position is only updated by the
+// runtime and read_position only by the consumer. The consumer detects the end of the stream
+// when the diagnostics socket is closed, once it has drained the ring up to write_position.
+typedef struct _DiagnosticsIpcSharedRingHeader {
+	uint32_t magic;
+	uint32_t version;
+	uint32_t header_size;
+	uint32_t capacity;
+	uint64_t write_position;
+	uint8_t padding1 [40];
+	uint64_t read_position;
+	uint8_t padding2 [56];
+} DiagnosticsIpcSharedRingHeader;
+#endif
+
 static bool _ipc_pal_socket_init = false;
 
 /*
@@ -155,6 +193,17 @@ ipc_socket_send (
 	ssize_t bytes_to_write,
 	ssize_t *bytes_written);
 
+#ifdef DS_IPC_PAL_SHARED_RING
+static
+bool
+ipc_socket_send_with_fd (
+	ds_ipc_socket_t s,
+	const uint8_t *buffer,
+	ssize_t bytes_to_write,
+	int fd,
+	ssize_t *bytes_written);
+#endif
+
 static
 bool
 ipc_transport_get_default_name (
@@ -181,6 +230,34 @@ ipc_alloc_tcp_address (
 	DiagnosticsIpcConnectionMode mode,
 	const ep_char8_t *ipc_name);
 
+#ifdef DS_IPC_PAL_SHARED_RING
+static
+bool
+ipc_shared_ring_wait_for_consumer (DiagnosticsIpcStream *ipc_stream);
+
+static
+bool
+ipc_shared_ring_write (
+	DiagnosticsIpcStream *ipc_stream,
+	const uint8_t *buffer,
+	uint32_t bytes_to_write,
+	uint32_t *bytes_written,
+	uint32_t timeout_ms);
+
+static
+void
+ipc_shared_ring_free (DiagnosticsIpcStream *ipc_stream);
+#endif
+
+static
+bool
+ipc_stream_socket_write (
+	DiagnosticsIpcStream *ipc_stream,
+	const uint8_t *buffer,
+	uint32_t bytes_to_write,
+	uint32_t *bytes_written,
+	uint32_t timeout_ms);
+
 static
 void
 ipc_stream_free_func (void *object);
@@ -652,6 +729,64 @@ ipc_socket_send (
 	return continue_send;
 }
 
+#ifdef DS_IPC_PAL_SHARED_RING
+static
+bool
+ipc_socket_send_with_fd (
+	ds_ipc_socket_t s,
+	const uint8_t *buffer,
+	ssize_t bytes_to_write,
+	int fd,
+	ssize_t *bytes_written)
+{
+	EP_ASSERT (bytes_to_write > 0);
+
+	union {
+		struct cmsghdr header;
+		uint8_t buffer [CMSG_SPACE (sizeof (int))];
+	} control;
+	memset (&control, 0, sizeof (control));
+
+	struct iovec iov;
+	iov.iov_base = (void *)buffer;
+	iov.iov_len = (size_t)bytes_to_write;
+
+	struct msghdr msg;
+	memset (&msg, 0, sizeof (msg));
+	msg.msg_iov = &iov;
+	msg.msg_iovlen = 1;
+	msg.msg_control = control.buffer;
+	msg.msg_controllen = sizeof (control.buffer);
+
+	struct cmsghdr *cmsg = CMSG_FIRSTHDR (&msg);
+	cmsg->cmsg_level = SOL_SOCKET;
+	cmsg->cmsg_type = SCM_RIGHTS;
+	cmsg->cmsg_len = CMSG_LEN (sizeof (int));
+	memcpy (CMSG_DATA (cmsg), &fd, sizeof (int));
+
+	ssize_t current_bytes_written;
+	DS_ENTER_BLOCKING_PAL_SECTION;
+	do {
+		current_bytes_written = sendmsg (s, &msg, 0);
+	} while (ipc_retry_syscall (current_bytes_written));
+	DS_EXIT_BLOCKING_PAL_SECTION;
+
+	if (current_bytes_written == DS_IPC_SOCKET_ERROR) {
+		*bytes_written = 0;
+		return false;
+	}
+
+	// The descriptor travels with the first byte, the rest of the buffer is a regular send.
+	bool success = true;
+	ssize_t remaining_bytes_written = 0;
+	if (current_bytes_written < bytes_to_write)
+		success = ipc_socket_send (s, buffer + current_bytes_written, bytes_to_write - current_bytes_written, &remaining_bytes_written);
+
+	*bytes_written = current_bytes_written + remaining_bytes_written;
+	return success;
+}
+#endif
+
 /*
  * DiagnosticsIpc.
  */
@@ -1367,21 +1502,108 @@ ep_on_error:
 	ep_exit_error_handler ();
 }
 
+#ifdef DS_IPC_PAL_SHARED_RING
 static
 bool
-ipc_stream_write_func (
-	void *object,
+ipc_shared_ring_wait_for_consumer (DiagnosticsIpcStream *ipc_stream)
+{
+	// No events are requested, poll only reports the consumer closing its end of the socket.
+	ds_ipc_pollfd_t pfd;
+	pfd.fd = ipc_stream->client_socket;
+	pfd.events = 0;
+	pfd.revents = 0;
+
+	return ipc_poll_fds (&pfd, 1, DS_IPC_SHARED_RING_WAIT_MS) == 0;
+}
+
+static
+bool
+ipc_shared_ring_write (
+	DiagnosticsIpcStream *ipc_stream,
 	const uint8_t *buffer,
 	uint32_t bytes_to_write,
 	uint32_t *bytes_written,
 	uint32_t timeout_ms)
 {
-	EP_ASSERT (object != NULL);
+	EP_ASSERT (ipc_stream != NULL);
+	EP_ASSERT (ipc_stream->shared_ring != NULL);
+
+	DiagnosticsIpcSharedRingHeader *header = (DiagnosticsIpcSharedRingHeader *)ipc_stream->shared_ring;
+	uint8_t *data = ipc_stream->shared_ring + sizeof (DiagnosticsIpcSharedRingHeader);
+
+	// Use the local capacity, the header is writable by the consumer.
+	uint32_t capacity = ipc_stream->shared_ring_size - (uint32_t)sizeof (DiagnosticsIpcSharedRingHeader);
+	uint64_t write_position = __atomic_load_n (&header->write_position, __ATOMIC_RELAXED);
+	uint32_t total_bytes_written = 0;
+	uint32_t waited_ms = 0;
+
+	while (total_bytes_written < bytes_to_write) {
+		uint64_t used = write_position - __atomic_load_n (&header->read_position, __ATOMIC_ACQUIRE);
+		if (used > capacity)
+			break;
+
+		if (used == capacity) {
+			if (timeout_ms != DS_IPC_TIMEOUT_INFINITE && waited_ms >= timeout_ms)
+				break;
+			if (!ipc_shared_ring_wait_for_consumer (ipc_stream))
+				break;
+			waited_ms += DS_IPC_SHARED_RING_WAIT_MS;
+			continue;
+		}
+
+		uint32_t available = capacity - (uint32_t)used;
+		uint32_t chunk = bytes_to_write - total_bytes_written;
+		if (chunk > available)
+			chunk = available;
+
+		uint32_t offset = (uint32_t)(write_position & (capacity - 1));
+		uint32_t first_chunk = chunk < capacity - offset ? chunk : capacity - offset;
+		memcpy (data + offset, buffer + total_bytes_written, first_chunk);
+		memcpy (data, buffer + total_bytes_written + first_chunk, chunk - first_chunk);
+
+		write_position += chunk;
+		__atomic_store_n (&header->write_position, write_position, __ATOMIC_RELEASE);
+		total_bytes_written += chunk;
+	}
+
+	*bytes_written = total_bytes_written;
+	return total_bytes_written == bytes_to_write;
+}
+
+static
+void
+ipc_shared_ring_free (DiagnosticsIpcStream *ipc_stream)
+{
+	EP_ASSERT (ipc_stream != NULL);
+
+	if (ipc_stream->shared_ring) {
+		munmap (ipc_stream->shared_ring, ipc_stream->shared_ring_size);
+		ipc_stream->shared_ring = NULL;
+		ipc_stream->shared_ring_size = 0;
+	}
+
+	if (ipc_stream->shared_ring_fd != -1) {
+		close (ipc_stream->shared_ring_fd);
+		ipc_stream->shared_ring_fd = -1;
+		ipc_stream->shared_ring_fd_pending = false;
+	}
+}
+#endif
+
+static
+bool
+ipc_stream_socket_write (
+	DiagnosticsIpcStream *ipc_stream,
+	const uint8_t *buffer,
+	uint32_t bytes_to_write,
+	uint32_t *bytes_written,
+	uint32_t timeout_ms)
+{
+	EP_ASSERT (ipc_stream != NULL);
 	EP_ASSERT (buffer != NULL);
 	EP_ASSERT (bytes_written != NULL);
 
 	bool success = false;
-	DiagnosticsIpcStream *ipc_stream = (DiagnosticsIpcStream *)object;
 	ssize_t total_bytes_written = 0;
 
 	if (timeout_ms != DS_IPC_TIMEOUT_INFINITE) {
@@ -1398,6 +1620,15 @@ ipc_stream_write_func (
 		// else fallthrough
 	}
 
+#ifdef DS_IPC_PAL_SHARED_RING
+	if (ipc_stream->shared_ring_fd_pending && bytes_to_write > 0) {
+		success = ipc_socket_send_with_fd (ipc_stream->client_socket, buffer, bytes_to_write, ipc_stream->shared_ring_fd, &total_bytes_written);
+		ep_raise_error_if_nok (success == true);
+		ipc_stream->shared_ring_fd_pending = false;
+		ep_exit_error_handler ();
+	}
+#endif
+
 	success = ipc_socket_send (ipc_stream->client_socket, buffer, bytes_to_write, &total_bytes_written);
 	ep_raise_error_if_nok (success == true);
 
@@ -1411,6 +1642,26 @@ ep_on_error:
 	ep_exit_error_handler ();
 }
 
+static
+bool
+ipc_stream_write_func (
+	void *object,
+	const uint8_t *buffer,
+	uint32_t bytes_to_write,
+	uint32_t *bytes_written,
+	uint32_t timeout_ms)
+{
+	EP_ASSERT (object != NULL);
+	DiagnosticsIpcStream *ipc_stream = (DiagnosticsIpcStream *)object;
+
+#ifdef DS_IPC_PAL_SHARED_RING
+	if (ipc_stream->shared_ring)
+		return ipc_shared_ring_write (ipc_stream, buffer, bytes_to_write, bytes_written, timeout_ms);
+#endif
+
+	return ipc_stream_socket_write (ipc_stream, buffer, bytes_to_write, bytes_written, timeout_ms);
+}
+
 static
 bool
 ipc_stream_flush_func (void *object)
@@ -1447,6 +1698,7 @@ ipc_stream_alloc (
 	instance->stream.vtable = &ipc_stream_vtable;
 	instance->client_socket = client_socket;
 	instance->mode = mode;
+	instance->shared_ring_fd = -1;
 
 ep_on_exit:
 	return instance;
@@ -1503,7 +1755,8 @@ ds_ipc_stream_write (
 	uint32_t *bytes_written,
 	uint32_t timeout_ms)
 {
-	return ipc_stream_write_func (
+	// Diagnostics messages always go over the socket, only the IpcStream writes use the shared ring.
+	return ipc_stream_socket_write (
 		ipc_stream,
 		buffer,
 		bytes_to_write,
@@ -1517,6 +1770,55 @@ ds_ipc_stream_flush (DiagnosticsIpcStream *ipc_stream)
 	return ipc_stream_flush_func (ipc_stream);
 }
 
+bool
+ds_ipc_stream_attach_shared_ring (
+	DiagnosticsIpcStream *ipc_stream,
+	uint32_t ring_size)
+{
+#ifdef DS_IPC_PAL_SHARED_RING
+	EP_ASSERT (ipc_stream != NULL);
+
+	if (ipc_stream->shared_ring || ipc_stream->client_socket == DS_IPC_INVALID_SOCKET)
+		return false;
+
+	// Power of two capacity, positions map to offsets in the data area with a mask.
+	uint32_t capacity = DS_IPC_SHARED_RING_MIN_CAPACITY;
+	while (capacity < ring_size && capacity < DS_IPC_SHARED_RING_MAX_CAPACITY)
+		capacity <<= 1;
+
+	uint32_t mapping_size = (uint32_t)sizeof (DiagnosticsIpcSharedRingHeader) + capacity;
+	void *mapping = MAP_FAILED;
+
+	int fd = (int)syscall (SYS_memfd_create, "dotnet-diagnostic-ring", MFD_CLOEXEC);
+	ep_raise_error_if_nok (fd != -1);
+	ep_raise_error_if_nok (ftruncate (fd, (off_t)mapping_size) == 0);
+
+	mapping = mmap (NULL, mapping_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	ep_raise_error_if_nok (mapping != MAP_FAILED);
+
+	DiagnosticsIpcSharedRingHeader *header;
+	header = (DiagnosticsIpcSharedRingHeader *)mapping;
+	header->magic = DS_IPC_SHARED_RING_MAGIC;
+	header->version = DS_IPC_SHARED_RING_VERSION;
+	header->header_size = (uint32_t)sizeof (DiagnosticsIpcSharedRingHeader);
+	header->capacity = capacity;
+
+	ipc_stream->shared_ring = (uint8_t *)mapping;
+	ipc_stream->shared_ring_size = mapping_size;
+	ipc_stream->shared_ring_fd = fd;
+	ipc_stream->shared_ring_fd_pending = true;
+
+	return true;
+
+ep_on_error:
+	if (fd != -1)
+		close (fd);
+	return false;
+#else
+	return false;
+#endif
+}
+
 bool
 ds_ipc_stream_close (
 	DiagnosticsIpcStream *ipc_stream,
@@ -1524,6 +1826,11 @@ ds_ipc_stream_close (
 {
 	EP_ASSERT (ipc_stream != NULL);
 
+#ifdef DS_IPC_PAL_SHARED_RING
+	// Everything written is published in the ring, the consumer drains it once the socket closes.
+	ipc_shared_ring_free (ipc_stream);
+#endif
+
 	if (ipc_stream->client_socket != DS_IPC_INVALID_SOCKET) {
 		ds_ipc_stream_flush (ipc_stream);
 
@@ -63,6 +63,11 @@ struct _DiagnosticsIpcStream_Internal {
 	IpcStream stream;
 	ds_ipc_socket_t client_socket;
 	DiagnosticsIpcConnectionMode mode;
+	// Shared memory ring receiving the stream writes, see ds_ipc_stream_attach_shared_ring.
+	uint8_t *shared_ring;
+	uint32_t shared_ring_size;
+	int shared_ring_fd;
+	bool shared_ring_fd_pending;
 };
 
 #if !defined(DS_INLINE_GETTER_SETTER) && !defined(DS_IMPL_IPC_PAL_SOCKET_GETTER_SETTER)
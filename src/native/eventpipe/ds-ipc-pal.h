@@ -121,6 +121,14 @@ ds_ipc_stream_write (
 bool
 ds_ipc_stream_flush (DiagnosticsIpcStream *ipc_stream);
 
+// Redirects the writes done through the IpcStream of ipc_stream into a shared memory ring of
+// ring_size bytes, the ring is handed to the peer together with the next ds_ipc_stream_write.
+// Returns false if the transport does not support shared memory rings.
+bool
+ds_ipc_stream_attach_shared_ring (
+	DiagnosticsIpcStream *ipc_stream,
+	uint32_t ring_size);
+
 bool
 ds_ipc_stream_close (
 	DiagnosticsIpcStream *ipc_stream,
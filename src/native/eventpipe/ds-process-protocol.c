@@ -65,6 +65,40 @@ process_protocol_helper_resume_runtime_startup (
 	DiagnosticsIpcMessage *message,
 	DiagnosticsIpcStream *stream);
 
+static
+bool
+process_protocol_helper_emit_jit_debug_info (
+	DiagnosticsIpcMessage *message,
+	DiagnosticsIpcStream *stream)
+{
+	EP_ASSERT (message != NULL);
+	EP_ASSERT (stream != NULL);
+
+	bool result = false;
+
+	// no payload
+	ds_ipc_result_t ipc_result = ds_rt_emit_jit_debug_info ();
+	if (ipc_result != DS_IPC_S_OK) {
+		ds_ipc_message_send_error (stream, ipc_result);
+		ep_raise_error ();
+	}
+
+	result = ds_ipc_message_send_success (stream, DS_IPC_S_OK);
+	if (!result) {
+		ds_ipc_message_send_error (stream, DS_IPC_E_FAIL);
+		ep_raise_error ();
+	}
+
+ep_on_exit:
+	ds_ipc_stream_free (stream);
+	return result;
+
+ep_on_error:
+	EP_ASSERT (!result);
+	DS_LOG_WARNING_0 ("Failed to send DiagnosticsIPC response");
+	ep_exit_error_handler ();
+}
+
 static
 bool
 process_protocol_helper_unknown_command (
@@ -475,6 +509,9 @@ ds_process_protocol_helper_handle_ipc_message (
 	case DS_PROCESS_COMMANDID_GET_PROCESS_ENV:
 		result = process_protocol_helper_get_process_env (message, stream);
 		break;
+	case DS_PROCESS_COMMANDID_EMIT_JIT_DEBUG_INFO:
+		result = process_protocol_helper_emit_jit_debug_info (message, stream);
+		break;
 	default:
 		result = process_protocol_helper_unknown_command (message, stream);
 		break;
@@ -89,6 +89,14 @@ static
 ds_ipc_result_t
 ds_rt_generate_core_dump (DiagnosticsGenerateCoreDumpCommandPayload *payload);
 
+/*
+* DiagnosticsProcess.
+*/
+
+static
+ds_ipc_result_t
+ds_rt_emit_jit_debug_info (void);
+
 /*
  * DiagnosticsIpc.
  */
@@ -13,11 +13,22 @@
 #include "ds-profiler-protocol.h"
 #include "ds-rt.h"
 
+// Commands that can run for a long time (dumps, profiler attach, tracing sessions rundown)
+// are handled on worker threads so that the server keeps accepting connections meanwhile.
+// Past this many in-flight commands, new ones are handled on the server thread again.
+#define DS_SERVER_MAX_WORKER_COUNT 4
+
+typedef struct _DiagnosticsServerWorkItem {
+	DiagnosticsIpcMessage message;
+	DiagnosticsIpcStream *stream;
+} DiagnosticsServerWorkItem;
+
 /*
  * Globals and volatile access functions.
  */
 
 static volatile uint32_t _server_shutting_down_state = 0;
+static volatile uint32_t _server_worker_count = 0;
 static ep_rt_wait_event_handle_t _server_resume_runtime_startup_event = { 0 };
 static bool _server_disabled = false;
 
@@ -65,6 +76,18 @@ server_protocol_helper_unknown_command (
 	DiagnosticsIpcMessage *message,
 	DiagnosticsIpcStream *stream);
 
+static
+void
+server_dispatch_ipc_message (
+	DiagnosticsIpcMessage *message,
+	DiagnosticsIpcStream *stream);
+
+static
+bool
+server_try_dispatch_ipc_message_to_worker (
+	DiagnosticsIpcMessage *message,
+	DiagnosticsIpcStream *stream);
+
 /*
  * DiagnosticServer.
  */
@@ -111,6 +134,86 @@ server_warning_callback (
 	DS_LOG_WARNING_2 ("warning (%d): %s.", code, message);
 }
 
+static
+void
+server_dispatch_ipc_message (
+	DiagnosticsIpcMessage *message,
+	DiagnosticsIpcStream *stream)
+{
+	switch ((DiagnosticsServerCommandSet)ds_ipc_header_get_commandset (ds_ipc_message_get_header_ref (message))) {
+	case DS_SERVER_COMMANDSET_EVENTPIPE:
+		ds_eventpipe_protocol_helper_handle_ipc_message (message, stream);
+		break;
+	case DS_SERVER_COMMANDSET_DUMP:
+		ds_dump_protocol_helper_handle_ipc_message (message, stream);
+		break;
+	case DS_SERVER_COMMANDSET_PROCESS:
+		ds_process_protocol_helper_handle_ipc_message (message, stream);
+		break;
+	case DS_SERVER_COMMANDSET_PROFILER:
+		ds_profiler_protocol_helper_handle_ipc_message (message, stream);
+		break;
+	default:
+		server_protocol_helper_unknown_command (message, stream);
+		break;
+	}
+}
+
+EP_RT_DEFINE_THREAD_FUNC (server_worker_thread)
+{
+	EP_ASSERT (data != NULL);
+	if (data == NULL)
+		return 1;
+
+	ep_rt_thread_params_t *thread_params = (ep_rt_thread_params_t *)data;
+	DiagnosticsServerWorkItem *work_item = (DiagnosticsServerWorkItem *)thread_params->thread_params;
+
+	server_dispatch_ipc_message (&work_item->message, work_item->stream);
+
+	ds_ipc_message_fini (&work_item->message);
+	ep_rt_object_free (work_item);
+
+	ep_rt_atomic_dec_uint32_t (&_server_worker_count);
+	return (ep_rt_thread_start_func_return_t)0;
+}
+
+// On success the worker owns the message payload and the stream, message is reset.
+static
+bool
+server_try_dispatch_ipc_message_to_worker (
+	DiagnosticsIpcMessage *message,
+	DiagnosticsIpcStream *stream)
+{
+	// Process commands are quick and resuming the runtime relies on the current port of the server thread.
+	if ((DiagnosticsServerCommandSet)ds_ipc_header_get_commandset (ds_ipc_message_get_header_ref (message)) == DS_SERVER_COMMANDSET_PROCESS)
+		return false;
+
+	if (ep_rt_atomic_inc_uint32_t (&_server_worker_count) > DS_SERVER_MAX_WORKER_COUNT) {
+		ep_rt_atomic_dec_uint32_t (&_server_worker_count);
+		return false;
+	}
+
+	DiagnosticsServerWorkItem *work_item = ep_rt_object_alloc (DiagnosticsServerWorkItem);
+	if (!work_item) {
+		ep_rt_atomic_dec_uint32_t (&_server_worker_count);
+		return false;
+	}
+
+	work_item->message = *message;
+	work_item->stream = stream;
+
+	ep_rt_thread_id_t thread_id = ep_rt_uint64_t_to_thread_id_t (0);
+	if (!ep_rt_thread_create ((void *)server_worker_thread, (void *)work_item, EP_THREAD_TYPE_SESSION, (void *)&thread_id)) {
+		DS_LOG_WARNING_1 ("Failed to create diagnostic server worker thread (%d), handling command on the server thread.", ep_rt_get_last_error ());
+		ep_rt_object_free (work_item);
+		ep_rt_atomic_dec_uint32_t (&_server_worker_count);
+		return false;
+	}
+
+	ds_ipc_message_init (message);
+	return true;
+}
+
 EP_RT_DEFINE_THREAD_FUNC (server_thread)
 {
 	EP_ASSERT (server_volatile_load_shutting_down_state () || ds_ipc_stream_factory_has_active_ports ());
@@ -152,23 +255,8 @@ EP_RT_DEFINE_THREAD_FUNC (server_thread)
 
 		DS_LOG_INFO_2 ("DiagnosticServer - received IPC message with command set (%d) and command id (%d)", ds_ipc_header_get_commandset (ds_ipc_message_get_header_ref (&message)), ds_ipc_header_get_commandid (ds_ipc_message_get_header_ref (&message)));
 
-		switch ((DiagnosticsServerCommandSet)ds_ipc_header_get_commandset (ds_ipc_message_get_header_ref (&message))) {
-		case DS_SERVER_COMMANDSET_EVENTPIPE:
-			ds_eventpipe_protocol_helper_handle_ipc_message (&message, stream);
-			break;
-		case DS_SERVER_COMMANDSET_DUMP:
-			ds_dump_protocol_helper_handle_ipc_message (&message, stream);
-			break;
-		case DS_SERVER_COMMANDSET_PROCESS:
-			ds_process_protocol_helper_handle_ipc_message (&message, stream);
-			break;
-		case DS_SERVER_COMMANDSET_PROFILER:
-			ds_profiler_protocol_helper_handle_ipc_message (&message, stream);
-			break;
-		default:
-			server_protocol_helper_unknown_command (&message, stream);
-			break;
-		}
+		if (!server_try_dispatch_ipc_message_to_worker (&message, stream))
+			server_dispatch_ipc_message (&message, stream);
 
 		ds_ipc_message_fini (&message);
 	}
@@ -240,6 +328,10 @@ ep_on_error:
 bool
 ds_server_shutdown (void)
 {
+	// The server can be shut down ahead of runtime shutdown, before a checkpoint of the process.
+	if (server_volatile_load_shutting_down_state ())
+		return true;
+
 	server_volatile_store_shutting_down_state (true);
 
 	if (ds_ipc_stream_factory_has_active_ports ())
@@ -63,6 +63,7 @@ typedef enum {
 	DS_PROCESS_COMMANDID_GET_PROCESS_INFO = 0x00,
 	DS_PROCESS_COMMANDID_RESUME_RUNTIME = 0x01,
 	DS_PROCESS_COMMANDID_GET_PROCESS_ENV = 0x02,
+	DS_PROCESS_COMMANDID_EMIT_JIT_DEBUG_INFO = 0x03,
 	// future
 } DiagnosticsProcessCommandId;
 
@@ -87,9 +88,19 @@ typedef enum {
 	EP_COMMANDID_STOP_TRACING = 0x01,
 	EP_COMMANDID_COLLECT_TRACING  = 0x02,
 	EP_COMMANDID_COLLECT_TRACING_2 = 0x03,
+	EP_COMMANDID_COLLECT_TRACING_3 = 0x04,
 	// future
 } EventPipeCommandId;
 
+// Session flags of the CollectTracing3 command.
+typedef enum {
+	EP_COLLECT_TRACING_FLAGS_NONE = 0x00,
+	// LZ4 compress the event and metadata blocks of the nettrace stream.
+	EP_COLLECT_TRACING_FLAGS_COMPRESS_BLOCKS = 0x01,
+	// Stream the nettrace data through a shared memory ring passed along the response instead of the socket.
+	EP_COLLECT_TRACING_FLAGS_SHARED_MEMORY = 0x02
+} EventPipeCollectTracingFlags;
+
 typedef enum {
 	DS_PORT_TYPE_LISTEN = 0,
 	DS_PORT_TYPE_CONNECT = 1
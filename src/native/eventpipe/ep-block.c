@@ -312,17 +312,16 @@ ep_block_serialize_header (
 	;
 }
 
+static
 void
-ep_block_fast_serialize (
+block_fast_serialize_data (
 	EventPipeBlock *block,
-	FastSerializer *fast_serializer)
+	FastSerializer *fast_serializer,
+	const uint8_t *data,
+	uint32_t data_size)
 {
 	EP_ASSERT (block != NULL);
 	EP_ASSERT (fast_serializer != NULL);
-
-	ep_return_void_if_nok (block->block != NULL);
-
-	uint32_t data_size = ep_block_get_bytes_written (block);
 	EP_ASSERT (data_size != 0);
 
 	uint32_t header_size =  ep_block_get_header_size_vcall (block);
@@ -340,7 +339,169 @@ ep_block_fast_serialize (
 	}
 
 	ep_block_serialize_header_vcall (block, fast_serializer);
-	ep_fast_serializer_write_buffer (fast_serializer, block->block, data_size);
+	ep_fast_serializer_write_buffer (fast_serializer, data, data_size);
+}
+
+void
+ep_block_fast_serialize (
+	EventPipeBlock *block,
+	FastSerializer *fast_serializer)
+{
+	EP_ASSERT (block != NULL);
+	EP_ASSERT (fast_serializer != NULL);
+
+	ep_return_void_if_nok (block->block != NULL);
+
+	block_fast_serialize_data (block, fast_serializer, block->block, ep_block_get_bytes_written (block));
+}
+
+/*
+ * LZ4 block compression.
+ *
+ * Produces the standard LZ4 block format (no frame): a sequence of tokens, each one
+ * a literal run followed by a back reference of at least 4 bytes within the last
+ * 64KB. A greedy single-probe hash chain is used, which is enough for the highly
+ * repetitive event headers and payloads found in event blocks.
+ */
+
+#define BLOCK_COMPRESSION_HASH_BITS 12
+#define BLOCK_COMPRESSION_HASH_TABLE_SIZE (1 << BLOCK_COMPRESSION_HASH_BITS)
+#define BLOCK_COMPRESSION_MIN_MATCH 4
+#define BLOCK_COMPRESSION_MAX_OFFSET 65535
+// The last 5 bytes are always literals and the last match must start 12 bytes before the end.
+#define BLOCK_COMPRESSION_LAST_LITERALS 5
+#define BLOCK_COMPRESSION_MATCH_FIND_LIMIT 12
+
+static
+inline
+uint32_t
+block_compression_read_uint32 (const uint8_t *source)
+{
+	uint32_t value;
+	memcpy (&value, source, sizeof (value));
+	return value;
+}
+
+static
+inline
+uint32_t
+block_compression_hash (uint32_t value)
+{
+	return (value * 2654435761U) >> (32 - BLOCK_COMPRESSION_HASH_BITS);
+}
+
+static
+uint8_t *
+block_compression_write_length (
+	uint8_t *write_pointer,
+	uint32_t length)
+{
+	while (length >= 255) {
+		*write_pointer++ = 255;
+		length -= 255;
+	}
+	*write_pointer++ = (uint8_t)length;
+	return write_pointer;
+}
+
+static
+inline
+bool
+block_compression_has_space (
+	const uint8_t *write_pointer,
+	const uint8_t *end,
+	uint32_t literal_length,
+	uint32_t match_length)
+{
+	// token + literal length + literals + offset + match length
+	size_t required = 1 + (literal_length / 255 + 1) + literal_length + 2 + (match_length / 255 + 1);
+	return (size_t)(end - write_pointer) >= required;
+}
+
+// Returns the compressed size, or 0 if the data does not compress to fewer than destination_size bytes.
+static
+uint32_t
+block_compress (
+	const uint8_t *source,
+	uint32_t source_size,
+	uint8_t *destination,
+	uint32_t destination_size,
+	uint32_t *hash_table)
+{
+	EP_ASSERT (source != NULL);
+	EP_ASSERT (destination != NULL);
+	EP_ASSERT (hash_table != NULL);
+
+	memset (hash_table, 0, BLOCK_COMPRESSION_HASH_TABLE_SIZE * sizeof (uint32_t));
+
+	const uint8_t *read_pointer = source;
+	const uint8_t *anchor = source;
+	const uint8_t *source_end = source + source_size;
+	uint8_t *write_pointer = destination;
+	uint8_t *destination_end = destination + destination_size;
+
+	if (source_size > BLOCK_COMPRESSION_MATCH_FIND_LIMIT) {
+		const uint8_t *match_find_limit = source_end - BLOCK_COMPRESSION_MATCH_FIND_LIMIT;
+		const uint8_t *match_extend_limit = source_end - BLOCK_COMPRESSION_LAST_LITERALS;
+
+		while (read_pointer < match_find_limit) {
+			uint32_t sequence = block_compression_read_uint32 (read_pointer);
+			uint32_t hash = block_compression_hash (sequence);
+			const uint8_t *reference = source + hash_table [hash];
+			hash_table [hash] = (uint32_t)(read_pointer - source);
+
+			if (reference >= read_pointer ||
+				read_pointer - reference > BLOCK_COMPRESSION_MAX_OFFSET ||
+				block_compression_read_uint32 (reference) != sequence) {
+				read_pointer++;
+				continue;
+			}
+
+			const uint8_t *match_end = read_pointer + BLOCK_COMPRESSION_MIN_MATCH;
+			reference += BLOCK_COMPRESSION_MIN_MATCH;
+			while (match_end < match_extend_limit && *match_end == *reference) {
+				match_end++;
+				reference++;
+			}
+
+			uint32_t literal_length = (uint32_t)(read_pointer - anchor);
+			uint32_t match_length = (uint32_t)(match_end - read_pointer) - BLOCK_COMPRESSION_MIN_MATCH;
+			uint16_t offset = (uint16_t)(match_end - reference);
+			if (!block_compression_has_space (write_pointer, destination_end, literal_length, match_length))
+				return 0;
+
+			uint8_t *token = write_pointer++;
+			*token = (uint8_t)((literal_length >= 15 ? 15 : literal_length) << 4);
+			if (literal_length >= 15)
+				write_pointer = block_compression_write_length (write_pointer, literal_length - 15);
+			memcpy (write_pointer, anchor, literal_length);
+			write_pointer += literal_length;
+
+			*write_pointer++ = (uint8_t)offset;
+			*write_pointer++ = (uint8_t)(offset >> 8);
+
+			*token |= (uint8_t)(match_length >= 15 ? 15 : match_length);
+			if (match_length >= 15)
+				write_pointer = block_compression_write_length (write_pointer, match_length - 15);
+
+			read_pointer = match_end;
+			anchor = match_end;
+		}
+	}
+
+	uint32_t last_literal_length = (uint32_t)(source_end - anchor);
+	if (!block_compression_has_space (write_pointer, destination_end, last_literal_length, 0))
+		return 0;
+
+	uint8_t *last_token = write_pointer++;
+	*last_token = (uint8_t)((last_literal_length >= 15 ? 15 : last_literal_length) << 4);
+	if (last_literal_length >= 15)
+		write_pointer = block_compression_write_length (write_pointer, last_literal_length - 15);
+	memcpy (write_pointer, anchor, last_literal_length);
+	write_pointer += last_literal_length;
+
+	uint32_t compressed_size = (uint32_t)(write_pointer - destination);
+	return compressed_size < source_size ? compressed_size : 0;
 }
 
 /*
@@ -356,7 +517,28 @@ block_base_fast_serialize_func (
 	EP_ASSERT (object != NULL);
 	EP_ASSERT (fast_serializer != NULL);
 
-	ep_block_fast_serialize (&((EventPipeEventBlockBase *)object)->block, fast_serializer);
+	EventPipeEventBlockBase *event_block_base = (EventPipeEventBlockBase *)object;
+	EventPipeBlock *block = &event_block_base->block;
+	ep_return_void_if_nok (block->block != NULL);
+
+	if (event_block_base->compressed_block != NULL) {
+		uint32_t data_size = ep_block_get_bytes_written (block);
+		event_block_base->compressed_block_size = block_compress (
+			block->block,
+			data_size,
+			event_block_base->compressed_block,
+			data_size,
+			event_block_base->compression_hash_table);
+
+		// Incompressible blocks go out as is, the reader checks the header flags of each block.
+		if (event_block_base->compressed_block_size != 0) {
+			block_fast_serialize_data (block, fast_serializer, event_block_base->compressed_block, event_block_base->compressed_block_size);
+			event_block_base->compressed_block_size = 0;
+			return;
+		}
+	}
+
+	ep_block_fast_serialize (block, fast_serializer);
 }
 
 static
@@ -440,6 +622,9 @@ ep_event_block_base_init (
 		format) != NULL);
 
 	event_block_base->use_header_compression = use_header_compression;
+	event_block_base->compressed_block = NULL;
+	event_block_base->compression_hash_table = NULL;
+	event_block_base->compressed_block_size = 0;
 
 	memset (event_block_base->compressed_header, 0, EP_ARRAY_SIZE (event_block_base->compressed_header));
 	ep_event_block_base_clear (event_block_base);
@@ -457,9 +642,38 @@ void
 ep_event_block_base_fini (EventPipeEventBlockBase *event_block_base)
 {
 	ep_return_void_if_nok (event_block_base != NULL);
+	ep_rt_byte_array_free (event_block_base->compressed_block);
+	ep_rt_byte_array_free ((uint8_t *)event_block_base->compression_hash_table);
 	ep_block_fini (&event_block_base->block);
 }
 
+bool
+ep_event_block_base_enable_block_compression (EventPipeEventBlockBase *event_block_base)
+{
+	EP_ASSERT (event_block_base != NULL);
+
+	EventPipeBlock *block = &event_block_base->block;
+
+	// The compression flag lives in the block header, which NetPerf blocks don't have.
+	ep_return_false_if_nok (block->format >= EP_SERIALIZATION_FORMAT_NETTRACE_V4 && block->block != NULL);
+	if (event_block_base->compressed_block != NULL)
+		return true;
+
+	event_block_base->compression_hash_table = (uint32_t *)ep_rt_byte_array_alloc (BLOCK_COMPRESSION_HASH_TABLE_SIZE * sizeof (uint32_t));
+	ep_raise_error_if_nok (event_block_base->compression_hash_table != NULL);
+
+	// Compressed output is only kept when smaller than the input, so the block size is enough.
+	event_block_base->compressed_block = ep_rt_byte_array_alloc ((size_t)(block->end_of_the_buffer - block->block));
+	ep_raise_error_if_nok (event_block_base->compressed_block != NULL);
+
+	return true;
+
+ep_on_error:
+	ep_rt_byte_array_free ((uint8_t *)event_block_base->compression_hash_table);
+	event_block_base->compression_hash_table = NULL;
+	return false;
+}
+
 void
 ep_event_block_base_clear (EventPipeEventBlockBase *event_block_base)
 {
@@ -481,7 +695,8 @@ ep_event_block_base_get_header_size (const EventPipeEventBlockBase *event_block_
 	return	sizeof(uint16_t) + // header size
 			sizeof(uint16_t) + // flags
 			sizeof(ep_timestamp_t)  + // min timestamp
-			sizeof(ep_timestamp_t);   // max timestamp
+			sizeof(ep_timestamp_t) +  // max timestamp
+			(event_block_base->compressed_block_size != 0 ? sizeof(uint32_t) : 0); // uncompressed size
 }
 
 void
@@ -497,7 +712,9 @@ ep_event_block_base_serialize_header (
 	const uint16_t header_size = (uint16_t)ep_block_get_header_size_vcall ((EventPipeBlock *)event_block_base);
 	ep_fast_serializer_write_buffer (fast_serializer, (const uint8_t *)&header_size, sizeof (header_size));
 
-	const uint16_t flags = event_block_base->use_header_compression ? 1 : 0;
+	// Flag 1: event headers are compressed.
+	// Flag 2: the block payload is LZ4 compressed, the header then ends with the uncompressed payload size.
+	const uint16_t flags = (event_block_base->use_header_compression ? 1 : 0) | (event_block_base->compressed_block_size != 0 ? 2 : 0);
 	ep_fast_serializer_write_buffer (fast_serializer, (const uint8_t *)&flags, sizeof (flags));
 
 	ep_timestamp_t min_timestamp = event_block_base->min_timestamp;
@@ -505,6 +722,11 @@ ep_event_block_base_serialize_header (
 
 	ep_timestamp_t max_timestamp = event_block_base->max_timestamp;
 	ep_fast_serializer_write_buffer (fast_serializer, (const uint8_t *)&max_timestamp, sizeof (max_timestamp));
+
+	if (event_block_base->compressed_block_size != 0) {
+		const uint32_t uncompressed_size = ep_block_get_bytes_written ((EventPipeBlock *)event_block_base);
+		ep_fast_serializer_write_buffer (fast_serializer, (const uint8_t *)&uncompressed_size, sizeof (uncompressed_size));
+	}
 }
 
 bool
@@ -140,6 +140,11 @@ struct _EventPipeEventBlockBase_Internal {
 	uint8_t compressed_header [100];
 	ep_timestamp_t min_timestamp;
 	ep_timestamp_t max_timestamp;
+	// LZ4 block compression state, only allocated once block compression is enabled.
+	uint8_t *compressed_block;
+	uint32_t *compression_hash_table;
+	// Size of compressed_block while it is being serialized, 0 otherwise.
+	uint32_t compressed_block_size;
 	bool use_header_compression;
 };
 
@@ -169,6 +174,10 @@ ep_event_block_base_init (
 void
 ep_event_block_base_fini (EventPipeEventBlockBase *event_block_base);
 
+// Compresses the block payload when it is serialized, see ep_event_block_base_serialize_header.
+bool
+ep_event_block_base_enable_block_compression (EventPipeEventBlockBase *event_block_base);
+
 void
 ep_event_block_base_clear (EventPipeEventBlockBase *event_block_base);
 
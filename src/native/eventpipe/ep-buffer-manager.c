@@ -69,6 +69,22 @@ buffer_manager_deallocate_buffer (
 	EventPipeBufferManager *buffer_manager,
 	EventPipeBuffer *buffer);
 
+static
+EventPipeBuffer *
+buffer_manager_try_get_recycled_buffer (
+	EventPipeBufferManager *buffer_manager,
+	uint32_t buffer_size);
+
+static
+void
+buffer_manager_recycle_buffer (
+	EventPipeBufferManager *buffer_manager,
+	EventPipeBuffer *buffer);
+
+static
+void
+buffer_manager_free_recycled_buffers (EventPipeBufferManager *buffer_manager);
+
 // Attempt to reserve space for a buffer
 static
 bool
@@ -501,7 +517,19 @@ buffer_manager_allocate_buffer_for_thread (
 	EP_ASSERT(buffer_size > 0);
 	ep_return_null_if_nok(buffer_manager_try_reserve_buffer(buffer_manager, buffer_size));
 
-	// Allocating a buffer requires us to take the lock.
+	// The sequence counter is exclusively mutated on this thread so this is a thread-local read.
+	sequence_number = ep_thread_session_state_get_volatile_sequence_number (thread_session_state);
+
+	// Get the memory before taking the lock, so that writers on other threads are not
+	// stalled behind a page allocation. Only the list and sequence point bookkeeping
+	// below needs the lock.
+	new_buffer = buffer_manager_try_get_recycled_buffer (buffer_manager, buffer_size);
+	if (new_buffer != NULL)
+		ep_buffer_reset (new_buffer, ep_thread_session_state_get_thread (thread_session_state), sequence_number);
+	else
+		new_buffer = ep_buffer_alloc (buffer_size, ep_thread_session_state_get_thread (thread_session_state), sequence_number);
+	ep_raise_error_if_nok (new_buffer != NULL);
+
 	EP_SPIN_LOCK_ENTER (&buffer_manager->rt_lock, section1)
 		thread_buffer_list = ep_thread_session_state_get_buffer_list (thread_session_state);
 		if (thread_buffer_list == NULL) {
@@ -513,11 +541,6 @@ buffer_manager_allocate_buffer_for_thread (
 			thread_buffer_list = NULL;
 		}
 
-		// The sequence counter is exclusively mutated on this thread so this is a thread-local read.
-		sequence_number = ep_thread_session_state_get_volatile_sequence_number (thread_session_state);
-		new_buffer = ep_buffer_alloc (buffer_size, ep_thread_session_state_get_thread (thread_session_state), sequence_number);
-		ep_raise_error_if_nok_holding_spin_lock (new_buffer != NULL, section1);
-
 		if (buffer_manager->sequence_point_alloc_budget != 0) {
 			// sequence point bookkeeping
 			if (buffer_size >= buffer_manager->remaining_sequence_point_alloc_budget) {
@@ -537,8 +560,7 @@ buffer_manager_allocate_buffer_for_thread (
 #endif // EP_CHECKED_BUILD
 
 		// Set the buffer on the thread.
-		if (new_buffer != NULL)
-			ep_buffer_list_insert_tail (ep_thread_session_state_get_buffer_list (thread_session_state), new_buffer);
+		ep_buffer_list_insert_tail (ep_thread_session_state_get_buffer_list (thread_session_state), new_buffer);
 
 	EP_SPIN_LOCK_EXIT (&buffer_manager->rt_lock, section1)
 
@@ -578,6 +600,73 @@ buffer_manager_deallocate_buffer (
 	}
 }
 
+static
+EventPipeBuffer *
+buffer_manager_try_get_recycled_buffer (
+	EventPipeBufferManager *buffer_manager,
+	uint32_t buffer_size)
+{
+	EP_ASSERT (buffer_manager != NULL);
+
+	// Slots only ever go from NULL to a buffer (recycle) and back (claim), so a
+	// successful exchange means this thread now exclusively owns the buffer. The
+	// buffer must not be looked at before it is claimed, another thread could
+	// claim and free it in the meantime.
+	for (uint32_t i = 0; i < EP_BUFFER_MANAGER_RECYCLED_BUFFER_COUNT; ++i) {
+		size_t slot = buffer_manager->recycled_buffers [i];
+		if (slot == 0 || ep_rt_atomic_compare_exchange_size_t (&buffer_manager->recycled_buffers [i], slot, 0) != slot)
+			continue;
+
+		EventPipeBuffer *buffer = (EventPipeBuffer *)slot;
+		if (ep_buffer_get_size (buffer) == buffer_size)
+			return buffer;
+
+		// Wrong size, give it back or drop it if the slot got refilled.
+		if (ep_rt_atomic_compare_exchange_size_t (&buffer_manager->recycled_buffers [i], 0, slot) != 0)
+			ep_buffer_free (buffer);
+	}
+
+	return NULL;
+}
+
+static
+void
+buffer_manager_recycle_buffer (
+	EventPipeBufferManager *buffer_manager,
+	EventPipeBuffer *buffer)
+{
+	EP_ASSERT (buffer_manager != NULL);
+	EP_ASSERT (buffer != NULL);
+
+	// The recycled buffer no longer counts against the session size limit, the
+	// writer that picks it up reserves its size again.
+	buffer_manager_release_buffer (buffer_manager, ep_buffer_get_size (buffer));
+#ifdef EP_CHECKED_BUILD
+	buffer_manager->num_buffers_allocated--;
+#endif
+
+	for (uint32_t i = 0; i < EP_BUFFER_MANAGER_RECYCLED_BUFFER_COUNT; ++i) {
+		if (ep_rt_atomic_compare_exchange_size_t (&buffer_manager->recycled_buffers [i], 0, (size_t)buffer) == 0)
+			return;
+	}
+
+	// All slots are taken.
+	ep_buffer_free (buffer);
+}
+
+static
+void
+buffer_manager_free_recycled_buffers (EventPipeBufferManager *buffer_manager)
+{
+	EP_ASSERT (buffer_manager != NULL);
+
+	for (uint32_t i = 0; i < EP_BUFFER_MANAGER_RECYCLED_BUFFER_COUNT; ++i) {
+		size_t slot = buffer_manager->recycled_buffers [i];
+		if (slot != 0 && ep_rt_atomic_compare_exchange_size_t (&buffer_manager->recycled_buffers [i], slot, 0) == slot)
+			ep_buffer_free ((EventPipeBuffer *)slot);
+	}
+}
+
 static
 void
 buffer_manager_move_next_event_any_thread (
@@ -747,7 +836,7 @@ buffer_manager_advance_to_non_empty_buffer (
 				// delete the empty buffer
 				EventPipeBuffer *removed_buffer = ep_buffer_list_get_and_remove_head (buffer_list);
 				EP_ASSERT (current_buffer == removed_buffer);
-				buffer_manager_deallocate_buffer (buffer_manager, removed_buffer);
+				buffer_manager_recycle_buffer (buffer_manager, removed_buffer);
 
 				// get the next buffer
 				current_buffer = buffer_list->head_buffer;
@@ -854,6 +943,9 @@ ep_buffer_manager_alloc (
 	instance->current_buffer = NULL;
 	instance->current_buffer_list = NULL;
 
+	for (uint32_t i = 0; i < EP_BUFFER_MANAGER_RECYCLED_BUFFER_COUNT; ++i)
+		instance->recycled_buffers [i] = 0;
+
 	instance->max_size_of_all_buffers = EP_CLAMP ((size_t)100 * 1024, max_size_of_all_buffers, (size_t)UINT32_MAX);
 
 	if (sequence_point_allocation_budget == 0) {
@@ -1439,6 +1531,8 @@ ep_buffer_manager_deallocate_buffers (EventPipeBufferManager *buffer_manager)
 
 	EP_SPIN_LOCK_EXIT (&buffer_manager->rt_lock, section1)
 
+	buffer_manager_free_recycled_buffers (buffer_manager);
+
 	// remove and delete the session state
 	ep_rt_thread_session_state_array_iterator_t thread_session_states_to_remove_iterator;
 	thread_session_states_to_remove_iterator = ep_rt_thread_session_state_array_iterator_begin (&thread_session_states_to_remove);
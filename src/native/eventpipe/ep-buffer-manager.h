@@ -86,6 +86,9 @@ ep_buffer_list_ensure_consistency (EventPipeBufferList *buffer_list);
  * EventPipeBufferManager.
  */
 
+// Number of drained buffers kept around for reuse by writer threads.
+#define EP_BUFFER_MANAGER_RECYCLED_BUFFER_COUNT 4
+
 #if defined(EP_INLINE_GETTER_SETTER) || defined(EP_IMPL_BUFFER_MANAGER_GETTER_SETTER)
 struct _EventPipeBufferManager {
 #else
@@ -113,6 +116,9 @@ struct _EventPipeBufferManager_Internal {
 	EventPipeEventInstance *current_event;
 	EventPipeBuffer *current_buffer;
 	EventPipeBufferList *current_buffer_list;
+	// Drained buffers that can be handed out again without a new allocation.
+	// Slots are claimed and released with compare-exchange, not under rt_lock.
+	volatile size_t recycled_buffers [EP_BUFFER_MANAGER_RECYCLED_BUFFER_COUNT];
 	// The total allocation size of buffers under management.
 	volatile size_t size_of_all_buffers;
 	// The maximum allowable size of buffers under management.
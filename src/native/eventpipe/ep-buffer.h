@@ -90,6 +90,14 @@ ep_buffer_alloc (
 void
 ep_buffer_free (EventPipeBuffer *buffer);
 
+// Prepares a buffer that has been handed back to the buffer manager to be
+// written again by writer_thread, without releasing its memory.
+void
+ep_buffer_reset (
+	EventPipeBuffer *buffer,
+	EventPipeThread *writer_thread,
+	uint32_t event_sequence_number);
+
 static
 inline
 uint32_t
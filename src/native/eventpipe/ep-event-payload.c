@@ -167,6 +167,45 @@ ep_event_payload_flatten (EventPipeEventPayload *event_payload)
 	}
 }
 
+bool
+ep_event_payload_read (
+	const EventPipeEventPayload *event_payload,
+	uint32_t offset,
+	uint8_t *dst,
+	uint32_t len)
+{
+	EP_ASSERT (event_payload != NULL);
+	EP_ASSERT (dst != NULL || len == 0);
+
+	ep_return_false_if_nok (offset <= event_payload->size && len <= event_payload->size - offset);
+	if (len == 0)
+		return true;
+
+	if (ep_event_payload_is_flattened (event_payload)) {
+		memcpy (dst, event_payload->data + offset, len);
+		return true;
+	}
+
+	ep_return_false_if_nok (event_payload->event_data != NULL);
+
+	EventData *event_data = event_payload->event_data;
+	for (uint32_t i = 0; i < event_payload->event_data_len && len > 0; ++i) {
+		uint32_t data_size = ep_event_data_get_size (&event_data [i]);
+		if (offset >= data_size) {
+			offset -= data_size;
+			continue;
+		}
+
+		uint32_t to_copy = EP_MIN (data_size - offset, len);
+		memcpy (dst, (uint8_t *)ep_event_data_get_ptr (&event_data [i]) + offset, to_copy);
+		dst += to_copy;
+		len -= to_copy;
+		offset = 0;
+	}
+
+	return len == 0;
+}
+
 uint8_t *
 ep_event_payload_get_flat_data (EventPipeEventPayload *event_payload)
 {
@@ -118,6 +118,15 @@ ep_event_payload_copy_data (
 void
 ep_event_payload_flatten (EventPipeEventPayload *event_payload);
 
+// Copy len bytes starting at offset (whether flat or array of objects) into dst,
+// without flattening the payload. Returns false if the range is out of bounds.
+bool
+ep_event_payload_read (
+	const EventPipeEventPayload *event_payload,
+	uint32_t offset,
+	uint8_t *dst,
+	uint32_t len);
+
 // Get the flat formatted data in this payload.
 // This method will allocate a buffer if it does not already contain flattened data.
 // This method will return NULL on OOM if a buffer needed to be allocated.
@@ -388,6 +388,16 @@ ep_file_free (EventPipeFile *file)
 	ep_rt_object_free (file);
 }
 
+bool
+ep_file_enable_block_compression (EventPipeFile *file)
+{
+	EP_ASSERT (file != NULL);
+	EP_ASSERT (ep_rt_volatile_load_uint32_t (&file->initialized) == 0);
+
+	return ep_event_block_base_enable_block_compression ((EventPipeEventBlockBase *)file->event_block) &&
+		ep_event_block_base_enable_block_compression ((EventPipeEventBlockBase *)file->metadata_block);
+}
+
 bool
 ep_file_initialize_file (EventPipeFile *file)
 {
@@ -80,6 +80,11 @@ ep_file_free (EventPipeFile *file);
 bool
 ep_file_initialize_file (EventPipeFile *file);
 
+// Compress the event and metadata blocks written to the file.
+// Must be called before the file is initialized.
+bool
+ep_file_enable_block_compression (EventPipeFile *file);
+
 void
 ep_file_write_event (
 	EventPipeFile *file,
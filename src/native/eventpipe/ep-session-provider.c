@@ -5,8 +5,12 @@
 
 #define EP_IMPL_SESSION_PROVIDER_GETTER_SETTER
 #include "ep-session-provider.h"
+#include "ep-event.h"
+#include "ep-event-payload.h"
 #include "ep-rt.h"
 
+#include <stdlib.h>
+
 /*
  * Forward declares of all static functions.
  */
@@ -15,6 +19,49 @@ static
 void
 session_provider_free_func (void *session_provider);
 
+static
+bool
+session_provider_parse_payload_filter (
+	EventPipeSessionProvider *session_provider,
+	const ep_char8_t *filter_data);
+
+static
+bool
+session_provider_payload_filter_clause_matches (
+	const EventPipePayloadFilterClause *clause,
+	const EventPipeEvent *ep_event,
+	const EventPipeEventPayload *payload);
+
+/*
+ * EventPipePayloadFilterClause.
+ */
+
+// The payload filter is passed in the provider filter data as
+//   PayloadFilter=<clause>[&&<clause>...]
+// where a clause is <field> <op> <value>, op one of == (or =) != < <= > >=.
+// Values are integers, floating point numbers or, for string fields, text
+// that is optionally quoted (only == and != apply to strings).
+#define PAYLOAD_FILTER_KEY "PayloadFilter="
+
+typedef enum {
+	PAYLOAD_FILTER_OP_EQ,
+	PAYLOAD_FILTER_OP_NE,
+	PAYLOAD_FILTER_OP_LT,
+	PAYLOAD_FILTER_OP_LE,
+	PAYLOAD_FILTER_OP_GT,
+	PAYLOAD_FILTER_OP_GE
+} PayloadFilterOp;
+
+struct _EventPipePayloadFilterClause {
+	ep_char16_t *field_name;
+	ep_char16_t *string_value;
+	double double_value;
+	int64_t int_value;
+	PayloadFilterOp op;
+	bool is_integer;
+	bool is_number;
+};
+
 /*
  * EventPipeSessionProvider.
  */
@@ -26,6 +73,401 @@ session_provider_free_func (void *session_provider)
 	ep_session_provider_free ((EventPipeSessionProvider *)session_provider);
 }
 
+static
+const ep_char8_t *
+session_provider_skip_spaces (
+	const ep_char8_t *str,
+	const ep_char8_t *str_end)
+{
+	while (str < str_end && (*str == ' ' || *str == '\t'))
+		str++;
+	return str;
+}
+
+static
+const ep_char8_t *
+session_provider_trim_spaces_end (
+	const ep_char8_t *str,
+	const ep_char8_t *str_end)
+{
+	while (str_end > str && (str_end [-1] == ' ' || str_end [-1] == '\t'))
+		str_end--;
+	return str_end;
+}
+
+static
+bool
+session_provider_parse_payload_filter_clause (
+	EventPipePayloadFilterClause *clause,
+	const ep_char8_t *str,
+	const ep_char8_t *str_end)
+{
+	EP_ASSERT (clause != NULL);
+
+	ep_char8_t *name = NULL;
+	ep_char8_t *value = NULL;
+	ep_char8_t *number_end = NULL;
+	const ep_char8_t *name_end = NULL;
+	const ep_char8_t *op = NULL;
+	const ep_char8_t *value_start = NULL;
+	bool result = false;
+
+	str = session_provider_skip_spaces (str, str_end);
+	str_end = session_provider_trim_spaces_end (str, str_end);
+
+	name_end = str;
+	while (name_end < str_end && *name_end != '=' && *name_end != '!' && *name_end != '<' && *name_end != '>')
+		name_end++;
+
+	op = name_end;
+	ep_raise_error_if_nok (op + 1 < str_end);
+	if (op [0] == '=') {
+		clause->op = PAYLOAD_FILTER_OP_EQ;
+		op += op [1] == '=' ? 2 : 1;
+	} else if (op [0] == '!' && op [1] == '=') {
+		clause->op = PAYLOAD_FILTER_OP_NE;
+		op += 2;
+	} else if (op [0] == '<') {
+		clause->op = op [1] == '=' ? PAYLOAD_FILTER_OP_LE : PAYLOAD_FILTER_OP_LT;
+		op += op [1] == '=' ? 2 : 1;
+	} else if (op [0] == '>') {
+		clause->op = op [1] == '=' ? PAYLOAD_FILTER_OP_GE : PAYLOAD_FILTER_OP_GT;
+		op += op [1] == '=' ? 2 : 1;
+	} else {
+		ep_raise_error ();
+	}
+
+	name_end = session_provider_trim_spaces_end (str, name_end);
+	ep_raise_error_if_nok (name_end > str);
+	name = ep_rt_utf8_string_dup_range (str, name_end);
+	ep_raise_error_if_nok (name != NULL);
+
+	value_start = session_provider_skip_spaces (op, str_end);
+	ep_raise_error_if_nok (value_start < str_end);
+	if (str_end - value_start >= 2 && (*value_start == '"' || *value_start == '\'') && str_end [-1] == *value_start) {
+		value_start++;
+		str_end--;
+	}
+	value = ep_rt_utf8_string_dup_range (value_start, str_end);
+	ep_raise_error_if_nok (value != NULL);
+
+	clause->field_name = ep_rt_utf8_to_utf16_string (name, -1);
+	ep_raise_error_if_nok (clause->field_name != NULL);
+
+	clause->string_value = ep_rt_utf8_to_utf16_string (value, -1);
+	ep_raise_error_if_nok (clause->string_value != NULL);
+
+	clause->int_value = (int64_t)strtoll (value, &number_end, 10);
+	clause->is_integer = number_end != value && *number_end == '\0';
+	clause->double_value = strtod (value, &number_end);
+	clause->is_number = number_end != value && *number_end == '\0';
+
+	// Only equality makes sense for text.
+	ep_raise_error_if_nok (clause->is_number || clause->op == PAYLOAD_FILTER_OP_EQ || clause->op == PAYLOAD_FILTER_OP_NE);
+
+	result = true;
+
+ep_on_exit:
+	ep_rt_utf8_string_free (name);
+	ep_rt_utf8_string_free (value);
+	return result;
+
+ep_on_error:
+	EP_ASSERT (!result);
+	ep_exit_error_handler ();
+}
+
+static
+bool
+session_provider_parse_payload_filter (
+	EventPipeSessionProvider *session_provider,
+	const ep_char8_t *filter_data)
+{
+	EP_ASSERT (session_provider != NULL);
+
+	// Filter data is a list of key=value pairs separated by ';'.
+	const ep_char8_t *filter = filter_data ? strstr (filter_data, PAYLOAD_FILTER_KEY) : NULL;
+	while (filter != NULL && filter != filter_data && filter [-1] != ';')
+		filter = strstr (filter + 1, PAYLOAD_FILTER_KEY);
+
+	if (filter == NULL)
+		return true;
+
+	filter += EP_ARRAY_SIZE (PAYLOAD_FILTER_KEY) - 1;
+	const ep_char8_t *filter_end = strchr (filter, ';');
+	if (filter_end == NULL)
+		filter_end = filter + strlen (filter);
+
+	uint32_t clause_count = 1;
+	for (const ep_char8_t *str = filter; str + 1 < filter_end; ++str) {
+		if (str [0] == '&' && str [1] == '&')
+			clause_count++;
+	}
+
+	session_provider->payload_filter = ep_rt_object_array_alloc (EventPipePayloadFilterClause, clause_count);
+	ep_return_false_if_nok (session_provider->payload_filter != NULL);
+	session_provider->payload_filter_len = clause_count;
+
+	const ep_char8_t *clause_start = filter;
+	for (uint32_t i = 0; i < clause_count; ++i) {
+		const ep_char8_t *clause_end = clause_start;
+		while (clause_end < filter_end && !(clause_end + 1 < filter_end && clause_end [0] == '&' && clause_end [1] == '&'))
+			clause_end++;
+
+		ep_return_false_if_nok (session_provider_parse_payload_filter_clause (&session_provider->payload_filter [i], clause_start, clause_end));
+		clause_start = clause_end + 2;
+	}
+
+	return true;
+}
+
+// Advances offset past a null terminated UTF-16 string stored at offset in a byte buffer.
+static
+bool
+session_provider_skip_utf16_string (
+	const uint8_t *buffer,
+	uint32_t buffer_len,
+	uint32_t *offset)
+{
+	while (*offset + sizeof (ep_char16_t) <= buffer_len) {
+		ep_char16_t c;
+		memcpy (&c, buffer + *offset, sizeof (c));
+		*offset += sizeof (c);
+		if (c == 0)
+			return true;
+	}
+
+	return false;
+}
+
+static
+inline
+ep_char16_t
+session_provider_to_lower_ascii (ep_char16_t c)
+{
+	return (c >= 'A' && c <= 'Z') ? (ep_char16_t)(c - 'A' + 'a') : c;
+}
+
+// Field names are compared ignoring ASCII case, so 'duration' matches a 'Duration' field.
+static
+bool
+session_provider_utf16_string_equals (
+	const uint8_t *buffer,
+	uint32_t buffer_len,
+	uint32_t offset,
+	const ep_char16_t *str,
+	bool ignore_case)
+{
+	for (;; ++str) {
+		ep_char16_t c;
+		ep_return_false_if_nok (offset + sizeof (c) <= buffer_len);
+		memcpy (&c, buffer + offset, sizeof (c));
+		offset += sizeof (c);
+
+		if (ignore_case ? session_provider_to_lower_ascii (c) != session_provider_to_lower_ascii (*str) : c != *str)
+			return false;
+		if (c == 0)
+			return true;
+	}
+}
+
+// Size of a fixed size payload field, 0 for strings and types that can't be skipped.
+static
+uint32_t
+session_provider_get_parameter_size (EventPipeParameterType type)
+{
+	switch (type) {
+	case EP_PARAMETER_TYPE_SBYTE:
+	case EP_PARAMETER_TYPE_BYTE:
+		return 1;
+	case EP_PARAMETER_TYPE_CHAR:
+	case EP_PARAMETER_TYPE_INT16:
+	case EP_PARAMETER_TYPE_UINT16:
+		return 2;
+	case EP_PARAMETER_TYPE_BOOLEAN:
+	case EP_PARAMETER_TYPE_INT32:
+	case EP_PARAMETER_TYPE_UINT32:
+	case EP_PARAMETER_TYPE_SINGLE:
+		return 4;
+	case EP_PARAMETER_TYPE_INT64:
+	case EP_PARAMETER_TYPE_UINT64:
+	case EP_PARAMETER_TYPE_DOUBLE:
+	case EP_PARAMETER_TYPE_DATE_TIME:
+		return 8;
+	case EP_PARAMETER_TYPE_DECIMAL:
+	case EP_PARAMETER_TYPE_GUID:
+		return 16;
+	default:
+		return 0;
+	}
+}
+
+static
+bool
+session_provider_payload_filter_clause_test (
+	const EventPipePayloadFilterClause *clause,
+	int compare)
+{
+	switch (clause->op) {
+	case PAYLOAD_FILTER_OP_EQ:
+		return compare == 0;
+	case PAYLOAD_FILTER_OP_NE:
+		return compare != 0;
+	case PAYLOAD_FILTER_OP_LT:
+		return compare < 0;
+	case PAYLOAD_FILTER_OP_LE:
+		return compare <= 0;
+	case PAYLOAD_FILTER_OP_GT:
+		return compare > 0;
+	case PAYLOAD_FILTER_OP_GE:
+		return compare >= 0;
+	default:
+		EP_UNREACHABLE ("Unknown payload filter operator");
+		return false;
+	}
+}
+
+static
+bool
+session_provider_payload_filter_clause_matches (
+	const EventPipePayloadFilterClause *clause,
+	const EventPipeEvent *ep_event,
+	const EventPipeEventPayload *payload)
+{
+	EP_ASSERT (clause != NULL);
+	EP_ASSERT (ep_event != NULL);
+	EP_ASSERT (payload != NULL);
+
+	const uint8_t *metadata = ep_event_get_metadata (ep_event);
+	uint32_t metadata_len = ep_event_get_metadata_len (ep_event);
+
+	// Metadata layout: event id, event name, keywords, version, level, parameter count
+	// followed by the (type, name) of each parameter.
+	uint32_t metadata_offset = sizeof (uint32_t);
+	if (!metadata || !session_provider_skip_utf16_string (metadata, metadata_len, &metadata_offset))
+		return true;
+	metadata_offset += sizeof (uint64_t) + sizeof (uint32_t) + sizeof (uint32_t);
+
+	uint32_t param_count;
+	if (metadata_offset + sizeof (param_count) > metadata_len)
+		return true;
+	memcpy (&param_count, metadata + metadata_offset, sizeof (param_count));
+	metadata_offset += sizeof (param_count);
+
+	// Walk the parameters and the payload in lockstep until the field is found.
+	uint32_t payload_offset = 0;
+	for (uint32_t i = 0; i < param_count; ++i) {
+		uint32_t type;
+		if (metadata_offset + sizeof (type) > metadata_len)
+			return true;
+		memcpy (&type, metadata + metadata_offset, sizeof (type));
+		metadata_offset += sizeof (type);
+
+		bool is_field = session_provider_utf16_string_equals (metadata, metadata_len, metadata_offset, clause->field_name, true);
+		if (!session_provider_skip_utf16_string (metadata, metadata_len, &metadata_offset))
+			return true;
+
+		uint32_t size = session_provider_get_parameter_size ((EventPipeParameterType)type);
+		if (is_field) {
+			if ((EventPipeParameterType)type == EP_PARAMETER_TYPE_STRING) {
+				// Compare the payload string against the value one character at a time.
+				int compare = 0;
+				for (const ep_char16_t *value = clause->string_value; compare == 0; ++value) {
+					ep_char16_t c;
+					if (!ep_event_payload_read (payload, payload_offset, (uint8_t *)&c, sizeof (c)))
+						return true;
+					payload_offset += sizeof (c);
+					compare = (c == *value) ? 0 : 1;
+					if (c == 0 || *value == 0)
+						break;
+				}
+				return session_provider_payload_filter_clause_test (clause, compare);
+			}
+
+			uint8_t raw [8] = { 0 };
+			if (size == 0 || size > sizeof (raw) || !clause->is_number || !ep_event_payload_read (payload, payload_offset, raw, size))
+				return true;
+
+			bool is_float = (EventPipeParameterType)type == EP_PARAMETER_TYPE_SINGLE || (EventPipeParameterType)type == EP_PARAMETER_TYPE_DOUBLE;
+			bool is_signed = false;
+			int64_t signed_value = 0;
+			uint64_t unsigned_value = 0;
+			double double_value = 0;
+
+			switch ((EventPipeParameterType)type) {
+			case EP_PARAMETER_TYPE_SINGLE: {
+				float value;
+				memcpy (&value, raw, sizeof (value));
+				double_value = value;
+				break;
+			}
+			case EP_PARAMETER_TYPE_DOUBLE:
+				memcpy (&double_value, raw, sizeof (double_value));
+				break;
+			case EP_PARAMETER_TYPE_SBYTE:
+				is_signed = true;
+				signed_value = *(int8_t *)raw;
+				break;
+			case EP_PARAMETER_TYPE_INT16: {
+				int16_t value;
+				memcpy (&value, raw, sizeof (value));
+				is_signed = true;
+				signed_value = value;
+				break;
+			}
+			case EP_PARAMETER_TYPE_BOOLEAN:
+			case EP_PARAMETER_TYPE_INT32: {
+				int32_t value;
+				memcpy (&value, raw, sizeof (value));
+				is_signed = true;
+				signed_value = value;
+				break;
+			}
+			case EP_PARAMETER_TYPE_INT64:
+			case EP_PARAMETER_TYPE_DATE_TIME:
+				memcpy (&signed_value, raw, sizeof (signed_value));
+				is_signed = true;
+				break;
+			default:
+				// Unsigned types, the value is in the low bytes of raw.
+				memcpy (&unsigned_value, raw, sizeof (unsigned_value));
+				break;
+			}
+
+			int compare;
+			if (is_float || !clause->is_integer) {
+				if (!is_float)
+					double_value = is_signed ? (double)signed_value : (double)unsigned_value;
+				compare = double_value < clause->double_value ? -1 : (double_value > clause->double_value ? 1 : 0);
+			} else if (is_signed) {
+				compare = signed_value < clause->int_value ? -1 : (signed_value > clause->int_value ? 1 : 0);
+			} else if (clause->int_value < 0) {
+				compare = 1;
+			} else {
+				compare = unsigned_value < (uint64_t)clause->int_value ? -1 : (unsigned_value > (uint64_t)clause->int_value ? 1 : 0);
+			}
+
+			return session_provider_payload_filter_clause_test (clause, compare);
+		}
+
+		if (size != 0) {
+			payload_offset += size;
+		} else if ((EventPipeParameterType)type == EP_PARAMETER_TYPE_STRING) {
+			ep_char16_t c = 1;
+			while (c != 0) {
+				if (!ep_event_payload_read (payload, payload_offset, (uint8_t *)&c, sizeof (c)))
+					return true;
+				payload_offset += sizeof (c);
+			}
+		} else {
+			// The remaining fields can't be located.
+			return true;
+		}
+	}
+
+	return true;
+}
+
 EventPipeSessionProvider *
 ep_session_provider_alloc (
 	const ep_char8_t *provider_name,
@@ -46,6 +488,9 @@ ep_session_provider_alloc (
 		ep_raise_error_if_nok (instance->filter_data != NULL);
 	}
 
+	// A malformed payload filter fails the session rather than silently letting every event through.
+	ep_raise_error_if_nok (session_provider_parse_payload_filter (instance, filter_data));
+
 	instance->keywords = keywords;
 	instance->logging_level = logging_level;
 
@@ -63,11 +508,35 @@ ep_session_provider_free (EventPipeSessionProvider * session_provider)
 {
 	ep_return_void_if_nok (session_provider != NULL);
 
+	if (session_provider->payload_filter) {
+		for (uint32_t i = 0; i < session_provider->payload_filter_len; ++i) {
+			ep_rt_utf16_string_free (session_provider->payload_filter [i].field_name);
+			ep_rt_utf16_string_free (session_provider->payload_filter [i].string_value);
+		}
+		ep_rt_object_array_free (session_provider->payload_filter);
+	}
+
 	ep_rt_utf8_string_free (session_provider->filter_data);
 	ep_rt_utf8_string_free (session_provider->provider_name);
 	ep_rt_object_free (session_provider);
 }
 
+bool
+ep_session_provider_payload_filter_matches (
+	const EventPipeSessionProvider *session_provider,
+	const EventPipeEvent *ep_event,
+	const EventPipeEventPayload *payload)
+{
+	EP_ASSERT (session_provider != NULL);
+
+	for (uint32_t i = 0; i < session_provider->payload_filter_len; ++i) {
+		if (!session_provider_payload_filter_clause_matches (&session_provider->payload_filter [i], ep_event, payload))
+			return false;
+	}
+
+	return true;
+}
+
 /*
  * EventPipeSessionProviderList.
  */
@@ -86,6 +555,7 @@ ep_session_provider_list_alloc (
 	ep_raise_error_if_nok (ep_rt_session_provider_list_is_valid (&instance->providers));
 
 	instance->catch_all_provider = NULL;
+	instance->has_payload_filters = false;
 
 	for (uint32_t i = 0; i < configs_len; ++i) {
 		const EventPipeProviderConfiguration *config = &configs [i];
@@ -104,6 +574,8 @@ ep_session_provider_list_alloc (
 				ep_provider_config_get_keywords (config),
 				ep_provider_config_get_logging_level (config),
 				ep_provider_config_get_filter_data (config));
+			ep_raise_error_if_nok (session_provider != NULL);
+			instance->has_payload_filters |= ep_session_provider_has_payload_filter (session_provider);
 			ep_raise_error_if_nok (ep_rt_session_provider_list_append (&instance->providers, session_provider));
 		}
 	}
@@ -149,6 +621,7 @@ ep_session_provider_list_add_session_provider (
 	EP_ASSERT (session_provider_list != NULL);
 	EP_ASSERT (session_provider != NULL);
 
+	session_provider_list->has_payload_filters |= ep_session_provider_has_payload_filter (session_provider);
 	return ep_rt_session_provider_list_append (&session_provider_list->providers, session_provider);
 }
 
@@ -24,6 +24,10 @@ struct _EventPipeSessionProvider_Internal {
 	uint64_t keywords;
 	EventPipeEventLevel logging_level;
 	ep_char8_t *filter_data;
+	// Optional payload predicate, parsed from the PayloadFilter entry of filter_data.
+	// An event is only kept if it matches every clause.
+	EventPipePayloadFilterClause *payload_filter;
+	uint32_t payload_filter_len;
 };
 
 #if !defined(EP_INLINE_GETTER_SETTER) && !defined(EP_IMPL_SESSION_PROVIDER_GETTER_SETTER)
@@ -36,6 +40,7 @@ EP_DEFINE_GETTER(EventPipeSessionProvider *, session_provider, const ep_char8_t
 EP_DEFINE_GETTER(EventPipeSessionProvider *, session_provider, uint64_t, keywords)
 EP_DEFINE_GETTER(EventPipeSessionProvider *, session_provider, EventPipeEventLevel, logging_level)
 EP_DEFINE_GETTER(EventPipeSessionProvider *, session_provider, const ep_char8_t *, filter_data)
+EP_DEFINE_GETTER(EventPipeSessionProvider *, session_provider, uint32_t, payload_filter_len)
 
 EventPipeSessionProvider *
 ep_session_provider_alloc (
@@ -47,6 +52,23 @@ ep_session_provider_alloc (
 void
 ep_session_provider_free (EventPipeSessionProvider * session_provider);
 
+static
+inline
+bool
+ep_session_provider_has_payload_filter (const EventPipeSessionProvider *session_provider)
+{
+	return ep_session_provider_get_payload_filter_len (session_provider) != 0;
+}
+
+// Evaluates the payload filter of the session provider against an event, using
+// the parameter descriptions in the event metadata to locate the fields.
+// Clauses naming a field the event does not have are ignored.
+bool
+ep_session_provider_payload_filter_matches (
+	const EventPipeSessionProvider *session_provider,
+	const EventPipeEvent *ep_event,
+	const EventPipeEventPayload *payload);
+
 /*
 * EventPipeSessionProviderList.
  */
@@ -57,6 +79,8 @@ struct _EventPipeSessionProviderList_Internal {
 #endif
 	ep_rt_session_provider_list_t providers;
 	EventPipeSessionProvider *catch_all_provider;
+	// True if any provider in the list has a payload filter.
+	bool has_payload_filters;
 };
 
 #if !defined(EP_INLINE_GETTER_SETTER) && !defined(EP_IMPL_SESSION_PROVIDER_GETTER_SETTER)
@@ -67,6 +91,7 @@ struct _EventPipeSessionProviderList {
 
 EP_DEFINE_GETTER_REF(EventPipeSessionProviderList *, session_provider_list, ep_rt_session_provider_list_t *, providers)
 EP_DEFINE_GETTER(EventPipeSessionProviderList *, session_provider_list, EventPipeSessionProvider *, catch_all_provider)
+EP_DEFINE_GETTER(EventPipeSessionProviderList *, session_provider_list, bool, has_payload_filters)
 
 EventPipeSessionProviderList *
 ep_session_provider_list_alloc (
@@ -387,6 +387,18 @@ ep_session_start_streaming (EventPipeSession *session)
 	return;
 }
 
+bool
+ep_session_enable_block_compression (EventPipeSession *session)
+{
+	EP_ASSERT (session != NULL);
+
+	ep_requires_lock_held ();
+
+	// Synchronous sessions don't serialize blocks.
+	ep_return_false_if_nok (session->file != NULL);
+	return ep_file_enable_block_compression (session->file);
+}
+
 bool
 ep_session_is_valid (const EventPipeSession *session)
 {
@@ -457,6 +469,15 @@ ep_session_write_event (
 
 	// Filter events specific to "this" session based on precomputed flag on provider/events.
 	if (ep_event_is_enabled_by_mask (ep_event, ep_session_get_mask (session))) {
+		// Drop events rejected by a payload filter before anything is copied.
+		if (ep_session_provider_list_get_has_payload_filters (session->providers) && payload != NULL) {
+			EventPipeSessionProvider *session_provider = ep_rt_session_provider_list_find_by_name (
+				ep_session_provider_list_get_providers_cref (session->providers),
+				ep_provider_get_provider_name (ep_event_get_provider (ep_event)));
+			if (session_provider && !ep_session_provider_payload_filter_matches (session_provider, ep_event, payload))
+				return true;
+		}
+
 		if (session->synchronous_callback) {
 			session->synchronous_callback (
 				ep_event_get_provider (ep_event),
@@ -123,6 +123,10 @@ ep_session_write_sequence_point_unbuffered (EventPipeSession *session);
 void
 ep_session_start_streaming (EventPipeSession *session);
 
+// _Requires_lock_held (ep)
+bool
+ep_session_enable_block_compression (EventPipeSession *session);
+
 // Determine if the session is valid or not.
 // Invalid sessions can be detected before they are enabled.
 bool
@@ -27,6 +27,7 @@ typedef struct _EventPipeFile EventPipeFile;
 typedef struct _EventPipeJsonFile EventPipeJsonFile;
 typedef struct _EventPipeMetadataBlock EventPipeMetadataBlock;
 typedef struct _EventPipeParameterDesc EventPipeParameterDesc;
+typedef struct _EventPipePayloadFilterClause EventPipePayloadFilterClause;
 typedef struct _EventPipeProvider EventPipeProvider;
 typedef struct _EventPipeProviderCallbackData EventPipeProviderCallbackData;
 typedef struct _EventPipeProviderCallbackDataQueue EventPipeProviderCallbackDataQueue;
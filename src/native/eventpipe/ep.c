@@ -1108,6 +1108,27 @@ ep_on_error:
 	ep_exit_error_handler ();
 }
 
+bool
+ep_enable_block_compression (EventPipeSessionID session_id)
+{
+	ep_requires_lock_not_held ();
+
+	bool result = false;
+
+	EP_LOCK_ENTER (section1)
+		ep_raise_error_if_nok_holding_lock (is_session_id_in_collection (session_id), section1);
+		result = ep_session_enable_block_compression ((EventPipeSession *)session_id);
+	EP_LOCK_EXIT (section1)
+
+ep_on_exit:
+	ep_requires_lock_not_held ();
+	return result;
+
+ep_on_error:
+	EP_ASSERT (!result);
+	ep_exit_error_handler ();
+}
+
 bool
 ep_enabled (void)
 {
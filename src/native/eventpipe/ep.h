@@ -206,6 +206,11 @@ ep_is_session_enabled (EventPipeSessionID session_id);
 void
 ep_start_streaming (EventPipeSessionID session_id);
 
+// Opts a session into LZ4 compression of its event and metadata blocks.
+// Must be called between ep_enable and ep_start_streaming.
+bool
+ep_enable_block_compression (EventPipeSessionID session_id);
+
 bool
 ep_enabled (void);
 
@@ -0,0 +1,106 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+using System;
+using System.Collections.Concurrent;
+using System.Diagnostics;
+using System.Runtime.CompilerServices;
+using System.Runtime.ConstrainedExecution;
+using System.Threading;
+
+// Runs with helper finalizer threads (FinalizerThreadCount=4) and checks that every
+// finalizer of a large backlog runs once, and that the critical finalizers still run
+// after all the normal finalizers of the objects that died in the same GC. The time
+// to drain the backlog and the number of threads that ran finalizers are reported.
+public class ParallelFinalization
+{
+    private const int ObjectCount = 100000;
+    private const int CriticalObjectCount = 100;
+    private const int Rounds = 5;
+
+    private static int s_finalized;
+    private static int s_criticalFinalized;
+    private static int s_criticalTooEarly;
+    private static ConcurrentDictionary<int, bool> s_finalizerThreads = new ConcurrentDictionary<int, bool>();
+
+    private class Finalizable
+    {
+        private int _spin;
+
+        public Finalizable(int spin)
+        {
+            _spin = spin;
+        }
+
+        ~Finalizable()
+        {
+            // A little work, so that the backlog takes some time to drain
+            Thread.SpinWait(_spin);
+            s_finalizerThreads.TryAdd(Environment.CurrentManagedThreadId, true);
+            Interlocked.Increment(ref s_finalized);
+        }
+    }
+
+    private class CriticalFinalizable : CriticalFinalizerObject
+    {
+        ~CriticalFinalizable()
+        {
+            if (Volatile.Read(ref s_finalized) != ObjectCount)
+            {
+                Interlocked.Increment(ref s_criticalTooEarly);
+            }
+            Interlocked.Increment(ref s_criticalFinalized);
+        }
+    }
+
+    // All the objects are kept alive until this returns, so that they all die in the same GC
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static void Allocate()
+    {
+        object[] objects = new object[CriticalObjectCount + ObjectCount];
+        for (int i = 0; i < CriticalObjectCount; i++)
+        {
+            objects[i] = new CriticalFinalizable();
+        }
+        for (int i = CriticalObjectCount; i < objects.Length; i++)
+        {
+            objects[i] = new Finalizable(20);
+        }
+        GC.KeepAlive(objects);
+    }
+
+    public static int Main()
+    {
+        for (int round = 0; round < Rounds; round++)
+        {
+            s_finalized = 0;
+            s_criticalFinalized = 0;
+
+            Allocate();
+
+            Stopwatch stopwatch = Stopwatch.StartNew();
+            GC.Collect();
+            GC.WaitForPendingFinalizers();
+            stopwatch.Stop();
+
+            if (s_finalized != ObjectCount || s_criticalFinalized != CriticalObjectCount)
+            {
+                Console.WriteLine($"FAILED: round {round} finalized {s_finalized} of {ObjectCount} objects and {s_criticalFinalized} of {CriticalObjectCount} critical objects");
+                return 101;
+            }
+
+            Console.WriteLine($"Round {round}: {ObjectCount} finalizers in {stopwatch.Elapsed.TotalMilliseconds:F1} ms");
+        }
+
+        Console.WriteLine($"Finalizers ran on {s_finalizerThreads.Count} threads");
+
+        if (s_criticalTooEarly != 0)
+        {
+            Console.WriteLine($"FAILED: {s_criticalTooEarly} critical finalizers ran before the normal finalizers were done");
+            return 101;
+        }
+
+        Console.WriteLine("PASSED");
+        return 100;
+    }
+}
@@ -0,0 +1,95 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+using System;
+using System.Diagnostics;
+using System.Runtime.CompilerServices;
+
+// Measures reference stores through the write barrier for the store patterns that
+// matter to the barrier flavors: stores into young objects, stores between old
+// objects, and stores of young objects into old ones (the only ones that need a
+// card). The throughput is reported so it can be tracked over time; the test only
+// fails if a reference stored into an old object is lost across a GC, which is
+// what a barrier that skips a needed card would cause.
+public class WriteBarrierStores
+{
+    // Small enough for the arrays to stay off the large object heap, which is old from the start
+    private const int SlotCount = 8 * 1024;
+    private const int Iterations = 2000;
+
+    private class Node
+    {
+        public int Id;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static void Store(object[] slots, object[] values)
+    {
+        for (int i = 0; i < slots.Length; i++)
+        {
+            slots[i] = values[i];
+        }
+    }
+
+    private static object[] MakeNodes(int start)
+    {
+        object[] nodes = new object[SlotCount];
+        for (int i = 0; i < nodes.Length; i++)
+        {
+            nodes[i] = new Node { Id = start + i };
+        }
+        return nodes;
+    }
+
+    private static void Measure(string name, object[] slots, object[] values)
+    {
+        Store(slots, values);
+
+        Stopwatch sw = Stopwatch.StartNew();
+        for (int i = 0; i < Iterations; i++)
+        {
+            Store(slots, values);
+        }
+        sw.Stop();
+
+        double nsPerStore = sw.Elapsed.TotalMilliseconds * 1000000.0 / ((double)Iterations * SlotCount);
+        Console.WriteLine("{0,-12} {1:F2} ns per store", name, nsPerStore);
+    }
+
+    private static void Promote()
+    {
+        GC.Collect();
+        GC.Collect();
+    }
+
+    public static int Main()
+    {
+        object[] oldSlots = new object[SlotCount];
+        object[] oldValues = MakeNodes(0);
+        Promote();
+
+        object[] youngSlots = new object[SlotCount];
+        object[] youngValues = MakeNodes(SlotCount);
+
+        Measure("young->young", youngSlots, youngValues);
+        Measure("old->old", oldSlots, oldValues);
+        Measure("old->young", oldSlots, youngValues);
+
+        // The last stores put young objects into an old array, they must survive
+        // a gen0 GC through its card.
+        youngValues = null;
+        GC.Collect(0);
+
+        for (int i = 0; i < oldSlots.Length; i++)
+        {
+            if (!(oldSlots[i] is Node node) || node.Id != SlotCount + i)
+            {
+                Console.WriteLine("FAILED: slot {0} lost its reference", i);
+                return 101;
+            }
+        }
+
+        Console.WriteLine("PASSED");
+        return 100;
+    }
+}
@@ -0,0 +1,86 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+using System;
+using System.Diagnostics;
+using System.Runtime.InteropServices;
+
+// Measures the cost of native code calling back into managed code at a high rate, the
+// way audio and graphics callbacks do: once through an UnmanagedCallersOnly function
+// pointer and once through a marshalled delegate, from a thread the runtime already
+// knows and from a native thread that is only set up on its first callback. The
+// per-call cost is reported so it can be tracked over time; the test only fails if a
+// callback returns the wrong result.
+public unsafe class TransitionLatency
+{
+    private const int WarmupIterations = 1000;
+    private const int Iterations = 1000000;
+
+    private static class TransitionLatencyNative
+    {
+        [DllImport(nameof(TransitionLatencyNative))]
+        public static extern int InvokeCallbackRepeatedly(IntPtr callbackProc, int count);
+
+        [DllImport(nameof(TransitionLatencyNative))]
+        public static extern int InvokeCallbackRepeatedlyOnNewThread(IntPtr callbackProc, int count);
+    }
+
+    private delegate int CallbackDelegate(int n);
+
+    [UnmanagedCallersOnly]
+    private static int UnmanagedCallersOnlyCallback(int n)
+    {
+        return n & 1;
+    }
+
+    private static int DelegateCallback(int n)
+    {
+        return n & 1;
+    }
+
+    private static bool Measure(string name, IntPtr callbackProc, bool onNewThread)
+    {
+        Func<IntPtr, int, int> invoke = onNewThread
+            ? TransitionLatencyNative.InvokeCallbackRepeatedlyOnNewThread
+            : TransitionLatencyNative.InvokeCallbackRepeatedly;
+
+        invoke(callbackProc, WarmupIterations);
+
+        Stopwatch sw = Stopwatch.StartNew();
+        int result = invoke(callbackProc, Iterations);
+        sw.Stop();
+
+        if (result != Iterations / 2)
+        {
+            Console.WriteLine("FAILED: {0} returned {1}, expected {2}", name, result, Iterations / 2);
+            return false;
+        }
+
+        double nsPerCall = sw.Elapsed.TotalMilliseconds * 1000000.0 / Iterations;
+        Console.WriteLine("{0}: {1:F1} ns per callback ({2} iterations)", name, nsPerCall, Iterations);
+        return true;
+    }
+
+    public static int Main()
+    {
+        IntPtr unmanagedCallersOnlyProc = (IntPtr)(delegate* unmanaged<int, int>)&UnmanagedCallersOnlyCallback;
+
+        CallbackDelegate callbackDelegate = DelegateCallback;
+        IntPtr delegateProc = Marshal.GetFunctionPointerForDelegate(callbackDelegate);
+
+        bool passed = Measure("UnmanagedCallersOnly", unmanagedCallersOnlyProc, onNewThread: false)
+            && Measure("UnmanagedCallersOnly, native thread", unmanagedCallersOnlyProc, onNewThread: true)
+            && Measure("Delegate", delegateProc, onNewThread: false)
+            && Measure("Delegate, native thread", delegateProc, onNewThread: true);
+
+        GC.KeepAlive(callbackDelegate);
+
+        if (!passed)
+        {
+            return 101;
+        }
+
+        Console.WriteLine("PASSED");
+        return 100;
+    }
+}
@@ -0,0 +1,43 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+#include <platformdefines.h>
+
+#include <thread>
+
+typedef int (STDMETHODCALLTYPE *CALLBACKPROC)(int n);
+
+extern "C" DLL_EXPORT int STDMETHODCALLTYPE InvokeCallbackRepeatedly(CALLBACKPROC pCallbackProc, int count)
+{
+    int acc = 0;
+    for (int i = 0; i < count; ++i)
+        acc += pCallbackProc(i);
+
+    return acc;
+}
+
+namespace
+{
+    struct CallbackContext
+    {
+        CALLBACKPROC CallbackProc;
+        int Count;
+        int Result;
+    };
+
+    void InvokeCallbackRepeatedlyProxy(CallbackContext* cxt)
+    {
+        cxt->Result = InvokeCallbackRepeatedly(cxt->CallbackProc, cxt->Count);
+    }
+}
+
+extern "C" DLL_EXPORT int STDMETHODCALLTYPE InvokeCallbackRepeatedlyOnNewThread(CALLBACKPROC pCallbackProc, int count)
+{
+    CallbackContext cxt{ pCallbackProc, count, 0 };
+    std::thread nativeThread{ InvokeCallbackRepeatedlyProxy, &cxt };
+
+    // Wait for the native thread to complete
+    nativeThread.join();
+
+    return cxt.Result;
+}
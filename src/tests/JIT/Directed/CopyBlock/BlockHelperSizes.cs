@@ -0,0 +1,117 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+using System;
+using System.Diagnostics;
+using System.Runtime.CompilerServices;
+
+// Measures cpblk and initblk with sizes that are only known at run time, which the
+// JIT turns into calls to the JIT_MemCpy and JIT_MemSet helpers. Each size bucket
+// hits a different path of the helpers, from the inline small block code to the
+// CPU specific loops and the CRT. The cost per call is reported so it can be
+// tracked over time; the test only fails if a block is not copied or set correctly.
+public class BlockHelperSizes
+{
+    private static readonly int[] s_sizes = { 1, 3, 7, 16, 31, 48, 64, 100, 256, 1000, 2048, 4096, 65536 };
+
+    private const int BytesPerBucket = 64 * 1024 * 1024;
+    private const int Slack = 64;
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static void Copy(byte[] dest, byte[] src, int offset, int size)
+    {
+        Unsafe.CopyBlockUnaligned(ref dest[offset], ref src[offset], (uint)size);
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static void Init(byte[] dest, int offset, byte value, int size)
+    {
+        Unsafe.InitBlockUnaligned(ref dest[offset], value, (uint)size);
+    }
+
+    private static bool Check(byte[] dest, byte[] src, int offset, int size, string what)
+    {
+        for (int i = 0; i < dest.Length; i++)
+        {
+            bool inside = (i >= offset) && (i < offset + size);
+            if (dest[i] != (inside ? src[i] : (byte)0))
+            {
+                Console.WriteLine("FAILED: {0} of {1} bytes at offset {2} is wrong at {3}", what, size, offset, i);
+                return false;
+            }
+        }
+        return true;
+    }
+
+    private static bool Verify(int size)
+    {
+        byte[] src = new byte[size + Slack];
+        new Random(size).NextBytes(src);
+
+        // Odd offsets make sure the helpers don't rely on alignment
+        for (int offset = 0; offset < 4; offset++)
+        {
+            byte[] dest = new byte[size + Slack];
+            Copy(dest, src, offset, size);
+            if (!Check(dest, src, offset, size, "copy"))
+            {
+                return false;
+            }
+
+            byte[] pattern = new byte[size + Slack];
+            Array.Fill(pattern, (byte)0x5A);
+            Array.Clear(dest, 0, dest.Length);
+            Init(dest, offset, 0x5A, size);
+            if (!Check(dest, pattern, offset, size, "init"))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    private static void Measure(int size)
+    {
+        byte[] src = new byte[size + Slack];
+        byte[] dest = new byte[size + Slack];
+        int iterations = Math.Max(BytesPerBucket / size, 1) / 4;
+
+        Copy(dest, src, 1, size);
+        Init(dest, 1, 0, size);
+
+        Stopwatch sw = Stopwatch.StartNew();
+        for (int i = 0; i < iterations; i++)
+        {
+            Copy(dest, src, 1, size);
+        }
+        double copyNs = sw.Elapsed.TotalMilliseconds * 1000000.0 / iterations;
+
+        sw.Restart();
+        for (int i = 0; i < iterations; i++)
+        {
+            Init(dest, 1, (byte)i, size);
+        }
+        double initNs = sw.Elapsed.TotalMilliseconds * 1000000.0 / iterations;
+
+        Console.WriteLine("{0,6} bytes: cpblk {1,9:F1} ns, initblk {2,9:F1} ns", size, copyNs, initNs);
+    }
+
+    public static int Main()
+    {
+        foreach (int size in s_sizes)
+        {
+            if (!Verify(size))
+            {
+                return 101;
+            }
+        }
+
+        foreach (int size in s_sizes)
+        {
+            Measure(size);
+        }
+
+        Console.WriteLine("PASSED");
+        return 100;
+    }
+}
@@ -0,0 +1,93 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+using System;
+using System.Diagnostics;
+using System.Reflection;
+using System.Runtime.CompilerServices;
+using System.Runtime.Loader;
+
+// Unloads a group of collectible AssemblyLoadContexts that are collected together while their
+// teardown runs in batches of two on the finalizer thread (LoaderAllocatorTeardownBatchSize=2).
+// The managed AssemblyLoadContext is only released when the batch that holds it is torn down, so
+// every context must still become unreachable. The time until the last one is gone is reported.
+public class IncrementalUnload
+{
+    private const int ContextCount = 32;
+    private const int Rounds = 3;
+    private const int MaxCollections = 1000;
+
+    public static int Compute(int value)
+    {
+        return value * 3 + 1;
+    }
+
+    // The contexts are only reachable through the weak references once this returns
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static WeakReference[] LoadAndUnload(string assemblyPath)
+    {
+        WeakReference[] contexts = new WeakReference[ContextCount];
+        for (int i = 0; i < ContextCount; i++)
+        {
+            AssemblyLoadContext alc = new AssemblyLoadContext($"IncrementalUnload{i}", isCollectible: true);
+            Assembly assembly = alc.LoadFromAssemblyPath(assemblyPath);
+
+            // Run code from the context, so that it has jitted code to unload
+            MethodInfo compute = assembly.GetType(nameof(IncrementalUnload)).GetMethod(nameof(Compute));
+            int result = (int)compute.Invoke(null, new object[] { i });
+            if (result != Compute(i))
+            {
+                throw new Exception($"Compute({i}) returned {result} in context {i}");
+            }
+
+            contexts[i] = new WeakReference(alc);
+            alc.Unload();
+        }
+        return contexts;
+    }
+
+    private static int CountAlive(WeakReference[] contexts)
+    {
+        int alive = 0;
+        foreach (WeakReference context in contexts)
+        {
+            if (context.IsAlive)
+            {
+                alive++;
+            }
+        }
+        return alive;
+    }
+
+    public static int Main()
+    {
+        string assemblyPath = typeof(IncrementalUnload).Assembly.Location;
+
+        for (int round = 0; round < Rounds; round++)
+        {
+            WeakReference[] contexts = LoadAndUnload(assemblyPath);
+
+            Stopwatch stopwatch = Stopwatch.StartNew();
+            int collections = 0;
+            while (CountAlive(contexts) != 0 && collections < MaxCollections)
+            {
+                GC.Collect();
+                GC.WaitForPendingFinalizers();
+                collections++;
+            }
+            stopwatch.Stop();
+
+            int alive = CountAlive(contexts);
+            if (alive != 0)
+            {
+                Console.WriteLine($"FAILED: round {round} still has {alive} of {ContextCount} contexts alive after {collections} collections");
+                return 101;
+            }
+
+            Console.WriteLine($"Round {round}: {ContextCount} contexts unloaded in {stopwatch.Elapsed.TotalMilliseconds:F1} ms and {collections} collections");
+        }
+
+        Console.WriteLine("PASSED");
+        return 100;
+    }
+}
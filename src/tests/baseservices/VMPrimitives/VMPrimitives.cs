@@ -0,0 +1,304 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+using System;
+using System.Collections.Generic;
+using System.Diagnostics;
+using System.Globalization;
+using System.Runtime.CompilerServices;
+using System.Runtime.InteropServices;
+using System.Threading;
+
+// Microbenchmarks of runtime primitives: cast cache lookups, virtual stub dispatch,
+// thread statics, AwareLock, P/Invoke and reverse P/Invoke transitions, string
+// interning and type loads. Each benchmark prints one JSON object per line,
+//
+//   {"benchmark":"<name>","operations":<count>,"nsPerOperation":<median over runs>}
+//
+// so that results can be collected and compared across builds. The iteration count
+// can be scaled by passing a multiplier as the first argument.
+public static unsafe class VMPrimitives
+{
+    private const int Iterations = 1000000;
+    private const int Runs = 5;
+
+    private static int s_scale = 1;
+    private static long s_checksum;
+    private static bool s_failed;
+
+    public interface IShape
+    {
+        int Area();
+    }
+
+    public sealed class Impl<T> : IShape
+    {
+        public int Area() => 1;
+    }
+
+    // 16 distinct types implementing IShape, for the polymorphic benchmarks
+    private static readonly IShape[] s_allShapes = new IShape[]
+    {
+        new Impl<byte>(), new Impl<sbyte>(), new Impl<short>(), new Impl<ushort>(),
+        new Impl<int>(), new Impl<uint>(), new Impl<long>(), new Impl<ulong>(),
+        new Impl<float>(), new Impl<double>(), new Impl<char>(), new Impl<bool>(),
+        new Impl<decimal>(), new Impl<string>(), new Impl<object>(), new Impl<Guid>(),
+    };
+
+    private static readonly Type[] s_typeArguments = new Type[]
+    {
+        typeof(byte), typeof(sbyte), typeof(short), typeof(ushort),
+        typeof(int), typeof(uint), typeof(long), typeof(ulong),
+        typeof(float), typeof(double), typeof(char), typeof(bool),
+        typeof(decimal), typeof(string), typeof(object), typeof(Guid),
+    };
+
+    // One open generic type per run of the type load benchmark, since a type only loads once
+    private static readonly Type[] s_openGenericTypes = new Type[]
+    {
+        typeof(Dictionary<,>), typeof(KeyValuePair<,>), typeof(Tuple<,>), typeof(ValueTuple<,>), typeof(Func<,>),
+    };
+
+    [ThreadStatic]
+    private static int t_counter;
+
+    [DllImport("VMPrimitivesNative")]
+    private static extern int Increment(int value);
+
+    [DllImport("VMPrimitivesNative")]
+    private static extern int CallbackLoop(delegate* unmanaged[Stdcall]<int, int> callback, int count);
+
+    [UnmanagedCallersOnly(CallConvs = new[] { typeof(CallConvStdcall) })]
+    private static int ManagedIncrement(int value) => value + 1;
+
+    // Runs the body once to warm up (unless it can only measure cold state) and then
+    // Runs times, and reports the median time per operation.
+    private static void Measure(string name, long operations, Func<int, long> body, bool warmUp = true)
+    {
+        if (warmUp)
+        {
+            s_checksum += body(-1);
+        }
+
+        double[] nsPerOperation = new double[Runs];
+        for (int run = 0; run < Runs; run++)
+        {
+            Stopwatch stopwatch = Stopwatch.StartNew();
+            s_checksum += body(run);
+            stopwatch.Stop();
+            nsPerOperation[run] = stopwatch.Elapsed.TotalMilliseconds * 1000000.0 / operations;
+        }
+
+        Array.Sort(nsPerOperation);
+        Console.WriteLine(string.Format(CultureInfo.InvariantCulture,
+            "{{\"benchmark\":\"{0}\",\"operations\":{1},\"nsPerOperation\":{2:F3}}}",
+            name, operations, nsPerOperation[Runs / 2]));
+    }
+
+    private static void Check(bool condition, string message)
+    {
+        if (!condition)
+        {
+            Console.WriteLine($"FAILED: {message}");
+            s_failed = true;
+        }
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static long CastLoop(object[] objects, int count)
+    {
+        long hits = 0;
+        for (int i = 0; i < count; i++)
+        {
+            // Variant casts are not resolved by the JIT helpers' fast paths and go through the cast cache
+            if (objects[i & 15] is IEnumerable<object>)
+            {
+                hits++;
+            }
+        }
+        return hits;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static long CallLoop(IShape[] shapes, int count)
+    {
+        long area = 0;
+        for (int i = 0; i < count; i++)
+        {
+            area += shapes[i & 15].Area();
+        }
+        return area;
+    }
+
+    private static IShape[] Shapes(int typeCount)
+    {
+        IShape[] shapes = new IShape[16];
+        for (int i = 0; i < shapes.Length; i++)
+        {
+            shapes[i] = s_allShapes[i % typeCount];
+        }
+        return shapes;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static long ThreadStaticLoop(int count)
+    {
+        t_counter = 0;
+        for (int i = 0; i < count; i++)
+        {
+            t_counter++;
+        }
+        return t_counter;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static long LockLoop(object lockObject, ref long counter, int count)
+    {
+        for (int i = 0; i < count; i++)
+        {
+            lock (lockObject)
+            {
+                counter++;
+            }
+        }
+        return count;
+    }
+
+    private static object InflatedLock()
+    {
+        // A hash code in the object header forces the lock into a sync block, so that
+        // locking goes through AwareLock rather than the thin lock
+        object lockObject = new object();
+        lockObject.GetHashCode();
+        return lockObject;
+    }
+
+    private static long ContendedLock(object lockObject, int threadCount, int countPerThread)
+    {
+        long counter = 0;
+        using Barrier barrier = new Barrier(threadCount);
+        Thread[] threads = new Thread[threadCount];
+        for (int t = 0; t < threadCount; t++)
+        {
+            threads[t] = new Thread(() =>
+            {
+                barrier.SignalAndWait();
+                LockLoop(lockObject, ref counter, countPerThread);
+            });
+            threads[t].Start();
+        }
+        foreach (Thread thread in threads)
+        {
+            thread.Join();
+        }
+        return counter;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static long PInvokeLoop(int count)
+    {
+        int value = 0;
+        for (int i = 0; i < count; i++)
+        {
+            value = Increment(value);
+        }
+        return value;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static long InternLoop(string[] strings, int count)
+    {
+        long length = 0;
+        for (int i = 0; i < count; i++)
+        {
+            length += string.Intern(strings[i & 1023]).Length;
+        }
+        return length;
+    }
+
+    private static long LoadTypes(Type openType)
+    {
+        long count = 0;
+        foreach (Type first in s_typeArguments)
+        {
+            foreach (Type second in s_typeArguments)
+            {
+                count += openType.MakeGenericType(first, second).TypeHandle.Value != IntPtr.Zero ? 1 : 0;
+            }
+        }
+        return count;
+    }
+
+    public static int Main(string[] args)
+    {
+        if (args.Length > 0)
+        {
+            s_scale = Math.Max(1, int.Parse(args[0], CultureInfo.InvariantCulture));
+        }
+        int n = Iterations * s_scale;
+
+        // Cast cache
+        object[] variantHits = new object[16];
+        object[] variantMisses = new object[16];
+        object[] variantRotating = new object[16];
+        for (int i = 0; i < 16; i++)
+        {
+            variantHits[i] = new List<string>();
+            variantMisses[i] = new List<int>();
+            variantRotating[i] = Array.CreateInstance(typeof(List<>).MakeGenericType(typeof(Impl<>).MakeGenericType(s_typeArguments[i])), 0);
+        }
+        Check(CastLoop(variantHits, 16) == 16 && CastLoop(variantMisses, 16) == 0 && CastLoop(variantRotating, 16) == 16, "unexpected cast results");
+        Measure("CastCache.Hit", n, run => CastLoop(variantHits, n));
+        Measure("CastCache.NegativeHit", n, run => CastLoop(variantMisses, n));
+        Measure("CastCache.RotatingTypes", n, run => CastLoop(variantRotating, n));
+
+        // Virtual stub dispatch
+        Check(CallLoop(Shapes(16), 16) == 16, "unexpected interface call results");
+        IShape[] monomorphic = Shapes(1);
+        IShape[] polymorphic = Shapes(3);
+        IShape[] megamorphic = Shapes(16);
+        Measure("VirtualStubDispatch.Monomorphic", n, run => CallLoop(monomorphic, n));
+        Measure("VirtualStubDispatch.Polymorphic", n, run => CallLoop(polymorphic, n));
+        Measure("VirtualStubDispatch.Megamorphic", n, run => CallLoop(megamorphic, n));
+
+        // Thread statics
+        Check(ThreadStaticLoop(16) == 16, "unexpected thread static value");
+        Measure("ThreadStatic.Increment", n, run => ThreadStaticLoop(n));
+
+        // AwareLock
+        object lockObject = InflatedLock();
+        long lockCounter = 0;
+        Measure("AwareLock.Uncontended", n, run => LockLoop(lockObject, ref lockCounter, n));
+        int threadCount = Math.Clamp(Environment.ProcessorCount, 2, 4);
+        int perThread = n / (threadCount * 4);
+        Check(ContendedLock(lockObject, threadCount, 16) == threadCount * 16, "lost updates under the lock");
+        Measure("AwareLock.Contended", (long)perThread * threadCount, run => ContendedLock(lockObject, threadCount, perThread));
+
+        // Transitions
+        Check(PInvokeLoop(16) == 16, "unexpected P/Invoke result");
+        Check(CallbackLoop(&ManagedIncrement, 16) == 16, "unexpected reverse P/Invoke result");
+        Measure("PInvoke.Transition", n, run => PInvokeLoop(n));
+        Measure("ReversePInvoke.Transition", n, run => CallbackLoop(&ManagedIncrement, n));
+
+        // String interning. An ldstr is resolved when its method is compiled, so
+        // the lookup of already interned strings is what runs repeatedly.
+        string[] strings = new string[1024];
+        for (int i = 0; i < strings.Length; i++)
+        {
+            strings[i] = string.Intern(new string('s', 1) + i.ToString(CultureInfo.InvariantCulture));
+        }
+        Measure("StringIntern.Hit", n, run => InternLoop(strings, n));
+
+        // Type loads, each run loads 256 new generic instantiations
+        int typesPerRun = s_typeArguments.Length * s_typeArguments.Length;
+        Measure("TypeLoad.GenericInstantiation", typesPerRun, run => LoadTypes(s_openGenericTypes[run]), warmUp: false);
+
+        if (s_failed)
+        {
+            return 101;
+        }
+
+        Console.WriteLine($"PASSED (checksum {s_checksum})");
+        return 100;
+    }
+}
@@ -0,0 +1,23 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+#include <platformdefines.h>
+
+// Target of the P/Invoke transition benchmark, does as little as possible
+extern "C" DLL_EXPORT int STDMETHODCALLTYPE Increment(int value)
+{
+    return value + 1;
+}
+
+// Drives the reverse P/Invoke transition benchmark: calls back into managed code
+// the given number of times from a single native frame
+typedef int (STDMETHODCALLTYPE *PFNINCREMENT)(int);
+extern "C" DLL_EXPORT int STDMETHODCALLTYPE CallbackLoop(PFNINCREMENT callback, int count)
+{
+    int value = 0;
+    for (int i = 0; i < count; i++)
+    {
+        value = callback(value);
+    }
+    return value;
+}
@@ -0,0 +1,74 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+using System;
+using System.Diagnostics;
+using System.Runtime.CompilerServices;
+using System.Threading;
+
+// Measures throw-to-catch latency for exceptions used for control flow: the same
+// exception is thrown through the same few frames over and over, the way timeouts
+// and cancellation are in services. The latency is reported so it can be tracked
+// over time; the test only fails if an exception is not caught where expected.
+public class ThrowCatchLatency
+{
+    private const int WarmupIterations = 1000;
+    private const int Iterations = 20000;
+    private const int Depth = 8;
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static int Recurse(int depth, Exception ex)
+    {
+        if (depth == 0)
+        {
+            throw ex;
+        }
+
+        return Recurse(depth - 1, ex) + 1;
+    }
+
+    private static int ThrowAndCatch(int iterations, Exception ex)
+    {
+        int caught = 0;
+        for (int i = 0; i < iterations; i++)
+        {
+            try
+            {
+                Recurse(Depth, ex);
+            }
+            catch (OperationCanceledException)
+            {
+                caught++;
+            }
+        }
+        return caught;
+    }
+
+    public static int Main()
+    {
+        // Preallocated, like a cached cancellation exception
+        Exception ex = new OperationCanceledException(CancellationToken.None);
+
+        if (ThrowAndCatch(WarmupIterations, ex) != WarmupIterations)
+        {
+            Console.WriteLine("FAILED: not every warmup exception was caught");
+            return 101;
+        }
+
+        Stopwatch sw = Stopwatch.StartNew();
+        int caught = ThrowAndCatch(Iterations, ex);
+        sw.Stop();
+
+        if (caught != Iterations)
+        {
+            Console.WriteLine("FAILED: caught {0} of {1} exceptions", caught, Iterations);
+            return 101;
+        }
+
+        double usPerThrow = sw.Elapsed.TotalMilliseconds * 1000.0 / Iterations;
+        Console.WriteLine("Throw-to-catch latency through {0} frames: {1:F2} us ({2} iterations)", Depth, usPerThrow, Iterations);
+
+        Console.WriteLine("PASSED");
+        return 100;
+    }
+}